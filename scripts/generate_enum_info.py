@@ -80,6 +80,8 @@ def main(args):
 
             for enum_name, enumerators in enum_class_name_to_enumerator_value_pair.items():
                 # std::vector の生成（単に列挙子を並べる）
+                # NOTE: クラステンプレートの静的メンバの明示的特殊化なので, template<>が必要. MSVCは省略しても通るがGCCは通らない
+                dest_file.write('template<>\n')
                 dest_file.write(f'std::vector<{enum_name}> EnumInfo<{enum_name}>::enumerators =\n')
                 dest_file.write('{\n')
                 for enumerator in enumerators:
@@ -87,6 +89,7 @@ def main(args):
                 dest_file.write('};\n\n')
 
                 # std::unordered_map の生成
+                dest_file.write('template<>\n')
                 dest_file.write(f'std::unordered_map<std::string, {enum_name}> EnumInfo<{enum_name}>::name_to_enum_map =\n')
                 dest_file.write('{\n')
                 for enumerator in enumerators:
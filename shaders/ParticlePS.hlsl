@@ -42,9 +42,11 @@ float4 main(VSOutput input) : SV_TARGET
     // スプライトの左上のUVオフセットを計算
     const float2 uv_offset = spriteSize * float2(column, row);
 
-    // サンプリング
-    const uint i_texture = GetValue(particles[input.i_particle].packed_data, i_texture_mask, i_texture_shift);
-    float4 texColor = g_textures.Sample(g_sampler, float3(uv_offset + input.uv * spriteSize, i_texture));
+    // シートのUVをアトラスのページのUVに変換してサンプリング
+    const SpriteTextureInfo texinfo = g_texinfos[input.i_texture];
+    const float2 sheet_uv = uv_offset + input.uv * spriteSize;
+    const float2 atlas_uv = float2(texinfo.uv_offset_x, texinfo.uv_offset_y) + sheet_uv * float2(texinfo.uv_scale_x, texinfo.uv_scale_y);
+    float4 texColor = g_textures.Sample(g_sampler, float3(atlas_uv, texinfo.page));
     
     // TODO: アルファ値の計算(particle.ageなどから)
     texColor.a *= particles[input.i_particle].alpha;
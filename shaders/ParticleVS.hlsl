@@ -8,6 +8,7 @@ cbuffer g_buffer_0 : register(b0)
 cbuffer b_guffer_1 : register(b1)
 {
     uint target_blend_mode;         // 描画対象ブレンドモード
+    uint instance_offset;           // インスタンスIDに足してパーティクルIDにする値. 生存パーティクルを詰めて描画する場合の開始位置
 }
 
 StructuredBuffer<Particle> particles : register(t0);
@@ -15,7 +16,7 @@ StructuredBuffer<Particle> particles : register(t0);
 VSOutput main(VSInput input)
 {    
     VSOutput output = (VSOutput) 0;
-    const uint id = input.instanceID;   // パーティクルID
+    const uint id = instance_offset + input.instanceID;   // パーティクルID
     const uint particle_size = particles[id].size;
     
     // 描画対象外のチェック
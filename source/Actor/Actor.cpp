@@ -23,9 +23,14 @@ Actor::Actor()
 	, _should_call_tick_actor(true)
 	, _should_call_draw(true)
 	, _is_draw_area_check_ignored(false)
+	, _is_stationary(false)
 	, _should_sort_components(false)
 	, _should_destroy(false)
 	, _parent_actor(nullptr)
+	, _index_in_scene(-1)
+	, _index_in_actors_to_add(-1)
+	, _index_in_actors_to_remove(-1)
+	, _scene_serial(0)
 {
 	if (debug_out_file && !debug_actor_log_body)
 	{
@@ -70,12 +75,19 @@ void Actor::Finalize()
 	_movement_component = nullptr;
 	_draw_priority = 0;
 	_bounding_circle_radius = 0.f;
-	_should_call_tick_actor = true;
 	_should_call_draw = true;
 	_is_draw_area_check_ignored = false;
+	_is_stationary = false;
 	_should_sort_components = false;
 	_should_destroy = false;
 	_parent_actor = nullptr;
+	_render_interpolation_offset = Vector2D();
+
+	// NOTE: シーンに追加されたままFinalize()=>Initialize()される場合(StageInteractiveScene::ReloadActorInStage())もあるので,
+	// 更新の設定はスケジューラーに通知しながら戻す. _index_in_~, _scene_serial, _draw_order_stateはシーンが管理するので触らない
+	SetShouldCallTickActor(true);
+	SetTickRate(EActorTickRate::EveryFrame);
+	SetTickRateReductionAllowed(false);
 }											  
 
 bool Actor::IsDespawnable() const
@@ -206,6 +218,7 @@ void Actor::RequestToSetActorHidden(const bool new_hidden)
 
 void Actor::ApplyDamage(const DamageInfo& damage_info)
 {
+	WakeTick();
 	TakeDamage(damage_info);
 }
 
@@ -245,7 +258,56 @@ bool Actor::IsInitialized() const
 
 void Actor::SetShouldCallTickActor(const bool should_call)
 {
+	if (_should_call_tick_actor == should_call)
+	{
+		return;
+	}
+
 	_should_call_tick_actor = should_call;
+	NotifyTickStateChanged();
+}
+
+void Actor::SetTickRate(const EActorTickRate new_tick_rate)
+{
+	if (_tick_state.rate == new_tick_rate)
+	{
+		return;
+	}
+
+	_tick_state.rate = new_tick_rate;
+	NotifyTickStateChanged();
+}
+
+EActorTickRate Actor::GetTickRate() const
+{
+	return _tick_state.rate;
+}
+
+void Actor::SetTickRateReductionAllowed(const bool is_allowed)
+{
+	if (_tick_state.is_rate_reduction_allowed == is_allowed)
+	{
+		return;
+	}
+
+	_tick_state.is_rate_reduction_allowed = is_allowed;
+	NotifyTickStateChanged();
+}
+
+void Actor::WakeTick()
+{
+	if (_owner_scene)
+	{
+		_owner_scene->GetActorTickScheduler().RequestWake(this);
+	}
+}
+
+void Actor::NotifyTickStateChanged()
+{
+	if (_owner_scene)
+	{
+		_owner_scene->GetActorTickScheduler().OnActorTickStateChanged(this);
+	}
 }
 
 void Actor::SetShouldCallDraw(const bool shoud_call)
@@ -330,6 +392,11 @@ Vector2D Actor::GetActorWorldPosition() const
 	return _root_component->GetWorldPosition();
 }
 
+Vector2D Actor::GetActorRenderPosition() const
+{
+	return GetActorWorldPosition() + _render_interpolation_offset;
+}
+
 void Actor::SetActorWorldPosition(const Vector2D& new_position)
 {
 	_root_component->SetWorldPosition(new_position);
@@ -423,6 +490,16 @@ void Actor::SetDrawAreaCheckIgnored(const bool new_draw_check_area_ignored)
 	_is_draw_area_check_ignored = new_draw_check_area_ignored;
 }
 
+bool Actor::IsStationary() const
+{
+	return _is_stationary;
+}
+
+void Actor::SetStationary(const bool is_stationary)
+{
+	_is_stationary = is_stationary;
+}
+
 float Actor::GetBoundingCircleRadius() const
 {
 	return _bounding_circle_radius;
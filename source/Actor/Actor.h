@@ -10,8 +10,11 @@
 #include "Component/SceneComponent.h"
 #include "Component/MovementComponent.h"
 #include "GameSystems/GameObjectManager.h"
+#include "GameSystems/ActorTickScheduler.h"
+#include "GameSystems/ActorDrawOrder.h"
 #include "GameSystems/Sound/SoundInstance.h"
 #include "Component/Collider/HitResult.h"
+#include "GameSystems/MasterData/internal/MasterDataBase.h"
 
 class SceneBase;
 
@@ -21,6 +24,10 @@ CLN2D_GEN_DEFINE_ACTOR()
 /// </summary>
 class Actor : public GameObject
 {
+	friend class SceneBase;
+	friend class ActorTickScheduler;
+	friend class ActorDrawOrder;
+
 public:
 	Actor();
 	virtual ~Actor();
@@ -106,6 +113,12 @@ protected:
 	//~ End Actor interface
 
 public:
+	/// <summary>
+	/// このクラスのアクターが生成するパーティクル(MdParticleのID)をout_particle_idsに追加する. ステージの読み込み時にスプライトを先読みするために使う
+	/// <para>ActorFactory::CollectUsedParticleIdsByEntityType()から呼ばれる. 派生クラスは同名の静的関数を定義して隠す. Actorでは何も追加しない</para>
+	/// </summary>
+	static void CollectUsedParticleIds(std::vector<MasterDataID>& out_particle_ids) {}
+
 	void SetScene(SceneBase* const in_owner_scene);
 	SceneBase* GetScene() const;
 
@@ -114,6 +127,24 @@ public:
 	bool ShouldCallDraw() const;
 	bool IsHidden() const;
 
+	/// <summary>
+	/// 更新頻度を設定する. シーンのActorTickSchedulerのバケットが移動する
+	/// <para>動かないアクター(ブロックなど)はSleepにすると, 衝突やダメージで起こされたときだけ更新される</para>
+	/// </summary>
+	void SetTickRate(const EActorTickRate new_tick_rate);
+	EActorTickRate GetTickRate() const;
+
+	/// <summary>
+	/// カメラから遠いときに更新頻度を自動で下げてよいか. 既定はfalse
+	/// <para>下げられたアクターは数フレーム分の経過時間をまとめて1回で更新されるので, 移動するアクターや衝突判定を持つアクターはtrueにしない(すり抜けの原因になる)</para>
+	/// </summary>
+	void SetTickRateReductionAllowed(const bool is_allowed);
+
+	/// <summary>
+	/// Sleepのアクターを次のフレームで1回だけ更新させる
+	/// </summary>
+	void WakeTick();
+
 	/// <summary>
 	/// このアクターと, 子アクターに破壊フラグを立てる.
 	/// <para>フラグが立っているアクターはSceneBaseによって破壊される</para>
@@ -126,6 +157,11 @@ public:
 	/// </summary>
 	SceneComponent* GetRootComponent() const;
 
+	/// <summary>
+	/// アクターが所有する全コンポーネントを取得
+	/// </summary>
+	const std::vector<ComponentBase*>& GetComponents() const { return _components; }
+
 	/// <summary>
 	/// ルートコンポーネントを他アクターのルートコンポーネントにアタッチする
 	/// </summary>
@@ -171,6 +207,16 @@ public:
 	/// </summary>
 	void AddActorLocalPosition(const Vector2D& delta_position);
 
+	/// <summary>
+	/// 描画に使う位置の, 現在位置からのずれ. シーンが固定ステップで更新している場合に, 最後の更新の前後の位置を補間して求められる
+	/// </summary>
+	const Vector2D& GetRenderInterpolationOffset() const { return _render_interpolation_offset; }
+
+	/// <summary>
+	/// 描画に使うワールド位置. GetActorWorldPosition() + GetRenderInterpolationOffset()
+	/// </summary>
+	Vector2D GetActorRenderPosition() const;
+
 	/// <summary>
 	/// ルートコンポーネントのワールド回転を取得
 	/// </summary>
@@ -213,6 +259,13 @@ public:
 	bool IsDrawAreaCheckIgnored() const;
 	void SetDrawAreaCheckIgnored(const bool new_draw_area_check_ignored);
 
+	/// <summary>
+	/// 初期位置から動かないアクターか. 既定はfalse
+	/// <para>StageActorStreamerはtrueのアクターを初期位置のセル単位でまとめてデスポーンさせ, 毎フレームの位置の判定を省く</para>
+	/// </summary>
+	bool IsStationary() const;
+	void SetStationary(const bool is_stationary);
+
 	/// <summary>
 	/// 描画判定用の外接円半径を取得
 	/// </summary>
@@ -288,8 +341,32 @@ private:
 	void AddChildActor(Actor* new_child);
 	void RemoveChildActor(Actor* child_to_remove);
 
+	/// <summary>
+	/// 更新に関する状態の変更をシーンのActorTickSchedulerに通知する
+	/// </summary>
+	void NotifyTickStateChanged();
+
 	SceneBase* _owner_scene;
 
+	// ActorTickSchedulerが管理する更新状態
+	ActorTickState _tick_state;
+
+	// ActorDrawOrderが管理する描画順の状態
+	ActorDrawOrderState _draw_order_state;
+
+	// SceneBase::_actors内の位置. シーンに追加されていない場合は-1
+	int _index_in_scene;
+
+	// SceneBase::_actors_to_add, _actors_to_remove内の位置. 追加/除外待ちでない場合は-1
+	int _index_in_actors_to_add;
+	int _index_in_actors_to_remove;
+
+	// シーンに登録された順の通し番号. ワールドのハッシュ値をアドレスに依存しない順序で求めるのに使う
+	uint32_t _scene_serial;
+
+	// ActorTickSchedulerが最後の更新の前後の位置から求めた, 描画位置のずれ
+	Vector2D _render_interpolation_offset;
+
 	bool _is_initialized;
 	bool _should_call_tick_actor;
 	bool _should_call_draw;
@@ -317,6 +394,9 @@ private:
 	// hiddenでない限り常に描画するか
 	bool _is_draw_area_check_ignored;
 
+	// 初期位置から動かないか
+	bool _is_stationary;
+
 	// 描画対象判定円の半径.
 	float _bounding_circle_radius;
 
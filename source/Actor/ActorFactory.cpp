@@ -54,6 +54,30 @@ std::shared_ptr<ActorInitialParams> ActorFactory::CreateInitialParamsByEntityTyp
     return nullptr;
 }
 
+#define PARTICLE_IDS_SWITCH_CASE(ET) case ET: matching_actor_of_entitytype_t<ET>::CollectUsedParticleIds(out_particle_ids); return
+void ActorFactory::CollectUsedParticleIdsByEntityType(const EEntityType entity_type, std::vector<MasterDataID>& out_particle_ids)
+{
+    switch (entity_type)
+    {
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::Actor);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::WalkingEnemy);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::FlyingEnemy);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::TacklingEnemy);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::ThrowingEnemy);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::Player);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::RectangleBlock);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::SlopeBlock);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::SlopeBlock2);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::GoalFlag);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::Coin);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::ItemActor);
+        PARTICLE_IDS_SWITCH_CASE(EEntityType::CrackedBrick);
+        // TODO: 有効な列挙子全てをここに
+    }
+
+    throw std::runtime_error("entity_type is unknown or unregisterd to ActorFactory::CollectUsedParticleIdsByEntityType()");
+}
+
 void ActorFactory::DestroyActor(Actor*& actor)
 {
 	GameObjectManager::GetInstance().DestroyObject(actor);
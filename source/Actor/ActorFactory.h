@@ -7,6 +7,8 @@
 #include <unordered_map>
 #include <functional>
 #include <type_traits>
+#include <vector>
+#include "GameSystems/MasterData/internal/MasterDataBase.h"
 
 class Actor;
 class SceneBase;
@@ -32,6 +34,11 @@ public:
 	/// <returns></returns>
 	static std::shared_ptr<ActorInitialParams> CreateInitialParamsByEntityType(const EEntityType entity_type);
 
+	/// <summary>
+	/// entity_typeに対応するアクターが生成するパーティクル(MdParticleのID)をout_particle_idsに追加する
+	/// </summary>
+	static void CollectUsedParticleIdsByEntityType(const EEntityType entity_type, std::vector<MasterDataID>& out_particle_ids);
+
 	/// <summary>
 	/// アクターを破棄する
 	/// </summary>
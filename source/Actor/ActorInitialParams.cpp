@@ -1,6 +1,8 @@
 #include "ActorInitialParams.h"
 #include "AllActorsInclude_generated.h"
 #include "Scene/StageInteractiveScene/StageEditorScene/ParameterEditing/ParameterEditingInclude.h"
+#include "Scene/StageInteractiveScene/StageEditorScene/ParameterEditing/TransformParamEdit.h"
+#include "Utility/Core/Math/MathJson.h"
 
 namespace {
 	constexpr const char* JKEY_DRAW_PRIORITY = "drawPriority";
@@ -16,14 +18,14 @@ void ActorInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
 	initial_params_json[JKEY_DRAW_PRIORITY] = _draw_priority;
 	physics.ToJsonObject(initial_params_json[JKEY_PHYSICS]);
-	transform.ToJsonObject(initial_params_json[JKEY_TRANSFORM]);
+	MathJson::ToJsonObject(transform, initial_params_json[JKEY_TRANSFORM]);
 }
 
 void ActorInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
 	initial_params_json.at(JKEY_DRAW_PRIORITY).get_to(_draw_priority);
 	physics.FromJsonObject(initial_params_json.at(JKEY_PHYSICS));
-	transform.FromJsonObject(initial_params_json.at(JKEY_TRANSFORM));
+	MathJson::FromJsonObject(initial_params_json.at(JKEY_TRANSFORM), transform);
 }
 
 void ActorInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
@@ -36,7 +38,7 @@ void ActorInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGrou
 
 	/*constexpr size_t NUM_TRANSFORM_MEMBERS = 2;
 	const std::shared_ptr<ParamEditGroup> transform_group = std::make_shared<ParamEditGroup>(LABEL_TRANSFORM, NUM_TRANSFORM_MEMBERS);
-	transform.AddToParamEditGroup(transform_group, command_history);
+	AddTransformToParamEditGroup(transform, transform_group, command_history);
 	parent->AddChild(transform_group);*/
 
 	/*constexpr size_t NUM_PHYSICS_MEMBERS = 3;
@@ -47,7 +49,7 @@ void ActorInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGrou
 
 void ActorInitialParams::AddToParamEditGroup_Transform(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	transform.AddToParamEditGroup(parent, command_history);
+	AddTransformToParamEditGroup(transform, parent, command_history);
 }
 
 void ActorInitialParams::AddToParamEditGroup_Physics(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
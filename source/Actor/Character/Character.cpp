@@ -19,7 +19,7 @@ Character::Character()
 
 void Character::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
 	using InitialParamsType = initial_params_of_actor_t<Character>;
 	const InitialParamsType* character_params = dynamic_cast<const InitialParamsType*>(actor_params);
 	assert(character_params);
@@ -47,14 +47,23 @@ void Character::Initialize(const ActorInitialParams* actor_params)
 
 	_is_movement_input_enabled = true;
 
+	for (auto& query : _ground_probe_queries)
+	{
+		query.ignore_actors.assign(1, this);
+		query.hit_object_types = static_cast<CollisionObjectType_UnderlyingType>(CollisionObjectType::GROUND);
+	}
+
 	_body_collider = CreateComponent<BoxCollider>(this);
 	SetupBodyCollider(_body_collider);
 	_body_collider->SetLocalPosition(Vector2D{});
+
+	// 高所からの落下で足場の薄いコライダーを通り抜けないようにする
+	_body_collider->SetContinuousCollisionEnabled(true);
 }
 
 void Character::TickActor(float delta_seconds)
 {
-	__super::TickActor(delta_seconds);
+	Actor::TickActor(delta_seconds);
 
 	UpdateWalkingDirectionAndGroundNormal();
 
@@ -112,13 +121,13 @@ void Character::Finalize()
 	_is_undamageable = false;
 	_last_ground_normal = Vector2D{};
 
-	__super::Finalize();
+	Actor::Finalize();
 }
 
 
 void Character::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	Actor::OnHitCollision(hit_result);
 
 	if (!hit_result.has_hit || !hit_result.self_collider || !hit_result.other_collider)
 	{
@@ -153,7 +162,7 @@ void Character::RequestToSetActorHidden(const bool new_hidden)
 {
 	if (!IsDead())
 	{
-		__super::RequestToSetActorHidden(new_hidden);
+		Actor::RequestToSetActorHidden(new_hidden);
 	}
 }
 
@@ -312,40 +321,18 @@ void Character::UpdateWalkingDirectionAndGroundNormal()
 	const float line_start_y = body_bottom + LINE_START_Y_OFFSET;
 	const float line_end_y = body_bottom + line_length;
 
-	QueryResult_SingleLineTrace query_result_left;
-	CollisionQueryParams_SingleLineTrace query_params_left;
-	query_params_left.ignore_actors.push_back(this);
-	query_params_left.hit_object_types = static_cast<CollisionObjectType_UnderlyingType>(CollisionObjectType::GROUND);
-	query_params_left.segment = FSegment{ Vector2D{body_left, line_start_y}, Vector2D{body_left, line_end_y} };
-	GetScene()->SingleLineTrace(query_result_left, query_params_left);
-	const float hit_sq_length_left = (query_result_left.hit_location.y - line_start_y);
-
-	QueryResult_SingleLineTrace query_result_left_long{};
-	CollisionQueryParams_SingleLineTrace query_params_left_long(query_params_left);
-	query_params_left_long.segment.end.y += _body_collider->GetBoxExtent().x;
-	GetScene()->SingleLineTrace(query_result_left_long, query_params_left_long);
-
-	QueryResult_SingleLineTrace query_result_right;
-	CollisionQueryParams_SingleLineTrace query_params_right;
-	query_params_right.ignore_actors.push_back(this);
-	query_params_right.hit_object_types = static_cast<CollisionObjectType_UnderlyingType>(CollisionObjectType::GROUND);
-	query_params_right.segment = FSegment{ Vector2D{body_right, line_start_y}, Vector2D{body_right, line_end_y} };
-	GetScene()->SingleLineTrace(query_result_right, query_params_right);
-	const float hit_sq_length_right = (query_result_right.hit_location.y - line_start_y);
-
-	QueryResult_SingleLineTrace query_result_right_long{};
-	CollisionQueryParams_SingleLineTrace query_params_right_long(query_params_right);
-	query_params_right_long.segment.end.y += _body_collider->GetBoxExtent().x;
-	GetScene()->SingleLineTrace(query_result_right_long, query_params_right_long);
-
-	QueryResult_SingleLineTrace query_result_center{};
-	CollisionQueryParams_SingleLineTrace query_params_center{};
 	const float center_start_y = body_bottom + LINE_START_Y_OFFSET;
 	const float center_end_y = body_bottom + _body_collider->GetBoxExtent().x;
-	query_params_center.ignore_actors.push_back(this);
-	query_params_center.hit_object_types = static_cast<CollisionObjectType_UnderlyingType>(CollisionObjectType::GROUND);
-	query_params_center.segment = FSegment{ Vector2D{body_position.x, center_start_y}, Vector2D{body_position.x, center_end_y} };
-	GetScene()->SingleLineTrace(query_result_center, query_params_center);
+	_ground_probe_queries[GROUND_PROBE_LEFT].segment = FSegment{ Vector2D{body_left, line_start_y}, Vector2D{body_left, line_end_y} };
+	_ground_probe_queries[GROUND_PROBE_LEFT_LONG].segment = FSegment{ Vector2D{body_left, line_start_y}, Vector2D{body_left, line_end_y + _body_collider->GetBoxExtent().x} };
+	_ground_probe_queries[GROUND_PROBE_RIGHT].segment = FSegment{ Vector2D{body_right, line_start_y}, Vector2D{body_right, line_end_y} };
+	_ground_probe_queries[GROUND_PROBE_RIGHT_LONG].segment = FSegment{ Vector2D{body_right, line_start_y}, Vector2D{body_right, line_end_y + _body_collider->GetBoxExtent().x} };
+	_ground_probe_queries[GROUND_PROBE_CENTER].segment = FSegment{ Vector2D{body_position.x, center_start_y}, Vector2D{body_position.x, center_end_y} };
+
+	// 全線分をまとめてトレースする
+	GetScene()->BatchedSingleLineTrace(_ground_probe_results.data(), _ground_probe_queries.data(), NUM_GROUND_PROBES);
+	const QueryResult_SingleLineTrace& query_result_left = _ground_probe_results[GROUND_PROBE_LEFT];
+	const QueryResult_SingleLineTrace& query_result_right = _ground_probe_results[GROUND_PROBE_RIGHT];
 
 	const Vector3D normal_left = Vector3D::MakeFromXY(query_result_left.hit_normal);
 	const Vector3D walk_dir_left = normal_left.Cross(Vector3D{ -1,0,0 }.Cross(normal_left));
@@ -5,6 +5,7 @@
 #include "Component/Collider/BoxCollider.h"
 #include "Component/Collider/HitResult.h"
 #include <vector>
+#include <array>
 #include <queue>
 #include <map>
 
@@ -161,6 +162,21 @@ private:
 	int _max_hp;
 	bool _is_undamageable;			// ダメージ無効化状態か. (ex)アイテムによる無敵状態, ダメージを受けた後のダメージ無効化
 	bool _is_movement_input_enabled;
+
+	// 地面の法線の検出に使う線分の番号
+	enum GroundProbeIndex : int
+	{
+		GROUND_PROBE_LEFT,
+		GROUND_PROBE_LEFT_LONG,
+		GROUND_PROBE_RIGHT,
+		GROUND_PROBE_RIGHT_LONG,
+		GROUND_PROBE_CENTER,
+		NUM_GROUND_PROBES
+	};
+
+	// 地面の法線の検出に使うクエリと結果. 毎Tick使いまわし, 無視するアクターの配列を確保し直さない
+	std::array<CollisionQueryParams_SingleLineTrace, NUM_GROUND_PROBES> _ground_probe_queries;
+	std::array<QueryResult_SingleLineTrace, NUM_GROUND_PROBES> _ground_probe_results;
 };
 
 template<>
@@ -26,7 +26,7 @@ namespace
 
 void CharacterInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	ActorInitialParams::ToJsonObject(initial_params_json);
 	initial_params_json[JKEY_MAX_HP] = max_hp;
 	initial_params_json[JKEY_LOOK_RIGHT] = look_right;
 	initial_params_json[JKEY_MAX_WALK_SPEED] = max_walk_speed;
@@ -35,7 +35,7 @@ void CharacterInitialParams::ToJsonObject(nlohmann::json& initial_params_json) c
 
 void CharacterInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	ActorInitialParams::FromJsonObject(initial_params_json);
 
 	initial_params_json.at(JKEY_MAX_HP).get_to(max_hp);
 	initial_params_json.at(JKEY_LOOK_RIGHT).get_to(look_right);
@@ -45,7 +45,7 @@ void CharacterInitialParams::FromJsonObject(const nlohmann::json& initial_params
 
 void CharacterInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	ActorInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup<EditParamType::INT>(
 		parent,
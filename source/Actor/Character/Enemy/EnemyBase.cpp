@@ -25,7 +25,7 @@ EnemyBase::~EnemyBase()
 
 void EnemyBase::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Character::Initialize(actor_params);
 
 	const EnemyBaseInitialParams* enemy_params = dynamic_cast<const EnemyBaseInitialParams*>(actor_params);
 	_player_hit_damage = enemy_params->player_hit_damage;
@@ -43,7 +43,7 @@ void EnemyBase::Initialize(const ActorInitialParams* actor_params)
 
 void EnemyBase::TickActor(float delta_seconds)
 {
-	__super::TickActor(delta_seconds);
+	Character::TickActor(delta_seconds);
 
 	if(!IsDead())
 	{
@@ -56,12 +56,12 @@ void EnemyBase::TickActor(float delta_seconds)
 void EnemyBase::Finalize()
 {
 	UnbindEvents();
-	__super::Finalize();
+	Character::Finalize();
 }
 
 void EnemyBase::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	Character::OnHitCollision(hit_result);
 
 	if (GetScene()->GetSceneType() != SceneType::INGAME_SCENE)
 	{
@@ -87,7 +87,7 @@ void EnemyBase::OnHitCollision(const HitResult& hit_result)
 
 void EnemyBase::TakeDamage(const DamageInfo& damage_info)
 {
-	__super::TakeDamage(damage_info);
+	Character::TakeDamage(damage_info);
 
 	SetMovementInputEnabled(false);
 
@@ -110,7 +110,7 @@ void EnemyBase::TakeDamage(const DamageInfo& damage_info)
 
 void EnemyBase::OnDead(const CharacterDeathInfo* death_info)
 {
-	__super::OnDead(death_info);
+	Character::OnDead(death_info);
 
 	SetMovementInputEnabled(false);
 	GetCharacterMovementComponent()->SetMovementMode(CharacterMovementMode::Falling);
@@ -14,17 +14,17 @@ EnemyBaseInitialParams::EnemyBaseInitialParams()
 
 void EnemyBaseInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	CharacterInitialParams::ToJsonObject(initial_params_json);
 	initial_params_json[JSON_KEY_PLAYER_HIT_DAMAGE] = player_hit_damage;
 }
 
 void EnemyBaseInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	CharacterInitialParams::FromJsonObject(initial_params_json);
 	initial_params_json.at(JSON_KEY_PLAYER_HIT_DAMAGE).get_to(player_hit_damage);
 }
 
 void EnemyBaseInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	CharacterInitialParams::AddToParamEditGroup(parent, command_history);
 }
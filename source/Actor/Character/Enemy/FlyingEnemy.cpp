@@ -44,7 +44,7 @@ FlyingEnemy::~FlyingEnemy()
 
 void FlyingEnemy::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	EnemyBase::Initialize(actor_params);
 
 	_destination_update_time = GetScene()->GetWorldTime() + DETINATION_UPDATE_INTERVAL;
 
@@ -58,12 +58,12 @@ void FlyingEnemy::Finalize()
 {
 	_destination.reset();
 
-	__super::Finalize();
+	EnemyBase::Finalize();
 }
 
 void FlyingEnemy::TakeDamage(const DamageInfo& damage_info)
 {
-	__super::TakeDamage(damage_info);
+	EnemyBase::TakeDamage(damage_info);
 
 	if (damage_info.damage_type == DamageType::Punch)
 	{
@@ -83,7 +83,7 @@ void FlyingEnemy::TakeDamage(const DamageInfo& damage_info)
 
 void FlyingEnemy::OnDead(const CharacterDeathInfo* death_info)
 {
-	__super::OnDead(death_info);
+	EnemyBase::OnDead(death_info);
 
 	GetAnimRenderer()->SetOverrideAnimation(FlyingEnemyAnimPlayInfo_Damaged, 0.f);
 }
@@ -95,7 +95,7 @@ std::vector<CollisionObjectType> FlyingEnemy::GetHitTargetTypes() const
 
 void FlyingEnemy::TickEnemy(const float delta_seconds)
 {
-	__super::TickEnemy(delta_seconds);
+	EnemyBase::TickEnemy(delta_seconds);
 
 	if (!_ingame_scene_ref)
 	{
@@ -61,7 +61,7 @@ TacklingEnemy::~TacklingEnemy()
 
 void TacklingEnemy::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	EnemyBase::Initialize(actor_params);
 
 	_next_flip_time = GetScene()->GetWorldTime() + FLIP_INTERVAL;
 	_default_walk_speed = GetCharacterMovementComponent()->_max_walk_speed;
@@ -73,7 +73,7 @@ void TacklingEnemy::Finalize()
 	_move_state = TacklingEnemyMoveState::Idle;
 	_player_lost_time = 0.f;
 
-	__super::Finalize();
+	EnemyBase::Finalize();
 }
 
 void TacklingEnemy::OnHitCollision(const HitResult& hit_result)
@@ -110,7 +110,7 @@ void TacklingEnemy::OnHitCollision(const HitResult& hit_result)
 	}
 	else
 	{
-		__super::OnHitCollision(hit_result);
+		EnemyBase::OnHitCollision(hit_result);
 	}
 }
 
@@ -126,21 +126,21 @@ void TacklingEnemy::TakeDamage(const DamageInfo& damage_info)
 		return;
 	}
 
-	__super::TakeDamage(damage_info);
+	EnemyBase::TakeDamage(damage_info);
 
 	GetAnimRenderer()->SetOverrideAnimation(TacklingEnemyAnimPlayInfo_Damaged, 1.f);
 }
 
 void TacklingEnemy::OnDead(const CharacterDeathInfo* death_info)
 {
-	__super::OnDead(death_info);
+	EnemyBase::OnDead(death_info);
 
 	GetAnimRenderer()->SetOverrideAnimation(TacklingEnemyAnimPlayInfo_Damaged, 0.f);
 }
 
 void TacklingEnemy::TickEnemy(const float delta_seconds)
 {
-	__super::TickEnemy(delta_seconds);
+	EnemyBase::TickEnemy(delta_seconds);
 
 	switch (_move_state)
 	{
@@ -46,22 +46,22 @@ WalkingEnemy::~WalkingEnemy()
 
 void WalkingEnemy::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	EnemyBase::Initialize(actor_params);
 }
 
 void WalkingEnemy::Draw(const CameraParams& camera_params)
 {
-	__super::Draw(camera_params);
+	EnemyBase::Draw(camera_params);
 }
 
 void WalkingEnemy::Finalize()
 {
-	__super::Finalize();
+	EnemyBase::Finalize();
 }
 
 void WalkingEnemy::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	EnemyBase::OnHitCollision(hit_result);
 
 	const CollisionObjectType hit_obj_type = hit_result.other_collider->GetCollisionObjectType();
 	
@@ -81,7 +81,7 @@ void WalkingEnemy::OnHitCollision(const HitResult& hit_result)
 
 void WalkingEnemy::TakeDamage(const DamageInfo& damage_info)
 {
-	__super::TakeDamage(damage_info);
+	EnemyBase::TakeDamage(damage_info);
 
 	if(damage_info.damage_type == DamageType::Punch)
 	{
@@ -101,14 +101,14 @@ void WalkingEnemy::TakeDamage(const DamageInfo& damage_info)
 
 void WalkingEnemy::OnDead(const CharacterDeathInfo* death_info)
 {
-	__super::OnDead(death_info);
+	EnemyBase::OnDead(death_info);
 
 	GetAnimRenderer()->SetOverrideAnimation(WalkingEnemyAnimPlayInfo_Damaged, 0.f);
 }
 
 void WalkingEnemy::TickEnemy(const float delta_seconds)
 {
-	__super::TickEnemy(delta_seconds);
+	EnemyBase::TickEnemy(delta_seconds);
 
 	if (!IsFacingAbyss())
 	{
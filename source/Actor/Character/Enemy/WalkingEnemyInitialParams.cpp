@@ -2,7 +2,7 @@
 
 void WalkingEnemyInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	EnemyBaseInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup_MaxWalkSpeed(parent, command_history);
 }
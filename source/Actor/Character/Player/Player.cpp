@@ -124,7 +124,7 @@ Player::~Player()
 
 void Player::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Character::Initialize(actor_params);
 
 	auto player_params = dynamic_cast<const initial_params_of_actor_t<Player>*>(actor_params);
 	_max_sp = player_params->_max_sp;
@@ -174,7 +174,7 @@ void Player::Initialize(const ActorInitialParams* actor_params)
 
 void Player::TickActor(float delta_seconds)
 {
-	__super::TickActor(delta_seconds);
+	Character::TickActor(delta_seconds);
 	_state_stack->Tick(*this, delta_seconds);
 	_delta_position = GetActorWorldPosition() - _last_position;
 	_last_position = GetActorWorldPosition();
@@ -183,13 +183,13 @@ void Player::TickActor(float delta_seconds)
 
 void Player::Draw(const CameraParams& camera_params)
 {
-	__super::Draw(camera_params);
+	Character::Draw(camera_params);
 	_state_stack->Draw(*this, camera_params);
 }
 
 void Player::DrawForeground(const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(canvas_info);
+	Character::DrawForeground(canvas_info);
 	_state_stack->DrawForeground(*this, canvas_info);
 }
 
@@ -208,12 +208,12 @@ void Player::Finalize()
 	_is_sprinting = false;
 	_reflector_collider = nullptr;
 
-	__super::Finalize();
+	Character::Finalize();
 }
 
 void Player::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	Character::OnHitCollision(hit_result);
 
 	// ゴールとの接触
 	Actor* other_actor = hit_result.other_collider->GetOwnerActor();
@@ -265,7 +265,7 @@ void Player::RequestToSetActorHidden(const bool new_hidden)
 
 void Player::TakeDamage(const DamageInfo& damage_info)
 {
-	__super::TakeDamage(damage_info);
+	Character::TakeDamage(damage_info);
 
 	SetIsUndamageable(true);
 	GetBodyCollider()->RemoveHitTarget(CollisionObjectType::ENEMY);
@@ -293,7 +293,7 @@ void Player::StompCharacter(Character* const stomped_character)
 
 void Player::OnJump()
 {
-	__super::OnJump();
+	Character::OnJump();
 
 	_player_animator->ChangeState(PlayerAnimStateID_Jump);
 
@@ -309,7 +309,7 @@ void Player::OnLanded()
 
 void Player::OnDead(const CharacterDeathInfo* death_info)
 {
-	__super::OnDead(death_info);
+	Character::OnDead(death_info);
 
 	_state_stack->ChangeState(*this, _player_states.dead);
 
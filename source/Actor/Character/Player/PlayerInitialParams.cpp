@@ -12,14 +12,14 @@ namespace
 
 void PlayerInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	CharacterInitialParams::ToJsonObject(initial_params_json);
 
 	initial_params_json[JKEY_MAX_SP] = _max_sp;
 }
 
 void PlayerInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	CharacterInitialParams::FromJsonObject(initial_params_json);
 
 	initial_params_json.at(JKEY_MAX_SP).get_to(_max_sp);
 }
@@ -27,7 +27,7 @@ void PlayerInitialParams::FromJsonObject(const nlohmann::json& initial_params_js
 
 void PlayerInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	CharacterInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup<EditParamType::INT>(
 		parent,
@@ -14,7 +14,7 @@ namespace
 
 void PlayerState_Dead::OnEnter(Player& player)
 {
-	__super::OnEnter(player);
+	PlayerState::OnEnter(player);
 
 	player.SetDeadAnimation();
 	player.GetCharacterMovementComponent()->_gravity_scale = 0.f;
@@ -23,12 +23,12 @@ void PlayerState_Dead::OnEnter(Player& player)
 
 void PlayerState_Dead::OnLeave(Player& player)
 {
-	__super::OnLeave(player);
+	PlayerState::OnLeave(player);
 }
 
 void PlayerState_Dead::Tick(Player& player, float delta_seconds)
 {
-	__super::Tick(player, delta_seconds);
+	PlayerState::Tick(player, delta_seconds);
 
 	if (!_vanishment_time_passed && _timer >= VANISHMENT_START_TIME)
 	{
@@ -54,6 +54,6 @@ void PlayerState_Dead::Tick(Player& player, float delta_seconds)
 
 void PlayerState_Dead::DrawForeground(Player& player, const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(player, canvas_info);
+	PlayerState::DrawForeground(player, canvas_info);
 	player.DrawPlayerUI(canvas_info);
 }
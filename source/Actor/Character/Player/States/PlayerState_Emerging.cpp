@@ -4,7 +4,7 @@
 
 void PlayerState_Emerging::OnEnter(Player& player)
 {
-	__super::OnEnter(player);
+	PlayerState::OnEnter(player);
 	if (player.GetScene()->GetSceneType() != SceneType::INGAME_SCENE)
 	{
 		player._ingame_scene_ref = nullptr;
@@ -24,7 +24,7 @@ void PlayerState_Emerging::OnLeave(Player& player)
 {
 	player.player_events.OnPlayerEmergenceSequenceFinished.Dispatch();
 
-	__super::OnLeave(player);
+	PlayerState::OnLeave(player);
 }
 
 void PlayerState_Emerging::Tick(Player& player, float delta_seconds)
@@ -34,7 +34,7 @@ void PlayerState_Emerging::Tick(Player& player, float delta_seconds)
 		return;
 	}
 
-	__super::Tick(player, delta_seconds);
+	PlayerState::Tick(player, delta_seconds);
 	
 	_timer += delta_seconds;
 	if (_timer > 0.5f)
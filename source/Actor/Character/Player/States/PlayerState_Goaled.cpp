@@ -12,7 +12,7 @@ PlayerState_Goaled::PlayerState_Goaled()
 
 void PlayerState_Goaled::OnEnter(Player& player)
 {
-	__super::OnEnter(player);
+	PlayerState::OnEnter(player);
 
 	player.GetBodyCollider()->SetHitObjectTypes({ CollisionObjectType::GROUND });
 	player.StopJumping();
@@ -32,12 +32,12 @@ void PlayerState_Goaled::OnEnter(Player& player)
 void PlayerState_Goaled::OnLeave(Player& player)
 {
 
-	__super::OnLeave(player);
+	PlayerState::OnLeave(player);
 }
 
 void PlayerState_Goaled::Tick(Player& player, float delta_seconds)
 {
-	__super::Tick(player, delta_seconds);
+	PlayerState::Tick(player, delta_seconds);
 
 	_timer += delta_seconds;
 }
@@ -7,7 +7,7 @@
 
 void PlayerState_Playing::OnEnter(Player& player)
 {
-	__super::OnEnter(player);
+	PlayerState::OnEnter(player);
 
 	_should_show_controls = true;
 
@@ -34,7 +34,7 @@ void PlayerState_Playing::OnEnter(Player& player)
 
 void PlayerState_Playing::OnLeave(Player& player)
 {
-	__super::OnLeave(player);
+	PlayerState::OnLeave(player);
 
 	player.character_events.OnBeginFalling.UnBind(this);
 	player.character_events.OnLanded.UnBind(this);
@@ -42,7 +42,7 @@ void PlayerState_Playing::OnLeave(Player& player)
 
 void PlayerState_Playing::Tick(Player& player, float delta_seconds)
 {
-	__super::Tick(player, delta_seconds);
+	PlayerState::Tick(player, delta_seconds);
 
 	if (_is_jump_key_active)
 	{
@@ -61,7 +61,7 @@ void PlayerState_Playing::Tick(Player& player, float delta_seconds)
 
 void PlayerState_Playing::DrawForeground(Player& player, const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(player, canvas_info);
+	PlayerState::DrawForeground(player, canvas_info);
 	player.DrawPlayerUI(canvas_info);
 }
 
@@ -1,5 +1,6 @@
 #include "BlockBase.h"
 #include "GameSystems/MasterData/MasterDataInclude.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
 #include <DxLib.h>
 #include <DirectXTex.h>
 #include <d3dcompiler.h>
@@ -50,10 +51,14 @@ namespace {
 
 void BlockBase::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
 
 	SetDrawAreaCheckIgnored(true);
 
+	// 衝突やダメージで起こされたときだけ更新する. 初期位置から動かない
+	SetTickRate(EActorTickRate::Sleep);
+	SetStationary(true);
+
 	const BlockInitialParams* block_params = dynamic_cast<const BlockInitialParams*>(actor_params);
 	block_id = block_params->block_id;
 	_is_horizontal_flip_enabled = block_params->_is_horizontal_flip_enabled;
@@ -74,6 +79,12 @@ void BlockBase::Initialize(const ActorInitialParams* actor_params)
 		}
 	}
 
+	// ヘッドレス実行中は描画しないので, Direct3Dのリソースを作らない
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	// デバイスの取得
 	ID3D11Device* p_Device =
 		const_cast<ID3D11Device*>
@@ -284,12 +295,12 @@ void BlockBase::Initialize(const ActorInitialParams* actor_params)
 
 void BlockBase::TickActor(const float delta_seconds)
 {
-	__super::TickActor(delta_seconds);
+	Actor::TickActor(delta_seconds);
 }
 
 void BlockBase::Draw(const CameraParams& camera_params)
 {
-	__super::Draw(camera_params);
+	Actor::Draw(camera_params);
 
 	DxLib::RefreshDxLibDirect3DSetting();
 
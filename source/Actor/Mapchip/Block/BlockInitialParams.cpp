@@ -10,21 +10,21 @@ namespace {
 
 void BlockInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	ActorInitialParams::ToJsonObject(initial_params_json);
 	initial_params_json[JKEY_BLOCK_ID] = block_id;
 	initial_params_json[JKEY_HORIZONAL_FLIP] = _is_horizontal_flip_enabled;
 }
 
 void BlockInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	ActorInitialParams::FromJsonObject(initial_params_json);
 	initial_params_json.at(JKEY_BLOCK_ID).get_to(block_id);
 	initial_params_json.at(JKEY_HORIZONAL_FLIP).get_to(_is_horizontal_flip_enabled);
 }
 
 void BlockInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	ActorInitialParams::AddToParamEditGroup(parent, command_history);
 
 
 	AddChildParamEditNodeToGroup<EditParamType::BLOCK_SKIN>(
@@ -60,7 +60,7 @@ void RectangleBlock::Initialize(const ActorInitialParams* actor_params)
 	_tiles_x = rectangle_params->tile_count.x;
 	_tiles_y = rectangle_params->tile_count.y;
 
-	__super::Initialize(actor_params);
+	BlockBase::Initialize(actor_params);
 
 	collider = CreateComponent<BoxCollider>(this);
 	collider->SetBoxColliderParams(
@@ -70,6 +70,7 @@ void RectangleBlock::Initialize(const ActorInitialParams* actor_params)
 		false,
 		Vector2D(_tiles_x, _tiles_y)* UNIT_TILE_SIZE
 	);
+	collider->SetMobility(ColliderMobility::STATIC);
 
 	const float half_diagonal_length = Vector2D(UNIT_TILE_SIZE * _tiles_x, UNIT_TILE_SIZE * _tiles_y).Length() / 2.f;
 	SetBoundingCircleRadius(half_diagonal_length);
@@ -88,7 +89,7 @@ void RectangleBlock::GetWorldConvexPolygonVertices(std::vector<Vector2D>& out_ve
 void RectangleBlock::Finalize()
 {
 
-	__super::Finalize();
+	BlockBase::Finalize();
 }
 
 void RectangleBlock::GetOccupyingTiles(int& out_tile_x, int& out_tile_y, Vector2D& out_snap_position_to_actor_position) const
@@ -17,20 +17,20 @@ namespace {
 
 void RectangleBlockInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	BlockInitialParams::ToJsonObject(initial_params_json);
 	initial_params_json[JKEY_TILE_COUNT] = static_cast<std::array<int, 2>>(tile_count);
 }
 
 void RectangleBlockInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	BlockInitialParams::FromJsonObject(initial_params_json);
 	initial_params_json.at(JKEY_TILE_COUNT).at(0).get_to(tile_count.x);
 	initial_params_json.at(JKEY_TILE_COUNT).at(1).get_to(tile_count.y);
 }
 
 void RectangleBlockInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	BlockInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup<EditParamType::INT2>(
 		parent,
@@ -10,7 +10,7 @@ void SlopeBlock::Initialize(const ActorInitialParams* actor_params)
 	_scale = slope_params->scale;
 	_width_per_height = slope_params->width_per_height;
 
-	__super::Initialize(actor_params);
+	BlockBase::Initialize(actor_params);
 
 	// コライダーの初期化
 	const CollisionType collision_type = CollisionType::BLOCK;
@@ -32,6 +32,7 @@ void SlopeBlock::Initialize(const ActorInitialParams* actor_params)
 		pushability,
 		vertex_local_positions
 	);
+	_slope_collider->SetMobility(ColliderMobility::STATIC);
 
 	SetDrawAreaCheckIgnored(true);
 }
@@ -49,7 +50,7 @@ void SlopeBlock::GetWorldConvexPolygonVertices(std::vector<Vector2D>& out_vertex
 
 void SlopeBlock::Finalize()
 {
-	__super::Finalize();
+	BlockBase::Finalize();
 }
 
 void SlopeBlock::GetOccupyingTiles(int& out_tiles_x, int& out_tiles_y, Vector2D& out_snap_position_to_actor_position) const
@@ -18,21 +18,21 @@ namespace
 
 void SlopeBlockInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	BlockInitialParams::ToJsonObject(initial_params_json);
 	initial_params_json[JKEY_SCALE] = scale;
 	initial_params_json[JKEY_WIDTH_PER_HEIGHT] = width_per_height;
 }
 
 void SlopeBlockInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	BlockInitialParams::FromJsonObject(initial_params_json);
 	initial_params_json.at(JKEY_SCALE).get_to(scale);
 	initial_params_json.at(JKEY_WIDTH_PER_HEIGHT).get_to(width_per_height);
 }
 
 void SlopeBlockInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	BlockInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup<EditParamType::INT>(
 		parent,
@@ -13,7 +13,11 @@ Coin::~Coin()
 
 void Coin::Initialize(const initial_params_of_actor_t<Actor>* const actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
+
+	// 衝突やダメージで起こされたときだけ更新する. 初期位置から動かない
+	SetTickRate(EActorTickRate::Sleep);
+	SetStationary(true);
 
 	InAnimateRenderer* renderer = CreateComponent<InAnimateRenderer>(this);
 	renderer->SetIcon(360);
@@ -32,7 +36,7 @@ void Coin::Initialize(const initial_params_of_actor_t<Actor>* const actor_params
 
 void Coin::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	Actor::OnHitCollision(hit_result);
 
 	Player* hit_player = dynamic_cast<Player*>(hit_result.other_collider->GetOwnerActor());
 	if(IsValid(hit_player))
@@ -14,7 +14,11 @@ CrackedBrick::~CrackedBrick()
 
 void CrackedBrick::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
+
+	// 衝突やダメージで起こされたときだけ更新する. 初期位置から動かない
+	SetTickRate(EActorTickRate::Sleep);
+	SetStationary(true);
 
 	auto renderer = CreateComponent<InAnimateRenderer>(this);
 	renderer->SetIcon(MasterDataID(357));
@@ -27,20 +31,26 @@ void CrackedBrick::Initialize(const ActorInitialParams* actor_params)
 		false,
 		Vector2D{ UNIT_TILE_SIZE, UNIT_TILE_SIZE }
 	);
+	collider->SetMobility(ColliderMobility::STATIC);
 
 	_sound_instance_destroyed = SoundManager::GetInstance().MakeSoundInstance("resources/sounds/se/ingame_scene/se_cracked_block_destroyed.ogg");
 	_sound_instance_destroyed->SetVolume(50);
 	_sound_instance_destroyed->SetPlayToEndWhenDestroyed(true);
 }
 
+void CrackedBrick::CollectUsedParticleIds(std::vector<MasterDataID>& out_particle_ids)
+{
+	out_particle_ids.push_back(DESTROYED_PARTICLE_ID);
+}
+
 void CrackedBrick::Draw(const CameraParams& camera_params)
 {
-	__super::Draw(camera_params);
+	Actor::Draw(camera_params);
 }
 
 void CrackedBrick::TakeDamage(const DamageInfo& damage_info)
 {
-	__super::TakeDamage(damage_info);
+	Actor::TakeDamage(damage_info);
 
 	if (damage_info.damage_type == DamageType::Crush)
 	{
@@ -48,7 +58,7 @@ void CrackedBrick::TakeDamage(const DamageInfo& damage_info)
 
 		ParticleSpawnDesc desc{};
 		
-		desc.FromJsonObject(MasterHelper::GetParticleJson(MasterDataID(2)));
+		desc.FromJsonObject(MasterHelper::GetParticleJson(DESTROYED_PARTICLE_ID));
 		desc.SetSpawnTransform(GetActorWorldPosition(), Vector2D{ 0,-1 }, Transform{ Vector2D{}, 0.f });
 		ParticleManager::GetInstance().Spawn(desc, 20);
 
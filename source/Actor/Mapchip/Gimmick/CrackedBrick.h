@@ -19,8 +19,14 @@ public:
 protected:
 	virtual void TakeDamage(const DamageInfo& damage_info) override;
 	//~ End Actor interface
-	
+
+public:
+	static void CollectUsedParticleIds(std::vector<MasterDataID>& out_particle_ids);
+
 private:
+	// 破壊されたときに生成するパーティクル
+	static constexpr MasterDataID DESTROYED_PARTICLE_ID = 2;
+
 	std::shared_ptr<SoundInstance> _sound_instance_destroyed;
 };
 
@@ -22,7 +22,11 @@ GoalFlag::~GoalFlag()
 
 void GoalFlag::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
+
+	// 衝突やダメージで起こされたときだけ更新する. 初期位置から動かない
+	SetTickRate(EActorTickRate::Sleep);
+	SetStationary(true);
 
 	const MdGameIcon& icon = MdGameIcon::Get(GOAL_FLAG_ICON_ID);
 	const float height_per_width = static_cast<float>(icon.height) / icon.width;
@@ -44,7 +48,7 @@ void GoalFlag::Initialize(const ActorInitialParams* actor_params)
 
 void GoalFlag::Finalize()
 {
-	__super::Finalize();
+	Actor::Finalize();
 }
 
 void GoalFlag::GetWorldConvexPolygonVertices(std::vector<Vector2D>& out_vertexes)
@@ -20,7 +20,7 @@ ItemActor::~ItemActor()
 
 void ItemActor::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
 	const ItemActorInitialParams* item_params = dynamic_cast<const ItemActorInitialParams*>(actor_params);
 	assert(item_params);
 
@@ -44,7 +44,7 @@ void ItemActor::Initialize(const ActorInitialParams* actor_params)
 
 void ItemActor::OnHitCollision(const HitResult& hit_result)
 {
-	__super::OnHitCollision(hit_result);
+	Actor::OnHitCollision(hit_result);
 
 	// 衝突相手はプレイヤーのみ
 	Actor* other_owner = hit_result.other_collider->GetOwnerActor();
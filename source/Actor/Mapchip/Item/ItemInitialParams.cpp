@@ -9,21 +9,21 @@ namespace
 }
 void ItemActorInitialParams::ToJsonObject(nlohmann::json& initial_params_json) const
 {
-	__super::ToJsonObject(initial_params_json);
+	ActorInitialParams::ToJsonObject(initial_params_json);
 
 	initial_params_json[JKEY_ITEM_ID] = item_id;
 }
 
 void ItemActorInitialParams::FromJsonObject(const nlohmann::json& initial_params_json)
 {
-	__super::FromJsonObject(initial_params_json);
+	ActorInitialParams::FromJsonObject(initial_params_json);
 
 	initial_params_json.at(JKEY_ITEM_ID).get_to(item_id);
 }
 
 void ItemActorInitialParams::AddToParamEditGroup(const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
 {
-	__super::AddToParamEditGroup(parent, command_history);
+	ActorInitialParams::AddToParamEditGroup(parent, command_history);
 
 	AddChildParamEditNodeToGroup<EditParamType::ITEM_ID>(
 		parent,
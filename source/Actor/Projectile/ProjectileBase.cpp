@@ -14,7 +14,7 @@ ProjectileBase::~ProjectileBase()
 
 void ProjectileBase::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
 
 	using InitialParamsType = initial_params_of_actor_t<ProjectileBase>;
 	const InitialParamsType* projectile_params = dynamic_cast<const InitialParamsType*>(actor_params);
@@ -29,7 +29,7 @@ void ProjectileBase::Initialize(const ActorInitialParams* actor_params)
 
 void ProjectileBase::Finalize()
 {
-	__super::Finalize();
+	Actor::Finalize();
 }
 
 ProjectileMovementComponent* ProjectileBase::GetProjectileMovement() const
@@ -11,7 +11,7 @@ SceneAnimRendererActor::~SceneAnimRendererActor()
 
 void SceneAnimRendererActor::Initialize(const ActorInitialParams* actor_params)
 {
-	__super::Initialize(actor_params);
+	Actor::Initialize(actor_params);
 	SetActorWorldPosition(Vector2D{ 0,0 });
 
 	SetDrawAreaCheckIgnored(true);
@@ -24,7 +24,7 @@ void SceneAnimRendererActor::Initialize(const ActorInitialParams* actor_params)
 
 void SceneAnimRendererActor::TickActor(float delta_seconds)
 {
-	__super::TickActor(delta_seconds);
+	Actor::TickActor(delta_seconds);
 }
 
 void SceneAnimRendererActor::RequestToSetActorHidden(const bool new_hidden)
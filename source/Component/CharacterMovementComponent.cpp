@@ -30,7 +30,7 @@ CharacterMovementComponent::CharacterMovementComponent()
 
 void CharacterMovementComponent::Initialize()
 {
-	__super::Initialize();
+	MovementComponent::Initialize();
 	_character_ref = dynamic_cast<Character*>(GetOwnerActor());
 	if (_character_ref == nullptr)
 	{
@@ -40,7 +40,7 @@ void CharacterMovementComponent::Initialize()
  
 void CharacterMovementComponent::Tick(const float delta_seconds)
 {
-	__super::Tick(delta_seconds);
+	MovementComponent::Tick(delta_seconds);
 
 	if(_pressed_jump)
 	{
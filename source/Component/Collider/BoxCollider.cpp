@@ -12,12 +12,12 @@ BoxCollider::BoxCollider()
 
 void BoxCollider::Initialize()
 {
-    __super::Initialize();
+    ColliderBase::Initialize();
 }
 
 void BoxCollider::Finalize()
 {
-    __super::Finalize();
+    ColliderBase::Finalize();
 }
 
 void BoxCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params)
@@ -32,8 +32,7 @@ void BoxCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_re
 
     std::array<Vector2D, 2> intersections;
     std::array<FSegment, 2> intersected_edges;
-    const FRect rect = FRect(GetWorldPosition(), unrotaed_diagonal.x, unrotaed_diagonal.y, GetWorldRotation());
-    const int intersection_count = GeometricUtility::GetSegmentRectIntersections(intersections, query_params.segment, rect, &intersected_edges);
+    const int intersection_count = GeometricUtility::GetSegmentRectIntersections(intersections, query_params.segment, _world_rect, &intersected_edges);
 
     if (intersection_count == 0)
     {
@@ -75,8 +74,7 @@ void BoxCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_
 		return;
 	}
 
-	const FRect this_rect = FRect(GetWorldPosition(), unrotaed_diagonal.x, unrotaed_diagonal.y, GetWorldRotation());
-	const bool is_hit = GeometricUtility::DoesRectOverlapWithAnother(this_rect, query_params.rect);
+	const bool is_hit = GeometricUtility::DoesRectOverlapWithAnother(_world_rect, query_params.rect);
 	query_result.has_hit = is_hit;
 	if (is_hit)
 	{
@@ -91,58 +89,49 @@ ColliderBase::ColliderShape BoxCollider::GetColliderShape() const
 
 void BoxCollider::GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const
 {
-    const Vector2D center_position = GetWorldPosition();
-    std::array<Vector2D,4> center_to_vertexes;
-    CalcCenterToAllVertices(center_to_vertexes);
+    out_vertex_positions.assign(_world_vertices.begin(), _world_vertices.end());
+}
 
-    out_vertex_positions = std::vector<Vector2D>(4);
-	for (size_t i = 0; i < 4; i++)
-	{
-		out_vertex_positions.at(i) = center_position + center_to_vertexes.at(i);
-	}
+int BoxCollider::GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const
+{
+    std::copy(_world_vertices.begin(), _world_vertices.end(), out_vertex_positions.begin());
+    return 4;
 }
 
 
 void BoxCollider::DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc)
 {
-    __super::DrawDebugLines(camera_params, desc);
+    ColliderBase::DrawDebugLines(camera_params, desc);
 
     // コライダーの外周を描画
-    const Vector2D center_position = GetWorldPosition();
-    std::array<Vector2D,4> center_to_vertexes;
-    CalcCenterToAllVertices(center_to_vertexes);
-
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
-
     DrawBlendInfo blend_info = DrawBlendInfo(DX_BLENDMODE_ALPHA, desc.box.line_alpha);
     for (size_t i = 0; i < 4; i++)
     {
-		Vector2D& from = vertex_positions.at(i);
-		Vector2D& to = vertex_positions.at((i + 1) % 4);
+		const Vector2D& from = _world_vertices.at(i);
+		const Vector2D& to = _world_vertices.at((i + 1) % 4);
         GetScene()->DrawDebugLine(from, to, desc.box.line_color, desc.box.line_thickness, blend_info);
     }
 }
 
 Vector2D BoxCollider::GetCenterWorldPosition() const
 {
-    return GetWorldPosition();
+    return _world_rect.center;
 }
 
-void BoxCollider::GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const
+FRectAA BoxCollider::UpdateWorldShapeCache()
 {
-	std::vector<Vector2D> vertex_positions;
-    GetVertexPositions(vertex_positions);
+    _world_rect = FRect{ GetWorldPosition(), unrotaed_diagonal.x, unrotaed_diagonal.y, GetWorldRotation() };
+    _world_rect.GetVertices(_world_vertices);
+
 	float left = FLT_MAX, top = FLT_MAX, right = -FLT_MAX, bottom = -FLT_MAX;
-	for (const auto& vertex : vertex_positions)
+	for (const auto& vertex : _world_vertices)
 	{
 		left = std::min(left, vertex.x);
 		top = std::min(top, vertex.y);
 		right = std::max(right, vertex.x);
 		bottom = std::max(bottom, vertex.y);
 	}
-	out_left_top = Vector2D(left, top);
-	out_right_bottom = Vector2D(right, bottom);
+	return FRectAA{ Vector2D(left, top), Vector2D(right, bottom) };
 }
 
 void BoxCollider::SetBoxColliderParams(
@@ -173,6 +162,8 @@ void BoxCollider::SetBoxColliderExtent(const Vector2D& new_box_extent)
     center_to_vertices.at(static_cast<uint8_t>(BoxColliderVertex::LEFT_BOTTOM)) = to_left_bottom;
     center_to_vertices.at(static_cast<uint8_t>(BoxColliderVertex::RIGHT_BOTTOM)) = to_right_bottom;
     center_to_vertices.at(static_cast<uint8_t>(BoxColliderVertex::RIGHT_TOP)) = to_right_top;
+
+    OnColliderShapeChanged();
 }
 
 Vector2D BoxCollider::CalcCenterToVertex(BoxColliderVertex vertex) const
@@ -183,26 +174,9 @@ Vector2D BoxCollider::CalcCenterToVertex(BoxColliderVertex vertex) const
 
 FRectAA BoxCollider::GetGeometricRectAA() const
 {
-	const Vector2D world_pos = GetWorldPosition();
+	const Vector2D& world_pos = _world_rect.center;
     FRectAA ret{};
 	ret.left_top = world_pos - unrotaed_diagonal / 2.0f;
 	ret.right_bottom = world_pos + unrotaed_diagonal / 2.0f;
 	return ret;
 }
-
-FRect BoxCollider::GetGeometricRect() const
-{
-	const Vector2D center = GetWorldPosition();
-    const Vector2D extent = GetBoxExtent();
-    const float rotation = GetWorldRotation();
-    return FRect{ center, extent.x, extent.y, rotation };
-}
-
-void BoxCollider::CalcCenterToAllVertices(std::array<Vector2D,4>& out_center_to_vertexes) const
-{
-    for (uint8_t i = 0; i < center_to_vertices.size(); i++)
-    {
-        out_center_to_vertexes.at(i) = CalcCenterToVertex(static_cast<BoxColliderVertex>(i));
-    }
-
-}
@@ -26,11 +26,13 @@ public:
 public:
 	virtual ColliderShape GetColliderShape() const override;
 	virtual void GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const override;
+	virtual int GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const override;
 	virtual void RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params) override;
 	virtual void RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params) override;
 	virtual void DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc = ColliderDebugDrawDesc{}) override;
 	virtual Vector2D GetCenterWorldPosition() const override;
-	virtual void GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const override;
+protected:
+	virtual FRectAA UpdateWorldShapeCache() override;
 	//~ End ColliderBase interface
 
 public:
@@ -65,15 +67,12 @@ public:
 	/// <returns></returns>
 	FRectAA GetGeometricRectAA() const;
 
-	FRect GetGeometricRect() const;
+	/// <summary>
+	/// ワールド空間での矩形を取得. トランスフォームか形状が変わったときに計算したキャッシュを返す
+	/// </summary>
+	const FRect& GetGeometricRect() const { return _world_rect; }
 
 private:
-	/**
-	* 中心から各頂点へのベクトルを反時計回りに計算
-	* 先頭要素は回転ゼロの状態で左上にあった頂点へのベクトル
-	*/
-	void CalcCenterToAllVertices(std::array<Vector2D,4>& out_center_to_vertexes) const;
-
 	// rotationがゼロのときの対角線を表すベクトル
 	// 向きは左上から右下
 	Vector2D unrotaed_diagonal;
@@ -83,6 +82,11 @@ private:
 	// 順番は左上から反時計回り
 	std::array<Vector2D, 4> center_to_vertices;
 
+	// ワールド空間での矩形と頂点座標のキャッシュ
+	// 頂点の順番はcenter_to_verticesと同じ
+	FRect _world_rect;
+	std::array<Vector2D, 4> _world_vertices;
+
 };
 
 enum class BoxColliderVertex : uint8_t
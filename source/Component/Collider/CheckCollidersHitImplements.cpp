@@ -2,13 +2,15 @@
 
 #include "Component/Collider/BoxCollider.h"
 #include "Component/Collider/SegmentCollider.h"
-// #include "Component/Collider/CircleCollider.h"
+#include "Component/Collider/CircleCollider.h"
 #include "Component/Collider/TriangleCollider.h"
+#include <algorithm>
+#include <cstdint>
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1, const BoxCollider* box2)
 {
-	FRect rect_1 = FRect(box1->GetWorldPosition(), box1->GetBoxExtent().x, box1->GetBoxExtent().y, box1->GetWorldRotation());
-	FRect rect_2 = FRect(box2->GetWorldPosition(), box2->GetBoxExtent().x, box2->GetBoxExtent().y, box2->GetWorldRotation());
+	const FRect& rect_1 = box1->GetGeometricRect();
+	const FRect& rect_2 = box2->GetGeometricRect();
 	Vector2D penetration_depth{};
 	const bool has_hit = GeometricUtility::DoesRectOverlapWithAnother(rect_1, rect_2, &penetration_depth);
 	if (!has_hit)
@@ -22,8 +24,8 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1,
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1, const SegmentCollider* segment2)
 {
-	const FRect rect = FRect(box1->GetWorldPosition(), box1->GetBoxExtent().x, box1->GetBoxExtent().y, box1->GetWorldRotation());
-	const FSegment segment = FSegment(segment2->CalcSegmentEndPosition(SegmentEnd::LEFT), segment2->CalcSegmentEndPosition(SegmentEnd::RIGHT));
+	const FRect& rect = box1->GetGeometricRect();
+	const FSegment& segment = segment2->GetWorldSegment();
 	Vector2D penetration_depth{};
 	const bool has_hit = GeometricUtility::DoesRectOverlapWithSegment(rect, segment, penetration_depth);
 	if (!has_hit)
@@ -37,14 +39,23 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1,
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1, const CircleCollider* circle2)
 {
-	// TODO: 矩形コライダーと円形コライダーの衝突判定
-	throw std::runtime_error("Not implemented yet");
+	const FRect& rect = box1->GetGeometricRect();
+	const FCircle& circle = circle2->GetWorldCircle();
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesRectOverlapWithCircle(rect, circle, &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(box1, circle2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1, const TriangleCollider* triangle2)
 {
-	const FRect geometric_rect1 = box1->GetGeometricRect();
-	const FTriangle geometric_triangle2 = triangle2->GetTriangle();
+	const FRect& geometric_rect1 = box1->GetGeometricRect();
+	const FTriangle& geometric_triangle2 = triangle2->GetTriangle();
 	Vector2D penetration_depth{};
 	const bool has_hit = GeometricUtility::DoesRectOverlapWithTriangle(geometric_rect1, geometric_triangle2, &penetration_depth);
 	if (!has_hit)
@@ -58,36 +69,82 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const BoxCollider* box1,
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const SegmentCollider* segment1, const SegmentCollider* segment2)
 {
-	// TODO: 線分コライダーと線分コライダーの衝突判定
-	throw std::runtime_error("Not implemented yet");
+	const FSegment& segment_1 = segment1->GetWorldSegment();
+	const FSegment& segment_2 = segment2->GetWorldSegment();
+	const Vector2D vertices_1[2] = { segment_1.start, segment_1.end };
+	const Vector2D vertices_2[2] = { segment_2.start, segment_2.end };
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesConvexPolygonOverlapWithAnother(vertices_1, 2, vertices_2, 2, &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(segment1, segment2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const SegmentCollider* segment1, const CircleCollider* circle2)
 {
-	// TODO: 線分コライダーと円形コライダーの衝突判定
-	throw std::runtime_error("Not implemented yet");
+	const FSegment& segment = segment1->GetWorldSegment();
+	const Vector2D vertices[2] = { segment.start, segment.end };
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesCircleOverlapWithConvexPolygon(circle2->GetWorldCircle(), vertices, 2, &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(segment1, circle2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const SegmentCollider* segment1, const TriangleCollider* triangle2)
 {
-	throw std::runtime_error("Not implemented yet");
+	const FSegment& segment = segment1->GetWorldSegment();
+	const Vector2D vertices[2] = { segment.start, segment.end };
+	const std::array<Vector2D, 3>& triangle_vertices = triangle2->GetTriangle().vertices;
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesConvexPolygonOverlapWithAnother(vertices, 2, triangle_vertices.data(), 3, &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(segment1, triangle2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const CircleCollider* circle1, const CircleCollider* circle2)
 {
-	// TODO: 円形コライダーと円形コライダーの衝突判定
-	throw std::runtime_error("Not implemented yet");
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesCircleOverlapWithAnother(circle1->GetWorldCircle(), circle2->GetWorldCircle(), &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(circle1, circle2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const CircleCollider* circle1, const TriangleCollider* triangle2)
 {
-	throw std::runtime_error("Not implemented yet");
+	const std::array<Vector2D, 3>& triangle_vertices = triangle2->GetTriangle().vertices;
+	Vector2D penetration_depth{};
+	const bool has_hit = GeometricUtility::DoesCircleOverlapWithConvexPolygon(circle1->GetWorldCircle(), triangle_vertices.data(), 3, &penetration_depth);
+	if (!has_hit)
+	{
+		out_result_for_1.has_hit = false;
+		return;
+	}
+
+	out_result_for_1 = MakeHitResult(circle1, triangle2, penetration_depth);
 }
 
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider* triangle1, const TriangleCollider* triangle2)
 {
-	throw std::runtime_error("Not implemented yet");
-	Vector2D penetration_depth;
+	Vector2D penetration_depth{};
 	const bool has_hit = GeometricUtility::DoesTriangleOverlapWIthAnother(triangle1->GetTriangle(), triangle2->GetTriangle(), &penetration_depth);
 	if (!has_hit)
 	{
@@ -95,7 +152,7 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider*
 		return;
 	}
 
-	MakeHitResult(triangle1, triangle2, penetration_depth);
+	out_result_for_1 = MakeHitResult(triangle1, triangle2, penetration_depth);
 }
 
 
@@ -140,3 +197,177 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider*
 	CheckCollidersHitImpl(result_for_2, circle2, triangle1);
 	out_result_for_1 = result_for_2.GetInverted();
 }
+
+namespace
+{
+	// CheckCollidersHitBatch()で一度に展開するペアの数
+	constexpr int BATCH_CHUNK_SIZE = 64;
+
+	// 事前判定の余白 [px].
+	// 個別の判定とは計算の順序が異なるので, 丸め誤差で衝突を見落とさないよう少し広めに候補を取る
+	constexpr float BATCH_CANDIDATE_MARGIN = 1.f;
+
+	// 円のSoA
+	struct CircleLanes
+	{
+		float x[BATCH_CHUNK_SIZE];
+		float y[BATCH_CHUNK_SIZE];
+		float radius[BATCH_CHUNK_SIZE];
+
+		void Gather(const CircleCollider* const* circles, const int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				const FCircle& circle = circles[i]->GetWorldCircle();
+				x[i] = circle.center.x;
+				y[i] = circle.center.y;
+				radius[i] = circle.radius;
+			}
+		}
+	};
+
+	// 矩形のSoA. 幅方向の単位ベクトル(axis_x, axis_y)を持ち, 高さ方向はそれを90度回転させたもの
+	struct BoxLanes
+	{
+		float x[BATCH_CHUNK_SIZE];
+		float y[BATCH_CHUNK_SIZE];
+		float axis_x[BATCH_CHUNK_SIZE];
+		float axis_y[BATCH_CHUNK_SIZE];
+		float half_width[BATCH_CHUNK_SIZE];
+		float half_height[BATCH_CHUNK_SIZE];
+
+		void Gather(const BoxCollider* const* boxes, const int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				const FRect& rect = boxes[i]->GetGeometricRect();
+				x[i] = rect.center.x;
+				y[i] = rect.center.y;
+				axis_x[i] = cosf(rect.rotation);
+				axis_y[i] = sinf(rect.rotation);
+				half_width[i] = rect.width * 0.5f;
+				half_height[i] = rect.height * 0.5f;
+			}
+		}
+	};
+
+	/// <summary>
+	/// 事前判定で候補になったペアだけ個別の判定を行う
+	/// </summary>
+	/// <returns>衝突していたペアの数</returns>
+	template<class Collider1, class Collider2>
+	int CheckCandidatePairs(
+		HitResult* out_results_for_1, const Collider1* const* colliders1, const Collider2* const* colliders2,
+		const uint8_t* is_candidate, const int count
+	)
+	{
+		int num_hits = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			out_results_for_1[i] = HitResult{};
+			if (is_candidate[i])
+			{
+				CheckCollidersHitImpl(out_results_for_1[i], colliders1[i], colliders2[i]);
+				num_hits += out_results_for_1[i].has_hit ? 1 : 0;
+			}
+		}
+		return num_hits;
+	}
+}
+
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const CircleCollider* const* circles1, const CircleCollider* const* circles2, const int num_pairs)
+{
+	CircleLanes lanes1, lanes2;
+	uint8_t is_candidate[BATCH_CHUNK_SIZE];
+
+	int num_hits = 0;
+	for (int begin = 0; begin < num_pairs; begin += BATCH_CHUNK_SIZE)
+	{
+		const int count = (std::min)(BATCH_CHUNK_SIZE, num_pairs - begin);
+		lanes1.Gather(circles1 + begin, count);
+		lanes2.Gather(circles2 + begin, count);
+
+		for (int i = 0; i < count; ++i)
+		{
+			const float dx = lanes2.x[i] - lanes1.x[i];
+			const float dy = lanes2.y[i] - lanes1.y[i];
+			const float reach = lanes1.radius[i] + lanes2.radius[i] + BATCH_CANDIDATE_MARGIN;
+			is_candidate[i] = static_cast<uint8_t>(dx * dx + dy * dy <= reach * reach);
+		}
+
+		num_hits += CheckCandidatePairs(out_results_for_1 + begin, circles1 + begin, circles2 + begin, is_candidate, count);
+	}
+	return num_hits;
+}
+
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const CircleCollider* const* circles1, const BoxCollider* const* boxes2, const int num_pairs)
+{
+	CircleLanes circle_lanes;
+	BoxLanes box_lanes;
+	uint8_t is_candidate[BATCH_CHUNK_SIZE];
+
+	int num_hits = 0;
+	for (int begin = 0; begin < num_pairs; begin += BATCH_CHUNK_SIZE)
+	{
+		const int count = (std::min)(BATCH_CHUNK_SIZE, num_pairs - begin);
+		circle_lanes.Gather(circles1 + begin, count);
+		box_lanes.Gather(boxes2 + begin, count);
+
+		for (int i = 0; i < count; ++i)
+		{
+			// 矩形のローカル座標系での円の中心と, 矩形からはみ出した量
+			const float dx = circle_lanes.x[i] - box_lanes.x[i];
+			const float dy = circle_lanes.y[i] - box_lanes.y[i];
+			const float local_x = dx * box_lanes.axis_x[i] + dy * box_lanes.axis_y[i];
+			const float local_y = -dx * box_lanes.axis_y[i] + dy * box_lanes.axis_x[i];
+			const float outside_x = (std::max)(fabsf(local_x) - box_lanes.half_width[i], 0.f);
+			const float outside_y = (std::max)(fabsf(local_y) - box_lanes.half_height[i], 0.f);
+			const float reach = circle_lanes.radius[i] + BATCH_CANDIDATE_MARGIN;
+			is_candidate[i] = static_cast<uint8_t>(outside_x * outside_x + outside_y * outside_y <= reach * reach);
+		}
+
+		num_hits += CheckCandidatePairs(out_results_for_1 + begin, circles1 + begin, boxes2 + begin, is_candidate, count);
+	}
+	return num_hits;
+}
+
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const BoxCollider* const* boxes1, const BoxCollider* const* boxes2, const int num_pairs)
+{
+	BoxLanes lanes1, lanes2;
+	uint8_t is_candidate[BATCH_CHUNK_SIZE];
+
+	int num_hits = 0;
+	for (int begin = 0; begin < num_pairs; begin += BATCH_CHUNK_SIZE)
+	{
+		const int count = (std::min)(BATCH_CHUNK_SIZE, num_pairs - begin);
+		lanes1.Gather(boxes1 + begin, count);
+		lanes2.Gather(boxes2 + begin, count);
+
+		for (int i = 0; i < count; ++i)
+		{
+			// 両方の矩形の辺の法線4本を分離軸とする. 軸同士の内積は相対角のcos, sinになる
+			const float dx = lanes2.x[i] - lanes1.x[i];
+			const float dy = lanes2.y[i] - lanes1.y[i];
+			const float abs_cos = fabsf(lanes1.axis_x[i] * lanes2.axis_x[i] + lanes1.axis_y[i] * lanes2.axis_y[i]);
+			const float abs_sin = fabsf(lanes1.axis_x[i] * lanes2.axis_y[i] - lanes1.axis_y[i] * lanes2.axis_x[i]);
+
+			const float distance_u1 = fabsf(dx * lanes1.axis_x[i] + dy * lanes1.axis_y[i]);
+			const float distance_v1 = fabsf(-dx * lanes1.axis_y[i] + dy * lanes1.axis_x[i]);
+			const float distance_u2 = fabsf(dx * lanes2.axis_x[i] + dy * lanes2.axis_y[i]);
+			const float distance_v2 = fabsf(-dx * lanes2.axis_y[i] + dy * lanes2.axis_x[i]);
+
+			const float reach_u1 = lanes1.half_width[i] + lanes2.half_width[i] * abs_cos + lanes2.half_height[i] * abs_sin + BATCH_CANDIDATE_MARGIN;
+			const float reach_v1 = lanes1.half_height[i] + lanes2.half_width[i] * abs_sin + lanes2.half_height[i] * abs_cos + BATCH_CANDIDATE_MARGIN;
+			const float reach_u2 = lanes2.half_width[i] + lanes1.half_width[i] * abs_cos + lanes1.half_height[i] * abs_sin + BATCH_CANDIDATE_MARGIN;
+			const float reach_v2 = lanes2.half_height[i] + lanes1.half_width[i] * abs_sin + lanes1.half_height[i] * abs_cos + BATCH_CANDIDATE_MARGIN;
+
+			// 分岐させないよう, 短絡評価しない&で結合する
+			is_candidate[i] = static_cast<uint8_t>(
+				(distance_u1 <= reach_u1) & (distance_v1 <= reach_v1) & (distance_u2 <= reach_u2) & (distance_v2 <= reach_v2)
+			);
+		}
+
+		num_hits += CheckCandidatePairs(out_results_for_1 + begin, boxes1 + begin, boxes2 + begin, is_candidate, count);
+	}
+	return num_hits;
+}
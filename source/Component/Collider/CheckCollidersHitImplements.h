@@ -24,4 +24,32 @@ void CheckCollidersHitImpl(HitResult& out_result_for_1, const CircleCollider* ci
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider* triangle1, const BoxCollider* box2);
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const CircleCollider* circle1, const SegmentCollider* segment2);
 void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider* triangle1, const SegmentCollider* segment2);
-void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider* triangle1, const CircleCollider* circle2);
\ No newline at end of file
+void CheckCollidersHitImpl(HitResult& out_result_for_1, const TriangleCollider* triangle1, const CircleCollider* circle2);
+
+/// <summary>
+/// 同じ形状の組み合わせのペアをまとめて判定する. 各ペアの結果は, CheckCollidersHitImpl()を個別に呼んだ結果と同じ
+/// <para>形状をSoAの一時配列に展開して, 分岐のないループで衝突の可能性があるペアを絞り込み, 候補だけを個別に判定する</para>
+/// <para>絞り込みのループはコンパイラの自動ベクトル化が効くように書いてある</para>
+/// </summary>
+/// <param name="out_results_for_1">ペアごとの1番目のコライダーから見た衝突結果. num_pairs個の要素を持つ配列</param>
+/// <param name="num_pairs">ペアの数</param>
+/// <returns>衝突していたペアの数</returns>
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const CircleCollider* const* circles1, const CircleCollider* const* circles2, const int num_pairs);
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const CircleCollider* const* circles1, const BoxCollider* const* boxes2, const int num_pairs);
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const BoxCollider* const* boxes1, const BoxCollider* const* boxes2, const int num_pairs);
+
+/// <summary>
+/// 専用の絞り込みを持たない組み合わせは, ペアごとに個別の判定を行う
+/// </summary>
+template<class Collider1, class Collider2>
+int CheckCollidersHitBatch(HitResult* out_results_for_1, const Collider1* const* colliders1, const Collider2* const* colliders2, const int num_pairs)
+{
+	int num_hits = 0;
+	for (int i = 0; i < num_pairs; ++i)
+	{
+		out_results_for_1[i] = HitResult{};
+		CheckCollidersHitImpl(out_results_for_1[i], colliders1[i], colliders2[i]);
+		num_hits += out_results_for_1[i].has_hit ? 1 : 0;
+	}
+	return num_hits;
+}
\ No newline at end of file
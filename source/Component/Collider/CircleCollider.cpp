@@ -0,0 +1,120 @@
+#include "CircleCollider.h"
+#include "Scene/SceneBase.h"
+#include "Actor/Actor.h"
+#include <cassert>
+
+CircleCollider::CircleCollider()
+	: _radius(0.f)
+{
+}
+
+CircleCollider::~CircleCollider()
+{
+}
+
+ColliderBase::ColliderShape CircleCollider::GetColliderShape() const
+{
+	return ColliderShape::CIRCLE;
+}
+
+void CircleCollider::GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const
+{
+	std::array<Vector2D, MAX_CONVEX_VERTICES> vertex_positions;
+	const int num_vertices = GetConvexVertexPositions(vertex_positions);
+	out_vertex_positions.assign(vertex_positions.begin(), vertex_positions.begin() + num_vertices);
+}
+
+int CircleCollider::GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const
+{
+	const Vector2D& center = _world_circle.center;
+	const float radius = _world_circle.radius;
+
+	// BoxColliderと同じく左上から反時計回り
+	out_vertex_positions[0] = center + Vector2D{ -radius, -radius };
+	out_vertex_positions[1] = center + Vector2D{ -radius, radius };
+	out_vertex_positions[2] = center + Vector2D{ radius, radius };
+	out_vertex_positions[3] = center + Vector2D{ radius, -radius };
+	return 4;
+}
+
+void CircleCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params)
+{
+	query_result = QueryResult_SingleLineTrace{};
+	query_result.has_hit = false;
+
+	float fraction;
+	if (!GeometricUtility::GetSegmentCircleIntersection(fraction, query_params.segment, _world_circle))
+	{
+		return;
+	}
+
+	query_result.has_hit = true;
+	query_result.hit_collider = this;
+	query_result.hit_location = query_params.segment.start + (query_params.segment.end - query_params.segment.start) * fraction;
+
+	// 円周上の点の法線は中心から外向き
+	const Vector2D center_to_hit = query_result.hit_location - _world_circle.center;
+	query_result.hit_normal = center_to_hit.IsZeroVector() ? Vector2D{ 0.f, -1.f } : center_to_hit.Normalize();
+}
+
+void CircleCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params)
+{
+	if (!ShouldCheckQueryHit(query_params))
+	{
+		query_result.has_hit = false;
+		return;
+	}
+
+	query_result.has_hit = GeometricUtility::DoesRectOverlapWithCircle(query_params.rect.ToFRect(), _world_circle);
+	if (query_result.has_hit)
+	{
+		query_result.hit_colliders.push_back(this);
+	}
+}
+
+void CircleCollider::DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc)
+{
+	ColliderBase::DrawDebugLines(camera_params, desc);
+
+	// 円周を正多角形で近似して描画
+	const float angle_step = 2.f * CLN2D_PI / NUM_DEBUG_CIRCLE_SEGMENTS;
+	Vector2D start = _world_circle.center + Vector2D{ _world_circle.radius, 0.f };
+	for (int i = 1; i <= NUM_DEBUG_CIRCLE_SEGMENTS; i++)
+	{
+		const Vector2D end = _world_circle.center + Vector2D::Rotate(Vector2D{ _world_circle.radius, 0.f }, angle_step * i);
+		GetScene()->DrawDebugLine(start, end, desc.circle.line_color, desc.circle.line_thickness, DrawBlendInfo(DX_BLENDMODE_ALPHA, desc.circle.line_alpha));
+		start = end;
+	}
+}
+
+Vector2D CircleCollider::GetCenterWorldPosition() const
+{
+	return _world_circle.center;
+}
+
+FRectAA CircleCollider::UpdateWorldShapeCache()
+{
+	_world_circle = FCircle{ GetWorldPosition(), _radius };
+
+	const Vector2D radius_vec{ _radius, _radius };
+	return FRectAA{ _world_circle.center - radius_vec, _world_circle.center + radius_vec };
+}
+
+void CircleCollider::SetRadius(const float new_radius)
+{
+	assert(new_radius >= 0.f);
+	_radius = new_radius;
+	OnColliderShapeChanged();
+}
+
+void CircleCollider::SetCircleColliderParams(const CollisionType new_collision_type, const CollisionObjectType new_collision_object_type, const std::vector<CollisionObjectType>& new_hit_object_types, const bool new_pushability, const float new_radius)
+{
+	SetColliderCommonParams(
+		new_collision_type,
+		new_collision_object_type,
+		new_hit_object_types,
+		new_pushability
+	);
+
+	SetRadius(new_radius);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ColliderBase.h"
+
+/// <summary>
+/// 円形コライダー
+/// <para>中心はコンポーネントのワールド座標. 半径はスケールの影響を受けない</para>
+/// </summary>
+class CircleCollider : public ColliderBase
+{
+public:
+	CircleCollider();
+	virtual ~CircleCollider();
+
+	//~ Begin ColliderBase interface
+public:
+	virtual ColliderShape GetColliderShape() const override;
+
+	/// <summary>
+	/// 円に外接する正方形の頂点を返す
+	/// </summary>
+	virtual void GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const override;
+
+	/// <summary>
+	/// 円に外接する正方形の頂点を返す. 連続衝突判定では円をこの正方形で近似する
+	/// </summary>
+	virtual int GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const override;
+	virtual void RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params) override;
+	virtual void RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params) override;
+	virtual void DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc = ColliderDebugDrawDesc{}) override;
+	virtual Vector2D GetCenterWorldPosition() const override;
+protected:
+	virtual FRectAA UpdateWorldShapeCache() override;
+	//~ End ColliderBase interface
+
+public:
+	/// <summary>
+	/// ワールド空間での円を取得. トランスフォームか形状が変わったときに計算したキャッシュを返す
+	/// </summary>
+	const FCircle& GetWorldCircle() const { return _world_circle; }
+
+	float GetRadius() const { return _radius; }
+	void SetRadius(const float new_radius);
+
+	/// <summary>
+	/// 円形コライダーのパラメータをまとめてセット
+	/// </summary>
+	/// <param name="new_collision_type">コリジョンタイプ</param>
+	/// <param name="new_collision_object_type">オブジェクトタイプ</param>
+	/// <param name="new_hit_object_types">衝突対象のオブジェクトタイプリスト</param>
+	/// <param name="new_pushability">押し戻しの可否</param>
+	/// <param name="new_radius">半径</param>
+	void SetCircleColliderParams(
+		const CollisionType new_collision_type,
+		const CollisionObjectType new_collision_object_type,
+		const std::vector<CollisionObjectType>& new_hit_object_types,
+		const bool new_pushability,
+		const float new_radius
+	);
+
+private:
+	// デバッグ描画で円周を近似する線分の数
+	static constexpr int NUM_DEBUG_CIRCLE_SEGMENTS = 24;
+
+	float _radius;
+
+	// ワールド空間での円のキャッシュ
+	FCircle _world_circle;
+};
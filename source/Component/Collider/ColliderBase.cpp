@@ -5,33 +5,36 @@
 #include "Actor/Actor.h"
 #include "Component/Collider/BoxCollider.h"
 #include "Component/Collider/SegmentCollider.h"
-// #include "Component/Collider/CircleCollider.h"
+#include "Component/Collider/CircleCollider.h"
 #include "Component/Collider/TriangleCollider.h"
 #include "Input/DeviceInput.h"
 
 void ColliderBase::Initialize()
 {
-	__super::Initialize();
+	SceneComponent::Initialize();
 	should_call_component_tick = false;
 
+	RefreshWorldShapeCache();
+	ResetContinuousCollisionSweep();
+
 	// CollisionManagerに新たなコリジョンの生成を通知する
 	CollisionManager::GetInstance().OnNewColliderInitialized(this);
 }
 
 void ColliderBase::Draw(const CameraParams& camera_params)
 {
-	__super::Draw(camera_params);
+	SceneComponent::Draw(camera_params);
 }
 
 void ColliderBase::Finalize()
 {
 	CollisionManager::GetInstance().OnColliderFinalize(this);
-	__super::Finalize();
+	SceneComponent::Finalize();
 }
 
 void ColliderBase::OnParentActorHiddenChanged(const bool new_hidden)
 {
-	__super::OnParentActorHiddenChanged(new_hidden);
+	SceneComponent::OnParentActorHiddenChanged(new_hidden);
 
 	if (new_hidden)
 	{
@@ -45,10 +48,22 @@ void ColliderBase::OnParentActorHiddenChanged(const bool new_hidden)
 
 void ColliderBase::OnThisWorldTransformChanged()
 {
-	__super::OnThisWorldTransformChanged();
+	SceneComponent::OnThisWorldTransformChanged();
+	RefreshWorldShapeCache();
+	CollisionManager::GetInstance().OnColliderTransformed(this);
+}
+
+void ColliderBase::OnColliderShapeChanged()
+{
+	RefreshWorldShapeCache();
 	CollisionManager::GetInstance().OnColliderTransformed(this);
 }
 
+void ColliderBase::RefreshWorldShapeCache()
+{
+	_world_aabb = UpdateWorldShapeCache();
+}
+
 bool ColliderBase::IsOverlappingWith(const ColliderBase* other_collider) const
 {
 	if (!ShouldCheckHitWith(other_collider))
@@ -64,20 +79,6 @@ bool ColliderBase::IsOverlappingWith(const ColliderBase* other_collider) const
 	);
 }
 
-void ColliderBase::HandleCollisionWith(const ColliderBase* other_collider) const
-{
-	if (ShouldCheckHitWith(other_collider))
-	{
-		HitResult hit_result_for_self;
-		CheckHitWith(hit_result_for_self, other_collider);
-
-		if (hit_result_for_self.has_hit)
-		{
-			HandleHitResult(hit_result_for_self);
-		}
-	}
-}
-
 bool ColliderBase::IsHitCheckTarget(const CollisionObjectType target_object_type) const
 {
 	auto casted_target_object_type = static_cast<CollisionObjectType_UnderlyingType>(target_object_type);
@@ -96,6 +97,7 @@ void ColliderBase::SetHitObjectTypes(const std::vector<CollisionObjectType>& new
 	{
 		hit_object_types |= static_cast<CollisionObjectType_UnderlyingType>(hit_object_type);
 	}
+	CollisionManager::GetInstance().OnColliderHitTargetsChanged(this);
 }
 
 CollisionType ColliderBase::GetCollisionTypeBetween(const ColliderBase* other) const
@@ -118,12 +120,24 @@ CollisionType ColliderBase::GetCollisionTypeBetween(const ColliderBase* other) c
 
 void ColliderBase::Deactivate()
 {
+	if (!is_active)
+	{
+		return;
+	}
+
 	is_active = false;
+	CollisionManager::GetInstance().OnColliderActiveChanged(this);
 }
 
 void ColliderBase::Activate()
 {
+	if (is_active)
+	{
+		return;
+	}
+
 	is_active = true;
+	CollisionManager::GetInstance().OnColliderActiveChanged(this);
 }
 
 bool ColliderBase::IsActive() const
@@ -131,6 +145,62 @@ bool ColliderBase::IsActive() const
 	return is_active;
 }
 
+void ColliderBase::SetMobility(const ColliderMobility new_mobility)
+{
+	if (mobility == new_mobility)
+	{
+		return;
+	}
+
+	mobility = new_mobility;
+	CollisionManager::GetInstance().OnColliderMobilityChanged(this);
+}
+
+void ColliderBase::SetContinuousCollisionEnabled(const bool is_enabled)
+{
+	if (_is_continuous_collision_enabled == is_enabled)
+	{
+		return;
+	}
+
+	_is_continuous_collision_enabled = is_enabled;
+	ResetContinuousCollisionSweep();
+	CollisionManager::GetInstance().OnColliderContinuousCollisionChanged(this);
+}
+
+void ColliderBase::ResetContinuousCollisionSweep()
+{
+	_sweep_start_position = (_world_aabb.left_top + _world_aabb.right_bottom) * 0.5f;
+}
+
+Vector2D ColliderBase::GetSweepDisplacement() const
+{
+	if (!_is_continuous_collision_enabled || IsStatic())
+	{
+		return Vector2D{};
+	}
+
+	const Vector2D displacement = (_world_aabb.left_top + _world_aabb.right_bottom) * 0.5f - _sweep_start_position;
+	if (displacement.LengthSquared() > MAX_SWEEP_DISTANCE * MAX_SWEEP_DISTANCE)
+	{
+		// ワープとみなす
+		return Vector2D{};
+	}
+	return displacement;
+}
+
+FRectAA ColliderBase::GetSweptAABB() const
+{
+	const Vector2D displacement = GetSweepDisplacement();
+	if (displacement.IsZeroVector())
+	{
+		return _world_aabb;
+	}
+
+	const FRectAA start_aabb(_world_aabb.left_top - displacement, _world_aabb.right_bottom - displacement);
+	return GeometricUtility::GetAARectUnion(start_aabb, _world_aabb);
+}
+
 void ColliderBase::SetShouldCheckWithHasCommonParent(const bool new_should_check_with_has_common_parent)
 {
 	should_check_with_has_common_parent = new_should_check_with_has_common_parent;
@@ -139,6 +209,7 @@ void ColliderBase::SetShouldCheckWithHasCommonParent(const bool new_should_check
 void ColliderBase::AddHitTarget(const CollisionObjectType new_target)
 {
 	hit_object_types |= static_cast<unsigned int>(new_target);
+	CollisionManager::GetInstance().OnColliderHitTargetsChanged(this);
 }
 
 void ColliderBase::RemoveHitTarget(const CollisionObjectType target_to_remove)
@@ -155,6 +226,7 @@ void ColliderBase::AddToHitTargetsOtherThan(const CollisionObjectType target_exc
 
 void ColliderBase::SetColliderCommonParams(const CollisionType new_collision_type, const CollisionObjectType new_collision_object_type, const std::vector<CollisionObjectType>& new_hit_object_types, const bool new_pushability)
 {
+	const CollisionObjectType old_collision_object_type = collision_object_type;
 	collision_type = new_collision_type;
 	collision_object_type = new_collision_object_type;
 	hit_object_types = 0;
@@ -163,6 +235,11 @@ void ColliderBase::SetColliderCommonParams(const CollisionType new_collision_typ
 		AddHitTarget(hit_object_type);
 	}
 	is_pushable = new_pushability;
+
+	if (collision_object_type != old_collision_object_type)
+	{
+		CollisionManager::GetInstance().OnColliderObjectTypeChanged(this, old_collision_object_type);
+	}
 }
 
 bool ColliderBase::ShouldCheckHitWith(const ColliderBase* other_collider) const
@@ -222,7 +299,9 @@ bool ColliderBase::HandlePushback(const HitResult& hit_result) const
 	constexpr float T_PER_N_THRESHOLD = 2.0f;	// 勾配が T_PER_N_THRESHOLD x100% 未満の坂なら真上から衝突した際に巻き戻し処理が行われる.
 
 	// めり込んでいて, 法線方向の速度がゼロでない
+	// 連続衝突判定で検出した衝突は接触時刻が分かっているので, 巻き戻しではなく押し戻し距離の分配で処理する
 	const bool should_rewind_time =
+		!hit_result.is_swept &&
 		relative_speed_n > N_SPEED_THRESHOLD &&
 		(relative_speed_t / relative_speed_n) < T_PER_N_THRESHOLD;
 
@@ -231,28 +310,10 @@ bool ColliderBase::HandlePushback(const HitResult& hit_result) const
 		// 時間の巻き戻しによる押し戻し
 
 		// "巻き戻し時間" = (めり込み深度) / (押し戻し方向スピード)
-		float rewind_time = hit_result.total_push_back_distance / relative_speed_n;
-		Vector2D delta_self_position = self_owner->GetVelocity() * (-rewind_time);
-		Vector2D delta_other_position = other_owner->GetVelocity() * (-rewind_time);
-		float rewind_distance_sq = 
-			(
-				hit_result.normal_from_other * Vector2D::Dot(hit_result.normal_from_other, (delta_self_position - delta_other_position))
-			).LengthSquared();
-
-		while (rewind_distance_sq > hit_result.total_push_back_distance*hit_result.total_push_back_distance)
-		{
-			rewind_time -= 1.f / 1024.f;
-			if(rewind_time < 0.f)
-			{
-				break;
-			}
-			delta_self_position = self_owner->GetVelocity() * (-rewind_time);
-			delta_other_position = other_owner->GetVelocity() * (-rewind_time);
-			rewind_distance_sq =
-				(
-					hit_result.normal_from_other * Vector2D::Dot(hit_result.normal_from_other, (delta_self_position - delta_other_position))
-					).LengthSquared();
-		}
+		// 巻き戻しによる法線方向の移動量は rewind_time * relative_speed_n なので, ちょうどめり込み深度だけ戻る
+		const float rewind_time = hit_result.total_push_back_distance / relative_speed_n;
+		const Vector2D delta_self_position = self_owner->GetVelocity() * (-rewind_time);
+		const Vector2D delta_other_position = other_owner->GetVelocity() * (-rewind_time);
 
 		// 巻き戻し時間が1フレームより十分に大きい場合は押し戻しを実行せず終了
 		if (rewind_time > 1.f / 10.f) 
@@ -347,8 +408,7 @@ void ColliderBase::CheckHitWith(HitResult& out_result_for_self, const ColliderBa
 			CheckCollidersHitImpl(out_result_for_self, this_as_box, dynamic_cast<const SegmentCollider*>(other_collider));
 			return;
 		case ColliderShape::CIRCLE:
-			// CheckCollidersHitImpl(out_result_for_self, this_as_box, dynamic_cast<const CircleCollider*>(other_collider));
-			throw std::runtime_error("Not implemented yet");
+			CheckCollidersHitImpl(out_result_for_self, this_as_box, dynamic_cast<const CircleCollider*>(other_collider));
 			return;
 		case ColliderShape::TRIANGLE:
 			CheckCollidersHitImpl(out_result_for_self, this_as_box, dynamic_cast<const TriangleCollider*>(other_collider));
@@ -367,8 +427,7 @@ void ColliderBase::CheckHitWith(HitResult& out_result_for_self, const ColliderBa
 			CheckCollidersHitImpl(out_result_for_self, this_as_segment, dynamic_cast<const SegmentCollider*>(other_collider));
 			return;
 		case ColliderShape::CIRCLE:
-			// CheckCollidersHitImpl(out_result_for_self, this_as_segment, dynamic_cast<const CircleCollider*>(other_collider));
-			throw std::runtime_error("Not implemented yet");
+			CheckCollidersHitImpl(out_result_for_self, this_as_segment, dynamic_cast<const CircleCollider*>(other_collider));
 			return;
 		case ColliderShape::TRIANGLE:
 			CheckCollidersHitImpl(out_result_for_self, this_as_segment, dynamic_cast<const TriangleCollider*>(other_collider));
@@ -377,24 +436,22 @@ void ColliderBase::CheckHitWith(HitResult& out_result_for_self, const ColliderBa
 	}
 	else if (this_shape == ColliderShape::CIRCLE)
 	{
-		throw std::runtime_error("Not implemented yet");
-		// const CircleCollider* this_as_circle = dynamic_cast<const CircleCollider*>(const_cast<ColliderBase*>(this));
-		//switch (other_shape)
-		//{
-		//case ColliderShape::BOX:
-		//	CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const BoxCollider*>(other_collider));
-		//	return;
-		//case ColliderShape::SEGMENT:
-		//	CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const SegmentCollider*>(other_collider));
-		//	return;
-		//case ColliderShape::CIRCLE:
-		//	CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const CircleCollider*>(other_collider));
-		//	throw std::runtime_error("Not implemented yet");
-		//	return;
-		//case ColliderShape::TRIANGLE:
-		//	CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const TriangleCollider*>(other_collider));
-		//	return;
-		//}
+		const CircleCollider* this_as_circle = dynamic_cast<const CircleCollider*>(const_cast<ColliderBase*>(this));
+		switch (other_shape)
+		{
+		case ColliderShape::BOX:
+			CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const BoxCollider*>(other_collider));
+			return;
+		case ColliderShape::SEGMENT:
+			CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const SegmentCollider*>(other_collider));
+			return;
+		case ColliderShape::CIRCLE:
+			CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const CircleCollider*>(other_collider));
+			return;
+		case ColliderShape::TRIANGLE:
+			CheckCollidersHitImpl(out_result_for_self, this_as_circle, dynamic_cast<const TriangleCollider*>(other_collider));
+			return;
+		}
 	}
 	else if (this_shape == ColliderShape::TRIANGLE)
 	{
@@ -408,8 +465,7 @@ void ColliderBase::CheckHitWith(HitResult& out_result_for_self, const ColliderBa
 			CheckCollidersHitImpl(out_result_for_self, this_as_triangle, dynamic_cast<const SegmentCollider*>(other_collider));
 			return;
 		case ColliderShape::CIRCLE:
-			// CheckCollidersHitImpl(out_result_for_self, this_as_triangle, dynamic_cast<const CircleCollider*>(other_collider));
-			throw std::runtime_error("Not implemented yet");
+			CheckCollidersHitImpl(out_result_for_self, this_as_triangle, dynamic_cast<const CircleCollider*>(other_collider));
 			return;
 		case ColliderShape::TRIANGLE:
 			CheckCollidersHitImpl(out_result_for_self, this_as_triangle, dynamic_cast<const TriangleCollider*>(other_collider));
@@ -418,23 +474,68 @@ void ColliderBase::CheckHitWith(HitResult& out_result_for_self, const ColliderBa
 	}
 }
 
-void ColliderBase::HandleHitResult(const HitResult& hit_result_for_self) const
+void ColliderBase::CheckSweptHitWith(HitResult& out_result_for_self, const ColliderBase* other_collider) const
+{
+	out_result_for_self = HitResult{};
+
+	// 相手を静止させたときの自身の移動量
+	const Vector2D relative_displacement = GetSweepDisplacement() - other_collider->GetSweepDisplacement();
+	if (relative_displacement.LengthSquared() < EPSIRON * EPSIRON)
+	{
+		return;
+	}
+
+	std::array<Vector2D, MAX_CONVEX_VERTICES> self_vertices;
+	std::array<Vector2D, MAX_CONVEX_VERTICES> other_vertices;
+	const int num_self_vertices = GetConvexVertexPositions(self_vertices);
+	const int num_other_vertices = other_collider->GetConvexVertexPositions(other_vertices);
+
+	// 移動前の位置から掃引する
+	for (int i = 0; i < num_self_vertices; ++i)
+	{
+		self_vertices[i] -= relative_displacement;
+	}
+
+	float time_of_impact;
+	Vector2D normal_from_other;
+	if (!GeometricUtility::SweepConvexPolygonAgainstAnother(
+		self_vertices.data(), num_self_vertices, relative_displacement,
+		other_vertices.data(), num_other_vertices,
+		time_of_impact, normal_from_other))
+	{
+		return;
+	}
+
+	// 接触後の移動量のうち, 法線方向の成分だけを打ち消す. 接線方向の成分は残るので面に沿って滑る
+	const float push_back_distance = (1.f - time_of_impact) * fabsf(Vector2D::Dot(normal_from_other, relative_displacement));
+	out_result_for_self = MakeSweptHitResult(this, other_collider, normal_from_other, push_back_distance);
+}
+
+bool ColliderBase::HandleHitResult(const HitResult& hit_result_for_self) const
 {
 	bool should_call_on_hit_collision = true;
+	bool has_executed_pushback = false;
 
 	if (hit_result_for_self.collision_type == CollisionType::BLOCK)
 	{
-		const bool has_executed_pushback = HandlePushback(hit_result_for_self);
+		has_executed_pushback = HandlePushback(hit_result_for_self);
 		should_call_on_hit_collision = has_executed_pushback;
 	}
 
 	if(should_call_on_hit_collision && _generate_hit_event && hit_result_for_self.other_collider->_generate_hit_event)
 	{
+		const ColliderBase* other_collider = hit_result_for_self.other_collider;
+
+		// Sleepのアクターは衝突した次のフレームに1回だけ更新する
+		GetOwnerActor()->WakeTick();
+		other_collider->GetOwnerActor()->WakeTick();
+
 		GetOwnerActor()->OnHitCollision(hit_result_for_self);
 
-		const ColliderBase* other_collider = hit_result_for_self.other_collider;
 		// 衝突相手のHitResultを用意して、相手の親Actorに渡す
 		HitResult hit_result_for_other = hit_result_for_self.GetInverted();
 		other_collider->GetOwnerActor()->OnHitCollision(hit_result_for_other);
 	}
+
+	return has_executed_pushback;
 }
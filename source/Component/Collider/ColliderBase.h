@@ -5,6 +5,7 @@
 #include "HitResult.h"
 #include "CheckCollidersHitImplements.h"
 #include <vector>
+#include <array>
 
 struct HitResult;
 class BoxCollider;
@@ -67,6 +68,21 @@ struct ColliderDebugDrawDesc
 	};
 
 	Triangle triangle;
+
+	struct Circle
+	{
+		Circle()
+			: line_color(0xFF0000)
+			, line_alpha(255)
+			, line_thickness(3)
+		{
+		}
+		int line_color;
+		int line_alpha;
+		int line_thickness;
+	};
+
+	Circle circle;
 };
 
 /// <summary>
@@ -74,12 +90,22 @@ struct ColliderDebugDrawDesc
 /// </summary>
 class ColliderBase : public SceneComponent
 {
+	// 衝突判定のパイプラインから判定と衝突結果の処理を呼ぶため
+	friend class CollisionManager;
+
 protected:
 	enum class ColliderShape : uint8_t
 	{
 		BOX, SEGMENT, CIRCLE, TRIANGLE
 	};
 
+public:
+	// GetConvexVertexPositions()で取得できる頂点の最大数
+	static constexpr int MAX_CONVEX_VERTICES = 4;
+
+	// 連続衝突判定で扱う1フレームの移動量の上限 [px]. これより大きな移動はワープとみなし, 経路上の衝突を検出しない
+	static constexpr float MAX_SWEEP_DISTANCE = 256.f;
+
 public:
 	ColliderBase()
 		: is_active(true)
@@ -91,6 +117,13 @@ public:
 		, debug_collider_id(0)
 		, _generate_hit_event(true)
 		, mass(1.f)
+		, mobility(ColliderMobility::DYNAMIC)
+		, serial_number(0)
+		, _index_in_all_colliders(-1)
+		, _index_in_continuous_colliders(-1)
+		, _world_aabb{}
+		, _is_continuous_collision_enabled(false)
+		, _sweep_start_position{}
 	{}
 	virtual ~ColliderBase() {}
 
@@ -115,6 +148,13 @@ public:
 	/// </summary>
 	virtual void GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const = 0;
 
+	/// <summary>
+	/// 凸多角形としてのワールド空間の頂点座標を取得する. 連続衝突判定に使う
+	/// <para>隣り合う要素同士が辺を形成する. 線分は2頂点</para>
+	/// </summary>
+	/// <returns>頂点数. 多角形で表せない形状の場合は0</returns>
+	virtual int GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const = 0;
+
 	virtual void RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params) = 0;
 	virtual void RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params) = 0;
 	virtual void DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc = ColliderDebugDrawDesc{});
@@ -125,27 +165,66 @@ public:
 	/// <returns></returns>
 	virtual Vector2D GetCenterWorldPosition() const = 0;
 
+protected:
 	/// <summary>
-	/// コライダーのAABBを取得する
+	/// ワールド空間の形状のキャッシュを現在のトランスフォームと形状パラメータから計算し直す
 	/// </summary>
-	virtual void GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const = 0;
+	/// <returns>ワールド空間の形状のAABB</returns>
+	virtual FRectAA UpdateWorldShapeCache() = 0;
 private:
 	void CheckHitWith(HitResult& out_result_for_self, const ColliderBase* other_collider) const;
 	//~ End ColliderBase interface
 
+	/// <summary>
+	/// 前回の衝突処理からの移動経路上で, 他のコライダーと最初に接触するかを判定する
+	/// <para>互いの移動量の差だけ自身を動かし, 移動前の位置から掃引する. 回転は考慮しない</para>
+	/// <para>BLOCKの場合, 押し戻し距離は接触後の移動量の法線成分になる</para>
+	/// </summary>
+	void CheckSweptHitWith(HitResult& out_result_for_self, const ColliderBase* other_collider) const;
+
 public:
 	/// <summary>
-	/// 他のコライダーとOVERLAP衝突しているか
+	/// コライダーのAABBを取得する
+	/// <para>トランスフォームか形状が変わったときに計算したキャッシュを返す</para>
 	/// </summary>
-	bool IsOverlappingWith(const ColliderBase* other_collider) const;
+	void GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const
+	{
+		out_left_top = _world_aabb.left_top;
+		out_right_bottom = _world_aabb.right_bottom;
+	}
+	const FRectAA& GetWorldAABB() const { return _world_aabb; }
+
+	/// <summary>
+	/// 連続衝突判定を有効にするか. デフォルトはfalse
+	/// <para>有効にすると, 前回の衝突処理から現在までの移動経路上の衝突も検出する. 1フレームで薄いコライダーを通り抜けるほど速いコライダーに使う</para>
+	/// </summary>
+	void SetContinuousCollisionEnabled(const bool is_enabled);
+	bool IsContinuousCollisionEnabled() const { return _is_continuous_collision_enabled; }
+
+	/// <summary>
+	/// 連続衝突判定の移動経路の始点を現在位置にする
+	/// <para>衝突処理の最後にCollisionManagerから呼ばれる. ワープなど, 経路上の衝突を検出すべきでない移動の後にも呼ぶ</para>
+	/// </summary>
+	void ResetContinuousCollisionSweep();
+
+	/// <summary>
+	/// 前回の衝突処理から現在までの移動量. 連続衝突判定が無効な場合とワープとみなす場合はゼロ
+	/// </summary>
+	Vector2D GetSweepDisplacement() const;
 
 	/// <summary>
-	/// other_colliderとの衝突有無をチェックし, 衝突有の場合は衝突解消とその後の処理を行う.
+	/// 前回の衝突処理から現在までの移動経路全体を覆うAABB. 連続衝突判定が無効な場合はGetWorldAABB()と同じ
 	/// </summary>
-	/// <param name="other_collider">自コライダーとの衝突をチェックするコライダー</param>
-	void HandleCollisionWith(const ColliderBase* other_collider) const;
+	FRectAA GetSweptAABB() const;
+
+public:
+	/// <summary>
+	/// 他のコライダーとOVERLAP衝突しているか
+	/// </summary>
+	bool IsOverlappingWith(const ColliderBase* other_collider) const;
 
 	CollisionObjectType GetCollisionObjectType() const { return collision_object_type; }
+	CollisionObjectType_UnderlyingType GetHitObjectTypes() const { return hit_object_types; }
 	CollisionType GetCollisionType() const { return collision_type; }
 
 	/// <summary>
@@ -155,6 +234,19 @@ public:
 
 	float GetMass() const { return mass; }
 	void SetMass(const float new_mass) { mass = new_mass; }
+
+	/// <summary>
+	/// 可動性を設定する. デフォルトはDYNAMIC
+	/// <para>STATICのコライダーはブロードフェーズの静的インデックスに登録され, 静的コライダー同士の衝突判定が省略される</para>
+	/// </summary>
+	void SetMobility(const ColliderMobility new_mobility);
+	ColliderMobility GetMobility() const { return mobility; }
+	bool IsStatic() const { return mobility == ColliderMobility::STATIC; }
+
+	/// <summary>
+	/// CollisionManagerへの登録順に振られる通し番号. 衝突処理の順序を決めるのに使う
+	/// </summary>
+	uint32_t GetSerialNumber() const { return serial_number; }
 	
 	// コリジョンを無効化
 	void Deactivate();
@@ -224,6 +316,11 @@ protected:
 	);
 
 
+	/// <summary>
+	/// 形状パラメータが変わったときに派生クラスから呼ぶ. キャッシュを更新し, CollisionManagerに通知する
+	/// </summary>
+	void OnColliderShapeChanged();
+
 	template<typename QueryParamsType>
 	bool ShouldCheckQueryHit(const QueryParamsType& query_params)
 	{
@@ -238,7 +335,12 @@ protected:
 
 private:
 	bool ShouldCheckHitWith(const ColliderBase* other_collider) const;
-	void HandleHitResult(const HitResult& hit_result_for_self) const;
+
+	/// <summary>
+	/// 衝突結果の処理. 押し戻しとActor::OnHitCollision()の呼び出しを行う
+	/// </summary>
+	/// <returns>押し戻しが行われたか</returns>
+	bool HandleHitResult(const HitResult& hit_result_for_self) const;
 
 	/// <summary>
 	/// 押し戻し処理.
@@ -246,6 +348,11 @@ private:
 	/// <returns>押し戻しが行われたか</returns>
 	bool HandlePushback(const HitResult& hit_result) const;
 
+	/// <summary>
+	/// ワールド空間の形状とAABBのキャッシュを更新する
+	/// </summary>
+	void RefreshWorldShapeCache();
+
 	bool is_active;
 	bool _generate_hit_event;	// ヒット時にActor::OnHitCollision()を呼ぶか否か
 	bool should_check_with_has_common_parent;	// 親アクターが同じコライダーとの衝突をチェックするか
@@ -254,6 +361,13 @@ private:
 	CollisionObjectType_UnderlyingType hit_object_types;	// 衝突対象のオブジェクトタイプの論理和
 	bool is_pushable;	// 押し戻し可能か
 	float mass;
+	ColliderMobility mobility;	// 可動性
+	uint32_t serial_number;	// CollisionManagerが振る通し番号
+	int _index_in_all_colliders;	// CollisionManager::all_colliders内の位置. 登録されていない場合は-1
+	int _index_in_continuous_colliders;	// CollisionManager::_continuous_colliders内の位置. 登録されていない場合は-1
+	FRectAA _world_aabb;	// ワールド空間のAABBのキャッシュ
+	bool _is_continuous_collision_enabled;	// 連続衝突判定を行うか
+	Vector2D _sweep_start_position;	// 連続衝突判定の移動経路の始点でのAABBの中心
 
 	// デバッグ線描画パラメータ
 	DebugColliderLineParams debug_line_params;
@@ -13,6 +13,18 @@ enum class CollisionType : uint8_t
 	BLOCK,
 };
 
+/// <summary>
+/// コライダーの可動性
+/// </summary>
+enum class ColliderMobility : uint8_t
+{
+	// ステージ読み込み後に移動しない. 静的コライダー同士の衝突判定は行われない
+	STATIC,
+
+	// 移動し得る
+	DYNAMIC,
+};
+
 /// <summary>
 /// コライダーの分類. コライダーに自身のCollisionObjectTypeと, 衝突判定を行う相手のCollisionObjectTypeを設定することで衝突対象を指定する.
 /// <para>ある1組の2コライダー間の衝突判定を行う条件は, 両コライダーが互いを衝突対象に設定している事</para>
@@ -10,6 +10,7 @@ HitResult HitResult::GetInverted() const
     inverted_result.has_hit = has_hit;
 	inverted_result.collision_type = collision_type;
 	inverted_result.total_push_back_distance = total_push_back_distance;
+	inverted_result.is_swept = is_swept;
 
 	// 反転で入れ替える項目
 	inverted_result.self_collider = other_collider;
@@ -58,4 +59,17 @@ HitResult MakeHitResult(const ColliderBase* self_collider, const ColliderBase* o
 		block_result.normal_from_other = normal;
 		return block_result;
 	}
+}
+
+HitResult MakeSweptHitResult(const ColliderBase* self_collider, const ColliderBase* other_collider, const Vector2D& normal_from_other, const float push_back_distance)
+{
+	// 法線と押し戻し距離はBLOCKの場合だけ使う
+	HitResult swept_result = MakeHitResult(self_collider, other_collider, normal_from_other);
+	swept_result.is_swept = true;
+	if (swept_result.collision_type == CollisionType::BLOCK)
+	{
+		swept_result.normal_from_other = normal_from_other;
+		swept_result.total_push_back_distance = push_back_distance;
+	}
+	return swept_result;
 }
\ No newline at end of file
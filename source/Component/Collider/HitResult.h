@@ -34,6 +34,7 @@ struct HitResult
 		, other_collider(other_collider_in)
 		, total_push_back_distance(push_back_distance_in)
 		, normal_from_other(normal_in)
+		, is_swept(false)
 	{}
 	~HitResult() {}
 
@@ -58,6 +59,9 @@ struct HitResult
 
 	// 押し戻し法線
 	Vector2D normal_from_other;
+
+	// 連続衝突判定で検出した衝突か. この場合, 押し戻し距離は接触後の移動量の法線成分で, 時間の巻き戻しは行わない
+	bool is_swept;
 };
 
 /// <summary>
@@ -65,6 +69,13 @@ struct HitResult
 /// </summary>
 HitResult MakeHitResult(const ColliderBase* self_collider, const ColliderBase* other_collider, const Vector2D& penetration_depth);
 
+/// <summary>
+/// 連続衝突判定の衝突結果を作成
+/// </summary>
+/// <param name="normal_from_other">接触した辺の, otherからselfへ向かう単位法線</param>
+/// <param name="push_back_distance">接触後の移動量の法線成分の大きさ</param>
+HitResult MakeSweptHitResult(const ColliderBase* self_collider, const ColliderBase* other_collider, const Vector2D& normal_from_other, const float push_back_distance);
+
 struct CollisionQueryParams_SingleLineTrace
 {
 	FSegment segment;
@@ -6,12 +6,12 @@
 
 void SegmentCollider::Initialize()
 {
-	__super::Initialize();
+	ColliderBase::Initialize();
 }
 
 void SegmentCollider::Finalize()
 {
-	__super::Finalize();
+	ColliderBase::Finalize();
 }
 
 void SegmentCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params)
@@ -25,11 +25,7 @@ void SegmentCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& quer
 	}
 	else
 	{
-		FSegment this_segment = FSegment
-		{
-			CalcSegmentEndPosition(SegmentEnd::LEFT),
-			CalcSegmentEndPosition(SegmentEnd::RIGHT)
-		};
+		const FSegment& this_segment = _world_segment;
 
 		query_result.hit_collider = this;
 		query_result.has_hit
@@ -58,13 +54,7 @@ void SegmentCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& qu
 	}
 	else
 	{
-		FSegment segment
-		{
-			CalcSegmentEndPosition(SegmentEnd::LEFT),
-			CalcSegmentEndPosition(SegmentEnd::RIGHT)
-		};
-
-		query_result.has_hit = GeometricUtility::DoesRectOverlapWithSegment(query_params.rect.ToFRect(), segment);
+		query_result.has_hit = GeometricUtility::DoesRectOverlapWithSegment(query_params.rect.ToFRect(), _world_segment);
 		if (query_result.has_hit)
 		{
 			query_result.hit_colliders.push_back(this);
@@ -74,10 +64,10 @@ void SegmentCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& qu
 
 void SegmentCollider::DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc)
 {
-	__super::DrawDebugLines(camera_params, desc);
+	ColliderBase::DrawDebugLines(camera_params, desc);
 
-	const Vector2D left_end = CalcSegmentEndPosition(SegmentEnd::LEFT);
-	const Vector2D right_end = CalcSegmentEndPosition(SegmentEnd::RIGHT);
+	const Vector2D& left_end = _world_segment.start;
+	const Vector2D& right_end = _world_segment.end;
 
 	int x1, y1, x2, y2;
 	Vector2D::WorldToViewport(left_end, camera_params).ToIntRound(x1, y1);
@@ -92,17 +82,23 @@ void SegmentCollider::DrawDebugLines(const CameraParams& camera_params, const Co
 
 Vector2D SegmentCollider::GetCenterWorldPosition() const
 {
-	return GetWorldPosition();
+	return _world_segment.GetMidPoint();
 }
 
-void SegmentCollider::GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const
+FRectAA SegmentCollider::UpdateWorldShapeCache()
 {
-	const Vector2D end_a = CalcSegmentEndPosition(SegmentEnd::LEFT);
-	const Vector2D end_b = CalcSegmentEndPosition(SegmentEnd::RIGHT);
-	out_left_top.x = std::min(end_a.x, end_b.x);
-	out_left_top.y = std::min(end_a.y, end_b.y);
-	out_right_bottom.x = std::max(end_a.x, end_b.x);
-	out_right_bottom.y = std::max(end_a.y, end_b.y);
+	const Transform world_transform = GetWorldTransform();
+	_world_segment.start = world_transform.TransformLocation(GetSegmentEndLocalPosition(SegmentEnd::LEFT));
+	_world_segment.end = world_transform.TransformLocation(GetSegmentEndLocalPosition(SegmentEnd::RIGHT));
+
+	const Vector2D& end_a = _world_segment.start;
+	const Vector2D& end_b = _world_segment.end;
+	FRectAA aabb{};
+	aabb.left_top.x = std::min(end_a.x, end_b.x);
+	aabb.left_top.y = std::min(end_a.y, end_b.y);
+	aabb.right_bottom.x = std::max(end_a.x, end_b.x);
+	aabb.right_bottom.y = std::max(end_a.y, end_b.y);
+	return aabb;
 }
 
 ColliderBase::ColliderShape SegmentCollider::GetColliderShape() const
@@ -112,8 +108,15 @@ ColliderBase::ColliderShape SegmentCollider::GetColliderShape() const
 
 void SegmentCollider::GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const
 {
-	out_vertex_positions.push_back(CalcSegmentEndPosition(SegmentEnd::LEFT));
-	out_vertex_positions.push_back(CalcSegmentEndPosition(SegmentEnd::RIGHT));
+	out_vertex_positions.push_back(_world_segment.start);
+	out_vertex_positions.push_back(_world_segment.end);
+}
+
+int SegmentCollider::GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const
+{
+	out_vertex_positions[0] = _world_segment.start;
+	out_vertex_positions[1] = _world_segment.end;
+	return 2;
 }
 
 void SegmentCollider::SetSegmentColliderParams(const CollisionType new_collision_type, const CollisionObjectType new_collision_object_type, const std::vector<CollisionObjectType>& new_hit_object_types, const bool new_pushability, const float new_length)
@@ -124,19 +127,17 @@ void SegmentCollider::SetSegmentColliderParams(const CollisionType new_collision
 		new_hit_object_types,
 		new_pushability
 	);
-	_length = new_length;
+	SetLength(new_length);
 }
 
 Vector2D SegmentCollider::CalcSegmentEndPosition(const SegmentEnd segment_end) const
 {
-	const Vector2D segment_end_local = GetSegmentEndLocalPosition(segment_end);
-	return GetWorldTransform().TransformLocation(segment_end_local);
+	return segment_end == SegmentEnd::LEFT ? _world_segment.start : _world_segment.end;
 }
 
 Vector2D SegmentCollider::CalcSegmentCenterToEnd(const SegmentEnd segment_end) const
 {
-	const Vector2D segment_end_local = GetSegmentEndLocalPosition(segment_end);
-	return GetWorldTransform().TransformDirection(segment_end_local);
+	return CalcSegmentEndPosition(segment_end) - _world_segment.GetMidPoint();
 }
 
 Vector2D SegmentCollider::GetSegmentEndLocalPosition(const SegmentEnd segment_end) const
@@ -155,12 +156,13 @@ Vector2D SegmentCollider::GetSegmentEndLocalPosition(const SegmentEnd segment_en
 void SegmentCollider::SetLength(const float new_length)
 {
 	_length = new_length;
+	OnColliderShapeChanged();
 }
 
 void SegmentCollider::DrawLine(const CameraParams& camera_params, const int color, const int thickness)
 {
-	const Vector2D from = CalcSegmentEndPosition(SegmentEnd::LEFT);
-	const Vector2D to = CalcSegmentEndPosition(SegmentEnd::RIGHT);
+	const Vector2D& from = _world_segment.start;
+	const Vector2D& to = _world_segment.end;
 	int x1, y1, x2, y2;
 	Vector2D::WorldToViewport(from, camera_params).ToIntRound(x1, y1);
 	Vector2D::WorldToViewport(to, camera_params).ToIntRound(x2, y2);
@@ -14,7 +14,9 @@ enum class SegmentEnd
 class SegmentCollider : public ColliderBase
 {
 public:
-	SegmentCollider() {}
+	SegmentCollider()
+		: _length(0.f)
+	{}
 	virtual ~SegmentCollider() {};
 
 	//~ Begin ComponentBase interface
@@ -27,11 +29,13 @@ public:
 public:
 	virtual ColliderShape GetColliderShape() const override;
 	virtual void GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const override;
+	virtual int GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const override;
 	virtual void RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params) override;
 	virtual void RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params) override;
 	virtual void DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc = ColliderDebugDrawDesc{}) override;
 	virtual Vector2D GetCenterWorldPosition() const override;
-	virtual void GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const override;
+protected:
+	virtual FRectAA UpdateWorldShapeCache() override;
 	//~ End ColliderBase interface
 
 public:
@@ -58,6 +62,12 @@ public:
 	// 端点のワールド座標を計算
 	Vector2D CalcSegmentEndPosition(const SegmentEnd segment_end) const;
 
+	/// <summary>
+	/// ワールド空間での線分を取得. 始点が左端, 終点が右端
+	/// <para>トランスフォームか形状が変わったときに計算したキャッシュを返す</para>
+	/// </summary>
+	const FSegment& GetWorldSegment() const { return _world_segment; }
+
 	/// <summary>
 	/// 端点のローカル座標を取得
 	/// </summary>
@@ -71,4 +81,7 @@ public:
 private:
 	// 線分の長さ
 	float _length;
+
+	// ワールド空間での線分のキャッシュ
+	FSegment _world_segment;
 };
\ No newline at end of file
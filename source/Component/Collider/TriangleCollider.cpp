@@ -17,12 +17,13 @@ ColliderBase::ColliderShape TriangleCollider::GetColliderShape() const
 
 void TriangleCollider::GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const
 {
-	out_vertex_positions = std::vector<Vector2D>();
-	out_vertex_positions.reserve(3);
-	for(auto& v_local : _vertex_local_positions)
-	{
-		out_vertex_positions.push_back(GetWorldTransform().TransformLocation(v_local));
-	}
+	_world_triangle.GetVertices(out_vertex_positions);
+}
+
+int TriangleCollider::GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const
+{
+	std::copy(_world_triangle.vertices.begin(), _world_triangle.vertices.end(), out_vertex_positions.begin());
+	return 3;
 }
 
 void TriangleCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params)
@@ -30,8 +31,7 @@ void TriangleCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& que
 	query_result = QueryResult_SingleLineTrace{};
 	query_result.has_hit = false;
 
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
+	const std::array<Vector2D, 3>& vertex_positions = _world_triangle.vertices;
 
 	std::array<FSegment, 3> edge_segments;
 	for (size_t i = 0; i < 3; i++)
@@ -74,9 +74,7 @@ void TriangleCollider::RespondToSingleLineTrace(QueryResult_SingleLineTrace& que
 
 void TriangleCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params)
 {
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
-	query_result.has_hit = GeometricUtility::DoesAARectOverlapWithTriangle(query_params.rect, FTriangle(vertex_positions));
+	query_result.has_hit = GeometricUtility::DoesAARectOverlapWithTriangle(query_params.rect, _world_triangle);
 	if (query_result.has_hit)
 	{
 		query_result.hit_colliders.push_back(this);
@@ -85,10 +83,9 @@ void TriangleCollider::RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& q
 
 void TriangleCollider::DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc)
 {
-	__super::DrawDebugLines(camera_params, desc);
+	ColliderBase::DrawDebugLines(camera_params, desc);
 
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
+	const std::array<Vector2D, 3>& vertex_positions = _world_triangle.vertices;
 	for (size_t i = 0; i < 3; i++)
 	{
 		const Vector2D& start = vertex_positions.at(i);
@@ -101,36 +98,29 @@ void TriangleCollider::DrawDebugLines(const CameraParams& camera_params, const C
 Vector2D TriangleCollider::GetCenterWorldPosition() const
 {
 	Vector2D center{};
-	for (auto& v : _vertex_local_positions)
+	for (auto& v : _world_triangle.vertices)
 	{
-		center += GetWorldTransform().TransformLocation(v);
+		center += v;
 	}
 
 	center /= 3.f;
 	return center;
 }
 
-void TriangleCollider::GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const
+FRectAA TriangleCollider::UpdateWorldShapeCache()
 {
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
+	const Transform world_transform = GetWorldTransform();
 	float left = FLT_MAX, top = FLT_MAX, right = -FLT_MAX, bottom = -FLT_MAX;
-	for (const auto& vertex : vertex_positions)
+	for (size_t i = 0; i < 3; i++)
 	{
+		const Vector2D vertex = world_transform.TransformLocation(_vertex_local_positions.at(i));
+		_world_triangle.vertices.at(i) = vertex;
 		left = std::min(left, vertex.x);
 		top = std::min(top, vertex.y);
 		right = std::max(right, vertex.x);
 		bottom = std::max(bottom, vertex.y);
 	}
-	out_left_top = Vector2D(left, top);
-	out_right_bottom = Vector2D(right, bottom);
-}
-
-FTriangle TriangleCollider::GetTriangle() const
-{
-	std::vector<Vector2D> vertex_positions;
-	GetVertexPositions(vertex_positions);
-	return FTriangle(vertex_positions);
+	return FRectAA{ Vector2D(left, top), Vector2D(right, bottom) };
 }
 
 void TriangleCollider::SetTriangleColliderParams(const CollisionType new_collision_type, const CollisionObjectType new_collision_object_type, const std::vector<CollisionObjectType>& new_hit_object_types, const bool new_pushability, const std::array<Vector2D, 3>& vertex_local_positions)
@@ -143,5 +133,6 @@ void TriangleCollider::SetTriangleColliderParams(const CollisionType new_collisi
 	);
 
 	_vertex_local_positions = vertex_local_positions;
+	OnColliderShapeChanged();
 }
 
@@ -15,6 +15,7 @@ public:
 public:
 	virtual ColliderShape GetColliderShape() const override;
 	virtual void GetVertexPositions(std::vector<Vector2D>& out_vertex_positions) const override;
+	virtual int GetConvexVertexPositions(std::array<Vector2D, MAX_CONVEX_VERTICES>& out_vertex_positions) const override;
 	virtual void RespondToSingleLineTrace(QueryResult_SingleLineTrace& query_result, const CollisionQueryParams_SingleLineTrace& query_params) override;
 	virtual void RespondToMultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params) override;
 	virtual void DrawDebugLines(const CameraParams& camera_params, const ColliderDebugDrawDesc& desc = ColliderDebugDrawDesc{}) override;
@@ -24,11 +25,15 @@ public:
 	/// </summary>
 	/// <returns></returns>
 	virtual Vector2D GetCenterWorldPosition() const override;
-	virtual void GetAABB(Vector2D& out_left_top, Vector2D& out_right_bottom) const override;
+protected:
+	virtual FRectAA UpdateWorldShapeCache() override;
 	//~ End ColliderBase interface
 
 public:
-	FTriangle GetTriangle() const;
+	/// <summary>
+	/// ワールド空間での三角形を取得. トランスフォームか形状が変わったときに計算したキャッシュを返す
+	/// </summary>
+	const FTriangle& GetTriangle() const { return _world_triangle; }
 
 	/// <summary>
 	/// 三角形コライダーのパラメータをまとめてセット
@@ -49,4 +54,7 @@ public:
 private:
 	// このコライダーを原点とする空間での頂点座標
 	std::array<Vector2D, 3> _vertex_local_positions;
+
+	// ワールド空間での三角形のキャッシュ
+	FTriangle _world_triangle;
 };
\ No newline at end of file
@@ -13,7 +13,7 @@ EmitterComponent::~EmitterComponent()
 
 void EmitterComponent::Tick(float delta_seconds)
 {
-	__super::Tick(delta_seconds);
+	SceneComponent::Tick(delta_seconds);
 
 	if (!_emitter_params)
 	{
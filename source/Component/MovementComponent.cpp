@@ -1,5 +1,6 @@
 #include "MovementComponent.h"
 #include "Actor/Actor.h"
+#include "Component/Collider/ColliderBase.h"
 
 MovementComponent::MovementComponent()
 {
@@ -8,3 +9,15 @@ MovementComponent::MovementComponent()
 MovementComponent::~MovementComponent()
 {
 }
+
+void MovementComponent::SetContinuousCollisionEnabled(const bool is_enabled)
+{
+	for (ComponentBase* const component : GetOwnerActor()->GetComponents())
+	{
+		ColliderBase* const collider = dynamic_cast<ColliderBase*>(component);
+		if (collider)
+		{
+			collider->SetContinuousCollisionEnabled(is_enabled);
+		}
+	}
+}
@@ -16,4 +16,10 @@ public:
 	virtual Vector2D GetVelocity() const = 0;
 	virtual void SetVelocity(const Vector2D& new_velocity) = 0;
 	//~ End MovementComponent interface
+
+	/// <summary>
+	/// 所有アクターの全コライダーの連続衝突判定の有効・無効を設定する
+	/// <para>1フレームで薄いコライダーを通り抜けるほど速く動かす場合に有効にする. 呼び出し後に追加されたコライダーには反映されない</para>
+	/// </summary>
+	void SetContinuousCollisionEnabled(const bool is_enabled);
 };
\ No newline at end of file
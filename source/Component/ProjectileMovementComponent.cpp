@@ -18,7 +18,7 @@ ProjectileMovementComponent::~ProjectileMovementComponent()
 
 void ProjectileMovementComponent::Tick(const float delta_seconds)
 {
-    __super::Tick(delta_seconds);
+    MovementComponent::Tick(delta_seconds);
 
     UpdateVelocity(delta_seconds);
 
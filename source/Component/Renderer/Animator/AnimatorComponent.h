@@ -39,7 +39,7 @@ public:
 public:
 	virtual void Tick(const float delta_seconds) override
 	{
-		__super::Tick(delta_seconds);
+		AnimRendererComponent::Tick(delta_seconds);
 		const uint8_t next_state = _anim_states.at(_current_anim_state).update_func(static_cast<Derived*>(this));
 		if (next_state != _current_anim_state)
 		{
@@ -2,13 +2,13 @@
 
 void PlayerAnimatorComponent::Initialize()
 {
-	__super::Initialize();
+	AnimatorComponent<PlayerAnimatorComponent>::Initialize();
 	_player_ref = dynamic_cast<Player*>(GetOwnerActor());
 }
 
 void PlayerAnimatorComponent::Tick(const float delta_seconds)
 {
-	__super::Tick(delta_seconds);
+	AnimatorComponent<PlayerAnimatorComponent>::Tick(delta_seconds);
 
 	_movement_mode = _player_ref->GetMovementMode();
 	_velocity = _player_ref->GetVelocity();
@@ -8,7 +8,7 @@ TacklingEnemyAnimatorComponent::TacklingEnemyAnimatorComponent()
 
 void TacklingEnemyAnimatorComponent::Initialize()
 {
-	__super::Initialize();
+	AnimatorComponent<TacklingEnemyAnimatorComponent>::Initialize();
 	_tackling_enemy_ref = dynamic_cast<TacklingEnemy*>(GetOwnerActor());
 	assert(_tackling_enemy_ref);
 }
@@ -3,7 +3,7 @@
 
 void WalkingEnemyAnimatorComponent::Initialize()
 {
-	__super::Initialize();
+	AnimatorComponent<WalkingEnemyAnimatorComponent>::Initialize();
 
 	_walking_enemy_ref = dynamic_cast<WalkingEnemy*>(GetOwnerActor());
 }
@@ -11,12 +11,12 @@ void WalkingEnemyAnimatorComponent::Initialize()
 void WalkingEnemyAnimatorComponent::Finalize()
 {
 	_walking_enemy_ref = nullptr;
-	__super::Finalize();
+	AnimatorComponent<WalkingEnemyAnimatorComponent>::Finalize();
 }
 
 void WalkingEnemyAnimatorComponent::Tick(const float delta_seconds)
 {
-	__super::Tick(delta_seconds);
+	AnimatorComponent<WalkingEnemyAnimatorComponent>::Tick(delta_seconds);
 
 	if (!_walking_enemy_ref)
 	{
@@ -1,6 +1,17 @@
 #include "RendererComponent.h"
 #include "GameSystems/MasterData/MasterDataInclude.h"
 #include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "Actor/Actor.h"
+
+Vector2D RendererComponentBase::GetRenderWorldPosition() const
+{
+	const Actor* const owner_actor = GetOwnerActor();
+	if (owner_actor == nullptr)
+	{
+		return GetWorldPosition();
+	}
+	return GetWorldPosition() + owner_actor->GetRenderInterpolationOffset();
+}
 
 AnimRendererComponent::AnimRendererComponent()
 	: _is_playing(false)
@@ -14,14 +25,14 @@ AnimRendererComponent::~AnimRendererComponent()
 
 void AnimRendererComponent::Initialize()
 {
-	__super::Initialize();
+	RendererComponentBase::Initialize();
 	_is_playing = false;
 	_anim_state = std::make_unique<AnimationState>();
 }
 
 void AnimRendererComponent::Tick(const float delta_seconds)
 {
-	__super::Tick(delta_seconds);
+	RendererComponentBase::Tick(delta_seconds);
 
 	if (!_is_playing)
 	{
@@ -102,7 +113,7 @@ void AnimRendererComponent::RendererDraw(const CameraParams& camera_params)
 			}
 
 			const int graph_handle = sprite_graph_handles.at(i_sprite);
-			const Vector2D play_position = Vector2D::WorldToViewport(GetWorldPosition(), camera_params);
+			const Vector2D play_position = Vector2D::WorldToViewport(GetRenderWorldPosition(), camera_params);
 			const float play_rotation = GetWorldRotation();
 
 			const int blend_mode = MasterHelper::GetAnimationBlendModeForDxLib(MdAnimation::Get(target_anim_state->anim_info.animation_id));
@@ -156,7 +167,7 @@ void InAnimateRenderer::RendererDraw(const CameraParams& camera_params)
 		return;
 	}
 
-	const Vector2D screen_pos = Vector2D::WorldToViewport(GetWorldPosition(), camera_params);
+	const Vector2D screen_pos = Vector2D::WorldToViewport(GetRenderWorldPosition(), camera_params);
 	const float actual_ex_rate = 1.f / camera_params.screen_scale * 1.25f * _ex_rate;
 
 	DxLib::DrawRotaGraph(
@@ -20,7 +20,7 @@ public:
 	{
 		if (_is_visible) 
 		{
-			__super::Draw(camera_params);
+			SceneComponent::Draw(camera_params);
 			RendererDraw(camera_params);
 		}
 	}
@@ -31,6 +31,11 @@ protected:
 	virtual void RendererDraw(const CameraParams& camera_params) = 0;
 	//~ End RendererComponentBase interface
 
+	/// <summary>
+	/// 描画に使うワールド位置. 所有アクターの描画位置の補間を反映する
+	/// </summary>
+	Vector2D GetRenderWorldPosition() const;
+
 public:
 	/// <summary>
 	/// 表示状態を設定する
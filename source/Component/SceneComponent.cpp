@@ -4,7 +4,9 @@
 
 SceneComponent::SceneComponent()
 	: parent_scene_component(nullptr)
+	, local_rotation(0.f)
 	, inherit_parent_rotation(true)
+	, is_world_transform_dirty(true)
 {}
 
 SceneComponent::~SceneComponent()
@@ -24,15 +26,17 @@ void SceneComponent::Finalize()
 		}
 	}
 
-	__super::Finalize();
+	ComponentBase::Finalize();
 }
 
 
 void SceneComponent::OnThisWorldTransformChanged()
 {
-	if (HasChildSceneComponent())
+	is_world_transform_dirty = true;
+
+	for (auto& child : children_scene_component)
 	{
-		for (auto& child : children_scene_component)
+		if (!child->is_world_transform_dirty)
 		{
 			child->OnThisWorldTransformChanged();
 		}
@@ -41,14 +45,12 @@ void SceneComponent::OnThisWorldTransformChanged()
 
 Transform SceneComponent::GetWorldTransform() const
 {
-	if (!HasParentSceneComponent())
+	if (is_world_transform_dirty)
 	{
-		return Transform{ local_position, local_rotation };
+		UpdateWorldTransformCache();
 	}
 
-	const Vector2D world_position = GetWorldPosition();
-	const float world_rotation = GetWorldRotation();
-	return Transform{ world_position, world_rotation };
+	return cached_world_transform;
 }
 
 void SceneComponent::SetWorldTransform(const Vector2D& new_world_position, const float new_world_rotation)
@@ -72,12 +74,12 @@ void SceneComponent::SetLocalTransform(const Vector2D& new_local_position, const
 
 Vector2D SceneComponent::GetWorldPosition() const
 {
-	if (HasParentSceneComponent())
+	if (is_world_transform_dirty)
 	{
-		return parent_scene_component->GetWorldTransform().TransformLocation(local_position);
+		UpdateWorldTransformCache();
 	}
 
-	return local_position;
+	return cached_world_transform.position;
 }
 
 void SceneComponent::SetWorldPosition(const Vector2D& new_world_position)
@@ -103,6 +105,7 @@ void SceneComponent::AddWorldPosition(const Vector2D& delta_position)
 void SceneComponent::SetLocalPosition(const Vector2D& new_local_position)
 {
 	local_position = new_local_position;
+	OnThisWorldTransformChanged();
 }
 
 void SceneComponent::AddActorLocalPosition(const Vector2D& delta_position)
@@ -112,12 +115,12 @@ void SceneComponent::AddActorLocalPosition(const Vector2D& delta_position)
 
 float SceneComponent::GetWorldRotation() const
 {
-	if (HasParentSceneComponent() && inherit_parent_rotation)
+	if (is_world_transform_dirty)
 	{
-		return parent_scene_component->GetWorldRotation() + local_rotation;
+		UpdateWorldTransformCache();
 	}
 
-	return local_rotation;
+	return cached_world_transform.rotation;
 }
 
 void SceneComponent::SetWorldRotation(const float new_world_rotation)
@@ -146,6 +149,17 @@ void SceneComponent::AddRotation(const float delta_local_rotation)
 	SetLocalRotation(GetLocalRotation() + delta_local_rotation);
 }
 
+void SceneComponent::SetInheritParentRotation(const bool inherit)
+{
+	if (inherit_parent_rotation == inherit)
+	{
+		return;
+	}
+
+	inherit_parent_rotation = inherit;
+	OnThisWorldTransformChanged();
+}
+
 void SceneComponent::AttachToSceneComponent(SceneComponent* new_parent, const bool keep_world_transform)
 {
 	if (!GetScene()->IsValid(new_parent))
@@ -184,6 +198,9 @@ void SceneComponent::DetachFromParentSceneComponent()
 
 	parent_scene_component->RemoveChild(this);
 	parent_scene_component = nullptr;
+
+	// 親の変換が掛からなくなるので, ワールド座標が変わる
+	OnThisWorldTransformChanged();
 }
 
 void SceneComponent::NormalizeRotation()
@@ -199,6 +216,24 @@ void SceneComponent::NormalizeRotation()
 	local_rotation = normalized_local_rotation;
 }
 
+void SceneComponent::UpdateWorldTransformCache() const
+{
+	if (!HasParentSceneComponent())
+	{
+		cached_world_transform.position = local_position;
+		cached_world_transform.rotation = local_rotation;
+	}
+	else
+	{
+		// 親のキャッシュが無効なら, ここで親から順に計算し直される
+		const Transform parent_to_world = parent_scene_component->GetWorldTransform();
+		cached_world_transform.position = parent_to_world.TransformLocation(local_position);
+		cached_world_transform.rotation = inherit_parent_rotation ? parent_to_world.rotation + local_rotation : local_rotation;
+	}
+
+	is_world_transform_dirty = false;
+}
+
 void SceneComponent::AddChild(SceneComponent* child_to_add)
 {
 	std::vector<SceneComponent*>& children = children_scene_component;
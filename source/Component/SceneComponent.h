@@ -6,6 +6,7 @@
 /// <summary>
 /// 位置情報を持つコンポーネント
 /// <para>SceneComponent同士で親子付けできる</para>
+/// <para>ワールドトランスフォームはキャッシュし, ローカルトランスフォームか親のトランスフォームが変わったときに無効化する. 無効化後の最初の取得時に親のキャッシュから計算し直す</para>
 /// </summary>
 class SceneComponent : public ComponentBase
 {
@@ -20,6 +21,10 @@ public:
 
 	//~ Begin SceneComponent interface
 protected:
+	/// <summary>
+	/// ワールドトランスフォームが変わったときに呼ばれる. ワールドトランスフォームのキャッシュを無効化し, 子に伝える
+	/// <para>キャッシュが既に無効な子は, その子孫も含めて通知済みなので伝えない</para>
+	/// </summary>
 	virtual void OnThisWorldTransformChanged();
 	//~ End SceneComponent interface
 
@@ -42,7 +47,7 @@ public:
 	void SetLocalRotation(const float new_local_rotation);
 	void AddRotation(const float delta_local_rotation);
 	
-	void SetInheritParentRotation(const bool inherit) { inherit_parent_rotation = inherit; }
+	void SetInheritParentRotation(const bool inherit);
 
 	bool HasParentSceneComponent() const { return parent_scene_component; }
 	SceneComponent* GetParentSceneComponent() const { return parent_scene_component; }
@@ -64,6 +69,11 @@ private:
 	/// </summary>
 	void NormalizeRotation();
 
+	/// <summary>
+	/// 親のワールドトランスフォームとローカルトランスフォームから, ワールドトランスフォームのキャッシュを計算し直す
+	/// </summary>
+	void UpdateWorldTransformCache() const;
+
 	void AddChild(SceneComponent* child_to_add);
 	void RemoveChild(SceneComponent* child_to_remove);
 
@@ -81,4 +91,9 @@ private:
 	/// falseの場合, ワールド回転 = ローカル回転
 	/// </summary>
 	bool inherit_parent_rotation;
+
+	// ワールドトランスフォームのキャッシュ. is_world_transform_dirtyがtrueの間は古い値
+	// NOTE: キャッシュが無効なコンポーネントの子孫は全てキャッシュが無効になっている
+	mutable Transform cached_world_transform;
+	mutable bool is_world_transform_dirty;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core.h"
+#include "GameObjectHandle.h"
 #include <type_traits>
 
 /// <summary>
@@ -23,7 +24,15 @@ public:
 		return dynamic_cast<GameObjectDerived*>(this) != nullptr;
 	}
 
+	/// <summary>
+	/// GameObjectManagerが割り当てたハンドル. GameObjectManager以外で生成されたオブジェクトや, 破棄処理中のオブジェクトでは無効なハンドルを返す
+	/// </summary>
+	const GameObjectHandle& GetHandle() const { return _handle; }
+
 protected:
 	static bool IsValid(const GameObject* const game_object);
 
+private:
+	friend class GameObjectManager;
+	GameObjectHandle _handle;
 };
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// GameObjectManagerが生成したGameObjectを指すハンドル
+/// <para>スロット番号と世代番号の組で, オブジェクトが破棄されるとスロットの世代番号が進むため, 破棄済みのオブジェクトを指すハンドルは無効になる</para>
+/// <para>スロットが別のオブジェクトに再利用された後でも, 古いハンドルが新しいオブジェクトを指すことはない</para>
+/// </summary>
+struct GameObjectHandle
+{
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+	uint32_t index = INVALID_INDEX;
+
+	// 0は無効. 有効なスロットの世代番号は1から始まる
+	uint32_t generation = 0;
+
+	bool operator==(const GameObjectHandle& other) const { return index == other.index && generation == other.generation; }
+	bool operator!=(const GameObjectHandle& other) const { return !(*this == other); }
+};
@@ -0,0 +1,135 @@
+#include "ActorDrawOrder.h"
+#include "Actor/Actor.h"
+#include <algorithm>
+#include <cassert>
+
+void ActorDrawOrder::Add(Actor* const actor)
+{
+	assert(actor != nullptr);
+
+	ActorDrawOrderState& state = actor->_draw_order_state;
+	if (state.is_registered)
+	{
+		return;
+	}
+
+	const int priority = actor->GetDrawPriority();
+	Bucket& bucket = _buckets[priority];
+
+	// 末尾に追加しても順序が保たれる場合は並べ替えない
+	if (!bucket.actors.empty())
+	{
+		const Actor* const last_actor = bucket.actors.back();
+		if (last_actor == nullptr || IsDrawnBefore(actor, last_actor))
+		{
+			bucket.needs_sort = true;
+		}
+	}
+
+	state.priority = priority;
+	state.index_in_bucket = static_cast<uint32_t>(bucket.actors.size());
+	state.is_registered = true;
+	bucket.actors.push_back(actor);
+}
+
+void ActorDrawOrder::Remove(Actor* const actor)
+{
+	ActorDrawOrderState& state = actor->_draw_order_state;
+	if (!state.is_registered)
+	{
+		return;
+	}
+
+	auto it = _buckets.find(state.priority);
+	assert(it != _buckets.end());
+
+	// 他のアクターの順序を崩さないように, 空きにしておいてPrepare()で詰める
+	Bucket& bucket = it->second;
+	assert(state.index_in_bucket < bucket.actors.size() && bucket.actors[state.index_in_bucket] == actor);
+	bucket.actors[state.index_in_bucket] = nullptr;
+	bucket.num_removed++;
+
+	state.is_registered = false;
+}
+
+void ActorDrawOrder::OnDrawPriorityChanged(Actor* const actor)
+{
+	const ActorDrawOrderState& state = actor->_draw_order_state;
+	if (!state.is_registered || state.priority == actor->GetDrawPriority())
+	{
+		return;
+	}
+
+	Remove(actor);
+	Add(actor);
+}
+
+void ActorDrawOrder::Clear()
+{
+	for (auto& priority_bucket_pair : _buckets)
+	{
+		for (Actor* actor : priority_bucket_pair.second.actors)
+		{
+			if (actor)
+			{
+				actor->_draw_order_state = ActorDrawOrderState();
+			}
+		}
+	}
+	_buckets.clear();
+}
+
+void ActorDrawOrder::Prepare()
+{
+	for (auto it = _buckets.begin(); it != _buckets.end();)
+	{
+		Bucket& bucket = it->second;
+		if (bucket.num_removed == static_cast<int>(bucket.actors.size()))
+		{
+			// 空になったバケットは削除する
+			it = _buckets.erase(it);
+			continue;
+		}
+
+		if (bucket.num_removed > 0 || bucket.needs_sort)
+		{
+			RebuildBucket(bucket);
+		}
+		++it;
+	}
+}
+
+void ActorDrawOrder::SortAllBuckets()
+{
+	for (auto& priority_bucket_pair : _buckets)
+	{
+		priority_bucket_pair.second.needs_sort = true;
+	}
+	Prepare();
+}
+
+bool ActorDrawOrder::IsDrawnBefore(const Actor* const actor_a, const Actor* const actor_b)
+{
+	// 画面下の方から描画する
+	return actor_a->GetActorWorldPosition().y > actor_b->GetActorWorldPosition().y;
+}
+
+void ActorDrawOrder::RebuildBucket(Bucket& bucket)
+{
+	if (bucket.num_removed > 0)
+	{
+		bucket.actors.erase(std::remove(bucket.actors.begin(), bucket.actors.end(), nullptr), bucket.actors.end());
+		bucket.num_removed = 0;
+	}
+
+	if (bucket.needs_sort)
+	{
+		std::stable_sort(bucket.actors.begin(), bucket.actors.end(), IsDrawnBefore);
+		bucket.needs_sort = false;
+	}
+
+	for (size_t i = 0; i < bucket.actors.size(); i++)
+	{
+		bucket.actors[i]->_draw_order_state.index_in_bucket = static_cast<uint32_t>(i);
+	}
+}
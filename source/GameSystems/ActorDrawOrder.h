@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include <map>
+#include <cstdint>
+
+class Actor;
+
+/// <summary>
+/// ActorDrawOrderがアクターごとに持つ状態. アクターが保持し, ActorDrawOrderだけが書き換える
+/// </summary>
+struct ActorDrawOrderState
+{
+	// 登録されているバケットの描画優先度. Actor::GetDrawPriority()が変わっても, バケットを移動するまでは古い値のまま
+	int priority = 0;
+	uint32_t index_in_bucket = 0;
+	bool is_registered = false;
+};
+
+/// <summary>
+/// シーン内のアクターの描画順を, 描画優先度ごとのバケットで管理するクラス
+/// <para>描画優先度が小さいバケットから順に描画する. バケット内では画面下(Y座標が大きい)のアクターから描画する</para>
+/// <para>追加はバケットの末尾に, 削除は空き(nullptr)にするだけで, 並べ替えと詰め直しは描画前のPrepare()で変更があったバケットだけ行う</para>
+/// </summary>
+class ActorDrawOrder
+{
+public:
+	ActorDrawOrder() {}
+
+	ActorDrawOrder(const ActorDrawOrder&) = delete;
+	ActorDrawOrder& operator=(const ActorDrawOrder&) = delete;
+
+	/// <summary>
+	/// Actor::GetDrawPriority()のバケットに追加する. 登録済みの場合は何もしない
+	/// </summary>
+	void Add(Actor* const actor);
+
+	/// <summary>
+	/// 登録を解除する. 未登録の場合は何もしない
+	/// </summary>
+	void Remove(Actor* const actor);
+
+	/// <summary>
+	/// アクターの描画優先度が変わったときに呼ばれ, バケットを移動させる
+	/// </summary>
+	void OnDrawPriorityChanged(Actor* const actor);
+
+	/// <summary>
+	/// 全アクターの登録を解除する
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// 変更があったバケットの空きを詰め, 必要なら並べ替える. 描画の前に呼ぶ
+	/// </summary>
+	void Prepare();
+
+	/// <summary>
+	/// 全バケットを現在のY座標で並べ替える
+	/// </summary>
+	void SortAllBuckets();
+
+	/// <summary>
+	/// 描画順に全アクターについてcallbackを呼ぶ
+	/// </summary>
+	/// <param name="callback">bool(Actor* actor). falseを返すと打ち切る</param>
+	template<typename Callback>
+	void ForEach(Callback&& callback) const
+	{
+		for (const auto& priority_bucket_pair : _buckets)
+		{
+			for (Actor* actor : priority_bucket_pair.second.actors)
+			{
+				if (actor && !callback(actor))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	int GetNumBuckets() const { return static_cast<int>(_buckets.size()); }
+
+private:
+	struct Bucket
+	{
+		// 削除されたアクターの位置はnullptr
+		std::vector<Actor*> actors;
+		int num_removed = 0;
+		bool needs_sort = false;
+	};
+
+	/// <summary>
+	/// 同じ描画優先度のバケット内で, actor_aをactor_bより先に描画するか
+	/// </summary>
+	static bool IsDrawnBefore(const Actor* const actor_a, const Actor* const actor_b);
+
+	/// <summary>
+	/// 空きを詰めて, 必要なら並べ替え, index_in_bucketを振り直す
+	/// </summary>
+	static void RebuildBucket(Bucket& bucket);
+
+	std::map<int, Bucket> _buckets;
+};
@@ -0,0 +1,465 @@
+#include "ActorTickScheduler.h"
+#include "Actor/Actor.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+	// カメラの描画範囲からこの距離以上離れたアクターの更新頻度を下げる
+	constexpr float DEFAULT_RATE_REDUCTION_DISTANCE = UNIT_TILE_SIZE * 8.f;
+
+	// 1ステップあたりこれより大きく移動したアクターはワープしたとみなし, 描画位置を補間しない
+	constexpr float MAX_INTERPOLATED_STEP_DISTANCE = UNIT_TILE_SIZE * 2.f;
+}
+
+ActorTickScheduler::ActorTickScheduler()
+	: _num_sleeping(0)
+	, _num_disabled(0)
+	, _is_ticking(false)
+	, _frame_count(0)
+	, _world_time(0.f)
+	, _rate_reduction_distance(DEFAULT_RATE_REDUCTION_DISTANCE)
+	, _num_ticked_last_frame(0)
+	, _num_woken_last_frame(0)
+{
+}
+
+void ActorTickScheduler::RegisterActor(Actor* const actor)
+{
+	assert(actor != nullptr);
+	assert(!_is_ticking);
+
+	ActorTickState& state = actor->_tick_state;
+	if (state.bucket != ActorTickState::EBucket::Unregistered)
+	{
+		return;
+	}
+
+	state.is_far_from_camera = false;
+	state.is_wake_requested = false;
+	state.is_bucket_dirty = false;
+	RefreshBucket(actor);
+}
+
+void ActorTickScheduler::UnregisterActor(Actor* const actor)
+{
+	assert(actor != nullptr);
+	assert(!_is_ticking);
+
+	ActorTickState& state = actor->_tick_state;
+	if (state.bucket == ActorTickState::EBucket::Unregistered)
+	{
+		return;
+	}
+
+	RemoveFromBucket(actor);
+
+	// 起こす予定のリストと状態変更のリストからも取り除く. どちらも小さいので線形探索でよい
+	if (state.is_wake_requested)
+	{
+		_woken_actors.erase(std::remove(_woken_actors.begin(), _woken_actors.end(), actor), _woken_actors.end());
+		state.is_wake_requested = false;
+	}
+	if (state.is_bucket_dirty)
+	{
+		_dirty_actors.erase(std::remove(_dirty_actors.begin(), _dirty_actors.end(), actor), _dirty_actors.end());
+		state.is_bucket_dirty = false;
+	}
+}
+
+void ActorTickScheduler::Clear()
+{
+	assert(!_is_ticking);
+
+	auto reset_state = [](Actor* const actor)
+		{
+			actor->_tick_state.bucket = ActorTickState::EBucket::Unregistered;
+			actor->_tick_state.is_wake_requested = false;
+			actor->_tick_state.is_bucket_dirty = false;
+		};
+
+	// NOTE: Sleepと更新無効のアクターは配列に入っていないので, アクター側の状態は戻せない. 呼び出し側でアクターを破棄する前提
+	for (Actor* actor : _every_frame_actors) { reset_state(actor); }
+	for (auto& phase_actors : _reduced_actors)
+	{
+		for (Actor* actor : phase_actors) { reset_state(actor); }
+		phase_actors.clear();
+	}
+	_every_frame_actors.clear();
+	_woken_actors.clear();
+	_dirty_actors.clear();
+	_num_sleeping = 0;
+	_num_disabled = 0;
+	_num_ticked_last_frame = 0;
+	_num_woken_last_frame = 0;
+}
+
+void ActorTickScheduler::OnActorTickStateChanged(Actor* const actor)
+{
+	ActorTickState& state = actor->_tick_state;
+	if (state.bucket == ActorTickState::EBucket::Unregistered)
+	{
+		return;
+	}
+
+	if (_is_ticking)
+	{
+		if (!state.is_bucket_dirty)
+		{
+			state.is_bucket_dirty = true;
+			_dirty_actors.push_back(actor);
+		}
+		return;
+	}
+
+	RefreshBucket(actor);
+}
+
+void ActorTickScheduler::RequestWake(Actor* const actor)
+{
+	ActorTickState& state = actor->_tick_state;
+	if (state.bucket != ActorTickState::EBucket::Sleeping || state.is_wake_requested)
+	{
+		return;
+	}
+
+	state.is_wake_requested = true;
+	_woken_actors.push_back(actor);
+}
+
+void ActorTickScheduler::TickActors(const float delta_seconds, const float world_time, const FCircle& camera_area)
+{
+	_is_ticking = true;
+	_world_time = world_time;
+	_camera_area = camera_area;
+	_num_ticked_last_frame = 0;
+	_num_woken_last_frame = 0;
+
+	// 1. 前のフレームで起こされたアクター
+	// NOTE: 更新中に起こされたアクターは次のフレームで更新するので, 先にリストを入れ替えておく
+	if (!_woken_actors.empty())
+	{
+		std::vector<Actor*> woken_actors;
+		woken_actors.swap(_woken_actors);
+
+		for (Actor* actor : woken_actors)
+		{
+			ActorTickState& state = actor->_tick_state;
+			state.is_wake_requested = false;
+			if (state.bucket == ActorTickState::EBucket::Sleeping && actor->ShouldCallTickActor() && !actor->IsHidden())
+			{
+				state.last_tick_world_time = world_time;
+				TickActor(actor, delta_seconds);
+				_num_woken_last_frame++;
+			}
+		}
+	}
+
+	// 2. 毎フレーム更新するアクター
+	// NOTE: 更新中にShouldCallTickActor()がfalseになったアクターは, バケットの移動を待たずにここで飛ばす
+	for (Actor* actor : _every_frame_actors)
+	{
+		if (actor->ShouldCallTickActor() && !actor->IsHidden())
+		{
+			actor->_tick_state.last_tick_world_time = world_time;
+			TickActor(actor, delta_seconds);
+			_num_ticked_last_frame++;
+		}
+	}
+
+	// 3. 更新頻度を下げたアクターのうち, 今回のグループ
+	for (Actor* actor : _reduced_actors[_frame_count % REDUCED_TICK_INTERVAL])
+	{
+		ActorTickState& state = actor->_tick_state;
+		const float accumulated_seconds = world_time - state.last_tick_world_time;
+
+		// 非表示の間の経過時間は, 毎フレーム更新の場合と同じく捨てる
+		state.last_tick_world_time = world_time;
+		if (actor->ShouldCallTickActor() && !actor->IsHidden())
+		{
+			TickActor(actor, accumulated_seconds);
+			_num_ticked_last_frame++;
+		}
+		else
+		{
+			state.last_tick_seconds = 0.f;
+		}
+	}
+
+	_is_ticking = false;
+	ApplyDirtyActors();
+
+	if (_frame_count % CAMERA_DISTANCE_CHECK_INTERVAL == 0)
+	{
+		UpdateCameraDistances(camera_area);
+	}
+
+	_frame_count++;
+}
+
+void ActorTickScheduler::GetStats(TickStats& out_stats) const
+{
+	out_stats.num_every_frame = static_cast<int>(_every_frame_actors.size());
+	out_stats.num_reduced = 0;
+	for (const auto& phase_actors : _reduced_actors)
+	{
+		out_stats.num_reduced += static_cast<int>(phase_actors.size());
+	}
+	out_stats.num_sleeping = _num_sleeping;
+	out_stats.num_disabled = _num_disabled;
+	out_stats.num_ticked = _num_ticked_last_frame;
+	out_stats.num_woken = _num_woken_last_frame;
+}
+
+void ActorTickScheduler::UpdateRenderInterpolation(const float render_world_time, const float step_seconds)
+{
+	auto interpolate = [render_world_time, step_seconds](Actor* const actor)
+		{
+			const ActorTickState& state = actor->_tick_state;
+			if (state.last_tick_seconds <= 0.f)
+			{
+				actor->_render_interpolation_offset = Vector2D();
+				return;
+			}
+
+			const Vector2D tick_delta = actor->GetActorWorldPosition() - state.position_before_last_tick;
+			const float max_distance = MAX_INTERPOLATED_STEP_DISTANCE * (state.last_tick_seconds / step_seconds);
+			if (tick_delta.LengthSquared() > max_distance * max_distance)
+			{
+				actor->_render_interpolation_offset = Vector2D();
+				return;
+			}
+
+			// 最後の更新の区間を, 更新の間隔から1ステップを引いた分だけ遅らせて表示する. 毎フレーム更新するアクターでは遅れは無く, 割合は補間の係数と同じになる
+			// 描画位置 = 更新前の位置 * (1 - ratio) + 現在位置 * ratio
+			const float ratio = (std::clamp)((render_world_time - state.last_tick_world_time + step_seconds) / state.last_tick_seconds, 0.f, 1.f);
+			actor->_render_interpolation_offset = tick_delta * (ratio - 1.f);
+		};
+
+	for (Actor* actor : _every_frame_actors)
+	{
+		interpolate(actor);
+	}
+	for (const auto& phase_actors : _reduced_actors)
+	{
+		for (Actor* actor : phase_actors)
+		{
+			interpolate(actor);
+		}
+	}
+}
+
+void ActorTickScheduler::ClearRenderInterpolation()
+{
+	for (Actor* actor : _every_frame_actors)
+	{
+		actor->_render_interpolation_offset = Vector2D();
+	}
+	for (const auto& phase_actors : _reduced_actors)
+	{
+		for (Actor* actor : phase_actors)
+		{
+			actor->_render_interpolation_offset = Vector2D();
+		}
+	}
+}
+
+ActorTickState::EBucket ActorTickScheduler::GetDesiredBucket(const Actor* const actor)
+{
+	const ActorTickState& state = actor->_tick_state;
+
+	if (!actor->ShouldCallTickActor())
+	{
+		return ActorTickState::EBucket::Disabled;
+	}
+
+	switch (state.rate)
+	{
+	case EActorTickRate::Sleep:
+		return ActorTickState::EBucket::Sleeping;
+	case EActorTickRate::Reduced:
+		return ActorTickState::EBucket::Reduced;
+	case EActorTickRate::EveryFrame:
+	default:
+		return (state.is_rate_reduction_allowed && state.is_far_from_camera)
+			? ActorTickState::EBucket::Reduced
+			: ActorTickState::EBucket::EveryFrame;
+	}
+}
+
+void ActorTickScheduler::MoveToBucket(Actor* const actor, const ActorTickState::EBucket desired_bucket)
+{
+	assert(!_is_ticking);
+	assert(desired_bucket != ActorTickState::EBucket::Unregistered);
+
+	ActorTickState& state = actor->_tick_state;
+	const bool was_active = state.bucket == ActorTickState::EBucket::EveryFrame || state.bucket == ActorTickState::EBucket::Reduced;
+	RemoveFromBucket(actor);
+
+	switch (desired_bucket)
+	{
+	case ActorTickState::EBucket::Disabled:
+		_num_disabled++;
+		break;
+
+	case ActorTickState::EBucket::Sleeping:
+		_num_sleeping++;
+		break;
+
+	case ActorTickState::EBucket::EveryFrame:
+		state.index_in_bucket = static_cast<uint32_t>(_every_frame_actors.size());
+		_every_frame_actors.push_back(actor);
+		break;
+
+	case ActorTickState::EBucket::Reduced:
+	{
+		// 1フレームあたりの更新数が均等になるように, 一番少ないグループに入れる
+		size_t phase = 0;
+		for (size_t i = 1; i < _reduced_actors.size(); i++)
+		{
+			if (_reduced_actors[i].size() < _reduced_actors[phase].size())
+			{
+				phase = i;
+			}
+		}
+		state.reduced_phase = static_cast<uint8_t>(phase);
+		state.index_in_bucket = static_cast<uint32_t>(_reduced_actors[phase].size());
+		_reduced_actors[phase].push_back(actor);
+		break;
+	}
+
+	default:
+		break;
+	}
+
+	// 更新されていなかった間の時間をReducedの経過時間に含めない. 次に更新されるまで描画位置は補間しない
+	if (!was_active)
+	{
+		state.last_tick_world_time = _world_time;
+		state.last_tick_seconds = 0.f;
+	}
+
+	// 補間の対象から外れるので, 描画位置のずれを戻しておく
+	const bool is_active = desired_bucket == ActorTickState::EBucket::EveryFrame || desired_bucket == ActorTickState::EBucket::Reduced;
+	if (!is_active)
+	{
+		actor->_render_interpolation_offset = Vector2D();
+	}
+	state.bucket = desired_bucket;
+}
+
+void ActorTickScheduler::RemoveFromBucket(Actor* const actor)
+{
+	ActorTickState& state = actor->_tick_state;
+
+	// 末尾の要素を空いた位置に移して取り除く
+	auto swap_remove = [actor, &state](std::vector<Actor*>& actors)
+		{
+			assert(state.index_in_bucket < actors.size() && actors[state.index_in_bucket] == actor);
+			Actor* const last_actor = actors.back();
+			actors[state.index_in_bucket] = last_actor;
+			last_actor->_tick_state.index_in_bucket = state.index_in_bucket;
+			actors.pop_back();
+		};
+
+	switch (state.bucket)
+	{
+	case ActorTickState::EBucket::Disabled:
+		_num_disabled--;
+		break;
+	case ActorTickState::EBucket::Sleeping:
+		_num_sleeping--;
+		break;
+	case ActorTickState::EBucket::EveryFrame:
+		swap_remove(_every_frame_actors);
+		break;
+	case ActorTickState::EBucket::Reduced:
+		swap_remove(_reduced_actors[state.reduced_phase]);
+		break;
+	default:
+		break;
+	}
+
+	state.bucket = ActorTickState::EBucket::Unregistered;
+}
+
+bool ActorTickScheduler::IsFarFromCamera(const Actor* const actor, const FCircle& camera_area) const
+{
+	const FCircle bounding_circle = actor->GetBoundingCircle();
+	const float threshold = actor->_tick_state.is_far_from_camera ? _rate_reduction_distance * 0.5f : _rate_reduction_distance;
+	const float max_distance = camera_area.radius + bounding_circle.radius + threshold;
+	return (bounding_circle.center - camera_area.center).LengthSquared() > max_distance * max_distance;
+}
+
+void ActorTickScheduler::UpdateCameraDistances(const FCircle& camera_area)
+{
+	// 判定しながら配列を書き換えないように, 移動させるアクターを先に集める
+	std::vector<Actor*> changed_actors;
+
+	auto check_actors = [this, &camera_area, &changed_actors](const std::vector<Actor*>& actors)
+		{
+			for (Actor* actor : actors)
+			{
+				ActorTickState& state = actor->_tick_state;
+				if (state.rate != EActorTickRate::EveryFrame || !state.is_rate_reduction_allowed)
+				{
+					continue;
+				}
+
+				const bool is_far = IsFarFromCamera(actor, camera_area);
+				if (is_far != state.is_far_from_camera)
+				{
+					state.is_far_from_camera = is_far;
+					changed_actors.push_back(actor);
+				}
+			}
+		};
+
+	check_actors(_every_frame_actors);
+	for (const auto& phase_actors : _reduced_actors)
+	{
+		check_actors(phase_actors);
+	}
+
+	for (Actor* actor : changed_actors)
+	{
+		MoveToBucket(actor, GetDesiredBucket(actor));
+	}
+}
+
+void ActorTickScheduler::RefreshBucket(Actor* const actor)
+{
+	ActorTickState& state = actor->_tick_state;
+	const bool is_active = state.bucket == ActorTickState::EBucket::EveryFrame || state.bucket == ActorTickState::EBucket::Reduced;
+
+	// 更新されていなかったアクターは, カメラからの距離を調べ直してからバケットに入れる
+	// NOTE: 最初のTickActors()の前はカメラ位置が分からないので, 次の定期的な判定に任せる
+	if (!is_active && _frame_count > 0 && state.rate == EActorTickRate::EveryFrame && state.is_rate_reduction_allowed)
+	{
+		state.is_far_from_camera = IsFarFromCamera(actor, _camera_area);
+	}
+
+	const ActorTickState::EBucket desired_bucket = GetDesiredBucket(actor);
+	if (desired_bucket != state.bucket)
+	{
+		MoveToBucket(actor, desired_bucket);
+	}
+}
+
+void ActorTickScheduler::ApplyDirtyActors()
+{
+	for (Actor* actor : _dirty_actors)
+	{
+		actor->_tick_state.is_bucket_dirty = false;
+		RefreshBucket(actor);
+	}
+	_dirty_actors.clear();
+}
+
+void ActorTickScheduler::TickActor(Actor* const actor, const float delta_seconds)
+{
+	ActorTickState& state = actor->_tick_state;
+	state.position_before_last_tick = actor->GetActorWorldPosition();
+	state.last_tick_seconds = delta_seconds;
+	actor->TickActor(delta_seconds);
+}
@@ -0,0 +1,206 @@
+#pragma once
+#include "Utility/Core/MathCore.h"
+#include <vector>
+#include <array>
+#include <cstdint>
+
+class Actor;
+
+/// <summary>
+/// アクターの更新頻度
+/// </summary>
+enum class EActorTickRate : uint8_t
+{
+	// 毎フレーム更新する. Actor::SetTickRateReductionAllowed(true)にした場合は, カメラから遠いときにReducedに自動で下げる
+	EveryFrame,
+
+	// ActorTickScheduler::REDUCED_TICK_INTERVALフレームに1回, その間の経過時間をまとめて更新する
+	Reduced,
+
+	// 更新しない. 衝突やダメージでActor::WakeTick()されると, 次のフレームに1回だけ更新する
+	Sleep,
+};
+
+/// <summary>
+/// ActorTickSchedulerがアクターごとに持つ状態. アクターが保持し, スケジューラーだけが書き換える
+/// </summary>
+struct ActorTickState
+{
+	enum class EBucket : uint8_t
+	{
+		Unregistered,
+		Disabled,	// Actor::ShouldCallTickActor()がfalse
+		Sleeping,
+		EveryFrame,
+		Reduced,
+	};
+
+	EActorTickRate rate = EActorTickRate::EveryFrame;
+	bool is_rate_reduction_allowed = false;
+
+	EBucket bucket = EBucket::Unregistered;
+	uint8_t reduced_phase = 0;
+	uint32_t index_in_bucket = 0;
+
+	// カメラから離れていてReducedに下げられているか
+	bool is_far_from_camera = false;
+
+	bool is_wake_requested = false;
+	bool is_bucket_dirty = false;
+
+	// 最後に更新したワールド時間. Reducedで更新するときの経過時間に使う
+	float last_tick_world_time = 0.f;
+
+	// 最後の更新を始める前の位置と, その更新で進めた時間. 描画の補間に使う. 時間が0の場合は補間しない
+	Vector2D position_before_last_tick;
+	float last_tick_seconds = 0.f;
+};
+
+/// <summary>
+/// シーン内のアクターを更新頻度ごとのバケットに分けて, TickActor()を呼び出すクラス
+/// <para>毎フレーム全アクターのフラグを調べる代わりに, 更新頻度やShouldCallTickActor()が変わったときだけバケットを移動させる</para>
+/// <para>Sleepのアクター(ブロックなど)と更新が無効なアクターは, どのバケットの配列にも入らないので毎フレームのコストがかからない</para>
+/// </summary>
+class ActorTickScheduler
+{
+public:
+	/// <summary>
+	/// 各バケットのアクター数と, 直近のTickActors()で更新したアクター数
+	/// </summary>
+	struct TickStats
+	{
+		int num_every_frame;
+		int num_reduced;
+		int num_sleeping;
+		int num_disabled;
+		int num_ticked;
+		int num_woken;
+	};
+
+	// Reducedのアクターを更新する間隔 [フレーム]. アクターをこの数のグループに分け, 1フレームに1グループずつ更新する
+	static constexpr int REDUCED_TICK_INTERVAL = 4;
+
+	// カメラからの距離を調べ直す間隔 [フレーム]
+	static constexpr int CAMERA_DISTANCE_CHECK_INTERVAL = 8;
+
+	ActorTickScheduler();
+
+	ActorTickScheduler(const ActorTickScheduler&) = delete;
+	ActorTickScheduler& operator=(const ActorTickScheduler&) = delete;
+
+	/// <summary>
+	/// シーンに追加されたアクターを登録する
+	/// </summary>
+	void RegisterActor(Actor* const actor);
+
+	/// <summary>
+	/// シーンから除外, もしくは破棄されるアクターの登録を解除する. 未登録の場合は何もしない
+	/// </summary>
+	void UnregisterActor(Actor* const actor);
+
+	/// <summary>
+	/// 全アクターの登録を解除する
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// アクターの更新頻度やShouldCallTickActor()が変わったときに呼ばれ, バケットを移動させる
+	/// <para>TickActors()の実行中はバケットの配列を変更できないので, 移動はTickActors()の最後に行う</para>
+	/// </summary>
+	void OnActorTickStateChanged(Actor* const actor);
+
+	/// <summary>
+	/// Sleepのアクターを次のTickActors()で1回だけ更新する. Sleep以外のアクターの場合は何もしない
+	/// </summary>
+	void RequestWake(Actor* const actor);
+
+	/// <summary>
+	/// 1フレーム分の更新. 起こされたアクター, EveryFrameのアクター, Reducedのアクターのうち今回のグループの順に更新する
+	/// </summary>
+	/// <param name="delta_seconds">前フレームからの経過時間</param>
+	/// <param name="world_time">このフレームの更新後のワールド時間</param>
+	/// <param name="camera_area">カメラの描画範囲. ここからrate_reduction_distanceより離れたアクターの更新頻度を下げる</param>
+	void TickActors(const float delta_seconds, const float world_time, const FCircle& camera_area);
+
+	void GetStats(TickStats& out_stats) const;
+
+	/// <summary>
+	/// 更新しているアクター(EveryFrameとReduced)の描画位置のずれを, それぞれの最後の更新の前後の位置から求める
+	/// <para>Reducedのアクターは更新の間隔の分だけ遅らせて表示し, 更新しないフレームでも止まって見えないようにする</para>
+	/// <para>それ以外のアクターはバケットを移動したときにずれを0に戻しているので, ここでは走査しない</para>
+	/// </summary>
+	/// <param name="render_world_time">描画するワールド時間. 最後のステップの終了時刻から, 持ち越した時間を引いたもの</param>
+	/// <param name="step_seconds">固定ステップの時間</param>
+	void UpdateRenderInterpolation(const float render_world_time, const float step_seconds);
+
+	/// <summary>
+	/// 更新しているアクターの描画位置のずれを0にする. 固定ステップで更新していない場合に使う
+	/// </summary>
+	void ClearRenderInterpolation();
+
+	/// <summary>
+	/// カメラの描画範囲からの距離がこれを超えたアクターの更新頻度を下げる. 半分より近づいたら元に戻す
+	/// <para>対象はActor::SetTickRateReductionAllowed(true)にしたアクターだけ</para>
+	/// </summary>
+	void SetRateReductionDistance(const float new_distance) { _rate_reduction_distance = new_distance; }
+	float GetRateReductionDistance() const { return _rate_reduction_distance; }
+
+private:
+	/// <summary>
+	/// アクターの状態から入るべきバケットを決める
+	/// </summary>
+	static ActorTickState::EBucket GetDesiredBucket(const Actor* const actor);
+
+	/// <summary>
+	/// アクターを今のバケットから取り除き, desired_bucketに入れる
+	/// </summary>
+	void MoveToBucket(Actor* const actor, const ActorTickState::EBucket desired_bucket);
+
+	void RemoveFromBucket(Actor* const actor);
+
+	/// <summary>
+	/// アクターの状態に合わせてバケットを移動させる. TickActors()の実行中は呼ばない
+	/// </summary>
+	void RefreshBucket(Actor* const actor);
+
+	/// <summary>
+	/// カメラの描画範囲から離れているか. 今の状態によって閾値を変え, 境界付近で頻繁に切り替わらないようにする
+	/// </summary>
+	bool IsFarFromCamera(const Actor* const actor, const FCircle& camera_area) const;
+
+	/// <summary>
+	/// EveryFrameとReducedのアクターについて, カメラからの距離を調べ直してバケットを移動させる
+	/// </summary>
+	void UpdateCameraDistances(const FCircle& camera_area);
+
+	/// <summary>
+	/// TickActors()の実行中に状態が変わったアクターのバケットを移動させる
+	/// </summary>
+	void ApplyDirtyActors();
+
+	/// <summary>
+	/// アクターのTickActor()を呼び, 描画の補間に使う更新前の位置と経過時間を記録する
+	/// </summary>
+	static void TickActor(Actor* const actor, const float delta_seconds);
+
+	std::vector<Actor*> _every_frame_actors;
+	std::array<std::vector<Actor*>, REDUCED_TICK_INTERVAL> _reduced_actors;
+
+	// 次のTickActors()で更新する, 起こされたSleepのアクター
+	std::vector<Actor*> _woken_actors;
+
+	// TickActors()の実行中に状態が変わったアクター
+	std::vector<Actor*> _dirty_actors;
+
+	int _num_sleeping;
+	int _num_disabled;
+
+	bool _is_ticking;
+	uint64_t _frame_count;
+	float _world_time;
+	FCircle _camera_area;
+	float _rate_reduction_distance;
+
+	int _num_ticked_last_frame;
+	int _num_woken_last_frame;
+};
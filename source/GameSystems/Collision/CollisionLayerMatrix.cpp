@@ -0,0 +1,149 @@
+#include "CollisionLayerMatrix.h"
+#include <stdexcept>
+
+namespace
+{
+	// レイヤー行列が扱うビット
+	constexpr CollisionObjectType_UnderlyingType LAYER_BITS = (1u << CollisionLayerMatrix::NUM_LAYERS) - 1u;
+}
+
+CollisionLayerMatrix::CollisionLayerMatrix()
+{
+	SetAllLayersCollide(true);
+}
+
+void CollisionLayerMatrix::SetLayersCollide(const CollisionObjectType layer_a, const CollisionObjectType layer_b, const bool should_collide)
+{
+	const int index_a = GetLayerIndex(layer_a);
+	const int index_b = GetLayerIndex(layer_b);
+
+	if (should_collide)
+	{
+		_layer_masks[index_a] |= (1u << index_b);
+		_layer_masks[index_b] |= (1u << index_a);
+	}
+	else
+	{
+		_layer_masks[index_a] &= ~(1u << index_b);
+		_layer_masks[index_b] &= ~(1u << index_a);
+	}
+
+	UpdateBucketMasks();
+}
+
+void CollisionLayerMatrix::SetLayerCollidesWith(const CollisionObjectType layer, const std::initializer_list<CollisionObjectType> targets)
+{
+	for (const CollisionObjectType target : targets)
+	{
+		SetLayersCollide(layer, target, true);
+	}
+}
+
+void CollisionLayerMatrix::SetAllLayersCollide(const bool should_collide)
+{
+	_layer_masks.fill(should_collide ? LAYER_BITS : 0u);
+	UpdateBucketMasks();
+}
+
+bool CollisionLayerMatrix::AllowHitTargets(const CollisionObjectType_UnderlyingType object_type, const CollisionObjectType_UnderlyingType hit_object_types)
+{
+	const CollisionObjectType_UnderlyingType layers = object_type & LAYER_BITS;
+	const CollisionObjectType_UnderlyingType target_layers = hit_object_types & LAYER_BITS;
+
+	bool is_changed = false;
+	for (int layer_index = 0; layer_index < NUM_LAYERS; ++layer_index)
+	{
+		const CollisionObjectType_UnderlyingType layer_bit = 1u << layer_index;
+
+		// 行列を対称に保つため, 衝突する側と衝突される側の両方に設定する
+		CollisionObjectType_UnderlyingType new_mask = _layer_masks[layer_index];
+		if ((layers & layer_bit) != 0)
+		{
+			new_mask |= target_layers;
+		}
+		if ((target_layers & layer_bit) != 0)
+		{
+			new_mask |= layers;
+		}
+
+		if (new_mask != _layer_masks[layer_index])
+		{
+			_layer_masks[layer_index] = new_mask;
+			is_changed = true;
+		}
+	}
+
+	if (is_changed)
+	{
+		UpdateBucketMasks();
+	}
+	return is_changed;
+}
+
+bool CollisionLayerMatrix::ShouldCollide(const CollisionObjectType_UnderlyingType object_type_a, const CollisionObjectType_UnderlyingType object_type_b) const
+{
+	CollisionObjectType_UnderlyingType layers_a = object_type_a & LAYER_BITS;
+	while (layers_a != 0)
+	{
+		// 最下位のビットから順に調べる
+		int layer_index = 0;
+		while ((layers_a & (1u << layer_index)) == 0)
+		{
+			++layer_index;
+		}
+		if ((_layer_masks[layer_index] & object_type_b) != 0)
+		{
+			return true;
+		}
+		layers_a &= ~(1u << layer_index);
+	}
+	return false;
+}
+
+int CollisionLayerMatrix::GetBucketIndex(const CollisionObjectType object_type)
+{
+	const CollisionObjectType_UnderlyingType bits = static_cast<CollisionObjectType_UnderlyingType>(object_type);
+	const bool is_single_layer = (bits != 0) && ((bits & (bits - 1)) == 0) && ((bits & LAYER_BITS) != 0);
+	if (!is_single_layer)
+	{
+		return MIXED_BUCKET;
+	}
+	return GetLayerIndex(object_type);
+}
+
+CollisionObjectType_UnderlyingType CollisionLayerMatrix::GetBucketObjectTypes(const int bucket_index)
+{
+	if (bucket_index == MIXED_BUCKET)
+	{
+		return static_cast<CollisionObjectType_UnderlyingType>(CollisionObjectType::WILDCARD);
+	}
+	return 1u << bucket_index;
+}
+
+void CollisionLayerMatrix::UpdateBucketMasks()
+{
+	for (int bucket_a = 0; bucket_a < NUM_BUCKETS; ++bucket_a)
+	{
+		_bucket_masks[bucket_a] = 0;
+		for (int bucket_b = 0; bucket_b < NUM_BUCKETS; ++bucket_b)
+		{
+			if (ShouldCollide(GetBucketObjectTypes(bucket_a), GetBucketObjectTypes(bucket_b)))
+			{
+				_bucket_masks[bucket_a] |= (1u << bucket_b);
+			}
+		}
+	}
+}
+
+int CollisionLayerMatrix::GetLayerIndex(const CollisionObjectType layer)
+{
+	const CollisionObjectType_UnderlyingType bits = static_cast<CollisionObjectType_UnderlyingType>(layer);
+	for (int layer_index = 0; layer_index < NUM_LAYERS; ++layer_index)
+	{
+		if (bits == (1u << layer_index))
+		{
+			return layer_index;
+		}
+	}
+	throw std::runtime_error("CollisionObjectType is not a single layer");
+}
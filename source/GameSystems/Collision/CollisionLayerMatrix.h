@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Component/Collider/CollisionType.h"
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+/// <summary>
+/// CollisionObjectTypeの分類(レイヤー)同士が衝突し得るかを表す対称行列. シーンごとにCollisionManagerに設定する
+/// <para>衝突し得ないレイヤーの組は, コライダーが互いを衝突対象に設定していてもブロードフェーズで候補ペアにならない</para>
+/// <para>ブロードフェーズはコライダーをレイヤーごとのバケットに分けて持ち, 衝突し得ないバケット同士は探索しない.</para>
+/// <para>単一の分類でないオブジェクトタイプ(NONE, WILDCARDなど)のコライダーは共通のバケットに入り, ペアごとに行列を確認する</para>
+/// </summary>
+class CollisionLayerMatrix
+{
+public:
+	// CollisionObjectTypeの単一ビットの分類 (GROUND ~ GOAL_FLAG) の数. 分類を追加したら増やす
+	static constexpr int NUM_LAYERS = 8;
+
+	// 単一の分類でないオブジェクトタイプのコライダーが入るバケット
+	static constexpr int MIXED_BUCKET = NUM_LAYERS;
+	static constexpr int NUM_BUCKETS = NUM_LAYERS + 1;
+
+	/// <summary>
+	/// 全てのレイヤーの組が衝突し得る状態で初期化する. この場合はコライダーの衝突対象の設定だけで判定される
+	/// </summary>
+	CollisionLayerMatrix();
+
+	/// <summary>
+	/// 2つのレイヤーが衝突し得るかを設定する. 行列は対称に保たれる
+	/// </summary>
+	/// <param name="layer_a">単一の分類</param>
+	/// <param name="layer_b">単一の分類</param>
+	void SetLayersCollide(const CollisionObjectType layer_a, const CollisionObjectType layer_b, const bool should_collide);
+
+	/// <summary>
+	/// layerと, targetsに含まれる全てのレイヤーが衝突し得るようにする
+	/// </summary>
+	void SetLayerCollidesWith(const CollisionObjectType layer, const std::initializer_list<CollisionObjectType> targets);
+
+	/// <summary>
+	/// 全てのレイヤーの組を衝突し得る, もしくは衝突し得ない状態にする
+	/// </summary>
+	void SetAllLayersCollide(const bool should_collide);
+
+	/// <summary>
+	/// object_typeの各レイヤーと, hit_object_typesの各レイヤーが衝突し得るようにする. コライダーの衝突対象から行列を作るのに使う
+	/// </summary>
+	/// <returns>行列が変わったか</returns>
+	bool AllowHitTargets(const CollisionObjectType_UnderlyingType object_type, const CollisionObjectType_UnderlyingType hit_object_types);
+
+	/// <summary>
+	/// 2つのオブジェクトタイプが衝突し得るか. 複数の分類を持つ場合は, いずれかの組が衝突し得れば真
+	/// </summary>
+	bool ShouldCollide(const CollisionObjectType_UnderlyingType object_type_a, const CollisionObjectType_UnderlyingType object_type_b) const;
+
+	/// <summary>
+	/// 2つのバケットのコライダーが候補ペアになり得るか
+	/// </summary>
+	bool ShouldBucketsCollide(const int bucket_a, const int bucket_b) const { return (_bucket_masks[bucket_a] & (1u << bucket_b)) != 0; }
+
+	/// <summary>
+	/// オブジェクトタイプのコライダーが入るバケット
+	/// </summary>
+	static int GetBucketIndex(const CollisionObjectType object_type);
+
+	/// <summary>
+	/// バケットに入るコライダーが持ち得るオブジェクトタイプの論理和. MIXED_BUCKETの場合はWILDCARD
+	/// </summary>
+	static CollisionObjectType_UnderlyingType GetBucketObjectTypes(const int bucket_index);
+
+private:
+	/// <summary>
+	/// レイヤー行列からバケット同士の組み合わせを計算し直す
+	/// </summary>
+	void UpdateBucketMasks();
+
+	static int GetLayerIndex(const CollisionObjectType layer);
+
+	// i番目のレイヤーと衝突し得るレイヤーのビットの論理和
+	std::array<CollisionObjectType_UnderlyingType, NUM_LAYERS> _layer_masks;
+
+	// i番目のバケットと候補ペアになり得るバケットのビットの論理和
+	std::array<uint32_t, NUM_BUCKETS> _bucket_masks;
+};
@@ -0,0 +1,89 @@
+#include "CollisionPairBuffer.h"
+#include "Component/Collider/ColliderBase.h"
+#include <algorithm>
+#include <numeric>
+
+void CollisionPairBuffer::Clear()
+{
+	collider_a.clear();
+	collider_b.clear();
+	aabb_a.clear();
+	aabb_b.clear();
+	object_type_a.clear();
+	object_type_b.clear();
+	hit_mask_a.clear();
+	hit_mask_b.clear();
+	sort_key.clear();
+}
+
+void CollisionPairBuffer::Add(ColliderBase* const a, const FRectAA& a_aabb, ColliderBase* const b, const FRectAA& b_aabb)
+{
+	collider_a.push_back(a);
+	collider_b.push_back(b);
+	aabb_a.push_back(a_aabb);
+	aabb_b.push_back(b_aabb);
+	object_type_a.push_back(static_cast<CollisionObjectType_UnderlyingType>(a->GetCollisionObjectType()));
+	object_type_b.push_back(static_cast<CollisionObjectType_UnderlyingType>(b->GetCollisionObjectType()));
+	hit_mask_a.push_back(a->GetHitObjectTypes());
+	hit_mask_b.push_back(b->GetHitObjectTypes());
+
+	// ペア内の順序に依らないよう, 小さい方の通し番号を上位に置く
+	const uint64_t serial_a = a->GetSerialNumber();
+	const uint64_t serial_b = b->GetSerialNumber();
+	sort_key.push_back(serial_a < serial_b ? ((serial_a << 32) | serial_b) : ((serial_b << 32) | serial_a));
+}
+
+int CollisionPairBuffer::FilterInPlace()
+{
+	const int num_pairs = Size();
+	int num_kept = 0;
+	for (int i = 0; i < num_pairs; ++i)
+	{
+		const bool is_mutual_target = (hit_mask_a[i] & object_type_b[i]) != 0 && (hit_mask_b[i] & object_type_a[i]) != 0;
+		if (!is_mutual_target || !GeometricUtility::DoesAARectOverlapWithAnother(aabb_a[i], aabb_b[i]))
+		{
+			continue;
+		}
+
+		if (num_kept != i)
+		{
+			MovePair(i, num_kept);
+		}
+		++num_kept;
+	}
+
+	collider_a.resize(num_kept);
+	collider_b.resize(num_kept);
+	aabb_a.resize(num_kept);
+	aabb_b.resize(num_kept);
+	object_type_a.resize(num_kept);
+	object_type_b.resize(num_kept);
+	hit_mask_a.resize(num_kept);
+	hit_mask_b.resize(num_kept);
+	sort_key.resize(num_kept);
+
+	return num_kept;
+}
+
+void CollisionPairBuffer::GetSortedOrder(std::vector<int>& out_order) const
+{
+	out_order.resize(Size());
+	std::iota(out_order.begin(), out_order.end(), 0);
+	std::sort(out_order.begin(), out_order.end(), [this](const int lhs, const int rhs)
+		{
+			return sort_key[lhs] < sort_key[rhs];
+		});
+}
+
+void CollisionPairBuffer::MovePair(const int src, const int dst)
+{
+	collider_a[dst] = collider_a[src];
+	collider_b[dst] = collider_b[src];
+	aabb_a[dst] = aabb_a[src];
+	aabb_b[dst] = aabb_b[src];
+	object_type_a[dst] = object_type_a[src];
+	object_type_b[dst] = object_type_b[src];
+	hit_mask_a[dst] = hit_mask_a[src];
+	hit_mask_b[dst] = hit_mask_b[src];
+	sort_key[dst] = sort_key[src];
+}
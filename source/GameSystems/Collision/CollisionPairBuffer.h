@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Utility/Core/MathCore.h"
+#include "Component/Collider/CollisionType.h"
+#include <vector>
+#include <cstdint>
+
+class ColliderBase;
+
+/// <summary>
+/// ブロードフェーズが出力する衝突判定の候補ペアの配列
+/// <para>フィルタリングでは要素ごとに一部のフィールドしか読まないので, フィールドごとに別の配列に格納する (SoA).</para>
+/// <para>フレーム間で使いまわし, 容量を解放しないことで毎フレームのメモリ確保を避ける</para>
+/// </summary>
+struct CollisionPairBuffer
+{
+	// ペアのコライダー. aが動的コライダー, bが相手
+	std::vector<ColliderBase*> collider_a;
+	std::vector<ColliderBase*> collider_b;
+
+	// コライダーのAABB (fat AABBではない)
+	std::vector<FRectAA> aabb_a;
+	std::vector<FRectAA> aabb_b;
+
+	// コライダーのオブジェクトタイプ
+	std::vector<CollisionObjectType_UnderlyingType> object_type_a;
+	std::vector<CollisionObjectType_UnderlyingType> object_type_b;
+
+	// 衝突対象のオブジェクトタイプの論理和
+	std::vector<CollisionObjectType_UnderlyingType> hit_mask_a;
+	std::vector<CollisionObjectType_UnderlyingType> hit_mask_b;
+
+	// ペアの並び順を決めるキー. コライダーの通し番号から作るので, ポインタの値や列挙順に依存しない
+	std::vector<uint64_t> sort_key;
+
+	int Size() const { return static_cast<int>(collider_a.size()); }
+
+	/// <summary>
+	/// 全ペアを削除する. 容量は保持される
+	/// </summary>
+	void Clear();
+
+	void Add(ColliderBase* const a, const FRectAA& a_aabb, ColliderBase* const b, const FRectAA& b_aabb);
+
+	/// <summary>
+	/// 互いを衝突対象に設定していないペアと, AABBが重ならないペアを取り除き, 残ったペアを前に詰める
+	/// </summary>
+	/// <returns>残ったペアの数</returns>
+	int FilterInPlace();
+
+	/// <summary>
+	/// sort_keyの昇順に並べたペアのインデックスを取得する
+	/// </summary>
+	void GetSortedOrder(std::vector<int>& out_order) const;
+
+private:
+	/// <summary>
+	/// src番目のペアをdst番目に移動する
+	/// </summary>
+	void MovePair(const int src, const int dst);
+};
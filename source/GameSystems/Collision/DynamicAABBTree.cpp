@@ -0,0 +1,360 @@
+#include "DynamicAABBTree.h"
+#include <algorithm>
+
+DynamicAABBTree::DynamicAABBTree()
+	: _root(NULL_NODE)
+	, _free_list(NULL_NODE)
+	, _proxy_count(0)
+{
+}
+
+int DynamicAABBTree::CreateProxy(const FRectAA& aabb, ColliderBase* collider)
+{
+	const int proxy_id = AllocateNode();
+
+	const Vector2D margin(AABB_MARGIN, AABB_MARGIN);
+	TreeNode& node = _nodes[proxy_id];
+	node.aabb = FRectAA(aabb.left_top - margin, aabb.right_bottom + margin);
+	node.collider = collider;
+	node.height = 0;
+
+	InsertLeaf(proxy_id);
+	++_proxy_count;
+
+	return proxy_id;
+}
+
+void DynamicAABBTree::DestroyProxy(const int proxy_id)
+{
+	assert(0 <= proxy_id && proxy_id < static_cast<int>(_nodes.size()));
+	assert(_nodes[proxy_id].IsLeaf());
+
+	RemoveLeaf(proxy_id);
+	FreeNode(proxy_id);
+	--_proxy_count;
+}
+
+bool DynamicAABBTree::MoveProxy(const int proxy_id, const FRectAA& aabb, const Vector2D& displacement)
+{
+	assert(0 <= proxy_id && proxy_id < static_cast<int>(_nodes.size()));
+	assert(_nodes[proxy_id].IsLeaf());
+
+	// fat AABBに収まっている間はツリーを変更しない
+	if (GeometricUtility::DoesRectContainAnother(_nodes[proxy_id].aabb, aabb))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxy_id);
+
+	// 余白を付け, さらに移動方向に拡張する
+	const Vector2D margin(AABB_MARGIN, AABB_MARGIN);
+	FRectAA fat_aabb(aabb.left_top - margin, aabb.right_bottom + margin);
+
+	const Vector2D d = displacement * DISPLACEMENT_MULTIPLIER;
+	if (d.x < 0.f)
+	{
+		fat_aabb.left_top.x += d.x;
+	}
+	else
+	{
+		fat_aabb.right_bottom.x += d.x;
+	}
+
+	if (d.y < 0.f)
+	{
+		fat_aabb.left_top.y += d.y;
+	}
+	else
+	{
+		fat_aabb.right_bottom.y += d.y;
+	}
+
+	_nodes[proxy_id].aabb = fat_aabb;
+
+	InsertLeaf(proxy_id);
+	return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+	_nodes.clear();
+	_nodes.shrink_to_fit();
+	_root = NULL_NODE;
+	_free_list = NULL_NODE;
+	_proxy_count = 0;
+}
+
+int DynamicAABBTree::AllocateNode()
+{
+	if (_free_list == NULL_NODE)
+	{
+		// フリーリストが空なのでノード配列を拡張する
+		TreeNode new_node{};
+		new_node.parent_or_next = NULL_NODE;
+		new_node.height = -1;
+		_nodes.push_back(new_node);
+		_free_list = static_cast<int>(_nodes.size()) - 1;
+		_nodes[_free_list].parent_or_next = NULL_NODE;
+	}
+
+	const int node_id = _free_list;
+	TreeNode& node = _nodes[node_id];
+	_free_list = node.parent_or_next;
+
+	node.parent_or_next = NULL_NODE;
+	node.child1 = NULL_NODE;
+	node.child2 = NULL_NODE;
+	node.height = 0;
+	node.collider = nullptr;
+	return node_id;
+}
+
+void DynamicAABBTree::FreeNode(const int node_id)
+{
+	TreeNode& node = _nodes[node_id];
+	node.parent_or_next = _free_list;
+	node.height = -1;
+	node.collider = nullptr;
+	_free_list = node_id;
+}
+
+void DynamicAABBTree::InsertLeaf(const int leaf)
+{
+	if (_root == NULL_NODE)
+	{
+		_root = leaf;
+		_nodes[_root].parent_or_next = NULL_NODE;
+		return;
+	}
+
+	// 周長の増加量が最小になる兄弟ノードを探す
+	const FRectAA leaf_aabb = _nodes[leaf].aabb;
+	int index = _root;
+	while (!_nodes[index].IsLeaf())
+	{
+		const int child1 = _nodes[index].child1;
+		const int child2 = _nodes[index].child2;
+
+		const float area = GetPerimeter(_nodes[index].aabb);
+		const float combined_area = GetPerimeter(Combine(_nodes[index].aabb, leaf_aabb));
+
+		// このノードとリーフで新しい親ノードを作る場合のコスト
+		const float cost = 2.f * combined_area;
+
+		// リーフを子孫に押し下げる場合の, 祖先側で増えるコスト
+		const float inheritance_cost = 2.f * (combined_area - area);
+
+		auto GetDescendCost = [&](const int child) -> float
+		{
+			const FRectAA combined = Combine(leaf_aabb, _nodes[child].aabb);
+			if (_nodes[child].IsLeaf())
+			{
+				return GetPerimeter(combined) + inheritance_cost;
+			}
+			return GetPerimeter(combined) - GetPerimeter(_nodes[child].aabb) + inheritance_cost;
+		};
+
+		const float cost1 = GetDescendCost(child1);
+		const float cost2 = GetDescendCost(child2);
+
+		if (cost < cost1 && cost < cost2)
+		{
+			break;
+		}
+
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+
+	const int sibling = index;
+
+	// 兄弟ノードとリーフの親ノードを新たに作る
+	const int old_parent = _nodes[sibling].parent_or_next;
+	const int new_parent = AllocateNode();
+	_nodes[new_parent].parent_or_next = old_parent;
+	_nodes[new_parent].aabb = Combine(leaf_aabb, _nodes[sibling].aabb);
+	_nodes[new_parent].height = _nodes[sibling].height + 1;
+	_nodes[new_parent].child1 = sibling;
+	_nodes[new_parent].child2 = leaf;
+	_nodes[sibling].parent_or_next = new_parent;
+	_nodes[leaf].parent_or_next = new_parent;
+
+	if (old_parent != NULL_NODE)
+	{
+		if (_nodes[old_parent].child1 == sibling)
+		{
+			_nodes[old_parent].child1 = new_parent;
+		}
+		else
+		{
+			_nodes[old_parent].child2 = new_parent;
+		}
+	}
+	else
+	{
+		_root = new_parent;
+	}
+
+	// 祖先ノードの高さとAABBを修正しつつバランスを取る
+	index = _nodes[leaf].parent_or_next;
+	while (index != NULL_NODE)
+	{
+		index = Balance(index);
+
+		const int child1 = _nodes[index].child1;
+		const int child2 = _nodes[index].child2;
+		_nodes[index].height = 1 + (std::max)(_nodes[child1].height, _nodes[child2].height);
+		_nodes[index].aabb = Combine(_nodes[child1].aabb, _nodes[child2].aabb);
+
+		index = _nodes[index].parent_or_next;
+	}
+}
+
+void DynamicAABBTree::RemoveLeaf(const int leaf)
+{
+	if (leaf == _root)
+	{
+		_root = NULL_NODE;
+		return;
+	}
+
+	const int parent = _nodes[leaf].parent_or_next;
+	const int grand_parent = _nodes[parent].parent_or_next;
+	const int sibling = (_nodes[parent].child1 == leaf) ? _nodes[parent].child2 : _nodes[parent].child1;
+
+	if (grand_parent == NULL_NODE)
+	{
+		// 親がルートなので兄弟ノードが新しいルートになる
+		_root = sibling;
+		_nodes[sibling].parent_or_next = NULL_NODE;
+		FreeNode(parent);
+		return;
+	}
+
+	// 親ノードを破棄して兄弟ノードを祖父ノードに繋げる
+	if (_nodes[grand_parent].child1 == parent)
+	{
+		_nodes[grand_parent].child1 = sibling;
+	}
+	else
+	{
+		_nodes[grand_parent].child2 = sibling;
+	}
+	_nodes[sibling].parent_or_next = grand_parent;
+	FreeNode(parent);
+
+	int index = grand_parent;
+	while (index != NULL_NODE)
+	{
+		index = Balance(index);
+
+		const int child1 = _nodes[index].child1;
+		const int child2 = _nodes[index].child2;
+		_nodes[index].aabb = Combine(_nodes[child1].aabb, _nodes[child2].aabb);
+		_nodes[index].height = 1 + (std::max)(_nodes[child1].height, _nodes[child2].height);
+
+		index = _nodes[index].parent_or_next;
+	}
+}
+
+int DynamicAABBTree::Balance(const int ia)
+{
+	assert(ia != NULL_NODE);
+
+	const TreeNode& node_a = _nodes[ia];
+	if (node_a.IsLeaf() || node_a.height < 2)
+	{
+		return ia;
+	}
+
+	const int ib = node_a.child1;
+	const int ic = node_a.child2;
+	const int balance = _nodes[ic].height - _nodes[ib].height;
+
+	// 子ノードの一方(iy)を持ち上げてiaと入れ替える
+	auto Rotate = [this, ia](const int iy, const int iz) -> int
+	{
+		// iy: 持ち上げる子ノード, iz: もう一方の子ノード
+		TreeNode& a = _nodes[ia];
+		TreeNode& y = _nodes[iy];
+		const int iy1 = y.child1;
+		const int iy2 = y.child2;
+
+		// aとyを入れ替える
+		y.child1 = ia;
+		y.parent_or_next = a.parent_or_next;
+		a.parent_or_next = iy;
+
+		// aの元の親はyを指す
+		if (y.parent_or_next != NULL_NODE)
+		{
+			TreeNode& y_parent = _nodes[y.parent_or_next];
+			if (y_parent.child1 == ia)
+			{
+				y_parent.child1 = iy;
+			}
+			else
+			{
+				assert(y_parent.child2 == ia);
+				y_parent.child2 = iy;
+			}
+		}
+		else
+		{
+			_root = iy;
+		}
+
+		// yの子のうち高い方をyに残し, 低い方をaに渡す
+		const bool y1_is_higher = _nodes[iy1].height > _nodes[iy2].height;
+		const int i_keep = y1_is_higher ? iy1 : iy2;
+		const int i_give = y1_is_higher ? iy2 : iy1;
+
+		y.child2 = i_keep;
+		if (a.child1 == iy)
+		{
+			a.child1 = i_give;
+		}
+		else
+		{
+			a.child2 = i_give;
+		}
+		_nodes[i_give].parent_or_next = ia;
+
+		a.aabb = Combine(_nodes[iz].aabb, _nodes[i_give].aabb);
+		y.aabb = Combine(a.aabb, _nodes[i_keep].aabb);
+
+		a.height = 1 + (std::max)(_nodes[iz].height, _nodes[i_give].height);
+		y.height = 1 + (std::max)(a.height, _nodes[i_keep].height);
+
+		return iy;
+	};
+
+	if (balance > 1)
+	{
+		// 右(child2)が高すぎる
+		return Rotate(ic, ib);
+	}
+
+	if (balance < -1)
+	{
+		// 左(child1)が高すぎる
+		return Rotate(ib, ic);
+	}
+
+	return ia;
+}
+
+FRectAA DynamicAABBTree::Combine(const FRectAA& a, const FRectAA& b)
+{
+	return FRectAA(
+		Vector2D((std::min)(a.left_top.x, b.left_top.x), (std::min)(a.left_top.y, b.left_top.y)),
+		Vector2D((std::max)(a.right_bottom.x, b.right_bottom.x), (std::max)(a.right_bottom.y, b.right_bottom.y))
+	);
+}
+
+float DynamicAABBTree::GetPerimeter(const FRectAA& aabb)
+{
+	const float width = aabb.right_bottom.x - aabb.left_top.x;
+	const float height = aabb.right_bottom.y - aabb.left_top.y;
+	return 2.f * (width + height);
+}
@@ -0,0 +1,343 @@
+#pragma once
+
+#include "Utility/Core/MathCore.h"
+#include <vector>
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+class ColliderBase;
+
+/// <summary>
+/// 動的AABBツリー (ブロードフェーズ用)
+/// <para>各リーフはコライダーのAABBを余白(AABB_MARGIN)だけ太らせたAABB(fat AABB)を持つ.</para>
+/// <para>コライダーが移動してもfat AABBからはみ出さない限りツリーは変更されず, はみ出した場合はそのリーフだけを再挿入する.</para>
+/// <para>挿入・削除時に回転による高さのバランス調整を行うので, コライダーが移動し続けてもツリーの深さは O(log n) に保たれる.</para>
+/// </summary>
+class DynamicAABBTree
+{
+public:
+	// 無効なノード番号
+	static constexpr int NULL_NODE = -1;
+
+	// fat AABBの余白 [px]
+	static constexpr float AABB_MARGIN = 8.f;
+
+	// 移動量に対するfat AABBの拡張倍率. 移動方向に余分に太らせることで再挿入の頻度を下げる
+	static constexpr float DISPLACEMENT_MULTIPLIER = 2.f;
+
+	// 探索に使うスタックの最大サイズ. バランスされたツリーの高さは高々数十なので十分に大きい
+	static constexpr int MAX_STACK_SIZE = 256;
+
+	// RayCastBatch()で一度に扱える線分の最大数. 線分ごとの探索継続フラグを32bitのマスクで持つ
+	static constexpr int MAX_BATCH_RAYS = 32;
+
+	DynamicAABBTree();
+
+	/// <summary>
+	/// プロキシ(リーフ)を生成してツリーに挿入する
+	/// </summary>
+	/// <param name="aabb">コライダーのAABB</param>
+	/// <param name="collider">プロキシに対応するコライダー</param>
+	/// <returns>プロキシID</returns>
+	int CreateProxy(const FRectAA& aabb, ColliderBase* collider);
+
+	/// <summary>
+	/// プロキシをツリーから削除する
+	/// </summary>
+	void DestroyProxy(const int proxy_id);
+
+	/// <summary>
+	/// プロキシのAABBを更新する.
+	/// <para>新しいAABBが現在のfat AABBに内包される場合は何もしない</para>
+	/// </summary>
+	/// <param name="proxy_id">プロキシID</param>
+	/// <param name="aabb">コライダーの新しいAABB</param>
+	/// <param name="displacement">前回からの移動量. fat AABBを移動方向に拡張するのに使う</param>
+	/// <returns>リーフが再挿入されたか</returns>
+	bool MoveProxy(const int proxy_id, const FRectAA& aabb, const Vector2D& displacement);
+
+	/// <summary>
+	/// 全ノードを破棄する
+	/// </summary>
+	void Clear();
+
+	ColliderBase* GetCollider(const int proxy_id) const { return _nodes[proxy_id].collider; }
+	const FRectAA& GetFatAABB(const int proxy_id) const { return _nodes[proxy_id].aabb; }
+
+	/// <summary>
+	/// ツリーの高さ. リーフのみの場合は0, 空の場合は-1
+	/// </summary>
+	int GetHeight() const { return _root == NULL_NODE ? -1 : _nodes[_root].height; }
+
+	int GetProxyCount() const { return _proxy_count; }
+
+	/// <summary>
+	/// AABBとfat AABBが重なる全プロキシについてcallbackを呼ぶ
+	/// </summary>
+	/// <param name="aabb">クエリ矩形</param>
+	/// <param name="callback">bool(int proxy_id). falseを返すと探索を打ち切る</param>
+	template<typename Callback>
+	void Query(const FRectAA& aabb, Callback&& callback) const;
+
+	/// <summary>
+	/// 線分とfat AABBが重なるプロキシについてcallbackを呼ぶ
+	/// </summary>
+	/// <param name="segment">線分</param>
+	/// <param name="callback">
+	/// float(int proxy_id, float max_fraction).
+	/// 戻り値は以降の探索に使う線分の長さの割合 (0で探索打ち切り, max_fractionをそのまま返すと続行, それより小さい値を返すと線分を短縮する)
+	/// </param>
+	template<typename Callback>
+	void RayCast(const FSegment& segment, Callback&& callback) const;
+
+	/// <summary>
+	/// 複数の線分について, ツリーを1回だけ走査してRayCast()と同じ処理を行う
+	/// <para>各ノードでは, 親ノードと重なった線分のうち, まだ打ち切られていないものだけを調べる</para>
+	/// </summary>
+	/// <param name="segments">線分の配列</param>
+	/// <param name="num_segments">線分の数. MAX_BATCH_RAYS以下</param>
+	/// <param name="callback">
+	/// float(int proxy_id, int segment_index, float max_fraction).
+	/// 戻り値の扱いはRayCast()と同じだが, 0を返したときに打ち切られるのはその線分の探索だけ
+	/// </param>
+	template<typename Callback>
+	void RayCastBatch(const FSegment* const segments, const int num_segments, Callback&& callback) const;
+
+	/// <summary>
+	/// 全ノードについてcallbackを呼ぶ. デバッグ描画用
+	/// </summary>
+	/// <param name="callback">void(const FRectAA& aabb, int depth, bool is_leaf)</param>
+	template<typename Callback>
+	void VisitNodes(Callback&& callback) const;
+
+private:
+	struct TreeNode
+	{
+		// 内部ノードの場合は子ノードのAABBの和, リーフの場合はfat AABB
+		FRectAA aabb;
+
+		// リーフに対応するコライダー. 内部ノードの場合はnullptr
+		ColliderBase* collider;
+
+		// 使用中は親ノード, 未使用時はフリーリストの次のノード
+		int parent_or_next;
+
+		int child1;
+		int child2;
+
+		// リーフは0, 未使用は-1
+		int height;
+
+		bool IsLeaf() const { return child1 == NULL_NODE; }
+	};
+
+	int AllocateNode();
+	void FreeNode(const int node_id);
+	void InsertLeaf(const int leaf);
+	void RemoveLeaf(const int leaf);
+
+	/// <summary>
+	/// ノードiaが不均衡であれば回転させる
+	/// </summary>
+	/// <returns>回転後にiaの位置にあるノード</returns>
+	int Balance(const int ia);
+
+	static FRectAA Combine(const FRectAA& a, const FRectAA& b);
+	static float GetPerimeter(const FRectAA& aabb);
+
+	std::vector<TreeNode> _nodes;
+	int _root;
+	int _free_list;
+	int _proxy_count;
+};
+
+template<typename Callback>
+inline void DynamicAABBTree::Query(const FRectAA& aabb, Callback&& callback) const
+{
+	if (_root == NULL_NODE)
+	{
+		return;
+	}
+
+	std::array<int, MAX_STACK_SIZE> stack;
+	int stack_size = 0;
+	stack[stack_size++] = _root;
+
+	while (stack_size > 0)
+	{
+		const int node_id = stack[--stack_size];
+		const TreeNode& node = _nodes[node_id];
+
+		if (!GeometricUtility::DoesAARectOverlapWithAnother(node.aabb, aabb))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			if (!callback(node_id))
+			{
+				return;
+			}
+		}
+		else
+		{
+			assert(stack_size + 2 <= MAX_STACK_SIZE);
+			stack[stack_size++] = node.child1;
+			stack[stack_size++] = node.child2;
+		}
+	}
+}
+
+template<typename Callback>
+inline void DynamicAABBTree::RayCast(const FSegment& segment, Callback&& callback) const
+{
+	if (_root == NULL_NODE)
+	{
+		return;
+	}
+
+	const Vector2D start = segment.start;
+	const Vector2D d = segment.end - segment.start;
+	float max_fraction = 1.f;
+
+	std::array<int, MAX_STACK_SIZE> stack;
+	int stack_size = 0;
+	stack[stack_size++] = _root;
+
+	while (stack_size > 0)
+	{
+		const int node_id = stack[--stack_size];
+		const TreeNode& node = _nodes[node_id];
+
+		float t_min = 0.f;
+		float t_max = max_fraction;
+		if (!GeometricUtility::ClipSegmentByAARect(start, d, node.aabb, t_min, t_max))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			const float new_max_fraction = callback(node_id, max_fraction);
+			if (new_max_fraction <= 0.f)
+			{
+				return;
+			}
+			max_fraction = (std::min)(max_fraction, new_max_fraction);
+		}
+		else
+		{
+			assert(stack_size + 2 <= MAX_STACK_SIZE);
+			stack[stack_size++] = node.child1;
+			stack[stack_size++] = node.child2;
+		}
+	}
+}
+
+template<typename Callback>
+inline void DynamicAABBTree::RayCastBatch(const FSegment* const segments, const int num_segments, Callback&& callback) const
+{
+	assert(num_segments <= MAX_BATCH_RAYS);
+	if (_root == NULL_NODE || num_segments <= 0)
+	{
+		return;
+	}
+
+	std::array<Vector2D, MAX_BATCH_RAYS> starts;
+	std::array<Vector2D, MAX_BATCH_RAYS> directions;
+	std::array<float, MAX_BATCH_RAYS> max_fractions;
+	for (int i = 0; i < num_segments; ++i)
+	{
+		starts[i] = segments[i].start;
+		directions[i] = segments[i].end - segments[i].start;
+		max_fractions[i] = 1.f;
+	}
+
+	// 探索を続けている線分のマスク
+	uint32_t active_mask = (num_segments == 32) ? 0xFFFFFFFFu : ((1u << num_segments) - 1u);
+
+	// ノードと, そのノードに到達した線分のマスクの組
+	std::array<std::pair<int, uint32_t>, MAX_STACK_SIZE> stack;
+	int stack_size = 0;
+	stack[stack_size++] = { _root, active_mask };
+
+	while (stack_size > 0 && active_mask != 0)
+	{
+		const auto [node_id, parent_mask] = stack[--stack_size];
+		const TreeNode& node = _nodes[node_id];
+
+		const uint32_t candidate_mask = parent_mask & active_mask;
+		uint32_t node_mask = 0;
+		for (int ray_index = 0; ray_index < num_segments; ++ray_index)
+		{
+			if ((candidate_mask & (1u << ray_index)) == 0)
+			{
+				continue;
+			}
+
+			float t_min = 0.f;
+			float t_max = max_fractions[ray_index];
+			if (GeometricUtility::ClipSegmentByAARect(starts[ray_index], directions[ray_index], node.aabb, t_min, t_max))
+			{
+				node_mask |= (1u << ray_index);
+			}
+		}
+		if (node_mask == 0)
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			for (int ray_index = 0; ray_index < num_segments; ++ray_index)
+			{
+				if ((node_mask & (1u << ray_index)) == 0)
+				{
+					continue;
+				}
+
+				const float new_max_fraction = callback(node_id, ray_index, max_fractions[ray_index]);
+				if (new_max_fraction <= 0.f)
+				{
+					active_mask &= ~(1u << ray_index);
+				}
+				max_fractions[ray_index] = (std::min)(max_fractions[ray_index], new_max_fraction);
+			}
+		}
+		else
+		{
+			assert(stack_size + 2 <= MAX_STACK_SIZE);
+			stack[stack_size++] = { node.child1, node_mask };
+			stack[stack_size++] = { node.child2, node_mask };
+		}
+	}
+}
+
+template<typename Callback>
+inline void DynamicAABBTree::VisitNodes(Callback&& callback) const
+{
+	if (_root == NULL_NODE)
+	{
+		return;
+	}
+
+	std::array<std::pair<int, int>, MAX_STACK_SIZE> stack;
+	int stack_size = 0;
+	stack[stack_size++] = { _root, 0 };
+
+	while (stack_size > 0)
+	{
+		const auto [node_id, depth] = stack[--stack_size];
+		const TreeNode& node = _nodes[node_id];
+		callback(node.aabb, depth, node.IsLeaf());
+
+		if (!node.IsLeaf())
+		{
+			assert(stack_size + 2 <= MAX_STACK_SIZE);
+			stack[stack_size++] = { node.child1, depth + 1 };
+			stack[stack_size++] = { node.child2, depth + 1 };
+		}
+	}
+}
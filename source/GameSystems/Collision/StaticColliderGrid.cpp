@@ -0,0 +1,173 @@
+#include "StaticColliderGrid.h"
+#include "Component/Collider/ColliderBase.h"
+#include <cassert>
+#include <cmath>
+
+StaticColliderGrid::StaticColliderGrid()
+	: _cell_size(CELL_SIZE)
+	, _num_cells_x(0)
+	, _num_cells_y(0)
+	, _current_stamp(0)
+{
+}
+
+void StaticColliderGrid::Build(const std::vector<ColliderBase*>& colliders)
+{
+	Clear();
+
+	if (colliders.empty())
+	{
+		return;
+	}
+
+	// エントリの作成とグリッド全体の領域の計算
+	_entries.reserve(colliders.size());
+	for (ColliderBase* const collider : colliders)
+	{
+		Entry entry;
+		entry.aabb = collider->GetWorldAABB();
+		entry.collider = collider;
+		entry.is_enabled = true;
+
+		if (_entries.empty())
+		{
+			_bounds = entry.aabb;
+		}
+		else
+		{
+			_bounds.left_top.x = (std::min)(_bounds.left_top.x, entry.aabb.left_top.x);
+			_bounds.left_top.y = (std::min)(_bounds.left_top.y, entry.aabb.left_top.y);
+			_bounds.right_bottom.x = (std::max)(_bounds.right_bottom.x, entry.aabb.right_bottom.x);
+			_bounds.right_bottom.y = (std::max)(_bounds.right_bottom.y, entry.aabb.right_bottom.y);
+		}
+
+		_entry_index_map[collider] = static_cast<int>(_entries.size());
+		_entries.push_back(entry);
+	}
+
+	// セル数が上限を超える場合はセルを大きくする. 領域の外の位置を端のセルにまとめると, 線分のDDAがエントリを飛ばしてしまう
+	const float width = _bounds.right_bottom.x - _bounds.left_top.x;
+	const float height = _bounds.right_bottom.y - _bounds.left_top.y;
+	const float max_extent = (std::max)(width, height);
+	_cell_size = (std::max)(CELL_SIZE, max_extent / MAX_CELLS_PER_AXIS);
+	while (ceilf(max_extent / _cell_size) > MAX_CELLS_PER_AXIS)
+	{
+		// 丸め誤差で上限を超える場合
+		_cell_size = nextafterf(_cell_size, (std::numeric_limits<float>::max)());
+	}
+
+	_num_cells_x = (std::max)(static_cast<int>(ceilf(width / _cell_size)), 1);
+	_num_cells_y = (std::max)(static_cast<int>(ceilf(height / _cell_size)), 1);
+	assert(_num_cells_x <= MAX_CELLS_PER_AXIS && _num_cells_y <= MAX_CELLS_PER_AXIS);
+	const int num_cells = _num_cells_x * _num_cells_y;
+
+	// 1パス目: セルごとのエントリ数を数える
+	_cell_begin.assign(num_cells + 1, 0);
+	for (const Entry& entry : _entries)
+	{
+		int min_x, min_y, max_x, max_y;
+		GetCellRange(entry.aabb, min_x, min_y, max_x, max_y);
+		for (int y = min_y; y <= max_y; ++y)
+		{
+			for (int x = min_x; x <= max_x; ++x)
+			{
+				++_cell_begin[GetCellIndex(x, y) + 1];
+			}
+		}
+	}
+
+	// 累積和をとってセルごとの開始位置にする
+	for (int i = 0; i < num_cells; ++i)
+	{
+		_cell_begin[i + 1] += _cell_begin[i];
+	}
+
+	// 2パス目: エントリを詰める
+	_cell_entries.resize(_cell_begin[num_cells]);
+	std::vector<int> write_positions(_cell_begin.begin(), _cell_begin.end() - 1);
+	for (int entry_index = 0; entry_index < static_cast<int>(_entries.size()); ++entry_index)
+	{
+		int min_x, min_y, max_x, max_y;
+		GetCellRange(_entries[entry_index].aabb, min_x, min_y, max_x, max_y);
+		for (int y = min_y; y <= max_y; ++y)
+		{
+			for (int x = min_x; x <= max_x; ++x)
+			{
+				_cell_entries[write_positions[GetCellIndex(x, y)]++] = entry_index;
+			}
+		}
+	}
+
+	_visit_stamps.assign(_entries.size(), 0);
+}
+
+bool StaticColliderGrid::Remove(const ColliderBase* collider)
+{
+	auto it = _entry_index_map.find(collider);
+	if (it == _entry_index_map.end())
+	{
+		return false;
+	}
+
+	// セルの配列は詰め直さず, エントリを無効化するだけにする
+	_entries[it->second].collider = nullptr;
+	_entry_index_map.erase(it);
+	return true;
+}
+
+bool StaticColliderGrid::SetEnabled(const ColliderBase* collider, const bool is_enabled)
+{
+	auto it = _entry_index_map.find(collider);
+	if (it == _entry_index_map.end())
+	{
+		return false;
+	}
+
+	_entries[it->second].is_enabled = is_enabled;
+	return true;
+}
+
+bool StaticColliderGrid::Contains(const ColliderBase* collider) const
+{
+	return _entry_index_map.find(collider) != _entry_index_map.end();
+}
+
+void StaticColliderGrid::Clear()
+{
+	_entries.clear();
+	_cell_begin.clear();
+	_cell_entries.clear();
+	_entry_index_map.clear();
+	_visit_stamps.clear();
+	_bounds = FRectAA();
+	_cell_size = CELL_SIZE;
+	_num_cells_x = 0;
+	_num_cells_y = 0;
+	_current_stamp = 0;
+}
+
+bool StaticColliderGrid::GetCellRange(const FRectAA& aabb, int& out_min_x, int& out_min_y, int& out_max_x, int& out_max_y) const
+{
+	if (_entries.empty() || !GeometricUtility::DoesAARectOverlapWithAnother(aabb, _bounds))
+	{
+		return false;
+	}
+
+	out_min_x = clamp(static_cast<int>(floorf((aabb.left_top.x - _bounds.left_top.x) / _cell_size)), 0, _num_cells_x - 1);
+	out_min_y = clamp(static_cast<int>(floorf((aabb.left_top.y - _bounds.left_top.y) / _cell_size)), 0, _num_cells_y - 1);
+	out_max_x = clamp(static_cast<int>(floorf((aabb.right_bottom.x - _bounds.left_top.x) / _cell_size)), 0, _num_cells_x - 1);
+	out_max_y = clamp(static_cast<int>(floorf((aabb.right_bottom.y - _bounds.left_top.y) / _cell_size)), 0, _num_cells_y - 1);
+	return true;
+}
+
+uint32_t StaticColliderGrid::AdvanceVisitStamp() const
+{
+	++_current_stamp;
+	if (_current_stamp == 0)
+	{
+		// 一周したらスタンプをリセットする
+		std::fill(_visit_stamps.begin(), _visit_stamps.end(), 0);
+		_current_stamp = 1;
+	}
+	return _current_stamp;
+}
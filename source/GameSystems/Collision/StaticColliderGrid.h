@@ -0,0 +1,272 @@
+#pragma once
+
+#include "Utility/Core/MathCore.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+class ColliderBase;
+
+/// <summary>
+/// 静的コライダー用の一様グリッド
+/// <para>ステージ読み込み時に一度だけ構築し, 以降はコライダーの削除と, 一時的な無効化のみ受け付ける.</para>
+/// <para>各セルに属するコライダーは1本の配列に詰めて格納する (セルごとの開始位置をオフセット配列で持つ).</para>
+/// <para>*クエリは重複除去用のスタンプを書き換えるので, 複数スレッドから同時に呼んではいけない</para>
+/// </summary>
+class StaticColliderGrid
+{
+public:
+	// セルの一辺の長さの最小値 [px]. ブロック4タイル分
+	// セル数が上限を超える広い領域では, 領域全体が上限のセル数に収まるまでセルを大きくする
+	static constexpr float CELL_SIZE = 128.f;
+
+	// グリッドの1辺あたりのセル数の上限. 極端に広いステージでメモリを使い過ぎないようにする
+	static constexpr int MAX_CELLS_PER_AXIS = 4096;
+
+	StaticColliderGrid();
+
+	/// <summary>
+	/// グリッドを構築する. 構築済みの内容は破棄される
+	/// </summary>
+	/// <param name="colliders">登録するコライダー</param>
+	void Build(const std::vector<ColliderBase*>& colliders);
+
+	/// <summary>
+	/// コライダーをグリッドから削除する
+	/// </summary>
+	/// <returns>グリッドに登録されていたか</returns>
+	bool Remove(const ColliderBase* collider);
+
+	/// <summary>
+	/// 登録されたコライダーを一時的にクエリの対象から外す, もしくは対象に戻す. セルの配列は変更しない
+	/// </summary>
+	/// <returns>グリッドに登録されていたか</returns>
+	bool SetEnabled(const ColliderBase* collider, const bool is_enabled);
+
+	/// <summary>
+	/// グリッドに登録されているか. 無効化されていても登録されていれば真
+	/// </summary>
+	bool Contains(const ColliderBase* collider) const;
+
+	void Clear();
+
+	int GetColliderCount() const { return static_cast<int>(_entry_index_map.size()); }
+
+	// 構築時に決めたセルの一辺の長さ [px]
+	float GetCellSize() const { return _cell_size; }
+
+	/// <summary>
+	/// AABBが重なる全コライダーについてcallbackを呼ぶ. 各コライダーについて高々1回呼ばれる
+	/// </summary>
+	/// <param name="aabb">クエリ矩形</param>
+	/// <param name="callback">bool(ColliderBase* collider, const FRectAA& aabb). falseを返すと探索を打ち切る</param>
+	template<typename Callback>
+	void Query(const FRectAA& aabb, Callback&& callback) const;
+
+	/// <summary>
+	/// 線分とAABBが重なるコライダーについて, 線分の始点に近いセルから順にcallbackを呼ぶ
+	/// </summary>
+	/// <param name="segment">線分</param>
+	/// <param name="callback">
+	/// float(ColliderBase* collider, float max_fraction).
+	/// 戻り値の扱いはDynamicAABBTree::RayCastと同じ
+	/// </param>
+	template<typename Callback>
+	void RayCast(const FSegment& segment, Callback&& callback) const;
+
+private:
+	struct Entry
+	{
+		FRectAA aabb;
+
+		// 削除済みの場合はnullptr
+		ColliderBase* collider;
+
+		// SetEnabled()で無効化されている場合はfalse
+		bool is_enabled;
+	};
+
+	/// <summary>
+	/// AABBと重なるセルの範囲を取得する
+	/// </summary>
+	/// <returns>グリッドと重なるか</returns>
+	bool GetCellRange(const FRectAA& aabb, int& out_min_x, int& out_min_y, int& out_max_x, int& out_max_y) const;
+
+	int GetCellIndex(const int cell_x, const int cell_y) const { return cell_y * _num_cells_x + cell_x; }
+
+	/// <summary>
+	/// 重複除去用のスタンプを進める
+	/// </summary>
+	uint32_t AdvanceVisitStamp() const;
+
+	std::vector<Entry> _entries;
+
+	// セルiに属するエントリは _cell_entries[_cell_begin[i]] から _cell_entries[_cell_begin[i+1]-1]
+	std::vector<int> _cell_begin;
+	std::vector<int> _cell_entries;
+
+	std::unordered_map<const ColliderBase*, int> _entry_index_map;
+
+	// グリッド全体の領域
+	FRectAA _bounds;
+	float _cell_size;
+	int _num_cells_x;
+	int _num_cells_y;
+
+	// クエリ中に同じエントリを2回以上処理しないためのスタンプ
+	mutable std::vector<uint32_t> _visit_stamps;
+	mutable uint32_t _current_stamp;
+};
+
+template<typename Callback>
+inline void StaticColliderGrid::Query(const FRectAA& aabb, Callback&& callback) const
+{
+	int min_x, min_y, max_x, max_y;
+	if (!GetCellRange(aabb, min_x, min_y, max_x, max_y))
+	{
+		return;
+	}
+
+	const uint32_t stamp = AdvanceVisitStamp();
+	for (int y = min_y; y <= max_y; ++y)
+	{
+		for (int x = min_x; x <= max_x; ++x)
+		{
+			const int cell_index = GetCellIndex(x, y);
+			for (int i = _cell_begin[cell_index]; i < _cell_begin[cell_index + 1]; ++i)
+			{
+				const int entry_index = _cell_entries[i];
+				if (_visit_stamps[entry_index] == stamp)
+				{
+					continue;
+				}
+				_visit_stamps[entry_index] = stamp;
+
+				const Entry& entry = _entries[entry_index];
+				if (!entry.collider || !entry.is_enabled || !GeometricUtility::DoesAARectOverlapWithAnother(entry.aabb, aabb))
+				{
+					continue;
+				}
+
+				if (!callback(entry.collider, entry.aabb))
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+template<typename Callback>
+inline void StaticColliderGrid::RayCast(const FSegment& segment, Callback&& callback) const
+{
+	if (_entries.empty())
+	{
+		return;
+	}
+
+	const Vector2D start = segment.start;
+	const Vector2D d = segment.end - segment.start;
+
+	// グリッドの領域で線分を切り取る
+	float t_enter = 0.f;
+	float t_exit = 1.f;
+	if (!GeometricUtility::ClipSegmentByAARect(start, d, _bounds, t_enter, t_exit))
+	{
+		return;
+	}
+
+	// 線分が通るセルを始点側から順に辿る (DDA)
+	const Vector2D enter_position = start + d * t_enter;
+	int cell_x = clamp(static_cast<int>(floorf((enter_position.x - _bounds.left_top.x) / _cell_size)), 0, _num_cells_x - 1);
+	int cell_y = clamp(static_cast<int>(floorf((enter_position.y - _bounds.left_top.y) / _cell_size)), 0, _num_cells_y - 1);
+
+	const int step_x = (d.x > 0.f) ? 1 : ((d.x < 0.f) ? -1 : 0);
+	const int step_y = (d.y > 0.f) ? 1 : ((d.y < 0.f) ? -1 : 0);
+
+	// 次のセル境界に到達するt, セル1つ分進むのに必要なt
+	constexpr float T_INFINITY = (std::numeric_limits<float>::max)();
+	float t_next_x = T_INFINITY;
+	float t_delta_x = T_INFINITY;
+	if (step_x != 0)
+	{
+		const float boundary_x = _bounds.left_top.x + (cell_x + (step_x > 0 ? 1 : 0)) * _cell_size;
+		t_next_x = (boundary_x - start.x) / d.x;
+		t_delta_x = _cell_size / fabsf(d.x);
+	}
+	float t_next_y = T_INFINITY;
+	float t_delta_y = T_INFINITY;
+	if (step_y != 0)
+	{
+		const float boundary_y = _bounds.left_top.y + (cell_y + (step_y > 0 ? 1 : 0)) * _cell_size;
+		t_next_y = (boundary_y - start.y) / d.y;
+		t_delta_y = _cell_size / fabsf(d.y);
+	}
+
+	float max_fraction = t_exit;
+	const uint32_t stamp = AdvanceVisitStamp();
+	while (true)
+	{
+		const int cell_index = GetCellIndex(cell_x, cell_y);
+		for (int i = _cell_begin[cell_index]; i < _cell_begin[cell_index + 1]; ++i)
+		{
+			const int entry_index = _cell_entries[i];
+			if (_visit_stamps[entry_index] == stamp)
+			{
+				continue;
+			}
+
+			const Entry& entry = _entries[entry_index];
+			if (!entry.collider || !entry.is_enabled)
+			{
+				continue;
+			}
+
+			float t_min = 0.f;
+			float t_max = max_fraction;
+			if (!GeometricUtility::ClipSegmentByAARect(start, d, entry.aabb, t_min, t_max))
+			{
+				// 線分が短縮された後なので, 後のセルでも重ならない
+				continue;
+			}
+			_visit_stamps[entry_index] = stamp;
+
+			const float new_max_fraction = callback(entry.collider, max_fraction);
+			if (new_max_fraction <= 0.f)
+			{
+				return;
+			}
+			max_fraction = (std::min)(max_fraction, new_max_fraction);
+		}
+
+		// 次のセルへ. 次のセルが線分の範囲外なら終了
+		if (t_next_x < t_next_y)
+		{
+			if (t_next_x > max_fraction)
+			{
+				break;
+			}
+			cell_x += step_x;
+			t_next_x += t_delta_x;
+			if (cell_x < 0 || _num_cells_x <= cell_x)
+			{
+				break;
+			}
+		}
+		else
+		{
+			if (t_next_y > max_fraction)
+			{
+				break;
+			}
+			cell_y += step_y;
+			t_next_y += t_delta_y;
+			if (cell_y < 0 || _num_cells_y <= cell_y)
+			{
+				break;
+			}
+		}
+	}
+}
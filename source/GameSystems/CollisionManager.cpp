@@ -2,19 +2,103 @@
 #include "Actor/Actor.h"
 #include "Component/Collider/ColliderBase.h"
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <utility>
 
-/// <summary>
-/// xのn乗
-/// </summary>
-constexpr int64_t powc(const int32_t x, const uint8_t n)
+namespace
 {
-	if (n == 0)
+	/// <summary>
+	/// コライダーが持つ位置を使って, リストに含まれるか調べる
+	/// </summary>
+	bool ContainsIndexedCollider(const std::vector<ColliderBase*>& colliders, const ColliderBase* const collider, int ColliderBase::* const index_member)
 	{
-		return 1;
+		const int index = collider->*index_member;
+		return 0 <= index && index < static_cast<int>(colliders.size()) && colliders[index] == collider;
 	}
-	else
+
+	void AddIndexedCollider(std::vector<ColliderBase*>& colliders, ColliderBase* const collider, int ColliderBase::* const index_member)
+	{
+		assert(!ContainsIndexedCollider(colliders, collider, index_member));
+		collider->*index_member = static_cast<int>(colliders.size());
+		colliders.push_back(collider);
+	}
+
+	/// <summary>
+	/// 末尾のコライダーを空いた位置に移して取り除く. 対のソートで順序を決めるので, リストの順序は保たなくてよい
+	/// </summary>
+	void RemoveIndexedCollider(std::vector<ColliderBase*>& colliders, ColliderBase* const collider, int ColliderBase::* const index_member)
+	{
+		// Finalize()でリストを空にした後に破棄されたコライダーは含まれない
+		if (!ContainsIndexedCollider(colliders, collider, index_member))
+		{
+			collider->*index_member = -1;
+			return;
+		}
+
+		const int index = collider->*index_member;
+		ColliderBase* const last_collider = colliders.back();
+		colliders[index] = last_collider;
+		last_collider->*index_member = index;
+		colliders.pop_back();
+		collider->*index_member = -1;
+	}
+
+	/// <summary>
+	/// 線分トレースでコライダー1つを調べ, 始点から最も近いヒットを更新する
+	/// </summary>
+	/// <param name="closest_result">これまでで最も近いヒット</param>
+	/// <param name="closest_fraction">closest_resultのヒット位置の, 線分の長さに対する割合</param>
+	/// <returns>以降の探索に使う線分の長さの割合. ヒットする度に線分を短縮する</returns>
+	float UpdateClosestLineTraceHit(
+		QueryResult_SingleLineTrace& closest_result,
+		float& closest_fraction,
+		ColliderBase* const collider,
+		const CollisionQueryParams_SingleLineTrace& query_params,
+		const float max_fraction
+	)
+	{
+		QueryResult_SingleLineTrace result{};
+		collider->RespondToSingleLineTrace(result, query_params);
+		if (!result.has_hit)
+		{
+			return (std::min)(max_fraction, closest_fraction);
+		}
+
+		const Vector2D direction = query_params.segment.GetDirectionUnnormalized();
+		const float direction_length_sq = direction.LengthSquared();
+		const float fraction = (direction_length_sq > 0.f)
+			? Vector2D::Dot(result.hit_location - query_params.segment.start, direction) / direction_length_sq
+			: 0.f;
+		if (!closest_result.has_hit || fraction < closest_fraction)
+		{
+			closest_result = result;
+			closest_fraction = fraction;
+		}
+		return (std::min)(max_fraction, closest_fraction);
+	}
+
+	// ナローフェーズの1タスクあたりのペア数
+	constexpr int NARROWPHASE_CHUNK_SIZE = 64;
+
+	bool AreHitResultsEqual(const HitResult& lhs, const HitResult& rhs)
+	{
+		return
+			lhs.has_hit == rhs.has_hit &&
+			lhs.collision_type == rhs.collision_type &&
+			lhs.self_collider == rhs.self_collider &&
+			lhs.other_collider == rhs.other_collider &&
+			lhs.total_push_back_distance == rhs.total_push_back_distance &&
+			lhs.is_swept == rhs.is_swept &&
+			lhs.normal_from_other.x == rhs.normal_from_other.x &&
+			lhs.normal_from_other.y == rhs.normal_from_other.y;
+	}
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
 	{
-		return x * powc(x, n - 1);
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
 	}
 }
 
@@ -27,690 +111,790 @@ void CollisionManager::Finalize()
 {
 	if (IsTreeConstructed())
 	{
-		DestructKdTree();
+		DestructTree();
 	}
 
 	all_colliders.clear();
 	all_colliders.shrink_to_fit();
+	_continuous_colliders.clear();
+	_continuous_colliders.shrink_to_fit();
+	_pending_moved_colliders.clear();
+	_pending_moved_colliders.shrink_to_fit();
+
+	_pair_buffer = CollisionPairBuffer{};
+	_pair_order.clear();
+	_pair_order.shrink_to_fit();
+	_hit_results.clear();
+	_hit_results.shrink_to_fit();
+	_pushed_actors.clear();
+	_pushed_actors.shrink_to_fit();
+	_narrowphase_thread_buffers.clear();
+	_narrowphase_thread_buffers.shrink_to_fit();
+	_thread_pool.reset();
+
+	_layer_matrix = CollisionLayerMatrix{};
 }
 
-void CollisionManager::OnColliderTransformed(ColliderBase* collider)
+void CollisionManager::ConstructTree()
 {
-	if (!IsTreeConstructed())
+	if (IsTreeConstructed())
 	{
+		// ツリーが構築済み
 		return;
 	}
 
-	// 子ノードに包含されるコライダーは親ノードにも包含されるので,
-	// 現在の所属ノードが子ノードを持つ場合, 子ノードの方が最適な可能性がある.
-	// 所属ノードの再検索が不要なのは, 現在の所属ノードに包含され, 且つ子ノードを持たない場合.
-	const KdNode* const current_node = collider_node_map.at(collider);
-	if(!current_node->HasChildNode() && CheckNodeContainsCollider(collider, current_node))
+	_is_tree_constructed = true;
+
+	// キャッシュしておいたコライダーのうち, STATICなものはバケットごとの静的グリッドに, それ以外はツリーに挿入する
+	std::array<std::vector<ColliderBase*>, CollisionLayerMatrix::NUM_BUCKETS> static_colliders;
+	for (const auto& collider : all_colliders)
 	{
-		return;
+		if (collider->IsStatic())
+		{
+			static_colliders[CollisionLayerMatrix::GetBucketIndex(collider->GetCollisionObjectType())].push_back(collider);
+		}
+		else
+		{
+			AddToBroadphase(collider);
+		}
 	}
+	for (int bucket_index = 0; bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++bucket_index)
+	{
+		StaticColliderGrid& static_grid = _buckets[bucket_index].static_grid;
+		static_grid.Build(static_colliders[bucket_index]);
 
-	KdNode* new_node = FindNode(collider);
-	
-	// 新しいノードに移す
-	RemoveFromBelongingNode(collider);
-	AddColliderToNode(collider, new_node);
+		// 無効なコライダーはグリッドに残したまま探索対象から外す
+		for (ColliderBase* const collider : static_colliders[bucket_index])
+		{
+			if (!collider->IsActive())
+			{
+				static_grid.SetEnabled(collider, false);
+			}
+		}
+	}
+
+	_stats = CollisionStats{};
+	_num_reinserted_proxies_in_frame = 0;
+	_num_transform_notifications_in_frame = 0;
+	_num_moved_proxies_in_frame = 0;
+	UpdateBroadphaseStats();
 }
 
-void CollisionManager::DrawPartition(const KdNode* node, const CameraParams& camera_params, const int color) const
+void CollisionManager::DestructTree()
 {
-	if (!node->HasChildNode())
+	if (!IsTreeConstructed())
 	{
 		return;
 	}
 
-	const Vector2D left_top_in_world = node->GetAreaLeftTop();
-	const Vector2D right_bottom_in_world = node->GetAreaRightBottom();
-
-	Vector2D line_from_in_world, line_to_in_world;
-	if (node->split_axis == Axis::X)
+	for (BroadphaseBucket& bucket : _buckets)
 	{
-		line_from_in_world.x = line_to_in_world.x = node->split_position;
-		line_from_in_world.y = left_top_in_world.y;
-		line_to_in_world.y = right_bottom_in_world.y;
+		bucket.tree.Clear();
+		bucket.static_grid.Clear();
 	}
-	else if (node->split_axis == Axis::Y)
-	{
-		line_from_in_world.x = left_top_in_world.x;
-		line_to_in_world.x = right_bottom_in_world.x;
-		line_from_in_world.y = line_to_in_world.y = node->split_position;
-	}
-
-	const Vector2D line_from_in_screen(Vector2D::WorldToViewport(line_from_in_world, camera_params));
-	const Vector2D line_to_in_screen(Vector2D::WorldToViewport(line_to_in_world, camera_params));
-
-	DrawLine(line_from_in_screen.x, line_from_in_screen.y, line_to_in_screen.x, line_to_in_screen.y, color);
-
-	// 
-	auto To2CharString = [](uint8_t x)->tstring
-	{
-		if (x >= 100)
-		{
-			return _T("XX");
-		}
+	collider_proxy_map.clear();
+	_inactive_colliders.clear();
+	_pending_moved_colliders.clear();
+	_is_tree_constructed = false;
+}
 
-		tstring x_str = to_tstring(x);
-		if (x < 10)
-		{
-			return _T(" ") + x_str;
-		}
-		else if (x < 100)
-		{
-			return x_str;
-		}
-	};
+void CollisionManager::CreateProxy(ColliderBase* const collider)
+{
+	const FRectAA& aabb = collider->GetWorldAABB();
+
+	BroadphaseProxy proxy;
+	proxy.bucket_index = CollisionLayerMatrix::GetBucketIndex(collider->GetCollisionObjectType());
+	proxy.proxy_id = _buckets[proxy.bucket_index].tree.CreateProxy(aabb, collider);
+	proxy.last_aabb_center = (aabb.left_top + aabb.right_bottom) * 0.5f;
+	proxy.is_move_pending = false;
+	collider_proxy_map[collider] = proxy;
+}
 
-	const tstring smaller_node_index_str(To2CharString(node->GetLeftChildIndex()));
-	const tstring larger_node_index_str(To2CharString(node->GetRightChildIndex()));
-	const tstring partition_label = _T("(") + smaller_node_index_str + _T(",") + larger_node_index_str + _T(")");
-	constexpr uint8_t FONT_SIZE = 16;
-	if (node->split_axis == Axis::X)
+void CollisionManager::AddToBroadphase(ColliderBase* const collider)
+{
+	if (collider->IsActive())
 	{
-		const int label_width = DrawStringHelper::GetDrawStringWidth(FONT_SIZE, partition_label.c_str(), strlenDx(partition_label.c_str()));
-		Vector2D label_left_top(line_to_in_screen + Vector2D(-label_width / 2, 0));
-		DrawString(label_left_top.x, label_left_top.y, partition_label.c_str(), color);
+		CreateProxy(collider);
 	}
-	else if (node->split_axis == Axis::Y)
+	else
 	{
-		Vector2D label_left_top(line_to_in_screen + Vector2D(0, -FONT_SIZE/2));
-		DrawString(label_left_top.x, label_left_top.y, partition_label.c_str(), color);
+		_inactive_colliders.insert(collider);
 	}
 }
 
-bool CollisionManager::CheckNodeContainsCollider(ColliderBase* const collider, const KdNode* const node) const
+StaticColliderGrid& CollisionManager::GetStaticGrid(const ColliderBase* const collider)
 {
-	// コライダーの外接AABB
-	Vector2D aabb_left_top, aabb_right_bottom;
-	collider->GetAABB(aabb_left_top, aabb_right_bottom);
+	return _buckets[CollisionLayerMatrix::GetBucketIndex(collider->GetCollisionObjectType())].static_grid;
+}
 
-	// ノードの領域にコライダーの外接AABBが内包されるかをチェックする
-	bool collider_is_inside_node = GeometricUtility::DoesRectContainAnother(
-		node->GetAreaLeftTop(),
-		node->GetAreaRightBottom(),
-		aabb_left_top,
-		aabb_right_bottom
+bool CollisionManager::ShouldQueryBucket(const ColliderBase* const collider, const int bucket_index, const int other_bucket_index) const
+{
+	return (
+		_layer_matrix.ShouldBucketsCollide(bucket_index, other_bucket_index) &&
+		(collider->GetHitObjectTypes() & CollisionLayerMatrix::GetBucketObjectTypes(other_bucket_index)) != 0
 	);
+}
 
-	return collider_is_inside_node;
+void CollisionManager::UpdateBroadphaseStats()
+{
+	_stats.num_proxies = 0;
+	_stats.tree_height = -1;
+	_stats.num_static_colliders = 0;
+	for (const BroadphaseBucket& bucket : _buckets)
+	{
+		_stats.num_proxies += bucket.tree.GetProxyCount();
+		_stats.tree_height = (std::max)(_stats.tree_height, bucket.tree.GetHeight());
+		_stats.num_static_colliders += bucket.static_grid.GetColliderCount();
+	}
+	_stats.num_inactive_colliders = static_cast<int>(_inactive_colliders.size());
 }
 
-KdNode* CollisionManager::FindNode(ColliderBase* collider) const
+void CollisionManager::OnNewColliderInitialized(ColliderBase* new_collider)
 {
-	if (!IsTreeConstructed())
+	if (!new_collider)
 	{
-		return nullptr;
+		return;
 	}
 
-	// コライダーの外接AABB
-	Vector2D aabb_left_top, aabb_right_bottom;
-	collider->GetAABB(aabb_left_top, aabb_right_bottom);
+	new_collider->serial_number = _next_serial_number++;
+	AddIndexedCollider(all_colliders, new_collider, &ColliderBase::_index_in_all_colliders);
+	AllowColliderHitTargets(new_collider);
 
-	// ルートからスタートする
-	KdNode* node = _root_node;
-	
-	while (node->HasChildNode())
+	if (IsTreeConstructed())
 	{
-		// 左右子ノードどちらかに内包される場合は、さらにその子ノードについても調べる.
-		// どちらの子ノードにも内包されない(分割軸と接触する)場合は、現在のノードに決定.
+		AddToBroadphase(new_collider);
+	}
+}
 
-		const bool in_left_node = CheckNodeContainsCollider(collider, node->GetLeftChildNode());
-		if (in_left_node)
+void CollisionManager::OnColliderFinalize(ColliderBase* collider)
+{
+	// 破壊されるコライダーをツリーから削除
+	if (IsTreeConstructed())
+	{
+		auto it_proxy = collider_proxy_map.find(collider);
+		if (it_proxy != collider_proxy_map.end())
 		{
-			node = node->GetLeftChildNode();
-			continue;
+			_buckets[it_proxy->second.bucket_index].tree.DestroyProxy(it_proxy->second.proxy_id);
+			collider_proxy_map.erase(it_proxy);
 		}
-
-		// 右子ノードに含まれるか
-		const bool in_right_node = CheckNodeContainsCollider(collider, node->GetRightChildNode());
-		if (in_right_node)
+		else if (_inactive_colliders.erase(collider) == 0)
 		{
-			node = node->GetRightChildNode();
-			continue;
+			GetStaticGrid(collider).Remove(collider);
 		}
-
-		// 左右子ノードのセルどちらにも内包されない
-		return node;
 	}
 
-	// ルートノードが子ノードを持たない
-	return node;
+	RemoveIndexedCollider(all_colliders, collider, &ColliderBase::_index_in_all_colliders);
+	RemoveIndexedCollider(_continuous_colliders, collider, &ColliderBase::_index_in_continuous_colliders);
 }
 
-KdNode* CollisionManager::FindNode(const Vector2D& query_point) const
+void CollisionManager::OnColliderTransformed(ColliderBase* collider)
 {
 	if (!IsTreeConstructed())
 	{
-		return nullptr;
+		return;
 	}
 
-	if (!_root_node->HasChildNode())
+	auto it_proxy = collider_proxy_map.find(collider);
+	if (it_proxy == collider_proxy_map.end())
 	{
-		return _root_node;
+		// 静的グリッドに登録されたコライダーが動かされた場合 (エディタでの配置変更など)
+		if (GetStaticGrid(collider).Contains(collider))
+		{
+			MoveFromStaticGridToTree(collider);
+		}
+
+		// それ以外は初期化前か無効化されているコライダー
+		return;
 	}
 
-	KdNode* node = _root_node;
-	while (node->HasChildNode())
+	++_num_transform_notifications_in_frame;
+
+	// 押し戻しや移動処理の途中の位置はツリーに反映せず, 次にツリーを参照するときの位置だけを反映する
+	BroadphaseProxy& proxy = it_proxy->second;
+	if (!proxy.is_move_pending)
 	{
-		// 左子ノードに内包されるかチェック
+		proxy.is_move_pending = true;
+		_pending_moved_colliders.push_back(collider);
+	}
+}
+
+void CollisionManager::FlushPendingProxyMoves()
+{
+	for (ColliderBase* const collider : _pending_moved_colliders)
+	{
+		// 保留後に破棄・無効化されたコライダーはツリーに残っていないので飛ばす
+		// NOTE: 破棄されたコライダーを参照しないよう, 先にマップを引く
+		auto it_proxy = collider_proxy_map.find(collider);
+		if (it_proxy == collider_proxy_map.end() || !it_proxy->second.is_move_pending)
 		{
-			const Vector2D left_top = node->GetLeftChildNode()->GetAreaLeftTop();
-			const Vector2D right_bottom = node->GetLeftChildNode()->GetAreaRightBottom();
-			const bool is_contained_in_left_node = GeometricUtility::DoesAARectContainPoint(query_point, left_top, right_bottom);
-			if (is_contained_in_left_node)
-			{
-				node = node->GetLeftChildNode();
-				continue;
-			}
+			continue;
 		}
 
-		// 右子ノードに内包されるかチェック
+		BroadphaseProxy& proxy = it_proxy->second;
+		proxy.is_move_pending = false;
+
+		const FRectAA& aabb = collider->GetWorldAABB();
+		const Vector2D aabb_center = (aabb.left_top + aabb.right_bottom) * 0.5f;
+
+		// fat AABBに収まっていればツリーは変更されない
+		// 予測に使う移動量は, 前回反映した位置からの1フレーム分の移動量になる
+		const bool is_reinserted = _buckets[proxy.bucket_index].tree.MoveProxy(proxy.proxy_id, aabb, aabb_center - proxy.last_aabb_center);
+		if (is_reinserted)
 		{
-			const Vector2D left_top = node->GetRightChildNode()->GetAreaLeftTop();
-			const Vector2D right_bottom = node->GetRightChildNode()->GetAreaRightBottom();
-			const bool is_contained_in_right_node = GeometricUtility::DoesAARectContainPoint(query_point, left_top, right_bottom);
-			if (is_contained_in_right_node)
-			{
-				node = node->GetRightChildNode();
-				continue;
-			}
+			++_num_reinserted_proxies_in_frame;
 		}
-
-		// どちらの子ノードにも内包されない
-		return node;
+		proxy.last_aabb_center = aabb_center;
+		++_num_moved_proxies_in_frame;
 	}
-
-	return nullptr;
+	_pending_moved_colliders.clear();
 }
 
-
-void CollisionManager::ConstructKdTree(const Vector2D& root_cell_left_top, const Vector2D& root_cell_right_bottom)
+void CollisionManager::OnColliderMobilityChanged(ColliderBase* collider)
 {
-	if (IsTreeConstructed())
+	if (!IsTreeConstructed())
 	{
-		// ツリーが構築済み
+		// ツリー構築時の可動性が使われる
 		return;
 	}
 
-	_root_node = new KdNode(0, 0, Axis::X, root_cell_left_top, root_cell_right_bottom);
-	assert(_root_node);
-
-	// キャッシュしておいたコライダーをルートノードに移す
-	for (const auto& collider : all_colliders)
+	if (!collider->IsStatic() && GetStaticGrid(collider).Contains(collider))
 	{
-		AddColliderToNode(collider, _root_node);
+		MoveFromStaticGridToTree(collider);
 	}
-
-	constexpr const uint32_t total_node_num = powc(2, MAX_TREE_DEPTH + 1) - 1;
-	kd_nodes = std::vector<KdNode*>(total_node_num, nullptr);
-	kd_nodes.at(0) = _root_node;
-
-	SplitKdNodeRecursively(_root_node);
 }
 
-void CollisionManager::SplitKdNodeRecursively(KdNode* parent_node)
+void CollisionManager::OnColliderContinuousCollisionChanged(ColliderBase* collider)
 {
-	assert(parent_node->depth <= MAX_TREE_DEPTH);
+	const bool is_registered = ContainsIndexedCollider(_continuous_colliders, collider, &ColliderBase::_index_in_continuous_colliders);
+	if (collider->IsContinuousCollisionEnabled())
+	{
+		if (!is_registered)
+		{
+			AddIndexedCollider(_continuous_colliders, collider, &ColliderBase::_index_in_continuous_colliders);
+		}
+	}
+	else if (is_registered)
+	{
+		RemoveIndexedCollider(_continuous_colliders, collider, &ColliderBase::_index_in_continuous_colliders);
+	}
+}
 
-	if (!ShouldSplitNode(parent_node))
+void CollisionManager::OnColliderActiveChanged(ColliderBase* collider)
+{
+	if (!IsTreeConstructed())
 	{
+		// ツリー構築時に有効かどうかが使われる
 		return;
 	}
 
-	// 分割軸. 分割線はこの軸に垂直.
-	const Axis parent_split_axis = parent_node->split_axis;
-
-	// ノードに属するコライダー
-	std::vector<ColliderBase*>& colliders_in_parent = parent_node->GetCollidersInNode();
-
-	// 分割軸に沿ってコライダーリストをソートする
-	SortCollidersAlongAxis(colliders_in_parent, parent_split_axis);
-	const size_t i_middle_collider = colliders_in_parent.size() / 2;
-	
-	// parent_nodeの中央のコライダーの 左(X分割の場合) or 上(Y分割の場合) に分割線を引く. --> 中央コライダーは右子ノードに属する
-	Vector2D middle_collider_left_top, dummy;
-	colliders_in_parent.at(i_middle_collider)->GetAABB(middle_collider_left_top, dummy);
-	if (parent_split_axis == Axis::X)
+	if (collider->IsActive())
 	{
-		// X軸で分割する場合、中央コライダーの左に分割線を引く
-		const float middle_collider_left = middle_collider_left_top.x;
-		parent_node->split_position = middle_collider_left - 1.f;
+		if (_inactive_colliders.erase(collider) > 0)
+		{
+			CreateProxy(collider);
+		}
+		else
+		{
+			GetStaticGrid(collider).SetEnabled(collider, true);
+		}
 	}
 	else
 	{
-		// Y軸で分割する場合、中央コライダーの上に分割線を引く
-		const float middle_collider_top = middle_collider_left_top.y;
-		parent_node->split_position = middle_collider_top - 1.f;
+		auto it_proxy = collider_proxy_map.find(collider);
+		if (it_proxy != collider_proxy_map.end())
+		{
+			_buckets[it_proxy->second.bucket_index].tree.DestroyProxy(it_proxy->second.proxy_id);
+			collider_proxy_map.erase(it_proxy);
+			_inactive_colliders.insert(collider);
+		}
+		else
+		{
+			GetStaticGrid(collider).SetEnabled(collider, false);
+		}
 	}
+	_stats.num_inactive_colliders = static_cast<int>(_inactive_colliders.size());
+}
 
-	// 子ノードの深さと分割軸. 親子で分割軸は逆
-	const int child_depth = parent_node->depth + 1;
-	const Axis child_split_axis = (parent_split_axis == Axis::X) ? Axis::Y : Axis::X;
-
-	// 左右子ノードの左上, 右下の座標
-	Vector2D left_node_left_top, left_node_right_bottom, right_node_left_top, right_node_right_bottom;
+void CollisionManager::OnColliderHitTargetsChanged(ColliderBase* collider)
+{
+	if (ContainsIndexedCollider(all_colliders, collider, &ColliderBase::_index_in_all_colliders))
+	{
+		AllowColliderHitTargets(collider);
+	}
+}
 
-	if (parent_split_axis == Axis::X)
+void CollisionManager::SetLayerMatrix(const CollisionLayerMatrix& layer_matrix)
+{
+	_layer_matrix = layer_matrix;
+	for (ColliderBase* const collider : all_colliders)
 	{
-		const float top = parent_node->cell_left_top.y;
-		const float bottom = parent_node->cell_right_bottom.y;
+		AllowColliderHitTargets(collider);
+	}
+}
 
-		// 左子ノードは分割線の左側
-		left_node_left_top = parent_node->cell_left_top;
-		left_node_right_bottom = Vector2D(parent_node->split_position, bottom);
+void CollisionManager::AllowColliderHitTargets(const ColliderBase* collider)
+{
+	_layer_matrix.AllowHitTargets(static_cast<CollisionObjectType_UnderlyingType>(collider->GetCollisionObjectType()), collider->GetHitObjectTypes());
+}
 
-		// 右子ノードは分割線の右側
-		right_node_left_top = Vector2D(parent_node->split_position, top);
-		right_node_right_bottom = parent_node->cell_right_bottom;
-	}
-	else
+void CollisionManager::OnColliderObjectTypeChanged(ColliderBase* collider, const CollisionObjectType old_object_type)
+{
+	OnColliderHitTargetsChanged(collider);
+
+	if (!IsTreeConstructed())
 	{
-		// Y軸分割
-		const float left = parent_node->cell_left_top.x;
-		const float right = parent_node->cell_right_bottom.x;
+		return;
+	}
 
-		// 左子ノードは分割線の上側
-		left_node_left_top = parent_node->cell_left_top;
-		left_node_right_bottom = Vector2D(right, parent_node->split_position);
+	const int old_bucket_index = CollisionLayerMatrix::GetBucketIndex(old_object_type);
+	const int new_bucket_index = CollisionLayerMatrix::GetBucketIndex(collider->GetCollisionObjectType());
+	if (old_bucket_index == new_bucket_index)
+	{
+		return;
+	}
 
-		// 右子ノードは分割線の下側
-		right_node_left_top = Vector2D(left, parent_node->split_position);
-		right_node_right_bottom = parent_node->cell_right_bottom;
+	auto it_proxy = collider_proxy_map.find(collider);
+	if (it_proxy != collider_proxy_map.end())
+	{
+		_buckets[old_bucket_index].tree.DestroyProxy(it_proxy->second.proxy_id);
+		collider_proxy_map.erase(it_proxy);
+		CreateProxy(collider);
+	}
+	else if (_buckets[old_bucket_index].static_grid.Remove(collider))
+	{
+		// グリッドは構築後に追加できないので, 新しいバケットのツリーに移す
+		AddToBroadphase(collider);
+		UpdateBroadphaseStats();
 	}
 
-	// 左子ノードを生成
-	parent_node->left_node = new KdNode(
-		child_depth, 
-		parent_node->GetLeftChildIndex(), 
-		child_split_axis,
-		left_node_left_top, left_node_right_bottom
-	);
-	KdNode* const left_child = parent_node->GetLeftChildNode();
-	kd_nodes.at(parent_node->GetLeftChildIndex()) = left_child;
-
-	// 右子ノードを生成
-	parent_node->right_node = new KdNode(
-		child_depth,
-		parent_node->GetRightChildIndex(),
-		child_split_axis,
-		right_node_left_top, right_node_right_bottom
-	);
-	KdNode* const right_child = parent_node->GetRightChildNode();
-	kd_nodes.at(parent_node->GetRightChildIndex()) = right_child;
-	
-	// 親ノードが持つコライダーを左右子ノードに分配
-	DistributeColliders(parent_node);
+	// 無効化されているコライダーは, 有効化されたときに新しいバケットに挿入される
+}
 
-	// NOTE: 分割の必要性は関数先頭でチェックされる
-	SplitKdNodeRecursively(left_child);
-	SplitKdNodeRecursively(right_child);
+void CollisionManager::MoveFromStaticGridToTree(ColliderBase* const collider)
+{
+	GetStaticGrid(collider).Remove(collider);
+	AddToBroadphase(collider);
+	UpdateBroadphaseStats();
 }
 
-void CollisionManager::DistributeColliders(KdNode* const parent_node)
+void CollisionManager::HandleCollisions()
 {
-	KdNode* const left_node = parent_node->GetLeftChildNode();
-	KdNode* const right_node = parent_node->GetRightChildNode();
-	if (!parent_node || !left_node || !right_node)
+	if (!IsTreeConstructed())
 	{
 		return;
 	}
 
-	const std::vector<ColliderBase*>& colliders_in_parent = parent_node->GetCollidersInNode();
-
-	// コライダーが子ノードに内包される場合は親ノードから子ノードに移し、
-	// 分割軸と接触する場合は親ノードに残す
-	auto it_collider = colliders_in_parent.begin();
-	while (it_collider != colliders_in_parent.end())
+	// ブロードフェーズ
+	const auto broadphase_begin = std::chrono::high_resolution_clock::now();
+	PreparePairs();
+	_stats.broadphase_ms = GetElapsedMilliseconds(broadphase_begin);
+
+	// ナローフェーズ
+	const auto narrowphase_begin = std::chrono::high_resolution_clock::now();
+	RunNarrowPhase();
+	_stats.num_hits = static_cast<int>(_hit_results.size());
+	_stats.num_swept_hits = static_cast<int>(std::count_if(_hit_results.begin(), _hit_results.end(), [](const HitResult& hit_result) { return hit_result.is_swept; }));
+	_stats.num_narrowphase_threads = GetNumNarrowPhaseThreads();
+	_stats.narrowphase_ms = GetElapsedMilliseconds(narrowphase_begin);
+
+	UpdateBroadphaseStats();
+	_stats.num_reinserted_proxies = _num_reinserted_proxies_in_frame;
+	_num_reinserted_proxies_in_frame = 0;
+	_stats.num_transform_notifications = _num_transform_notifications_in_frame;
+	_num_transform_notifications_in_frame = 0;
+	_stats.num_moved_proxies = _num_moved_proxies_in_frame;
+	_num_moved_proxies_in_frame = 0;
+
+	// 解決
+	// NOTE: 押し戻しによる移動は保留され, 次のフレームのブロードフェーズでまとめてツリーに反映される
+	const auto resolve_begin = std::chrono::high_resolution_clock::now();
+	ResolveHits();
+	_stats.resolve_ms = GetElapsedMilliseconds(resolve_begin);
+
+	// 押し戻し後の位置を次のフレームの移動経路の始点にする
+	for (ColliderBase* const collider : _continuous_colliders)
 	{
-		ColliderBase* const collider = *it_collider;
+		collider->ResetContinuousCollisionSweep();
+	}
+}
 
-		Vector2D aabb_left_top, aabb_right_bottom;
-		collider->GetAABB(aabb_left_top, aabb_right_bottom);
+void CollisionManager::FindCandidatePairs()
+{
+	_pair_buffer.Clear();
 
-		// 左子ノードに内包される
-		if(CheckNodeContainsCollider(collider, left_node))
+	for (ColliderBase* const collider : all_colliders)
+	{
+		// 静的コライダー同士は判定しないので, 動的コライダーの側からだけ探索する
+		if (collider->IsStatic())
 		{
-			// 親ノードから左子ノードにコライダーを移動
-			RemoveFromBelongingNode(it_collider);
-			AddColliderToNode(collider, left_node);
 			continue;
 		}
 
-		// 右子ノードに内包される
-		if(CheckNodeContainsCollider(collider, right_node))
+		// 無効化されているコライダーはツリーに無い
+		const auto it_proxy = collider_proxy_map.find(collider);
+		if (it_proxy == collider_proxy_map.end())
 		{
-			// 親ノードから右子ノードにコライダーを移動
-			RemoveFromBelongingNode(it_collider);
-			AddColliderToNode(collider, right_node);
 			continue;
 		}
 
-		// *iteratorは左右子ノードどちらにも属さない
-		++it_collider;
+		const int bucket_index = it_proxy->second.bucket_index;
+		const int proxy_id = it_proxy->second.proxy_id;
+		const FRectAA& fat_aabb = _buckets[bucket_index].tree.GetFatAABB(proxy_id);
+		const FRectAA query_aabb = GetBroadphaseQueryAABB(collider, bucket_index, proxy_id);
+
+		// 連続衝突判定が有効な場合は, 移動経路全体のAABBでFilterInPlace()を通す
+		const FRectAA aabb = collider->GetSweptAABB();
+
+		for (int other_bucket_index = 0; other_bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++other_bucket_index)
+		{
+			if (!ShouldQueryBucket(collider, bucket_index, other_bucket_index))
+			{
+				continue;
+			}
+
+			// 複数のレイヤーを持つコライダーのバケットは, レイヤー行列をペアごとに調べる
+			const bool is_mixed = (bucket_index == CollisionLayerMatrix::MIXED_BUCKET || other_bucket_index == CollisionLayerMatrix::MIXED_BUCKET);
+			auto should_collide = [this, collider, is_mixed](const ColliderBase* const other_collider)
+				{
+					return !is_mixed || _layer_matrix.ShouldCollide(
+						static_cast<CollisionObjectType_UnderlyingType>(collider->GetCollisionObjectType()),
+						static_cast<CollisionObjectType_UnderlyingType>(other_collider->GetCollisionObjectType())
+					);
+				};
+
+			const DynamicAABBTree& other_tree = _buckets[other_bucket_index].tree;
+			other_tree.Query(query_aabb, [this, collider, bucket_index, proxy_id, other_bucket_index, &other_tree, &fat_aabb, &aabb, &should_collide](const int other_proxy_id)
+				{
+					ColliderBase* const other_collider = other_tree.GetCollider(other_proxy_id);
+					if (!should_collide(other_collider))
+					{
+						return true;
+					}
+
+					// 動的コライダー同士のペアは通常両方のリーフから見つかるので, (バケット, ID)の大きい方だけを採用する
+					// 連続衝突判定が有効なコライダーは探索範囲が広いので, 相手から見つからないペアはこちらで採用する
+					bool should_add = other_collider->IsStatic() || std::make_pair(other_bucket_index, other_proxy_id) > std::make_pair(bucket_index, proxy_id);
+					if (!should_add && (collider->IsContinuousCollisionEnabled() || other_collider->IsContinuousCollisionEnabled()))
+					{
+						should_add = !GeometricUtility::DoesAARectOverlapWithAnother(GetBroadphaseQueryAABB(other_collider, other_bucket_index, other_proxy_id), fat_aabb);
+					}
+
+					if (should_add)
+					{
+						_pair_buffer.Add(collider, aabb, other_collider, other_collider->GetSweptAABB());
+					}
+					return true;
+				});
+
+			_buckets[other_bucket_index].static_grid.Query(query_aabb, [this, collider, &aabb, &should_collide](ColliderBase* const static_collider, const FRectAA& static_aabb)
+				{
+					if (should_collide(static_collider))
+					{
+						_pair_buffer.Add(collider, aabb, static_collider, static_aabb);
+					}
+					return true;
+				});
+		}
 	}
 }
 
-void CollisionManager::DestructKdTree()
+FRectAA CollisionManager::GetBroadphaseQueryAABB(const ColliderBase* const collider, const int bucket_index, const int proxy_id) const
 {
-	if (!IsTreeConstructed())
+	const FRectAA& fat_aabb = _buckets[bucket_index].tree.GetFatAABB(proxy_id);
+	if (!collider->IsContinuousCollisionEnabled())
 	{
-		return;
+		return fat_aabb;
 	}
-
-	DestroyKdNodesRecursively(_root_node);
-	kd_nodes.clear();
-	kd_nodes.shrink_to_fit();
-	collider_node_map.clear();
+	return GeometricUtility::GetAARectUnion(fat_aabb, collider->GetSweptAABB());
 }
 
-void CollisionManager::ReConstructKdTree()
+void CollisionManager::PreparePairs()
 {
-	if (!IsTreeConstructed())
-	{
-		return;
-	}
-	const Vector2D area_left_top = _root_node->GetAreaLeftTop();
-	const Vector2D area_right_bottom = _root_node->GetAreaRightBottom();
-	DestructKdTree();
-	ConstructKdTree(area_left_top, area_right_bottom);
-	return;
+	FlushPendingProxyMoves();
+	FindCandidatePairs();
+	_stats.num_candidate_pairs = _pair_buffer.Size();
+	_stats.num_filtered_pairs = _pair_buffer.FilterInPlace();
+
+	// 列挙順はツリーの形状に依存するので, コライダーの通し番号順に並べ替えて処理順を一定にする
+	_pair_buffer.GetSortedOrder(_pair_order);
 }
 
-void CollisionManager::ReConstructKdTree(const Vector2D& new_area_left_top, const Vector2D& new_area_right_bottom)
+void CollisionManager::RunNarrowPhase()
 {
-	if (!IsTreeConstructed())
+	_hit_results.clear();
+
+	if (_thread_pool)
 	{
+		RunNarrowPhaseParallel();
 		return;
 	}
 
-	DestructKdTree();
-	ConstructKdTree(new_area_left_top, new_area_right_bottom);
-}
-
-
-void CollisionManager::HandleCollisions()
-{
-	for (auto& node : kd_nodes)
+	for (const int pair_index : _pair_order)
 	{
-		if (!node)
+		HitResult hit_result;
+		if (CheckPairHit(pair_index, hit_result))
 		{
-			continue;
+			_hit_results.push_back(hit_result);
 		}
-		HandleCollisionsBetweenNodes(node, node);
 	}
 }
 
-void CollisionManager::HandleCollisionsBetweenNodes(const KdNode* fixed_node, const KdNode* root_of_targets)
+void CollisionManager::RunNarrowPhaseParallel()
 {
-	if (!fixed_node || !root_of_targets) return;
-
-	if (root_of_targets->left_node && root_of_targets->right_node)
+	const int num_threads = _thread_pool->GetNumThreads();
+	_narrowphase_thread_buffers.resize(num_threads);
+	for (auto& buffer : _narrowphase_thread_buffers)
 	{
-		HandleCollisionsBetweenNodes(fixed_node, root_of_targets->left_node);
-		HandleCollisionsBetweenNodes(fixed_node, root_of_targets->right_node);
+		buffer.hits.clear();
 	}
 
-	if (fixed_node == root_of_targets)
-	{
-		// 1ノードに属するコライダーの全組み合わせ
-		std::vector<ColliderBase*> fixed_colliders = fixed_node->colliders;
-		for (auto iterator = fixed_colliders.begin(); iterator != fixed_colliders.end(); ++iterator)
+	// 各スレッドは担当したペアの結果を自分のバッファにだけ書き込む
+	_thread_pool->ParallelFor(
+		static_cast<int>(_pair_order.size()),
+		NARROWPHASE_CHUNK_SIZE,
+		[this](const int begin, const int end, const int thread_index)
 		{
-			for (auto sub_iterator = iterator + 1; sub_iterator != fixed_colliders.end(); ++sub_iterator)
+			auto& hits = _narrowphase_thread_buffers[thread_index].hits;
+			for (int i = begin; i < end; ++i)
 			{
-				(*iterator)->HandleCollisionWith(*sub_iterator);
-			}
-		}
-	}
-	else
-	{
-		// 異なる2ノードに属するコライダーの全組み合わせ
-		std::vector<ColliderBase*> fixed_colliders = fixed_node->colliders;
-		std::vector<ColliderBase*> target_colliders = root_of_targets->colliders;
-		for (auto& collider1 : fixed_colliders)
-		{
-			for (auto& collider2 : target_colliders)
-			{
-				collider1->HandleCollisionWith(collider2);
+				HitResult hit_result;
+				if (CheckPairHit(_pair_order[i], hit_result))
+				{
+					hits.emplace_back(i, hit_result);
+				}
 			}
-		}
-	}
-}
+		});
 
-void CollisionManager::OnNewColliderInitialized(ColliderBase* new_collider)
-{
-	if (!new_collider)
+	// どのスレッドがどのタスクを処理したかに依らないよう, _pair_order上の位置で並べ直す
+	std::vector<std::pair<int, HitResult>>& merged_hits = _narrowphase_thread_buffers[0].hits;
+	for (int thread_index = 1; thread_index < num_threads; ++thread_index)
 	{
-		return;
+		const auto& hits = _narrowphase_thread_buffers[thread_index].hits;
+		merged_hits.insert(merged_hits.end(), hits.begin(), hits.end());
 	}
+	std::sort(merged_hits.begin(), merged_hits.end(), [](const auto& lhs, const auto& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
 
-	all_colliders.push_back(new_collider);
-
-	if (IsTreeConstructed())
+	for (const auto& hit : merged_hits)
 	{
-		// ツリーから新コライダーを内包するノードを探す
-		KdNode* const new_collider_node = FindNode(new_collider);
-		AddColliderToNode(new_collider, new_collider_node);
+		_hit_results.push_back(hit.second);
 	}
 }
 
-void CollisionManager::DestroyKdNodesRecursively(KdNode*& current_node)
+bool CollisionManager::CheckPairHit(const int pair_index, HitResult& out_hit_result) const
 {
-	if (current_node->left_node != nullptr)
-	{
-		DestroyKdNodesRecursively(current_node->left_node);
-	}
-	if (current_node->right_node != nullptr)
+	const ColliderBase* const collider_a = _pair_buffer.collider_a[pair_index];
+	const ColliderBase* const collider_b = _pair_buffer.collider_b[pair_index];
+
+	if (!collider_a->ShouldCheckHitWith(collider_b))
 	{
-		DestroyKdNodesRecursively(current_node->right_node);
+		return false;
 	}
 
-	delete current_node;
-	current_node = nullptr;
+	CheckHitWithSweep(out_hit_result, collider_a, collider_b);
+	return out_hit_result.has_hit;
 }
 
-void CollisionManager::OnColliderFinalize(ColliderBase* collider)
+void CollisionManager::CheckHitWithSweep(HitResult& out_result_for_self, const ColliderBase* const self_collider, const ColliderBase* const other_collider)
 {
-
-	// 破壊されるコライダーを所属ノードから削除
-	RemoveFromBelongingNode(collider);
-
-	auto it_collider = std::find(all_colliders.begin(), all_colliders.end(), collider);
-	if(it_collider != all_colliders.end())
+	self_collider->CheckHitWith(out_result_for_self, other_collider);
+	if (out_result_for_self.has_hit)
 	{
-		all_colliders.erase(it_collider);
+		return;
 	}
-}
 
-void CollisionManager::DrawCells(const CameraParams& camera_params, const uint8_t node_depth) const
-{
-	if (node_depth > MAX_TREE_DEPTH)
+	// 現在位置で重なっていなくても, 移動経路上で接触していれば衝突とする
+	if (self_collider->IsContinuousCollisionEnabled() || other_collider->IsContinuousCollisionEnabled())
 	{
-		return;
+		self_collider->CheckSweptHitWith(out_result_for_self, other_collider);
 	}
-	const int line_thickness = ceil(camera_params.screen_scale);
-	constexpr const int color = 0x00FFFF;
-	
-	if (_root_node)
-	{
-		// ルートノードセルの描画
-		int cell_left, cell_top, cell_right, cell_bottom;
-		(Vector2D::WorldToViewport(_root_node->cell_left_top, camera_params)).ToIntRound(cell_left, cell_top);
-		(Vector2D::WorldToViewport(_root_node->cell_right_bottom, camera_params)).ToIntRound(cell_right, cell_bottom);
-		DrawBoxAA(cell_left, cell_top, cell_right, cell_bottom, color, false, line_thickness);
-		
-		DrawCircle(cell_left, cell_top, 3, color, true);
-		const tstring text_left_top = _T("RootNode-LeftTop");
-		const int draw_str_left = cell_left - GetDrawStringWidth(text_left_top.c_str(), strlenDx(text_left_top.c_str())) / 2;
-		const int draw_str_top = cell_top - GetFontSize();
-		DrawString(draw_str_left, draw_str_top, text_left_top.c_str(), color);
+}
 
-		const tstring text_right_bottom = _T("RootNode-RightBottom");
-		const int draw_str_right = cell_right - GetDrawStringWidth(text_right_bottom.c_str(), strlenDx(text_right_bottom.c_str())) / 2;
-		const int draw_str_bottom = cell_bottom + GetFontSize();
-		DrawString(draw_str_right, draw_str_bottom, text_right_bottom.c_str(), color);
-	}
+void CollisionManager::ResolveHits()
+{
+	_pushed_actors.clear();
 
-	for (const auto& node : kd_nodes)
+	for (const HitResult& hit_result : _hit_results)
 	{
-		if(node)
+		const ColliderBase* const self_collider = hit_result.self_collider;
+		const ColliderBase* const other_collider = hit_result.other_collider;
+
+		// 先に処理した衝突のOnHitCollision()で無効化された場合など
+		if (!self_collider->ShouldCheckHitWith(other_collider))
 		{
-			DrawPartition(node, camera_params, color);
+			continue;
 		}
-	}
 
-	return;
-	
-	// 指定された深さのノードの内, ツリーで最も左,最も右にあるノード
-	const uint8_t left_most_node_number = pow(2, node_depth) - 1;
-	const uint8_t right_most_node_number = pow(2, node_depth + 1) - 2;
-
-	for (int i = 0; i <= right_most_node_number; i++)
-	{
-		const KdNode* const node = kd_nodes.at(i);
-		if (node)
+		// 押し戻しで動いたアクターの判定結果は古くなっているので, 判定し直す
+		HitResult updated_hit_result;
+		const HitResult* hit_result_to_handle = &hit_result;
+		if (IsPushedInThisResolve(self_collider->GetOwnerActor()) || IsPushedInThisResolve(other_collider->GetOwnerActor()))
 		{
-			int x1, y1, x2, y2;
+			CheckHitWithSweep(updated_hit_result, self_collider, other_collider);
+			if (!updated_hit_result.has_hit)
+			{
+				continue;
+			}
+			hit_result_to_handle = &updated_hit_result;
+		}
 
-			(Vector2D::WorldToViewport(node->cell_left_top, camera_params)).ToIntRound(x1, y1);
-			(Vector2D::WorldToViewport(node->cell_right_bottom, camera_params)).ToIntRound(x2, y2);
-			DrawBoxAA(x1, y1, x2, y2, color, false, line_thickness);
+		const bool has_executed_pushback = self_collider->HandleHitResult(*hit_result_to_handle);
+		if (has_executed_pushback)
+		{
+			_pushed_actors.push_back(self_collider->GetOwnerActor());
+			_pushed_actors.push_back(other_collider->GetOwnerActor());
 		}
 	}
 }
 
-void GetOverlappingCollidersImpl(std::vector<ColliderBase*>& out_overlapping_colliders, const KdNode* const node, ColliderBase* const target_collider, const bool check_descendant_nodes = false)
+void CollisionManager::SetNumNarrowPhaseThreads(const int num_threads)
 {
-	if (check_descendant_nodes && node->HasChildNode())
+	if (num_threads == GetNumNarrowPhaseThreads())
 	{
-		GetOverlappingCollidersImpl(out_overlapping_colliders, node->GetLeftChildNode(), target_collider, true);
-		GetOverlappingCollidersImpl(out_overlapping_colliders, node->GetRightChildNode(), target_collider, true);
+		return;
 	}
 
-	const std::vector<ColliderBase*>& colliders_in_node = node->colliders;
-	for (const auto& other_collider : colliders_in_node)
+	_thread_pool.reset();
+	if (num_threads > 1)
 	{
-		if (other_collider == target_collider)
-		{
-			continue;
-		}
-		if (target_collider->IsOverlappingWith(other_collider))
-		{
-			out_overlapping_colliders.push_back(other_collider);
-		}
+		_thread_pool = std::make_unique<WorkStealingThreadPool>(num_threads);
 	}
 }
 
-void CollisionManager::GetOverlappingColliders(std::vector<ColliderBase*>& out_overlapping_colliders, ColliderBase* const target_collider) const
+int CollisionManager::GetNumNarrowPhaseThreads() const
 {
-	if (target_collider->GetCollisionType() != CollisionType::OVERLAP)
+	return _thread_pool ? _thread_pool->GetNumThreads() : 1;
+}
+
+bool CollisionManager::DEBUG_VerifyParallelNarrowPhase(const int num_threads)
+{
+	if (!IsTreeConstructed())
 	{
-		return;
+		return true;
 	}
 
-	const KdNode* target_node = collider_node_map.at(target_collider);
+	const int original_num_threads = GetNumNarrowPhaseThreads();
+	PreparePairs();
 
-	// 1. target_colliderが所属するノードと, その子孫ノード
-	GetOverlappingCollidersImpl(out_overlapping_colliders, target_node, target_collider, true);
+	SetNumNarrowPhaseThreads(1);
+	RunNarrowPhase();
+	const std::vector<HitResult> serial_hit_results = _hit_results;
 
-	// 2. 祖先ノード
-	uint8_t target_node_index = target_node->GetNodeIndex();
-	// target_nodeがルートノードでなければ祖先ノードについて調べる
-	if (target_node_index != 0)
-	{
-		uint8_t parent_node_index = (target_node_index - 1) / 2;
-		while (true)
-		{
-			GetOverlappingCollidersImpl(out_overlapping_colliders, kd_nodes.at(parent_node_index), target_collider, false);
+	SetNumNarrowPhaseThreads(num_threads);
+	RunNarrowPhase();
+	const bool is_same = std::equal(
+		serial_hit_results.begin(), serial_hit_results.end(),
+		_hit_results.begin(), _hit_results.end(),
+		AreHitResultsEqual
+	);
 
-			if (parent_node_index == 0)
-			{
-				// ルートに到達したらループを抜ける
-				break;
-			}
-			else
-			{
-				// 親の親についても調べる
-				parent_node_index = (parent_node_index - 1) / 2;
-			}
-		}
-	}
+	SetNumNarrowPhaseThreads(original_num_threads);
+	_hit_results.clear();
+	return is_same;
+}
+
+bool CollisionManager::IsPushedInThisResolve(const Actor* actor) const
+{
+	// 1フレームに押し戻しが起こるペアは少ないので線形探索で十分
+	return std::find(_pushed_actors.begin(), _pushed_actors.end(), actor) != _pushed_actors.end();
 }
 
-void CollisionManager::FindOverlappingNodesRecursively(std::vector<KdNode*>& out_intersected_nodes, KdNode* node, const FSegment& segment) const
+void CollisionManager::DrawTree(const CameraParams& camera_params, const int max_depth) const
 {
-	if (!node)
+	const int line_thickness = ceil(camera_params.screen_scale);
+	constexpr const int node_color = 0x00FFFF;
+	constexpr const int leaf_color = 0xFFFF00;
+
+	for (const BroadphaseBucket& bucket : _buckets)
 	{
-		return;
+		bucket.tree.VisitNodes([&camera_params, max_depth, line_thickness](const FRectAA& aabb, const int depth, const bool is_leaf)
+			{
+				if (depth > max_depth)
+				{
+					return;
+				}
+
+				int left, top, right, bottom;
+				(Vector2D::WorldToViewport(aabb.left_top, camera_params)).ToIntRound(left, top);
+				(Vector2D::WorldToViewport(aabb.right_bottom, camera_params)).ToIntRound(right, bottom);
+				DrawBoxAA(left, top, right, bottom, is_leaf ? leaf_color : node_color, false, line_thickness);
+			});
 	}
-	
-	if (IsOverlapping(node, segment))
+}
+
+void CollisionManager::GetLeafDepthHistogram(std::vector<int>& out_num_leaves_per_depth) const
+{
+	out_num_leaves_per_depth.clear();
+	for (const BroadphaseBucket& bucket : _buckets)
 	{
-		out_intersected_nodes.push_back(node);
+		bucket.tree.VisitNodes([&out_num_leaves_per_depth](const FRectAA&, const int depth, const bool is_leaf)
+			{
+				if (!is_leaf)
+				{
+					return;
+				}
 
-		if (node->HasChildNode()) 
-		{
-			FindOverlappingNodesRecursively(out_intersected_nodes, node->GetLeftChildNode(), segment);
-			FindOverlappingNodesRecursively(out_intersected_nodes, node->GetRightChildNode(), segment);
-		}
+				if (static_cast<int>(out_num_leaves_per_depth.size()) <= depth)
+				{
+					out_num_leaves_per_depth.resize(depth + 1, 0);
+				}
+				++out_num_leaves_per_depth[depth];
+			});
 	}
 }
 
-void CollisionManager::FindOverlappingNodesRecursively(std::vector<KdNode*>& out_intersected_nodes, KdNode* node, const FRectAA& rect) const
+void CollisionManager::GetOverlappingColliders(std::vector<ColliderBase*>& out_overlapping_colliders, ColliderBase* const target_collider)
 {
-	if (!IsTreeConstructed() ||  !node)
+	if (target_collider->GetCollisionType() != CollisionType::OVERLAP || !IsTreeConstructed())
 	{
 		return;
 	}
 
-	if (IsOverlapping(node, rect))
-	{
-		out_intersected_nodes.push_back(node);
+	FlushPendingProxyMoves();
 
-		if (node->HasChildNode())
+	auto add_if_overlapping = [&out_overlapping_colliders, target_collider](ColliderBase* const other_collider)
 		{
-			FindOverlappingNodesRecursively(out_intersected_nodes, node->GetLeftChildNode(), rect);
-			FindOverlappingNodesRecursively(out_intersected_nodes, node->GetRightChildNode(), rect);
-		}
-	}
-}
-
-bool CollisionManager::IsOverlapping(const KdNode* const node, const FSegment& segment) const
-{
-	const FRectAA rect{ node->GetAreaLeftTop(), node->GetAreaRightBottom() };
+			if (other_collider != target_collider && target_collider->IsOverlappingWith(other_collider))
+			{
+				out_overlapping_colliders.push_back(other_collider);
+			}
+			return true;
+		};
 
-	const bool is_segment_contained = GeometricUtility::DoesAARectContainSegment(rect, segment);
-	if (is_segment_contained)
+	const FRectAA& target_aabb = target_collider->GetWorldAABB();
+	const int bucket_index = CollisionLayerMatrix::GetBucketIndex(target_collider->GetCollisionObjectType());
+	for (int other_bucket_index = 0; other_bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++other_bucket_index)
 	{
-		return true;
-	}
-	
-	const int num_intersections = GeometricUtility::GetSegmentAARectIntersections(segment, rect);
-	return num_intersections > 0;
-}
+		if (!ShouldQueryBucket(target_collider, bucket_index, other_bucket_index))
+		{
+			continue;
+		}
 
-bool CollisionManager::IsOverlapping(const KdNode* const node, const FRectAA& rect) const
-{
-	const FRectAA node_rect{ node->GetAreaLeftTop(), node->GetAreaRightBottom() };
-	return GeometricUtility::DoesAARectOverlapWithAnother(node_rect, rect);
+		const BroadphaseBucket& bucket = _buckets[other_bucket_index];
+		bucket.tree.Query(target_aabb, [&bucket, &add_if_overlapping](const int proxy_id)
+			{
+				return add_if_overlapping(bucket.tree.GetCollider(proxy_id));
+			});
+		bucket.static_grid.Query(target_aabb, [&add_if_overlapping](ColliderBase* const static_collider, const FRectAA&)
+			{
+				return add_if_overlapping(static_collider);
+			});
+	}
 }
 
-int CollisionManager::DEBUG_GetNodeIndex(ColliderBase* collider)
+int CollisionManager::DEBUG_GetProxyId(ColliderBase* collider) const
 {
-	auto it = collider_node_map.find(collider);
-	if (it == collider_node_map.end())
+	auto it = collider_proxy_map.find(collider);
+	if (it == collider_proxy_map.end())
 	{
 		return -1;
 	}
 
-	return it->second->node_index;
+	return it->second.proxy_id;
 }
 
-
 void CollisionManager::SingleLineTrace(QueryResult_SingleLineTrace& out_query_result, const CollisionQueryParams_SingleLineTrace& query_params)
 {
 	if (!IsTreeConstructed())
@@ -718,132 +902,137 @@ void CollisionManager::SingleLineTrace(QueryResult_SingleLineTrace& out_query_re
 		return;
 	}
 
-	out_query_result = QueryResult_SingleLineTrace{};
+	FlushPendingProxyMoves();
 
-	// ラインと交差するノードを取得
-	std::vector<KdNode*> intersected_nodes = {};
-	FindOverlappingNodesRecursively(intersected_nodes, _root_node, query_params.segment);
+	out_query_result = QueryResult_SingleLineTrace{};
+	out_query_result.has_hit = false;
 
-	// 取得したノード内のコライダーとラインの交差をチェック
-	std::vector<QueryResult_SingleLineTrace> results = {};
-	for (auto& node : intersected_nodes)
+	// 複数のツリーと静的グリッドを調べるので, 最も近いヒットの位置はここで保持する
+	float closest_fraction = 1.f;
+	for (int bucket_index = 0; bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++bucket_index)
 	{
-		for (auto& collider : node->colliders)
+		// ヒット対象のオブジェクトタイプを含まないバケットは調べない
+		if ((query_params.hit_object_types & CollisionLayerMatrix::GetBucketObjectTypes(bucket_index)) == 0)
 		{
-			QueryResult_SingleLineTrace result{};
-			collider->RespondToSingleLineTrace(result, query_params);
-			if (result.has_hit)
-			{
-				results.push_back(result);
-
-				if (result.hit_location.IsZeroVector())
-				{
-					int x = 0;
-				}
-			}
+			continue;
 		}
-	}
 
-	if (results.empty())
-	{
-		out_query_result.has_hit = false;
-		return;
-	}
-	else
-	{
-		// 結果をソート
-		std::sort(results.begin(), results.end(), [&query_params](const QueryResult_SingleLineTrace& a, const QueryResult_SingleLineTrace& b)
+		const BroadphaseBucket& bucket = _buckets[bucket_index];
+		bucket.tree.RayCast(query_params.segment, [&bucket, &out_query_result, &query_params, &closest_fraction](const int proxy_id, const float max_fraction)
 			{
-				const Vector2D& loc_a = a.hit_location;
-				const Vector2D& loc_b = b.hit_location;
-				return (loc_a - query_params.segment.start).LengthSquared() < (loc_b - query_params.segment.start).LengthSquared();
+				return UpdateClosestLineTraceHit(out_query_result, closest_fraction, bucket.tree.GetCollider(proxy_id), query_params, max_fraction);
 			});
-
-		// ラインの始点から最も近いコライダーの結果を採用
-		out_query_result = results.at(0);
+		if (out_query_result.has_hit && closest_fraction <= 0.f)
+		{
+			// 始点でヒットしている
+			return;
+		}
+		bucket.static_grid.RayCast(query_params.segment, [&out_query_result, &query_params, &closest_fraction](ColliderBase* const collider, const float max_fraction)
+			{
+				return UpdateClosestLineTraceHit(out_query_result, closest_fraction, collider, query_params, max_fraction);
+			});
+		if (out_query_result.has_hit && closest_fraction <= 0.f)
+		{
+			return;
+		}
 	}
 }
 
-void CollisionManager::MultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params)
+void CollisionManager::BatchedSingleLineTrace(QueryResult_SingleLineTrace* const out_query_results, const CollisionQueryParams_SingleLineTrace* const queries, const int num_queries)
 {
 	if (!IsTreeConstructed())
 	{
 		return;
 	}
 
-	query_result = QueryResult_MultiAARectTrace{};
-
-	// クエリの矩形と重なっているノードを取得
-	std::vector<KdNode*> overlapping_nodes = {};
-	FindOverlappingNodesRecursively(overlapping_nodes, _root_node, query_params.rect);
+	FlushPendingProxyMoves();
 
-	for (auto& node : overlapping_nodes)
+	// ツリーの一括走査で扱える本数ずつ処理する
+	constexpr int BATCH_SIZE = DynamicAABBTree::MAX_BATCH_RAYS;
+	for (int batch_begin = 0; batch_begin < num_queries; batch_begin += BATCH_SIZE)
 	{
-		for (auto& collider : node->colliders)
+		const int batch_size = (std::min)(BATCH_SIZE, num_queries - batch_begin);
+		QueryResult_SingleLineTrace* const batch_results = out_query_results + batch_begin;
+		const CollisionQueryParams_SingleLineTrace* const batch_queries = queries + batch_begin;
+
+		std::array<FSegment, BATCH_SIZE> segments;
+		std::array<float, BATCH_SIZE> closest_fractions;
+		CollisionObjectType_UnderlyingType batch_hit_object_types = 0;
+		for (int i = 0; i < batch_size; ++i)
 		{
-			collider->RespondToMultiAARectTrace(query_result, query_params);
+			batch_results[i] = QueryResult_SingleLineTrace{};
+			batch_results[i].has_hit = false;
+			segments[i] = batch_queries[i].segment;
+			closest_fractions[i] = 1.f;
+			batch_hit_object_types |= batch_queries[i].hit_object_types;
 		}
-	}
-
-	query_result.has_hit = !query_result.hit_colliders.empty();
-}
 
-bool CollisionManager::ShouldSplitNode(const KdNode* const node)
-{
-	return node->GetCollidersNum() >= MIN_COLLIDERS_PER_NODE && node->depth < MAX_TREE_DEPTH;
-}
+		for (int bucket_index = 0; bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++bucket_index)
+		{
+			// どの線分のヒット対象も含まないバケットは調べない
+			if ((batch_hit_object_types & CollisionLayerMatrix::GetBucketObjectTypes(bucket_index)) == 0)
+			{
+				continue;
+			}
 
-void CollisionManager::AddColliderToNode(ColliderBase* const collider, KdNode* const node)
-{
-	node->AddCollider(collider);
+			const BroadphaseBucket& bucket = _buckets[bucket_index];
+			bucket.tree.RayCastBatch(segments.data(), batch_size,
+				[&bucket, batch_results, batch_queries, &closest_fractions](const int proxy_id, const int ray_index, const float max_fraction)
+				{
+					return UpdateClosestLineTraceHit(batch_results[ray_index], closest_fractions[ray_index], bucket.tree.GetCollider(proxy_id), batch_queries[ray_index], max_fraction);
+				});
 
-	//マッピング情報を登録
-	collider_node_map[collider] = node;
-}
+			// 静的グリッドは線分ごとにセルを辿る. ツリーで見つかったヒットより遠いセルは調べない
+			for (int i = 0; i < batch_size; ++i)
+			{
+				QueryResult_SingleLineTrace& result = batch_results[i];
+				float& closest_fraction = closest_fractions[i];
+				if (result.has_hit && closest_fraction <= 0.f)
+				{
+					continue;
+				}
 
-void CollisionManager::RemoveFromBelongingNode(ColliderBase* collider)
-{
-	// ツリーが破壊済みであれば何もする必要がない
-	if (!IsTreeConstructed())
-	{
-		return;
+				const CollisionQueryParams_SingleLineTrace& query_params = batch_queries[i];
+				bucket.static_grid.RayCast(query_params.segment, [&result, &query_params, &closest_fraction](ColliderBase* const collider, const float max_fraction)
+					{
+						return UpdateClosestLineTraceHit(result, closest_fraction, collider, query_params, max_fraction);
+					});
+			}
+		}
 	}
-
-	KdNode* const belonging_node = collider_node_map.at(collider);
-	collider_node_map.erase(collider);
-	belonging_node->EraseCollider(collider);
 }
 
-void CollisionManager::RemoveFromBelongingNode(std::vector<ColliderBase*>::const_iterator& it_collider)
+void CollisionManager::MultiAARectTrace(QueryResult_MultiAARectTrace& query_result, const CollisionQueryParams_RectAA& query_params)
 {
 	if (!IsTreeConstructed())
 	{
 		return;
 	}
 
-	KdNode* const belonging_node = collider_node_map.at(*it_collider);
-	collider_node_map.erase(*it_collider);
-	it_collider = belonging_node->EraseCollider(*it_collider);
-}
+	FlushPendingProxyMoves();
 
-void CollisionManager::SortCollidersAlongAxis(std::vector<ColliderBase*>& colliders, const Axis axis) const
-{
-	// axisがX軸の場合、外接AABBの左側のX座標を基準に昇順ソートする (左から右)
-	// axisがY軸の場合、外接AABBの上側のY座標を基準に昇順ソートする (上から下)
-	std::sort(colliders.begin(), colliders.end(),
-		[axis](ColliderBase* collider1, ColliderBase* collider2)
+	query_result = QueryResult_MultiAARectTrace{};
+
+	// ヒット対象のオブジェクトタイプを含むバケットの, クエリの矩形とfat AABB(静的グリッドの場合はAABB)が重なっているコライダーだけを調べる
+	for (int bucket_index = 0; bucket_index < CollisionLayerMatrix::NUM_BUCKETS; ++bucket_index)
 	{
-		Vector2D aabb1_left_top, aabb2_left_top, dummy;
-		collider1->GetAABB(aabb1_left_top, dummy);
-		collider2->GetAABB(aabb2_left_top, dummy);
-		if (axis == Axis::X)
+		if ((query_params.hit_object_types & CollisionLayerMatrix::GetBucketObjectTypes(bucket_index)) == 0)
 		{
-			return aabb1_left_top.x < aabb2_left_top.x;
-		}
-		
-		if (axis == Axis::Y)
-		{
-			return aabb1_left_top.y < aabb2_left_top.y;
+			continue;
 		}
-	});
+
+		const BroadphaseBucket& bucket = _buckets[bucket_index];
+		bucket.tree.Query(query_params.rect, [&bucket, &query_result, &query_params](const int proxy_id)
+			{
+				bucket.tree.GetCollider(proxy_id)->RespondToMultiAARectTrace(query_result, query_params);
+				return true;
+			});
+		bucket.static_grid.Query(query_params.rect, [&query_result, &query_params](ColliderBase* const collider, const FRectAA&)
+			{
+				collider->RespondToMultiAARectTrace(query_result, query_params);
+				return true;
+			});
+	}
+
+	query_result.has_hit = !query_result.hit_colliders.empty();
 }
@@ -2,32 +2,35 @@
 
 #include "Core.h"
 #include "Component/Collider/HitResult.h"
+#include "GameSystems/Collision/DynamicAABBTree.h"
+#include "GameSystems/Collision/StaticColliderGrid.h"
+#include "GameSystems/Collision/CollisionPairBuffer.h"
+#include "GameSystems/Collision/CollisionLayerMatrix.h"
+#include "Utility/Core/Threading/WorkStealingThreadPool.h"
 #include <vector>
+#include <array>
 #include <unordered_map>
 #include <unordered_set>
+#include <climits>
 
 class ColliderBase;
 class Actor;
-struct KdNode;
-
-enum class Axis { X, Y };
 
 /// <summary>
 /// コリジョン管理クラス
 /// <para>コリジョンの検出, 衝突判定を行う</para>
+/// <para>ブロードフェーズには動的AABBツリーを使う. コライダーの移動はツリーの局所的な更新で反映されるので, 再構築は不要</para>
+/// <para>ツリー構築時にSTATICなコライダーは静的グリッドに登録し, 動的コライダーからの問い合わせにのみ使う</para>
+/// <para>衝突処理は, 候補ペアの列挙(ブロードフェーズ), 衝突判定(ナローフェーズ), 衝突結果の処理(解決)の3段階で行う</para>
+/// <para>ナローフェーズは任意でマルチスレッド化できる. 解決はメインスレッドで, シングルスレッドの場合と同じ順序で行う</para>
+/// <para>連続衝突判定が有効なコライダーは, 前回のHandleCollisions()からの移動経路全体で候補ペアを探し, 離散判定で衝突しなければ掃引判定を行う</para>
+/// <para>ツリーと静的グリッドはレイヤー(CollisionObjectTypeの分類)ごとのバケットに分けて持ち, レイヤー行列で衝突し得ないバケット同士は探索しない</para>
+/// <para>無効化されたコライダーはブロードフェーズから外し, 有効化されたときに戻す</para>
+/// <para>コライダーの移動は保留しておき, 衝突処理とクエリの前にまとめてツリーに反映する. 1フレームに何度動いても, ツリーの更新はコライダーごとに1回になる</para>
 /// </summary>
 class CollisionManager
 {
 public:
-	// k-dツリーの木の最大深さ. ルートは深さ0.
-	static constexpr int MAX_TREE_DEPTH = 4;
-
-	// k-dツリーのノードの数の最大値. コライダー数が少ない場合はこの数に満たないこともある.
-	static constexpr int MAX_NUM_NODES = (1 << (MAX_TREE_DEPTH + 1)) - 1;
-
-	// ノードを分割するのに最低限必要なコライダー数. 深さが最大に達していなくても所属コライダー数がこの数を下回ったらそれ以上分割しない.
-	static constexpr const int MIN_COLLIDERS_PER_NODE = 4;
-
 	static CollisionManager& GetInstance()
 	{
 		static CollisionManager instance;
@@ -35,7 +38,12 @@ public:
 	}
 private:
 	CollisionManager()
-		: _root_node(nullptr)
+		: _is_tree_constructed(false)
+		, _next_serial_number(1)
+		, _num_reinserted_proxies_in_frame(0)
+		, _num_transform_notifications_in_frame(0)
+		, _num_moved_proxies_in_frame(0)
+		, _stats{}
 	{}
 	~CollisionManager() {}
 
@@ -46,6 +54,51 @@ private:
 	CollisionManager& operator=(CollisionManager&&) = delete;
 
 public:
+	/// <summary>
+	/// 衝突処理の統計情報. HandleCollisions()の度に更新される
+	/// </summary>
+	struct CollisionStats
+	{
+		// ツリーに登録されているコライダー数
+		int num_proxies;
+
+		// バケットごとのツリーの高さの最大値
+		int tree_height;
+
+		// 直近のHandleCollisions()で生成された候補ペア数
+		int num_candidate_pairs;
+
+		// 直近のHandleCollisions()までの1フレームでツリーに再挿入されたコライダー数
+		int num_reinserted_proxies;
+
+		// 直近のHandleCollisions()までの1フレームでOnColliderTransformed()が呼ばれた回数と, そのうちツリーに反映したコライダー数
+		int num_transform_notifications;
+		int num_moved_proxies;
+
+		// 静的グリッドに登録されているコライダー数
+		int num_static_colliders;
+
+		// 無効化されてブロードフェーズから外れている動的コライダー数
+		int num_inactive_colliders;
+
+		// 候補ペアのうち, 互いが衝突対象でAABBが重なっていたペア数
+		int num_filtered_pairs;
+
+		// ナローフェーズで衝突していたペア数
+		int num_hits;
+
+		// 衝突していたペアのうち, 連続衝突判定で検出されたペア数
+		int num_swept_hits;
+
+		// ナローフェーズのスレッド数
+		int num_narrowphase_threads;
+
+		// 各段階の処理時間 [ms]
+		double broadphase_ms;
+		double narrowphase_ms;
+		double resolve_ms;
+	};
+
 	void Initialize();
 
 	/// <summary>
@@ -54,32 +107,22 @@ public:
 	void Finalize();
 
 	/// <summary>
-	/// 領域を指定してKDツリーを構築する. 領域外のコライダーはルートノードに属すると判定される
-	/// </summary>
-	/// <param name="area_left_top">KD分割する領域の左上座標</param>
-	/// <param name="area_right_bottom">KD分割する領域の右下座標</param>
-	void ConstructKdTree(const Vector2D& area_left_top, const Vector2D& area_right_bottom);
-
-	// kdツリーの破壊
-	void DestructKdTree();
-
-	/// <summary>
-	/// 現在と同じ領域でKDツリーを再構築する.
+	/// ブロードフェーズのツリーを構築する.
+	/// <para>構築前に生成されたコライダーはここでまとめてツリーに挿入され, 以降に生成・移動したコライダーは逐次反映される</para>
+	/// <para>構築前に生成されたSTATICなコライダーはツリーではなく静的グリッドに登録される</para>
 	/// </summary>
-	void ReConstructKdTree();
+	void ConstructTree();
 
 	/// <summary>
-	/// 領域を変更してKDツリーを再構築する.
+	/// ツリーを破壊する. コライダーへの参照は保持される
 	/// </summary>
-	/// <param name="area_left_top"></param>
-	/// <param name="area_right_bottom"></param>
-	void ReConstructKdTree(const Vector2D& new_area_left_top, const Vector2D& new_area_right_bottom);
+	void DestructTree();
 
 	/// <summary>
 	/// ツリーが構築済みか否か
 	/// </summary>
 	/// <returns></returns>
-	bool IsTreeConstructed() const { return _root_node; }
+	bool IsTreeConstructed() const { return _is_tree_constructed; }
 
 	/// <summary>
 	/// 衝突判定と, 衝突結果の処理. シーンのTickから呼ぶ.
@@ -88,251 +131,325 @@ public:
 
 	/// <summary>
 	/// コライダーが生成されたときに行う処理.
-	/// <para>生成されたコライダーへの参照を保存し, コライダーが所属するノードを検索する</para>
+	/// <para>生成されたコライダーへの参照を保存し, ツリーが構築済みであればツリーに挿入する</para>
 	/// </summary>
 	/// <param name="new_collider"></param>
 	void OnNewColliderInitialized(ColliderBase* new_collider);
 
 	/// <summary>
-	/// コライダーをノードから削除し, collider_node_mapのマッピング情報も削除する
+	/// コライダーをツリーから削除し, コライダーへの参照を破棄する
 	/// </summary>
 	/// <param name="collider">削除対象</param>
 	void OnColliderFinalize(ColliderBase* const collider);
 
 	/// <summary>
 	/// コライダーが回転・移動した際に呼ばれる.
-	/// 所属中のノードが最適なノードでない場合, 所属ノードを再検索する.
+	/// ツリーへの反映は次の衝突処理かクエリまで保留し, その時点でAABBがfat AABBからはみ出していれば再挿入する.
+	/// <para>静的グリッドに登録されたコライダーが移動した場合は, すぐにグリッドから外してツリーに移す</para>
 	/// </summary>
 	/// <param name="collider">回転・移動したコライダー</param>
 	void OnColliderTransformed(ColliderBase* collider);
 
-	void DrawPartition(const KdNode* node, const CameraParams& camera_params, const int line_color) const;
+	/// <summary>
+	/// コライダーの可動性が変更された際に呼ばれる.
+	/// <para>DYNAMICになったコライダーが静的グリッドに登録されている場合は, グリッドから外してツリーに移す.</para>
+	/// <para>ツリー構築後にSTATICになったコライダーはツリーに残り, 静的コライダー同士のペアが除外されるだけ</para>
+	/// </summary>
+	void OnColliderMobilityChanged(ColliderBase* collider);
+
+	/// <summary>
+	/// コライダーの連続衝突判定の有効・無効が変更された際に呼ばれる
+	/// </summary>
+	void OnColliderContinuousCollisionChanged(ColliderBase* collider);
+
+	/// <summary>
+	/// コライダーが有効化・無効化された際に呼ばれる.
+	/// <para>無効化された動的コライダーはツリーから削除し, 静的グリッドのコライダーはグリッド上で無効化する. 有効化されたときに元に戻す</para>
+	/// </summary>
+	void OnColliderActiveChanged(ColliderBase* collider);
+
+	/// <summary>
+	/// コライダーのオブジェクトタイプが変更された際に呼ばれる. 別のバケットに移す必要があれば移す
+	/// <para>静的グリッドに登録されていたコライダーは, 新しいバケットのツリーに移る</para>
+	/// </summary>
+	/// <param name="collider">オブジェクトタイプが変更されたコライダー</param>
+	/// <param name="old_object_type">変更前のオブジェクトタイプ</param>
+	void OnColliderObjectTypeChanged(ColliderBase* collider, const CollisionObjectType old_object_type);
+
+	/// <summary>
+	/// コライダーの衝突対象が変更された際に呼ばれる. レイヤー行列が許していない組を追加する
+	/// </summary>
+	void OnColliderHitTargetsChanged(ColliderBase* collider);
 
 	/// <summary>
-	/// 指定された深さの各ノードのセルを描画する
+	/// レイヤー行列を設定する. 次のHandleCollisions()から使われる
+	/// <para>登録されている(と以降に登録される)コライダーの衝突対象の組は, 設定した行列に関わらず衝突し得るように追加される.
+	/// 全ての組を衝突し得ない状態の行列を設定すれば, コライダーの衝突対象だけから行列が作られる</para>
+	/// <para>Finalize()で全てのレイヤーが衝突し得る状態に戻るので, シーンごとに設定する</para>
+	/// </summary>
+	void SetLayerMatrix(const CollisionLayerMatrix& layer_matrix);
+	const CollisionLayerMatrix& GetLayerMatrix() const { return _layer_matrix; }
+
+	/// <summary>
+	/// ツリーのノードのAABBを描画する
 	/// </summary>
 	/// <param name="camera_params"></param>
-	/// <param name="nodes_depth">描画するノードの深さ</param>
-	void DrawCells(const CameraParams& camera_params, const uint8_t nodes_depth = 0) const;
+	/// <param name="max_depth">描画するノードの最大の深さ. ルートは0</param>
+	void DrawTree(const CameraParams& camera_params, const int max_depth = INT_MAX) const;
+
+	/// <summary>
+	/// ツリーの深さごとのリーフ数を全バケットについて合計する. ツリーの偏りの確認用
+	/// </summary>
+	/// <param name="out_num_leaves_per_depth">添え字が深さ(ルートは0). 最も深いリーフまでの大きさになる</param>
+	void GetLeafDepthHistogram(std::vector<int>& out_num_leaves_per_depth) const;
 
 	/// <summary>
 	/// target_colliderと重なっているコライダーを取得する
 	/// </summary>
 	/// <param name="out_overlapping_colliders">target_colliderと重なっているコライダーリスト</param>
 	/// <param name="target_collider">CollisionTypeがOverlapのコライダー</param>
-	void GetOverlappingColliders(std::vector<ColliderBase*>& out_overlapping_colliders, ColliderBase* const target_collider) const;
+	void GetOverlappingColliders(std::vector<ColliderBase*>& out_overlapping_colliders, ColliderBase* const target_collider);
+
+	const CollisionStats& GetStats() const { return _stats; }
 
 	/// <summary>
-	/// 線分と重なっているノードをすべて取得
+	/// ナローフェーズのスレッド数を設定する. デフォルトは1 (シングルスレッド)
+	/// <para>2以上を指定するとスレッドプールを生成し, 候補ペアの衝突判定を並列に行う</para>
 	/// </summary>
-	/// <param name="out_intersected_nodes">結果格納先</param>
-	/// <param name="node">対称ノード. このノードが結果に含まれ, 且つ子ノードを持つ場合は, 子ノードについても再帰的に探索する</param>
-	/// <param name="segment">線分</param>
-	/// <returns></returns>
-	void FindOverlappingNodesRecursively(std::vector<KdNode*>& out_intersected_nodes, KdNode* node, const FSegment& segment) const;
+	/// <param name="num_threads">メインスレッドを含むスレッド数</param>
+	void SetNumNarrowPhaseThreads(const int num_threads);
+	int GetNumNarrowPhaseThreads() const;
 
 	/// <summary>
-	/// 軸に平行な矩形と重なっているノードをすべて取得
+	/// 現在のコライダーの状態で, シングルスレッドとnum_threadsスレッドのナローフェーズの結果が一致するか調べる.
+	/// <para>衝突結果の処理は行わない</para>
 	/// </summary>
-	/// <param name="out_intersected_nodes">結果格納先</param>
-	/// <param name="node">対称ノード. このノードが結果に含まれ, 且つ子ノードを持つ場合は, 子ノードについても再帰的に探索する</param>
-	/// <param name="rect">軸に平行な矩形</param>
-	void FindOverlappingNodesRecursively(std::vector<KdNode*>& out_intersected_nodes, KdNode* node, const FRectAA& rect) const;
+	bool DEBUG_VerifyParallelNarrowPhase(const int num_threads);
+
+	int DEBUG_GetProxyId(ColliderBase* collider) const;
+
+	//クエリ系
+	void SingleLineTrace(QueryResult_SingleLineTrace& out_query_result, const CollisionQueryParams_SingleLineTrace& query_params);
 
 	/// <summary>
-	/// 線分がノードのエリアに重なっているか
+	/// 複数の線分についてSingleLineTrace()を行う. 結果はSingleLineTrace()を1本ずつ呼んだ場合と同じ
+	/// <para>ツリーの走査を全線分で共有し, 線分ごとに最も近いヒットだけを保持する. ヒープ確保は行わない</para>
 	/// </summary>
-	/// <param name="node">ノード</param>
-	/// <param name="segment">線分</param>
-	bool IsOverlapping(const KdNode* const node, const FSegment& segment) const;
+	/// <param name="out_query_results">線分ごとの結果. num_queries個の要素を持つ配列</param>
+	/// <param name="queries">線分ごとのクエリ. フィルタ(対象オブジェクトタイプ, 無視するアクター)も線分ごとに指定できる</param>
+	/// <param name="num_queries">線分の数</param>
+	void BatchedSingleLineTrace(QueryResult_SingleLineTrace* const out_query_results, const CollisionQueryParams_SingleLineTrace* const queries, const int num_queries);
 
+	void MultiAARectTrace(QueryResult_MultiAARectTrace& out_query_result, const CollisionQueryParams_RectAA& query_params = CollisionQueryParams_RectAA{});
+
+private:
 	/// <summary>
-	/// 軸に平行な矩形がノードのエリアに重なっているか
+	/// コライダーに対応するツリーのリーフ
 	/// </summary>
-	/// <param name="node">ノード</param>
-	/// <param name="rect">軸に平行な矩形</param>
-	bool IsOverlapping(const KdNode* const node, const FRectAA& rect) const;
+	struct BroadphaseProxy
+	{
+		// 所属するバケット
+		int bucket_index;
 
-	int DEBUG_GetNodeIndex(ColliderBase* collider);
+		// バケットのDynamicAABBTreeのプロキシID
+		int proxy_id;
 
-	//クエリ系
-	void SingleLineTrace(QueryResult_SingleLineTrace& out_query_result, const CollisionQueryParams_SingleLineTrace& query_params);
-	void MultiAARectTrace(QueryResult_MultiAARectTrace& out_query_result, const CollisionQueryParams_RectAA& query_params = CollisionQueryParams_RectAA{});
+		// 前回ツリーに反映したときのAABBの中心. 移動量の計算に使う
+		Vector2D last_aabb_center;
 
+		// 移動がまだツリーに反映されていないか. _pending_moved_collidersに重複して積まないために使う
+		bool is_move_pending;
+	};
 
-private:
+	/// <summary>
+	/// ブロードフェーズの1レイヤー分の構造
+	/// </summary>
+	struct BroadphaseBucket
+	{
+		DynamicAABBTree tree;
+
+		// ツリー構築時にSTATICだったコライダーの一様グリッド
+		StaticColliderGrid static_grid;
+	};
 
 	/// <summary>
-	/// ノードが分割条件を満たすか
-	/// <para>分割条件: ノードの深さがMAX_TREE_DEPTH未満 かつ 所属コライダー数がMIN_COLLIDERS_PER_NODE以上</para>
+	/// コライダーのオブジェクトタイプに対応するバケットのツリーにコライダーを挿入する
 	/// </summary>
-	static bool ShouldSplitNode(const KdNode* const node);
+	void CreateProxy(ColliderBase* const collider);
 
 	/// <summary>
-	/// ノードに所属コライダーを追加する
+	/// 動的コライダーをブロードフェーズに追加する. 無効なコライダーはツリーに挿入せず, 有効化を待つ
 	/// </summary>
-	void AddColliderToNode(ColliderBase* const collider, KdNode* const node);
+	void AddToBroadphase(ColliderBase* const collider);
 
 	/// <summary>
-	/// kdノードを再帰的に分割する.
-	/// <para>
-	/// 分割は ノードの深さがMAX_TREE_DEPTHに達する または ノードに属するコライダー数がMIN_COLLIDERS_PER_NODE以下になる まで行われる
-	/// </para>
+	/// コライダーのオブジェクトタイプに対応するバケットの静的グリッド
 	/// </summary>
-	/// <param name="parent_node">分割のルートノード</param>
-	void SplitKdNodeRecursively(KdNode* parent_node);
+	StaticColliderGrid& GetStaticGrid(const ColliderBase* const collider);
 
 	/// <summary>
-	/// 左右の子ノードに親ノードのコライダーを移動させる.
-	/// どちらの子ノードにも包含されないコライダーは親ノードに残る
+	/// コライダーがother_bucket_indexのバケットを候補ペアの探索対象にするか. レイヤー行列と衝突対象の設定で決まる
 	/// </summary>
-	void DistributeColliders(KdNode* const parent_node);
+	bool ShouldQueryBucket(const ColliderBase* const collider, const int bucket_index, const int other_bucket_index) const;
 
 	/// <summary>
-	/// 破壊ルートノードの子孫ノードをdeleteした後, 破壊ルートノードをdeleteする DestructKdTree()から呼ばれる
+	/// コライダーのオブジェクトタイプと衝突対象の組をレイヤー行列に追加する
 	/// </summary>
-	/// <param name="destruction_root_node">破壊ルートノード</param>
-	void DestroyKdNodesRecursively(KdNode*& destruction_root_node);
-	
+	void AllowColliderHitTargets(const ColliderBase* collider);
+
 	/// <summary>
-	/// 1つの固定ノードと、別のノード及びその子孫ノードの間で, 属するコライダーの全組で衝突判定を行う.
+	/// ツリーと静的グリッドの統計情報を更新する
 	/// </summary>
-	/// <param name="fixed_node">固定ノード</param>
-	/// <param name="root_of_targets">衝突判定の対象となるノードのルート. このノード自体と, その子孫ノードが固定ノードとの衝突判定の対象となる。</param>
-	void HandleCollisionsBetweenNodes(const KdNode* fixed_node, const KdNode* root_of_targets);
-	
+	void UpdateBroadphaseStats();
+
 	/// <summary>
-	/// コライダーがノードに包含されるかをチェックする
+	/// コライダーを静的グリッドから外し, ツリーに挿入する
 	/// </summary>
-	/// <param name="collider">コライダー</param>
-	/// <param name="node">ノード</param>
-	/// <returns>nodeがcolliderを包含するか</returns>
-	bool CheckNodeContainsCollider(ColliderBase* const collider, const KdNode* const node) const;
+	void MoveFromStaticGridToTree(ColliderBase* const collider);
 
 	/// <summary>
-	/// コライダーが所属する最適なノードを検索する
-	/// <para>*最適なノードは, コライダーを包含するノードの中で最も深いもの</para>
+	/// 保留中のコライダーの移動をツリーに反映する. ツリーを参照する処理の前に呼ぶ
 	/// </summary>
-	/// <param name="collider">検索対象コライダー</param>
-	/// <returns>コライダーが属する最適なノード</returns>
-	KdNode* FindNode(ColliderBase* collider) const;
+	void FlushPendingProxyMoves();
 
 	/// <summary>
-	/// クエリポイントが所属する最も深いノードを検索する
+	/// ブロードフェーズ.
+	/// 動的コライダーのfat AABBと重なるツリーの葉及び静的グリッドのコライダーとのペアを, 衝突し得るバケットからだけ列挙し, _pair_bufferに格納する
 	/// </summary>
-	/// <param name="query_point"></param>
-	/// <returns></returns>
-	KdNode* FindNode(const Vector2D& query_point) const;
+	void FindCandidatePairs();
 
 	/// <summary>
-	/// ノードからコライダーを削除
+	/// 動的コライダーが候補ペアの探索に使う矩形. 連続衝突判定が有効な場合は移動経路全体を含む
 	/// </summary>
-	/// <param name="collider">削除対象</param>
-	void RemoveFromBelongingNode(ColliderBase* collider);
+	FRectAA GetBroadphaseQueryAABB(const ColliderBase* const collider, const int bucket_index, const int proxy_id) const;
+
+	/// <summary>
+	/// 候補ペアのうち, 互いが衝突対象で昇順にソートされた状態までを用意する
+	/// </summary>
+	void PreparePairs();
+
+	/// <summary>
+	/// ナローフェーズ. _pair_orderの順に候補ペアの衝突判定を行い, 衝突していたものを_hit_resultsに格納する
+	/// </summary>
+	void RunNarrowPhase();
+
+	/// <summary>
+	/// ナローフェーズをスレッドプールで行う. 結果の順序はRunNarrowPhase()のシングルスレッドの場合と同じ
+	/// </summary>
+	void RunNarrowPhaseParallel();
+
+	/// <summary>
+	/// 候補ペアの衝突判定. 複数スレッドから呼ばれるので, コライダーの状態を変更してはいけない
+	/// </summary>
+	/// <returns>衝突しているか</returns>
+	bool CheckPairHit(const int pair_index, HitResult& out_hit_result) const;
+
+	/// <summary>
+	/// 2つのコライダーの衝突判定. 離散判定で衝突せず, どちらかの連続衝突判定が有効な場合は掃引判定も行う
+	/// </summary>
+	static void CheckHitWithSweep(HitResult& out_result_for_self, const ColliderBase* const self_collider, const ColliderBase* const other_collider);
 
 	/// <summary>
-	/// ノードからコライダーを削除
+	/// _hit_resultsの順に押し戻しとActor::OnHitCollision()を呼ぶ
+	/// <para>先に処理した押し戻しで動いたアクターのペアは, 判定し直してから処理する</para>
 	/// </summary>
-	/// <param name="it_collider">削除対象を指すイテレータ. 関数内で削除した次のコライダーを指すように更新される</param>
-	void RemoveFromBelongingNode(std::vector<ColliderBase*>::const_iterator& it_collider);
+	void ResolveHits();
 
 	/// <summary>
-	/// <para>axisがX軸の場合、外接AABBの左側のX座標が昇順(左から右)になるようにソートする</para>
-	/// <para>axisがY軸の場合、外接AABBの上側のY座標が昇順(上から下)になるようにソートする</para>
+	/// 現在のResolveHits()の中で押し戻されたアクターか
 	/// </summary>
-	/// <param name="colliders">ソート対象のコライダーリスト</param>
-	/// <param name="axis">ソートの基準となる軸</param>
-	void SortCollidersAlongAxis(std::vector<ColliderBase*>& colliders, const Axis axis) const;
+	bool IsPushedInThisResolve(const Actor* actor) const;
+
+	bool _is_tree_constructed;
 
 	/// <summary>
-	/// KDノードのリスト
-	/// <para>親ノードのインデックスをi_parentとすると</para>
-	/// <para>左子ノード: 2*i_parent + 1</para>
-	/// <para>右子ノード: 2*i_parent + 2</para>
+	/// レイヤーごとのブロードフェーズ. 添え字はCollisionLayerMatrix::GetBucketIndex()
 	/// </summary>
-	std::vector<KdNode*> kd_nodes;
+	std::array<BroadphaseBucket, CollisionLayerMatrix::NUM_BUCKETS> _buckets;
 
 	/// <summary>
-	/// KDツリーのルートノード
+	/// レイヤー同士が衝突し得るか
 	/// </summary>
-	KdNode* _root_node;
+	CollisionLayerMatrix _layer_matrix;
 
 	/// <summary>
-	/// コライダーとKDノードのマッピング情報
+	/// 無効化されているためにツリーから外している動的コライダー
 	/// </summary>
-	std::unordered_map<ColliderBase*, KdNode*> collider_node_map;
+	std::unordered_set<ColliderBase*> _inactive_colliders;
+
+	/// <summary>
+	/// コライダーとツリーのリーフのマッピング情報
+	/// </summary>
+	std::unordered_map<ColliderBase*, BroadphaseProxy> collider_proxy_map;
 
 	/// <summary>
 	///	存在するすべてのコライダー
 	/// </summary>
 	std::vector<ColliderBase*> all_colliders;
-};
 
-/// <summary>
-/// 左子ノードは分割された親ノードの X(Y)が小さい側で, 右子ノードは大きい側
-/// <para>コライダーのAABBが左右子ノードのエリアいずれかに内包される場合, そのコライダーは子ノードに所属する</para>
-/// <para>AABBが子ノードの境界線に接触する場合は, 親ノードに所属する</para>
-/// <para>あるコライダーが衝突し得るのは, 所属するノードと, その子孫および祖先ノード に所属するコライダー</para>
-/// </summary>
-struct KdNode
-{
 	/// <summary>
-	/// 
-	/// </summary>
-	/// <param name="depth_in">ノードの深さ. ルートは0</param>
-	/// <param name="node_index_in">ノード番号. 左子は2*[親インデックス]+1 or 右子は2*[親インデックス]+2</param>
-	/// <param name="split_axis_in">分割軸</param>
-	/// <param name="left_top">左上の座標</param>
-	/// <param name="right_bottom">右下の座標</param>
-	KdNode(const uint8_t depth_in, const uint8_t node_index_in, Axis split_axis_in, Vector2D left_top_in, Vector2D right_bottom_in)
-		: left_node(nullptr)
-		, right_node(nullptr)
-		, depth(depth_in)
-		, node_index(node_index_in)
-		, split_axis(split_axis_in)
-		, cell_left_top(left_top_in)
-		, cell_right_bottom(right_bottom_in)
-		, split_position(0.f)
+	/// 連続衝突判定が有効なコライダー
+	/// </summary>
+	std::vector<ColliderBase*> _continuous_colliders;
+
+	/// <summary>
+	/// 移動がツリーに反映されていないコライダー
+	/// <para>反映前に破棄・無効化されたコライダーも残るので, 反映時にcollider_proxy_mapで保留中か確かめる</para>
+	/// </summary>
+	std::vector<ColliderBase*> _pending_moved_colliders;
+
+	// 以下, フレーム間で使いまわすバッファ
+
+	/// <summary>
+	/// 衝突判定の候補ペア
+	/// </summary>
+	CollisionPairBuffer _pair_buffer;
+
+	/// <summary>
+	/// 候補ペアを処理する順番 (_pair_bufferのインデックス)
+	/// </summary>
+	std::vector<int> _pair_order;
+
+	/// <summary>
+	/// ナローフェーズの結果
+	/// </summary>
+	std::vector<HitResult> _hit_results;
+
+	/// <summary>
+	/// ResolveHits()の中で押し戻されたアクター
+	/// </summary>
+	std::vector<const Actor*> _pushed_actors;
+
+	/// <summary>
+	/// スレッドごとのナローフェーズの結果. _pair_order上の位置と衝突結果の組
+	/// <para>別スレッドが書き込むバッファ同士が同じキャッシュラインに載らないように揃える</para>
+	/// </summary>
+	struct alignas(64) NarrowPhaseThreadBuffer
 	{
-	}
+		std::vector<std::pair<int, HitResult>> hits;
+	};
+	std::vector<NarrowPhaseThreadBuffer> _narrowphase_thread_buffers;
 
-	std::vector<ColliderBase*>& GetCollidersInNode() { return colliders; }
-	void AddCollider(ColliderBase* collider) { colliders.push_back(collider); }
+	/// <summary>
+	/// ナローフェーズ用のスレッドプール. シングルスレッドの場合はnullptr
+	/// </summary>
+	std::unique_ptr<WorkStealingThreadPool> _thread_pool;
 
 	/// <summary>
-	/// コライダーリストからコライダーを削除する
+	/// 次に登録されるコライダーに振る通し番号
 	/// </summary>
-	/// <param name="collider">削除対象コライダー</param>
-	/// <returns>削除したコライダーの次のコライダーのイテレータ</returns>
-	std::vector<ColliderBase*>::iterator EraseCollider(ColliderBase* collider) {
-		auto iterator = std::find(colliders.begin(), colliders.end(), collider);
-		if (iterator != colliders.end())
-		{
-			return colliders.erase(iterator);
-		}
-	}
-	uint8_t GetNodeIndex() const { return node_index; }
-	bool HasChildNode() const { return left_node && right_node; }
-	uint8_t GetLeftChildIndex() const { return 2 * node_index + 1; }
-	KdNode* const GetLeftChildNode() const { return left_node; }
-	uint8_t GetRightChildIndex() const { return 2 * node_index + 2; }
-	KdNode* const GetRightChildNode() const { return right_node; }
-
-	/// <summary>
-	///  ノードに所属するコライダー数を取得
-	/// </summary>
-	size_t GetCollidersNum() const { return colliders.size(); }
-
-	Vector2D GetAreaLeftTop() const { return cell_left_top; }
-	Vector2D GetAreaRightBottom() const { return cell_right_bottom; }
-
-	std::vector<ColliderBase*> colliders;
-	KdNode* left_node;
-	KdNode* right_node;
-	uint8_t depth;
-	uint8_t node_index;
-	Vector2D cell_left_top;
-	Vector2D cell_right_bottom;
-	Axis split_axis;
-	float split_position;
-};
\ No newline at end of file
+	uint32_t _next_serial_number;
+
+	/// <summary>
+	/// 前回のHandleCollisions()以降にツリーに再挿入されたコライダー数
+	/// </summary>
+	int _num_reinserted_proxies_in_frame;
+
+	/// <summary>
+	/// 前回のHandleCollisions()以降のOnColliderTransformed()の呼び出し回数と, ツリーに反映したコライダー数
+	/// </summary>
+	int _num_transform_notifications_in_frame;
+	int _num_moved_proxies_in_frame;
+
+	CollisionStats _stats;
+};
@@ -0,0 +1,215 @@
+#include "GameObjectManager.h"
+#include "GameObject.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace
+{
+	// 1チャンクの目安のサイズ. スロットがこれより大きい型(シーンなど)は1チャンクに1スロット
+	constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+	// 小さい型でも1チャンクに詰めすぎない
+	constexpr size_t MAX_SLOTS_PER_CHUNK = 256;
+}
+
+GameObjectPool::GameObjectPool(const size_t slot_size, const size_t slot_alignment)
+	: _slot_alignment(slot_alignment)
+	, _num_live_slots(0)
+{
+	// 各スロットの先頭がアラインメントを満たすように, スロットサイズをアラインメントの倍数に切り上げる
+	_slot_size = (slot_size + slot_alignment - 1) / slot_alignment * slot_alignment;
+	_slots_per_chunk = std::clamp<size_t>(CHUNK_BYTES / _slot_size, 1, MAX_SLOTS_PER_CHUNK);
+}
+
+GameObjectPool::~GameObjectPool()
+{
+	// NOTE: 生存中のオブジェクトが残っていてもデストラクタは呼ばない(以前のnewによる生成で解放されなかった場合と同じ扱い)
+	for (void* chunk : _chunks)
+	{
+		::operator delete(chunk, std::align_val_t(_slot_alignment));
+	}
+}
+
+void* GameObjectPool::Allocate()
+{
+	if (_free_slots.empty())
+	{
+		AllocateChunk();
+	}
+
+	void* const storage = _free_slots.back();
+	_free_slots.pop_back();
+	_num_live_slots++;
+	return storage;
+}
+
+void GameObjectPool::Free(void* const storage)
+{
+	assert(storage != nullptr);
+	assert(_num_live_slots > 0);
+	_free_slots.push_back(storage);
+	_num_live_slots--;
+}
+
+void GameObjectPool::ResetFreeList()
+{
+	assert(_num_live_slots == 0);
+
+	_free_slots.clear();
+	for (auto it = _chunks.rbegin(); it != _chunks.rend(); ++it)
+	{
+		char* const chunk_begin = static_cast<char*>(*it);
+		for (size_t i = _slots_per_chunk; i > 0; i--)
+		{
+			_free_slots.push_back(chunk_begin + (i - 1) * _slot_size);
+		}
+	}
+}
+
+void GameObjectPool::AllocateChunk()
+{
+	char* const chunk_begin = static_cast<char*>(::operator new(_slot_size * _slots_per_chunk, std::align_val_t(_slot_alignment)));
+	_chunks.push_back(chunk_begin);
+
+	// 末尾から取り出すので, 先頭のスロットから使われるように逆順に積む
+	_free_slots.reserve(_free_slots.size() + _slots_per_chunk);
+	for (size_t i = _slots_per_chunk; i > 0; i--)
+	{
+		_free_slots.push_back(chunk_begin + (i - 1) * _slot_size);
+	}
+}
+
+GameObjectManager::GameObjectManager()
+	: _total_objects_created(0)
+{
+}
+
+GameObjectManager::~GameObjectManager()
+{
+}
+
+bool GameObjectManager::IsValid(const GameObject* const object) const
+{
+	if (object == nullptr)
+	{
+		return false;
+	}
+
+	const GameObjectHandle& handle = object->GetHandle();
+	return IsValid(handle) && _slots[handle.index].object == object;
+}
+
+void GameObjectManager::ResetUnusedPools()
+{
+	for (auto& pool : _pools)
+	{
+		if (pool && pool->GetNumLiveSlots() == 0)
+		{
+			pool->ResetFreeList();
+		}
+	}
+
+	// 全スロットが空いていれば, スロット表も先頭から使われるように並べ直す
+	if (_free_slot_indices.size() == _slots.size())
+	{
+		std::sort(_free_slot_indices.begin(), _free_slot_indices.end(), std::greater<uint32_t>());
+	}
+}
+
+void GameObjectManager::GetPoolStats(PoolStats& out_stats) const
+{
+	out_stats.num_live_objects = static_cast<int>(_slots.size() - _free_slot_indices.size());
+	out_stats.num_pools = 0;
+	out_stats.num_chunks = 0;
+	out_stats.num_chunk_bytes = 0;
+	out_stats.total_objects_created = _total_objects_created;
+
+	for (const auto& pool : _pools)
+	{
+		if (!pool)
+		{
+			continue;
+		}
+		out_stats.num_pools++;
+		out_stats.num_chunks += static_cast<int>(pool->GetNumChunks());
+		out_stats.num_chunk_bytes += pool->GetNumChunks() * pool->GetChunkBytes();
+	}
+}
+
+size_t GameObjectManager::IssuePoolIndex()
+{
+	static size_t num_issued = 0;
+	return num_issued++;
+}
+
+GameObjectPool& GameObjectManager::GetPool(const size_t pool_index, const size_t slot_size, const size_t slot_alignment)
+{
+	if (pool_index >= _pools.size())
+	{
+		_pools.resize(pool_index + 1);
+	}
+
+	if (!_pools[pool_index])
+	{
+		_pools[pool_index] = std::make_unique<GameObjectPool>(slot_size, slot_alignment);
+	}
+
+	return *_pools[pool_index];
+}
+
+void GameObjectManager::RegisterObject(GameObject* const object, void* const storage, GameObjectPool* const pool)
+{
+	uint32_t slot_index;
+	if (!_free_slot_indices.empty())
+	{
+		slot_index = _free_slot_indices.back();
+		_free_slot_indices.pop_back();
+	}
+	else
+	{
+		if (_slots.size() >= GameObjectHandle::INVALID_INDEX)
+		{
+			throw std::runtime_error("GameObjectManager: too many objects");
+		}
+		slot_index = static_cast<uint32_t>(_slots.size());
+		_slots.push_back(ObjectSlot{ nullptr, nullptr, nullptr, 1 });
+	}
+
+	ObjectSlot& slot = _slots[slot_index];
+	assert(slot.object == nullptr);
+	slot.object = object;
+	slot.storage = storage;
+	slot.pool = pool;
+
+	object->_handle.index = slot_index;
+	object->_handle.generation = slot.generation;
+
+	_total_objects_created++;
+}
+
+void GameObjectManager::DestroyObjectImpl(GameObject* const object)
+{
+	assert(IsValid(object));
+	const uint32_t slot_index = object->_handle.index;
+	ObjectSlot& slot = _slots[slot_index];
+	void* const storage = slot.storage;
+	GameObjectPool* const pool = slot.pool;
+
+	// 世代番号を進めて, このスロットを指すハンドルを全て無効にする. 0は無効な世代番号なので飛ばす
+	slot.generation++;
+	if (slot.generation == 0)
+	{
+		slot.generation = 1;
+	}
+	slot.object = nullptr;
+	slot.storage = nullptr;
+	slot.pool = nullptr;
+	_free_slot_indices.push_back(slot_index);
+
+	// デストラクタ中やその後のIsValid(object)がfalseになるように, 先にハンドルを無効にしておく
+	object->_handle = GameObjectHandle();
+	object->~GameObject();
+
+	pool->Free(storage);
+}
@@ -1,17 +1,91 @@
 #pragma once
 #include "Utility/SingletonBase.h"
+#include "GameObjectHandle.h"
 #include <type_traits>
-#include <unordered_set>
+#include <vector>
+#include <memory>
+#include <new>
 #include <cassert>
 
 class GameObject;
 
+/// <summary>
+/// 同じ型のGameObjectを格納する固定サイズのスロットのプール
+/// <para>スロットはチャンク単位でまとめて確保し, 破棄されたスロットは次の生成で再利用する. チャンクはプールが破棄されるまで解放しない</para>
+/// </summary>
+class GameObjectPool
+{
+public:
+	GameObjectPool(const size_t slot_size, const size_t slot_alignment);
+	~GameObjectPool();
+
+	GameObjectPool(const GameObjectPool&) = delete;
+	GameObjectPool& operator=(const GameObjectPool&) = delete;
+
+	/// <summary>
+	/// 未使用のスロットを1つ取り出す. 空きがなければチャンクを追加する
+	/// </summary>
+	void* Allocate();
+
+	/// <summary>
+	/// Allocate()で取り出したスロットを返却する. オブジェクトのデストラクタは呼び出し側で済ませておく
+	/// </summary>
+	void Free(void* const storage);
+
+	/// <summary>
+	/// 空きスロットのリストをアドレス順に並べ直す. 使用中のスロットがない場合のみ呼べる
+	/// <para>生成と破棄を繰り返して順番がばらばらになった後でも, 次の生成から連続したアドレスに配置されるようになる</para>
+	/// </summary>
+	void ResetFreeList();
+
+	size_t GetNumLiveSlots() const { return _num_live_slots; }
+	size_t GetNumChunks() const { return _chunks.size(); }
+	size_t GetChunkBytes() const { return _slot_size * _slots_per_chunk; }
+
+private:
+	void AllocateChunk();
+
+	size_t _slot_size;
+	size_t _slot_alignment;
+	size_t _slots_per_chunk;
+
+	std::vector<void*> _chunks;
+
+	// 未使用のスロット. 末尾から取り出す
+	std::vector<void*> _free_slots;
+
+	size_t _num_live_slots;
+};
+
 /// <summary>
 /// GameObjectの生成・破棄を行うクラス
+/// <para>オブジェクトは型ごとのGameObjectPoolに配置し, スロット表に登録してハンドルを割り当てる</para>
 /// </summary>
 class GameObjectManager : public Singleton<GameObjectManager>
 {
 public:
+	/// <summary>
+	/// プールの使用状況. ベンチマークやデバッグ表示用
+	/// </summary>
+	struct PoolStats
+	{
+		// 生存中のオブジェクト数
+		int num_live_objects;
+
+		// 生成されたプールの数(= CreateObject()された型の数)
+		int num_pools;
+
+		// 確保済みのチャンク数とその合計サイズ
+		int num_chunks;
+		size_t num_chunk_bytes;
+
+		// 起動してからの生成数の累計. 差分を取って区間ごとの値にする
+		// チャンクは解放しないので, num_chunksの差分が区間内のチャンク確保回数になる
+		int64_t total_objects_created;
+	};
+
+	GameObjectManager();
+	virtual ~GameObjectManager();
 
 	/// <summary>
 	/// GameObjectインスタンスを生成する. 戻り値は常に有効
@@ -21,26 +95,104 @@ public:
 	GameObjectDerived* CreateObject()
 	{
 		static_assert(std::is_base_of_v<GameObject, GameObjectDerived>, "GameObjectDerived must be derived from GameObject");
-		GameObjectDerived* new_object = new GameObjectDerived();
+		GameObjectPool& pool = GetPool(GetPoolIndex<GameObjectDerived>(), sizeof(GameObjectDerived), alignof(GameObjectDerived));
+		void* const storage = pool.Allocate();
+		GameObjectDerived* new_object = new(storage) GameObjectDerived();
 		assert(new_object != nullptr);
-		_objects.insert(new_object);
+		RegisterObject(new_object, storage, &pool);
 		return new_object;
 	}
 
+	/// <summary>
+	/// CreateObject()で生成したオブジェクトを破棄する. objectはnullptrになる
+	/// </summary>
 	template<class GameObjectDerived>
 	void DestroyObject(GameObjectDerived*& object)
 	{
 		static_assert(std::is_base_of_v<GameObject, GameObjectDerived>, "GameObjectDerived must be derived from GameObject");
-		_objects.erase(object);
-		delete object;
+		if (object == nullptr)
+		{
+			return;
+		}
+		DestroyObjectImpl(object);
 		object = nullptr;
 	}
 
-	bool IsValid(const GameObject* const object) const
+	/// <summary>
+	/// handleが生存中のオブジェクトを指しているか. スロット番号と世代番号の比較のみで判定する
+	/// </summary>
+	bool IsValid(const GameObjectHandle& handle) const
+	{
+		return handle.index < _slots.size()
+			&& _slots[handle.index].generation == handle.generation
+			&& _slots[handle.index].object != nullptr;
+	}
+
+	/// <summary>
+	/// objectが生存中か
+	/// <para>object自身のハンドルで判定するため, objectは破棄済みであってもプールのメモリを指している必要がある(CreateObject()の戻り値か, nullptr)</para>
+	/// </summary>
+	bool IsValid(const GameObject* const object) const;
+
+	/// <summary>
+	/// handleが指すオブジェクト. 無効なハンドルの場合はnullptr
+	/// </summary>
+	GameObject* FindObject(const GameObjectHandle& handle) const
 	{
-		return _objects.find(object) != _objects.end();
+		return IsValid(handle) ? _slots[handle.index].object : nullptr;
 	}
 
+	/// <summary>
+	/// 生存中のオブジェクトがないプールの空きスロットをアドレス順に並べ直す
+	/// <para>シーンのアクターを一括で破棄した後に呼ぶ. チャンクは次のシーンで再利用するため解放しない</para>
+	/// </summary>
+	void ResetUnusedPools();
+
+	void GetPoolStats(PoolStats& out_stats) const;
+
 private:
-	std::unordered_set<const GameObject*> _objects;
+	/// <summary>
+	/// スロット表の要素. スロット番号はハンドルのindexに対応する
+	/// </summary>
+	struct ObjectSlot
+	{
+		// 未使用のスロットではnullptr
+		GameObject* object;
+
+		// objectを配置したプールのメモリ. 多重継承ではobjectと異なるアドレスになりうる
+		void* storage;
+		GameObjectPool* pool;
+
+		uint32_t generation;
+	};
+
+	/// <summary>
+	/// 型ごとに一意なプール番号
+	/// </summary>
+	template<class GameObjectDerived>
+	static size_t GetPoolIndex()
+	{
+		static const size_t pool_index = IssuePoolIndex();
+		return pool_index;
+	}
+
+	static size_t IssuePoolIndex();
+
+	/// <summary>
+	/// pool_indexのプール. 最初に呼ばれたときに生成する
+	/// </summary>
+	GameObjectPool& GetPool(const size_t pool_index, const size_t slot_size, const size_t slot_alignment);
+
+	void RegisterObject(GameObject* const object, void* const storage, GameObjectPool* const pool);
+	void DestroyObjectImpl(GameObject* const object);
+
+	// プール番号で引く. CreateObject()されていない型の要素はnullptr
+	std::vector<std::unique_ptr<GameObjectPool>> _pools;
+
+	std::vector<ObjectSlot> _slots;
+
+	// 未使用のスロット番号. 末尾から取り出す
+	std::vector<uint32_t> _free_slot_indices;
+
+	int64_t _total_objects_created;
 };
@@ -3,105 +3,114 @@
 #include <DirectXTex.h>
 #include <DxLib.h>
 #include "Utility/Core/StringUtils.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+
+namespace
+{
+    // シーンをまたいで保持する画像の予算
+    constexpr uint64_t GRAPHIC_CACHE_BUDGET_BYTES = 256ull * 1024 * 1024;
+}
 
 GraphicResourceManager::GraphicResourceManager()
+    : _cache(GRAPHIC_CACHE_BUDGET_BYTES, &GraphicResourceManager::UnloadAsset)
+    , _scene_generation(1)
 {
 }
 
-void GraphicResourceManager::UnloadSprite(const MasterDataID sprite_id)
+size_t GraphicResourceManager::GraphicAssetKeyHash::operator()(const GraphicAssetKey& key) const
 {
-    if (!IsLoadedSprite(sprite_id))
+    size_t hash = std::hash<std::string>()(key.path);
+    hash ^= std::hash<MasterDataID>()(key.id) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<uint8_t>()(static_cast<uint8_t>(key.type)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+template<class LoadFunc>
+GraphicResourceManager::GraphicAsset& GraphicResourceManager::AcquireForScene(const GraphicAssetKey& key, LoadFunc&& load)
+{
+    // このシーンで取得済みの場合は, 参照カウントを変えずに返す. 毎フレーム呼ばれるのはここ
+    GraphicAsset* p_asset = _cache.Find(key);
+    if (p_asset && p_asset->scene_generation == _scene_generation)
     {
-        return;
+        return *p_asset;
     }
 
-    std::vector<int>& handles = _loaded_sprites.at(sprite_id);
-    for (int handle : handles)
+    // 前のシーンから残っている場合はロードせずに参照を増やし, 無い場合はロードして追加する
+    p_asset = _cache.Acquire(key);
+    if (!p_asset)
     {
-        DxLib::DeleteGraph(handle);
+        GraphicAsset new_asset{};
+        uint64_t bytes = 0;
+        load(new_asset, bytes);
+        p_asset = &_cache.Insert(key, std::move(new_asset), bytes);
     }
-    _loaded_sprites.erase(sprite_id);
+
+    p_asset->scene_generation = _scene_generation;
+    _scene_keys.push_back(key);
+    return *p_asset;
 }
 
-void GraphicResourceManager::UnloadGraphForDxLib(const std::string& file_path)
+void GraphicResourceManager::UnloadAsset(const GraphicAssetKey& key, GraphicAsset& asset)
 {
-    if (!IsLoadedGraphForDxLib(file_path))
+    for (const int ghandle : asset.dxlib_handles)
     {
-        return;
+        if (ghandle != -1)
+        {
+            DxLib::DeleteGraph(ghandle);
+        }
     }
-
-    const int handle = _loaded_graphs_for_dxlib.at(file_path);
-    DxLib::DeleteGraph(handle);
-    _loaded_graphs_for_dxlib.erase(file_path);
+    asset.dxlib_handles.clear();
+    asset.texture = Texture();
 }
 
-bool GraphicResourceManager::IsLoadedGraphForDxLib(const std::string& file_path) const
+GraphicResourceManager::~GraphicResourceManager()
 {
-    return _loaded_graphs_for_dxlib.find(file_path) != _loaded_graphs_for_dxlib.end();
 }
 
-bool GraphicResourceManager::IsLoadedGraphForDxLib(const MasterDataID image_id) const
+void GraphicResourceManager::Finalize()
 {
-    const std::string& file_path = MdImageFile::GetPath(image_id);
-    return IsLoadedGraphForDxLib(file_path);
+    UnloadAll();
+    Singleton<GraphicResourceManager>::Finalize();
 }
 
-bool GraphicResourceManager::IsLoadedSprite(const MasterDataID sprite_id) const
+void GraphicResourceManager::UnloadAll()
 {
-    return _loaded_sprites.find(sprite_id) != _loaded_sprites.end();
+    _cache.Clear();
+    _scene_keys.clear();
+    _scene_generation++;
 }
 
-bool GraphicResourceManager::IsLoadedTexture(const MasterDataID image_id) const
+void GraphicResourceManager::ReleaseSceneReferences()
 {
-    return _loaded_textures.find(image_id) != _loaded_textures.end();
-}
+    for (const GraphicAssetKey& key : _scene_keys)
+    {
+        _cache.Release(key);
+    }
+    _scene_keys.clear();
 
-GraphicResourceManager::~GraphicResourceManager()
-{
+    // 次のシーンでは, 取得したときに改めて参照を数える
+    _scene_generation++;
+    _cache.Trim();
 }
 
-void GraphicResourceManager::Finalize()
+void GraphicResourceManager::SetCacheBudget(const uint64_t budget_bytes)
 {
-    UnloadAll();
-    __super::Finalize();
+    _cache.SetBudget(budget_bytes);
 }
 
-void GraphicResourceManager::UnloadAll()
+AssetCacheStats GraphicResourceManager::GetCacheStats() const
 {
-    if (_loaded_textures.size() > 0)
-    {
-        _loaded_textures.clear();
-    }
-
-    if (_loaded_graphs_for_dxlib.size() > 0)
-    {
-        for (auto& pair : _loaded_graphs_for_dxlib)
-        {
-            int ghandle = pair.second;
-            DxLib::DeleteGraph(ghandle);
-        }
-        _loaded_graphs_for_dxlib.clear();
-    }
-
-    if (_loaded_sprites.size() > 0)
-    {
-        for (auto& pair : _loaded_sprites)
-        {
-            for (auto& ghandle : pair.second)
-            {
-                DxLib::DeleteGraph(ghandle);
-            }
-        }
-        _loaded_sprites.clear();
-    }
+    return _cache.GetStats();
 }
 
-int GraphicResourceManager::LoadGraphForDxLib(const std::string& file_path)
+void GraphicResourceManager::LoadGraphForDxLib(const std::string& file_path, GraphicAsset& out_asset, uint64_t& out_bytes)
 {
-    // ロード済みの場合は削除して再ロード
-    if (IsLoadedGraphForDxLib(file_path))
+    // ヘッドレス実行では画像をロードせず, 無効なハンドルを記録する
+    if (HeadlessPlatform::IsEnabled())
     {
-        UnloadGraphForDxLib(file_path);
+        out_asset.dxlib_handles.assign(1, -1);
+        out_bytes = 0;
+        return;
     }
 
     const int ghandle = DxLib::LoadGraph(to_tstring(file_path).c_str());
@@ -110,22 +119,22 @@ int GraphicResourceManager::LoadGraphForDxLib(const std::string& file_path)
         throw std::runtime_error("Failed to load graph");
     }
 
-    _loaded_graphs_for_dxlib[file_path] = ghandle;
-    return ghandle;
-}
+    // 32bitカラーとして見積もる
+    int width = 0;
+    int height = 0;
+    DxLib::GetGraphSize(ghandle, &width, &height);
 
-int GraphicResourceManager::LoadGraphForDxLib(const MasterDataID image_id)
-{
-    const std::string& file_path = MdImageFile::GetPath(image_id);
-    return LoadGraphForDxLib(file_path);
+    out_asset.dxlib_handles.assign(1, ghandle);
+    out_bytes = static_cast<uint64_t>(width) * height * 4;
 }
 
-void GraphicResourceManager::LoadTexture(const MasterDataID image_id, ID3D11Resource** out_pp_resource, ID3D11ShaderResourceView** out_pp_srv)
+void GraphicResourceManager::LoadTexture(const MasterDataID image_id, GraphicAsset& out_asset, uint64_t& out_bytes)
 {
-    // ロード済みの場合は削除して再ロード
-    if (IsLoadedTexture(image_id))
+    // ヘッドレス実行ではデバイスが無いので, テクスチャを作らない
+    if (HeadlessPlatform::IsEnabled())
     {
-        _loaded_textures.erase(image_id);
+        out_bytes = 0;
+        return;
     }
 
     // デバイスの取得
@@ -180,27 +189,12 @@ void GraphicResourceManager::LoadTexture(const MasterDataID image_id, ID3D11Reso
         throw std::runtime_error("[GraphicResourceManager::LoadTexture()]failed to create SRV");
     }
 
-    // マップに追加
-    _loaded_textures[image_id] = new_texture;
-
-    if (out_pp_resource)
-    {
-        *out_pp_resource = new_texture.p_resource.Get();
-    }
-    if (out_pp_srv)
-    {
-        *out_pp_srv = new_texture.p_srv.Get();
-    }
+    out_asset.texture = new_texture;
+    out_bytes = static_cast<uint64_t>(scratch_image.GetPixelsSize());
 }
 
-void GraphicResourceManager::LoadSpriteForDxLib(const MasterDataID sprite_id, std::vector<int>* out_sprite_handles)
+void GraphicResourceManager::LoadSpriteForDxLib(const MasterDataID sprite_id, GraphicAsset& out_asset, uint64_t& out_bytes)
 {
-    // ロード済みの場合は削除して再ロード
-    if (IsLoadedSprite(sprite_id))
-    {
-        UnloadSprite(sprite_id);
-    }
-
     const MdSpriteSheet& sprite_sheet = MdSpriteSheet::Get(sprite_id);
     const MdImageFile& image = MdImageFile::Get(sprite_sheet.image_id);
     const int num_x = sprite_sheet.num_columns;
@@ -208,15 +202,20 @@ void GraphicResourceManager::LoadSpriteForDxLib(const MasterDataID sprite_id, st
     const int size_x = image.width / num_x;
     const int size_y = image.height / num_y;
 
-    _loaded_sprites[sprite_id] = std::vector<int>(num_x * num_y);
-    std::vector<int>& new_handles = _loaded_sprites.at(sprite_id);
+    std::vector<int>& new_handles = out_asset.dxlib_handles;
+    new_handles.assign(num_x * num_y, -1);
 
-    DxLib::LoadDivGraph(to_tstring(image.path).c_str(), new_handles.size(), num_x, num_y, size_x, size_y, new_handles.data());
-
-    if (out_sprite_handles)
+    // ヘッドレス実行ではコマ数だけ無効なハンドルを並べる
+    if (HeadlessPlatform::IsEnabled())
     {
-        *out_sprite_handles = new_handles;
+        out_bytes = 0;
+        return;
     }
+
+    DxLib::LoadDivGraph(to_tstring(image.path).c_str(), new_handles.size(), num_x, num_y, size_x, size_y, new_handles.data());
+
+    // 32bitカラーとして見積もる
+    out_bytes = static_cast<uint64_t>(image.width) * image.height * 4;
 }
 
 int GraphicResourceManager::GetGraphForDxLib(const MasterDataID image_id)
@@ -227,23 +226,24 @@ int GraphicResourceManager::GetGraphForDxLib(const MasterDataID image_id)
 
 int GraphicResourceManager::GetGraphForDxLib(const std::string& file_path)
 {
-    if (!IsLoadedGraphForDxLib(file_path))
-    {
-        return LoadGraphForDxLib(file_path);
-    }
+    const GraphicAssetKey key{ EGraphicAssetType::GraphForDxLib, 0, file_path };
+    const GraphicAsset& asset = AcquireForScene(key, [this, &file_path](GraphicAsset& out_asset, uint64_t& out_bytes)
+        {
+            LoadGraphForDxLib(file_path, out_asset, out_bytes);
+        });
 
-    return _loaded_graphs_for_dxlib.at(file_path);
+    return asset.dxlib_handles.front();
 }
 
 void GraphicResourceManager::GetTexture(const MasterDataID image_id, ID3D11Resource** out_p_resource, ID3D11ShaderResourceView** out_p_srv)
 {
-    if (!IsLoadedTexture(image_id))
-    {
-        LoadTexture(image_id, out_p_resource, out_p_srv);
-        return;
-    }
+    const GraphicAssetKey key{ EGraphicAssetType::Texture, image_id, std::string() };
+    const GraphicAsset& asset = AcquireForScene(key, [this, image_id](GraphicAsset& out_asset, uint64_t& out_bytes)
+        {
+            LoadTexture(image_id, out_asset, out_bytes);
+        });
 
-    const Texture& tex = _loaded_textures.at(image_id);
+    const Texture& tex = asset.texture;
 
     if (out_p_resource)
     {
@@ -257,16 +257,21 @@ void GraphicResourceManager::GetTexture(const MasterDataID image_id, ID3D11Resou
 
 const std::vector<int>& GraphicResourceManager::GetSprite(const MasterDataID sprite_id)
 {
-    if (!IsLoadedSprite(sprite_id))
-    {
-        LoadSpriteForDxLib(sprite_id);
-    }
+    const GraphicAssetKey key{ EGraphicAssetType::SpriteForDxLib, sprite_id, std::string() };
+    const GraphicAsset& asset = AcquireForScene(key, [this, sprite_id](GraphicAsset& out_asset, uint64_t& out_bytes)
+        {
+            LoadSpriteForDxLib(sprite_id, out_asset, out_bytes);
+        });
 
-    return _loaded_sprites.at(sprite_id);
+    return asset.dxlib_handles;
 }
 
 int GraphicResourceManager::GetDerivedGraph(const MasterDataID image_id, const int left, const int top, const int width, const int height)
 {
     const int ghandle_parent = GetGraphForDxLib(image_id);
+    if (HeadlessPlatform::IsEnabled())
+    {
+        return -1;
+    }
     return DxLib::DerivationGraph(left, top, width, height, ghandle_parent);
 }
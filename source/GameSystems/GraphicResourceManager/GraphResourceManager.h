@@ -3,10 +3,13 @@
 #include <d3d11.h>
 #include <wrl/client.h>
 #include "Utility/SingletonBase.h"
+#include "Utility/AssetCache.h"
 #include "GameSystems/MasterData/MasterDataInclude.h"
 
 /// <summary>
 /// 画像リソースの管理クラス
+/// <para>ロードした画像はAssetCacheに入れてシーンをまたいで保持し, 予算を超えたときだけ参照されていないものを古い順に解放する</para>
+/// <para>Get~()で取得した画像は, ReleaseSceneReferences()を呼ぶまで(通常はシーンの終了まで)そのシーンが参照しているものとして数える</para>
 /// </summary>
 class GraphicResourceManager : public Singleton<GraphicResourceManager>
 {
@@ -19,30 +22,23 @@ public:
 
 	virtual void Finalize() override;
 
-	void UnloadAll();
-
 	/// <summary>
-	/// DxLib用に画像をロードする. ロード済みの場合は再ロードする
+	/// 参照されているものも含め, 全ての画像を解放する
 	/// </summary>
-	/// <param name="file_path">画像パス</param>
-	/// <returns>DxLibグラフィックハンドル</returns>
-	int LoadGraphForDxLib(const std::string& file_path);
+	void UnloadAll();
 
 	/// <summary>
-	/// DxLib用に画像をロードする. ロード済みの場合は再ロードする
+	/// 現在のシーンが参照している画像の参照を外す. 画像は解放せず, 次のシーンで使われればロードせずに返す
+	/// <para>SceneBase::Finalize()から呼ばれる. この後, 以前に取得したハンドルは解放されている可能性がある</para>
 	/// </summary>
-	/// <param name="image_id">画像ID</param>
-	/// <returns>DxLibグラフィックハンドル</returns>
-	int LoadGraphForDxLib(const MasterDataID image_id);
+	void ReleaseSceneReferences();
 
 	/// <summary>
-	/// DxLib用にスプライトをロードする. ロード済みの場合は再ロードする
+	/// キャッシュの予算を設定し, 超えた分の参照されていない画像を解放する
 	/// </summary>
-	/// <param name="sprite_id"></param>
-	/// <param name="out_sprite_handles"></param>
-	void LoadSpriteForDxLib(const MasterDataID sprite_id, std::vector<int>* out_sprite_handles = nullptr);
+	void SetCacheBudget(const uint64_t budget_bytes);
 
-	void LoadTexture(const MasterDataID image_id, ID3D11Resource** out_pp_resource = nullptr, ID3D11ShaderResourceView** out_pp_srv = nullptr);
+	AssetCacheStats GetCacheStats() const;
 
 	// 未ロードの場合, ロードして返却
 	int GetGraphForDxLib(const MasterDataID image_id);
@@ -56,14 +52,6 @@ public:
 private:
 	GraphicResourceManager();
 
-	void UnloadSprite(const MasterDataID sprite_id);
-	void UnloadGraphForDxLib(const std::string& file_path);
-
-	bool IsLoadedGraphForDxLib(const std::string& file_path) const;
-	bool IsLoadedGraphForDxLib(const MasterDataID image_id) const;
-	bool IsLoadedSprite(const MasterDataID sprite_id) const;
-	bool IsLoadedTexture(const MasterDataID image_id) const;
-
 	struct Texture
 	{
 		Texture() {}
@@ -84,7 +72,57 @@ private:
 		ComPtr<ID3D11ShaderResourceView> p_srv;		// ViewDimensionがTEXTURE2DのSRV
 	};
 
-	std::unordered_map <MasterDataID, Texture> _loaded_textures;		// キーは画像ID
-	std::unordered_map<std::string, int>  _loaded_graphs_for_dxlib;		// 値はDxLibグラフィックハンドル
-	std::unordered_map<MasterDataID, std::vector<int>> _loaded_sprites;
-};
\ No newline at end of file
+	enum class EGraphicAssetType : uint8_t
+	{
+		GraphForDxLib,		// キーは画像パス
+		SpriteForDxLib,		// キーはスプライトID
+		Texture,			// キーは画像ID
+	};
+
+	struct GraphicAssetKey
+	{
+		EGraphicAssetType type;
+		MasterDataID id;
+		std::string path;
+
+		bool operator==(const GraphicAssetKey& other) const { return type == other.type && id == other.id && path == other.path; }
+	};
+
+	struct GraphicAssetKeyHash
+	{
+		size_t operator()(const GraphicAssetKey& key) const;
+	};
+
+	/// <summary>
+	/// キャッシュに入れる画像. 種類によって使うメンバが異なる
+	/// </summary>
+	struct GraphicAsset
+	{
+		// DxLibグラフィックハンドル. GraphForDxLibは1個, SpriteForDxLibはコマ数だけ並べる
+		std::vector<int> dxlib_handles;
+		Texture texture;
+
+		// 最後に参照したシーンの世代. 現在の世代と同じ場合は, このシーンの参照を数え済み
+		uint32_t scene_generation;
+	};
+
+	/// <summary>
+	/// 現在のシーンの参照としてキャッシュから画像を取得する. 常駐していない場合はloadでロードしてキャッシュに入れる
+	/// </summary>
+	/// <param name="load">void(GraphicAsset& out_asset, uint64_t& out_bytes)</param>
+	template<class LoadFunc>
+	GraphicAsset& AcquireForScene(const GraphicAssetKey& key, LoadFunc&& load);
+
+	static void UnloadAsset(const GraphicAssetKey& key, GraphicAsset& asset);
+
+	// 画像をロードする. 管理はAcquireForScene()で行う
+	void LoadGraphForDxLib(const std::string& file_path, GraphicAsset& out_asset, uint64_t& out_bytes);
+	void LoadSpriteForDxLib(const MasterDataID sprite_id, GraphicAsset& out_asset, uint64_t& out_bytes);
+	void LoadTexture(const MasterDataID image_id, GraphicAsset& out_asset, uint64_t& out_bytes);
+
+	AssetCache<GraphicAssetKey, GraphicAsset, GraphicAssetKeyHash> _cache;
+
+	// 現在のシーンが参照している画像
+	std::vector<GraphicAssetKey> _scene_keys;
+	uint32_t _scene_generation;
+};
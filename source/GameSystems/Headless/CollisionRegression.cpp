@@ -0,0 +1,574 @@
+#include "CollisionRegression.h"
+#include "Actor/Actor.h"
+#include "Actor/ActorFactory.h"
+#include "Actor/Mapchip/Block/RectangleBlock/RectangleBlockInitialParams.h"
+#include "Actor/Mapchip/Block/SlopeBlock/SlopeBlockInitialParams.h"
+#include "GameSystems/CollisionManager.h"
+#include "Component/Collider/BoxCollider.h"
+#include "Component/Collider/TriangleCollider.h"
+#include "Scene/StageInteractiveScene/StageInteractiveScene.h"
+#include "Scene/StageInteractiveScene/StagePerimeterColliderHolder.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	constexpr const char* DEFAULT_GOLDEN_FILE_PATH = "collision_regression_golden.txt";
+
+	// シミュレーションの固定ステップ
+	constexpr float SIMULATION_DELTA_SECONDS = 1.f / 60.f;
+
+	// 動的コライダーの動き. スポーン位置を中心に左右に往復しながら跳ねる
+	constexpr float PATROL_AMPLITUDE = UNIT_TILE_SIZE * 3.f;
+	constexpr float PATROL_PERIOD_SECONDS = 2.f;
+	constexpr float HOP_HEIGHT = UNIT_TILE_SIZE * 1.5f;
+
+	// コライダーごとに動きの位相をずらす量 [rad]
+	constexpr float PHASE_STEP = 0.37f;
+
+	// ハッシュに使う位置の分解能 [1/px]. 浮動小数点の演算順序による僅かな差は無視する
+	constexpr float POSITION_HASH_RESOLUTION = 100.f;
+
+	// ブロードフェーズの効率の比較で, ゴールデンファイルの値からこの割合以上増えたら不一致とする
+	constexpr double PAIRS_TOLERANCE_RATIO = 0.1;
+	constexpr double LEAF_DEPTH_TOLERANCE_RATIO = 0.1;
+
+	// ツリーの高さの比較で, ゴールデンファイルの値からこの段数までの増加は許す
+	constexpr double TREE_HEIGHT_TOLERANCE = 1.0;
+
+	// 速度の比較で, ゴールデンファイルの値からこの割合以上遅くなったら不一致とする
+	constexpr double TIMING_TOLERANCE_RATIO = 0.2;
+
+	// 速度の比較で, 差がこれ未満であれば計測誤差とみなす [ms]
+	constexpr double TIMING_TOLERANCE_MIN_MS = 0.05;
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+
+	/// <summary>
+	/// FNV-1aで64bitの値をハッシュに加える
+	/// </summary>
+	uint64_t CombineHash(uint64_t hash, const uint64_t value)
+	{
+		constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+		for (int i = 0; i < 8; ++i)
+		{
+			hash ^= (value >> (i * 8)) & 0xFFull;
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+
+	/// <summary>
+	/// リーフの平均の深さ. リーフが無ければ0
+	/// </summary>
+	double GetMeanLeafDepth(const std::vector<int>& num_leaves_per_depth)
+	{
+		int64_t num_leaves = 0;
+		int64_t total_depth = 0;
+		for (size_t depth = 0; depth < num_leaves_per_depth.size(); ++depth)
+		{
+			num_leaves += num_leaves_per_depth[depth];
+			total_depth += static_cast<int64_t>(depth) * num_leaves_per_depth[depth];
+		}
+		return num_leaves > 0 ? static_cast<double>(total_depth) / num_leaves : 0.0;
+	}
+}
+
+CollisionRegressionParams::CollisionRegressionParams()
+	: stage_file_path("resources/stage_templates/stage_template_1.json")
+	, num_stage_copies(1)
+	, num_ticks(600)
+{
+}
+
+CollisionRegression::CollisionRegression(SceneBase* const owner_scene)
+	: _owner_scene(owner_scene)
+	, _num_skipped_actors(0)
+	, _is_stage_loaded(false)
+{
+	assert(_owner_scene);
+}
+
+CollisionRegression::~CollisionRegression()
+{
+	DestroyActors();
+}
+
+bool CollisionRegression::ParseCommandLine(const std::string& command_line, CollisionRegressionParams& out_params, std::string& out_golden_file_path, bool& out_should_write_golden, std::string& out_report_path)
+{
+	std::istringstream iss(command_line);
+	std::vector<std::string> args;
+	std::string arg;
+	while (iss >> arg)
+	{
+		args.push_back(arg);
+	}
+
+	if (std::find(args.begin(), args.end(), "--collision-regression") == args.end())
+	{
+		return false;
+	}
+
+	out_golden_file_path = DEFAULT_GOLDEN_FILE_PATH;
+	out_should_write_golden = false;
+	for (size_t i = 0; i < args.size(); i++)
+	{
+		const bool has_value = i + 1 < args.size();
+		if (args[i] == "--stage-file" && has_value)
+		{
+			out_params.stage_file_path = args[++i];
+		}
+		else if (args[i] == "--golden" && has_value)
+		{
+			out_golden_file_path = args[++i];
+		}
+		else if (args[i] == "--copies" && has_value)
+		{
+			out_params.num_stage_copies = std::stoi(args[++i]);
+		}
+		else if (args[i] == "--ticks" && has_value)
+		{
+			out_params.num_ticks = std::stoi(args[++i]);
+		}
+		else if (args[i] == "--report" && has_value)
+		{
+			out_report_path = args[++i];
+		}
+		else if (args[i] == "--write-golden")
+		{
+			out_should_write_golden = true;
+		}
+	}
+
+	return true;
+}
+
+bool CollisionRegression::LoadStage(const std::string& stage_file_path, const int num_stage_copies)
+{
+	DestroyActors();
+
+	std::ifstream json_file(stage_file_path);
+	if (!json_file.is_open())
+	{
+		return false;
+	}
+
+	Stage stage;
+	stage.FromJsonObject(nlohmann::json::parse(json_file));
+	json_file.close();
+
+	// 静的コライダーはツリーの構築時に静的グリッドに登録されるので, ツリーを作り直す
+	CollisionManager::GetInstance().DestructTree();
+	CollisionManager::GetInstance().SetLayerMatrix(StageInteractiveScene::MakeStageCollisionLayerMatrix());
+
+	// ステージを横に複製して並べ, コライダー数を増やす
+	const float stage_width = stage.GetStageSize().x;
+	for (int copy_index = 0; copy_index < num_stage_copies; ++copy_index)
+	{
+		const Vector2D offset(stage_width * copy_index, 0.f);
+		for (const auto& spawn_info : stage.GetSpawnActorInfosRef())
+		{
+			if (!SpawnColliderActor(*spawn_info, offset))
+			{
+				++_num_skipped_actors;
+			}
+		}
+	}
+
+	// ステージの外壁
+	ActorInitialParams perimeter_params;
+	perimeter_params.transform.position = stage.GetStageLeftTop();
+	StagePerimeterColliderHolder* perimeter = ActorFactory::CreateAndInitializeActor<StagePerimeterColliderHolder>(&perimeter_params, _owner_scene);
+	perimeter->CreateColliders(stage.GetStageLeftTop(), stage.GetStageRightBottom() + Vector2D(stage_width * (num_stage_copies - 1), 0.f));
+	_static_actors.push_back(perimeter);
+
+	CollisionManager::GetInstance().ConstructTree();
+	_is_stage_loaded = true;
+	return true;
+}
+
+Actor* CollisionRegression::SpawnColliderActor(const SpawnActorInfo& spawn_info, const Vector2D& offset)
+{
+	// アクター本体と同じ形状・衝突設定のコライダーを作る. 大きさは各アクターの既定値に合わせる
+	const ActorInitialParams& spawn_params = *spawn_info.initial_params;
+
+	bool is_dynamic = false;
+	Vector2D box_extent(UNIT_TILE_SIZE, UNIT_TILE_SIZE);
+	CollisionType collision_type = CollisionType::BLOCK;
+	CollisionObjectType collision_object_type = CollisionObjectType::NONE;
+	std::vector<CollisionObjectType> hit_targets;
+	bool is_pushable = false;
+	const SlopeBlockInitialParams* slope_params = nullptr;
+
+	switch (spawn_info.entity_type)
+	{
+	case EEntityType::RectangleBlock:
+	{
+		const RectangleBlockInitialParams* rectangle_params = dynamic_cast<const RectangleBlockInitialParams*>(&spawn_params);
+		assert(rectangle_params);
+		box_extent = Vector2D(rectangle_params->tile_count.x, rectangle_params->tile_count.y) * UNIT_TILE_SIZE;
+		collision_object_type = CollisionObjectType::GROUND;
+		hit_targets = { CollisionObjectType::ENEMY, CollisionObjectType::PLAYER, CollisionObjectType::DAMAGE };
+		break;
+	}
+	case EEntityType::SlopeBlock:
+	case EEntityType::SlopeBlock2:
+		slope_params = dynamic_cast<const SlopeBlockInitialParams*>(&spawn_params);
+		assert(slope_params);
+		collision_object_type = CollisionObjectType::GROUND;
+		hit_targets = { CollisionObjectType::ENEMY, CollisionObjectType::PLAYER, CollisionObjectType::DAMAGE };
+		break;
+	case EEntityType::CrackedBrick:
+		collision_object_type = CollisionObjectType::GROUND;
+		hit_targets = { CollisionObjectType::WILDCARD };
+		break;
+	case EEntityType::Player:
+		is_dynamic = true;
+		collision_object_type = CollisionObjectType::PLAYER;
+		hit_targets = {
+			CollisionObjectType::GROUND,
+			CollisionObjectType::BARRIER,
+			CollisionObjectType::ENEMY,
+			CollisionObjectType::ITEM,
+			CollisionObjectType::GIMMICK,
+			CollisionObjectType::GOAL_FLAG
+		};
+		is_pushable = true;
+		break;
+	case EEntityType::WalkingEnemy:
+	case EEntityType::FlyingEnemy:
+	case EEntityType::TacklingEnemy:
+	case EEntityType::ThrowingEnemy:
+		is_dynamic = true;
+		collision_object_type = CollisionObjectType::ENEMY;
+		hit_targets = { CollisionObjectType::PLAYER, CollisionObjectType::DAMAGE, CollisionObjectType::GROUND, CollisionObjectType::BARRIER };
+		is_pushable = true;
+		break;
+	case EEntityType::Coin:
+		collision_type = CollisionType::OVERLAP;
+		collision_object_type = CollisionObjectType::GIMMICK;
+		hit_targets = { CollisionObjectType::PLAYER };
+		break;
+	case EEntityType::ItemActor:
+		is_dynamic = true;
+		collision_type = CollisionType::OVERLAP;
+		collision_object_type = CollisionObjectType::ITEM;
+		hit_targets = { CollisionObjectType::PLAYER };
+		break;
+	case EEntityType::GoalFlag:
+		box_extent = Vector2D(UNIT_TILE_SIZE, UNIT_TILE_SIZE * 2.f);
+		collision_type = CollisionType::OVERLAP;
+		collision_object_type = CollisionObjectType::GOAL_FLAG;
+		hit_targets = { CollisionObjectType::PLAYER };
+		break;
+	default:
+		// 衝突判定を持たない
+		return nullptr;
+	}
+
+	initial_params_of_actor_t<Actor> actor_params;
+	actor_params.transform = spawn_params.transform;
+	actor_params.transform.position += offset;
+	// シーンのTickとDrawの対象にしないため, シーンには追加しない
+	Actor* actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, _owner_scene);
+
+	ColliderBase* collider = nullptr;
+	if (slope_params)
+	{
+		// 右上がりの坂. 左右反転は考慮しない
+		const Vector2D half_size = Vector2D(slope_params->scale * slope_params->width_per_height, slope_params->scale) * (UNIT_TILE_SIZE * 0.5f);
+		TriangleCollider* triangle = actor->CreateComponent<TriangleCollider>(actor);
+		triangle->SetTriangleColliderParams(
+			collision_type, collision_object_type, hit_targets, is_pushable,
+			{ Vector2D(-half_size.x, half_size.y), Vector2D(half_size.x, half_size.y), Vector2D(half_size.x, -half_size.y) }
+		);
+		collider = triangle;
+	}
+	else
+	{
+		BoxCollider* box = actor->CreateComponent<BoxCollider>(actor);
+		box->SetBoxColliderParams(collision_type, collision_object_type, hit_targets, is_pushable, box_extent);
+		collider = box;
+	}
+	_colliders.push_back(collider);
+
+	if (is_dynamic)
+	{
+		_dynamic_actors.push_back(actor);
+		_dynamic_spawn_positions.push_back(actor->GetActorWorldPosition());
+	}
+	else
+	{
+		collider->SetMobility(ColliderMobility::STATIC);
+		_static_actors.push_back(actor);
+	}
+	return actor;
+}
+
+void CollisionRegression::DestroyActors()
+{
+	for (auto& actor : _dynamic_actors)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_dynamic_actors.clear();
+	_dynamic_spawn_positions.clear();
+
+	for (auto& actor : _static_actors)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_static_actors.clear();
+	_colliders.clear();
+	_num_skipped_actors = 0;
+	_is_stage_loaded = false;
+}
+
+void CollisionRegression::StepSimulation(const int tick)
+{
+	// 位置はティック番号だけで決める. 押し戻しの結果は次のティックに持ち越さない
+	const float time = tick * SIMULATION_DELTA_SECONDS;
+	const float angular_speed = 2.f * CLN2D_PI / PATROL_PERIOD_SECONDS;
+	for (size_t i = 0; i < _dynamic_actors.size(); ++i)
+	{
+		const float phase = angular_speed * time + PHASE_STEP * i;
+		const Vector2D displacement(PATROL_AMPLITUDE * sinf(phase), -HOP_HEIGHT * fabsf(sinf(2.f * phase)));
+		_dynamic_actors[i]->SetActorWorldPosition(_dynamic_spawn_positions[i] + displacement);
+	}
+
+	CollisionManager::GetInstance().HandleCollisions();
+}
+
+CollisionRegressionReport CollisionRegression::Run(const CollisionRegressionParams& params)
+{
+	CollisionRegressionReport report{};
+	report.stage_file_path = params.stage_file_path;
+	report.num_stage_copies = params.num_stage_copies;
+	report.num_ticks = params.num_ticks;
+	report.behavior_hash = FNV_OFFSET_BASIS;
+
+	if (!LoadStage(params.stage_file_path, params.num_stage_copies) || params.num_ticks <= 0)
+	{
+		return report;
+	}
+
+	CollisionManager& collision_manager = CollisionManager::GetInstance();
+	for (int tick = 0; tick < params.num_ticks; ++tick)
+	{
+		const auto handle_begin = std::chrono::high_resolution_clock::now();
+		StepSimulation(tick);
+		report.handle_collisions_ms_per_tick += GetElapsedMilliseconds(handle_begin);
+
+		const CollisionManager::CollisionStats& stats = collision_manager.GetStats();
+		report.total_candidate_pairs += stats.num_candidate_pairs;
+		report.total_filtered_pairs += stats.num_filtered_pairs;
+		report.total_hits += stats.num_hits;
+		report.max_tree_height = (std::max)(report.max_tree_height, stats.tree_height);
+		report.broadphase_ms_per_tick += stats.broadphase_ms;
+		report.narrowphase_ms_per_tick += stats.narrowphase_ms;
+		report.resolve_ms_per_tick += stats.resolve_ms;
+
+		// NOTE: ペア数はブロードフェーズの作り方で変わるので, ハッシュには含めない. 挙動はヒット数と押し戻し後の位置だけで決まる
+		report.behavior_hash = CombineHash(report.behavior_hash, static_cast<uint64_t>(stats.num_hits));
+		report.behavior_hash = CombineHash(report.behavior_hash, static_cast<uint64_t>(stats.num_swept_hits));
+		for (const Actor* const actor : _dynamic_actors)
+		{
+			const Vector2D position = actor->GetActorWorldPosition();
+			report.behavior_hash = CombineHash(report.behavior_hash, static_cast<uint64_t>(llroundf(position.x * POSITION_HASH_RESOLUTION)));
+			report.behavior_hash = CombineHash(report.behavior_hash, static_cast<uint64_t>(llroundf(position.y * POSITION_HASH_RESOLUTION)));
+		}
+	}
+
+	report.num_static_colliders = collision_manager.GetStats().num_static_colliders;
+	report.num_dynamic_colliders = static_cast<int>(_dynamic_actors.size());
+	report.num_skipped_actors = _num_skipped_actors;
+	collision_manager.GetLeafDepthHistogram(report.num_leaves_per_depth);
+
+	report.handle_collisions_ms_per_tick /= params.num_ticks;
+	report.broadphase_ms_per_tick /= params.num_ticks;
+	report.narrowphase_ms_per_tick /= params.num_ticks;
+	report.resolve_ms_per_tick /= params.num_ticks;
+	return report;
+}
+
+void CollisionRegression::GetReportEntries(const CollisionRegressionReport& report, std::vector<std::pair<std::string, std::string>>& out_behavior_entries, std::vector<ToleranceEntry>& out_performance_entries, std::vector<ToleranceEntry>& out_timing_entries)
+{
+	std::ostringstream behavior_hash;
+	behavior_hash << std::hex << report.behavior_hash;
+
+	out_behavior_entries = {
+		{ "stage_file", report.stage_file_path },
+		{ "num_stage_copies", std::to_string(report.num_stage_copies) },
+		{ "num_ticks", std::to_string(report.num_ticks) },
+		{ "num_static_colliders", std::to_string(report.num_static_colliders) },
+		{ "num_dynamic_colliders", std::to_string(report.num_dynamic_colliders) },
+		{ "num_skipped_actors", std::to_string(report.num_skipped_actors) },
+		{ "total_hits", std::to_string(report.total_hits) },
+		{ "behavior_hash", behavior_hash.str() },
+	};
+	out_performance_entries = {
+		{ "total_candidate_pairs", static_cast<double>(report.total_candidate_pairs), PAIRS_TOLERANCE_RATIO, 0.0 },
+		{ "total_filtered_pairs", static_cast<double>(report.total_filtered_pairs), PAIRS_TOLERANCE_RATIO, 0.0 },
+		{ "max_tree_height", static_cast<double>(report.max_tree_height), 0.0, TREE_HEIGHT_TOLERANCE },
+		{ "mean_leaf_depth", GetMeanLeafDepth(report.num_leaves_per_depth), LEAF_DEPTH_TOLERANCE_RATIO, 0.0 },
+	};
+	out_timing_entries = {
+		{ "broadphase_ms_per_tick", report.broadphase_ms_per_tick, TIMING_TOLERANCE_RATIO, TIMING_TOLERANCE_MIN_MS },
+		{ "narrowphase_ms_per_tick", report.narrowphase_ms_per_tick, TIMING_TOLERANCE_RATIO, TIMING_TOLERANCE_MIN_MS },
+		{ "resolve_ms_per_tick", report.resolve_ms_per_tick, TIMING_TOLERANCE_RATIO, TIMING_TOLERANCE_MIN_MS },
+		{ "handle_collisions_ms_per_tick", report.handle_collisions_ms_per_tick, TIMING_TOLERANCE_RATIO, TIMING_TOLERANCE_MIN_MS },
+	};
+}
+
+bool CollisionRegression::WriteGoldenFile(const std::string& golden_file_path, const CollisionRegressionReport& report)
+{
+	std::ofstream golden_file(golden_file_path);
+	if (!golden_file.is_open())
+	{
+		return false;
+	}
+
+	std::vector<std::pair<std::string, std::string>> behavior_entries;
+	std::vector<ToleranceEntry> performance_entries;
+	std::vector<ToleranceEntry> timing_entries;
+	GetReportEntries(report, behavior_entries, performance_entries, timing_entries);
+
+	// 1行に1項目, キーと値を空白で区切る. #で始まる行は比較に使わない
+	golden_file << "# collision regression golden (CollisionRegression)\n";
+	golden_file << "# behavior: exact match\n";
+	for (const auto& [key, value] : behavior_entries)
+	{
+		golden_file << key << ' ' << value << '\n';
+	}
+
+	golden_file << "# broadphase: must not grow beyond the tolerance\n";
+	golden_file << "# leaves_per_depth";
+	for (size_t depth = 0; depth < report.num_leaves_per_depth.size(); ++depth)
+	{
+		golden_file << (depth > 0 ? "," : " ") << report.num_leaves_per_depth[depth];
+	}
+	golden_file << '\n';
+	for (const ToleranceEntry& entry : performance_entries)
+	{
+		golden_file << entry.key << ' ' << entry.value << '\n';
+	}
+
+	golden_file << "# timing [ms]: must not grow beyond the tolerance\n";
+	for (const ToleranceEntry& entry : timing_entries)
+	{
+		golden_file << entry.key << ' ' << entry.value << '\n';
+	}
+	return golden_file.good();
+}
+
+bool CollisionRegression::CompareWithGoldenFile(const std::string& golden_file_path, const CollisionRegressionReport& report, std::vector<std::string>& out_mismatches, const bool should_compare_timings)
+{
+	out_mismatches.clear();
+
+	std::ifstream golden_file(golden_file_path);
+	if (!golden_file.is_open())
+	{
+		out_mismatches.push_back("failed to open " + golden_file_path);
+		return false;
+	}
+
+	std::unordered_map<std::string, std::string> golden_values;
+	std::string line;
+	while (std::getline(golden_file, line))
+	{
+		const size_t separator = line.find(' ');
+		if (line.empty() || line[0] == '#' || separator == std::string::npos)
+		{
+			continue;
+		}
+		golden_values[line.substr(0, separator)] = line.substr(separator + 1);
+	}
+
+	std::vector<std::pair<std::string, std::string>> behavior_entries;
+	std::vector<ToleranceEntry> performance_entries;
+	std::vector<ToleranceEntry> timing_entries;
+	GetReportEntries(report, behavior_entries, performance_entries, timing_entries);
+
+	for (const auto& [key, value] : behavior_entries)
+	{
+		const auto it = golden_values.find(key);
+		if (it == golden_values.end())
+		{
+			out_mismatches.push_back(key + ": missing in golden");
+		}
+		else if (it->second != value)
+		{
+			out_mismatches.push_back(key + ": expected " + it->second + ", got " + value);
+		}
+	}
+
+	const auto compare_with_tolerance = [&golden_values, &out_mismatches](const ToleranceEntry& entry)
+		{
+			const auto it = golden_values.find(entry.key);
+			if (it == golden_values.end())
+			{
+				out_mismatches.push_back(entry.key + ": missing in golden");
+				return;
+			}
+
+			const double golden_value = std::stod(it->second);
+			if (entry.value > golden_value * (1.0 + entry.tolerance_ratio) && entry.value - golden_value > entry.tolerance_min)
+			{
+				std::ostringstream message;
+				message << entry.key << ": regressed from " << golden_value << " to " << entry.value;
+				out_mismatches.push_back(message.str());
+			}
+		};
+
+	for (const ToleranceEntry& entry : performance_entries)
+	{
+		compare_with_tolerance(entry);
+	}
+
+	if (should_compare_timings)
+	{
+		for (const ToleranceEntry& entry : timing_entries)
+		{
+			compare_with_tolerance(entry);
+		}
+	}
+
+	return out_mismatches.empty();
+}
+
+std::string CollisionRegression::FormatReport(const CollisionRegressionReport& report)
+{
+	char buffer[512];
+	snprintf(
+		buffer, sizeof(buffer),
+		"x%d  ticks %d  static %d  dynamic %d  pairs %lld  filtered %lld  hits %lld  height %d  hash %016llx  broad %.3f  narrow %.3f  resolve %.3f  handle %.3f ms",
+		report.num_stage_copies,
+		report.num_ticks,
+		report.num_static_colliders,
+		report.num_dynamic_colliders,
+		static_cast<long long>(report.total_candidate_pairs),
+		static_cast<long long>(report.total_filtered_pairs),
+		static_cast<long long>(report.total_hits),
+		report.max_tree_height,
+		static_cast<unsigned long long>(report.behavior_hash),
+		report.broadphase_ms_per_tick,
+		report.narrowphase_ms_per_tick,
+		report.resolve_ms_per_tick,
+		report.handle_collisions_ms_per_tick
+	);
+	return buffer;
+}
@@ -0,0 +1,157 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Utility/Core/Math/Vector2D.h"
+
+class SceneBase;
+class Actor;
+class ColliderBase;
+struct SpawnActorInfo;
+
+/// <summary>
+/// CollisionRegression::Run()の設定
+/// </summary>
+struct CollisionRegressionParams
+{
+	CollisionRegressionParams();
+
+	std::string stage_file_path;
+
+	// ステージを横に複製して並べる数
+	int num_stage_copies;
+
+	int num_ticks;
+};
+
+/// <summary>
+/// CollisionRegression::Run()の結果
+/// </summary>
+struct CollisionRegressionReport
+{
+	// 条件と挙動. ゴールデンファイルとの比較では完全に一致する必要がある
+	std::string stage_file_path;
+	int num_stage_copies;
+	int num_static_colliders;
+	int num_dynamic_colliders;
+	int num_skipped_actors;		// コライダーを生成しなかったスポーン情報の数
+	int num_ticks;
+	int64_t total_hits;
+	uint64_t behavior_hash;		// ティックごとのヒット数と, 押し戻し後の動的コライダーの位置のハッシュ
+
+	// ブロードフェーズの効率. ツリーの作り方で変わるので, ゴールデンファイルの値から許容範囲を超えて増えていれば不一致とする
+	int64_t total_candidate_pairs;
+	int64_t total_filtered_pairs;
+	int max_tree_height;
+	std::vector<int> num_leaves_per_depth;	// 最後のティックでのツリーの深さごとのリーフ数. 比較には平均の深さを使う
+
+	// 速度. ゴールデンファイルの値から許容範囲を超えて遅くなっていれば不一致とする
+	double broadphase_ms_per_tick;
+	double narrowphase_ms_per_tick;
+	double resolve_ms_per_tick;
+	double handle_collisions_ms_per_tick;
+};
+
+/// <summary>
+/// 実際のステージJSONを使った, 衝突処理のベンチマークと回帰テスト
+/// <para>ステージのスポーン情報ごとに, アクター本体の代わりに同じ形状・設定のコライダーだけを持つアクターを生成し, 決まった動きで num_ticks ティック分の衝突処理を行う</para>
+/// <para>アクターのTickや描画, 入力に依存しないので, 同じステージと設定なら毎回同じ結果になる</para>
+/// <para>結果をゴールデンファイルに書き出しておき, ブロードフェーズなどを変更した後に比較することで, 挙動の変化と速度の低下を検出する</para>
+/// <para>TestSceneImpl_7から対話的に, または--collision-regressionを指定してコマンドラインから実行する</para>
+/// </summary>
+class CollisionRegression
+{
+public:
+	/// <param name="owner_scene">生成するアクターの所属シーン. アクターはシーンに追加しない</param>
+	explicit CollisionRegression(SceneBase* const owner_scene);
+	~CollisionRegression();
+
+	CollisionRegression(const CollisionRegression&) = delete;
+	CollisionRegression& operator=(const CollisionRegression&) = delete;
+
+	/// <summary>
+	/// コマンドライン引数から設定を読み取る
+	/// <para>--collision-regression --stage-file [JSON] --golden [ファイル] [--copies N] [--ticks N] [--write-golden] [--report [ファイル]]</para>
+	/// </summary>
+	/// <returns>--collision-regressionが指定されていたか</returns>
+	static bool ParseCommandLine(const std::string& command_line, CollisionRegressionParams& out_params, std::string& out_golden_file_path, bool& out_should_write_golden, std::string& out_report_path);
+
+	/// <summary>
+	/// ステージJSONを読み込み, コライダーを生成し直す
+	/// </summary>
+	/// <returns>読み込みに成功したか</returns>
+	bool LoadStage(const std::string& stage_file_path, const int num_stage_copies);
+
+	void DestroyActors();
+
+	/// <summary>
+	/// 動的コライダーをティック番号から決まる位置に移動させ, 衝突処理を行う
+	/// </summary>
+	void StepSimulation(const int tick);
+
+	/// <summary>
+	/// ステージを読み込み直し, num_ticks ティック分のシミュレーションを行って結果をまとめる
+	/// <para>読み込みに失敗した場合, 衝突処理の項目が0のままの結果を返す</para>
+	/// </summary>
+	CollisionRegressionReport Run(const CollisionRegressionParams& params);
+
+	bool IsStageLoaded() const { return _is_stage_loaded; }
+	const std::vector<ColliderBase*>& GetColliders() const { return _colliders; }
+	int GetNumDynamicColliders() const { return static_cast<int>(_dynamic_actors.size()); }
+	int GetNumSkippedActors() const { return _num_skipped_actors; }
+
+	/// <summary>
+	/// 結果をゴールデンファイルに書き出す
+	/// </summary>
+	/// <returns>書き出しに成功したか</returns>
+	static bool WriteGoldenFile(const std::string& golden_file_path, const CollisionRegressionReport& report);
+
+	/// <summary>
+	/// 結果をゴールデンファイルと比較する
+	/// </summary>
+	/// <param name="out_mismatches">一致しなかった項目の説明</param>
+	/// <param name="should_compare_timings">速度も比較するか. ゴールデンファイルを書き出したマシン以外で比較する場合はfalseにする</param>
+	/// <returns>全項目が一致したか. ファイルが開けない場合はfalse</returns>
+	static bool CompareWithGoldenFile(const std::string& golden_file_path, const CollisionRegressionReport& report, std::vector<std::string>& out_mismatches, const bool should_compare_timings = true);
+
+	/// <summary>
+	/// 結果を1行にまとめた文字列
+	/// </summary>
+	static std::string FormatReport(const CollisionRegressionReport& report);
+
+private:
+	/// <summary>
+	/// スポーン情報に対応するコライダーを持つアクターを生成する
+	/// </summary>
+	/// <param name="spawn_info">スポーン情報</param>
+	/// <param name="offset">スポーン位置に加える移動量. ステージを複製して並べるのに使う</param>
+	/// <returns>生成したアクター. 衝突判定を持たないエンティティの場合はnullptr</returns>
+	Actor* SpawnColliderActor(const SpawnActorInfo& spawn_info, const Vector2D& offset);
+
+	/// <summary>
+	/// ゴールデンファイルの, 許容範囲を持つ項目. golden_value * (1 + tolerance_ratio)を超え, かつ差がtolerance_minを超えたら不一致とする
+	/// </summary>
+	struct ToleranceEntry
+	{
+		std::string key;
+		double value;
+		double tolerance_ratio;
+		double tolerance_min;
+	};
+
+	/// <summary>
+	/// ゴールデンファイルに書き出す項目. 挙動, ブロードフェーズの効率, 速度の項目に分ける
+	/// </summary>
+	static void GetReportEntries(const CollisionRegressionReport& report, std::vector<std::pair<std::string, std::string>>& out_behavior_entries, std::vector<ToleranceEntry>& out_performance_entries, std::vector<ToleranceEntry>& out_timing_entries);
+
+	SceneBase* _owner_scene;
+
+	std::vector<Actor*> _static_actors;
+	std::vector<Actor*> _dynamic_actors;
+	std::vector<ColliderBase*> _colliders;
+
+	// 動的コライダーのスポーン位置. ティックごとの位置はここからの変位で決める
+	std::vector<Vector2D> _dynamic_spawn_positions;
+
+	int _num_skipped_actors;
+	bool _is_stage_loaded;
+};
@@ -0,0 +1,3 @@
+#include "HeadlessPlatform.h"
+
+bool HeadlessPlatform::_is_enabled = false;
@@ -0,0 +1,22 @@
+#pragma once
+
+/// <summary>
+/// 描画, サウンド, 入力デバイスを使わずにゲームを動かすヘッドレス実行モード
+/// <para>有効な間, SceneBaseはスクリーンを作らず描画処理を行わない. 画像とサウンドはロードせず, 無効なハンドル(-1)を返す. パーティクルはCPUで更新だけ行う</para>
+/// <para>入力はDeviceInput::SetInputSource()で設定した供給元から受け取る</para>
+/// <para>Windows版ではDxLibをウィンドウ非表示で初期化して使う(Main.cppのRunHeadless()). tests/CMakeLists.txtのビルドでは, DxLib, Direct3D 11, ImGuiの代わりにヘッドレスのプラットフォーム層(source/Platform/Headless)を使う</para>
+/// <para>tests/test_headless_stage.cppは, プラットフォーム層の上でステージを読み込み, スクリプトの入力で動かす</para>
+/// </summary>
+class HeadlessPlatform
+{
+public:
+	/// <summary>
+	/// ヘッドレス実行モードを有効にする. 最初のシーンを生成する前に1回だけ呼ぶ
+	/// </summary>
+	static void Enable() { _is_enabled = true; }
+
+	static bool IsEnabled() { return _is_enabled; }
+
+private:
+	static bool _is_enabled;
+};
@@ -0,0 +1,323 @@
+#include "HeadlessRunner.h"
+#include "Core.h"
+#include <imgui.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/GameObjectManager.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Sound/SoundManager.h"
+#include "GameSystems/SystemTimer.h"
+#include "Input/DeviceInput.h"
+#include "Input/ScriptedInputSource.h"
+#include "GameSystems/InputReplay/InputPlaybackSource.h"
+#include "Utility/Core/Math/RandomNumberGenerator.h"
+#include "Scene/StageInteractiveScene/InGameScene/InGameScene.h"
+
+namespace
+{
+	constexpr float DEFAULT_SIMULATED_SECONDS = 60.f;
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+
+	InGameScene* LoadStage(const SceneBaseInitialParams* const scene_params, HeadlessRunReport& report)
+	{
+		const auto load_begin = std::chrono::high_resolution_clock::now();
+		InGameScene* scene = GameObjectManager::GetInstance().CreateObject<InGameScene>();
+		scene->Initialize(scene_params);
+		report.num_stage_loads++;
+		report.max_stage_load_ms = std::max(report.max_stage_load_ms, GetElapsedMilliseconds(load_begin));
+		return scene;
+	}
+
+	/// <summary>
+	/// 終了時のキャッシュの統計から, 実行前の回数を引く
+	/// </summary>
+	AssetCacheStats GetCacheStatsSince(const AssetCacheStats& end, const AssetCacheStats& begin)
+	{
+		AssetCacheStats stats = end;
+		stats.num_hits -= begin.num_hits;
+		stats.num_misses -= begin.num_misses;
+		stats.num_evictions -= begin.num_evictions;
+		return stats;
+	}
+
+	void WriteCacheStats(const AssetCacheStats& stats, nlohmann::json& out_json)
+	{
+		out_json["num_hits"] = stats.num_hits;
+		out_json["num_misses"] = stats.num_misses;
+		out_json["num_evictions"] = stats.num_evictions;
+		out_json["num_resident"] = stats.num_resident;
+		out_json["resident_bytes"] = stats.resident_bytes;
+		out_json["budget_bytes"] = stats.budget_bytes;
+	}
+
+	void UnloadStage(InGameScene*& scene)
+	{
+		scene->Finalize();
+		GameObjectManager::GetInstance().DestroyObject(scene);
+		scene = nullptr;
+	}
+}
+
+HeadlessRunParams::HeadlessRunParams()
+	: stage_id(StageId::NONE)
+	, simulated_seconds(DEFAULT_SIMULATED_SECONDS)
+	, frame_seconds(1.f / FRAME_RATE)
+	, should_continue_on_retry(true)
+{
+}
+
+bool HeadlessRunner::ParseCommandLine(const std::string& command_line, HeadlessRunParams& out_params, std::string& out_report_path)
+{
+	std::istringstream iss(command_line);
+	std::vector<std::string> args;
+	std::string arg;
+	while (iss >> arg)
+	{
+		args.push_back(arg);
+	}
+
+	if (std::find(args.begin(), args.end(), "--headless") == args.end())
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < args.size(); i++)
+	{
+		const bool has_value = i + 1 < args.size();
+		if (args[i] == "--stage" && has_value)
+		{
+			out_params.stage_id = StageId(args[++i]);
+		}
+		else if (args[i] == "--seconds" && has_value)
+		{
+			out_params.simulated_seconds = std::stof(args[++i]);
+		}
+		else if (args[i] == "--fps" && has_value)
+		{
+			out_params.frame_seconds = 1.f / std::stof(args[++i]);
+		}
+		else if (args[i] == "--input" && has_value)
+		{
+			out_params.input_script_path = args[++i];
+		}
+		else if (args[i] == "--replay" && has_value)
+		{
+			out_params.input_recording_path = args[++i];
+		}
+		else if (args[i] == "--report" && has_value)
+		{
+			out_report_path = args[++i];
+		}
+		else if (args[i] == "--no-retry")
+		{
+			out_params.should_continue_on_retry = false;
+		}
+	}
+
+	return true;
+}
+
+HeadlessRunReport HeadlessRunner::Run(const HeadlessRunParams& params)
+{
+	assert(HeadlessPlatform::IsEnabled());
+	assert(ImGui::GetCurrentContext() != nullptr);
+
+	// 記録を再生する場合は, 記録のステージと経過時間と入力を使う
+	const bool is_replay = !params.input_recording_path.empty();
+	InputRecording recording;
+	if (is_replay)
+	{
+		recording.LoadFromFile(params.input_recording_path);
+	}
+	const StageId stage_id = is_replay ? recording.stage_id : params.stage_id;
+
+	if (!stage_id.IsValid())
+	{
+		throw std::runtime_error("HeadlessRunner: invalid stage id");
+	}
+	if (params.frame_seconds <= 0.f)
+	{
+		throw std::runtime_error("HeadlessRunner: frame_seconds must be positive");
+	}
+
+	HeadlessRunReport report{};
+	report.exit_scene_type = SceneType::INGAME_SCENE;
+	report.first_diverged_frame = -1;
+
+	ScriptedInputSource script_source;
+	InputPlaybackSource playback_source(recording);
+	if (is_replay)
+	{
+		DeviceInput::SetInputSource(&playback_source);
+		RandomNumberGenerator::SetSeed(recording.random_seed);
+	}
+	else
+	{
+		if (!params.input_script_path.empty())
+		{
+			script_source.LoadFromFile(params.input_script_path);
+		}
+		DeviceInput::SetInputSource(&script_source);
+	}
+	DeviceInput::ReleaseAllKey();
+
+	SystemTimer::GetInstance().Init();
+
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(WINDOW_SIZE_X, WINDOW_SIZE_Y);
+	io.DeltaTime = params.frame_seconds;
+
+	const AssetCacheStats graphic_cache_begin = GraphicResourceManager::GetInstance().GetCacheStats();
+	const AssetCacheStats sound_cache_begin = SoundManager::GetInstance().GetCacheStats();
+
+	const auto run_begin = std::chrono::high_resolution_clock::now();
+
+	const StageInteractiveSceneInitialParams initial_params(SceneType::NONE, stage_id);
+	InGameScene* scene = LoadStage(&initial_params, report);
+
+	// NOTE: 記録はSceneManagerでのプレイなので, シーン遷移後の入力のリセットも同じように行う
+	if (is_replay)
+	{
+		DeviceInput::ResetAll();
+	}
+
+	while (true)
+	{
+		// このフレームの経過時間と入力
+		float frame_seconds = params.frame_seconds;
+		if (is_replay)
+		{
+			if (!playback_source.AdvanceFrame(frame_seconds))
+			{
+				break;
+			}
+		}
+		else
+		{
+			if (report.simulated_seconds >= params.simulated_seconds)
+			{
+				break;
+			}
+			script_source.Advance(frame_seconds);
+		}
+
+		const auto frame_begin = std::chrono::high_resolution_clock::now();
+
+		SystemTimer::GetInstance().Update();
+		io.DeltaTime = frame_seconds;
+		ImGui::NewFrame();
+
+		DeviceInput::Tick();
+
+		const float delta_seconds = frame_seconds * scene->GetGameSpeed();
+		const SceneType next_scene_type = scene->ExecuteTick(delta_seconds);
+
+		ImGui::EndFrame();
+
+		report.num_frames++;
+		report.simulated_seconds += delta_seconds;
+		report.max_num_actors = std::max(report.max_num_actors, scene->GetNumActors());
+		report.max_frame_ms = std::max(report.max_frame_ms, GetElapsedMilliseconds(frame_begin));
+
+		const ParticleSpawnStats& spawn_stats = scene->GetFrameCostStats().particle_spawn;
+		report.num_spawned_particles += spawn_stats.num_particles;
+		report.num_dropped_particles += spawn_stats.num_dropped_particles;
+		report.max_particle_spawn_ms = std::max(report.max_particle_spawn_ms, spawn_stats.generate_ms + spawn_stats.submit_ms);
+
+		if (is_replay && scene->ComputeWorldStateHash() != playback_source.GetRecordedWorldStateHash())
+		{
+			if (report.num_diverged_frames == 0)
+			{
+				report.first_diverged_frame = playback_source.GetFrameIndex();
+			}
+			report.num_diverged_frames++;
+		}
+
+		if (next_scene_type == SceneType::MSG_RELOAD && (params.should_continue_on_retry || is_replay))
+		{
+			// 読み込み直す前にステップ数を集計する. 時計は新しいシーンで0から数え直す
+			report.num_world_steps += scene->GetSimulationClock().GetStats().num_total_steps;
+
+			std::unique_ptr<const SceneBaseInitialParams> retry_params = scene->GetInitialParamsForNextScene(SceneType::INGAME_SCENE);
+			UnloadStage(scene);
+			scene = LoadStage(retry_params.get(), report);
+
+			if (is_replay)
+			{
+				DeviceInput::ResetAll();
+			}
+			else
+			{
+				// リトライ後は最初から同じ操作をする
+				script_source.Rewind();
+				DeviceInput::ReleaseAllKey();
+			}
+		}
+		else if (next_scene_type != SceneType::INGAME_SCENE)
+		{
+			report.exit_scene_type = next_scene_type;
+			break;
+		}
+	}
+
+	report.num_world_steps += scene->GetSimulationClock().GetStats().num_total_steps;
+	UnloadStage(scene);
+
+	report.wall_seconds = GetElapsedMilliseconds(run_begin) / 1000.0;
+	report.simulated_seconds_per_wall_second = report.wall_seconds > 0.0 ? report.simulated_seconds / report.wall_seconds : 0.0;
+	report.graphic_cache = GetCacheStatsSince(GraphicResourceManager::GetInstance().GetCacheStats(), graphic_cache_begin);
+	report.sound_cache = GetCacheStatsSince(SoundManager::GetInstance().GetCacheStats(), sound_cache_begin);
+
+	SystemTimer::GetInstance().Finalize();
+	DeviceInput::SetInputSource(nullptr);
+	if (is_replay)
+	{
+		RandomNumberGenerator::ResetSeed();
+	}
+
+	return report;
+}
+
+void HeadlessRunner::WriteReport(const HeadlessRunReport& report, const std::string& file_path)
+{
+	if (file_path.empty())
+	{
+		return;
+	}
+
+	nlohmann::json report_json;
+	report_json["num_frames"] = report.num_frames;
+	report_json["num_stage_loads"] = report.num_stage_loads;
+	report_json["max_stage_load_ms"] = report.max_stage_load_ms;
+	report_json["num_world_steps"] = report.num_world_steps;
+	report_json["simulated_seconds"] = report.simulated_seconds;
+	report_json["wall_seconds"] = report.wall_seconds;
+	report_json["simulated_seconds_per_wall_second"] = report.simulated_seconds_per_wall_second;
+	report_json["max_frame_ms"] = report.max_frame_ms;
+	report_json["max_num_actors"] = report.max_num_actors;
+	report_json["num_spawned_particles"] = report.num_spawned_particles;
+	report_json["num_dropped_particles"] = report.num_dropped_particles;
+	report_json["max_particle_spawn_ms"] = report.max_particle_spawn_ms;
+	WriteCacheStats(report.graphic_cache, report_json["graphic_cache"]);
+	WriteCacheStats(report.sound_cache, report_json["sound_cache"]);
+	report_json["exit_scene_type"] = static_cast<int>(report.exit_scene_type);
+	report_json["num_diverged_frames"] = report.num_diverged_frames;
+	report_json["first_diverged_frame"] = report.first_diverged_frame;
+
+	std::ofstream ofs(file_path);
+	if (!ofs)
+	{
+		throw std::runtime_error("Failed to open headless report file: " + file_path);
+	}
+	ofs << report_json.dump(4) << std::endl;
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <string>
+#include "Scene/SceneType.h"
+#include "Utility/AssetCache.h"
+#include "Scene/StageInteractiveScene/Stage/internal/StageId.h"
+
+/// <summary>
+/// HeadlessRunner::Run()の設定
+/// </summary>
+struct HeadlessRunParams
+{
+	HeadlessRunParams();
+
+	StageId stage_id;
+
+	// ワールドを進める時間の合計(ゲーム速度を反映した値)
+	float simulated_seconds;
+
+	// 1フレームの経過時間. 実時間とは無関係に, 毎フレームこの値でシーンを進める
+	float frame_seconds;
+
+	// ScriptedInputSourceのJSONファイル. 空の場合はキーを何も押さない
+	std::string input_script_path;
+
+	// InputRecordingのファイル. 指定した場合はstage_id, frame_seconds, input_script_pathの代わりに記録のステージ, 経過時間, 入力を使い, 記録の最後のフレームまで再生する
+	std::string input_recording_path;
+
+	// trueの場合, リトライ(SceneType::MSG_RELOAD)でステージを読み込み直して続ける. falseの場合はそこで終了する
+	bool should_continue_on_retry;
+};
+
+/// <summary>
+/// HeadlessRunner::Run()の結果
+/// </summary>
+struct HeadlessRunReport
+{
+	int num_frames;
+	int num_stage_loads;
+
+	// ステージの読み込み(リトライでの読み込み直しを含む)にかかった時間の最大値
+	double max_stage_load_ms;
+	uint64_t num_world_steps;
+	double simulated_seconds;
+	double wall_seconds;
+
+	// 実時間1秒あたりに進めたワールドの時間
+	double simulated_seconds_per_wall_second;
+
+	double max_frame_ms;
+	size_t max_num_actors;
+
+	// 生成したパーティクル数と, プールの空きが足りず捨てたパーティクル数. 生成にかかった時間の1フレームあたりの最大値
+	uint64_t num_spawned_particles;
+	uint64_t num_dropped_particles;
+	double max_particle_spawn_ms;
+
+	// 画像とサウンドのキャッシュ. ヒット数, ミス数, 解放数は実行中に増えた分で, 常駐しているサイズは終了時の値
+	AssetCacheStats graphic_cache;
+	AssetCacheStats sound_cache;
+
+	// 終了時にシーンが要求した遷移先. 時間を進めきって終了した場合はSceneType::INGAME_SCENE
+	SceneType exit_scene_type;
+
+	// 記録の再生時, ワールドのハッシュ値が記録と一致しなかったフレーム数と, その最初のフレーム(一致した場合は-1)
+	int num_diverged_frames;
+	int first_diverged_frame;
+};
+
+/// <summary>
+/// ヘッドレス実行モードでステージを読み込み, 描画を待たずに最大速度でシーンを進める
+/// <para>長時間の連続実行テストや, 実時間1秒あたりに進められるワールドの時間の計測に使う</para>
+/// <para>NOTE: HeadlessPlatform::Enable()とImGuiコンテキストの作成を済ませてから呼ぶ. シーンのTick()がImGuiを使う場合があるため, 毎フレームImGuiのフレームを開始/終了する</para>
+/// </summary>
+class HeadlessRunner
+{
+public:
+	/// <summary>
+	/// コマンドライン引数から設定を読み取る. "--headless"が含まれない場合はfalseを返す
+	/// <para>--headless --stage [UUID] [--seconds 秒] [--fps フレームレート] [--input スクリプト] [--replay 記録] [--report 出力先] [--no-retry]</para>
+	/// </summary>
+	static bool ParseCommandLine(const std::string& command_line, HeadlessRunParams& out_params, std::string& out_report_path);
+
+	/// <summary>
+	/// ステージを読み込み, params.simulated_secondsだけ進めるか, シーンが別のシーンへの遷移を要求するまで実行する
+	/// <para>記録を再生する場合は, 記録の最後のフレームまでか, シーンが別のシーンへの遷移を要求するまで実行する</para>
+	/// </summary>
+	static HeadlessRunReport Run(const HeadlessRunParams& params);
+
+	/// <summary>
+	/// 結果をJSONファイルに書き出す. 空のパスの場合は何もしない
+	/// </summary>
+	static void WriteReport(const HeadlessRunReport& report, const std::string& file_path);
+};
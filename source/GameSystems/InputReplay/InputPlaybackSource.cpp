@@ -0,0 +1,42 @@
+#include "InputPlaybackSource.h"
+#include <cassert>
+
+InputPlaybackSource::InputPlaybackSource(const InputRecording& recording)
+	: _recording(recording)
+	, _frame_index(-1)
+{
+}
+
+InputPlaybackSource::~InputPlaybackSource()
+{
+}
+
+void InputPlaybackSource::Poll(DeviceInputSnapshot& out_snapshot)
+{
+	assert(_frame_index >= 0 && !IsFinished());
+	out_snapshot = _recording.GetFrames()[_frame_index].snapshot;
+}
+
+bool InputPlaybackSource::AdvanceFrame(float& out_delta_seconds)
+{
+	if (_frame_index + 1 >= static_cast<int>(_recording.GetNumFrames()))
+	{
+		_frame_index = static_cast<int>(_recording.GetNumFrames());
+		return false;
+	}
+
+	_frame_index++;
+	out_delta_seconds = _recording.GetFrames()[_frame_index].delta_seconds;
+	return true;
+}
+
+uint32_t InputPlaybackSource::GetRecordedWorldStateHash() const
+{
+	assert(_frame_index >= 0 && !IsFinished());
+	return _recording.GetFrames()[_frame_index].world_state_hash;
+}
+
+bool InputPlaybackSource::IsFinished() const
+{
+	return _frame_index >= static_cast<int>(_recording.GetNumFrames());
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Input/DeviceInputSource.h"
+#include "GameSystems/InputReplay/InputRecording.h"
+
+/// <summary>
+/// InputRecordingのフレームを順に供給するDeviceInputSource
+/// <para>毎フレーム, DeviceInput::Tick()の前にAdvanceFrame()を呼び, 戻り値の経過時間でシーンを進める</para>
+/// </summary>
+class InputPlaybackSource : public DeviceInputSource
+{
+public:
+	explicit InputPlaybackSource(const InputRecording& recording);
+	virtual ~InputPlaybackSource();
+
+	//~ Begin DeviceInputSource interface
+public:
+	virtual void Poll(DeviceInputSnapshot& out_snapshot) override;
+	//~ End DeviceInputSource interface
+
+public:
+	/// <summary>
+	/// 次のフレームに進め, そのフレームの経過時間を返す. 最後のフレームを過ぎている場合は何もせずfalseを返す
+	/// </summary>
+	bool AdvanceFrame(float& out_delta_seconds);
+
+	/// <summary>
+	/// 現在のフレームの, 記録時のワールドのハッシュ値
+	/// </summary>
+	uint32_t GetRecordedWorldStateHash() const;
+
+	/// <summary>
+	/// 現在のフレームの番号. AdvanceFrame()を呼ぶ前は-1
+	/// </summary>
+	int GetFrameIndex() const { return _frame_index; }
+
+	bool IsFinished() const;
+
+private:
+	const InputRecording& _recording;
+	int _frame_index;
+};
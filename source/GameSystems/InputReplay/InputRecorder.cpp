@@ -0,0 +1,76 @@
+#include "InputRecorder.h"
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include "Utility/Core/Math/RandomNumberGenerator.h"
+
+InputRecorder::InputRecorder()
+	: _is_recording(false)
+{
+}
+
+void InputRecorder::BeginRecording(const StageId& stage_id)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	_recording.Clear();
+	_recording.stage_id = stage_id;
+	_recording.random_seed = RandomNumberGenerator::GenerateSeed();
+	RandomNumberGenerator::SetSeed(_recording.random_seed);
+
+	_is_recording = true;
+}
+
+void InputRecorder::RecordFrame(const float delta_seconds, const DeviceInputSnapshot& snapshot, const uint32_t world_state_hash)
+{
+	if (!_is_recording)
+	{
+		return;
+	}
+
+	InputRecording::Frame frame;
+	frame.delta_seconds = delta_seconds;
+	frame.snapshot = snapshot;
+	frame.world_state_hash = world_state_hash;
+	_recording.AddFrame(frame);
+}
+
+void InputRecorder::EndRecording()
+{
+	if (!_is_recording)
+	{
+		return;
+	}
+	_is_recording = false;
+
+	RandomNumberGenerator::ResetSeed();
+
+	// [ステージのUUID]_[日時].inputrec
+	const std::time_t now = std::time(nullptr);
+	std::tm local_time{};
+#ifdef _WIN32
+	localtime_s(&local_time, &now);
+#else
+	localtime_r(&now, &local_time);
+#endif
+	std::ostringstream oss;
+	oss << _output_directory << "/" << _recording.stage_id.ToUUIDFormatString()
+		<< "_" << std::put_time(&local_time, "%Y%m%d_%H%M%S") << ".inputrec";
+
+	try
+	{
+		_recording.SaveToFile(oss.str());
+	}
+	catch (const std::exception& e)
+	{
+		// 記録の失敗でゲームを止めない
+		std::cerr << "InputRecorder::EndRecording: " << e.what() << std::endl;
+	}
+
+	_recording.Clear();
+}
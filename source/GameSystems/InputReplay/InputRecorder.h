@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+#include "GameSystems/InputReplay/InputRecording.h"
+
+/// <summary>
+/// InGameSceneのプレイを, 開始から終了(リトライを含む)まで1つのInputRecordingとして記録し, ファイルに書き出す
+/// <para>SceneManagerがシーンの遷移と更新に合わせて呼び出す. 出力先のディレクトリを設定していない場合は何もしない</para>
+/// </summary>
+class InputRecorder
+{
+public:
+	InputRecorder();
+
+	/// <summary>
+	/// 記録の出力先. 空の場合は記録しない
+	/// </summary>
+	void SetOutputDirectory(const std::string& directory) { _output_directory = directory; }
+	bool IsEnabled() const { return !_output_directory.empty(); }
+
+	bool IsRecording() const { return _is_recording; }
+
+	/// <summary>
+	/// 記録中のステージ. 記録していない場合はStageId::NONE
+	/// </summary>
+	const StageId& GetStageId() const { return _recording.stage_id; }
+
+	/// <summary>
+	/// 記録を開始する. 乱数生成器をこの記録のシードで作り直すので, シーンの初期化の前に呼ぶ
+	/// </summary>
+	void BeginRecording(const StageId& stage_id);
+
+	/// <summary>
+	/// シーンの更新1回分を記録する
+	/// </summary>
+	/// <param name="delta_seconds">ゲーム速度を掛ける前の経過時間</param>
+	/// <param name="snapshot">このフレームにDeviceInput::Tick()でポーリングした入力状態</param>
+	/// <param name="world_state_hash">更新後のSceneBase::ComputeWorldStateHash()</param>
+	void RecordFrame(const float delta_seconds, const DeviceInputSnapshot& snapshot, const uint32_t world_state_hash);
+
+	/// <summary>
+	/// 記録を終了してファイルに書き出す. 乱数生成器は非決定的なシードに戻す
+	/// </summary>
+	void EndRecording();
+
+private:
+	std::string _output_directory;
+	bool _is_recording;
+	InputRecording _recording;
+};
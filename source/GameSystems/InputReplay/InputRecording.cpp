@@ -0,0 +1,141 @@
+#include "InputRecording.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+	constexpr char FILE_MAGIC[8] = { 'C', 'L', 'N', 'I', 'N', 'R', 'E', 'C' };
+	constexpr uint32_t FILE_VERSION = 1;
+
+	template<typename T>
+	void WriteValue(std::ofstream& ofs, const T& value)
+	{
+		ofs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<typename T>
+	void ReadValue(std::ifstream& ifs, T& out_value)
+	{
+		ifs.read(reinterpret_cast<char*>(&out_value), sizeof(T));
+		if (!ifs)
+		{
+			throw std::runtime_error("Input recording file is truncated");
+		}
+	}
+}
+
+InputRecording::InputRecording()
+	: random_seed(0)
+	, stage_id(StageId::NONE)
+{
+}
+
+void InputRecording::Clear()
+{
+	random_seed = 0;
+	stage_id = StageId::NONE;
+	_frames.clear();
+}
+
+void InputRecording::SaveToFile(const std::string& file_path) const
+{
+	std::ofstream ofs(file_path, std::ios::binary);
+	if (!ofs)
+	{
+		throw std::runtime_error("Failed to open input recording file: " + file_path);
+	}
+
+	ofs.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+	WriteValue(ofs, FILE_VERSION);
+	WriteValue(ofs, random_seed);
+	WriteValue(ofs, stage_id.GetHighBits());
+	WriteValue(ofs, stage_id.GetLowBits());
+	WriteValue(ofs, static_cast<uint32_t>(_frames.size()));
+
+	// キーはほとんどのフレームで変化しないので, 前のフレームから変化したキーコードだけを書く
+	char last_key_buf[DeviceInputSnapshot::KEY_BUFFER_SIZE] = {};
+	std::vector<uint8_t> changed_keys;
+	for (const Frame& frame : _frames)
+	{
+		WriteValue(ofs, frame.delta_seconds);
+		WriteValue(ofs, frame.world_state_hash);
+		WriteValue(ofs, static_cast<int32_t>(frame.snapshot.mouse_input));
+		WriteValue(ofs, static_cast<int32_t>(frame.snapshot.mouse_wheel_rot));
+		WriteValue(ofs, frame.snapshot.mouse_position.x);
+		WriteValue(ofs, frame.snapshot.mouse_position.y);
+
+		changed_keys.clear();
+		for (int i = 0; i < DeviceInputSnapshot::KEY_BUFFER_SIZE; i++)
+		{
+			if (frame.snapshot.key_buf[i] != last_key_buf[i])
+			{
+				changed_keys.push_back(static_cast<uint8_t>(i));
+			}
+		}
+		WriteValue(ofs, static_cast<uint16_t>(changed_keys.size()));
+		ofs.write(reinterpret_cast<const char*>(changed_keys.data()), changed_keys.size());
+
+		std::memcpy(last_key_buf, frame.snapshot.key_buf, sizeof(last_key_buf));
+	}
+
+	if (!ofs)
+	{
+		throw std::runtime_error("Failed to write input recording file: " + file_path);
+	}
+}
+
+void InputRecording::LoadFromFile(const std::string& file_path)
+{
+	std::ifstream ifs(file_path, std::ios::binary);
+	if (!ifs)
+	{
+		throw std::runtime_error("Failed to open input recording file: " + file_path);
+	}
+
+	char magic[sizeof(FILE_MAGIC)];
+	ifs.read(magic, sizeof(magic));
+	uint32_t version = 0;
+	ReadValue(ifs, version);
+	if (std::memcmp(magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || version != FILE_VERSION)
+	{
+		throw std::runtime_error("Unsupported input recording file: " + file_path);
+	}
+
+	Clear();
+
+	uint64_t stage_id_high_bits = 0;
+	uint64_t stage_id_low_bits = 0;
+	uint32_t num_frames = 0;
+	ReadValue(ifs, random_seed);
+	ReadValue(ifs, stage_id_high_bits);
+	ReadValue(ifs, stage_id_low_bits);
+	ReadValue(ifs, num_frames);
+	stage_id = StageId(stage_id_high_bits, stage_id_low_bits);
+
+	_frames.resize(num_frames);
+	char key_buf[DeviceInputSnapshot::KEY_BUFFER_SIZE] = {};
+	for (Frame& frame : _frames)
+	{
+		int32_t mouse_input = 0;
+		int32_t mouse_wheel_rot = 0;
+		ReadValue(ifs, frame.delta_seconds);
+		ReadValue(ifs, frame.world_state_hash);
+		ReadValue(ifs, mouse_input);
+		ReadValue(ifs, mouse_wheel_rot);
+		ReadValue(ifs, frame.snapshot.mouse_position.x);
+		ReadValue(ifs, frame.snapshot.mouse_position.y);
+		frame.snapshot.mouse_input = mouse_input;
+		frame.snapshot.mouse_wheel_rot = mouse_wheel_rot;
+
+		uint16_t num_changed_keys = 0;
+		ReadValue(ifs, num_changed_keys);
+		for (uint16_t i = 0; i < num_changed_keys; i++)
+		{
+			uint8_t key_code = 0;
+			ReadValue(ifs, key_code);
+			key_buf[key_code] = key_buf[key_code] ? 0 : 1;
+		}
+		std::memcpy(frame.snapshot.key_buf, key_buf, sizeof(key_buf));
+	}
+}
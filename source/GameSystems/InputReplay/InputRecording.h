@@ -0,0 +1,48 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Input/DeviceInputSource.h"
+#include "Scene/StageInteractiveScene/Stage/internal/StageId.h"
+
+/// <summary>
+/// InGameSceneの1回のプレイを再現するための記録
+/// <para>乱数のシード, ステージ, フレームごとの経過時間と入力状態を持つ. 同じシードで乱数生成器を作り直し, 同じ順に入力と経過時間を与えれば同じ更新結果になる</para>
+/// <para>各フレームには更新後のワールドのハッシュ値(SceneBase::ComputeWorldStateHash())も残し, 再生時に一致を確認する</para>
+/// </summary>
+class InputRecording
+{
+public:
+	struct Frame
+	{
+		// SceneBase::GetGameSpeed()を掛ける前の経過時間
+		float delta_seconds;
+
+		DeviceInputSnapshot snapshot;
+
+		uint32_t world_state_hash;
+	};
+
+	InputRecording();
+
+	void Clear();
+
+	void AddFrame(const Frame& frame) { _frames.push_back(frame); }
+	const std::vector<Frame>& GetFrames() const { return _frames; }
+	size_t GetNumFrames() const { return _frames.size(); }
+
+	/// <summary>
+	/// ファイルに書き出す. キーの状態は前のフレームから変化したキーだけを書く. 書き出せない場合は例外を投げる
+	/// </summary>
+	void SaveToFile(const std::string& file_path) const;
+
+	/// <summary>
+	/// SaveToFile()で書き出したファイルを読み込む. 形式が違う場合は例外を投げる
+	/// </summary>
+	void LoadFromFile(const std::string& file_path);
+
+	uint64_t random_seed;
+	StageId stage_id;
+
+private:
+	std::vector<Frame> _frames;
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+/// <summary>
+/// マスターデータIDの型
+/// <para>マスターデータ本体(MasterDataBase.h)に依存せずにIDだけを扱うモジュールは, このヘッダーだけをインクルードする</para>
+/// </summary>
+using MasterDataID = unsigned long;
+constexpr MasterDataID INVALID_MASTER_ID = 0;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Utility/Core/FileUtil.h"
+#include "GameSystems/MasterData/MasterDataID.h"
 #include <tchar.h>
 #include <vector>
 #include <string>
@@ -8,12 +9,6 @@
 #include <stdint.h>
 #include <algorithm>
 
-/// <summary>
-/// マスターデータIDの型
-/// </summary>
-using MasterDataID = unsigned long;
-constexpr MasterDataID INVALID_MASTER_ID = 0;
-
 // CRTP基底クラス. 
 // 派生クラスにはメンバ関数GetMembers(), GetMapKey()の実装が必要
 // std::tuple<T0&, T1&, T2& ...> GetMembers()
@@ -1,5 +1,6 @@
 #pragma once
 #include "MasterData.h"
+#include <nlohmann/json.hpp>
 #include <imgui.h>
 #include "Utility/ImGui/internal/ImGuiExtensions.h"
 namespace MasterHelper {
@@ -0,0 +1,429 @@
+#include "CpuParticleSimulator.h"
+#include <algorithm>
+#include <cassert>
+
+// AVX2が有効なビルドでは8個ずつ, x64などSSE2が使える環境では4個ずつ, それ以外は1個ずつ更新する
+#if !defined(CLN2D_DISABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define CLN2D_PARTICLE_SIMD_AVX2
+#elif !defined(CLN2D_DISABLE_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CLN2D_PARTICLE_SIMD_SSE2
+#endif
+
+namespace
+{
+	// SoA配列の長さをこの倍数に切り上げる. どのSIMD幅でも末尾の読み書きが配列の範囲内に収まる
+	constexpr uint32_t SIMD_PADDING = 8;
+
+	uint32_t RoundUpToPadding(const uint32_t size)
+	{
+		return (size + SIMD_PADDING - 1) / SIMD_PADDING * SIMD_PADDING;
+	}
+
+	uint32_t GetMaxLoop(const uint32_t packed_data)
+	{
+		return (packed_data & Particle::max_loop_mask) >> Particle::max_loop_shift;
+	}
+
+	/// <summary>
+	/// ParticleCS.hlslのフレームのインクリメントの可否. i_frame < offset + (num_anim_frames - offset) * max_loop - 1
+	/// <para>NOTE: シェーダーと同じく符号無し整数で計算する</para>
+	/// </summary>
+	bool CanAdvanceFrame(const uint32_t i_frame, const uint32_t loop_start_offset, const uint32_t num_anim_frames, const uint32_t max_loop)
+	{
+		return max_loop == 0 || i_frame < loop_start_offset + (num_anim_frames - loop_start_offset) * max_loop - 1;
+	}
+
+	////////~ Begin SIMD wrappers
+	//
+	// Tick()は以下の型と関数だけを使って書き, SIMD命令セットごとの違いはここに閉じ込める
+	// SimdFloat: float をWIDTH個並べたもの. SimdMask: 比較結果
+	//
+#if defined(CLN2D_PARTICLE_SIMD_AVX2)
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 8;
+		__m256 v;
+	};
+	struct SimdMask
+	{
+		__m256 v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+	inline SimdFloat Set(const float x) { return { _mm256_set1_ps(x) }; }
+	inline void Store(float* p, const SimdFloat& a) { _mm256_storeu_ps(p, a.v); }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { _mm256_add_ps(a.v, b.v) }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { _mm256_sub_ps(a.v, b.v) }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { _mm256_mul_ps(a.v, b.v) }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { _mm256_div_ps(a.v, b.v) }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { _mm256_min_ps(a.v, b.v) }; }
+	inline SimdFloat Max(const SimdFloat& a, const SimdFloat& b) { return { _mm256_max_ps(a.v, b.v) }; }
+	inline SimdMask operator>(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { _mm256_and_ps(a.v, b.v) }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+	inline uint32_t ToBits(const SimdMask& mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask.v)); }
+
+	/// <summary>
+	/// packed_dataのis_activeが0でないレーン
+	/// </summary>
+	inline SimdMask LoadIsActive(const uint32_t* packed_data)
+	{
+		const __m256i is_active = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(packed_data)), _mm256_set1_epi32(static_cast<int>(Particle::is_active_mask)));
+		const __m256i is_inactive = _mm256_cmpeq_epi32(is_active, _mm256_setzero_si256());
+		return { _mm256_castsi256_ps(_mm256_xor_si256(is_inactive, _mm256_set1_epi32(-1))) };
+	}
+
+	/// <summary>
+	/// float(i_frame + 1)
+	/// </summary>
+	inline SimdFloat LoadNextFrameCount(const uint32_t* i_frame)
+	{
+		return { _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(i_frame)), _mm256_set1_epi32(1))) };
+	}
+
+#elif defined(CLN2D_PARTICLE_SIMD_SSE2)
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 4;
+		__m128 v;
+	};
+	struct SimdMask
+	{
+		__m128 v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { _mm_loadu_ps(p) }; }
+	inline SimdFloat Set(const float x) { return { _mm_set1_ps(x) }; }
+	inline void Store(float* p, const SimdFloat& a) { _mm_storeu_ps(p, a.v); }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { _mm_add_ps(a.v, b.v) }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { _mm_sub_ps(a.v, b.v) }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { _mm_mul_ps(a.v, b.v) }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { _mm_div_ps(a.v, b.v) }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { _mm_min_ps(a.v, b.v) }; }
+	inline SimdFloat Max(const SimdFloat& a, const SimdFloat& b) { return { _mm_max_ps(a.v, b.v) }; }
+	inline SimdMask operator>(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { _mm_and_ps(a.v, b.v) }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+	inline uint32_t ToBits(const SimdMask& mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask.v)); }
+
+	inline SimdMask LoadIsActive(const uint32_t* packed_data)
+	{
+		const __m128i is_active = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(packed_data)), _mm_set1_epi32(static_cast<int>(Particle::is_active_mask)));
+		const __m128i is_inactive = _mm_cmpeq_epi32(is_active, _mm_setzero_si128());
+		return { _mm_castsi128_ps(_mm_xor_si128(is_inactive, _mm_set1_epi32(-1))) };
+	}
+
+	inline SimdFloat LoadNextFrameCount(const uint32_t* i_frame)
+	{
+		return { _mm_cvtepi32_ps(_mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(i_frame)), _mm_set1_epi32(1))) };
+	}
+
+#else
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 1;
+		float v;
+	};
+	struct SimdMask
+	{
+		bool v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { *p }; }
+	inline SimdFloat Set(const float x) { return { x }; }
+	inline void Store(float* p, const SimdFloat& a) { *p = a.v; }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { a.v + b.v }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { a.v - b.v }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { a.v * b.v }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { a.v / b.v }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { a.v < b.v ? a.v : b.v }; }
+	inline SimdFloat Max(const SimdFloat& a, const SimdFloat& b) { return { a.v > b.v ? a.v : b.v }; }
+	inline SimdMask operator>(const SimdFloat& a, const SimdFloat& b) { return { a.v > b.v }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { a.v >= b.v }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { a.v && b.v }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return { mask.v ? a.v : b.v }; }
+	inline uint32_t ToBits(const SimdMask& mask) { return mask.v ? 1u : 0u; }
+
+	inline SimdMask LoadIsActive(const uint32_t* packed_data) { return { (*packed_data & Particle::is_active_mask) != 0 }; }
+	inline SimdFloat LoadNextFrameCount(const uint32_t* i_frame) { return { static_cast<float>(*i_frame + 1) }; }
+#endif
+	//
+	////////~ End SIMD wrappers
+}
+
+CpuParticleSimulator::CpuParticleSimulator(const uint32_t capacity)
+	: _capacity(capacity)
+	, _padded_capacity(RoundUpToPadding(capacity))
+	, _pool_count(0)
+{
+	assert(capacity > 0);
+
+	for (std::vector<float>* array : { &_pos_x, &_pos_y, &_vel_x, &_vel_y, &_age, &_life_time, &_alpha, &_gravity_scale, &_frame_duration,
+		&_size, &_world_transform_pos_x, &_world_transform_pos_y, &_world_transform_rot })
+	{
+		array->assign(_padded_capacity, 0.f);
+	}
+	for (std::vector<uint32_t>* array : { &_i_frame, &_packed_data, &_anim_first_frame, &_loop_start_offset, &_num_anim_frames })
+	{
+		array->assign(_padded_capacity, 0);
+	}
+
+	// Tick()は_capacity個全てが同時に寿命を迎えても確保し直さない
+	_pool.resize(_capacity);
+	_retired_ids.reserve(_capacity);
+
+	// 全てのスロットをプールに入れる. 小さいIDから取り出されるように逆順に並べる
+	for (uint32_t i = 0; i < _capacity; i++)
+	{
+		_pool[i] = _capacity - 1 - i;
+	}
+	_pool_count.store(_capacity);
+}
+
+CpuParticleSimulator::~CpuParticleSimulator()
+{
+}
+
+bool CpuParticleSimulator::Spawn(const Particle* spawn_particles, const uint32_t num_spawn)
+{
+	const uint32_t* ids = ConsumeFromPool(num_spawn);
+	if (!ids)
+	{
+		return false;
+	}
+
+	for (uint32_t i = 0; i < num_spawn; i++)
+	{
+		const Particle& p = spawn_particles[i];
+		const uint32_t id = ids[i];
+
+		_pos_x[id] = p.pos.x;
+		_pos_y[id] = p.pos.y;
+		_vel_x[id] = p.vel.x;
+		_vel_y[id] = p.vel.y;
+		_age[id] = p.age;
+		_life_time[id] = p.life_time;
+		_alpha[id] = p.alpha;
+		_gravity_scale[id] = p.gravity_scale;
+		_frame_duration[id] = p.frame_duration;
+		_i_frame[id] = p.i_frame;
+		_anim_first_frame[id] = p.anim_first_frame;
+		_loop_start_offset[id] = p.loop_start_offset;
+		_num_anim_frames[id] = p.num_anim_frames;
+		_size[id] = p.size;
+		_world_transform_pos_x[id] = p.world_transform_pos.x;
+		_world_transform_pos_y[id] = p.world_transform_pos.y;
+		_world_transform_rot[id] = p.world_transform_rot;
+
+		// パーティクルをアクティブに
+		_packed_data[id] = (p.packed_data & ~Particle::is_active_mask) | (1u << Particle::is_active_shift);
+	}
+
+	return true;
+}
+
+void CpuParticleSimulator::Tick(const float delta_seconds, const float gravity_force_x, const float gravity_force_y)
+{
+	constexpr int WIDTH = SimdFloat::WIDTH;
+
+	const SimdFloat dt = Set(delta_seconds);
+	const SimdFloat gx = Set(gravity_force_x);
+	const SimdFloat gy = Set(gravity_force_y);
+	const SimdFloat zero = Set(0.f);
+	const SimdFloat half = Set(0.5f);
+	const SimdFloat one = Set(1.f);
+	const SimdFloat two = Set(2.f);
+
+	_retired_ids.clear();
+
+	for (uint32_t i = 0; i < _padded_capacity; i += WIDTH)
+	{
+		const SimdMask is_active = LoadIsActive(&_packed_data[i]);
+		if (ToBits(is_active) == 0)
+		{
+			continue;
+		}
+
+		// 速度, 位置
+		const SimdFloat gravity_scale = Load(&_gravity_scale[i]);
+		SimdFloat vel_x = Load(&_vel_x[i]);
+		SimdFloat vel_y = Load(&_vel_y[i]);
+		vel_x = Select(is_active, vel_x + gravity_scale * gx * dt, vel_x);
+		vel_y = Select(is_active, vel_y + gravity_scale * gy * dt, vel_y);
+		Store(&_vel_x[i], vel_x);
+		Store(&_vel_y[i], vel_y);
+		Store(&_pos_x[i], Select(is_active, Load(&_pos_x[i]) + vel_x * dt, Load(&_pos_x[i])));
+		Store(&_pos_y[i], Select(is_active, Load(&_pos_y[i]) + vel_y * dt, Load(&_pos_y[i])));
+
+		// アニメーションフレーム. フレームが進むのはframe_durationごとなので, 該当するレーンだけ1個ずつ処理する
+		const SimdFloat age = Load(&_age[i]);
+		const uint32_t frame_update_bits = ToBits(is_active & (age >= Load(&_frame_duration[i]) * LoadNextFrameCount(&_i_frame[i])));
+		for (int lane = 0; frame_update_bits != 0 && lane < WIDTH; lane++)
+		{
+			const uint32_t id = i + lane;
+			if ((frame_update_bits & (1u << lane)) && CanAdvanceFrame(_i_frame[id], _loop_start_offset[id], _num_anim_frames[id], GetMaxLoop(_packed_data[id])))
+			{
+				_i_frame[id]++;
+			}
+		}
+
+		// アルファ値
+		const SimdFloat life_time = Load(&_life_time[i]);
+		const SimdFloat t = age / life_time;
+		const SimdFloat faded_alpha = Min(Max(one - two * (t - half), zero), one);
+		Store(&_alpha[i], Select(is_active & (t > half), faded_alpha, Load(&_alpha[i])));
+
+		// 経過時間. 寿命を迎えたものは非アクティブにしてプールに戻す
+		const SimdFloat new_age = Select(is_active, age + dt, age);
+		Store(&_age[i], new_age);
+		const uint32_t retire_bits = ToBits(is_active & (new_age >= life_time));
+		for (int lane = 0; retire_bits != 0 && lane < WIDTH; lane++)
+		{
+			if ((retire_bits & (1u << lane)) == 0)
+			{
+				continue;
+			}
+			const uint32_t id = i + lane;
+			_packed_data[id] &= ~Particle::is_active_mask;
+			_retired_ids.push_back(id);
+		}
+	}
+
+	AppendToPool(_retired_ids.data(), static_cast<uint32_t>(_retired_ids.size()));
+}
+
+void CpuParticleSimulator::DeactivateAll()
+{
+	_retired_ids.clear();
+	for (uint32_t id = 0; id < _capacity; id++)
+	{
+		if (_packed_data[id] & Particle::is_active_mask)
+		{
+			_packed_data[id] &= ~Particle::is_active_mask;
+			_retired_ids.push_back(id);
+		}
+	}
+	AppendToPool(_retired_ids.data(), static_cast<uint32_t>(_retired_ids.size()));
+}
+
+uint32_t CpuParticleSimulator::GetPoolCount() const
+{
+	return _pool_count.load(std::memory_order_acquire);
+}
+
+Particle CpuParticleSimulator::GetParticle(const uint32_t index) const
+{
+	assert(index < _capacity);
+
+	Particle p;
+	p.size = _size[index];
+	p.life_time = _life_time[index];
+	p.age = _age[index];
+	p.alpha = _alpha[index];
+	p.gravity_scale = _gravity_scale[index];
+	p.pos.x = _pos_x[index];
+	p.pos.y = _pos_y[index];
+	p.vel.x = _vel_x[index];
+	p.vel.y = _vel_y[index];
+	p.i_frame = _i_frame[index];
+	p.anim_first_frame = _anim_first_frame[index];
+	p.loop_start_offset = _loop_start_offset[index];
+	p.num_anim_frames = _num_anim_frames[index];
+	p.frame_duration = _frame_duration[index];
+	p.packed_data = _packed_data[index];
+	p.world_transform_pos.x = _world_transform_pos_x[index];
+	p.world_transform_pos.y = _world_transform_pos_y[index];
+	p.world_transform_rot = _world_transform_rot[index];
+	return p;
+}
+
+void CpuParticleSimulator::ExportParticles(Particle* out_particles) const
+{
+	for (uint32_t i = 0; i < _capacity; i++)
+	{
+		out_particles[i] = GetParticle(i);
+	}
+}
+
+void CpuParticleSimulator::ExportParticles(const uint32_t* indices, const uint32_t num_indices, Particle* out_particles) const
+{
+	for (uint32_t i = 0; i < num_indices; i++)
+	{
+		out_particles[i] = GetParticle(indices[i]);
+	}
+}
+
+int CpuParticleSimulator::GetSimdWidth()
+{
+	return SimdFloat::WIDTH;
+}
+
+bool CpuParticleSimulator::TickParticleReference(Particle& particle, const float delta_seconds, const float gravity_force_x, const float gravity_force_y)
+{
+	const uint32_t is_active = (particle.packed_data & Particle::is_active_mask) >> Particle::is_active_shift;
+	if (is_active == 0)
+	{
+		return false;
+	}
+
+	particle.vel.x += particle.gravity_scale * gravity_force_x * delta_seconds;
+	particle.vel.y += particle.gravity_scale * gravity_force_y * delta_seconds;
+	particle.pos.x += particle.vel.x * delta_seconds;
+	particle.pos.y += particle.vel.y * delta_seconds;
+
+	const bool is_frame_update_timing = particle.age >= particle.frame_duration * static_cast<float>(particle.i_frame + 1);
+	if (is_frame_update_timing)
+	{
+		if (CanAdvanceFrame(particle.i_frame, particle.loop_start_offset, particle.num_anim_frames, GetMaxLoop(particle.packed_data)))
+		{
+			particle.i_frame++;
+		}
+	}
+
+	// アルファ値更新
+	const float age = particle.age;
+	const float life = particle.life_time;
+	const float t = age / life;
+	if (age / life > 0.5f)
+	{
+		particle.alpha = std::min(std::max(1.f - 2.f * (t - 0.5f), 0.f), 1.f);
+	}
+
+	particle.age += delta_seconds;
+	if (particle.age >= particle.life_time)
+	{
+		particle.SetIsActive(0);
+		return true;
+	}
+	return false;
+}
+
+const uint32_t* CpuParticleSimulator::ConsumeFromPool(const uint32_t num)
+{
+	uint32_t pool_count = _pool_count.load(std::memory_order_acquire);
+	do
+	{
+		if (pool_count < num)
+		{
+			return nullptr;
+		}
+	} while (!_pool_count.compare_exchange_weak(pool_count, pool_count - num, std::memory_order_acq_rel));
+
+	return &_pool[pool_count - num];
+}
+
+void CpuParticleSimulator::AppendToPool(const uint32_t* ids, const uint32_t num)
+{
+	if (num == 0)
+	{
+		return;
+	}
+
+	const uint32_t begin = _pool_count.fetch_add(num, std::memory_order_acq_rel);
+	assert(begin + num <= _capacity);
+	std::copy(ids, ids + num, _pool.begin() + begin);
+}
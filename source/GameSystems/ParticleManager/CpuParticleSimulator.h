@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+
+/// <summary>
+/// ParticleCS.hlsl, CSSpawnParticle.hlsl, CSDeactivateAllParticles.hlsl と同じ処理をCPUで行うパーティクルシミュレーター
+/// <para>パーティクルはSoA(構造体の配列ではなく, メンバごとの配列)で保持し, Tick()ではSSE2/AVX2で複数個ずつまとめて更新する</para>
+/// <para>空きスロットはAppend/ConsumeStructuredBufferの代わりに, 要素数をアトミックに増減するフリーリストで管理する</para>
+/// <para>Direct3Dに依存しないので, GPUの無い環境やヘッドレス実行でも使える</para>
+/// </summary>
+class CpuParticleSimulator
+{
+public:
+	/// <param name="capacity">同時に存在できるパーティクル数. MAX_PARTICLES_NUMを超えてもよい</param>
+	explicit CpuParticleSimulator(const uint32_t capacity = MAX_PARTICLES_NUM);
+	~CpuParticleSimulator();
+
+	// コピー,ムーブの禁止
+	CpuParticleSimulator(const CpuParticleSimulator&) = delete;
+	CpuParticleSimulator& operator=(const CpuParticleSimulator&) = delete;
+	CpuParticleSimulator(CpuParticleSimulator&&) = delete;
+	CpuParticleSimulator& operator=(CpuParticleSimulator&&) = delete;
+
+	/// <summary>
+	/// CSSpawnParticle.hlslに相当. プールから取り出したスロットにspawn_particlesをコピーし, アクティブにする
+	/// <para>プールのパーティクルが足りない場合は何もせずfalseを返す</para>
+	/// </summary>
+	bool Spawn(const Particle* spawn_particles, const uint32_t num_spawn);
+
+	/// <summary>
+	/// ParticleCS.hlslに相当. アクティブなパーティクルの速度, 位置, アニメーションフレーム, アルファ値, 経過時間を更新し, 寿命を迎えたものをプールに戻す
+	/// </summary>
+	void Tick(const float delta_seconds, const float gravity_force_x, const float gravity_force_y);
+
+	/// <summary>
+	/// CSDeactivateAllParticles.hlslに相当. 全てのパーティクルを非アクティブにしてプールに戻す
+	/// </summary>
+	void DeactivateAll();
+
+	uint32_t GetCapacity() const { return _capacity; }
+	uint32_t GetPoolCount() const;
+	uint32_t GetNumActiveParticles() const { return _capacity - GetPoolCount(); }
+
+	/// <summary>
+	/// index番目のスロットのパーティクル
+	/// </summary>
+	Particle GetParticle(const uint32_t index) const;
+
+	/// <summary>
+	/// 全てのスロットを構造体の配列に書き出す. 描画用のバッファへのアップロードに使う
+	/// </summary>
+	/// <param name="out_particles">GetCapacity()個の要素を持つ配列</param>
+	void ExportParticles(Particle* out_particles) const;
+
+	/// <summary>
+	/// indicesのスロットを順に構造体の配列に書き出す. ParticleDrawListsで詰めた生存パーティクルだけをアップロードするのに使う
+	/// </summary>
+	/// <param name="out_particles">num_indices個の要素を持つ配列</param>
+	void ExportParticles(const uint32_t* indices, const uint32_t num_indices, Particle* out_particles) const;
+
+	/// <summary>
+	/// 全てのスロットのParticle::packed_data. ParticleDrawLists::Build()に渡す
+	/// </summary>
+	const uint32_t* GetPackedData() const { return _packed_data.data(); }
+
+	/// <summary>
+	/// Tick()で一度に更新するパーティクル数(SIMD幅)
+	/// </summary>
+	static int GetSimdWidth();
+
+	/// <summary>
+	/// ParticleCS.hlslの1スレッド分の処理をそのまま書き写したもの. Tick()の結果の検証に使う
+	/// </summary>
+	/// <returns>寿命を迎えて非アクティブになった場合はtrue</returns>
+	static bool TickParticleReference(Particle& particle, const float delta_seconds, const float gravity_force_x, const float gravity_force_y);
+
+private:
+	/// <summary>
+	/// プールからnum個のスロットを取り出す. 足りない場合はnullptr
+	/// </summary>
+	const uint32_t* ConsumeFromPool(const uint32_t num);
+
+	/// <summary>
+	/// num個のスロットをプールに戻す
+	/// </summary>
+	void AppendToPool(const uint32_t* ids, const uint32_t num);
+
+	uint32_t _capacity;
+
+	// 各配列の長さ. _capacityをSIMD幅の倍数に切り上げた値で, 末尾の余りは常に非アクティブ
+	uint32_t _padded_capacity;
+
+	//~ Tick()で毎回読み書きする値
+	std::vector<float> _pos_x;
+	std::vector<float> _pos_y;
+	std::vector<float> _vel_x;
+	std::vector<float> _vel_y;
+	std::vector<float> _age;
+	std::vector<float> _life_time;
+	std::vector<float> _alpha;
+	std::vector<float> _gravity_scale;
+	std::vector<float> _frame_duration;
+	std::vector<uint32_t> _i_frame;
+	std::vector<uint32_t> _packed_data;
+
+	//~ フレームの進行判定と描画でのみ使う値
+	std::vector<uint32_t> _anim_first_frame;
+	std::vector<uint32_t> _loop_start_offset;
+	std::vector<uint32_t> _num_anim_frames;
+	std::vector<float> _size;
+	std::vector<float> _world_transform_pos_x;
+	std::vector<float> _world_transform_pos_y;
+	std::vector<float> _world_transform_rot;
+
+	// プール. [0, _pool_count)が空きスロットのID
+	// NOTE: GPUでSpawnとTickのディスパッチが重ならないのと同じく, 取り出し(Spawn)と戻し(Tick, DeactivateAll)は同時に行わない.
+	// 取り出し同士, 戻し同士はアトミックな要素数の増減だけで複数スレッドから行える
+	std::vector<uint32_t> _pool;
+	std::atomic<uint32_t> _pool_count;
+
+	// Tick()で寿命を迎えたスロットのID. 最後にまとめてプールに戻す
+	std::vector<uint32_t> _retired_ids;
+};
@@ -1,4 +1,5 @@
 #include "Particle.h"
+#include <cassert>
 
 Particle::Particle()
     : life_time(1.f)
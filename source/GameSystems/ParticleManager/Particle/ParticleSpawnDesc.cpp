@@ -1,4 +1,7 @@
 #include "ParticleSpawnDesc.h"
+#include "Core.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+#include "GameSystems/ParticleManager/ParticleSpawnQueue.h"
 
 void ParticleSpawnDesc::ToJsonObject(nlohmann::json& jobj) const
 {
@@ -32,3 +35,65 @@ ParticleSpawnDesc::ParticleSpawnDesc()
 	, world_transform()
 {
 }
+
+void ParticleSpawnDesc::MakeParticles(Particle* out_particles, const int num_spawn, const unsigned int texture_index) const
+{
+	const MdAnimation& animation = MdAnimation::Get(animation_id);
+	const Vector2D init_pos_world = world_transform.TransformLocation(initial_position);
+
+	for (int i = 0; i < num_spawn; i++)
+	{
+		Particle& p = out_particles[i];
+		p = Particle();
+		p.size = size.GetRandomValueInRange();
+		p.life_time = life_time.GetRandomValueInRange();
+
+		// 初期位置, 初速度
+		p.pos.x = init_pos_world.x;
+		p.pos.y = init_pos_world.y;
+
+		const float rot_angle_deg = RandomNumberGenerator::GetRandomFloat(-velocity_angle_deg * 0.5f, velocity_angle_deg * 0.5f);
+		const Vector2D init_vel_local = Vector2D::Rotate(
+			(initial_velocity_normalized * initial_speed.GetRandomValueInRange()),
+			DX_PI_F * rot_angle_deg / 180.f
+		);
+		const Vector2D init_vel_world = world_transform.TransformDirection(init_vel_local);
+		p.vel.x = init_vel_world.x;
+		p.vel.y = init_vel_world.y;
+
+		p.gravity_scale = gravity_scale.GetRandomValueInRange();
+
+		p.anim_first_frame = animation.first_frame;
+		p.num_anim_frames = animation.num_frames;
+		p.loop_start_offset = animation.loop_start_offset;
+		p.frame_duration = animation.default_frame_duration;
+
+		p.SetBlendMode(static_cast<Particle::uint>(MasterHelper::GetAnimationBlendMode(animation)));
+		p.SetMaxLoop(0);
+		p.SetTextureIndex(texture_index);
+	}
+}
+
+ParticleSpawnRequest ParticleSpawnDesc::MakeSpawnRequest(const int num_spawn) const
+{
+	const Vector2D position = world_transform.TransformLocation(initial_position);
+	const Vector2D velocity_direction = world_transform.TransformDirection(initial_velocity_normalized);
+
+	ParticleSpawnRequest request;
+	request.animation_id = animation_id;
+	request.num_spawn = num_spawn > 0 ? static_cast<uint32_t>(num_spawn) : 0;
+	request.position_x = position.x;
+	request.position_y = position.y;
+	request.velocity_direction_x = velocity_direction.x;
+	request.velocity_direction_y = velocity_direction.y;
+	request.half_velocity_angle = velocity_angle_deg * 0.5f * (DX_PI_F / 180.f);
+	request.size_min = size.min;
+	request.size_range = size.max - size.min;
+	request.life_time_min = life_time.min;
+	request.life_time_range = life_time.max - life_time.min;
+	request.gravity_scale_min = gravity_scale.min;
+	request.gravity_scale_range = gravity_scale.max - gravity_scale.min;
+	request.speed_min = initial_speed.min;
+	request.speed_range = initial_speed.max - initial_speed.min;
+	return request;
+}
@@ -4,6 +4,9 @@
 #include "Utility/Core/MathCore.h"
 #include "Utility/Core/Math/Transform.h"
 
+struct Particle;
+struct ParticleSpawnRequest;
+
 struct ParticleSpawnDesc : public IJsonObject
 {
 	//~ Begin IJsonObject interface
@@ -31,4 +34,17 @@ struct ParticleSpawnDesc : public IJsonObject
 	}
 
 	ParticleSpawnDesc();
+
+	/// <summary>
+	/// 生成情報からnum_spawn個のパーティクルの初期値を作る. 範囲で指定された値は乱数で決める
+	/// </summary>
+	/// <param name="out_particles">num_spawn個の要素を持つ配列</param>
+	/// <param name="texture_index">アニメーションのスプライトのテクスチャ配列内のインデックス</param>
+	void MakeParticles(Particle* out_particles, const int num_spawn, const unsigned int texture_index) const;
+
+	/// <summary>
+	/// ParticleSpawnQueueに追加する生成要求を作る. ワールド変換はこの時点の値を使う
+	/// </summary>
+	/// <param name="num_spawn">生成数. 0以下の場合はnum_spawnが0の(キューが受け付けない)要求になる</param>
+	ParticleSpawnRequest MakeSpawnRequest(const int num_spawn) const;
 };
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "ParticleDrawLists.h"
+#include <algorithm>
+#include <cassert>
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+
+namespace
+{
+	// 非アクティブなスロットはこの個数ずつまとめて読み飛ばす
+	constexpr uint32_t SKIP_BLOCK_SIZE = 8;
+}
+
+ParticleDrawLists::ParticleDrawLists(const uint32_t num_blend_modes, const uint32_t num_textures)
+	: _num_blend_modes(num_blend_modes)
+	, _num_textures(num_textures)
+	, _group_offsets(num_blend_modes * num_textures + 1, 0)
+	, _num_live_particles(0)
+	, _num_rejected_particles(0)
+{
+	assert(num_blend_modes > 0 && num_textures > 0);
+}
+
+ParticleDrawLists::~ParticleDrawLists()
+{
+}
+
+void ParticleDrawLists::Build(const uint32_t* packed_data, const uint32_t num_particles)
+{
+	if (_live_indices.size() < num_particles)
+	{
+		_live_indices.resize(num_particles);
+		_live_groups.resize(num_particles);
+		_indices.resize(num_particles);
+	}
+
+	// 1. 生存しているパーティクルを元の順番のまま詰め, グループごとの数を数える
+	// NOTE: 数は_group_offsets[group + 1]に数えておき, 2.で累積和にする
+	std::fill(_group_offsets.begin(), _group_offsets.end(), 0);
+	uint32_t num_live = 0;
+	uint32_t num_rejected = 0;
+	uint32_t i = 0;
+	while (i < num_particles)
+	{
+		// 非アクティブなスロットが続く区間は, まとめてis_activeを調べて読み飛ばす
+		if (i + SKIP_BLOCK_SIZE <= num_particles)
+		{
+			uint32_t block_bits = 0;
+			for (uint32_t k = 0; k < SKIP_BLOCK_SIZE; k++)
+			{
+				block_bits |= packed_data[i + k];
+			}
+			if ((block_bits & Particle::is_active_mask) == 0)
+			{
+				i += SKIP_BLOCK_SIZE;
+				continue;
+			}
+		}
+
+		const uint32_t end = std::min(i + SKIP_BLOCK_SIZE, num_particles);
+		for (; i < end; i++)
+		{
+			const uint32_t packed = packed_data[i];
+			if ((packed & Particle::is_active_mask) == 0)
+			{
+				continue;
+			}
+
+			const uint32_t blend_mode = (packed & Particle::blend_mode_mask) >> Particle::blend_mode_shift;
+			const uint32_t i_texture = (packed & Particle::i_texture_mask) >> Particle::i_texture_shift;
+			if (blend_mode >= _num_blend_modes || i_texture >= _num_textures)
+			{
+				num_rejected++;
+				continue;
+			}
+
+			const uint32_t group = GetGroupIndex(blend_mode, i_texture);
+			_live_indices[num_live] = i;
+			_live_groups[num_live] = group;
+			_group_offsets[group + 1]++;
+			num_live++;
+		}
+	}
+
+	// 2. 数の累積和から各グループの開始位置を求める
+	for (size_t group = 1; group < _group_offsets.size(); group++)
+	{
+		_group_offsets[group] += _group_offsets[group - 1];
+	}
+
+	// 3. 元の順番を保ったまま, グループごとの位置に振り分ける
+	// NOTE: 開始位置を書き込み位置として使う. 振り分け後は次のグループの開始位置になっているので, 1つずつずらして元に戻す
+	for (uint32_t k = 0; k < num_live; k++)
+	{
+		_indices[_group_offsets[_live_groups[k]]++] = _live_indices[k];
+	}
+	for (size_t group = _group_offsets.size() - 1; group > 0; group--)
+	{
+		_group_offsets[group] = _group_offsets[group - 1];
+	}
+	_group_offsets[0] = 0;
+
+	_num_live_particles = num_live;
+	_num_rejected_particles = num_rejected;
+}
+
+ParticleDrawLists::Range ParticleDrawLists::GetGroupRange(const uint32_t blend_mode, const uint32_t i_texture) const
+{
+	assert(blend_mode < _num_blend_modes && i_texture < _num_textures);
+	const uint32_t group = GetGroupIndex(blend_mode, i_texture);
+	return { _group_offsets[group], _group_offsets[group + 1] - _group_offsets[group] };
+}
+
+ParticleDrawLists::Range ParticleDrawLists::GetBlendModeRange(const uint32_t blend_mode) const
+{
+	assert(blend_mode < _num_blend_modes);
+	const uint32_t first_group = GetGroupIndex(blend_mode, 0);
+	const uint32_t end_group = GetGroupIndex(blend_mode + 1, 0);
+	return { _group_offsets[first_group], _group_offsets[end_group] - _group_offsets[first_group] };
+}
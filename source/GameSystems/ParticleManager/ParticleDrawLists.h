@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 生存しているパーティクルのインデックスを, ブレンドモードとテクスチャごとにまとめた描画リスト
+/// <para>インデックスはブレンドモード, テクスチャ, インデックスの昇順に並ぶので, 1つのブレンドモードのパーティクルは連続した範囲になる</para>
+/// <para>描画ではブレンドモードごとにその範囲のインスタンスだけを描画すればよく, 非アクティブなスロットを頂点シェーダーで捨てる必要がない</para>
+/// <para>Particle::packed_dataだけを読むので, Direct3Dに依存しない</para>
+/// </summary>
+class ParticleDrawLists
+{
+public:
+	/// <summary>
+	/// GetIndices()の中の範囲
+	/// </summary>
+	struct Range
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+	/// <param name="num_blend_modes">ブレンドモードの数. packed_dataのblend_modeがこれ以上のパーティクルはリストに含めない</param>
+	/// <param name="num_textures">テクスチャの数. packed_dataのi_textureがこれ以上のパーティクルはリストに含めない</param>
+	ParticleDrawLists(const uint32_t num_blend_modes, const uint32_t num_textures);
+	~ParticleDrawLists();
+
+	/// <summary>
+	/// packed_dataのis_activeが0でないパーティクルのリストを作り直す
+	/// <para>2回目以降は, パーティクル数が前回以下であれば確保し直さない</para>
+	/// </summary>
+	/// <param name="packed_data">Particle::packed_dataの配列</param>
+	/// <param name="num_particles">配列の要素数</param>
+	void Build(const uint32_t* packed_data, const uint32_t num_particles);
+
+	/// <summary>
+	/// グループ順に並んだ, 生存しているパーティクルのインデックス
+	/// </summary>
+	const uint32_t* GetIndices() const { return _indices.data(); }
+	uint32_t GetNumLiveParticles() const { return _num_live_particles; }
+
+	/// <summary>
+	/// ブレンドモードとテクスチャの組み合わせ1つ分の範囲
+	/// </summary>
+	Range GetGroupRange(const uint32_t blend_mode, const uint32_t i_texture) const;
+
+	/// <summary>
+	/// ブレンドモード1つ分(全てのテクスチャ)の範囲
+	/// </summary>
+	Range GetBlendModeRange(const uint32_t blend_mode) const;
+
+	/// <summary>
+	/// アクティブだが, ブレンドモードかテクスチャが範囲外のためリストに含めなかったパーティクル数
+	/// </summary>
+	uint32_t GetNumRejectedParticles() const { return _num_rejected_particles; }
+
+	uint32_t GetNumBlendModes() const { return _num_blend_modes; }
+	uint32_t GetNumTextures() const { return _num_textures; }
+
+private:
+	uint32_t GetGroupIndex(const uint32_t blend_mode, const uint32_t i_texture) const { return blend_mode * _num_textures + i_texture; }
+
+	uint32_t _num_blend_modes;
+	uint32_t _num_textures;
+
+	// グループごとの_indicesの開始位置. 要素数はグループ数+1で, 最後の要素は_num_live_particles
+	std::vector<uint32_t> _group_offsets;
+
+	std::vector<uint32_t> _indices;
+	uint32_t _num_live_particles;
+	uint32_t _num_rejected_particles;
+
+	// Build()の作業用. 生存しているパーティクルのインデックスとグループを, 元の順番のまま詰めたもの
+	std::vector<uint32_t> _live_indices;
+	std::vector<uint32_t> _live_groups;
+};
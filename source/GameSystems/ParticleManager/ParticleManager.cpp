@@ -1,4 +1,17 @@
 #include "ParticleManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include <chrono>
+
+namespace
+{
+	// 1フレームに受け付ける生成要求数. 1つのエミッターは1フレームに1回だけ要求する
+	constexpr uint32_t MAX_SPAWN_REQUESTS_PER_FRAME = 4096;
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
 
 ParticleManager& ParticleManager::GetInstance()
 {
@@ -6,9 +19,24 @@ ParticleManager& ParticleManager::GetInstance()
 	return instance;
 }
 
-bool ParticleManager::Init()
+bool ParticleManager::Init(const EParticleBackend backend)
 {
 	SafeRelease(p_pm);
+	p_cpu_simulator.reset();
+	_spawn_queue.Clear();
+	_backend = backend;
+
+	if (backend == EParticleBackend::CPU)
+	{
+		p_cpu_simulator = std::make_unique<CpuParticleSimulator>(MAX_PARTICLES_NUM);
+
+		// ヘッドレス実行中は描画しないので, Direct3Dのリソースを作らない
+		if (HeadlessPlatform::IsEnabled())
+		{
+			return true;
+		}
+	}
+
 	p_pm = new ParticleManagerImpl();
 	if (!p_pm)
 	{
@@ -26,6 +54,8 @@ bool ParticleManager::Init()
 
 void ParticleManager::End()
 {
+	_spawn_queue.Clear();
+	p_cpu_simulator.reset();
 	if (p_pm)
 	{
 		p_pm->End();
@@ -35,16 +65,24 @@ void ParticleManager::End()
 
 bool ParticleManager::Spawn(const ParticleSpawnDesc& spawn_desc, const int num_spawn)
 {
-	if (!p_pm)
+	if (!p_cpu_simulator && !p_pm)
 	{
 		return false;
 	}
 
-	return p_pm->Spawn(spawn_desc, num_spawn);
+	return _spawn_queue.Enqueue(spawn_desc.MakeSpawnRequest(num_spawn));
 }
 
 void ParticleManager::Tick(const float delta_seconds)
 {
+	FlushSpawnQueue();
+
+	if (p_cpu_simulator)
+	{
+		p_cpu_simulator->Tick(delta_seconds, 0.f, PARTICLE_GRAVITY_ACCELERATION);
+		return;
+	}
+
 	if (!p_pm)
 	{
 		return;
@@ -53,8 +91,41 @@ void ParticleManager::Tick(const float delta_seconds)
 	p_pm->Tick(delta_seconds);
 }
 
+void ParticleManager::PreloadParticleSprites(const std::vector<MasterDataID>& particle_ids)
+{
+	if (!p_pm)
+	{
+		return;
+	}
+
+	// パーティクルの生成情報からアニメーション, アニメーションからスプライトをたどる
+	std::vector<MasterDataID> sprite_ids;
+	sprite_ids.reserve(particle_ids.size());
+	for (const MasterDataID particle_id : particle_ids)
+	{
+		ParticleSpawnDesc spawn_desc{};
+		spawn_desc.FromJsonObject(MasterHelper::GetParticleJson(particle_id));
+		sprite_ids.push_back(MdAnimation::Get(spawn_desc.animation_id).sprite_id);
+	}
+
+	p_pm->PreloadSpriteTextures(sprite_ids);
+}
+
 void ParticleManager::DeactivateAllParticles()
 {
+	_spawn_queue.Clear();
+
+	if (p_cpu_simulator)
+	{
+		p_cpu_simulator->DeactivateAll();
+		return;
+	}
+
+	if (!p_pm)
+	{
+		return;
+	}
+
 	p_pm->DeactivateAllParticles();
 }
 
@@ -65,16 +136,111 @@ void ParticleManager::Draw(const CameraParams& camera_params)
 		return;
 	}
 
+	if (p_cpu_simulator)
+	{
+		// NOTE: 1フレームにTick()が複数回呼ばれる場合もあるので, リストは描画の直前に1回だけ作る
+		_draw_lists.Build(p_cpu_simulator->GetPackedData(), p_cpu_simulator->GetCapacity());
+		p_pm->UploadParticles(*p_cpu_simulator, _draw_lists);
+		p_pm->Draw(camera_params, &_draw_lists);
+		return;
+	}
 	p_pm->Draw(camera_params);
 }
 
 UINT ParticleManager::GetPoolCount() const
 {
+	if (p_cpu_simulator)
+	{
+		return p_cpu_simulator->GetPoolCount();
+	}
+
+	if (!p_pm)
+	{
+		return 0;
+	}
+
 	return p_pm->GetPoolCount();
 }
 
+ParticleSpawnStats ParticleManager::TakeSpawnStats()
+{
+	const ParticleSpawnStats stats = _spawn_stats;
+	_spawn_stats = ParticleSpawnStats();
+	return stats;
+}
+
+SpriteAtlasStats ParticleManager::GetSpriteAtlasStats() const
+{
+	if (!p_pm)
+	{
+		return SpriteAtlasStats();
+	}
+
+	return p_pm->GetSpriteAtlasStats();
+}
+
+void ParticleManager::FlushSpawnQueue()
+{
+	if (_spawn_queue.IsEmpty())
+	{
+		return;
+	}
+
+	// 乱数列のシードは生成のまとまりごとにRandomNumberGeneratorから1つだけ取る.
+	// 入力の記録の再生でシードを固定すれば, パーティクルも同じ値で生成される
+	const uint64_t batch_seed = RandomNumberGenerator::GetRandomUint64();
+
+	ParticleSpawnStats stats;
+	const uint32_t num_spawn = _spawn_queue.Build(
+		batch_seed,
+		GetPoolCount(),
+		[this](const MasterDataID animation_id) { return ResolveSpawnAnimation(animation_id); },
+		stats
+	);
+
+	if (num_spawn > 0)
+	{
+		const auto submit_begin = std::chrono::high_resolution_clock::now();
+		const bool has_spawned = p_cpu_simulator
+			? p_cpu_simulator->Spawn(_spawn_queue.GetParticles(), num_spawn)
+			: p_pm->SpawnParticles(_spawn_queue.GetParticles(), num_spawn);
+		stats.submit_ms = GetElapsedMilliseconds(submit_begin);
+		stats.num_submits = 1;
+
+		// NOTE: 生成数はプールのパーティクル数以下にしているので, 失敗するのはプールのパーティクル数が古い場合のみ
+		if (!has_spawned)
+		{
+			stats.num_dropped_requests = stats.num_requests;
+			stats.num_dropped_particles += stats.num_particles;
+			stats.num_particles = 0;
+		}
+	}
+
+	_spawn_stats += stats;
+}
+
+ParticleSpawnAnimation ParticleManager::ResolveSpawnAnimation(const MasterDataID animation_id)
+{
+	const MdAnimation& animation = MdAnimation::Get(animation_id);
+
+	ParticleSpawnAnimation spawn_animation = {};
+	spawn_animation.anim_first_frame = animation.first_frame;
+	spawn_animation.num_anim_frames = animation.num_frames;
+	spawn_animation.loop_start_offset = animation.loop_start_offset;
+	spawn_animation.frame_duration = animation.default_frame_duration;
+	spawn_animation.blend_mode = static_cast<uint32_t>(MasterHelper::GetAnimationBlendMode(animation));
+
+	// 描画しない場合はテクスチャを読み込まない
+	spawn_animation.texture_index = p_pm ? p_pm->LoadSpriteTexture(animation.sprite_id) : 0;
+	return spawn_animation;
+}
+
 ParticleManager::ParticleManager()
 	: p_pm(nullptr)
+	, _spawn_queue(MAX_SPAWN_REQUESTS_PER_FRAME, MAX_PARTICLES_NUM)
+	, _spawn_stats()
+	, _draw_lists(static_cast<uint32_t>(EnumInfo<EBlendMode>::List().size()), MAX_TEXTURES_NUM)
+	, _backend(EParticleBackend::GPU)
 {}
 
 ParticleManager::~ParticleManager()
@@ -1,8 +1,20 @@
 #pragma once
 #include "ParticleManagerImpl.h"
+#include "CpuParticleSimulator.h"
+#include "ParticleDrawLists.h"
+#include "ParticleSpawnQueue.h"
 
 // TODO: ParticleManagerをSingleton<ParticleManager>派生クラスにして, Implから実装を移動する
 
+/// <summary>
+/// パーティクルの更新を行う場所
+/// </summary>
+enum class EParticleBackend
+{
+	GPU,	// コンピュートシェーダー(ParticleManagerImpl)で生成, 更新する
+	CPU,	// CpuParticleSimulatorで生成, 更新し, 描画の前にパーティクルバッファへ書き込む
+};
+
 /// <summary>
 /// パーティクルシステムのインターフェース. 本体はParticleManagerImpl
 /// </summary>
@@ -14,8 +26,9 @@ public:
 	/// <summary>
 	/// 初期化
 	/// <para>NOTE: DXライブラリ初期化処理後に呼ぶ</para>
+	/// <para>EParticleBackend::CPUの場合, ヘッドレス実行中は描画用のParticleManagerImplを作らずに更新だけ行う</para>
 	/// </summary>
-	bool Init();
+	bool Init(const EParticleBackend backend = EParticleBackend::GPU);
 
 	/// <summary>
 	/// 終了処理
@@ -25,19 +38,26 @@ public:
 
 	/// <summary>
 	/// パーティクルの生成
+	/// <para>要求はキューに溜め, 次のTick()の最初にそのフレームの全ての要求をまとめて生成する</para>
 	/// </summary>
-	/// <param name="spawn_desc">パーティクル生成情報</param>
+	/// <param name="spawn_desc">パーティクル生成情報. ワールド変換はこの時点の値を使う</param>
 	/// <param name="num_spawn">生成数</param>
-	/// <returns></returns>
+	/// <returns>キューに追加できた場合はtrue. プールが足りない場合は生成時に捨てられる</returns>
 	bool Spawn(const ParticleSpawnDesc& spawn_desc, const int num_spawn = 1);
 
+	/// <summary>
+	/// パーティクル(MdParticleのID)が使うスプライトのテクスチャを先にアトラスへ読み込む
+	/// <para>ステージの読み込み時に呼び, プレイ中に初めて生成したときにテクスチャを読み込まないようにする. 描画しない場合は何もしない</para>
+	/// </summary>
+	void PreloadParticleSprites(const std::vector<MasterDataID>& particle_ids);
+
 	/// <summary>
 	/// 全てのパーティクルを非アクティブ化
 	/// </summary>
 	void DeactivateAllParticles();
 
 	/// <summary>
-	/// パーティクルの更新
+	/// パーティクルの更新. 先に, キューに溜まった生成要求をまとめて生成する
 	/// </summary>
 	void Tick(const float delta_seconds);
 
@@ -52,6 +72,23 @@ public:
 	/// <returns></returns>
 	UINT GetPoolCount() const;
 
+	EParticleBackend GetBackend() const { return _backend; }
+
+	/// <summary>
+	/// 直前のDraw()で描画した生存パーティクルのリスト. EParticleBackend::CPUの場合のみ作られる
+	/// </summary>
+	const ParticleDrawLists& GetDrawLists() const { return _draw_lists; }
+
+	/// <summary>
+	/// 前回呼んでからの生成の統計情報を返し, 0に戻す. 毎フレーム呼べば1フレーム分の統計になる
+	/// </summary>
+	ParticleSpawnStats TakeSpawnStats();
+
+	/// <summary>
+	/// スプライトテクスチャのアトラスの統計情報. 描画しない場合は全て0
+	/// </summary>
+	SpriteAtlasStats GetSpriteAtlasStats() const;
+
 private:
 	ParticleManager();
 	~ParticleManager();
@@ -62,6 +99,16 @@ private:
 	ParticleManager(ParticleManager&&) = delete;
 	ParticleManager& operator=(ParticleManager&&) = delete;
 
+	/// <summary>
+	/// キューに溜まった生成要求の初期値をまとめて作り, 1回でパーティクルバッファ(CPUの場合はシミュレーター)へ送る
+	/// </summary>
+	void FlushSpawnQueue();
+
+	/// <summary>
+	/// パーティクルの初期値のうちアニメーションから決まる部分を作る. 描画する場合はテクスチャも読み込む
+	/// </summary>
+	ParticleSpawnAnimation ResolveSpawnAnimation(const MasterDataID animation_id);
+
 	template<class T>
 	void SafeRelease(T*& p)
 	{
@@ -74,4 +121,18 @@ private:
 
 	// ParticleManagerImplインスタンス
 	ParticleManagerImpl* p_pm;
+
+	// EParticleBackend::CPUの場合のシミュレーター
+	std::unique_ptr<CpuParticleSimulator> p_cpu_simulator;
+
+	// 1フレームの間の生成要求
+	ParticleSpawnQueue _spawn_queue;
+
+	// TakeSpawnStats()を呼んでからの生成の統計情報
+	ParticleSpawnStats _spawn_stats;
+
+	// EParticleBackend::CPUの場合に, 描画の前に作る生存パーティクルのリスト
+	ParticleDrawLists _draw_lists;
+
+	EParticleBackend _backend;
 };
\ No newline at end of file
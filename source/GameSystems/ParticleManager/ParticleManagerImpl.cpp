@@ -10,7 +10,7 @@
 /////////////////////////////////
 //// 定数
 /////////////////////////////////
-const Vector2D gravity_force = Vector2D(0.f, 1.f) * 9.8 * 32;	// 32px == 1 meter
+const Vector2D gravity_force = Vector2D(0.f, PARTICLE_GRAVITY_ACCELERATION);
 
 ////////////////////////////////
 //// 構造体定義
@@ -22,12 +22,17 @@ struct alignas(16) CB0_VS
 };
 
 // VS用定数バッファ(b1)
+struct alignas(16) CB1_VS
+{
+	UINT target_blend_mode;		// 描画対象ブレンドモード
+	UINT instance_offset;		// インスタンスIDに足してパーティクルIDにする値
+};
+
 struct alignas(16) UINT_WRAPPER
 {
 	UINT value;
 };
 
-typedef UINT_WRAPPER CB1_VS;
 typedef UINT_WRAPPER CB0_CS_SPAWN;
 
 // VS用定数バッファサイズリスト
@@ -127,6 +132,12 @@ bool ParticleManagerImpl::Init()
 		return false;
 	}
 
+	// スプライトテクスチャのアトラスの生成
+	if (!m_spriteAtlas->Init(pDev, m_pContextRef))
+	{
+		return false;
+	}
+
 	HRESULT hr;
 	ComPtr<ID3DBlob> blob = nullptr;
 	// シェーダーのコンパイルと生成
@@ -351,7 +362,9 @@ bool ParticleManagerImpl::Init()
 }
 
 void ParticleManagerImpl::End()
-{}
+{
+	m_spriteAtlas->Release();
+}
 
 ParticleManagerImpl::ParticleManagerImpl()
 	: m_pBlendState(
@@ -361,7 +374,7 @@ ParticleManagerImpl::ParticleManagerImpl()
 			{EBlendMode::Mula, nullptr},
 		}
 		)
-	, m_textureLoader(std::make_unique<TextureLoader>())
+	, m_spriteAtlas(std::make_unique<SpriteAtlas>())
 	, m_particles(MAX_PARTICLES_NUM)
 	, m_pool_count(MAX_PARTICLES_NUM)
 {
@@ -387,74 +400,28 @@ void ParticleManagerImpl::DeactivateAllParticles()
 	DxLib::RefreshDxLibDirect3DSetting();
 }
 
-bool ParticleManagerImpl::Spawn(const ParticleSpawnDesc& spawn_desc, const int num_spawn)
+bool ParticleManagerImpl::SpawnParticles(const Particle* spawn_particles, const UINT num_spawn)
 {
 	// プールに十分な数のパーティクルがあるかチェック
-	if (m_pool_count < num_spawn)
+	if (num_spawn == 0 || num_spawn > MAX_PARTICLES_NUM || m_pool_count < num_spawn)
 	{
 		return false;
 	}
 
-	// 生成するパーティクルが参照するスプライトテクスチャがロードされていない場合
-	// ロード済みのテクスチャも合わせて再ロードする
-	const MdAnimation& animation = MdAnimation::Get(spawn_desc.animation_id);
-	if (_sprite_id_to_texture_index_map.find(animation.sprite_id) == _sprite_id_to_texture_index_map.end())
-	{
-		// ロードするテクスチャのIDをまとめる
-		std::vector<MasterDataID> sprite_ids;
-		sprite_ids.reserve(_sprite_id_to_texture_index_map.size() + 1);	// ロード済み+1個分の領域を確保
-		for (auto& pair : _sprite_id_to_texture_index_map)
-		{
-			sprite_ids.push_back(pair.first);
-		}
-		sprite_ids.push_back(MdAnimation::Get(spawn_desc.animation_id).sprite_id);
-
-		std::vector<SpriteTextureLoadInfo> texture_load_infos;
-		MakeSpriteTextureLoadInfos(texture_load_infos, sprite_ids);
-
-		m_textureLoader->LoadTextureArray(GetDevice(), texture_load_infos.data(), texture_load_infos.size(), m_pSRV_TextureArray);
-	}
-
 	// 1. 定数バッファ内の生成数を更新
 	CB0_CS_SPAWN cb = {};
 	cb.value = num_spawn;
 	m_pContextRef->UpdateSubresource(m_pCB_CS_SpawnNum.Get(), 0, nullptr, &cb, 0, 0);
 
-	// 2. バッファm_pSpawnInfoBufferの[0]から[num_spawn-1]までを更新
-	const Vector2D init_pos_world = spawn_desc.world_transform.TransformLocation(spawn_desc.initial_position);
-
-	for (int i = 0; i < num_spawn; i++)
-	{
-		Particle& p = m_particles.at(i);
-		p = Particle();
-		p.size = spawn_desc.size.GetRandomValueInRange();
-		p.life_time = spawn_desc.life_time.GetRandomValueInRange();
-
-		// 初期位置, 初速度
-		p.pos.x = init_pos_world.x;
-		p.pos.y = init_pos_world.y;
-
-		const float rot_angle_deg = RandomNumberGenerator::GetRandomFloat(-spawn_desc.velocity_angle_deg * 0.5f, spawn_desc.velocity_angle_deg * 0.5f);		
-		const Vector2D init_vel_local = Vector2D::Rotate(
-			(spawn_desc.initial_velocity_normalized * spawn_desc.initial_speed.GetRandomValueInRange()),
-			DX_PI_F * rot_angle_deg / 180.f
-		);
-		const Vector2D init_vel_world = spawn_desc.world_transform.TransformDirection(init_vel_local);
-		p.vel.x = init_vel_world.x;
-		p.vel.y = init_vel_world.y;
-
-		p.gravity_scale = spawn_desc.gravity_scale.GetRandomValueInRange();
-		
-		p.anim_first_frame = animation.first_frame;
-		p.num_anim_frames = animation.num_frames;
-		p.loop_start_offset = animation.loop_start_offset;
-		p.frame_duration = animation.default_frame_duration;
-
-		p.SetBlendMode(static_cast<Particle::uint>(MasterHelper::GetAnimationBlendMode(animation)));
-		p.SetMaxLoop(0);
-		p.SetTextureIndex(_sprite_id_to_texture_index_map.at(animation.sprite_id));
-	}
-	m_pContextRef->UpdateSubresource(m_pSpawnInfoBuffer.Get(), 0, nullptr, m_particles.data(), 0, 0);
+	// 2. バッファm_pSpawnInfoBufferの[0]から[num_spawn-1]までだけを更新
+	D3D11_BOX box = {};
+	box.left = 0;
+	box.right = num_spawn * sizeof(Particle);
+	box.top = 0;
+	box.bottom = 1;
+	box.front = 0;
+	box.back = 1;
+	m_pContextRef->UpdateSubresource(m_pSpawnInfoBuffer.Get(), 0, &box, spawn_particles, 0, 0);
 
 	// 3. リソースバインド & ディスパッチ
 	const UINT NumDispatch = num_spawn / NUM_THREADS_X + 1;
@@ -509,7 +476,7 @@ void ParticleManagerImpl::Tick(const float delta_seconds)
 	DxLib::RefreshDxLibDirect3DSetting();
 }
 
-void ParticleManagerImpl::Draw(const CameraParams& camera_params)
+void ParticleManagerImpl::Draw(const CameraParams& camera_params, const ParticleDrawLists* draw_lists)
 {
 	DxLib::RefreshDxLibDirect3DSetting();
 
@@ -527,7 +494,7 @@ void ParticleManagerImpl::Draw(const CameraParams& camera_params)
 		camera_params.GetMatrixWorldToNormalizedDevice(cb0.TransformMatrix);
 		m_pContextRef->UpdateSubresource(m_pCB_VS[0].Get(), 0, nullptr, &cb0, 0, 0);
 		CB1_VS cb1 = {};
-		cb1.value = static_cast<unsigned int>(EBlendMode::Alpha);
+		cb1.target_blend_mode = static_cast<unsigned int>(EBlendMode::Alpha);
 		m_pContextRef->UpdateSubresource(m_pCB_VS[1].Get(), 0, nullptr, &cb1, 0, 0);
 
 		m_pContextRef->VSSetShader(m_pVertexShader.Get(), nullptr, 0);
@@ -549,23 +516,39 @@ void ParticleManagerImpl::Draw(const CameraParams& camera_params)
 		m_pContextRef->PSSetShader(m_pPixelShader.Get(), nullptr, 0);
 		// リソースバインド(PS)
 		m_pContextRef->PSSetShaderResources(0, 1, m_pSRV_PtBuff.GetAddressOf());
-		m_pContextRef->PSSetShaderResources(1, 1, m_textureLoader->GetTextureArraySRV());
-		m_pContextRef->PSSetShaderResources(2, 1, m_textureLoader->GetTextureInfosSRV());
+		m_pContextRef->PSSetShaderResources(1, 1, m_spriteAtlas->GetTextureArraySRV());
+		m_pContextRef->PSSetShaderResources(2, 1, m_spriteAtlas->GetTextureInfosSRV());
 		m_pContextRef->PSSetSamplers(0, 1, m_pSamplerState.GetAddressOf());
 	}
 
 	// ブレンドモードごとに描画処理
 	for (auto& blend_mode : EnumInfo<EBlendMode>::List())
 	{
+		// 描画リストがある場合は, パーティクルバッファの先頭にブレンドモード順に詰められた生存パーティクルだけを描画する
+		// 無い場合は全てのスロットを描画し, 頂点シェーダーで非アクティブと他のブレンドモードのパーティクルを捨てる
+		UINT instance_offset = 0;
+		UINT num_instances = MAX_PARTICLES_NUM;
+		if (draw_lists)
+		{
+			const ParticleDrawLists::Range range = draw_lists->GetBlendModeRange(static_cast<uint32_t>(blend_mode));
+			if (range.count == 0)
+			{
+				continue;
+			}
+			instance_offset = range.offset;
+			num_instances = range.count;
+		}
+
 		ID3D11BlendState* bs = m_pBlendState.at(blend_mode).Get();
 		m_pContextRef->OMSetBlendState(bs, nullptr, 0xFFFFFFFF);
 
 		// 頂点シェーダーで描画対象パーティクルの判別に利用する定数
 		CB1_VS cb1_vs{};
-		cb1_vs.value = static_cast<int>(blend_mode);
+		cb1_vs.target_blend_mode = static_cast<int>(blend_mode);
+		cb1_vs.instance_offset = instance_offset;
 		m_pContextRef->UpdateSubresource(m_pCB_VS[1].Get(), 0, nullptr, &cb1_vs, 0, 0);
 		
-		m_pContextRef->DrawInstanced(6, MAX_PARTICLES_NUM, 0, 0);
+		m_pContextRef->DrawInstanced(6, num_instances, 0, 0);
 	}
 
 	// DXライブラリのDirect3D設定を再度行う.
@@ -577,6 +560,44 @@ UINT ParticleManagerImpl::GetPoolCount() const
 	return m_pool_count;
 }
 
+int ParticleManagerImpl::LoadSpriteTexture(const MasterDataID sprite_id)
+{
+	// ロードされていない場合は, そのテクスチャだけをアトラスの空いている領域へ書き込む
+	return m_spriteAtlas->Load(sprite_id);
+}
+
+void ParticleManagerImpl::PreloadSpriteTextures(const std::vector<MasterDataID>& sprite_ids)
+{
+	m_spriteAtlas->Preload(sprite_ids);
+}
+
+SpriteAtlasStats ParticleManagerImpl::GetSpriteAtlasStats() const
+{
+	return m_spriteAtlas->GetStats();
+}
+
+void ParticleManagerImpl::UploadParticles(const CpuParticleSimulator& simulator, const ParticleDrawLists& draw_lists)
+{
+	assert(simulator.GetCapacity() <= MAX_PARTICLES_NUM);
+
+	// 生存しているパーティクルだけを描画リストの順にパーティクルバッファの先頭へ詰めて書き込む
+	const uint32_t num_live_particles = draw_lists.GetNumLiveParticles();
+	if (num_live_particles == 0)
+	{
+		return;
+	}
+	simulator.ExportParticles(draw_lists.GetIndices(), num_live_particles, m_particles.data());
+
+	D3D11_BOX box = {};
+	box.left = 0;
+	box.right = num_live_particles * sizeof(Particle);
+	box.top = 0;
+	box.bottom = 1;
+	box.front = 0;
+	box.back = 1;
+	m_pContextRef->UpdateSubresource(m_pParticleBuffer.Get(), 0, &box, m_particles.data(), 0, 0);
+}
+
 bool ParticleManagerImpl::InitBlendStateMap(ID3D11Device* pDev)
 {
 	HRESULT hr;
@@ -829,26 +850,3 @@ ID3D11Device* ParticleManagerImpl::GetDevice() const
 {
 	return const_cast<ID3D11Device*>(reinterpret_cast<const ID3D11Device*>(DxLib::GetUseDirect3D11Device()));
 }
-
-void ParticleManagerImpl::MakeSpriteTextureLoadInfos(std::vector<SpriteTextureLoadInfo>& out_infos, const std::vector<MasterDataID> sprite_ids)
-{
-	_sprite_id_to_texture_index_map.clear();
-	out_infos.clear();
-	out_infos.reserve(sprite_ids.size());
-
-	int texture_index = 0;
-	for (auto& id : sprite_ids)
-	{
-		const MdSpriteSheet& sprite_data = MdSpriteSheet::Get(id);
-		const MdImageFile& image_data = MasterHelper::GetImageFile(sprite_data);
-
-		out_infos.push_back(SpriteTextureLoadInfo{});
-		SpriteTextureLoadInfo& info = out_infos.at(out_infos.size() - 1);
-		info.path = StringToWString(image_data.path);
-		info.sprite_rows = sprite_data.num_rows;
-		info.sprite_columns = sprite_data.num_columns;
-		
-		_sprite_id_to_texture_index_map[id] = texture_index;
-		++texture_index;
-	}
-}
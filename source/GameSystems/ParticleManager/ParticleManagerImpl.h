@@ -9,7 +9,9 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
-#include "Textureloader/TextureLoader.h"
+#include "TextureLoader/SpriteAtlas.h"
+#include "GameSystems/ParticleManager/CpuParticleSimulator.h"
+#include "GameSystems/ParticleManager/ParticleDrawLists.h"
 
 /////////////////////
 // プロトタイプ宣言
@@ -34,25 +36,46 @@ private:
 
 	bool Init();
 	void End();
-	bool Spawn(const ParticleSpawnDesc& spawn_desc, const int num_spawn);
+
+	/// <summary>
+	/// 初期値を作り終えたパーティクルを生成する. 1回のアップロードとディスパッチで全てを生成する
+	/// <para>プールのパーティクルが足りない場合は何もせずfalseを返す</para>
+	/// </summary>
+	bool SpawnParticles(const Particle* spawn_particles, const UINT num_spawn);
+
 	void DeactivateAllParticles();
 	void Tick(const float delta_seconds);
-	void Draw(const CameraParams& camera_params);
+	void Draw(const CameraParams& camera_params, const ParticleDrawLists* draw_lists = nullptr);
 	UINT GetPoolCount() const;
 
+	/// <summary>
+	/// スプライトのテクスチャをアトラスに読み込み, テクスチャインデックスを返す. 読み込み済みの場合はインデックスだけ返す
+	/// </summary>
+	int LoadSpriteTexture(const MasterDataID sprite_id);
+
+	/// <summary>
+	/// 読み込まれていないスプライトのテクスチャをまとめてアトラスに読み込む
+	/// </summary>
+	void PreloadSpriteTextures(const std::vector<MasterDataID>& sprite_ids);
+
+	SpriteAtlasStats GetSpriteAtlasStats() const;
+
+	/// <summary>
+	/// CpuParticleSimulatorで更新したパーティクルのうち, draw_listsに含まれるものをパーティクルバッファの先頭に詰めて書き込む
+	/// <para>この後は同じdraw_listsを渡してDraw()を呼ぶ</para>
+	/// </summary>
+	void UploadParticles(const CpuParticleSimulator& simulator, const ParticleDrawLists& draw_lists);
+
 	bool InitBlendStateMap(ID3D11Device* pDev);
 	bool InitParticleBuffer(ID3D11Device* pDev);
 
 	ID3D11Device* GetDevice() const;
-	void MakeSpriteTextureLoadInfos(std::vector<SpriteTextureLoadInfo>& out_infos, const std::vector<MasterDataID> sprite_ids);
 
 	ComPtr<ID3D11InputLayout>			m_pInputLayout;			// 入力レイアウト
 	ComPtr<ID3D11Buffer>				m_pVertexBuffer;		// 頂点バッファ
 	ComPtr<ID3D11Buffer>				m_pCB_VS[14];			// 定数バッファ(頂点シェーダー)
 	ComPtr<ID3D11Buffer>				m_pCB_PS;				// 定数バッファ(ピクセルシェーダー)
 	ComPtr<ID3D11Buffer>				m_pIndexBuffer;			// インデックスバッファ
-	ComPtr<ID3D11Resource>				m_pTexture2D;			// テクスチャ
-	ComPtr<ID3D11ShaderResourceView>	m_pSRV_TextureArray;			// テクスチャ用シェーダーリソースビュー
 	ComPtr<ID3D11SamplerState>			m_pSamplerState;		// サンプラーステート
 
 	ComPtr<ID3D11Buffer>				m_pParticleBuffer;		// パーティクルバッファ
@@ -80,7 +103,8 @@ private:
 
 	ID3D11DeviceContext* m_pContextRef = nullptr;
 
-	std::unique_ptr<class TextureLoader> m_textureLoader;
+	// スプライトテクスチャのアトラス. 読み込んだスプライトはEnd()まで常駐する
+	std::unique_ptr<SpriteAtlas> m_spriteAtlas;
 
 	// ブレンドステート
 	std::unordered_map<EBlendMode, ComPtr<ID3D11BlendState>> m_pBlendState;
@@ -91,6 +115,4 @@ private:
 	UINT m_pool_count = 0;
 
 	CameraParams m_lastCameraParams;
-
-	std::unordered_map<MasterDataID, int> _sprite_id_to_texture_index_map;
 };
\ No newline at end of file
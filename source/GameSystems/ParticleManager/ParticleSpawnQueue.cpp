@@ -0,0 +1,182 @@
+#include "ParticleSpawnQueue.h"
+#include <cassert>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+	// 1つのパーティクルの初期値を決めるのに使う乱数の数 (サイズ, 寿命, 重力スケール, 初速, 初速度の角度)
+	constexpr uint32_t NUM_RANDOM_VALUES_PER_PARTICLE = 5;
+
+	// 1回のBuild()で解決するアニメーションの種類数の見込み. 超えた場合は配列を伸ばす
+	constexpr size_t EXPECTED_NUM_ANIMATIONS = 16;
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
+
+ParticleSpawnStats& ParticleSpawnStats::operator+=(const ParticleSpawnStats& other)
+{
+	num_requests += other.num_requests;
+	num_dropped_requests += other.num_dropped_requests;
+	num_particles += other.num_particles;
+	num_dropped_particles += other.num_dropped_particles;
+	num_submits += other.num_submits;
+	generate_ms += other.generate_ms;
+	submit_ms += other.submit_ms;
+	return *this;
+}
+
+ParticleSpawnQueue::ParticleSpawnQueue(const uint32_t max_requests, const uint32_t max_particles)
+	: _max_requests(max_requests)
+	, _max_particles(max_particles)
+	, _num_queued_particles(0)
+	, _num_rejected_requests(0)
+	, _num_rejected_particles(0)
+	, _particles(max_particles)
+	, _num_particles(0)
+	, _random_values(static_cast<size_t>(max_particles) * NUM_RANDOM_VALUES_PER_PARTICLE)
+{
+	assert(max_requests > 0 && max_particles > 0);
+	_requests.reserve(max_requests);
+	_resolved_animations.reserve(EXPECTED_NUM_ANIMATIONS);
+}
+
+ParticleSpawnQueue::~ParticleSpawnQueue()
+{
+}
+
+bool ParticleSpawnQueue::Enqueue(const ParticleSpawnRequest& request)
+{
+	if (request.num_spawn == 0)
+	{
+		return false;
+	}
+
+	if (_requests.size() >= _max_requests || _num_queued_particles + request.num_spawn > _max_particles)
+	{
+		_num_rejected_requests++;
+		_num_rejected_particles += request.num_spawn;
+		return false;
+	}
+
+	_requests.push_back(request);
+	_num_queued_particles += request.num_spawn;
+	return true;
+}
+
+uint32_t ParticleSpawnQueue::Build(
+	const uint64_t batch_seed,
+	const uint32_t max_particles,
+	const std::function<ParticleSpawnAnimation(const MasterDataID)>& resolve_animation,
+	ParticleSpawnStats& out_stats
+)
+{
+	const auto generate_begin = std::chrono::high_resolution_clock::now();
+
+	out_stats = ParticleSpawnStats();
+	out_stats.num_requests = static_cast<uint32_t>(_requests.size()) + _num_rejected_requests;
+	out_stats.num_dropped_requests = _num_rejected_requests;
+	out_stats.num_dropped_particles = _num_rejected_particles;
+
+	// 1. 追加された順に, 生成できる数を超える要求を捨てる. 捨てた要求はnum_spawnを0にする
+	const uint32_t num_available = max_particles < _max_particles ? max_particles : _max_particles;
+	uint32_t num_particles = 0;
+	for (ParticleSpawnRequest& request : _requests)
+	{
+		if (num_particles + request.num_spawn > num_available)
+		{
+			out_stats.num_dropped_requests++;
+			out_stats.num_dropped_particles += request.num_spawn;
+			request.num_spawn = 0;
+			continue;
+		}
+		num_particles += request.num_spawn;
+	}
+
+	// 2. 全てのパーティクルの分の乱数をまとめて作る. 値の種類ごとにnum_particles個ずつ並べる
+	_random_stream.Seed(batch_seed);
+	_random_stream.FillUniform(_random_values.data(), static_cast<size_t>(num_particles) * NUM_RANDOM_VALUES_PER_PARTICLE);
+	const float* const random_size = _random_values.data();
+	const float* const random_life_time = random_size + num_particles;
+	const float* const random_gravity_scale = random_life_time + num_particles;
+	const float* const random_speed = random_gravity_scale + num_particles;
+	const float* const random_angle = random_speed + num_particles;
+
+	// 3. 要求ごとに共通の値を入れたパーティクルを作り, 乱数で決める値だけを書き換えてコピーする
+	_resolved_animations.clear();
+	uint32_t i_particle = 0;
+	for (const ParticleSpawnRequest& request : _requests)
+	{
+		if (request.num_spawn == 0)
+		{
+			continue;
+		}
+
+		const ParticleSpawnAnimation& animation = FindOrResolveAnimation(request.animation_id, resolve_animation);
+		Particle base;
+		base.pos.x = request.position_x;
+		base.pos.y = request.position_y;
+		base.anim_first_frame = animation.anim_first_frame;
+		base.num_anim_frames = animation.num_anim_frames;
+		base.loop_start_offset = animation.loop_start_offset;
+		base.frame_duration = animation.frame_duration;
+		base.SetBlendMode(animation.blend_mode);
+		base.SetMaxLoop(0);
+		base.SetTextureIndex(animation.texture_index);
+
+		const uint32_t end = i_particle + request.num_spawn;
+		for (; i_particle < end; i_particle++)
+		{
+			Particle& p = _particles[i_particle];
+			p = base;
+			p.size = request.size_min + random_size[i_particle] * request.size_range;
+			p.life_time = request.life_time_min + random_life_time[i_particle] * request.life_time_range;
+			p.gravity_scale = request.gravity_scale_min + random_gravity_scale[i_particle] * request.gravity_scale_range;
+
+			// 初速度の向きを[-half_velocity_angle, half_velocity_angle]だけ回転させる
+			const float speed = request.speed_min + random_speed[i_particle] * request.speed_range;
+			const float angle = request.half_velocity_angle * (random_angle[i_particle] * 2.f - 1.f);
+			const float cos_angle = std::cos(angle);
+			const float sin_angle = std::sin(angle);
+			p.vel.x = (request.velocity_direction_x * cos_angle - request.velocity_direction_y * sin_angle) * speed;
+			p.vel.y = (request.velocity_direction_x * sin_angle + request.velocity_direction_y * cos_angle) * speed;
+		}
+	}
+	assert(i_particle == num_particles);
+
+	_num_particles = num_particles;
+	out_stats.num_particles = num_particles;
+	out_stats.generate_ms = GetElapsedMilliseconds(generate_begin);
+
+	_requests.clear();
+	_num_queued_particles = 0;
+	_num_rejected_requests = 0;
+	_num_rejected_particles = 0;
+	return num_particles;
+}
+
+void ParticleSpawnQueue::Clear()
+{
+	_requests.clear();
+	_num_queued_particles = 0;
+	_num_rejected_requests = 0;
+	_num_rejected_particles = 0;
+	_num_particles = 0;
+}
+
+const ParticleSpawnAnimation& ParticleSpawnQueue::FindOrResolveAnimation(const MasterDataID animation_id, const std::function<ParticleSpawnAnimation(const MasterDataID)>& resolve_animation)
+{
+	for (const auto& resolved : _resolved_animations)
+	{
+		if (resolved.first == animation_id)
+		{
+			return resolved.second;
+		}
+	}
+
+	_resolved_animations.emplace_back(animation_id, resolve_animation(animation_id));
+	return _resolved_animations.back().second;
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "GameSystems/MasterData/MasterDataID.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+#include "Utility/Core/Math/BatchRandomStream.h"
+
+/// <summary>
+/// パーティクル生成の統計情報. 1回のParticleSpawnQueue::Build()の分, またはParticleManagerで1フレーム分を足し合わせたもの
+/// </summary>
+struct ParticleSpawnStats
+{
+	// 受け付けた生成要求数と, そのうちプールかキューの空きが足りず捨てた要求数
+	uint32_t num_requests;
+	uint32_t num_dropped_requests;
+
+	// 生成したパーティクル数と, 捨てた要求に含まれていたパーティクル数
+	uint32_t num_particles;
+	uint32_t num_dropped_particles;
+
+	// パーティクルバッファへのアップロードとディスパッチ(EParticleBackend::CPUの場合はCpuParticleSimulator::Spawn())の回数
+	uint32_t num_submits;
+
+	// 初期値の生成と, アップロード/ディスパッチにかかった時間
+	double generate_ms;
+	double submit_ms;
+
+	ParticleSpawnStats& operator+=(const ParticleSpawnStats& other);
+};
+
+/// <summary>
+/// アニメーションから決まる, パーティクルの初期値のうち生成要求によらない部分
+/// </summary>
+struct ParticleSpawnAnimation
+{
+	uint32_t anim_first_frame;
+	uint32_t num_anim_frames;
+	uint32_t loop_start_offset;
+	float frame_duration;
+	uint32_t blend_mode;
+	uint32_t texture_index;
+};
+
+/// <summary>
+/// ワールド変換まで済ませたパーティクルの生成要求. 通常はParticleSpawnDesc::MakeSpawnRequest()で作る
+/// </summary>
+struct ParticleSpawnRequest
+{
+	MasterDataID animation_id;
+	uint32_t num_spawn;
+
+	// ワールド空間での初期位置と, 初速度の向き(角度の範囲の中心)
+	float position_x;
+	float position_y;
+	float velocity_direction_x;
+	float velocity_direction_y;
+
+	// 初速度の向きを回転させる角度の範囲の半分 [rad]
+	float half_velocity_angle;
+
+	// 範囲で指定された値. GetRandomValueInRange()と同じく min + (max - min) * [0,1)の乱数 で決める
+	float size_min, size_range;
+	float life_time_min, life_time_range;
+	float gravity_scale_min, gravity_scale_range;
+	float speed_min, speed_range;
+};
+
+/// <summary>
+/// 1フレーム(ワールドの1ステップ)の間のパーティクル生成要求を溜め, まとめて初期値を作るキュー
+/// <para>範囲で指定された値は要求ごとにRandomNumberGeneratorを呼ぶ代わりに, BatchRandomStreamで全要求の分をまとめて作る</para>
+/// <para>アニメーションとテクスチャは, 1回のBuild()の中でアニメーションIDごとに1回だけ解決する</para>
+/// <para>要求とパーティクルの配列はコンストラクタで確保し, Enqueue(), Build()では確保しない</para>
+/// <para>ParticleSpawnDescやマスターデータには依存しない. アニメーションはBuild()に渡す関数で解決する</para>
+/// </summary>
+class ParticleSpawnQueue
+{
+public:
+	/// <param name="max_requests">1回のBuild()までに受け付ける要求数の上限</param>
+	/// <param name="max_particles">1回のBuild()までに受け付けるパーティクル数の上限</param>
+	ParticleSpawnQueue(const uint32_t max_requests, const uint32_t max_particles);
+	~ParticleSpawnQueue();
+
+	/// <summary>
+	/// 生成要求を追加する
+	/// </summary>
+	/// <returns>num_spawnが0か, キューの空きが足りず捨てた場合はfalse</returns>
+	bool Enqueue(const ParticleSpawnRequest& request);
+
+	/// <summary>
+	/// キューの要求からパーティクルの初期値をまとめて作り, キューを空にする. 作った値はGetParticles()で参照する
+	/// <para>要求は追加された順に, 合計がmax_particlesを超えるものを丸ごと捨てる</para>
+	/// </summary>
+	/// <param name="batch_seed">範囲で指定された値を決める乱数列のシード</param>
+	/// <param name="max_particles">生成できるパーティクル数. プールのパーティクル数を渡す</param>
+	/// <param name="resolve_animation">アニメーションIDからアニメーションとテクスチャを解決する関数</param>
+	/// <param name="out_stats">生成数と生成にかかった時間を書き込む. アップロードの回数と時間は書き込まない</param>
+	/// <returns>作ったパーティクル数</returns>
+	uint32_t Build(
+		const uint64_t batch_seed,
+		const uint32_t max_particles,
+		const std::function<ParticleSpawnAnimation(const MasterDataID)>& resolve_animation,
+		ParticleSpawnStats& out_stats
+	);
+
+	/// <summary>
+	/// 直前のBuild()で作ったパーティクルの初期値
+	/// </summary>
+	const Particle* GetParticles() const { return _particles.data(); }
+	uint32_t GetNumParticles() const { return _num_particles; }
+
+	bool IsEmpty() const { return _requests.empty() && _num_rejected_requests == 0; }
+
+	/// <summary>
+	/// 溜まっている要求を捨てる
+	/// </summary>
+	void Clear();
+
+private:
+	/// <summary>
+	/// 解決済みのアニメーションを探し, 無ければresolve_animationで解決して追加する
+	/// </summary>
+	const ParticleSpawnAnimation& FindOrResolveAnimation(const MasterDataID animation_id, const std::function<ParticleSpawnAnimation(const MasterDataID)>& resolve_animation);
+
+	uint32_t _max_requests;
+	uint32_t _max_particles;
+
+	std::vector<ParticleSpawnRequest> _requests;
+	uint32_t _num_queued_particles;
+
+	// キューの空きが足りずEnqueue()で捨てた要求. 次のBuild()の統計に含める
+	uint32_t _num_rejected_requests;
+	uint32_t _num_rejected_particles;
+
+	// Build()で作るパーティクルと, そのための乱数
+	std::vector<Particle> _particles;
+	uint32_t _num_particles;
+	std::vector<float> _random_values;
+	BatchRandomStream _random_stream;
+
+	// 1回のBuild()の中で解決したアニメーション
+	std::vector<std::pair<MasterDataID, ParticleSpawnAnimation>> _resolved_animations;
+};
@@ -2,11 +2,19 @@
 #pragma once
 #endif
 
-#define MAX_TEXTURES_NUM 8
+#define MAX_TEXTURES_NUM 64
 #define NUM_THREADS_X 1024
 #define NUM_THREAD_GROUPS 32
 
 #ifdef __cplusplus
 constexpr unsigned int MAX_PARTICLES_NUM = NUM_THREADS_X * NUM_THREAD_GROUPS;
 constexpr unsigned int NUM_PARTICLE_CS_DISPATCH = NUM_THREAD_GROUPS;
+
+// パーティクルにかかる重力加速度(下向き). 32px == 1 meter
+constexpr float PARTICLE_GRAVITY_ACCELERATION = 9.8f * 32.f;
+
+// スプライトシートを置くアトラスのページの一辺, ページ数の上限, スプライトの周囲に空ける隙間 [texel]
+constexpr unsigned int PARTICLE_ATLAS_PAGE_SIZE = 2048;
+constexpr unsigned int MAX_PARTICLE_ATLAS_PAGES = 8;
+constexpr unsigned int PARTICLE_ATLAS_PADDING = 2;
 #endif
\ No newline at end of file
@@ -0,0 +1,323 @@
+#include "SpriteAtlas.h"
+#include "DirectXTex.h"
+#include "SpriteTextureInfo.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "Utility/Core/StringUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace
+{
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
+
+SpriteAtlas::SpriteAtlas()
+	: _layout(PARTICLE_ATLAS_PAGE_SIZE, PARTICLE_ATLAS_PAGE_SIZE, MAX_PARTICLE_ATLAS_PAGES, MAX_TEXTURES_NUM, PARTICLE_ATLAS_PADDING)
+	, _num_allocated_pages(0)
+	, _num_decodes(0)
+	, _num_page_grows(0)
+	, _load_ms(0.0)
+{
+}
+
+SpriteAtlas::~SpriteAtlas()
+{
+}
+
+bool SpriteAtlas::Init(ID3D11Device* pDev, ID3D11DeviceContext* pContext)
+{
+	Release();
+
+	m_pDevRef = pDev;
+	m_pContextRef = pContext;
+	if (!(m_pDevRef && m_pContextRef))
+	{
+		return false;
+	}
+
+	// スプライトを読み込む前でも描画でバインドできるように, 1ページ分を作っておく
+	return ReservePages(1) && CreateTexInfoBuffer();
+}
+
+void SpriteAtlas::Release()
+{
+	m_pSRV_Textures.Reset();
+	m_pResource_Textures.Reset();
+	m_pSRV_TexInfos.Reset();
+	m_pResource_TexInfos.Reset();
+	m_pDevRef = nullptr;
+	m_pContextRef = nullptr;
+
+	_layout.Clear();
+	_num_allocated_pages = 0;
+	_num_decodes = 0;
+	_num_page_grows = 0;
+	_load_ms = 0.0;
+}
+
+int SpriteAtlas::Load(const MasterDataID sprite_id)
+{
+	if (const SpriteAtlasEntry* const resident = _layout.Find(sprite_id))
+	{
+		return static_cast<int>(resident->index);
+	}
+
+	const auto load_begin = std::chrono::high_resolution_clock::now();
+
+	DirectX::ScratchImage image;
+	Decode(sprite_id, image);
+	const int texture_index = Upload(sprite_id, image);
+
+	_load_ms += GetElapsedMilliseconds(load_begin);
+	return texture_index;
+}
+
+void SpriteAtlas::Preload(const std::vector<MasterDataID>& sprite_ids)
+{
+	const auto load_begin = std::chrono::high_resolution_clock::now();
+
+	// 1. 読み込まれていないものだけを重複なく読み込む
+	std::vector<std::pair<MasterDataID, DirectX::ScratchImage>> images;
+	images.reserve(sprite_ids.size());
+	for (const MasterDataID sprite_id : sprite_ids)
+	{
+		const bool is_queued = std::any_of(images.begin(), images.end(), [sprite_id](const auto& image) { return image.first == sprite_id; });
+		if (IsResident(sprite_id) || is_queued)
+		{
+			continue;
+		}
+
+		images.emplace_back(sprite_id, DirectX::ScratchImage());
+		Decode(sprite_id, images.back().second);
+	}
+
+	// 2. スカイライン法は高さの大きいものから置くと隙間が少なくなる
+	std::stable_sort(images.begin(), images.end(), [](const auto& a, const auto& b)
+		{
+			return a.second.GetMetadata().height > b.second.GetMetadata().height;
+		});
+
+	for (const auto& image : images)
+	{
+		Upload(image.first, image.second);
+	}
+
+	_load_ms += GetElapsedMilliseconds(load_begin);
+}
+
+ID3D11ShaderResourceView** SpriteAtlas::GetTextureArraySRV()
+{
+	return m_pSRV_Textures.GetAddressOf();
+}
+
+ID3D11ShaderResourceView** SpriteAtlas::GetTextureInfosSRV()
+{
+	return m_pSRV_TexInfos.GetAddressOf();
+}
+
+SpriteAtlasStats SpriteAtlas::GetStats() const
+{
+	SpriteAtlasStats stats = {};
+	stats.num_sprites = static_cast<uint32_t>(_layout.GetEntries().size());
+	stats.num_pages = _layout.GetNumPages();
+	stats.num_allocated_pages = _num_allocated_pages;
+	stats.resident_bytes = static_cast<uint64_t>(_layout.GetPageWidth()) * _layout.GetPageHeight() * BytesPerTexel * _num_allocated_pages;
+	stats.num_decodes = _num_decodes;
+	stats.num_page_grows = _num_page_grows;
+	stats.occupancy = _layout.GetOccupancy();
+	stats.load_ms = _load_ms;
+	return stats;
+}
+
+void SpriteAtlas::Decode(const MasterDataID sprite_id, DirectX::ScratchImage& out_image)
+{
+	const MdSpriteSheet& sprite_data = MdSpriteSheet::Get(sprite_id);
+	const MdImageFile& image_data = MasterHelper::GetImageFile(sprite_data);
+
+	DirectX::ScratchImage loaded_image;
+	HRESULT hr = DirectX::LoadFromDDSFile(StringToWString(image_data.path).c_str(), DirectX::DDS_FLAGS_NONE, nullptr, loaded_image);
+	if (FAILED(hr))
+	{
+		throw std::runtime_error("Failed to load sprite texture: " + image_data.path);
+	}
+	_num_decodes++;
+
+	// ページと同じ形式にする. ミップマップは使わないので最上位の1枚だけを残す
+	const DirectX::Image& top_image = *loaded_image.GetImage(0, 0, 0);
+	if (top_image.format == PageFormat)
+	{
+		hr = out_image.InitializeFromImage(top_image);
+	}
+	else if (DirectX::IsCompressed(top_image.format))
+	{
+		hr = DirectX::Decompress(top_image, PageFormat, out_image);
+	}
+	else
+	{
+		hr = DirectX::Convert(top_image, PageFormat, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, out_image);
+	}
+
+	if (FAILED(hr))
+	{
+		throw std::runtime_error("Failed to convert sprite texture: " + image_data.path);
+	}
+}
+
+int SpriteAtlas::Upload(const MasterDataID sprite_id, const DirectX::ScratchImage& image)
+{
+	const DirectX::Image& src = *image.GetImage(0, 0, 0);
+	const SpriteAtlasEntry* const entry = _layout.Add(sprite_id, static_cast<uint32_t>(src.width), static_cast<uint32_t>(src.height));
+	if (!entry)
+	{
+		throw std::runtime_error("Particle sprite atlas is full or the sprite is larger than a page: sprite_id=" + std::to_string(sprite_id));
+	}
+
+	if (!ReservePages(_layout.GetNumPages()))
+	{
+		throw std::runtime_error("Failed to grow particle sprite atlas");
+	}
+
+	// 1. スプライトの領域だけを書き込む
+	D3D11_BOX box = {};
+	box.left = entry->x;
+	box.right = entry->x + entry->width;
+	box.top = entry->y;
+	box.bottom = entry->y + entry->height;
+	box.front = 0;
+	box.back = 1;
+	m_pContextRef->UpdateSubresource(m_pResource_Textures.Get(), D3D11CalcSubresource(0, entry->page, 1), &box, src.pixels, static_cast<UINT>(src.rowPitch), 0);
+
+	// 2. スプライトシート情報の1要素だけを書き込む
+	const MdSpriteSheet& sprite_data = MdSpriteSheet::Get(sprite_id);
+	SpriteTextureInfo texinfo(sprite_data.num_rows, sprite_data.num_columns);
+	texinfo.uv_offset_x = static_cast<float>(entry->x) / _layout.GetPageWidth();
+	texinfo.uv_offset_y = static_cast<float>(entry->y) / _layout.GetPageHeight();
+	texinfo.uv_scale_x = static_cast<float>(entry->width) / _layout.GetPageWidth();
+	texinfo.uv_scale_y = static_cast<float>(entry->height) / _layout.GetPageHeight();
+	texinfo.page = entry->page;
+
+	D3D11_BOX texinfo_box = {};
+	texinfo_box.left = entry->index * sizeof(SpriteTextureInfo);
+	texinfo_box.right = texinfo_box.left + sizeof(SpriteTextureInfo);
+	texinfo_box.top = 0;
+	texinfo_box.bottom = 1;
+	texinfo_box.front = 0;
+	texinfo_box.back = 1;
+	m_pContextRef->UpdateSubresource(m_pResource_TexInfos.Get(), 0, &texinfo_box, &texinfo, 0, 0);
+
+	return static_cast<int>(entry->index);
+}
+
+bool SpriteAtlas::ReservePages(const uint32_t num_pages)
+{
+	if (num_pages <= _num_allocated_pages)
+	{
+		return true;
+	}
+
+	const uint32_t page_width = _layout.GetPageWidth();
+	const uint32_t page_height = _layout.GetPageHeight();
+
+	// 隙間のテクセルが透明になるように, 0で初期化する
+	const UINT row_pitch = page_width * BytesPerTexel;
+	const std::vector<uint8_t> zeros(static_cast<size_t>(row_pitch) * page_height, 0);
+	std::vector<D3D11_SUBRESOURCE_DATA> init_data(num_pages);
+	for (D3D11_SUBRESOURCE_DATA& data : init_data)
+	{
+		data.pSysMem = zeros.data();
+		data.SysMemPitch = row_pitch;
+		data.SysMemSlicePitch = 0;
+	}
+
+	D3D11_TEXTURE2D_DESC tex2d_desc = {};
+	tex2d_desc.Format = PageFormat;
+	tex2d_desc.ArraySize = num_pages;
+	tex2d_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	tex2d_desc.CPUAccessFlags = 0;
+	tex2d_desc.Height = page_height;
+	tex2d_desc.Width = page_width;
+	tex2d_desc.MipLevels = 1;
+	tex2d_desc.MiscFlags = 0;
+	tex2d_desc.SampleDesc.Count = 1;
+	tex2d_desc.SampleDesc.Quality = 0;
+	tex2d_desc.Usage = D3D11_USAGE_DEFAULT;
+
+	ComPtr<ID3D11Texture2D> new_texture;
+	HRESULT hr = m_pDevRef->CreateTexture2D(&tex2d_desc, init_data.data(), new_texture.GetAddressOf());
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC desc = {};
+	desc.Format = PageFormat;
+	desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+	desc.Texture2DArray.ArraySize = num_pages;
+	desc.Texture2DArray.FirstArraySlice = 0;
+	desc.Texture2DArray.MostDetailedMip = 0;
+	desc.Texture2DArray.MipLevels = 1;
+
+	ComPtr<ID3D11ShaderResourceView> new_srv;
+	hr = m_pDevRef->CreateShaderResourceView(new_texture.Get(), &desc, new_srv.GetAddressOf());
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	// 既存のページはGPU上でコピーし, スプライトを読み直さない
+	for (uint32_t page = 0; page < _num_allocated_pages; page++)
+	{
+		const UINT subresource = D3D11CalcSubresource(0, page, 1);
+		m_pContextRef->CopySubresourceRegion(new_texture.Get(), subresource, 0, 0, 0, m_pResource_Textures.Get(), subresource, nullptr);
+	}
+
+	if (_num_allocated_pages > 0)
+	{
+		_num_page_grows++;
+	}
+	m_pResource_Textures = new_texture;
+	m_pSRV_Textures = new_srv;
+	_num_allocated_pages = num_pages;
+	return true;
+}
+
+bool SpriteAtlas::CreateTexInfoBuffer()
+{
+	// 読み込んでいない要素も参照できるように, 全要素を既定値で初期化する
+	std::vector<SpriteTextureInfo> texinfos(MAX_TEXTURES_NUM);
+
+	D3D11_BUFFER_DESC buffDesc = {};
+	buffDesc.ByteWidth				= sizeof(SpriteTextureInfo) * MAX_TEXTURES_NUM;
+	buffDesc.Usage					= D3D11_USAGE_DEFAULT;
+	buffDesc.BindFlags				= D3D11_BIND_SHADER_RESOURCE;
+	buffDesc.CPUAccessFlags			= 0;
+	buffDesc.MiscFlags				= D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	buffDesc.StructureByteStride	= sizeof(SpriteTextureInfo);
+
+	D3D11_SUBRESOURCE_DATA initData = {};
+	initData.pSysMem = texinfos.data();
+	initData.SysMemPitch = 0;
+	initData.SysMemSlicePitch = 0;
+	HRESULT hr = m_pDevRef->CreateBuffer(&buffDesc, &initData, m_pResource_TexInfos.GetAddressOf());
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc = {};
+	viewDesc.Format = DXGI_FORMAT_UNKNOWN;
+	viewDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+	viewDesc.Buffer.FirstElement = 0;
+	viewDesc.Buffer.NumElements = MAX_TEXTURES_NUM;
+	hr = m_pDevRef->CreateShaderResourceView(m_pResource_TexInfos.Get(), &viewDesc, m_pSRV_TexInfos.GetAddressOf());
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include "GameSystems/ParticleManager/ParticleSystemSettings.h"
+#include "SpriteAtlasLayout.h"
+#include "GameSystems/MasterData/MasterDataID.h"
+#include <wrl/client.h>
+#include <d3d11.h>
+#include <vector>
+
+namespace DirectX
+{
+	class ScratchImage;
+}
+
+/// <summary>
+/// SpriteAtlasの統計情報
+/// </summary>
+struct SpriteAtlasStats
+{
+	// 常駐しているスプライトシート数と, スプライトを置いているページ数
+	uint32_t num_sprites;
+	uint32_t num_pages;
+
+	// テクスチャ配列のスライス数と, そのサイズ
+	uint32_t num_allocated_pages;
+	uint64_t resident_bytes;
+
+	// これまでにDDSを読み込んだ回数. 同じスプライトは一度しか読み込まない
+	uint32_t num_decodes;
+
+	// ページが足りずにテクスチャ配列を作り直した回数. 既存のページはGPU上でコピーする
+	uint32_t num_page_grows;
+
+	// 使っているページの面積に対する, スプライトの面積の割合
+	float occupancy;
+
+	// 読み込み(デコード, アップロード)にかかった時間の合計
+	double load_ms;
+};
+
+/// <summary>
+/// パーティクルのスプライトシートを常駐させるテクスチャアトラス
+/// <para>スプライトシートはSpriteAtlasLayoutで決めた位置に, 固定サイズのページを並べたTexture2DArrayへ書き込む</para>
+/// <para>新しいスプライトは読み込んだ1枚だけをその領域へアップロードし, 読み込み済みのスプライトを読み直したり動かしたりしない</para>
+/// <para>スプライトシート情報(SpriteTextureInfo)のバッファはMAX_TEXTURES_NUM個分を確保しておき, 追加した要素だけを書き込む</para>
+/// </summary>
+class SpriteAtlas
+{
+	template<typename T> using ComPtr = Microsoft::WRL::ComPtr<T>;
+public:
+	static constexpr DXGI_FORMAT PageFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
+	static constexpr uint32_t BytesPerTexel = 4;
+
+	SpriteAtlas();
+	~SpriteAtlas();
+
+	/// <summary>
+	/// 1ページ分のテクスチャ配列とスプライトシート情報のバッファを作る
+	/// </summary>
+	bool Init(ID3D11Device* pDev, ID3D11DeviceContext* pContext);
+
+	/// <summary>
+	/// 全てのリソースと配置を捨てる
+	/// </summary>
+	void Release();
+
+	/// <summary>
+	/// スプライトシートをアトラスに読み込み, テクスチャインデックスを返す. 読み込み済みの場合はインデックスだけ返す
+	/// <para>ファイルを読み込めない, アトラスに置けない場合はstd::runtime_errorを投げる</para>
+	/// </summary>
+	int Load(const MasterDataID sprite_id);
+
+	/// <summary>
+	/// 読み込まれていないスプライトシートをまとめて読み込む. 詰め込みの効率が良くなるように, 高さが大きいものから置く
+	/// </summary>
+	void Preload(const std::vector<MasterDataID>& sprite_ids);
+
+	bool IsResident(const MasterDataID sprite_id) const { return _layout.Find(sprite_id) != nullptr; }
+
+	ID3D11ShaderResourceView** GetTextureArraySRV();
+	ID3D11ShaderResourceView** GetTextureInfosSRV();
+
+	const SpriteAtlasLayout& GetLayout() const { return _layout; }
+	SpriteAtlasStats GetStats() const;
+
+private:
+	/// <summary>
+	/// スプライトシートのDDSを読み込み, ページと同じ形式の1枚の画像にする
+	/// </summary>
+	void Decode(const MasterDataID sprite_id, DirectX::ScratchImage& out_image);
+
+	/// <summary>
+	/// 読み込んだ画像をアトラスに置き, その領域とスプライトシート情報だけを書き込む
+	/// </summary>
+	int Upload(const MasterDataID sprite_id, const DirectX::ScratchImage& image);
+
+	/// <summary>
+	/// テクスチャ配列のスライス数をnum_pages以上にする. 作り直す場合は既存のページをコピーする
+	/// </summary>
+	bool ReservePages(const uint32_t num_pages);
+
+	bool CreateTexInfoBuffer();
+
+	ID3D11Device* m_pDevRef = nullptr;
+	ID3D11DeviceContext* m_pContextRef = nullptr;
+
+	ComPtr<ID3D11Texture2D> m_pResource_Textures;
+	ComPtr<ID3D11ShaderResourceView> m_pSRV_Textures;
+
+	ComPtr<ID3D11Buffer> m_pResource_TexInfos;
+	ComPtr<ID3D11ShaderResourceView> m_pSRV_TexInfos;
+
+	SpriteAtlasLayout _layout;
+	uint32_t _num_allocated_pages;
+	uint32_t _num_decodes;
+	uint32_t _num_page_grows;
+	double _load_ms;
+};
@@ -0,0 +1,203 @@
+#include "SpriteAtlasLayout.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+SpriteAtlasLayout::SpriteAtlasLayout(const uint32_t page_width, const uint32_t page_height, const uint32_t max_pages, const uint32_t max_entries, const uint32_t padding)
+	: _page_width(page_width)
+	, _page_height(page_height)
+	, _max_pages(max_pages)
+	, _max_entries(max_entries)
+	, _padding(padding)
+	, _used_texels(0)
+{
+	assert(page_width > padding * 2 && page_height > padding * 2);
+	assert(page_width <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
+	assert(page_height <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
+	assert(max_pages > 0 && max_entries > 0);
+	_entries.reserve(max_entries);
+	_pages.reserve(max_pages);
+}
+
+SpriteAtlasLayout::~SpriteAtlasLayout()
+{
+}
+
+const SpriteAtlasEntry* SpriteAtlasLayout::Find(const uint64_t sprite_id) const
+{
+	const auto it = _sprite_id_to_index.find(sprite_id);
+	if (it == _sprite_id_to_index.end())
+	{
+		return nullptr;
+	}
+	return &_entries.at(it->second);
+}
+
+const SpriteAtlasEntry* SpriteAtlasLayout::Add(const uint64_t sprite_id, const uint32_t width, const uint32_t height)
+{
+	if (const SpriteAtlasEntry* const resident = Find(sprite_id))
+	{
+		return resident;
+	}
+
+	// 左上のパディングはページの端の分としてスカイラインの初期値で空けてあるので, 右下の分だけを足す
+	if (width == 0 || height == 0 || _entries.size() >= _max_entries
+		|| width + _padding * 2 > _page_width || height + _padding * 2 > _page_height)
+	{
+		return nullptr;
+	}
+	const int32_t padded_width = static_cast<int32_t>(width + _padding);
+	const int32_t padded_height = static_cast<int32_t>(height + _padding);
+
+	// 1. 既存のページに前から順に置けるか試し, 置けなければ新しいページを使う
+	uint32_t page = 0;
+	size_t i_node = 0;
+	int32_t x = 0;
+	int32_t y = 0;
+	for (; page < _pages.size(); page++)
+	{
+		if (FindPosition(_pages.at(page), padded_width, padded_height, i_node, x, y))
+		{
+			break;
+		}
+	}
+
+	if (page == _pages.size())
+	{
+		if (_pages.size() >= _max_pages)
+		{
+			return nullptr;
+		}
+
+		const int32_t padding = static_cast<int32_t>(_padding);
+		_pages.push_back(Skyline{ SkylineNode{ padding, padding, static_cast<int32_t>(_page_width) - padding } });
+		const bool fits = FindPosition(_pages.back(), padded_width, padded_height, i_node, x, y);
+		assert(fits);
+		(void)fits;
+	}
+
+	// 2. 配置してスカイラインを更新する
+	Place(_pages.at(page), i_node, x, y, padded_width, padded_height);
+
+	SpriteAtlasEntry entry = {};
+	entry.sprite_id = sprite_id;
+	entry.index = static_cast<uint32_t>(_entries.size());
+	entry.page = page;
+	entry.x = static_cast<uint32_t>(x);
+	entry.y = static_cast<uint32_t>(y);
+	entry.width = width;
+	entry.height = height;
+	_entries.push_back(entry);
+	_sprite_id_to_index[sprite_id] = entry.index;
+	_used_texels += static_cast<uint64_t>(width) * height;
+
+	return &_entries.back();
+}
+
+void SpriteAtlasLayout::Clear()
+{
+	_entries.clear();
+	_sprite_id_to_index.clear();
+	_pages.clear();
+	_used_texels = 0;
+}
+
+float SpriteAtlasLayout::GetOccupancy() const
+{
+	if (_pages.empty())
+	{
+		return 0.f;
+	}
+	const uint64_t page_texels = static_cast<uint64_t>(_page_width) * _page_height * _pages.size();
+	return static_cast<float>(static_cast<double>(_used_texels) / static_cast<double>(page_texels));
+}
+
+bool SpriteAtlasLayout::FitsAt(const Skyline& skyline, const size_t i_node, const int32_t width, const int32_t height, int32_t& out_y) const
+{
+	// 矩形の下にある線分のうち最も低い(yが大きい)ものに上端を合わせる
+	const int32_t x = skyline.at(i_node).x;
+	if (x + width > static_cast<int32_t>(_page_width))
+	{
+		return false;
+	}
+
+	int32_t width_left = width;
+	int32_t y = skyline.at(i_node).y;
+	for (size_t i = i_node; width_left > 0; i++)
+	{
+		if (i == skyline.size())
+		{
+			return false;
+		}
+		y = std::max(y, skyline.at(i).y);
+		if (y + height > static_cast<int32_t>(_page_height))
+		{
+			return false;
+		}
+		width_left -= skyline.at(i).width;
+	}
+
+	out_y = y;
+	return true;
+}
+
+bool SpriteAtlasLayout::FindPosition(const Skyline& skyline, const int32_t width, const int32_t height, size_t& out_i_node, int32_t& out_x, int32_t& out_y) const
+{
+	bool is_found = false;
+	for (size_t i = 0; i < skyline.size(); i++)
+	{
+		int32_t y = 0;
+		if (!FitsAt(skyline, i, width, height, y))
+		{
+			continue;
+		}
+
+		// 線分は左から順に並んでいるので, yが同じなら先に見つかった方が左にある
+		if (!is_found || y < out_y)
+		{
+			is_found = true;
+			out_i_node = i;
+			out_x = skyline.at(i).x;
+			out_y = y;
+		}
+	}
+	return is_found;
+}
+
+void SpriteAtlasLayout::Place(Skyline& skyline, const size_t i_node, const int32_t x, const int32_t y, const int32_t width, const int32_t height)
+{
+	// 1. 矩形の下端を新しい線分として挿入する
+	skyline.insert(skyline.begin() + i_node, SkylineNode{ x, y + height, width });
+
+	// 2. 新しい線分に隠れた部分を後ろの線分から削る
+	for (size_t i = i_node + 1; i < skyline.size();)
+	{
+		const SkylineNode& prev = skyline.at(i - 1);
+		SkylineNode& node = skyline.at(i);
+		const int32_t overlap = prev.x + prev.width - node.x;
+		if (overlap <= 0)
+		{
+			break;
+		}
+
+		node.x += overlap;
+		node.width -= overlap;
+		if (node.width > 0)
+		{
+			break;
+		}
+		skyline.erase(skyline.begin() + i);
+	}
+
+	// 3. 高さが同じ隣り合う線分をまとめる
+	for (size_t i = 0; i + 1 < skyline.size();)
+	{
+		if (skyline.at(i).y == skyline.at(i + 1).y)
+		{
+			skyline.at(i).width += skyline.at(i + 1).width;
+			skyline.erase(skyline.begin() + i + 1);
+			continue;
+		}
+		i++;
+	}
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// アトラスに置いたスプライトシート1枚分の配置
+/// </summary>
+struct SpriteAtlasEntry
+{
+	// 呼び出し元が決めるスプライトのID. SpriteAtlasではMdSpriteSheetのID
+	uint64_t sprite_id;
+
+	// 追加された順の番号. パーティクルのテクスチャインデックスとして使う
+	uint32_t index;
+
+	// 置いたページと, ページ内の左上のテクセル位置. パディングは含まない
+	uint32_t page;
+	uint32_t x;
+	uint32_t y;
+	uint32_t width;
+	uint32_t height;
+};
+
+/// <summary>
+/// スプライトシートを固定サイズのページに詰めるアトラスの配置と常駐の管理. Direct3Dにもマスターデータにも依存しない
+/// <para>配置はページごとのスカイライン法(Bottom-Left)で決める. 一度置いたスプライトは動かさないので, 追加しても既存のテクセルを書き直す必要はない</para>
+/// <para>スプライトの周囲(ページの端を含む)には必ずpadding以上の隙間を空け, バイリニア補間で隣のスプライトが滲まないようにする</para>
+/// </summary>
+class SpriteAtlasLayout
+{
+public:
+	/// <param name="page_width">ページの幅 [texel]</param>
+	/// <param name="page_height">ページの高さ [texel]</param>
+	/// <param name="max_pages">ページ数の上限</param>
+	/// <param name="max_entries">置けるスプライトシート数の上限. テクスチャインデックスの範囲になる</param>
+	/// <param name="padding">スプライト同士, スプライトとページの端の間に空けるテクセル数</param>
+	SpriteAtlasLayout(const uint32_t page_width, const uint32_t page_height, const uint32_t max_pages, const uint32_t max_entries, const uint32_t padding);
+	~SpriteAtlasLayout();
+
+	/// <summary>
+	/// 配置済みのスプライトを探す
+	/// </summary>
+	/// <returns>配置されていない場合はnullptr</returns>
+	const SpriteAtlasEntry* Find(const uint64_t sprite_id) const;
+
+	/// <summary>
+	/// スプライトを配置する. 既存のページに置けない場合は新しいページを使う
+	/// <para>配置済みの場合は何もせず, その配置を返す</para>
+	/// </summary>
+	/// <returns>ページより大きい, スプライト数かページ数が上限に達しているなどで置けない場合はnullptr</returns>
+	const SpriteAtlasEntry* Add(const uint64_t sprite_id, const uint32_t width, const uint32_t height);
+
+	/// <summary>
+	/// 全ての配置を捨てる
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// 配置済みのスプライト. 要素の位置がSpriteAtlasEntry::indexと一致する
+	/// </summary>
+	const std::vector<SpriteAtlasEntry>& GetEntries() const { return _entries; }
+
+	/// <summary>
+	/// スプライトを1つ以上置いているページ数
+	/// </summary>
+	uint32_t GetNumPages() const { return static_cast<uint32_t>(_pages.size()); }
+
+	uint32_t GetPageWidth() const { return _page_width; }
+	uint32_t GetPageHeight() const { return _page_height; }
+	uint32_t GetMaxPages() const { return _max_pages; }
+	uint32_t GetMaxEntries() const { return _max_entries; }
+	uint32_t GetPadding() const { return _padding; }
+
+	/// <summary>
+	/// 配置済みのスプライトの面積の合計 [texel]. パディングは含まない
+	/// </summary>
+	uint64_t GetUsedTexels() const { return _used_texels; }
+
+	/// <summary>
+	/// 使っているページの面積に対する, スプライトの面積の割合
+	/// </summary>
+	float GetOccupancy() const;
+
+private:
+	/// <summary>
+	/// スカイラインの水平な線分. x から x + width までの区間で, yより上(y未満)は埋まっている
+	/// </summary>
+	struct SkylineNode
+	{
+		int32_t x;
+		int32_t y;
+		int32_t width;
+	};
+
+	typedef std::vector<SkylineNode> Skyline;
+
+	/// <summary>
+	/// 幅width, 高さheightの矩形の左端をskyline[i_node].xに合わせたときに置けるか調べる
+	/// </summary>
+	/// <param name="out_y">置ける場合の上端のy</param>
+	bool FitsAt(const Skyline& skyline, const size_t i_node, const int32_t width, const int32_t height, int32_t& out_y) const;
+
+	/// <summary>
+	/// 1つのページの中で, 上端が最も小さく(同じなら左端が最も小さく)なる位置を探す
+	/// </summary>
+	/// <returns>置けない場合はfalse</returns>
+	bool FindPosition(const Skyline& skyline, const int32_t width, const int32_t height, size_t& out_i_node, int32_t& out_x, int32_t& out_y) const;
+
+	/// <summary>
+	/// skyline[i_node]の位置に矩形を置き, スカイラインを更新する
+	/// </summary>
+	static void Place(Skyline& skyline, const size_t i_node, const int32_t x, const int32_t y, const int32_t width, const int32_t height);
+
+	uint32_t _page_width;
+	uint32_t _page_height;
+	uint32_t _max_pages;
+	uint32_t _max_entries;
+	uint32_t _padding;
+
+	std::vector<SpriteAtlasEntry> _entries;
+	std::unordered_map<uint64_t, uint32_t> _sprite_id_to_index;
+	std::vector<Skyline> _pages;
+	uint64_t _used_texels;
+};
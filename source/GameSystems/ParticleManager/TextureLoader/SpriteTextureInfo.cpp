@@ -3,11 +3,21 @@
 SpriteTextureInfo::SpriteTextureInfo(const unsigned int in_sprite_rows, const unsigned int in_sprite_columns)
 	: sprite_rows(in_sprite_rows)
 	, sprite_columns(in_sprite_columns)
+	, uv_offset_x(0.f)
+	, uv_offset_y(0.f)
+	, uv_scale_x(1.f)
+	, uv_scale_y(1.f)
+	, page(0)
 {
 }
 
 SpriteTextureInfo::SpriteTextureInfo()
 	: sprite_rows(1)
 	, sprite_columns(1)
+	, uv_offset_x(0.f)
+	, uv_offset_y(0.f)
+	, uv_scale_x(1.f)
+	, uv_scale_y(1.f)
+	, page(0)
 {
 }
@@ -11,6 +11,13 @@ struct SpriteTextureInfo
 	uint sprite_rows;
 	uint sprite_columns;
 
+	// アトラス内の位置. シートのUV(0~1)を uv_offset + uv * uv_scale でページのUVに変換し, pageのスライスをサンプリングする
+	float uv_offset_x;
+	float uv_offset_y;
+	float uv_scale_x;
+	float uv_scale_y;
+	uint page;
+
 #ifdef __cplusplus
 	SpriteTextureInfo(const unsigned int in_sprite_rows, const unsigned int in_sprite_columns);
 	SpriteTextureInfo();
@@ -0,0 +1,90 @@
+#include "SimulationClock.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+SimulationClock::SimulationClock()
+	: _is_fixed_step_enabled(true)
+	, _fixed_step_seconds(1.f / DEFAULT_STEPS_PER_SECOND)
+	, _max_steps_per_frame(DEFAULT_MAX_STEPS_PER_FRAME)
+	, _accumulated_seconds(0.f)
+	, _step_seconds(0.f)
+	, _stats{}
+{
+}
+
+void SimulationClock::SetFixedStepEnabled(const bool is_enabled)
+{
+	_is_fixed_step_enabled = is_enabled;
+	_accumulated_seconds = 0.f;
+}
+
+void SimulationClock::SetStepsPerSecond(const float steps_per_second)
+{
+	assert(steps_per_second > 0.f);
+	_fixed_step_seconds = 1.f / steps_per_second;
+	_accumulated_seconds = 0.f;
+}
+
+void SimulationClock::SetMaxStepsPerFrame(const int max_steps_per_frame)
+{
+	assert(max_steps_per_frame > 0);
+	_max_steps_per_frame = max_steps_per_frame;
+}
+
+int SimulationClock::Advance(const float delta_seconds)
+{
+	int num_steps = 0;
+
+	if (!_is_fixed_step_enabled)
+	{
+		_step_seconds = delta_seconds;
+		num_steps = 1;
+	}
+	else
+	{
+		_step_seconds = _fixed_step_seconds;
+		_accumulated_seconds += std::max(delta_seconds, 0.f);
+
+		// NOTE: 浮動小数点の誤差でステップ1回分にわずかに足りない場合も1ステップとみなす
+		const float step_threshold = _fixed_step_seconds * (1.f - 1e-4f);
+		while (_accumulated_seconds >= step_threshold && num_steps < _max_steps_per_frame)
+		{
+			_accumulated_seconds = std::max(_accumulated_seconds - _fixed_step_seconds, 0.f);
+			num_steps++;
+		}
+
+		// 上限に達して処理しきれない時間は捨てる. 持ち越すと次のフレームも上限まで進めることになり, 遅れが回復しない
+		if (_accumulated_seconds >= step_threshold)
+		{
+			_stats.num_capped_frames++;
+			_stats.dropped_seconds += _accumulated_seconds - std::fmod(_accumulated_seconds, _fixed_step_seconds);
+			_accumulated_seconds = std::fmod(_accumulated_seconds, _fixed_step_seconds);
+		}
+	}
+
+	if (num_steps == 0)
+	{
+		_stats.num_frames_without_step++;
+	}
+	_stats.num_steps_last_frame = num_steps;
+	_stats.num_total_steps += num_steps;
+
+	return num_steps;
+}
+
+float SimulationClock::GetInterpolationAlpha() const
+{
+	if (!_is_fixed_step_enabled)
+	{
+		return 1.f;
+	}
+	return std::min(_accumulated_seconds / _fixed_step_seconds, 1.f);
+}
+
+void SimulationClock::Reset()
+{
+	_accumulated_seconds = 0.f;
+	_step_seconds = 0.f;
+	_stats = ClockStats{};
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+
+/// <summary>
+/// ワールドの更新を固定の時間刻み(ステップ)で進めるための時計
+/// <para>フレームの経過時間を貯めておき, ステップ1回分貯まるごとにワールドを1ステップ進める. 余った時間は次のフレームに持ち越す</para>
+/// <para>ヒッチで大きな経過時間が来ても, 1フレームに進めるステップ数はmax_steps_per_frameまでで, 超えた分の時間は捨てる</para>
+/// <para>描画は, 最後の2ステップの間を持ち越した時間の割合(GetInterpolationAlpha())で補間して行う</para>
+/// </summary>
+class SimulationClock
+{
+public:
+	/// <summary>
+	/// 直近のAdvance()の結果と累計
+	/// </summary>
+	struct ClockStats
+	{
+		int num_steps_last_frame;
+		int num_frames_without_step;	// ステップを進めなかったフレーム数の累計
+		int num_capped_frames;			// ステップ数が上限に達し, 時間を捨てたフレーム数の累計
+		float dropped_seconds;			// 上限を超えて捨てた時間の累計
+		uint64_t num_total_steps;
+	};
+
+	// 1秒あたりのステップ数の既定値
+	static constexpr float DEFAULT_STEPS_PER_SECOND = 120.f;
+
+	// 1フレームに進めるステップ数の上限の既定値
+	static constexpr int DEFAULT_MAX_STEPS_PER_FRAME = 8;
+
+	SimulationClock();
+
+	/// <summary>
+	/// 固定ステップを使うか. falseの場合, 1フレームに1回, フレームの経過時間でワールドを進める(補間なし)
+	/// </summary>
+	void SetFixedStepEnabled(const bool is_enabled);
+	bool IsFixedStepEnabled() const { return _is_fixed_step_enabled; }
+
+	/// <summary>
+	/// 1秒あたりのステップ数を設定する. 貯めている時間は捨てる
+	/// </summary>
+	void SetStepsPerSecond(const float steps_per_second);
+	float GetStepsPerSecond() const { return 1.f / _fixed_step_seconds; }
+
+	void SetMaxStepsPerFrame(const int max_steps_per_frame);
+	int GetMaxStepsPerFrame() const { return _max_steps_per_frame; }
+
+	/// <summary>
+	/// フレームの経過時間を貯め, このフレームに進めるステップ数を返す
+	/// </summary>
+	/// <param name="delta_seconds">フレームの経過時間(ゲーム速度を反映済み)</param>
+	int Advance(const float delta_seconds);
+
+	/// <summary>
+	/// 直近のAdvance()で進める1ステップの時間. 固定ステップが無効の場合はフレームの経過時間
+	/// </summary>
+	float GetStepSeconds() const { return _step_seconds; }
+
+	/// <summary>
+	/// 描画の補間に使う, 最後のステップの状態の重み[0, 1]. 1の場合は最後のステップの状態をそのまま描画する
+	/// </summary>
+	float GetInterpolationAlpha() const;
+
+	/// <summary>
+	/// 貯めている時間と統計を捨てる
+	/// </summary>
+	void Reset();
+
+	const ClockStats& GetStats() const { return _stats; }
+
+private:
+	bool _is_fixed_step_enabled;
+	float _fixed_step_seconds;
+	int _max_steps_per_frame;
+
+	// 次のステップまでに貯めている時間
+	float _accumulated_seconds;
+	float _step_seconds;
+
+	ClockStats _stats;
+};
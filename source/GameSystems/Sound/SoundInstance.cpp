@@ -1,5 +1,6 @@
 #include "SoundInstance.h"
 #include "GameSystems/Sound/SoundManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
 
 #undef PlaySound
 
@@ -12,7 +13,7 @@ SoundInstance::SoundInstance(const int handle)
 
 SoundInstance::~SoundInstance()
 {
-	SoundManager::GetInstance().UnloadSound(_handle, _should_play_to_end_when_destroyed);
+	SoundManager::GetInstance().ReleaseSoundInstance(*this);
 }
 
 int SoundInstance::GetVolume() const
@@ -37,6 +38,11 @@ void SoundInstance::Stop() const
 
 void SoundInstance::SetPlaySpeed(const float play_speed)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	DxLib::ResetFrequencySoundMem(_handle);
 	DxLib::SetFrequencySoundMem(static_cast<int>(DxLib::GetFrequencySoundMem(_handle) * play_speed), _handle);
 }
@@ -4,9 +4,12 @@
 
 /// <summary>
 /// サウンドインスタンス. SoundManagerで作成される.
+/// <para>同じファイルのインスタンスは, SoundManagerがキャッシュしている1つのサウンドデータを共有する</para>
 /// </summary>
 class SoundInstance
 {
+	friend class SoundManager;
+
 public:
 	SoundInstance(const int handle);
 	~SoundInstance();
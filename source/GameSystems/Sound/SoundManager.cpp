@@ -1,6 +1,26 @@
 #include "SoundManager.h"
 #include "Core.h"
 #include <nlohmann/json.hpp>
+#include "GameSystems/Headless/HeadlessPlatform.h"
+
+namespace
+{
+	// シーンをまたいで保持するサウンドデータの予算
+	constexpr uint64_t SOUND_CACHE_BUDGET_BYTES = 64ull * 1024 * 1024;
+
+	void UnloadCachedSound(const std::string&, int& sound_handle)
+	{
+		if (sound_handle != -1)
+		{
+			DxLib::DeleteSoundMem(sound_handle);
+		}
+	}
+}
+
+SoundManager::SoundManager()
+	: _cache(SOUND_CACHE_BUDGET_BYTES, &UnloadCachedSound)
+{
+}
 
 void SoundManager::Finalize()
 {
@@ -9,6 +29,12 @@ void SoundManager::Finalize()
 
 int SoundManager::LoadSoundResource(const std::string& file_name, const int buffer_num)
 {
+	// ヘッドレス実行ではサウンドをロードせず, 以降の操作は全て何もしない
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return -1;
+	}
+
 	const int new_handle = DxLib::LoadSoundMem(to_tstring(file_name).c_str(), buffer_num);
 
 	_sound_handles.insert(new_handle);
@@ -18,6 +44,11 @@ int SoundManager::LoadSoundResource(const std::string& file_name, const int buff
 
 void SoundManager::UnloadSound(const int sound_handle, const bool wait_until_the_end)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	_sound_handles.erase(sound_handle);
 
 	if (wait_until_the_end && DxLib::CheckSoundMem(sound_handle) != 0)
@@ -32,34 +63,168 @@ void SoundManager::UnloadSound(const int sound_handle, const bool wait_until_the
 
 void SoundManager::UnloadAllSounds()
 {
+	_finishing_sounds.clear();
+	_instance_file_paths.clear();
+	_cache.Clear();
+	_sound_handles.clear();
+
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
     DxLib::InitSoundMem();
 }
 
+void SoundManager::UnloadSceneSounds()
+{
+	for (const int sound_handle : _sound_handles)
+	{
+		DxLib::DeleteSoundMem(sound_handle);
+	}
+	_sound_handles.clear();
+}
+
+void SoundManager::TrimCache()
+{
+	UpdateFinishingSounds();
+	_cache.Trim();
+}
+
+void SoundManager::SetCacheBudget(const uint64_t budget_bytes)
+{
+	_cache.SetBudget(budget_bytes);
+}
+
+AssetCacheStats SoundManager::GetCacheStats() const
+{
+	return _cache.GetStats();
+}
+
+void SoundManager::UpdateFinishingSounds()
+{
+	for (auto it = _finishing_sounds.begin(); it != _finishing_sounds.end();)
+	{
+		if (DxLib::CheckSoundMem(it->handle) == 1)
+		{
+			++it;
+			continue;
+		}
+
+		DxLib::DeleteSoundMem(it->handle);
+		_cache.Release(it->file_path);
+		it = _finishing_sounds.erase(it);
+	}
+}
+
 void SoundManager::PlaySound(const int sound_handle, const bool should_loop, const bool top_position_flag)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	int play_type = should_loop ? DX_PLAYTYPE_LOOP : DX_PLAYTYPE_BACK;
 	DxLib::PlaySoundMem(sound_handle, play_type, top_position_flag);
 }
 
 void SoundManager::StopSound(const int sound_handle)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	DxLib::StopSoundMem(sound_handle);
 }
 
 void SoundManager::SetVolume(const int sound_handle, const int volume)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	const int clamped_volume = clamp(volume, 0, 100);
 	DxLib::ChangeVolumeSoundMem(255 * clamped_volume / 100, sound_handle);
 }
 
 int SoundManager::GetVolume(const int sound_handle)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return 0;
+	}
+
 	int volume_value = DxLib::GetVolumeSoundMem2(sound_handle);
 	return 100 * volume_value / 255;
 }
 
 std::shared_ptr<SoundInstance> SoundManager::MakeSoundInstance(const std::string& file_path, const int buffer_num)
 {
-	const int sound_handle = LoadSoundResource(file_path, buffer_num);
-	return std::make_shared<SoundInstance>(sound_handle);
+	const bool is_headless = HeadlessPlatform::IsEnabled();
+	if (!is_headless)
+	{
+		UpdateFinishingSounds();
+	}
+
+	// 前のシーンから残っている場合はロードせずに共有する
+	const int* p_source_handle = _cache.Acquire(file_path);
+	if (!p_source_handle)
+	{
+		// ヘッドレス実行ではサウンドをロードせず, 無効なハンドルを記録する
+		int source_handle = -1;
+		uint64_t bytes = 0;
+		if (!is_headless)
+		{
+			source_handle = DxLib::LoadSoundMem(to_tstring(file_path).c_str(), 1);
+			if (source_handle == -1)
+			{
+				throw std::runtime_error("[SoundManager::MakeSoundInstance()]failed to load " + file_path);
+			}
+
+			// 16bitステレオとして見積もる
+			bytes = static_cast<uint64_t>(DxLib::GetSoundTotalSample(source_handle)) * 4;
+		}
+		p_source_handle = &_cache.Insert(file_path, std::move(source_handle), bytes);
+	}
+
+	// 音量や再生位置はインスタンスごとに持つので, サウンドデータを共有したハンドルを作る
+	const int sound_handle = is_headless ? -1 : DxLib::DuplicateSoundMem(*p_source_handle, buffer_num);
+	auto new_instance = std::make_shared<SoundInstance>(sound_handle);
+	_instance_file_paths[new_instance.get()] = file_path;
+	return new_instance;
+}
+
+void SoundManager::ReleaseSoundInstance(const SoundInstance& instance)
+{
+	const auto it = _instance_file_paths.find(&instance);
+	if (it == _instance_file_paths.end())
+	{
+		// UnloadAllSounds()の後に残っていたインスタンスは, サウンドデータの参照を持っていない
+		if (!HeadlessPlatform::IsEnabled())
+		{
+			DxLib::DeleteSoundMem(instance._handle);
+		}
+		return;
+	}
+
+	const std::string file_path = std::move(it->second);
+	_instance_file_paths.erase(it);
+
+	if (HeadlessPlatform::IsEnabled())
+	{
+		_cache.Release(file_path);
+		return;
+	}
+
+	// 再生が終わるまでサウンドデータを解放しない
+	if (instance._should_play_to_end_when_destroyed && DxLib::CheckSoundMem(instance._handle) == 1)
+	{
+		_finishing_sounds.push_back(FinishingSound{ instance._handle, file_path });
+		return;
+	}
+
+	DxLib::DeleteSoundMem(instance._handle);
+	_cache.Release(file_path);
 }
@@ -2,9 +2,11 @@
 
 #include "Core.h"
 #include "Utility/SingletonBase.h"
+#include "Utility/AssetCache.h"
 #include "SoundInstance.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #undef PlaySound
 
@@ -14,6 +16,10 @@ struct Sound
 	int volume;	// [0, 100]
 };
 
+/// <summary>
+/// サウンドの管理クラス
+/// <para>MakeSoundInstance()でロードしたサウンドデータはAssetCacheに入れてシーンをまたいで保持し, インスタンスはそれを複製して作る</para>
+/// </summary>
 class SoundManager : public Singleton<SoundManager>
 {
 private:
@@ -30,6 +36,7 @@ public:
 public:
 	/// <summary>
 	/// サウンドをロード
+	/// <para>キャッシュには入れない. UnloadSound()で解放しなかったものは, シーンの終了時にUnloadSceneSounds()で解放される</para>
 	/// </summary>
 	/// <param name="file_name">音声ファイルパス</param>
 	/// <param name="buffer_num">同時に再生できる数</param>
@@ -43,10 +50,29 @@ public:
 	void UnloadSound(const int sound_handle, const bool wait_until_the_end = false);
 
 	/// <summary>
-	/// すべてのサウンドを解放
+	/// すべてのサウンドを解放. キャッシュしているサウンドデータも解放し, 残っているサウンドインスタンスは無効になる
 	/// </summary>
 	void UnloadAllSounds();
 
+	/// <summary>
+	/// LoadSoundResource()でロードし, まだ解放していないサウンドを解放する. キャッシュしているサウンドデータは解放しない
+	/// <para>SceneBase::Finalize()でアクターを破棄した後に呼ばれる</para>
+	/// </summary>
+	void UnloadSceneSounds();
+
+	/// <summary>
+	/// 最後まで再生して破棄するインスタンスのうち再生が終わったものを解放し, 予算を超えた分の使われていないサウンドデータを解放する
+	/// <para>SceneBase::Finalize()でアクターを破棄した後に呼ばれる</para>
+	/// </summary>
+	void TrimCache();
+
+	/// <summary>
+	/// キャッシュの予算を設定し, 超えた分の使われていないサウンドデータを解放する
+	/// </summary>
+	void SetCacheBudget(const uint64_t budget_bytes);
+
+	AssetCacheStats GetCacheStats() const;
+
 	/// <summary>
 	/// サウンドを再生開始
 	/// </summary>
@@ -82,6 +108,31 @@ public:
 	/// <returns>サウンドインスタンス</returns>
 	std::shared_ptr<SoundInstance> MakeSoundInstance(const std::string& file_path, const int buffer_num = 3);
 
+	/// <summary>
+	/// サウンドインスタンスのハンドルを解放し, 共有しているサウンドデータの参照を外す. SoundInstanceのデストラクタから呼ばれる
+	/// </summary>
+	void ReleaseSoundInstance(const SoundInstance& instance);
+
 private:
+	SoundManager();
+
+	// 最後まで再生してから解放するインスタンス
+	struct FinishingSound
+	{
+		int handle;
+		std::string file_path;
+	};
+
+	void UpdateFinishingSounds();
+
+	// LoadSoundResource()でロードしたサウンドハンドル
 	std::unordered_set<int> _sound_handles;
+
+	// 音声ファイルパスから, 複製元のサウンドハンドル
+	AssetCache<std::string, int> _cache;
+
+	// 生きているサウンドインスタンスが共有しているサウンドデータの音声ファイルパス
+	std::unordered_map<const SoundInstance*, std::string> _instance_file_paths;
+
+	std::vector<FinishingSound> _finishing_sounds;
 };
\ No newline at end of file
@@ -5,7 +5,7 @@
 
 namespace
 {
-	constexpr const uint16_t KEY_BUFFER_SIZE = 256;
+	constexpr const uint16_t KEY_BUFFER_SIZE = DeviceInputSnapshot::KEY_BUFFER_SIZE;
 	constexpr const float DRAGDROP_MOUSEMOVE_THRESHOLD = 2.f;
 }
 std::vector<DeviceInput::ButtonState> DeviceInput::key_states(KEY_BUFFER_SIZE, DeviceInput::ButtonState::Up);
@@ -22,6 +22,9 @@ std::unordered_map<int, DeviceInput::ButtonState> DeviceInput::mouse_states(
 		{MOUSE_INPUT_8, DeviceInput::ButtonState::Up}
 	});
 
+std::vector<DeviceInput::PendingEdges> DeviceInput::key_pending_edges(KEY_BUFFER_SIZE);
+std::unordered_map<int, DeviceInput::PendingEdges> DeviceInput::mouse_pending_edges;
+
 DeviceInput::WheelState DeviceInput::wheel_state = DeviceInput::WheelState::Stopped;
 
 DeviceInput::InputEvents DeviceInput::input_events = DeviceInput::InputEvents();
@@ -30,24 +33,30 @@ Vector2D DeviceInput::_current_mouse_pos = DeviceInput::CallDxLibGetMousePoint()
 Vector2D DeviceInput::_delta_mouse_pos = Vector2D();
 bool DeviceInput::_is_mouse_dragging = false;
 bool DeviceInput::_has_reset = false;
+bool DeviceInput::_is_in_world_step = false;
+DeviceInputSource* DeviceInput::_input_source = nullptr;
+DeviceInputSnapshot DeviceInput::_last_snapshot = DeviceInputSnapshot();
 
 void DeviceInput::Tick()
 {
+	PollInputSource(_last_snapshot);
+	const DeviceInputSnapshot& snapshot = _last_snapshot;
+
 	if (_has_reset)
 	{
-		if (DxLib::CheckHitKeyAll() == 0)
+		if (!IsAnyButtonActive(snapshot))
 		{
 			_has_reset = false;
 		}
 		return;
 	}
 
-	UpdateKeyStates();
-	UpdateMouseButtonStates();
-	UpdateWheelState();
+	UpdateKeyStates(snapshot);
+	UpdateMouseButtonStates(snapshot);
+	UpdateWheelState(snapshot);
 
 	_last_mouse_pos = _current_mouse_pos;
-	_current_mouse_pos = CallDxLibGetMousePoint();
+	_current_mouse_pos = snapshot.mouse_position;
 	_delta_mouse_pos = _current_mouse_pos - _last_mouse_pos;
 	if (_delta_mouse_pos.Length() < EPSIRON)
 	{
@@ -83,11 +92,16 @@ void DeviceInput::ReleaseAllKey()
 	{
 		state = ButtonState::Up;
 	}
+	for (auto& pending_edges : key_pending_edges)
+	{
+		pending_edges = PendingEdges();
+	}
 }
 
 void DeviceInput::ResetAll()
 {
 	ReleaseAllKey();
+	mouse_pending_edges.clear();
 	input_events = InputEvents();
 	_has_reset = true;
 }
@@ -96,11 +110,11 @@ DeviceInput::ButtonState DeviceInput::GetButtonState(const uint8_t dx_button_cod
 {
 	if (device == Device::KEYBOARD)
 	{
-		return key_states.at(dx_button_code);
+		return ApplyPendingEdges(key_states.at(dx_button_code), key_pending_edges.at(dx_button_code));
 	}
 	else if (device == Device::MOUSE)
 	{
-		return mouse_states.at(dx_button_code);
+		return ApplyPendingEdges(mouse_states.at(dx_button_code), mouse_pending_edges[dx_button_code]);
 	}
 	return ButtonState::Up;
 }
@@ -127,58 +141,22 @@ bool DeviceInput::IsActive(const uint8_t dx_button_code, const Device device)
 
 bool DeviceInput::IsPressed(const uint8_t dx_button_code, const Device device)
 {
-	if (device == Device::KEYBOARD)
-	{
-		return key_states.at(dx_button_code) == ButtonState::Pressed;
-	}
-	else if (device == Device::MOUSE)
-	{
-		return mouse_states.at(dx_button_code) == ButtonState::Pressed;
-	}
-
-	return false;
+	return GetButtonState(dx_button_code, device) == ButtonState::Pressed;
 }
 
 bool DeviceInput::IsReleased(const uint8_t dx_button_code, const Device device)
 {
-	if (device == Device::KEYBOARD)
-	{
-		return key_states.at(dx_button_code) == ButtonState::Released;
-	}
-	else if (device == Device::MOUSE)
-	{
-		return mouse_states.at(dx_button_code) == ButtonState::Released;
-	}
-
-	return false;
+	return GetButtonState(dx_button_code, device) == ButtonState::Released;
 }
 
 bool DeviceInput::IsUp(const uint8_t dx_button_code, const Device device)
 {
-	if (device == Device::KEYBOARD)
-	{
-		return key_states.at(dx_button_code) == ButtonState::Up;
-	}
-	else if (device == Device::MOUSE)
-	{
-		return mouse_states.at(dx_button_code) == ButtonState::Up;
-	}
-
-	return true;
+	return GetButtonState(dx_button_code, device) == ButtonState::Up;
 }
 
 bool DeviceInput::IsDown(const uint8_t dx_button_code, const Device device)
 {
-	if (device == Device::KEYBOARD)
-	{
-		return key_states.at(dx_button_code) == ButtonState::Down;
-	}
-	else if (device == Device::MOUSE)
-	{
-		return mouse_states.at(dx_button_code) == ButtonState::Down;
-	}
-
-	return false;
+	return GetButtonState(dx_button_code, device) == ButtonState::Down;
 }
 
 Vector2D DeviceInput::GetInputDir_WASD()
@@ -268,6 +246,80 @@ bool DeviceInput::IsActiveAny(const Device device)
 	return false;
 }
 
+void DeviceInput::EndWorldStep()
+{
+	_is_in_world_step = false;
+
+	for (auto& pending_edges : key_pending_edges)
+	{
+		ConsumePendingEdge(pending_edges);
+	}
+	for (auto& button_pending_edges_pair : mouse_pending_edges)
+	{
+		ConsumePendingEdge(button_pending_edges_pair.second);
+	}
+}
+
+void DeviceInput::DiscardPendingEdgeEvents()
+{
+	for (auto& pending_edges : key_pending_edges)
+	{
+		pending_edges = PendingEdges();
+	}
+	mouse_pending_edges.clear();
+}
+
+DeviceInput::ButtonState DeviceInput::ApplyPendingEdges(const ButtonState state, const PendingEdges& pending_edges)
+{
+	if (!_is_in_world_step)
+	{
+		return state;
+	}
+
+	// 受け取っていない押された瞬間/離された瞬間があれば, 今のフレームの状態より先に返す
+	if (pending_edges.num_edges > 0)
+	{
+		return pending_edges.first_edge;
+	}
+
+	// このフレームの押された瞬間/離された瞬間は, 前のステップで受け取り済み
+	switch (state)
+	{
+	case ButtonState::Pressed: return ButtonState::Down;
+	case ButtonState::Released: return ButtonState::Up;
+	}
+	return state;
+}
+
+void DeviceInput::AddPendingEdge(PendingEdges& pending_edges, const ButtonState new_state)
+{
+	if (new_state != ButtonState::Pressed && new_state != ButtonState::Released)
+	{
+		return;
+	}
+
+	if (pending_edges.num_edges == 1)
+	{
+		pending_edges.num_edges = 2;
+		return;
+	}
+
+	// 空か, 2つ溜まっている場合は古いものを捨てて, 新しいものだけを持つ
+	pending_edges.first_edge = new_state;
+	pending_edges.num_edges = 1;
+}
+
+void DeviceInput::ConsumePendingEdge(PendingEdges& pending_edges)
+{
+	if (pending_edges.num_edges == 0)
+	{
+		return;
+	}
+
+	pending_edges.num_edges--;
+	pending_edges.first_edge = (pending_edges.first_edge == ButtonState::Pressed) ? ButtonState::Released : ButtonState::Pressed;
+}
+
 DeviceInput::ButtonState DeviceInput::GetNextButtonState(const ButtonState last_state, const bool button_is_active_now)
 {
 	// Last: Active -> Current: InActive  => Released
@@ -297,35 +349,70 @@ DeviceInput::ButtonState DeviceInput::GetNextButtonState(const ButtonState last_
 	return last_state;
 }
 
-void DeviceInput::UpdateKeyStates()
+void DeviceInput::PollInputSource(DeviceInputSnapshot& out_snapshot)
+{
+	if (_input_source)
+	{
+		_input_source->Poll(out_snapshot);
+		return;
+	}
+
+	PollDxLib(out_snapshot);
+}
+
+void DeviceInput::PollDxLib(DeviceInputSnapshot& out_snapshot)
+{
+	DxLib::GetHitKeyStateAll(out_snapshot.key_buf);
+	out_snapshot.mouse_input = DxLib::GetMouseInput();
+	out_snapshot.mouse_wheel_rot = DxLib::GetMouseWheelRotVol();
+	out_snapshot.mouse_position = CallDxLibGetMousePoint();
+}
+
+bool DeviceInput::IsAnyButtonActive(const DeviceInputSnapshot& snapshot)
 {
-	char key_buf[KEY_BUFFER_SIZE];
-	GetHitKeyStateAll(key_buf);
+	if (snapshot.mouse_input != 0)
+	{
+		return true;
+	}
+
+	for (int i = 0; i < KEY_BUFFER_SIZE; i++)
+	{
+		if (snapshot.key_buf[i] == 1)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
+void DeviceInput::UpdateKeyStates(const DeviceInputSnapshot& snapshot)
+{
 	for (int i = 0; i < KEY_BUFFER_SIZE; i++)
 	{
 		const ButtonState last_key_state = key_states.at(i);
-		const bool key_is_active_now = (key_buf[i] == 1);
+		const bool key_is_active_now = (snapshot.key_buf[i] == 1);
 		key_states.at(i) = GetNextButtonState(last_key_state, key_is_active_now);
+		AddPendingEdge(key_pending_edges.at(i), key_states.at(i));
 	}
 }
 
-void DeviceInput::UpdateMouseButtonStates()
+void DeviceInput::UpdateMouseButtonStates(const DeviceInputSnapshot& snapshot)
 {
 	// MOUSE_INPUT_X との論理積が0でなければマウスボタンXは押されている
-	const int mouse_input = GetMouseInput();
+	const int mouse_input = snapshot.mouse_input;
 
 	for (auto& button_state_pair : mouse_states)
 	{
 		const ButtonState last_mouse_state = button_state_pair.second;
 		const bool button_is_active_now = ((mouse_input & button_state_pair.first) != 0);
 		button_state_pair.second = GetNextButtonState(last_mouse_state, button_is_active_now);
+		AddPendingEdge(mouse_pending_edges[button_state_pair.first], button_state_pair.second);
 	}
 }
 
-void DeviceInput::UpdateWheelState()
+void DeviceInput::UpdateWheelState(const DeviceInputSnapshot& snapshot)
 {
-	int rot = GetMouseWheelRotVol();
+	const int rot = snapshot.mouse_wheel_rot;
 
 	if (rot > 0)
 	{
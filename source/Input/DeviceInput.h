@@ -5,6 +5,7 @@
 #include <functional>
 #include "Utility/Core/Math/Vector2D.h"
 #include "Utility/Core/Event.h"
+#include "Input/DeviceInputSource.h"
 
 
 /// <summary>
@@ -68,15 +69,65 @@ public:
 
 	// いずれかのキーが押されている
 	static bool IsActiveAny(const Device device = Device::KEYBOARD);
+
+	/// <summary>
+	/// ワールドの1ステップの開始. EndWorldStep()までのボタンの取得は, ワールドがまだ受け取っていない押された瞬間/離された瞬間を返す
+	/// <para>ステップを1回も進めなかったフレームの押された瞬間/離された瞬間は, 次のステップまで持ち越される</para>
+	/// <para>1フレームにワールドを複数ステップ進める場合, 1つの押された瞬間/離された瞬間は1ステップだけで検出される</para>
+	/// </summary>
+	static void BeginWorldStep() { _is_in_world_step = true; }
+
+	/// <summary>
+	/// ワールドの1ステップの終了. 各ボタンの持ち越している押された瞬間/離された瞬間を1つずつ受け取り済みにする
+	/// </summary>
+	static void EndWorldStep();
+
+	/// <summary>
+	/// 持ち越している押された瞬間/離された瞬間を捨てる. ワールドを止めている間の入力をワールドに渡さないために使う
+	/// </summary>
+	static void DiscardPendingEdgeEvents();
+
+	/// <summary>
+	/// 入力の供給元を設定する. nullptrの場合はDxLibから直接ポーリングする
+	/// <para>所有権は移らないので, 呼び出し側はnullptrに戻すまでinput_sourceを破棄しないこと</para>
+	/// </summary>
+	static void SetInputSource(DeviceInputSource* const input_source) { _input_source = input_source; }
+	static DeviceInputSource* GetInputSource() { return _input_source; }
+
+	/// <summary>
+	/// 直近のTick()でポーリングした入力状態. 入力の記録に使う
+	/// </summary>
+	static const DeviceInputSnapshot& GetLastSnapshot() { return _last_snapshot; }
 private:
+	/// <summary>
+	/// ワールドのステップがまだ受け取っていない, ボタンの押された瞬間/離された瞬間
+	/// <para>押された瞬間と離された瞬間は交互に起きるので, 最初の1つと数だけを持つ. 3つ目が来たら古い2つ(1回分のタップ)を捨てる</para>
+	/// </summary>
+	struct PendingEdges
+	{
+		ButtonState first_edge = ButtonState::Up;
+		uint8_t num_edges = 0;
+	};
+
+	/// <summary>
+	/// BeginWorldStep()の間は, 持ち越している押された瞬間/離された瞬間を反映したボタンの状態を返す
+	/// </summary>
+	static ButtonState ApplyPendingEdges(const ButtonState state, const PendingEdges& pending_edges);
+	static void AddPendingEdge(PendingEdges& pending_edges, const ButtonState new_state);
+	static void ConsumePendingEdge(PendingEdges& pending_edges);
 	static ButtonState GetNextButtonState(const ButtonState last_state, const bool is_active_now);
-	static void UpdateKeyStates();
-	static void UpdateMouseButtonStates();
-	static void UpdateWheelState();
+	static void PollInputSource(DeviceInputSnapshot& out_snapshot);
+	static void PollDxLib(DeviceInputSnapshot& out_snapshot);
+	static bool IsAnyButtonActive(const DeviceInputSnapshot& snapshot);
+	static void UpdateKeyStates(const DeviceInputSnapshot& snapshot);
+	static void UpdateMouseButtonStates(const DeviceInputSnapshot& snapshot);
+	static void UpdateWheelState(const DeviceInputSnapshot& snapshot);
 	static Vector2D CallDxLibGetMousePoint();
 
 	static std::vector<ButtonState> key_states;
 	static std::unordered_map<int, ButtonState> mouse_states;
+	static std::vector<PendingEdges> key_pending_edges;
+	static std::unordered_map<int, PendingEdges> mouse_pending_edges;
 	static WheelState wheel_state;
 
 	static Vector2D _last_mouse_pos;
@@ -84,4 +135,7 @@ private:
 	static Vector2D _current_mouse_pos;
 	static bool _is_mouse_dragging;
 	static bool _has_reset;
+	static bool _is_in_world_step;
+	static DeviceInputSource* _input_source;
+	static DeviceInputSnapshot _last_snapshot;
 };
\ No newline at end of file
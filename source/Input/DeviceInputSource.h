@@ -0,0 +1,36 @@
+#pragma once
+#include "Utility/Core/Math/Vector2D.h"
+
+/// <summary>
+/// DeviceInput::Tick()で1回ポーリングした, 入力デバイスの状態
+/// </summary>
+struct DeviceInputSnapshot
+{
+	static constexpr int KEY_BUFFER_SIZE = 256;
+
+	// DxLib::GetHitKeyStateAll()と同じ形式. 押されているキーは1
+	char key_buf[KEY_BUFFER_SIZE];
+
+	// DxLib::GetMouseInput()と同じ形式. 押されているボタンのMOUSE_INPUT_Xの論理和
+	int mouse_input;
+
+	// DxLib::GetMouseWheelRotVol()と同じ形式
+	int mouse_wheel_rot;
+
+	Vector2D mouse_position;
+};
+
+/// <summary>
+/// DeviceInputに入力を供給するインターフェース
+/// <para>DeviceInput::SetInputSource()で設定していない場合, DeviceInputはDxLibから直接ポーリングする</para>
+/// </summary>
+class DeviceInputSource
+{
+public:
+	virtual ~DeviceInputSource() {}
+
+	/// <summary>
+	/// 現在の入力状態を取得する. DeviceInput::Tick()から1フレームに1回呼ばれる
+	/// </summary>
+	virtual void Poll(DeviceInputSnapshot& out_snapshot) = 0;
+};
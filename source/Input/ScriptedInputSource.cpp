@@ -0,0 +1,124 @@
+#include "ScriptedInputSource.h"
+#include "Core.h"
+#include <DxLib.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+ScriptedInputSource::ScriptedInputSource()
+	: _next_event_index(0)
+	, _script_time(0.f)
+	, _loop_seconds(0.f)
+{
+	std::memset(_key_buf, 0, sizeof(_key_buf));
+}
+
+ScriptedInputSource::~ScriptedInputSource()
+{
+}
+
+void ScriptedInputSource::Poll(DeviceInputSnapshot& out_snapshot)
+{
+	std::memcpy(out_snapshot.key_buf, _key_buf, sizeof(_key_buf));
+	out_snapshot.mouse_input = 0;
+	out_snapshot.mouse_wheel_rot = 0;
+	out_snapshot.mouse_position = Vector2D();
+}
+
+void ScriptedInputSource::LoadFromFile(const std::string& file_path)
+{
+	std::ifstream ifs(file_path);
+	if (!ifs)
+	{
+		throw std::runtime_error("Failed to open input script: " + file_path);
+	}
+
+	nlohmann::json script_json;
+	ifs >> script_json;
+
+	_events.clear();
+	SetLoopSeconds(script_json.value("loop_seconds", 0.f));
+
+	for (const nlohmann::json& event_json : script_json.at("events"))
+	{
+		const nlohmann::json& key_json = event_json.at("key");
+		const uint8_t dx_key_code = key_json.is_number_integer()
+			? static_cast<uint8_t>(key_json.get<int>())
+			: KeyNameToKeyCode(key_json.get<std::string>());
+
+		AddKeyEvent(event_json.at("time").get<float>(), dx_key_code, event_json.value("down", true));
+	}
+
+	Rewind();
+}
+
+void ScriptedInputSource::AddKeyEvent(const float time, const uint8_t dx_key_code, const bool is_down)
+{
+	// 同じ時刻のイベントは追加した順に反映する
+	auto it = std::upper_bound(_events.begin(), _events.end(), time,
+		[](const float t, const KeyEvent& key_event) { return t < key_event.time; });
+	_events.insert(it, KeyEvent{ time, dx_key_code, is_down });
+}
+
+void ScriptedInputSource::Advance(const float delta_seconds)
+{
+	_script_time += std::max(delta_seconds, 0.f);
+
+	while (true)
+	{
+		while (_next_event_index < _events.size() && _events[_next_event_index].time <= _script_time)
+		{
+			const KeyEvent& key_event = _events[_next_event_index];
+			_key_buf[key_event.dx_key_code] = key_event.is_down ? 1 : 0;
+			_next_event_index++;
+		}
+
+		if (_loop_seconds <= 0.f || _script_time < _loop_seconds)
+		{
+			break;
+		}
+
+		// 周期の終わりまでのイベントを反映したので, 先頭に戻る. 押されたままのキーは次の周期に持ち越す
+		_script_time -= _loop_seconds;
+		_next_event_index = 0;
+	}
+}
+
+void ScriptedInputSource::Rewind()
+{
+	_next_event_index = 0;
+	_script_time = 0.f;
+	std::memset(_key_buf, 0, sizeof(_key_buf));
+}
+
+uint8_t ScriptedInputSource::KeyNameToKeyCode(const std::string& key_name)
+{
+	static const std::unordered_map<std::string, uint8_t> KEY_CODES =
+	{
+		{"A", KEY_INPUT_A}, {"B", KEY_INPUT_B}, {"C", KEY_INPUT_C}, {"D", KEY_INPUT_D},
+		{"E", KEY_INPUT_E}, {"F", KEY_INPUT_F}, {"G", KEY_INPUT_G}, {"H", KEY_INPUT_H},
+		{"I", KEY_INPUT_I}, {"J", KEY_INPUT_J}, {"K", KEY_INPUT_K}, {"L", KEY_INPUT_L},
+		{"M", KEY_INPUT_M}, {"N", KEY_INPUT_N}, {"O", KEY_INPUT_O}, {"P", KEY_INPUT_P},
+		{"Q", KEY_INPUT_Q}, {"R", KEY_INPUT_R}, {"S", KEY_INPUT_S}, {"T", KEY_INPUT_T},
+		{"U", KEY_INPUT_U}, {"V", KEY_INPUT_V}, {"W", KEY_INPUT_W}, {"X", KEY_INPUT_X},
+		{"Y", KEY_INPUT_Y}, {"Z", KEY_INPUT_Z},
+		{"0", KEY_INPUT_0}, {"1", KEY_INPUT_1}, {"2", KEY_INPUT_2}, {"3", KEY_INPUT_3},
+		{"4", KEY_INPUT_4}, {"5", KEY_INPUT_5}, {"6", KEY_INPUT_6}, {"7", KEY_INPUT_7},
+		{"8", KEY_INPUT_8}, {"9", KEY_INPUT_9},
+		{"SPACE", KEY_INPUT_SPACE}, {"RETURN", KEY_INPUT_RETURN}, {"ESCAPE", KEY_INPUT_ESCAPE},
+		{"TAB", KEY_INPUT_TAB}, {"BACK", KEY_INPUT_BACK},
+		{"LSHIFT", KEY_INPUT_LSHIFT}, {"RSHIFT", KEY_INPUT_RSHIFT},
+		{"LCONTROL", KEY_INPUT_LCONTROL}, {"RCONTROL", KEY_INPUT_RCONTROL},
+		{"LEFT", KEY_INPUT_LEFT}, {"RIGHT", KEY_INPUT_RIGHT}, {"UP", KEY_INPUT_UP}, {"DOWN", KEY_INPUT_DOWN},
+	};
+
+	auto it = KEY_CODES.find(key_name);
+	if (it == KEY_CODES.end())
+	{
+		throw std::runtime_error("Unknown key name in input script: " + key_name);
+	}
+	return it->second;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Input/DeviceInputSource.h"
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 時刻とキーの押下/解放を並べたスクリプトから入力を供給するDeviceInputSource
+/// <para>ヘッドレス実行でプレイヤーを操作するために使う. 時刻はAdvance()で渡した経過時間の累計で, 実時間とは無関係</para>
+/// <para>スクリプトのJSON形式: { "loop_seconds": 4.0, "events": [ { "time": 0.5, "key": "D", "down": true }, ... ] }</para>
+/// <para>keyはキー名("A", "SPACE", "LEFT"など)かKEY_INPUT_Xの値. loop_secondsが正の場合, その周期でスクリプトを繰り返す</para>
+/// </summary>
+class ScriptedInputSource : public DeviceInputSource
+{
+public:
+	ScriptedInputSource();
+	virtual ~ScriptedInputSource();
+
+	//~ Begin DeviceInputSource interface
+public:
+	virtual void Poll(DeviceInputSnapshot& out_snapshot) override;
+	//~ End DeviceInputSource interface
+
+public:
+	/// <summary>
+	/// JSONファイルからスクリプトを読み込む. 読み込めない場合は例外を投げる
+	/// </summary>
+	void LoadFromFile(const std::string& file_path);
+
+	/// <summary>
+	/// キーの押下/解放を追加する
+	/// </summary>
+	/// <param name="time">スクリプト開始からの時刻</param>
+	/// <param name="dx_key_code">KEY_INPUT_X</param>
+	/// <param name="is_down">trueなら押下, falseなら解放</param>
+	void AddKeyEvent(const float time, const uint8_t dx_key_code, const bool is_down);
+
+	/// <summary>
+	/// 0以下の場合は繰り返さない
+	/// </summary>
+	void SetLoopSeconds(const float loop_seconds) { _loop_seconds = loop_seconds; }
+
+	/// <summary>
+	/// スクリプトの時刻を進め, その時刻までのイベントを反映する. DeviceInput::Tick()の前に呼ぶ
+	/// </summary>
+	void Advance(const float delta_seconds);
+
+	/// <summary>
+	/// スクリプトの時刻を0に戻し, 全てのキーを離す
+	/// </summary>
+	void Rewind();
+
+	/// <summary>
+	/// キー名をKEY_INPUT_Xに変換する. 不明なキー名の場合は例外を投げる
+	/// </summary>
+	static uint8_t KeyNameToKeyCode(const std::string& key_name);
+
+private:
+	struct KeyEvent
+	{
+		float time;
+		uint8_t dx_key_code;
+		bool is_down;
+	};
+
+	// 時刻順に並べたイベント
+	std::vector<KeyEvent> _events;
+	size_t _next_event_index;
+
+	float _script_time;
+	float _loop_seconds;
+
+	char _key_buf[DeviceInputSnapshot::KEY_BUFFER_SIZE];
+};
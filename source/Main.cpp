@@ -1,6 +1,8 @@
 #include <imgui.h>
 #include <imgui_impl_win32.h>
 #include <imgui_impl_dx11.h>
+#include <fstream>
+#include <sstream>
 
 #include "SystemTypes.h"
 #include "Scene/SceneManager.h"
@@ -10,6 +12,10 @@
 #include "GameSystems/FontManager.h"
 #include "GameSystems/GameConfig/GameConfig.h"
 #include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/Headless/HeadlessRunner.h"
+#include "GameSystems/Headless/CollisionRegression.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
 
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -44,7 +50,161 @@ LRESULT __stdcall WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 	return 0;
 }
 
+/// <summary>
+/// コマンドライン引数から"[name] [値]"の値を探す. 見つからない場合は空文字列
+/// </summary>
+std::string FindCommandLineValue(const std::string& command_line, const std::string& name)
+{
+	std::istringstream iss(command_line);
+	std::string arg;
+	while (iss >> arg)
+	{
+		if (arg == name && iss >> arg)
+		{
+			return arg;
+		}
+	}
+	return std::string();
+}
+
+/// <summary>
+/// ヘッドレス実行用に, ウィンドウを表示せず描画とサウンドを無効にしてＤＸライブラリを初期化する
+/// </summary>
+/// <returns>初期化に成功したか</returns>
+bool InitializeHeadlessDxLib()
+{
+	HeadlessPlatform::Enable();
+
+	DxLib::SetOutApplicationLogValidFlag(FALSE);
+	DxLib::SetAlwaysRunFlag(true);
+	DxLib::ChangeWindowMode(true);
+	DxLib::SetWindowVisibleFlag(FALSE);
+	DxLib::SetNotDrawFlag(TRUE);
+	DxLib::SetNotSoundFlag(TRUE);
+	DxLib::SetUseCharCodeFormat(DX_CHARCODEFORMAT_UTF8);
+
+	return DxLib_Init() != -1;
+}
+
+/// <summary>
+/// ウィンドウを表示せず, 描画とサウンドを無効にしてステージを最大速度で進める
+/// <para>Windows版で画面を出さずに動かすためのモード. Windows以外ではtests/のプラットフォーム層の上で同じHeadlessRunnerを使う(HeadlessPlatformを参照)</para>
+/// </summary>
+int RunHeadless(const HeadlessRunParams& params, const std::string& report_path)
+{
+	if (!InitializeHeadlessDxLib())
+	{
+		return -1;
+	}
+
+	GameConfig::GetInstance().Init();
+
+	// パーティクルは描画しないが, 通常の実行と同じく生成と更新は行う
+	if (!ParticleManager::GetInstance().Init(EParticleBackend::CPU))
+	{
+		return -1;
+	}
+
+	// シーンのTick()で使われるImGuiは, バックエンド無しでフレームの開始/終了だけ行う
+	ImGui::CreateContext();
+	ImGui::GetIO().IniFilename = nullptr;
+	ImGui::GetIO().LogFilename = nullptr;
+	FontManager::GetInstance().AddFontsFromMasterData();
+	ImGui::GetIO().Fonts->Build();
+
+	int exit_code = 0;
+	try
+	{
+		const HeadlessRunReport report = HeadlessRunner::Run(params);
+		HeadlessRunner::WriteReport(report, report_path);
+	}
+	catch (const std::exception& e)
+	{
+		std::ofstream ofs(report_path.empty() ? "headless_error.txt" : report_path + ".error.txt");
+		ofs << e.what() << std::endl;
+		exit_code = 1;
+	}
+
+	ImGui::DestroyContext();
+	GraphicResourceManager::GetInstance().Destroy();
+	ParticleManager::GetInstance().End();
+
+	// NOTE: 通常の実行と同じく, デバッグビルドではDxLib_End()を呼び出さない
+#ifndef _DEBUG
+	DxLib_End();
+#endif
 
+	return exit_code;
+}
+
+/// <summary>
+/// ウィンドウを表示せずに衝突処理の回帰テストを実行し, ゴールデンファイルを書き出すか比較する
+/// <para>結果はreport_path(空の場合はcollision_regression_result.txt)に書き出す</para>
+/// </summary>
+/// <returns>一致した(書き出しの場合は成功した)ら0, 一致しなかったら1, 実行できなかったら-1</returns>
+int RunCollisionRegression(const CollisionRegressionParams& params, const std::string& golden_file_path, const bool should_write_golden, const std::string& report_path)
+{
+	if (!InitializeHeadlessDxLib())
+	{
+		return -1;
+	}
+
+	std::ofstream ofs(report_path.empty() ? "collision_regression_result.txt" : report_path);
+	int exit_code = 0;
+	try
+	{
+		// コライダーを持つアクターの所属先. シーンには追加しないので, Tick()は呼ばない
+		TestSceneImplBase owner_scene;
+		SceneBaseInitialParams scene_params = {};
+		owner_scene.Initialize(&scene_params);
+		{
+			CollisionRegression regression(&owner_scene);
+			const CollisionRegressionReport report = regression.Run(params);
+			ofs << CollisionRegression::FormatReport(report) << std::endl;
+
+			std::vector<std::string> mismatches;
+			if (!regression.IsStageLoaded())
+			{
+				ofs << "FAILED: failed to load " << params.stage_file_path << std::endl;
+				exit_code = -1;
+			}
+			else if (should_write_golden)
+			{
+				const bool is_written = CollisionRegression::WriteGoldenFile(golden_file_path, report);
+				ofs << (is_written ? "written " : "FAILED: failed to write ") << golden_file_path << std::endl;
+				exit_code = is_written ? 0 : -1;
+			}
+			else if (CollisionRegression::CompareWithGoldenFile(golden_file_path, report, mismatches))
+			{
+				ofs << "PASSED" << std::endl;
+			}
+			else
+			{
+				ofs << "FAILED" << std::endl;
+				for (const std::string& mismatch : mismatches)
+				{
+					ofs << "  " << mismatch << std::endl;
+				}
+				exit_code = 1;
+			}
+		}
+		owner_scene.Finalize();
+	}
+	catch (const std::exception& e)
+	{
+		ofs << "FAILED: " << e.what() << std::endl;
+		exit_code = -1;
+	}
+
+	GraphicResourceManager::GetInstance().Destroy();
+
+	// NOTE: 通常の実行と同じく, デバッグビルドではDxLib_End()を呼び出さない
+#ifndef _DEBUG
+	DxLib_End();
+#endif
+
+	return exit_code;
+}
 
 // プログラムは WinMain から始まります
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
@@ -52,6 +212,28 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	//マスターデータのロード
 	LoadAllMasterData();
 
+	// --headlessが指定された場合は, ウィンドウを表示せずにステージを進めて終了する
+	{
+		HeadlessRunParams headless_params;
+		std::string headless_report_path;
+		if (HeadlessRunner::ParseCommandLine(lpCmdLine, headless_params, headless_report_path))
+		{
+			return RunHeadless(headless_params, headless_report_path);
+		}
+	}
+
+	// --collision-regressionが指定された場合は, 衝突処理の回帰テストを実行して終了する. 結果が一致しなければ0以外を返す
+	{
+		CollisionRegressionParams regression_params;
+		std::string golden_file_path;
+		bool should_write_golden = false;
+		std::string regression_report_path;
+		if (CollisionRegression::ParseCommandLine(lpCmdLine, regression_params, golden_file_path, should_write_golden, regression_report_path))
+		{
+			return RunCollisionRegression(regression_params, golden_file_path, should_write_golden, regression_report_path);
+		}
+	}
+
 	// ＤＸライブラリ初期化処理
 	{
 #ifndef _DEBUG
@@ -76,8 +258,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	// コンフィグのロード
 	GameConfig::GetInstance().Init();
 
-	// パーティクルシステム初期化
-	if (!ParticleManager::GetInstance().Init())
+	// パーティクルシステム初期化. --particle-backend cpuが指定された場合はCPUで更新する
+	const EParticleBackend particle_backend = FindCommandLineValue(lpCmdLine, "--particle-backend") == "cpu" ? EParticleBackend::CPU : EParticleBackend::GPU;
+	if (!ParticleManager::GetInstance().Init(particle_backend))
 	{
 		return -1;
 	}
@@ -112,6 +295,10 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
 	// SceneManagerの生成
 	SceneManager* scene_manager = new SceneManager();
+
+	// --record-input [ディレクトリ]が指定された場合は, InGameSceneのプレイを記録する
+	scene_manager->GetInputRecorder().SetOutputDirectory(FindCommandLineValue(lpCmdLine, "--record-input"));
+
 	scene_manager->Initialize();
 
 	// ゲームループの周期
@@ -0,0 +1,13 @@
+#include <DirectXTex.h>
+#include <d3dcompiler.h>
+
+namespace DirectX
+{
+	HRESULT LoadFromDDSFile(const wchar_t*, DDS_FLAGS, TexMetadata*, ScratchImage&) { return E_FAIL; }
+	HRESULT LoadFromWICFile(const wchar_t*, WIC_FLAGS, TexMetadata*, ScratchImage&) { return E_FAIL; }
+	HRESULT CreateTexture(ID3D11Device*, const Image*, size_t, const TexMetadata&, ID3D11Resource**) { return E_FAIL; }
+	HRESULT CreateShaderResourceView(ID3D11Device*, const Image*, size_t, const TexMetadata&, ID3D11ShaderResourceView**) { return E_FAIL; }
+}
+
+HRESULT D3DReadFileToBlob(LPCWSTR, ID3DBlob**) { return E_FAIL; }
+HRESULT D3DCompileFromFile(LPCWSTR, const D3D_SHADER_MACRO*, ID3DInclude*, LPCSTR, LPCSTR, UINT, UINT, ID3DBlob**, ID3DBlob**) { return E_FAIL; }
@@ -0,0 +1,155 @@
+#include <DxLib.h>
+#include "SystemTypes.h"
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	// 描画しないので, 描画先とブレンドモードは設定された値を覚えておくだけ
+	int draw_screen = 0;
+	int draw_blend_mode = DX_BLENDMODE_NOBLEND;
+	int draw_blend_param = 0;
+	RECT draw_area = { 0, 0, 0, 0 };
+	int font_size = DEFAULT_FONT_SIZE;
+
+	const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+}
+
+namespace DxLib
+{
+	int SetDrawScreen(int DrawScreen) { draw_screen = DrawScreen; return 0; }
+	int GetDrawScreen() { return draw_screen; }
+	int ClearDrawScreen(const RECT*) { return 0; }
+	int MakeScreen(int, int, int) { return -1; }
+	int SaveDrawScreen(int, int, int, int, const TCHAR*, int, int, int, int) { return -1; }
+
+	int SetDrawBlendMode(int BlendMode, int BlendParam)
+	{
+		draw_blend_mode = BlendMode;
+		draw_blend_param = BlendParam;
+		return 0;
+	}
+
+	int GetDrawBlendMode(int* BlendMode, int* BlendParam)
+	{
+		*BlendMode = draw_blend_mode;
+		*BlendParam = draw_blend_param;
+		return 0;
+	}
+
+	int SetDrawArea(int x1, int y1, int x2, int y2)
+	{
+		draw_area = { x1, y1, x2, y2 };
+		return 0;
+	}
+
+	int GetDrawArea(RECT* Rect)
+	{
+		*Rect = draw_area;
+		return 0;
+	}
+
+	int RefreshDxLibDirect3DSetting() { return 0; }
+	const void* GetUseDirect3D11Device() { return nullptr; }
+	const void* GetUseDirect3D11DeviceContext() { return nullptr; }
+
+	int GetWindowSize(int* Width, int* Height)
+	{
+		*Width = WINDOW_SIZE_X;
+		*Height = WINDOW_SIZE_Y;
+		return 0;
+	}
+
+	unsigned int GetColor(int Red, int Green, int Blue)
+	{
+		return 0xFF000000u | (static_cast<unsigned int>(Red & 0xFF) << 16) | (static_cast<unsigned int>(Green & 0xFF) << 8) | static_cast<unsigned int>(Blue & 0xFF);
+	}
+
+	int GetNowCount(int)
+	{
+		return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count());
+	}
+
+	int DrawLine(int, int, int, int, unsigned int, int) { return 0; }
+	int DrawBox(int, int, int, int, unsigned int, int) { return 0; }
+	int DrawBoxAA(float, float, float, float, unsigned int, int, float) { return 0; }
+	int DrawTriangle(int, int, int, int, int, int, unsigned int, int) { return 0; }
+	int DrawCircleAA(float, float, float, int, unsigned int, int, float) { return 0; }
+
+	int LoadGraph(const TCHAR*, int) { return -1; }
+
+	int LoadDivGraph(const TCHAR*, int AllNum, int, int, int, int, int* HandleArray, int)
+	{
+		for (int i = 0; i < AllNum; i++)
+		{
+			HandleArray[i] = -1;
+		}
+		return -1;
+	}
+
+	int DerivationGraph(int, int, int, int, int) { return -1; }
+	int DeleteGraph(int, int) { return 0; }
+
+	int GetGraphSize(int, int* SizeXBuf, int* SizeYBuf)
+	{
+		*SizeXBuf = 0;
+		*SizeYBuf = 0;
+		return -1;
+	}
+
+	int DrawExtendGraph(int, int, int, int, int, int) { return 0; }
+	int DrawRotaGraph(int, int, double, double, int, int, int, int) { return 0; }
+	int DrawRotaGraphF(float, float, double, double, int, int, int, int) { return 0; }
+	int DrawRotaGraph3(int, int, int, int, double, double, double, int, int, int, int) { return 0; }
+
+	int CreateFontToHandle(const TCHAR*, int, int, int, int, int, int, int) { return -1; }
+	int GetFontSize() { return font_size; }
+	int SetFontSize(int FontSize) { font_size = FontSize; return 0; }
+	int DrawString(int, int, const TCHAR*, unsigned int, unsigned int) { return 0; }
+	int DrawStringToHandle(int, int, const TCHAR*, unsigned int, int, unsigned int, int) { return 0; }
+	int DrawFormatString(int, int, unsigned int, const TCHAR*, ...) { return 0; }
+	int DrawFormatStringToHandle(int, int, unsigned int, int, const TCHAR*, ...) { return 0; }
+	int GetDrawStringWidth(const TCHAR*, int, int) { return 0; }
+	int GetDrawStringWidthToHandle(const TCHAR*, int, int, int) { return 0; }
+	int DrawKeyInputString(int, int, int, int) { return 0; }
+
+	int GetKeyInputString(TCHAR* StrBuffer, int)
+	{
+		StrBuffer[0] = '\0';
+		return 0;
+	}
+
+	int strlenDx(const TCHAR* Str) { return static_cast<int>(std::strlen(Str)); }
+
+	int InitSoundMem(int) { return 0; }
+	int LoadSoundMem(const TCHAR*, int, int) { return -1; }
+	int DuplicateSoundMem(int, int) { return -1; }
+	int DeleteSoundMem(int, int) { return 0; }
+	int PlaySoundMem(int, int, int) { return -1; }
+	int StopSoundMem(int) { return 0; }
+	int CheckSoundMem(int) { return -1; }
+	int SetPlayFinishDeleteSoundMem(int, int) { return 0; }
+	int ChangeVolumeSoundMem(int, int) { return 0; }
+	int GetVolumeSoundMem2(int) { return 0; }
+	int SetFrequencySoundMem(int, int) { return 0; }
+	int ResetFrequencySoundMem(int) { return 0; }
+	int GetFrequencySoundMem(int) { return -1; }
+	LONGLONG GetSoundTotalSample(int) { return -1; }
+
+	int GetHitKeyStateAll(char* KeyStateArray)
+	{
+		std::memset(KeyStateArray, 0, 256);
+		return 0;
+	}
+
+	int GetMouseInput() { return 0; }
+
+	int GetMousePoint(int* XBuf, int* YBuf)
+	{
+		*XBuf = 0;
+		*YBuf = 0;
+		return 0;
+	}
+
+	int GetMouseWheelRotVol(int) { return 0; }
+}
@@ -0,0 +1,153 @@
+#include <imgui.h>
+
+struct ImGuiContext
+{
+	ImGuiIO io;
+	ImFontAtlas fonts;
+	ImFont default_font;
+	ImGuiStyle style;
+	ImDrawList draw_list;
+};
+
+namespace
+{
+	ImGuiContext* current_context = nullptr;
+
+	// GetGlyphRangesJapanese()の戻り値. 範囲の終わりを示す0だけを持つ
+	const ImWchar EMPTY_GLYPH_RANGES[] = { 0 };
+}
+
+void ImDrawList::AddLine(const ImVec2&, const ImVec2&, ImU32, float) {}
+void ImDrawList::AddRectFilled(const ImVec2&, const ImVec2&, ImU32, float, int) {}
+void ImDrawList::AddImage(ImTextureID, const ImVec2&, const ImVec2&, const ImVec2&, const ImVec2&, ImU32) {}
+
+ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig*)
+{
+	return &ImGui::GetCurrentContext()->default_font;
+}
+
+ImFont* ImFontAtlas::AddFontFromFileTTF(const char*, float, const ImFontConfig*, const ImWchar*)
+{
+	return &ImGui::GetCurrentContext()->default_font;
+}
+
+const ImWchar* ImFontAtlas::GetGlyphRangesJapanese()
+{
+	return EMPTY_GLYPH_RANGES;
+}
+
+namespace ImGui
+{
+	ImGuiContext* CreateContext()
+	{
+		ImGuiContext* context = new ImGuiContext();
+		context->io.Fonts = &context->fonts;
+		if (current_context == nullptr)
+		{
+			current_context = context;
+		}
+		return context;
+	}
+
+	void DestroyContext(ImGuiContext* ctx)
+	{
+		if (ctx == nullptr)
+		{
+			ctx = current_context;
+		}
+		if (ctx == current_context)
+		{
+			current_context = nullptr;
+		}
+		delete ctx;
+	}
+
+	ImGuiContext* GetCurrentContext() { return current_context; }
+	ImGuiIO& GetIO() { return current_context->io; }
+	ImGuiStyle& GetStyle() { return current_context->style; }
+	void NewFrame() {}
+	void EndFrame() {}
+
+	bool Begin(const char*, bool*, ImGuiWindowFlags) { return false; }
+	void End() {}
+	bool BeginChild(const char*, const ImVec2&, ImGuiChildFlags, ImGuiWindowFlags) { return false; }
+	bool BeginChild(ImGuiID, const ImVec2&, ImGuiChildFlags, ImGuiWindowFlags) { return false; }
+	void EndChild() {}
+	bool IsWindowHovered(ImGuiHoveredFlags) { return false; }
+	ImVec2 GetWindowPos() { return ImVec2(); }
+	ImVec2 GetContentRegionMax() { return ImVec2(); }
+	ImVec2 GetWindowContentRegionMin() { return ImVec2(); }
+	void SetNextWindowPos(const ImVec2&, ImGuiCond, const ImVec2&) {}
+	void SetNextWindowSize(const ImVec2&, ImGuiCond) {}
+	void SetNextWindowFocus() {}
+	void SetNextWindowBgAlpha(float) {}
+	ImDrawList* GetWindowDrawList() { return &current_context->draw_list; }
+
+	ImVec2 GetContentRegionAvail() { return ImVec2(); }
+	ImVec2 GetCursorScreenPos() { return ImVec2(); }
+	void SetCursorPos(const ImVec2&) {}
+	void SetCursorPosX(float) {}
+	void SetCursorPosY(float) {}
+	void SetNextItemWidth(float) {}
+	void Indent(float) {}
+	void Unindent(float) {}
+	void PushID(const char*) {}
+	void PushID(int) {}
+	void PopID() {}
+
+	void PushFont(ImFont*) {}
+	void PopFont() {}
+	void PushStyleColor(ImGuiCol, ImU32) {}
+	void PushStyleColor(ImGuiCol, const ImVec4&) {}
+	void PopStyleColor(int) {}
+	void PushStyleVar(ImGuiStyleVar, float) {}
+	void PushStyleVar(ImGuiStyleVar, const ImVec2&) {}
+	void PopStyleVar(int) {}
+	void PushAllowKeyboardFocus(bool) {}
+	void PopAllowKeyboardFocus() {}
+
+	ImVec4 ColorConvertU32ToFloat4(ImU32 in)
+	{
+		constexpr float s = 1.0f / 255.0f;
+		return ImVec4((in & 0xFF) * s, ((in >> 8) & 0xFF) * s, ((in >> 16) & 0xFF) * s, ((in >> 24) & 0xFF) * s);
+	}
+
+	const ImVec4& GetStyleColorVec4(ImGuiCol idx) { return current_context->style.Colors[idx]; }
+
+	ImU32 GetColorU32(const ImVec4& col)
+	{
+		const auto to_byte = [](const float v) { return static_cast<ImU32>((v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v) * 255.0f + 0.5f); };
+		return IM_COL32(to_byte(col.x), to_byte(col.y), to_byte(col.z), to_byte(col.w));
+	}
+
+	float GetFontSize() { return current_context->default_font.FontSize; }
+	ImVec2 CalcTextSize(const char*, const char*, bool, float) { return ImVec2(); }
+
+	void SameLine(float, float) {}
+	void Text(const char*, ...) {}
+	bool Button(const char*, const ImVec2&) { return false; }
+	void Image(ImTextureID, const ImVec2&, const ImVec2&, const ImVec2&, const ImVec4&, const ImVec4&) {}
+	bool ImageButton(const char*, ImTextureID, const ImVec2&, const ImVec2&, const ImVec2&, const ImVec4&, const ImVec4&) { return false; }
+	bool Checkbox(const char*, bool*) { return false; }
+	bool InputText(const char*, char*, size_t, ImGuiInputTextFlags, void*, void*) { return false; }
+	bool InputInt(const char*, int*, int, int, ImGuiInputTextFlags) { return false; }
+	bool InputFloat(const char*, float*, float, float, const char*, ImGuiInputTextFlags) { return false; }
+	bool InputScalarN(const char*, ImGuiDataType, void*, int, const void*, const void*, const char*, ImGuiInputTextFlags) { return false; }
+	bool ColorEdit3(const char*, float[3], ImGuiColorEditFlags) { return false; }
+	bool ColorEdit4(const char*, float[4], ImGuiColorEditFlags) { return false; }
+	bool TreeNode(const char*) { return false; }
+	void TreePop() {}
+	bool BeginItemTooltip() { return false; }
+	void EndTooltip() {}
+
+	bool IsItemHovered(ImGuiHoveredFlags) { return false; }
+	bool IsItemDeactivatedAfterEdit() { return false; }
+	bool IsAnyItemActive() { return false; }
+	bool IsMouseDoubleClicked(ImGuiMouseButton) { return false; }
+
+	void OpenPopup(const char*, ImGuiPopupFlags) {}
+	bool BeginPopupModal(const char*, bool*, ImGuiWindowFlags) { return false; }
+	void EndPopup() {}
+	void CloseCurrentPopup() {}
+	bool IsPopupOpen(const char*, ImGuiPopupFlags) { return false; }
+}
@@ -0,0 +1,59 @@
+// ヘッドレスのプラットフォーム層: GPUパーティクルのバックエンド(ParticleManagerImpl.cpp, SpriteAtlas.cpp)の代わり
+// Direct3D 11のデバイスが無いので, Init()はfalseを返す. ヘッドレス実行ではEParticleBackend::CPUを使い, これらは生成されない
+#include "GameSystems/ParticleManager/ParticleManagerImpl.h"
+
+SpriteAtlas::SpriteAtlas()
+	: _layout(PARTICLE_ATLAS_PAGE_SIZE, PARTICLE_ATLAS_PAGE_SIZE, MAX_PARTICLE_ATLAS_PAGES, MAX_TEXTURES_NUM, PARTICLE_ATLAS_PADDING)
+	, _num_allocated_pages(0)
+	, _num_decodes(0)
+	, _num_page_grows(0)
+	, _load_ms(0.0)
+{
+}
+
+SpriteAtlas::~SpriteAtlas()
+{
+}
+
+ParticleManagerImpl::ParticleManagerImpl()
+{
+}
+
+ParticleManagerImpl::~ParticleManagerImpl()
+{
+}
+
+bool ParticleManagerImpl::Init()
+{
+	return false;
+}
+
+void ParticleManagerImpl::End() {}
+
+bool ParticleManagerImpl::SpawnParticles(const Particle*, const UINT)
+{
+	return false;
+}
+
+void ParticleManagerImpl::DeactivateAllParticles() {}
+void ParticleManagerImpl::Tick(const float) {}
+void ParticleManagerImpl::Draw(const CameraParams&, const ParticleDrawLists*) {}
+
+UINT ParticleManagerImpl::GetPoolCount() const
+{
+	return 0;
+}
+
+int ParticleManagerImpl::LoadSpriteTexture(const MasterDataID)
+{
+	return 0;
+}
+
+void ParticleManagerImpl::PreloadSpriteTextures(const std::vector<MasterDataID>&) {}
+
+SpriteAtlasStats ParticleManagerImpl::GetSpriteAtlasStats() const
+{
+	return SpriteAtlasStats{};
+}
+
+void ParticleManagerImpl::UploadParticles(const CpuParticleSimulator&, const ParticleDrawLists&) {}
@@ -0,0 +1,111 @@
+#include <windows.h>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <string>
+
+namespace
+{
+	// UTF-8の1文字を読み, コードポイントを返す. 不正なバイト列はU+FFFDにする
+	char32_t DecodeUtf8(const unsigned char* str, const int length, int& index)
+	{
+		const unsigned char lead = str[index++];
+		int num_trail = 0;
+		char32_t code_point = 0;
+		if (lead < 0x80) { return lead; }
+		else if ((lead & 0xE0) == 0xC0) { num_trail = 1; code_point = lead & 0x1F; }
+		else if ((lead & 0xF0) == 0xE0) { num_trail = 2; code_point = lead & 0x0F; }
+		else if ((lead & 0xF8) == 0xF0) { num_trail = 3; code_point = lead & 0x07; }
+		else { return 0xFFFD; }
+
+		for (int i = 0; i < num_trail; i++)
+		{
+			if (index >= length || (str[index] & 0xC0) != 0x80)
+			{
+				return 0xFFFD;
+			}
+			code_point = (code_point << 6) | (str[index++] & 0x3F);
+		}
+		return code_point;
+	}
+
+	void EncodeUtf8(const char32_t code_point, std::string& out_str)
+	{
+		if (code_point < 0x80)
+		{
+			out_str.push_back(static_cast<char>(code_point));
+		}
+		else if (code_point < 0x800)
+		{
+			out_str.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+			out_str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+		}
+		else if (code_point < 0x10000)
+		{
+			out_str.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+			out_str.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+			out_str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+		}
+		else
+		{
+			out_str.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+			out_str.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+			out_str.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+			out_str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+		}
+	}
+}
+
+// NOTE: Windowsと同じく, 長さに-1を渡すと終端の0まで変換し, 結果の長さにも終端を含める. 出力先の長さが0なら必要な長さだけを返す
+int MultiByteToWideChar(UINT, DWORD, LPCSTR multi_byte_str, int multi_byte_length, LPWSTR wide_char_str, int wide_char_length)
+{
+	const int length = multi_byte_length < 0 ? static_cast<int>(std::strlen(multi_byte_str)) + 1 : multi_byte_length;
+	const unsigned char* str = reinterpret_cast<const unsigned char*>(multi_byte_str);
+
+	int num_written = 0;
+	int index = 0;
+	while (index < length)
+	{
+		const char32_t code_point = DecodeUtf8(str, length, index);
+		if (wide_char_length > 0)
+		{
+			if (num_written >= wide_char_length)
+			{
+				return 0;
+			}
+			wide_char_str[num_written] = static_cast<wchar_t>(code_point);
+		}
+		num_written++;
+	}
+	return num_written;
+}
+
+int WideCharToMultiByte(UINT, DWORD, LPCWSTR wide_char_str, int wide_char_length, LPSTR multi_byte_str, int multi_byte_length, LPCSTR, BOOL* used_default_char)
+{
+	const int length = wide_char_length < 0 ? static_cast<int>(std::wcslen(wide_char_str)) + 1 : wide_char_length;
+
+	std::string utf8;
+	for (int i = 0; i < length; i++)
+	{
+		EncodeUtf8(static_cast<char32_t>(wide_char_str[i]), utf8);
+	}
+
+	if (used_default_char)
+	{
+		*used_default_char = FALSE;
+	}
+	if (multi_byte_length > 0)
+	{
+		if (static_cast<int>(utf8.size()) > multi_byte_length)
+		{
+			return 0;
+		}
+		std::memcpy(multi_byte_str, utf8.data(), utf8.size());
+	}
+	return static_cast<int>(utf8.size());
+}
+
+void OutputDebugStringA(LPCSTR output_string)
+{
+	std::fputs(output_string, stderr);
+}
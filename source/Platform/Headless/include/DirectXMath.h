@@ -0,0 +1,51 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: DirectXMath.hの代わり
+// ゲームはシェーダーに渡す値の入れ物としてだけ使うので, 型のメモリレイアウトと生成だけを用意する. 演算関数は無い
+
+namespace DirectX
+{
+	struct XMFLOAT2
+	{
+		float x;
+		float y;
+
+		XMFLOAT2() = default;
+		constexpr XMFLOAT2(const float in_x, const float in_y) : x(in_x), y(in_y) {}
+	};
+
+	struct XMFLOAT3
+	{
+		float x;
+		float y;
+		float z;
+
+		XMFLOAT3() = default;
+		constexpr XMFLOAT3(const float in_x, const float in_y, const float in_z) : x(in_x), y(in_y), z(in_z) {}
+	};
+
+	struct XMFLOAT4
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+
+		XMFLOAT4() = default;
+		constexpr XMFLOAT4(const float in_x, const float in_y, const float in_z, const float in_w) : x(in_x), y(in_y), z(in_z), w(in_w) {}
+	};
+
+	struct alignas(16) XMMATRIX
+	{
+		float m[4][4];
+
+		XMMATRIX() = default;
+		constexpr XMMATRIX(
+			const float m00, const float m01, const float m02, const float m03,
+			const float m10, const float m11, const float m12, const float m13,
+			const float m20, const float m21, const float m22, const float m23,
+			const float m30, const float m31, const float m32, const float m33
+		)
+			: m{ { m00, m01, m02, m03 }, { m10, m11, m12, m13 }, { m20, m21, m22, m23 }, { m30, m31, m32, m33 } }
+		{}
+	};
+}
@@ -0,0 +1,61 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: DirectXTex.hの代わり
+// 画像ファイルの読み込みとテクスチャの作成は, どれもE_FAILを返して失敗する. ヘッドレス実行では呼ばれない
+#include "d3d11.h"
+#include <cstddef>
+
+namespace DirectX
+{
+	enum DDS_FLAGS : unsigned long
+	{
+		DDS_FLAGS_NONE = 0x0,
+	};
+
+	enum WIC_FLAGS : unsigned long
+	{
+		WIC_FLAGS_NONE = 0x0,
+	};
+
+	struct TexMetadata
+	{
+		size_t width;
+		size_t height;
+		size_t depth;
+		size_t arraySize;
+		size_t mipLevels;
+		uint32_t miscFlags;
+		uint32_t miscFlags2;
+		DXGI_FORMAT format;
+	};
+
+	struct Image
+	{
+		size_t width;
+		size_t height;
+		DXGI_FORMAT format;
+		size_t rowPitch;
+		size_t slicePitch;
+		uint8_t* pixels;
+	};
+
+	/// <summary>
+	/// 読み込んだ画像の入れ物. ヘッドレスでは常に空
+	/// </summary>
+	class ScratchImage
+	{
+	public:
+		const TexMetadata& GetMetadata() const { return _metadata; }
+		const Image* GetImages() const { return nullptr; }
+		size_t GetImageCount() const { return 0; }
+		uint8_t* GetPixels() const { return nullptr; }
+		size_t GetPixelsSize() const { return 0; }
+
+	private:
+		TexMetadata _metadata{};
+	};
+
+	HRESULT LoadFromDDSFile(const wchar_t* szFile, DDS_FLAGS flags, TexMetadata* metadata, ScratchImage& image);
+	HRESULT LoadFromWICFile(const wchar_t* szFile, WIC_FLAGS flags, TexMetadata* metadata, ScratchImage& image);
+	HRESULT CreateTexture(ID3D11Device* pDevice, const Image* srcImages, size_t nimages, const TexMetadata& metadata, ID3D11Resource** ppResource);
+	HRESULT CreateShaderResourceView(ID3D11Device* pDevice, const Image* srcImages, size_t nimages, const TexMetadata& metadata, ID3D11ShaderResourceView** ppSRV);
+}
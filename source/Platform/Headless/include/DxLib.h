@@ -0,0 +1,172 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: DxLib.hの代わり
+// ゲームのソースが使う関数と定数だけを, DxLibと同じ名前, 引数, 値で宣言する.
+// 実装(Platform/Headless/DxLib.cpp)は何も描画, 再生せず, ハンドルを返す関数は無効なハンドル(-1)を返す.
+// 入力はキーもマウスも押されていない状態を返すので, テストではDeviceInput::SetInputSource()で入力を与える
+#include "windows.h"
+#include "tchar.h"
+
+#define DX_PI_F (3.1415926535897932384626433832795f)
+
+// ブレンドモード
+#define DX_BLENDMODE_NOBLEND (0)
+#define DX_BLENDMODE_ALPHA (1)
+#define DX_BLENDMODE_ADD (2)
+#define DX_BLENDMODE_SUB (3)
+#define DX_BLENDMODE_MUL (4)
+#define DX_BLENDMODE_INVSRC (10)
+#define DX_BLENDMODE_MULA (11)
+
+// サウンドの再生形式
+#define DX_PLAYTYPE_NORMAL (0)
+#define DX_PLAYTYPE_BACK (1)
+#define DX_PLAYTYPE_LOOP (3)
+
+// フォント
+#define DEFAULT_FONT_SIZE (16)
+#define DX_FONTTYPE_NORMAL (0x00)
+
+// マウスボタン
+#define MOUSE_INPUT_LEFT (0x0001)
+#define MOUSE_INPUT_RIGHT (0x0002)
+#define MOUSE_INPUT_MIDDLE (0x0004)
+#define MOUSE_INPUT_4 (0x0008)
+#define MOUSE_INPUT_5 (0x0010)
+#define MOUSE_INPUT_6 (0x0020)
+#define MOUSE_INPUT_7 (0x0040)
+#define MOUSE_INPUT_8 (0x0080)
+
+// キー. GetHitKeyStateAll()の配列の添え字(DirectInputのスキャンコード)
+#define KEY_INPUT_ESCAPE (0x01)
+#define KEY_INPUT_1 (0x02)
+#define KEY_INPUT_2 (0x03)
+#define KEY_INPUT_3 (0x04)
+#define KEY_INPUT_4 (0x05)
+#define KEY_INPUT_5 (0x06)
+#define KEY_INPUT_6 (0x07)
+#define KEY_INPUT_7 (0x08)
+#define KEY_INPUT_8 (0x09)
+#define KEY_INPUT_9 (0x0A)
+#define KEY_INPUT_0 (0x0B)
+#define KEY_INPUT_BACK (0x0E)
+#define KEY_INPUT_TAB (0x0F)
+#define KEY_INPUT_Q (0x10)
+#define KEY_INPUT_W (0x11)
+#define KEY_INPUT_E (0x12)
+#define KEY_INPUT_R (0x13)
+#define KEY_INPUT_T (0x14)
+#define KEY_INPUT_Y (0x15)
+#define KEY_INPUT_U (0x16)
+#define KEY_INPUT_I (0x17)
+#define KEY_INPUT_O (0x18)
+#define KEY_INPUT_P (0x19)
+#define KEY_INPUT_RETURN (0x1C)
+#define KEY_INPUT_LCONTROL (0x1D)
+#define KEY_INPUT_A (0x1E)
+#define KEY_INPUT_S (0x1F)
+#define KEY_INPUT_D (0x20)
+#define KEY_INPUT_F (0x21)
+#define KEY_INPUT_G (0x22)
+#define KEY_INPUT_H (0x23)
+#define KEY_INPUT_J (0x24)
+#define KEY_INPUT_K (0x25)
+#define KEY_INPUT_L (0x26)
+#define KEY_INPUT_LSHIFT (0x2A)
+#define KEY_INPUT_Z (0x2C)
+#define KEY_INPUT_X (0x2D)
+#define KEY_INPUT_C (0x2E)
+#define KEY_INPUT_V (0x2F)
+#define KEY_INPUT_B (0x30)
+#define KEY_INPUT_N (0x31)
+#define KEY_INPUT_M (0x32)
+#define KEY_INPUT_RSHIFT (0x36)
+#define KEY_INPUT_SPACE (0x39)
+#define KEY_INPUT_RCONTROL (0x9D)
+#define KEY_INPUT_UP (0xC8)
+#define KEY_INPUT_LEFT (0xCB)
+#define KEY_INPUT_RIGHT (0xCD)
+#define KEY_INPUT_DOWN (0xD0)
+
+struct RECT
+{
+	LONG left;
+	LONG top;
+	LONG right;
+	LONG bottom;
+};
+
+namespace DxLib
+{
+	// 描画先と描画設定
+	int SetDrawScreen(int DrawScreen);
+	int GetDrawScreen();
+	int ClearDrawScreen(const RECT* ClearRect = nullptr);
+	int MakeScreen(int SizeX, int SizeY, int UseAlphaChannel = FALSE);
+	int SaveDrawScreen(int x1, int y1, int x2, int y2, const TCHAR* FileName, int SaveType = 0, int Jpeg_Quality = 80, int Jpeg_Sample2x1 = TRUE, int Png_CompressionLevel = -1);
+	int SetDrawBlendMode(int BlendMode, int BlendParam);
+	int GetDrawBlendMode(int* BlendMode, int* BlendParam);
+	int SetDrawArea(int x1, int y1, int x2, int y2);
+	int GetDrawArea(RECT* Rect);
+	int RefreshDxLibDirect3DSetting();
+	const void* GetUseDirect3D11Device();
+	const void* GetUseDirect3D11DeviceContext();
+	int GetWindowSize(int* Width, int* Height);
+	unsigned int GetColor(int Red, int Green, int Blue);
+	int GetNowCount(int UseRDTSCFlag = FALSE);
+
+	// 図形
+	int DrawLine(int x1, int y1, int x2, int y2, unsigned int Color, int Thickness = 1);
+	int DrawBox(int x1, int y1, int x2, int y2, unsigned int Color, int FillFlag);
+	int DrawBoxAA(float x1, float y1, float x2, float y2, unsigned int Color, int FillFlag, float LineThickness = 1.0f);
+	int DrawTriangle(int x1, int y1, int x2, int y2, int x3, int y3, unsigned int Color, int FillFlag);
+	int DrawCircleAA(float x, float y, float r, int posnum, unsigned int Color, int FillFlag = TRUE, float LineThickness = 1.0f);
+
+	// グラフィック
+	int LoadGraph(const TCHAR* FileName, int NotUse3DFlag = FALSE);
+	int LoadDivGraph(const TCHAR* FileName, int AllNum, int XNum, int YNum, int XSize, int YSize, int* HandleArray, int NotUse3DFlag = FALSE);
+	int DerivationGraph(int SrcX, int SrcY, int Width, int Height, int SrcGraphHandle);
+	int DeleteGraph(int GrHandle, int LogOutFlag = FALSE);
+	int GetGraphSize(int GrHandle, int* SizeXBuf, int* SizeYBuf);
+	int DrawExtendGraph(int x1, int y1, int x2, int y2, int GrHandle, int TransFlag);
+	int DrawRotaGraph(int x, int y, double ExRate, double Angle, int GrHandle, int TransFlag, int ReverseXFlag = FALSE, int ReverseYFlag = FALSE);
+	int DrawRotaGraphF(float xf, float yf, double ExRate, double Angle, int GrHandle, int TransFlag, int ReverseXFlag = FALSE, int ReverseYFlag = FALSE);
+	int DrawRotaGraph3(int x, int y, int cx, int cy, double ExtRateX, double ExtRateY, double Angle, int GrHandle, int TransFlag, int ReverseXFlag = FALSE, int ReverseYFlag = FALSE);
+
+	// 文字列
+	int CreateFontToHandle(const TCHAR* FontName, int Size, int Thick, int FontType = -1, int CharSet = -1, int EdgeSize = -1, int Italic = FALSE, int Handle = -1);
+	int GetFontSize();
+	int SetFontSize(int FontSize);
+	int DrawString(int x, int y, const TCHAR* String, unsigned int Color, unsigned int EdgeColor = 0);
+	int DrawStringToHandle(int x, int y, const TCHAR* String, unsigned int Color, int FontHandle, unsigned int EdgeColor = 0, int VerticalFlag = FALSE);
+	int DrawFormatString(int x, int y, unsigned int Color, const TCHAR* FormatString, ...);
+	int DrawFormatStringToHandle(int x, int y, unsigned int Color, int FontHandle, const TCHAR* FormatString, ...);
+	int GetDrawStringWidth(const TCHAR* String, int StrLen, int VerticalFlag = FALSE);
+	int GetDrawStringWidthToHandle(const TCHAR* String, int StrLen, int FontHandle, int VerticalFlag = FALSE);
+	int DrawKeyInputString(int x, int y, int InputHandle, int DrawCandidateList = TRUE);
+	int GetKeyInputString(TCHAR* StrBuffer, int InputHandle);
+	int strlenDx(const TCHAR* Str);
+
+	// サウンド
+	int InitSoundMem(int LogOutFlag = FALSE);
+	int LoadSoundMem(const TCHAR* FileName, int BufferNum = 3, int UnionHandle = -1);
+	int DuplicateSoundMem(int SrcSoundHandle, int BufferNum = 3);
+	int DeleteSoundMem(int SoundHandle, int LogOutFlag = FALSE);
+	int PlaySoundMem(int SoundHandle, int PlayType, int TopPositionFlag = TRUE);
+	int StopSoundMem(int SoundHandle);
+	int CheckSoundMem(int SoundHandle);
+	int SetPlayFinishDeleteSoundMem(int DeleteFlag, int SoundHandle);
+	int ChangeVolumeSoundMem(int VolumePal, int SoundHandle);
+	int GetVolumeSoundMem2(int SoundHandle);
+	int SetFrequencySoundMem(int FrequencyPal, int SoundHandle);
+	int ResetFrequencySoundMem(int SoundHandle);
+	int GetFrequencySoundMem(int SoundHandle);
+	LONGLONG GetSoundTotalSample(int SoundHandle);
+
+	// 入力
+	int GetHitKeyStateAll(char* KeyStateArray);
+	int GetMouseInput();
+	int GetMousePoint(int* XBuf, int* YBuf);
+	int GetMouseWheelRotVol(int CounterReset = TRUE);
+}
+
+using namespace DxLib;
@@ -0,0 +1,3 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: 大文字で始まる名前でインクルードするソース向け
+#include "windows.h"
@@ -0,0 +1,212 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: d3d11.hの代わり
+// ゲームのソースが使うインターフェース, 構造体, 定数だけを宣言する. ヘッドレスではDxLib::GetUseDirect3D11Device()がnullptrを返すので,
+// インターフェースを実装したオブジェクトは存在せず, メソッドが呼ばれることもない
+#include "windows.h"
+
+struct IUnknown
+{
+	virtual unsigned long AddRef() = 0;
+	virtual unsigned long Release() = 0;
+
+protected:
+	~IUnknown() = default;
+};
+
+struct ID3D10Blob : public IUnknown
+{
+	virtual LPVOID GetBufferPointer() = 0;
+	virtual SIZE_T GetBufferSize() = 0;
+};
+typedef ID3D10Blob ID3DBlob;
+
+struct ID3D11DeviceChild : public IUnknown {};
+struct ID3D11Resource : public ID3D11DeviceChild {};
+struct ID3D11Buffer : public ID3D11Resource {};
+struct ID3D11Texture2D : public ID3D11Resource {};
+struct ID3D11View : public ID3D11DeviceChild {};
+struct ID3D11ShaderResourceView : public ID3D11View {};
+struct ID3D11UnorderedAccessView : public ID3D11View {};
+struct ID3D11InputLayout : public ID3D11DeviceChild {};
+struct ID3D11SamplerState : public ID3D11DeviceChild {};
+struct ID3D11BlendState : public ID3D11DeviceChild {};
+struct ID3D11VertexShader : public ID3D11DeviceChild {};
+struct ID3D11PixelShader : public ID3D11DeviceChild {};
+struct ID3D11ComputeShader : public ID3D11DeviceChild {};
+struct ID3D11ClassLinkage : public IUnknown {};
+struct ID3D11ClassInstance : public ID3D11DeviceChild {};
+
+enum DXGI_FORMAT
+{
+	DXGI_FORMAT_UNKNOWN = 0,
+	DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+	DXGI_FORMAT_R32G32_FLOAT = 16,
+	DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+	DXGI_FORMAT_R32_UINT = 42,
+};
+
+enum D3D11_USAGE
+{
+	D3D11_USAGE_DEFAULT = 0,
+	D3D11_USAGE_IMMUTABLE = 1,
+	D3D11_USAGE_DYNAMIC = 2,
+	D3D11_USAGE_STAGING = 3,
+};
+
+enum D3D11_BIND_FLAG
+{
+	D3D11_BIND_VERTEX_BUFFER = 0x1,
+	D3D11_BIND_INDEX_BUFFER = 0x2,
+	D3D11_BIND_CONSTANT_BUFFER = 0x4,
+	D3D11_BIND_SHADER_RESOURCE = 0x8,
+	D3D11_BIND_UNORDERED_ACCESS = 0x80,
+};
+
+enum D3D11_FILTER
+{
+	D3D11_FILTER_MIN_MAG_MIP_POINT = 0,
+	D3D11_FILTER_MIN_MAG_MIP_LINEAR = 0x15,
+};
+
+enum D3D11_TEXTURE_ADDRESS_MODE
+{
+	D3D11_TEXTURE_ADDRESS_WRAP = 1,
+	D3D11_TEXTURE_ADDRESS_MIRROR = 2,
+	D3D11_TEXTURE_ADDRESS_CLAMP = 3,
+};
+
+enum D3D11_COMPARISON_FUNC
+{
+	D3D11_COMPARISON_NEVER = 1,
+	D3D11_COMPARISON_ALWAYS = 8,
+};
+
+enum D3D11_BLEND
+{
+	D3D11_BLEND_ZERO = 1,
+	D3D11_BLEND_ONE = 2,
+	D3D11_BLEND_SRC_COLOR = 3,
+	D3D11_BLEND_INV_SRC_COLOR = 4,
+	D3D11_BLEND_SRC_ALPHA = 5,
+	D3D11_BLEND_INV_SRC_ALPHA = 6,
+	D3D11_BLEND_DEST_ALPHA = 7,
+	D3D11_BLEND_INV_DEST_ALPHA = 8,
+	D3D11_BLEND_DEST_COLOR = 9,
+	D3D11_BLEND_INV_DEST_COLOR = 10,
+};
+
+enum D3D11_BLEND_OP
+{
+	D3D11_BLEND_OP_ADD = 1,
+	D3D11_BLEND_OP_SUBTRACT = 2,
+	D3D11_BLEND_OP_REV_SUBTRACT = 3,
+	D3D11_BLEND_OP_MIN = 4,
+	D3D11_BLEND_OP_MAX = 5,
+};
+
+enum D3D11_COLOR_WRITE_ENABLE
+{
+	D3D11_COLOR_WRITE_ENABLE_ALL = 0xF,
+};
+
+enum D3D11_INPUT_CLASSIFICATION
+{
+	D3D11_INPUT_PER_VERTEX_DATA = 0,
+	D3D11_INPUT_PER_INSTANCE_DATA = 1,
+};
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
+
+#define D3D11_APPEND_ALIGNED_ELEMENT (0xffffffff)
+#define D3D11_FLOAT32_MAX (3.402823466e+38f)
+
+struct D3D11_BUFFER_DESC
+{
+	UINT ByteWidth;
+	D3D11_USAGE Usage;
+	UINT BindFlags;
+	UINT CPUAccessFlags;
+	UINT MiscFlags;
+	UINT StructureByteStride;
+};
+
+struct D3D11_SUBRESOURCE_DATA
+{
+	const void* pSysMem;
+	UINT SysMemPitch;
+	UINT SysMemSlicePitch;
+};
+
+struct D3D11_SAMPLER_DESC
+{
+	D3D11_FILTER Filter;
+	D3D11_TEXTURE_ADDRESS_MODE AddressU;
+	D3D11_TEXTURE_ADDRESS_MODE AddressV;
+	D3D11_TEXTURE_ADDRESS_MODE AddressW;
+	float MipLODBias;
+	UINT MaxAnisotropy;
+	D3D11_COMPARISON_FUNC ComparisonFunc;
+	float BorderColor[4];
+	float MinLOD;
+	float MaxLOD;
+};
+
+struct D3D11_RENDER_TARGET_BLEND_DESC
+{
+	BOOL BlendEnable;
+	D3D11_BLEND SrcBlend;
+	D3D11_BLEND DestBlend;
+	D3D11_BLEND_OP BlendOp;
+	D3D11_BLEND SrcBlendAlpha;
+	D3D11_BLEND DestBlendAlpha;
+	D3D11_BLEND_OP BlendOpAlpha;
+	BYTE RenderTargetWriteMask;
+};
+
+struct D3D11_BLEND_DESC
+{
+	BOOL AlphaToCoverageEnable;
+	BOOL IndependentBlendEnable;
+	D3D11_RENDER_TARGET_BLEND_DESC RenderTarget[8];
+};
+
+struct D3D11_INPUT_ELEMENT_DESC
+{
+	LPCSTR SemanticName;
+	UINT SemanticIndex;
+	DXGI_FORMAT Format;
+	UINT InputSlot;
+	UINT AlignedByteOffset;
+	D3D11_INPUT_CLASSIFICATION InputSlotClass;
+	UINT InstanceDataStepRate;
+};
+
+struct ID3D11Device : public IUnknown
+{
+	virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* pDesc, const D3D11_SUBRESOURCE_DATA* pInitialData, ID3D11Buffer** ppBuffer) = 0;
+	virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* pInputElementDescs, UINT NumElements, const void* pShaderBytecodeWithInputSignature, SIZE_T BytecodeLength, ID3D11InputLayout** ppInputLayout) = 0;
+	virtual HRESULT CreateVertexShader(const void* pShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* pClassLinkage, ID3D11VertexShader** ppVertexShader) = 0;
+	virtual HRESULT CreatePixelShader(const void* pShaderBytecode, SIZE_T BytecodeLength, ID3D11ClassLinkage* pClassLinkage, ID3D11PixelShader** ppPixelShader) = 0;
+	virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* pBlendStateDesc, ID3D11BlendState** ppBlendState) = 0;
+	virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* pSamplerDesc, ID3D11SamplerState** ppSamplerState) = 0;
+};
+
+struct ID3D11DeviceContext : public ID3D11DeviceChild
+{
+	virtual void IASetInputLayout(ID3D11InputLayout* pInputLayout) = 0;
+	virtual void IASetVertexBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ppVertexBuffers, const UINT* pStrides, const UINT* pOffsets) = 0;
+	virtual void IASetIndexBuffer(ID3D11Buffer* pIndexBuffer, DXGI_FORMAT Format, UINT Offset) = 0;
+	virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY Topology) = 0;
+	virtual void OMSetBlendState(ID3D11BlendState* pBlendState, const float BlendFactor[4], UINT SampleMask) = 0;
+	virtual void UpdateSubresource(ID3D11Resource* pDstResource, UINT DstSubresource, const void* pDstBox, const void* pSrcData, UINT SrcRowPitch, UINT SrcDepthPitch) = 0;
+	virtual void VSSetShader(ID3D11VertexShader* pVertexShader, ID3D11ClassInstance* const* ppClassInstances, UINT NumClassInstances) = 0;
+	virtual void VSSetConstantBuffers(UINT StartSlot, UINT NumBuffers, ID3D11Buffer* const* ppConstantBuffers) = 0;
+	virtual void PSSetShader(ID3D11PixelShader* pPixelShader, ID3D11ClassInstance* const* ppClassInstances, UINT NumClassInstances) = 0;
+	virtual void PSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* ppShaderResourceViews) = 0;
+	virtual void PSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* ppSamplers) = 0;
+	virtual void DrawIndexed(UINT IndexCount, UINT StartIndexLocation, int BaseVertexLocation) = 0;
+};
@@ -0,0 +1,19 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: d3dcompiler.hの代わり
+// シェーダーの読み込みとコンパイルは, どちらもE_FAILを返して失敗する. ヘッドレス実行では呼ばれない
+#include "d3d11.h"
+
+#define D3DCOMPILE_DEBUG (1 << 0)
+#define D3DCOMPILE_ENABLE_STRICTNESS (1 << 11)
+
+struct ID3DInclude;
+#define D3D_COMPILE_STANDARD_FILE_INCLUDE ((ID3DInclude*)(size_t)1)
+
+struct D3D_SHADER_MACRO
+{
+	LPCSTR Name;
+	LPCSTR Definition;
+};
+
+HRESULT D3DReadFileToBlob(LPCWSTR pFileName, ID3DBlob** ppContents);
+HRESULT D3DCompileFromFile(LPCWSTR pFileName, const D3D_SHADER_MACRO* pDefines, ID3DInclude* pInclude, LPCSTR pEntrypoint, LPCSTR pTarget, UINT Flags1, UINT Flags2, ID3DBlob** ppCode, ID3DBlob** ppErrorMsgs);
@@ -0,0 +1,248 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: Dear ImGuiのimgui.hの代わり
+// ゲームのソースが使うAPIだけを, ImGuiと同じ名前と引数で宣言する. 実装(Platform/Headless/ImGui.cpp)はウィンドウを作らず,
+// Begin系はウィンドウが閉じている扱いでfalseを, ボタンは押されていない扱いでfalseを返す
+#include <cstddef>
+
+typedef unsigned int ImU32;
+typedef unsigned int ImGuiID;
+typedef unsigned short ImWchar;
+typedef void* ImTextureID;
+typedef int ImGuiCol;
+typedef int ImGuiCond;
+typedef int ImGuiStyleVar;
+typedef int ImGuiWindowFlags;
+typedef int ImGuiChildFlags;
+typedef int ImGuiHoveredFlags;
+typedef int ImGuiPopupFlags;
+typedef int ImGuiDataType;
+typedef int ImGuiInputTextFlags;
+typedef int ImGuiColorEditFlags;
+typedef int ImGuiMouseButton;
+
+#define IM_COL32(R, G, B, A) (((ImU32)(A) << 24) | ((ImU32)(B) << 16) | ((ImU32)(G) << 8) | ((ImU32)(R) << 0))
+
+struct ImVec2
+{
+	float x, y;
+	constexpr ImVec2() : x(0.0f), y(0.0f) {}
+	constexpr ImVec2(float _x, float _y) : x(_x), y(_y) {}
+};
+
+struct ImVec4
+{
+	float x, y, z, w;
+	constexpr ImVec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+	constexpr ImVec4(float _x, float _y, float _z, float _w) : x(_x), y(_y), z(_z), w(_w) {}
+};
+
+enum ImGuiWindowFlags_
+{
+	ImGuiWindowFlags_None = 0,
+	ImGuiWindowFlags_NoTitleBar = 1 << 0,
+	ImGuiWindowFlags_NoResize = 1 << 1,
+	ImGuiWindowFlags_NoMove = 1 << 2,
+	ImGuiWindowFlags_NoScrollbar = 1 << 3,
+	ImGuiWindowFlags_NoScrollWithMouse = 1 << 4,
+	ImGuiWindowFlags_NoCollapse = 1 << 5,
+	ImGuiWindowFlags_NoSavedSettings = 1 << 8,
+	ImGuiWindowFlags_NoMouseInputs = 1 << 9,
+	ImGuiWindowFlags_NoNavInputs = 1 << 16,
+	ImGuiWindowFlags_NoNavFocus = 1 << 17,
+	ImGuiWindowFlags_NoNav = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
+};
+
+enum ImGuiCol_
+{
+	ImGuiCol_Text,
+	ImGuiCol_WindowBg = 2,
+	ImGuiCol_Border = 5,
+	ImGuiCol_FrameBg = 7,
+	ImGuiCol_Button = 21,
+	ImGuiCol_ButtonHovered,
+	ImGuiCol_ButtonActive,
+	ImGuiCol_Header,
+	ImGuiCol_HeaderHovered,
+	ImGuiCol_HeaderActive,
+	ImGuiCol_ModalWindowDimBg = 54,
+	ImGuiCol_COUNT,
+};
+
+enum ImGuiStyleVar_
+{
+	ImGuiStyleVar_Alpha,
+	ImGuiStyleVar_WindowPadding = 2,
+	ImGuiStyleVar_WindowBorderSize = 4,
+	ImGuiStyleVar_WindowMinSize,
+	ImGuiStyleVar_FramePadding = 11,
+	ImGuiStyleVar_FrameBorderSize = 13,
+	ImGuiStyleVar_ItemSpacing = 14,
+};
+
+enum ImGuiCond_
+{
+	ImGuiCond_None = 0,
+	ImGuiCond_Always = 1 << 0,
+	ImGuiCond_Once = 1 << 1,
+	ImGuiCond_FirstUseEver = 1 << 2,
+	ImGuiCond_Appearing = 1 << 3,
+};
+
+enum ImGuiHoveredFlags_
+{
+	ImGuiHoveredFlags_None = 0,
+	ImGuiHoveredFlags_ChildWindows = 1 << 0,
+	ImGuiHoveredFlags_RootWindow = 1 << 1,
+	ImGuiHoveredFlags_AnyWindow = 1 << 2,
+	ImGuiHoveredFlags_AllowWhenBlockedByActiveItem = 1 << 7,
+};
+
+enum ImGuiPopupFlags_
+{
+	ImGuiPopupFlags_None = 0,
+	ImGuiPopupFlags_AnyPopupId = 1 << 10,
+	ImGuiPopupFlags_AnyPopupLevel = 1 << 11,
+	ImGuiPopupFlags_AnyPopup = ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel,
+};
+
+enum ImGuiDataType_
+{
+	ImGuiDataType_S8,
+	ImGuiDataType_U8,
+	ImGuiDataType_S16,
+	ImGuiDataType_U16,
+	ImGuiDataType_S32,
+	ImGuiDataType_U32,
+	ImGuiDataType_S64,
+	ImGuiDataType_U64,
+	ImGuiDataType_Float,
+	ImGuiDataType_Double,
+};
+
+struct ImGuiContext;
+struct ImFontConfig;
+
+struct ImFont
+{
+	float FontSize = 13.0f;
+};
+
+struct ImFontAtlas
+{
+	ImFont* AddFontDefault(const ImFontConfig* font_cfg = nullptr);
+	ImFont* AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = nullptr, const ImWchar* glyph_ranges = nullptr);
+	const ImWchar* GetGlyphRangesJapanese();
+};
+
+struct ImGuiStyle
+{
+	float Alpha = 1.0f;
+	ImVec2 WindowPadding = ImVec2(8, 8);
+	ImVec2 FramePadding = ImVec2(4, 3);
+	ImVec2 ItemSpacing = ImVec2(8, 4);
+	float ScrollbarSize = 14.0f;
+	ImVec4 Colors[ImGuiCol_COUNT];
+};
+
+struct ImDrawList
+{
+	void AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f);
+	void AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, int flags = 0);
+	void AddImage(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min = ImVec2(0, 0), const ImVec2& uv_max = ImVec2(1, 1), ImU32 col = IM_COL32(255, 255, 255, 255));
+};
+
+struct ImGuiIO
+{
+	ImVec2 DisplaySize = ImVec2(-1.0f, -1.0f);
+	float DeltaTime = 1.0f / 60.0f;
+	ImFontAtlas* Fonts = nullptr;
+};
+
+namespace ImGui
+{
+	// コンテキスト
+	ImGuiContext* CreateContext();
+	void DestroyContext(ImGuiContext* ctx = nullptr);
+	ImGuiContext* GetCurrentContext();
+	ImGuiIO& GetIO();
+	ImGuiStyle& GetStyle();
+	void NewFrame();
+	void EndFrame();
+
+	// ウィンドウ
+	bool Begin(const char* name, bool* p_open = nullptr, ImGuiWindowFlags flags = 0);
+	void End();
+	bool BeginChild(const char* str_id, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0, ImGuiWindowFlags window_flags = 0);
+	bool BeginChild(ImGuiID id, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0, ImGuiWindowFlags window_flags = 0);
+	void EndChild();
+	bool IsWindowHovered(ImGuiHoveredFlags flags = 0);
+	ImVec2 GetWindowPos();
+	ImVec2 GetContentRegionMax();
+	ImVec2 GetWindowContentRegionMin();
+	void SetNextWindowPos(const ImVec2& pos, ImGuiCond cond = 0, const ImVec2& pivot = ImVec2(0, 0));
+	void SetNextWindowSize(const ImVec2& size, ImGuiCond cond = 0);
+	void SetNextWindowFocus();
+	void SetNextWindowBgAlpha(float alpha);
+	ImDrawList* GetWindowDrawList();
+
+	// レイアウト
+	ImVec2 GetContentRegionAvail();
+	ImVec2 GetCursorScreenPos();
+	void SetCursorPos(const ImVec2& local_pos);
+	void SetCursorPosX(float local_x);
+	void SetCursorPosY(float local_y);
+	void SetNextItemWidth(float item_width);
+	void Indent(float indent_w = 0.0f);
+	void Unindent(float indent_w = 0.0f);
+	void PushID(const char* str_id);
+	void PushID(int int_id);
+	void PopID();
+
+	// スタイル
+	void PushFont(ImFont* font);
+	void PopFont();
+	void PushStyleColor(ImGuiCol idx, ImU32 col);
+	void PushStyleColor(ImGuiCol idx, const ImVec4& col);
+	void PopStyleColor(int count = 1);
+	void PushStyleVar(ImGuiStyleVar idx, float val);
+	void PushStyleVar(ImGuiStyleVar idx, const ImVec2& val);
+	void PopStyleVar(int count = 1);
+	void PushAllowKeyboardFocus(bool tab_stop);
+	void PopAllowKeyboardFocus();
+	ImVec4 ColorConvertU32ToFloat4(ImU32 in);
+	const ImVec4& GetStyleColorVec4(ImGuiCol idx);
+	ImU32 GetColorU32(const ImVec4& col);
+	float GetFontSize();
+	ImVec2 CalcTextSize(const char* text, const char* text_end = nullptr, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
+
+	// ウィジェット
+	void SameLine(float offset_from_start_x = 0.0f, float spacing = -1.0f);
+	void Text(const char* fmt, ...);
+	bool Button(const char* label, const ImVec2& size = ImVec2(0, 0));
+	void Image(ImTextureID user_texture_id, const ImVec2& image_size, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1, 1), const ImVec4& tint_col = ImVec4(1, 1, 1, 1), const ImVec4& border_col = ImVec4(0, 0, 0, 0));
+	bool ImageButton(const char* str_id, ImTextureID user_texture_id, const ImVec2& image_size, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1, 1), const ImVec4& bg_col = ImVec4(0, 0, 0, 0), const ImVec4& tint_col = ImVec4(1, 1, 1, 1));
+	bool Checkbox(const char* label, bool* v);
+	bool InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, void* callback = nullptr, void* user_data = nullptr);
+	bool InputInt(const char* label, int* v, int step = 1, int step_fast = 100, ImGuiInputTextFlags flags = 0);
+	bool InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
+	bool InputScalarN(const char* label, ImGuiDataType data_type, void* p_data, int components, const void* p_step = nullptr, const void* p_step_fast = nullptr, const char* format = nullptr, ImGuiInputTextFlags flags = 0);
+	bool ColorEdit3(const char* label, float col[3], ImGuiColorEditFlags flags = 0);
+	bool ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flags = 0);
+	bool TreeNode(const char* label);
+	void TreePop();
+	bool BeginItemTooltip();
+	void EndTooltip();
+
+	// 状態
+	bool IsItemHovered(ImGuiHoveredFlags flags = 0);
+	bool IsItemDeactivatedAfterEdit();
+	bool IsAnyItemActive();
+	bool IsMouseDoubleClicked(ImGuiMouseButton button);
+
+	// ポップアップ
+	void OpenPopup(const char* str_id, ImGuiPopupFlags popup_flags = 0);
+	bool BeginPopupModal(const char* name, bool* p_open = nullptr, ImGuiWindowFlags flags = 0);
+	void EndPopup();
+	void CloseCurrentPopup();
+	bool IsPopupOpen(const char* str_id, ImGuiPopupFlags flags = 0);
+}
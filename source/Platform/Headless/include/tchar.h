@@ -0,0 +1,38 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: tchar.hの代わり
+// ゲームはマルチバイト文字セット(Collon2D.vcxprojのCharacterSet=MultiByte)でビルドするので, TCHARはcharになる.
+// 文字列を扱うMSVCのCRTのセキュア関数(_s)もここで用意する
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+typedef char TCHAR;
+
+#define _T(x) x
+#define _TEXT(x) x
+
+template<size_t N, typename... Args>
+int sprintf_s(char (&buffer)[N], const char* format, Args... args)
+{
+	return std::snprintf(buffer, N, format, args...);
+}
+
+template<typename... Args>
+int sprintf_s(char* buffer, const size_t buffer_size, const char* format, Args... args)
+{
+	return std::snprintf(buffer, buffer_size, format, args...);
+}
+
+template<size_t N>
+int strncpy_s(char (&dest)[N], const char* src, const size_t count)
+{
+	const size_t length = std::min(std::strlen(src), std::min(count, N - 1));
+	std::memcpy(dest, src, length);
+	dest[length] = '\0';
+	return 0;
+}
+
+#define _stprintf_s sprintf_s
+#define _tcslen strlen
+#define _tcscmp strcmp
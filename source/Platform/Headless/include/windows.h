@@ -0,0 +1,62 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: Windows SDKのwindows.hの代わり
+// ゲームのソースが使う型, マクロ, 関数だけを宣言する. tests/CMakeLists.txtのビルドでのみインクルードパスに入る
+#include <cstdint>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+
+typedef int BOOL;
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef unsigned int UINT;
+typedef uint32_t DWORD;
+typedef int32_t LONG;
+typedef int32_t HRESULT;
+typedef int64_t LONGLONG;
+typedef void* HANDLE;
+typedef void* HWND;
+typedef size_t SIZE_T;
+typedef char* LPSTR;
+typedef const char* LPCSTR;
+typedef wchar_t* LPWSTR;
+typedef const wchar_t* LPCWSTR;
+typedef const void* LPCVOID;
+typedef void* LPVOID;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define S_OK ((HRESULT)0L)
+#define S_FALSE ((HRESULT)1L)
+#define E_FAIL ((HRESULT)0x80004005L)
+#define E_NOTIMPL ((HRESULT)0x80004001L)
+#define E_INVALIDARG ((HRESULT)0x80070057L)
+#define E_OUTOFMEMORY ((HRESULT)0x8007000EL)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+#define ARRAYSIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+#define CP_ACP 0
+#define CP_UTF8 65001
+
+/// <summary>
+/// UTF-8の文字列をワイド文字列に変換する. code_pageはCP_UTF8とCP_ACPのどちらもUTF-8として扱う
+/// <para>LinuxのワイドはUTF-32なので, 1つのコードポイントを1つのwchar_tにする</para>
+/// </summary>
+int MultiByteToWideChar(UINT code_page, DWORD flags, LPCSTR multi_byte_str, int multi_byte_length, LPWSTR wide_char_str, int wide_char_length);
+
+/// <summary>
+/// ワイド文字列をUTF-8の文字列に変換する. 引数の扱いはMultiByteToWideChar()と同じ
+/// </summary>
+int WideCharToMultiByte(UINT code_page, DWORD flags, LPCWSTR wide_char_str, int wide_char_length, LPSTR multi_byte_str, int multi_byte_length, LPCSTR default_char, BOOL* used_default_char);
+
+/// <summary>
+/// 標準エラー出力に書き出す
+/// </summary>
+void OutputDebugStringA(LPCSTR output_string);
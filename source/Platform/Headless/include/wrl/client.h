@@ -0,0 +1,96 @@
+#pragma once
+// ヘッドレスのプラットフォーム層: wrl/client.hの代わり. COMオブジェクトの参照を数えるスマートポインタ
+#include <cstddef>
+
+namespace Microsoft
+{
+	namespace WRL
+	{
+		template<typename T>
+		class ComPtr
+		{
+		public:
+			ComPtr() : _ptr(nullptr) {}
+			ComPtr(std::nullptr_t) : _ptr(nullptr) {}
+			ComPtr(T* ptr) : _ptr(ptr) { InternalAddRef(); }
+			ComPtr(const ComPtr& other) : _ptr(other._ptr) { InternalAddRef(); }
+			ComPtr(ComPtr&& other) noexcept : _ptr(other._ptr) { other._ptr = nullptr; }
+			~ComPtr() { InternalRelease(); }
+
+			ComPtr& operator=(const ComPtr& other)
+			{
+				ComPtr(other).Swap(*this);
+				return *this;
+			}
+
+			ComPtr& operator=(ComPtr&& other) noexcept
+			{
+				ComPtr(static_cast<ComPtr&&>(other)).Swap(*this);
+				return *this;
+			}
+
+			ComPtr& operator=(std::nullptr_t)
+			{
+				InternalRelease();
+				return *this;
+			}
+
+			T* Get() const { return _ptr; }
+			T* operator->() const { return _ptr; }
+			explicit operator bool() const { return _ptr != nullptr; }
+
+			T** GetAddressOf() { return &_ptr; }
+			T* const* GetAddressOf() const { return &_ptr; }
+
+			T** ReleaseAndGetAddressOf()
+			{
+				InternalRelease();
+				return &_ptr;
+			}
+
+			T** operator&() { return ReleaseAndGetAddressOf(); }
+
+			void Reset() { InternalRelease(); }
+
+			unsigned long Reset(std::nullptr_t)
+			{
+				InternalRelease();
+				return 0;
+			}
+
+			void Swap(ComPtr& other)
+			{
+				T* const ptr = _ptr;
+				_ptr = other._ptr;
+				other._ptr = ptr;
+			}
+
+		private:
+			void InternalAddRef()
+			{
+				if (_ptr)
+				{
+					_ptr->AddRef();
+				}
+			}
+
+			void InternalRelease()
+			{
+				T* const ptr = _ptr;
+				if (ptr)
+				{
+					_ptr = nullptr;
+					ptr->Release();
+				}
+			}
+
+			T* _ptr;
+		};
+
+		template<typename T>
+		bool operator==(const ComPtr<T>& lhs, std::nullptr_t) { return lhs.Get() == nullptr; }
+
+		template<typename T>
+		bool operator!=(const ComPtr<T>& lhs, std::nullptr_t) { return lhs.Get() != nullptr; }
+	}
+}
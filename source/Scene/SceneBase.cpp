@@ -5,25 +5,38 @@
 #include "Actor/SceneAnimRendererActor.h"
 #include "GameSystems/ParticleManager/ParticleManager.h"
 #include "GameSystems/SystemTimer.h"
+#include "GameSystems/GameObjectManager.h"
 #include "GameSystems/CollisionManager.h"
 #include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
 #include "GameSystems/Sound/SoundManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
+#include <cassert>
 #include <fstream>
+#include <chrono>
+
+namespace
+{
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
 
 const Vector2D SceneBase::BASIC_GRAVITY_FORCE = Vector2D(0, 600);
 
 SceneBase::SceneBase()
-	: should_sort_actors(true)
-	, _game_speed_rate(1.0f)
+	: _game_speed_rate(1.0f)
 	, _world_area_left_top(0, 0)
 	, _world_area_right_bottom(FLT_MAX, WINDOW_SIZE_Y)
 	, _world_timer(0.f)
 	, _scene_anim_actor(nullptr)
 	, _should_clamp_camera_in_world_area(true)
+	, _frame_cost_stats{}
+	, _next_actor_serial(0)
 {}
 
 SceneBase::~SceneBase()
@@ -58,30 +71,35 @@ void SceneBase::Initialize(const SceneBaseInitialParams* const scene_params)
 	_debug_world_canvas = std::make_unique<Canvas>(debug_world_canvas_info);
 
 	CollisionManager::GetInstance().Initialize();
+
+	_simulation_clock.Reset();
 }
 
 SceneType SceneBase::Tick(float delta_seconds)
 {
 	if(_is_world_timer_active)
 	{
-		UpdateWorldDelayedEvents(delta_seconds);
-
-		UpdateWorldRepeatingEvents(delta_seconds);
+		const auto simulation_begin = std::chrono::high_resolution_clock::now();
 
-		// アクターの更新
-		for (auto iterator = _actors.begin(); iterator != _actors.end(); ++iterator)
+		// ワールドは固定の時間刻みで進める. ヒッチで経過時間が大きくても1ステップの移動量は変わらない
+		const int num_steps = _simulation_clock.Advance(delta_seconds);
+		for (int i = 0; i < num_steps; i++)
 		{
-			Actor*& actor = *iterator;
-			if (actor && actor->ShouldCallTickActor() && !actor->IsHidden())
-			{
-				actor->TickActor(delta_seconds);
-			}
+			// NOTE: 押された瞬間/離された瞬間は, ステップが無かったフレームの分も含めて1つずつ1ステップだけで検出される
+			DeviceInput::BeginWorldStep();
+			TickWorldStep(_simulation_clock.GetStepSeconds());
+			DeviceInput::EndWorldStep();
 		}
 
-		// パーティクル更新
-		ParticleManager::GetInstance().Tick(delta_seconds);
+		UpdateRenderInterpolation();
 
-		_world_timer += delta_seconds;
+		_frame_cost_stats.simulation_ms = GetElapsedMilliseconds(simulation_begin);
+		_frame_cost_stats.particle_spawn = ParticleManager::GetInstance().TakeSpawnStats();
+	}
+	else
+	{
+		// 止めている間の入力は, 再開後のステップに持ち越さない
+		DeviceInput::DiscardPendingEdgeEvents();
 	}
 
 	// カメラパラメータの更新
@@ -97,26 +115,53 @@ SceneType SceneBase::Tick(float delta_seconds)
 	return GetSceneType();
 }
 
-void SceneBase::Draw()
+void SceneBase::TickWorldStep(const float step_seconds)
 {
-	// 1. アクターの描画処理
-	for (const auto& actor : _actors)
+	UpdateWorldDelayedEvents(step_seconds);
+
+	UpdateWorldRepeatingEvents(step_seconds);
+
+	// アクターの更新. Sleepのアクターや更新が無効なアクターはスケジューラーの配列に入っていないので, ここでは走査されない
+	_tick_scheduler.TickActors(step_seconds, _world_timer + step_seconds, GetSceneDrawArea());
+
+	// パーティクル更新
+	ParticleManager::GetInstance().Tick(step_seconds);
+
+	_world_timer += step_seconds;
+}
+
+void SceneBase::UpdateRenderInterpolation()
+{
+	if (!_simulation_clock.IsFixedStepEnabled())
 	{
-		if (!actor->ShouldCallDraw()) { continue; }
+		_tick_scheduler.ClearRenderInterpolation();
+		return;
+	}
 
-		if (actor->IsHidden()) { continue; }
+	// 持ち越した時間の分だけ, 最後のステップの終了時刻より前を描画する
+	const float step_seconds = _simulation_clock.GetStepSeconds();
+	const float render_world_time = _world_timer - (1.f - _simulation_clock.GetInterpolationAlpha()) * step_seconds;
+	_tick_scheduler.UpdateRenderInterpolation(render_world_time, step_seconds);
+}
 
-		if (!actor->IsDrawAreaCheckIgnored())
+void SceneBase::Draw()
+{
+	// 1. アクターの描画処理
+	const FCircle draw_area = GetSceneDrawArea();
+	ForEachActorInDrawOrder([this, &draw_area](Actor* const actor)
 		{
-			const FCircle draw_area = GetSceneDrawArea();
-			if (!IsActorInDrawArea(actor, draw_area))
+			if (!actor->ShouldCallDraw()) { return true; }
+
+			if (actor->IsHidden()) { return true; }
+
+			if (!actor->IsDrawAreaCheckIgnored() && !IsActorInDrawArea(actor, draw_area))
 			{
-				continue;
+				return true;
 			}
-		}
 
-		actor->Draw(_camera_params);
-	}
+			actor->Draw(_camera_params);
+			return true;
+		});
 
 	// 2. パーティクル描画
 	ParticleManager::GetInstance().Draw(_camera_params);
@@ -129,27 +174,48 @@ void SceneBase::Draw()
 void SceneBase::DrawForeground(const CanvasInfo& canvas_info)
 {
 	// アクターのUI描画処理 
-	for (const auto& actor : _actors)
-	{
-		if (actor->IsHidden())
+	ForEachActorInDrawOrder([&canvas_info](Actor* const actor)
 		{
-			continue;
-		}
-		actor->DrawForeground(canvas_info);
-	}
+			if (!actor->IsHidden())
+			{
+				actor->DrawForeground(canvas_info);
+			}
+			return true;
+		});
 }
 
 void SceneBase::Finalize()
 {
-	GraphicResourceManager::GetInstance().Finalize();
-	SoundManager::GetInstance().Finalize();
+	// 画像とサウンドは解放せず, 次のシーンで使われなかった分だけ予算に応じて解放する
+	GraphicResourceManager::GetInstance().ReleaseSceneReferences();
 	CollisionManager::GetInstance().Finalize();
 
 	// パーティクルを全破壊
 	ParticleManager::GetInstance().DeactivateAllParticles();
 
+	// 追加/除外待ちのリストを空にする. 除外待ちのアクターはDestroyAllActors()で破棄されるので, その前に行う
+	for (Actor* const actor : _actors_to_add)
+	{
+		if (actor)
+		{
+			actor->_index_in_actors_to_add = -1;
+		}
+	}
+	for (Actor* const actor : _actors_to_remove)
+	{
+		if (actor)
+		{
+			actor->_index_in_actors_to_remove = -1;
+		}
+	}
+	_actors_to_add.clear();
+	_actors_to_remove.clear();
+	_next_actor_serial = 0;
+
 	// 全てのオブジェクトを破棄
 	DestroyAllActors();
+	SoundManager::GetInstance().UnloadSceneSounds();
+	SoundManager::GetInstance().TrimCache();
 
 	_world_delayed_events.clear();
 	_world_repeating_events.clear();
@@ -157,9 +223,6 @@ void SceneBase::Finalize()
 	_bg_layer.clear();
 	_bg_layer.shrink_to_fit();
 
-	_actors_to_add.clear();
-	_actors_to_remove.clear();
-
 	_game_speed_rate = 1.0f;
 }
 
@@ -176,7 +239,7 @@ void SceneBase::OnAddedActor(Actor* new_actor)
 {
 	new_actor->actor_events.on_draw_priority_changed.Bind
 	(
-		[this]() {OnActorDrawPriorityChanged(); },
+		[this, new_actor]() {OnActorDrawPriorityChanged(new_actor); },
 		this
 	);
 }
@@ -218,47 +281,74 @@ SceneType SceneBase::ExecuteTick(const float delta_seconds)
 		DestroyActor(destroyee);
 	}
 
-	// シーンに追加されたアクターの処理
-	if (_actors_to_add.size() != 0)
+	// シーンに追加/除外されたアクターの処理
+	FlushPendingActors();
+	
+	return ret;
+}
+
+void SceneBase::FlushPendingActors()
+{
+	for (size_t i = 0; i < _actors_to_add.size(); i++)
 	{
-		for (auto& actor : _actors_to_add)
+		Actor* const actor = _actors_to_add[i];
+		if (actor == nullptr)
 		{
-			_actors.push_back(actor);
+			continue;
 		}
-		_actors_to_add.clear();
-		should_sort_actors = true;
+
+		actor->_index_in_actors_to_add = -1;
+		AddToActorRegistry(actor);
 	}
+	_actors_to_add.clear();
 
-	// シーンから除外されたアクターの処理
-	if (_actors_to_remove.size() != 0)
+	for (size_t i = 0; i < _actors_to_remove.size(); i++)
 	{
-		for (auto& actor : _actors_to_remove)
+		Actor* const actor = _actors_to_remove[i];
+		if (actor == nullptr)
 		{
-			auto it = std::find(_actors.begin(), _actors.end(), actor);
-			if (it == _actors.end())
-			{
-				throw std::runtime_error("Attempted to remove actor that is not in the scene");
-			}
+			continue;
+		}
 
-			_actors.erase(it);
+		if (!ExistsInScene(actor))
+		{
+			throw std::runtime_error("Attempted to remove actor that is not in the scene");
 		}
 
-		_actors_to_remove.clear();
-		should_sort_actors = true;
+		actor->_index_in_actors_to_remove = -1;
+		RemoveFromActorRegistry(actor);
+	}
+	_actors_to_remove.clear();
+}
+
+void SceneBase::CancelPendingActor(Actor* const actor)
+{
+	if (actor->_index_in_actors_to_add >= 0)
+	{
+		assert(_actors_to_add[actor->_index_in_actors_to_add] == actor);
+		_actors_to_add[actor->_index_in_actors_to_add] = nullptr;
+		actor->_index_in_actors_to_add = -1;
+	}
+
+	if (actor->_index_in_actors_to_remove >= 0)
+	{
+		assert(_actors_to_remove[actor->_index_in_actors_to_remove] == actor);
+		_actors_to_remove[actor->_index_in_actors_to_remove] = nullptr;
+		actor->_index_in_actors_to_remove = -1;
 	}
-	
-	return ret;
 }
 
 void SceneBase::ExecuteDrawProcess()
 {
-	// アクターを描画優先度でソート
-	if (should_sort_actors)
+	if (HeadlessPlatform::IsEnabled())
 	{
-		SortActorsByDrawPriority();
-		should_sort_actors = false;
+		return;
 	}
 
+	const auto draw_begin = std::chrono::high_resolution_clock::now();
+
+	PrepareDrawOrder();
+
 	// 1. 背景描画
 	DrawBackground();
 
@@ -283,6 +373,8 @@ void SceneBase::ExecuteDrawProcess()
 			true
 		);
 	}
+
+	_frame_cost_stats.draw_ms = GetElapsedMilliseconds(draw_begin);
 }
 
 void SceneBase::SetGameSpeed(const float new_speed_rate)
@@ -300,8 +392,47 @@ float SceneBase::GetWorldTime() const
 	return _world_timer;
 }
 
+uint32_t SceneBase::ComputeWorldStateHash() const
+{
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	const auto combine = [&hash](const void* const data, const size_t size)
+		{
+			const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < size; i++)
+			{
+				hash = (hash ^ bytes[i]) * 16777619u;
+			}
+		};
+
+	combine(&_world_timer, sizeof(_world_timer));
+
+	const uint32_t num_actors = static_cast<uint32_t>(_actors.size());
+	combine(&num_actors, sizeof(num_actors));
+
+	// NOTE: _actorsの並びは除外時の入れ替えで変わるので, シーンに登録された順の通し番号で並べ直してから混ぜる
+	std::vector<const Actor*> sorted_actors(_actors.begin(), _actors.end());
+	std::sort(sorted_actors.begin(), sorted_actors.end(),
+		[](const Actor* const a, const Actor* const b) { return a->_scene_serial < b->_scene_serial; });
+
+	for (const Actor* const actor : sorted_actors)
+	{
+		combine(&actor->_scene_serial, sizeof(actor->_scene_serial));
+		const Vector2D position = actor->GetActorWorldPosition();
+		combine(&position.x, sizeof(position.x));
+		combine(&position.y, sizeof(position.y));
+	}
+
+	return hash;
+}
+
 void SceneBase::DrawDebugLine(const Vector2D& start_world, const Vector2D& end_world, const int line_color, const int line_thickness, const DrawBlendInfo& blend_info)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	const int last_screen = DxLib::GetDrawScreen();
 
 	DxLib::SetDrawScreen(_debug_world_canvas->handle);
@@ -315,6 +446,11 @@ void SceneBase::DrawDebugLine(const Vector2D& start_world, const Vector2D& end_w
 
 void SceneBase::DrawDebugRect(const FRect& rect, const int line_color, const int line_thickness, const DrawBlendInfo& blend_info)
 {
+	if (HeadlessPlatform::IsEnabled())
+	{
+		return;
+	}
+
 	std::array<Vector2D, 4> vertices;
 	rect.GetVertices(vertices);
 
@@ -350,14 +486,15 @@ void SceneBase::DestroyActor(Actor*& destroyee)
 
 	// 破壊前処理
 	PreDestroyActor(destroyee);
-	destroyee->Finalize();
 
 	// 破壊対象をactorsから除外
-	std::vector<Actor*>::iterator it_destroyee;
-	if (ExistsInScene(destroyee, &it_destroyee))
+	if (ExistsInScene(destroyee))
 	{
-		_actors.erase(it_destroyee);
+		RemoveFromActorRegistry(destroyee);
 	}
+	CancelPendingActor(destroyee);
+
+	destroyee->Finalize();
 
 	// 破壊
 	ActorFactory::DestroyActor(destroyee);
@@ -376,22 +513,51 @@ bool SceneBase::IsActorInDrawArea(const Actor* const actor, const FCircle& draw_
 	return GeometricUtility::DoesCircleOverlapWithAnother(draw_area, actor_bounding_circle);
 }
 
-bool SceneBase::ExistsInScene(Actor* actor, std::vector<Actor*>::iterator* outIt)
+bool SceneBase::ExistsInScene(const Actor* const actor) const
 {
-	auto it = std::find(_actors.begin(), _actors.end(), actor);
-	if (outIt != nullptr)
-	{
-		*outIt = it;
-	}
+	const int index = actor->_index_in_scene;
+	return 0 <= index && index < static_cast<int>(_actors.size()) && _actors[index] == actor;
+}
+
+void SceneBase::AddToActorRegistry(Actor* const actor)
+{
+	assert(!ExistsInScene(actor));
+
+	actor->_index_in_scene = static_cast<int>(_actors.size());
+	actor->_scene_serial = _next_actor_serial++;
+	actor->_render_interpolation_offset = Vector2D();
+	_actors.push_back(actor);
+	_draw_order.Add(actor);
+	_tick_scheduler.RegisterActor(actor);
+}
+
+void SceneBase::RemoveFromActorRegistry(Actor* const actor)
+{
+	assert(ExistsInScene(actor));
+
+	// 末尾のアクターを空いた位置に移して取り除く. 描画順は_draw_orderが持つので_actorsの順序は保たなくてよい
+	const int index = actor->_index_in_scene;
+	Actor* const last_actor = _actors.back();
+	_actors[index] = last_actor;
+	last_actor->_index_in_scene = index;
+	_actors.pop_back();
+	actor->_index_in_scene = -1;
 
-	return it != _actors.end();
+	_draw_order.Remove(actor);
+	_tick_scheduler.UnregisterActor(actor);
 }
 
 void SceneBase::RemoveActor(Actor* actor_to_remove)
 {
 	if (ExistsInScene(actor_to_remove))
 	{
-		_actors_to_remove.insert(actor_to_remove);
+		if (actor_to_remove->_index_in_actors_to_remove >= 0)
+		{
+			return;
+		}
+
+		actor_to_remove->_index_in_actors_to_remove = static_cast<int>(_actors_to_remove.size());
+		_actors_to_remove.push_back(actor_to_remove);
 		OnRemovedActor(actor_to_remove);
 	}
 }
@@ -405,7 +571,13 @@ void SceneBase::AddActor(Actor* actor_to_add)
 
 	if(!ExistsInScene(actor_to_add))
 	{
-		_actors_to_add.insert(actor_to_add);
+		if (actor_to_add->_index_in_actors_to_add >= 0)
+		{
+			return;
+		}
+
+		actor_to_add->_index_in_actors_to_add = static_cast<int>(_actors_to_add.size());
+		_actors_to_add.push_back(actor_to_add);
 		OnAddedActor(actor_to_add);
 	}
 }
@@ -425,6 +597,11 @@ void SceneBase::SingleLineTrace(QueryResult_SingleLineTrace& out_query_result, c
 	CollisionManager::GetInstance().SingleLineTrace(out_query_result, query_params);
 }
 
+void SceneBase::BatchedSingleLineTrace(QueryResult_SingleLineTrace* const out_query_results, const CollisionQueryParams_SingleLineTrace* const queries, const int num_queries)
+{
+	CollisionManager::GetInstance().BatchedSingleLineTrace(out_query_results, queries, num_queries);
+}
+
 void SceneBase::MultiAARectTrace(QueryResult_MultiAARectTrace& out_query_result, const CollisionQueryParams_RectAA& query_params)
 {
 	CollisionManager::GetInstance().MultiAARectTrace(out_query_result, query_params);
@@ -435,10 +612,19 @@ void SceneBase::DestroyAllActors()
 	for (auto& actor : _actors)
 	{
 		PreDestroyActor(actor);
+		_tick_scheduler.UnregisterActor(actor);
+		_draw_order.Remove(actor);
+		actor->_index_in_scene = -1;
 		actor->Finalize();
 		ActorFactory::DestroyActor(actor);
 	}
 	_actors.clear();
+	_tick_scheduler.Clear();
+	_draw_order.Clear();
+
+	// 空になった型のプールをまとめて初期状態に戻し, 次のシーンのアクターが連続したメモリに配置されるようにする
+	// NOTE: コライダーやイベントの登録解除が必要なため, デストラクタとFinalize()を飛ばしてメモリだけ解放することはしない
+	GameObjectManager::GetInstance().ResetUnusedPools();
 }
 
 void SceneBase::UpdateWorldDelayedEvents(const float delta_seconds)
@@ -509,12 +695,9 @@ std::shared_ptr<DxLibScreenCapture> SceneBase::CaptureScene()
 	return capture_screen;
 }
 
-void SceneBase::OnActorDrawPriorityChanged()
+void SceneBase::OnActorDrawPriorityChanged(Actor* const actor)
 {
-	if (!should_sort_actors)
-	{
-		should_sort_actors = true;
-	}
+	_draw_order.OnDrawPriorityChanged(actor);
 }
 
 void SceneBase::MakeDelayedEventWorld(GameObject* const object, const float delay_time, const std::function<void()> process)
@@ -538,18 +721,13 @@ void SceneBase::MakeRepeatingEventSystem(const GameObject* const object, const f
 }
 
 void SceneBase::SortActorsByDrawPriority()
-{	
-	std::sort(_actors.begin(), _actors.end(), [](const Actor* obj1, const Actor* obj2)
-	{
-		if (obj1->GetDrawPriority() != obj2->GetDrawPriority())
-		{
-			// draw_sort_priorityが小さい順にソートする
-			return obj1->GetDrawPriority() < obj2->GetDrawPriority();
-		}
+{
+	_draw_order.SortAllBuckets();
+}
 
-		// priorityが同じ場合は、画面下の方から描画する
-		return  obj1->GetActorWorldPosition().y > obj2->GetActorWorldPosition().y;
-	});
+void SceneBase::PrepareDrawOrder()
+{
+	_draw_order.Prepare();
 }
 
 void SceneBase::AddBackgroundToLayer(BackgroundParams bg_params)
@@ -712,11 +890,17 @@ void SceneBase::SetWorldTimerActive(const bool new_world_timer_active)
 SceneBase::Canvas::Canvas(const CanvasInfo& canvas_info)
 	: info(canvas_info)
 {
-	handle = MakeScreen(canvas_info.width, canvas_info.height, TRUE);
+	// ヘッドレス実行ではスクリーンを作らない
+	handle = HeadlessPlatform::IsEnabled() ? -1 : MakeScreen(canvas_info.width, canvas_info.height, TRUE);
 }
 
 void SceneBase::Canvas::ClearScreen()
 {
+	if (handle == -1)
+	{
+		return;
+	}
+
 	const int last_screen = DxLib::GetDrawScreen();
 
 	DxLib::SetDrawScreen(handle);
@@ -8,6 +8,8 @@
 #include "Actor/ActorTraits.h"
 #include "Actor/ActorFactory.h"
 #include "Component/Collider/HitResult.h"
+#include "GameSystems/SimulationClock.h"
+#include "GameSystems/ParticleManager/ParticleSpawnQueue.h"
 #include <type_traits>
 #include <memory>
 #include <vector>
@@ -112,6 +114,13 @@ protected:
 	/// <param name="destroyed"></param>
 	virtual void OnDestroyedActor(Actor* destroyed);
 
+	/// <summary>
+	/// ワールドを1ステップ進める. Tick()から, SimulationClockが決めた回数だけ呼ばれる
+	/// <para>遅延処理, 定期実行処理, アクター, パーティクルを更新する. 衝突処理など, ステップごとに行う処理は派生クラスでこの後に追加する</para>
+	/// </summary>
+	/// <param name="step_seconds">1ステップの時間. 固定ステップが無効の場合はフレームの経過時間</param>
+	virtual void TickWorldStep(const float step_seconds);
+
 private:
 	virtual bool ShouldSpawnSceneAnimRendererActor() const;
 	//~ End SceneBase interface
@@ -135,12 +144,46 @@ public:
 
 	float GetWorldTime() const;
 
+	/// <summary>
+	/// シーンに追加済みのアクター数. 追加/除外待ちのアクターは含まない
+	/// </summary>
+	size_t GetNumActors() const { return _actors.size(); }
+
+	/// <summary>
+	/// ワールド時間と全アクターの位置から作るハッシュ値
+	/// <para>入力の再生で, 記録時とワールドの更新結果が一致しているかを確認するために使う</para>
+	/// </summary>
+	uint32_t ComputeWorldStateHash() const;
+
+	/// <summary>
+	/// シーン内のアクターのTickActor()を呼び出すスケジューラー
+	/// </summary>
+	ActorTickScheduler& GetActorTickScheduler() { return _tick_scheduler; }
+
+	/// <summary>
+	/// ワールドを進めるステップの時計. ステップの間隔や1フレームのステップ数の上限はここで設定する
+	/// </summary>
+	SimulationClock& GetSimulationClock() { return _simulation_clock; }
+
+	/// <summary>
+	/// 直近のフレームの, ワールドの更新(全ステップ)と描画にかかった時間
+	/// </summary>
+	struct FrameCostStats
+	{
+		double simulation_ms;
+		double draw_ms;
+
+		// ワールドの更新(全ステップ)でのパーティクル生成. 時間はsimulation_msに含まれる
+		ParticleSpawnStats particle_spawn;
+	};
+	const FrameCostStats& GetFrameCostStats() const { return _frame_cost_stats; }
+
 	std::shared_ptr<DxLibScreenCapture> CaptureScene();
 
 	/// <summary>
 	/// アクターが自身の描画優先度を変更した際に呼ぶ関数
 	/// </summary>
-	void OnActorDrawPriorityChanged();
+	void OnActorDrawPriorityChanged(Actor* const actor);
 
 	/// <summary>
 	/// ワールド時間での遅延処理を作成する.
@@ -187,6 +230,7 @@ public:
 	void StopAnimation(const size_t scene_anim_index);
 
 	void SingleLineTrace(QueryResult_SingleLineTrace& out_query_result, const CollisionQueryParams_SingleLineTrace& query_params);
+	void BatchedSingleLineTrace(QueryResult_SingleLineTrace* const out_query_results, const CollisionQueryParams_SingleLineTrace* const queries, const int num_queries);
 	void MultiAARectTrace(QueryResult_MultiAARectTrace& out_query_result, const CollisionQueryParams_RectAA& query_params = CollisionQueryParams_RectAA{});
 
 	/// <summary>
@@ -242,8 +286,26 @@ protected:
 
 	Actor* CreateAndInitializeActorByEntityType(const EEntityType entity_type, const ActorInitialParams* actor_params);
 
+	/// <summary>
+	/// 全アクターの描画順を現在のY座標で並べ替える. 追加, 削除, 描画優先度の変更による並べ替えは描画前に自動で行われる
+	/// </summary>
 	void SortActorsByDrawPriority();
 
+	/// <summary>
+	/// 追加, 削除, 描画優先度の変更があったバケットだけ描画順を整える. ExecuteDrawProcess()の最初に呼ばれる
+	/// </summary>
+	void PrepareDrawOrder();
+
+	/// <summary>
+	/// 描画順にシーン内のアクターについてcallbackを呼ぶ
+	/// </summary>
+	/// <param name="callback">bool(Actor* actor). falseを返すと打ち切る</param>
+	template<typename Callback>
+	void ForEachActorInDrawOrder(Callback&& callback) const
+	{
+		_draw_order.ForEach(std::forward<Callback>(callback));
+	}
+
 	/// <summary>
 	/// Actorを破壊する. SceneBase::_actorsのイテレーション中に呼ばない
 	/// </summary>
@@ -290,19 +352,60 @@ protected:
 	FCircle GetSceneDrawArea() const;
 	static bool IsActorInDrawArea(const Actor* const actor, const FCircle& draw_area);
 
+	// シーン内のアクター. 除外時は末尾の要素と入れ替えて取り除くため, 順序は不定. 描画順に処理する場合はForEachActorInDrawOrder()を使う
 	std::vector<Actor*> _actors;
-	bool ExistsInScene(Actor* actor, std::vector<Actor*>::iterator* outIt = nullptr);
+	bool ExistsInScene(const Actor* const actor) const;
 
 private:
 	bool _is_world_timer_active = true;
 
 	/// <summary>
 	/// シーン内の全Actorを破棄
+	/// <para>破棄後, 生存中のオブジェクトがなくなったGameObjectManagerのプールをリセットする</para>
 	/// </summary>
 	void DestroyAllActors();
 
-	std::unordered_set<Actor*> _actors_to_add;
-	std::unordered_set<Actor*> _actors_to_remove;
+	/// <summary>
+	/// _actors, _draw_order, _tick_schedulerに登録する
+	/// </summary>
+	void AddToActorRegistry(Actor* const actor);
+
+	/// <summary>
+	/// _actors, _draw_order, _tick_schedulerから登録を解除する
+	/// </summary>
+	void RemoveFromActorRegistry(Actor* const actor);
+
+	/// <summary>
+	/// 追加/除外待ちのリストを, 要求された順に処理して空にする
+	/// </summary>
+	void FlushPendingActors();
+
+	/// <summary>
+	/// 追加/除外待ちのリストから取り除く. 要素は詰めずにnullptrにしておき, FlushPendingActors()で読み飛ばす
+	/// </summary>
+	void CancelPendingActor(Actor* const actor);
+
+	// 追加/除外待ちのアクター. AddActor(), RemoveActor()が呼ばれた順に並べ, 同じ順に処理する
+	// NOTE: 処理順がアドレスに依存すると_actorsの並びが実行ごとに変わり, 入力を再生しても同じ結果にならないのでハッシュセットは使わない
+	std::vector<Actor*> _actors_to_add;
+	std::vector<Actor*> _actors_to_remove;
+
+	// 次にシーンに登録するアクターの通し番号
+	uint32_t _next_actor_serial;
+
+	// _actorsのうち更新するアクターを, 更新頻度ごとに管理する
+	ActorTickScheduler _tick_scheduler;
+
+	// _actorsの描画順
+	ActorDrawOrder _draw_order;
+
+	SimulationClock _simulation_clock;
+	FrameCostStats _frame_cost_stats;
+
+	/// <summary>
+	/// SimulationClock::GetInterpolationAlpha()から描画するワールド時間を求め, 更新しているアクターの描画位置のずれを求める
+	/// </summary>
+	void UpdateRenderInterpolation();
 
 	float _game_speed_rate;
 
@@ -313,11 +416,6 @@ private:
 	Vector2D _world_area_left_top;
 	Vector2D _world_area_right_bottom;
 
-	/// <summary>
-	/// trueの場合, アクターのDrawを呼ぶ前に描画優先度によるアクターのソートを行った後, falseに設定される.
-	/// </summary>
-	bool should_sort_actors;
-
 	// should_update_objectsがtrueの場合にのみ更新
 	float _world_timer;
 
@@ -49,6 +49,11 @@ SceneManagerMessage SceneManager::Tick(float DeltaSeconds)
 
 	SceneType next_scene_type = _current_scene->ExecuteTick(DeltaSeconds * _current_scene->GetGameSpeed());
 	SceneType current_scene_type = _current_scene->GetSceneType();
+
+	if (_input_recorder.IsRecording() && current_scene_type == SceneType::INGAME_SCENE)
+	{
+		_input_recorder.RecordFrame(DeltaSeconds, DeviceInput::GetLastSnapshot(), _current_scene->ComputeWorldStateHash());
+	}
 	if (next_scene_type == SceneType::MSG_RELOAD)
 	{
 		std::unique_ptr<const SceneBaseInitialParams> scene_params
@@ -83,13 +88,15 @@ SceneManagerMessage SceneManager::Tick(float DeltaSeconds)
 
 void SceneManager::Finalize()
 {
+	_input_recorder.EndRecording();
+
 	// CurrentSceneの解放
 	if (_current_scene != nullptr)
 	{
 		ImGui::NewFrame();
 
 		_current_scene->Finalize();
-		delete _current_scene;
+		GameObjectManager::GetInstance().DestroyObject(_current_scene);
 		_current_scene = nullptr;
 
 		ImGui::EndFrame();
@@ -153,13 +160,31 @@ void SceneManager::ChangeScene(SceneType next_scene_type, std::unique_ptr<const
 	if (_current_scene != nullptr)
 	{
 		_current_scene->Finalize();
-		delete _current_scene;
+		GameObjectManager::GetInstance().DestroyObject(_current_scene);
 	}
 
 	const int load_start_time = GetNowCount();
 
 	DrawLoadingScreen();
 
+	// 入力の記録. 同じステージのリトライでは記録を続ける
+	if (_input_recorder.IsEnabled())
+	{
+		const StageInteractiveSceneInitialParams* const stage_params = (next_scene_type == SceneType::INGAME_SCENE)
+			? dynamic_cast<const StageInteractiveSceneInitialParams*>(scene_params.get())
+			: nullptr;
+		const bool is_retry = stage_params && _input_recorder.IsRecording() && stage_params->stage_id == _input_recorder.GetStageId();
+		if (!is_retry)
+		{
+			_input_recorder.EndRecording();
+			if (stage_params)
+			{
+				// 乱数生成器を記録のシードで作り直すので, シーンの初期化より前に開始する
+				_input_recorder.BeginRecording(stage_params->stage_id);
+			}
+		}
+	}
+
 	// 新しいシーンの開始
 	new_scene->Initialize(scene_params.get());
 	_current_scene = new_scene;
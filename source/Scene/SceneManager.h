@@ -2,6 +2,7 @@
 #include <memory>
 #include <Scene/SceneType.h>
 #include "Utility/Core/Rendering/CanvasInfo.h"
+#include "GameSystems/InputReplay/InputRecorder.h"
 
 struct SceneBaseInitialParams;
 
@@ -42,6 +43,11 @@ public:
 	 */
 	void Finalize();
 
+	/// <summary>
+	/// InGameSceneのプレイを記録する. SetOutputDirectory()で出力先を設定した場合のみ記録する
+	/// </summary>
+	InputRecorder& GetInputRecorder() { return _input_recorder; }
+
 private:
 	void NewImGuiFrame();
 
@@ -66,6 +72,8 @@ private:
 	class SceneBase* CreateScene(SceneType new_scene_type);
 
 	class SceneBase* _current_scene;
+
+	InputRecorder _input_recorder;
 	
 	int _draw_scene_screen_handle;
 
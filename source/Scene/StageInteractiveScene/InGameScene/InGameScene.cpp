@@ -10,6 +10,10 @@
 #include "Actor/AllActorsInclude_generated.h"
 #include "Component/Collider/SegmentCollider.h"
 #include "Input/DeviceInput.h"
+#include "Actor/ActorFactory.h"
+#include "GameSystems/ParticleManager/ParticleManager.h"
+#include <algorithm>
+#include <unordered_set>
 
 namespace
 {
@@ -32,10 +36,14 @@ InGameScene::~InGameScene()
 
 void InGameScene::Initialize(const SceneBaseInitialParams* const scene_params)
 {
-	__super::Initialize(scene_params);
+	StageInteractiveScene::Initialize(scene_params);
 
 	_remaining_time = GetStageRef().GetTimeLimit();
 
+	SetupActorStreamer();
+
+	PreloadParticleSprites();
+
 	if (scene_params == nullptr)
 	{
 		std::cerr << "InGameScene::Initialize: scene_params is nullptr" << std::endl;
@@ -59,7 +67,7 @@ void InGameScene::Initialize(const SceneBaseInitialParams* const scene_params)
 
 SceneType InGameScene::Tick(float delta_seconds)
 {
-	SceneType result_scene_type = __super::Tick(delta_seconds);
+	SceneType result_scene_type = StageInteractiveScene::Tick(delta_seconds);
 
 	if (_is_end_scene_requested)
 	{
@@ -75,45 +83,15 @@ SceneType InGameScene::Tick(float delta_seconds)
 
 	_state_stack->Tick(*this, delta_seconds);
 
-	for (auto& actor : _actors)
-	{
-		// スポーン/デスポーンはステージへの生成情報があるアクターに対してのみ行う
-		if (!IsActorInStage(actor))
-		{
-			continue;
-		}
-
-		// スポーンチェック
-		const Transform spawn_transform = GetSpawnActorInfo(actor)->initial_params->transform;
-		FCircle actor_spawn_circle(spawn_transform.position, actor->GetBoundingCircleRadius());
-		const bool is_init_pos_in_spawn_area = GeometricUtility::DoesCircleOverlapWithAnother(actor_spawn_circle, GetSpawnArea());
-		const bool should_spawn = actor->IsHidden() && is_init_pos_in_spawn_area;
-		_was_actor_init_pos_in_spawn_area.at(actor) = is_init_pos_in_spawn_area;
-		if (should_spawn)
-		{
-			actor->SetActorWorldPosition(spawn_transform.position);
-			actor->SetActorWorldRotation(spawn_transform.rotation);
-			actor->SetVelocity(Vector2D{});
-			actor->RequestToSetActorHidden(false);
-			continue;
-		}
-
-		// デスポーンチェック
-		const bool is_actor_in_spawn_area = GeometricUtility::DoesCircleOverlapWithAnother(actor->GetBoundingCircle(), GetSpawnArea());
-		const bool should_despawn = !actor->IsHidden() && !is_actor_in_spawn_area;
-		if (should_despawn)
-		{
-			actor->RequestToSetActorHidden(true);
-			continue;
-		}
-	}
+	// スポーン/デスポーンはステージへの生成情報があるアクターに対してのみ行う
+	_actor_streamer.Update(GetSpawnArea());
 
 	return result_scene_type;
 }
 
 void InGameScene::DrawForeground(const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(canvas_info);
+	StageInteractiveScene::DrawForeground(canvas_info);
 
 	_state_stack->DrawForeground(*this, canvas_info);
 }
@@ -123,7 +101,7 @@ void InGameScene::Finalize()
 	_state_stack->Finalize(*this);
 	_state_stack.reset();
 
-	_was_actor_init_pos_in_spawn_area.clear();
+	_actor_streamer.Finalize();
 
 	_destination_scene = SceneType::NONE;
 	_total_score = 0;
@@ -134,7 +112,21 @@ void InGameScene::Finalize()
 	_has_hurried_player = false;
 	_sound_instance_bgm.reset();
 
-	__super::Finalize();
+	StageInteractiveScene::Finalize();
+}
+
+bool InGameScene::ShouldCreateStageActorLazily(const SpawnActorInfo& spawn_info) const
+{
+	switch (spawn_info.entity_type)
+	{
+	case EEntityType::RectangleBlock:
+	case EEntityType::SlopeBlock:
+	case EEntityType::SlopeBlock2:
+		// 地形のコライダーはCollisionManager::ConstructTree()で静的グリッドに入れるため, 最初に生成する
+		return false;
+	default:
+		return true;
+	}
 }
 
 void InGameScene::AddScore(int score)
@@ -149,32 +141,25 @@ int InGameScene::GetScore() const
 
 void InGameScene::UpdateCameraParams(const float delta_seconds)
 {
-	__super::UpdateCameraParams(delta_seconds);
+	StageInteractiveScene::UpdateCameraParams(delta_seconds);
 
 	_state_stack->UpdateCameraParams(*this, delta_seconds);
 
 	ClampCameraPositionInStage(_camera_params);
 }
 
-void InGameScene::OnAddedActor(Actor* new_actor)
-{
-	__super::OnAddedActor(new_actor);
-
-	_was_actor_init_pos_in_spawn_area[new_actor] = false;
-}
-
 void InGameScene::OnRemovedActor(Actor* removed_actor)
 {
-	_was_actor_init_pos_in_spawn_area.erase(removed_actor);
+	_actor_streamer.RemoveActor(removed_actor);
 
-	__super::OnRemovedActor(removed_actor);
+	StageInteractiveScene::OnRemovedActor(removed_actor);
 }
 
 void InGameScene::PreDestroyActor(Actor* destroyee)
 {
-	_was_actor_init_pos_in_spawn_area.erase(destroyee);
+	_actor_streamer.RemoveActor(destroyee);
 
-	__super::PreDestroyActor(destroyee);
+	StageInteractiveScene::PreDestroyActor(destroyee);
 }
 
 FCircle InGameScene::GetSpawnArea() const
@@ -182,6 +167,51 @@ FCircle InGameScene::GetSpawnArea() const
 	return FCircle(_camera_params.world_offset, _spawn_area_radius);
 }
 
+void InGameScene::SetupActorStreamer()
+{
+	_actor_streamer.Initialize(GetStageRef(),
+		[this](const std::shared_ptr<SpawnActorInfo>& spawn_info)
+		{
+			return CreateStageActor(spawn_info);
+		});
+
+	// 生成済みのアクター(プレイヤー)と, 遅延生成するアクターを登録する
+	const auto& actor_spawn_info_map = GetActorSpawnInfoMap();
+	std::unordered_set<const SpawnActorInfo*> created_spawn_infos;
+	for (const auto& actor_info_pair : actor_spawn_info_map)
+	{
+		_actor_streamer.AddActor(actor_info_pair.first, actor_info_pair.second);
+		created_spawn_infos.insert(actor_info_pair.second.get());
+	}
+	for (const auto& spawn_info : GetStageRef().GetSpawnActorInfosRef())
+	{
+		if (created_spawn_infos.find(spawn_info.get()) == created_spawn_infos.end())
+		{
+			_actor_streamer.AddPendingActor(spawn_info);
+		}
+	}
+}
+
+void InGameScene::PreloadParticleSprites()
+{
+	std::unordered_set<EEntityType> entity_types;
+	for (const auto& spawn_info : GetStageRef().GetSpawnActorInfosRef())
+	{
+		entity_types.insert(spawn_info->entity_type);
+	}
+
+	std::vector<MasterDataID> particle_ids;
+	for (const EEntityType entity_type : entity_types)
+	{
+		ActorFactory::CollectUsedParticleIdsByEntityType(entity_type, particle_ids);
+	}
+	std::sort(particle_ids.begin(), particle_ids.end());
+	particle_ids.erase(std::unique(particle_ids.begin(), particle_ids.end()), particle_ids.end());
+
+	// 読み込み済みのスプライトはシーンをまたいでアトラスに残っているので, 再読み込みやリトライでは何も読み込まない
+	ParticleManager::GetInstance().PreloadParticleSprites(particle_ids);
+}
+
 void InGameScene::EndInGameScene()
 {
 	_is_end_scene_requested = true;
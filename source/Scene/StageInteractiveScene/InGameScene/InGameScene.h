@@ -2,6 +2,7 @@
 
 #include "Scene/StageInteractiveScene/StageInteractiveScene.h"
 #include "Scene/SceneState/SceneState.h"
+#include "StageActorStreamer.h"
 #include <vector>
 #include <string>
 #include <map>
@@ -34,7 +35,6 @@ public:
 	virtual SceneType GetSceneType() const override { return SceneType::INGAME_SCENE; }
 	virtual void UpdateCameraParams(const float delta_seconds) override;
 protected:
-	virtual void OnAddedActor(Actor* new_actor) override;
 	virtual void OnRemovedActor(Actor* removed_actor) override;
 	virtual void PreDestroyActor(Actor* destroyee) override;
 	//~ End SceneBase interface
@@ -42,6 +42,7 @@ protected:
 	//~ Begin StageInteractiveScene interface
 protected:
 	// virtual void BuildStage(const Stage& stage) override;
+	virtual bool ShouldCreateStageActorLazily(const SpawnActorInfo& spawn_info) const override;
 	//~ End StageInteractiveScene interface
 
 public:
@@ -58,8 +59,15 @@ private:
 	/// </summary>
 	const float _spawn_area_radius;
 	FCircle GetSpawnArea() const;
-	// 前フレームでアクターのスポーン位置がスポーンエリア内にあったか
-	std::unordered_map<Actor*, bool> _was_actor_init_pos_in_spawn_area;
+
+	// ステージのアクターのスポーン/デスポーンと遅延生成を行う
+	StageActorStreamer _actor_streamer;
+	void SetupActorStreamer();
+
+	/// <summary>
+	/// ステージに配置されたアクターが生成するパーティクルのスプライトを先に読み込み, プレイ中にテクスチャを読み込まないようにする
+	/// </summary>
+	void PreloadParticleSprites();
 
 	bool _is_end_scene_requested;
 	SceneType _destination_scene;
@@ -0,0 +1,398 @@
+#include "StageActorStreamer.h"
+#include "Actor/Actor.h"
+#include "Actor/ActorInitialParams.h"
+#include "Scene/StageInteractiveScene/SpawnActorInfo.h"
+#include "Scene/StageInteractiveScene/Stage/Stage.h"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+StageActorStreamer::StageActorStreamer()
+	: _stage_left(0.f)
+	, _cell_width(CELL_WIDTH_TILES * UNIT_TILE_SIZE)
+	, _max_radius(0.f)
+	, _first_active_cell(0)
+	, _last_active_cell(-1)
+	, _has_updated(false)
+	, _stats{}
+{
+}
+
+void StageActorStreamer::Initialize(const Stage& stage, const CreateActorFunction& create_actor_function)
+{
+	assert(_cells.empty());
+
+	const int num_cells = std::max(1, (stage.GetStageLength() + CELL_WIDTH_TILES - 1) / CELL_WIDTH_TILES);
+	_cells.resize(num_cells);
+	for (Cell& cell : _cells)
+	{
+		cell.init_pos_min = Vector2D{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		cell.init_pos_max = Vector2D{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+		cell.max_radius = 0.f;
+		cell.state = ECellState::Outside;
+	}
+
+	_stage_left = stage.GetStageLeftTop().x;
+	_create_actor_function = create_actor_function;
+}
+
+void StageActorStreamer::Finalize()
+{
+	_cells.clear();
+	_cells.shrink_to_fit();
+	_actor_cell_indices.clear();
+	_spawned_dynamic_actors.clear();
+	_respawn_candidates.clear();
+	_create_actor_function = nullptr;
+
+	_max_radius = 0.f;
+	_first_active_cell = 0;
+	_last_active_cell = -1;
+	_has_updated = false;
+	_stats = StreamingStats{};
+}
+
+void StageActorStreamer::AddActor(Actor* const actor, const std::shared_ptr<SpawnActorInfo>& spawn_info)
+{
+	assert(actor != nullptr);
+	AddEntry(Entry{ spawn_info, actor });
+
+	if (!actor->IsHidden() && !IsStaticActor(actor))
+	{
+		_spawned_dynamic_actors.push_back(Entry{ spawn_info, actor });
+	}
+}
+
+void StageActorStreamer::AddPendingActor(const std::shared_ptr<SpawnActorInfo>& spawn_info)
+{
+	AddEntry(Entry{ spawn_info, nullptr });
+	_stats.num_pending_actors++;
+}
+
+void StageActorStreamer::RemoveActor(Actor* const actor)
+{
+	auto it = _actor_cell_indices.find(actor);
+	if (it == _actor_cell_indices.end())
+	{
+		return;
+	}
+
+	std::vector<Entry>& entries = _cells[it->second].entries;
+	auto it_entry = std::find_if(entries.begin(), entries.end(), [actor](const Entry& entry) { return entry.actor == actor; });
+	assert(it_entry != entries.end());
+	*it_entry = entries.back();
+	entries.pop_back();
+	_actor_cell_indices.erase(it);
+
+	// スポーン中のリストと再スポーン候補からも取り除く. どちらも小さいので線形探索でよい
+	auto is_removed_actor = [actor](const Entry& entry) { return entry.actor == actor; };
+	_spawned_dynamic_actors.erase(std::remove_if(_spawned_dynamic_actors.begin(), _spawned_dynamic_actors.end(), is_removed_actor), _spawned_dynamic_actors.end());
+	_respawn_candidates.erase(std::remove_if(_respawn_candidates.begin(), _respawn_candidates.end(), is_removed_actor), _respawn_candidates.end());
+}
+
+void StageActorStreamer::Update(const FCircle& spawn_area)
+{
+	if (_cells.empty())
+	{
+		return;
+	}
+
+	_stats.num_cells = static_cast<int>(_cells.size());
+	_stats.num_visited_cells = 0;
+	_stats.num_visited_entries = 0;
+
+	// 1. 前回デスポーンしたアクターのうち, 初期位置がスポーンエリア内にあるものを再スポーンさせる
+	if (!_respawn_candidates.empty())
+	{
+		std::vector<Entry> respawn_candidates;
+		respawn_candidates.swap(_respawn_candidates);
+		for (const Entry& entry : respawn_candidates)
+		{
+			if (entry.actor->IsHidden() && IsInitPosInSpawnArea(entry, spawn_area))
+			{
+				SpawnActor(entry);
+			}
+		}
+	}
+
+	// 2. セル
+	// スポーンエリアと重なり得るセルの範囲. 範囲外のセルは全てOutside
+	const float reach = spawn_area.radius + _max_radius;
+	const int first_cell = GetCellIndex(spawn_area.center.x - reach);
+	const int last_cell = GetCellIndex(spawn_area.center.x + reach);
+
+	auto update_cell = [this, &spawn_area](Cell& cell, const bool is_forced)
+		{
+			const ECellState new_state = ComputeCellState(cell, spawn_area);
+			switch (new_state)
+			{
+			case ECellState::Outside:
+				if (is_forced || cell.state != ECellState::Outside)
+				{
+					DespawnStaticActorsInCell(cell);
+				}
+				break;
+
+			case ECellState::Inside:
+				// 全エントリーの初期位置がスポーンエリア内なので, 入ったときに1回だけスポーンさせればよい
+				// NOTE: そのため, Insideの間に非表示になった動かないアクター(取ったコインなど)は, セルが一度Insideでなくなるまで再スポーンしない
+				if (is_forced || cell.state != ECellState::Inside)
+				{
+					UpdateCellEntries(cell, spawn_area);
+				}
+				break;
+
+			case ECellState::Boundary:
+				UpdateCellEntries(cell, spawn_area);
+				break;
+			}
+			cell.state = new_state;
+		};
+
+	if (!_has_updated)
+	{
+		// 最初は全セルの状態が分からないので全て調べる
+		for (Cell& cell : _cells)
+		{
+			update_cell(cell, true);
+		}
+		_has_updated = true;
+	}
+	else
+	{
+		// 範囲から外れたセル
+		for (int i = _first_active_cell; i <= _last_active_cell; i++)
+		{
+			if ((i < first_cell || last_cell < i) && _cells[i].state != ECellState::Outside)
+			{
+				DespawnStaticActorsInCell(_cells[i]);
+				_cells[i].state = ECellState::Outside;
+			}
+		}
+
+		for (int i = first_cell; i <= last_cell; i++)
+		{
+			update_cell(_cells[i], false);
+		}
+	}
+
+	_first_active_cell = first_cell;
+	_last_active_cell = last_cell;
+
+	// 3. スポーン中の動くアクター
+	// NOTE: セルより後に調べ, ここでデスポーンしたアクターが同じフレームで再スポーンしないようにする
+	UpdateSpawnedDynamicActors(spawn_area);
+
+	_stats.num_spawned_dynamic_actors = static_cast<int>(_spawned_dynamic_actors.size());
+}
+
+void StageActorStreamer::GetStats(StreamingStats& out_stats) const
+{
+	out_stats = _stats;
+}
+
+void StageActorStreamer::AddEntry(const Entry& entry)
+{
+	const Vector2D& init_pos = entry.spawn_info->initial_params->transform.position;
+	const float radius = entry.actor ? entry.actor->GetBoundingCircleRadius() : PENDING_ACTOR_RADIUS;
+	const int cell_index = GetCellIndex(init_pos.x);
+
+	Cell& cell = _cells[cell_index];
+	cell.entries.push_back(entry);
+	cell.init_pos_min = Vector2D{ std::min(cell.init_pos_min.x, init_pos.x), std::min(cell.init_pos_min.y, init_pos.y) };
+	cell.init_pos_max = Vector2D{ std::max(cell.init_pos_max.x, init_pos.x), std::max(cell.init_pos_max.y, init_pos.y) };
+	cell.max_radius = std::max(cell.max_radius, radius);
+	_max_radius = std::max(_max_radius, radius);
+
+	if (entry.actor)
+	{
+		_actor_cell_indices[entry.actor] = cell_index;
+	}
+
+	// 追加されたセルがどの状態か分からないので, 次のUpdate()で全セルを調べ直す
+	_has_updated = false;
+}
+
+int StageActorStreamer::GetCellIndex(const float x) const
+{
+	// NOTE: ステージ外の位置は端のセルに入れる
+	const float cell_position = (x - _stage_left) / _cell_width;
+	if (cell_position <= 0.f)
+	{
+		return 0;
+	}
+
+	return std::min(static_cast<int>(cell_position), static_cast<int>(_cells.size()) - 1);
+}
+
+StageActorStreamer::ECellState StageActorStreamer::ComputeCellState(const Cell& cell, const FCircle& spawn_area) const
+{
+	if (cell.entries.empty())
+	{
+		return ECellState::Outside;
+	}
+
+	const Vector2D& center = spawn_area.center;
+
+	// 初期位置を囲む矩形とスポーンエリアの中心の最短距離が, 半径の和より大きければ重ならない
+	const float nearest_dx = std::max({ cell.init_pos_min.x - center.x, 0.f, center.x - cell.init_pos_max.x });
+	const float nearest_dy = std::max({ cell.init_pos_min.y - center.y, 0.f, center.y - cell.init_pos_max.y });
+	const float reach = spawn_area.radius + cell.max_radius;
+	if (nearest_dx * nearest_dx + nearest_dy * nearest_dy > reach * reach)
+	{
+		return ECellState::Outside;
+	}
+
+	// 矩形の最も遠い頂点がスポーンエリア内なら, 全ての初期位置がスポーンエリア内
+	const float farthest_dx = std::max(fabsf(cell.init_pos_min.x - center.x), fabsf(cell.init_pos_max.x - center.x));
+	const float farthest_dy = std::max(fabsf(cell.init_pos_min.y - center.y), fabsf(cell.init_pos_max.y - center.y));
+	if (farthest_dx * farthest_dx + farthest_dy * farthest_dy < spawn_area.radius * spawn_area.radius)
+	{
+		return ECellState::Inside;
+	}
+
+	return ECellState::Boundary;
+}
+
+void StageActorStreamer::UpdateCellEntries(Cell& cell, const FCircle& spawn_area)
+{
+	_stats.num_visited_cells++;
+	_stats.num_visited_entries += static_cast<int>(cell.entries.size());
+
+	for (Entry& entry : cell.entries)
+	{
+		if (entry.actor == nullptr)
+		{
+			TryCreatePendingActor(entry, spawn_area);
+			continue;
+		}
+
+		Actor* const actor = entry.actor;
+		if (actor->IsHidden())
+		{
+			if (IsInitPosInSpawnArea(entry, spawn_area))
+			{
+				SpawnActor(entry);
+			}
+		}
+		else if (IsStaticActor(actor))
+		{
+			// 動くアクターのデスポーン判定はUpdateSpawnedDynamicActors()で行う
+			if (!GeometricUtility::DoesCircleOverlapWithAnother(actor->GetBoundingCircle(), spawn_area))
+			{
+				DespawnActor(actor);
+			}
+		}
+	}
+}
+
+void StageActorStreamer::DespawnStaticActorsInCell(Cell& cell)
+{
+	_stats.num_visited_cells++;
+	_stats.num_visited_entries += static_cast<int>(cell.entries.size());
+
+	for (Entry& entry : cell.entries)
+	{
+		if (entry.actor && !entry.actor->IsHidden() && IsStaticActor(entry.actor))
+		{
+			DespawnActor(entry.actor);
+		}
+	}
+}
+
+void StageActorStreamer::UpdateSpawnedDynamicActors(const FCircle& spawn_area)
+{
+	for (size_t i = 0; i < _spawned_dynamic_actors.size();)
+	{
+		const Entry entry = _spawned_dynamic_actors[i];
+		Actor* const actor = entry.actor;
+		if (!actor->IsHidden() && GeometricUtility::DoesCircleOverlapWithAnother(actor->GetBoundingCircle(), spawn_area))
+		{
+			i++;
+			continue;
+		}
+
+		if (!actor->IsHidden())
+		{
+			DespawnActor(actor);
+		}
+
+		// 初期位置がスポーンエリア内に残っている場合は, 次のUpdate()で再スポーンさせる
+		_respawn_candidates.push_back(entry);
+
+		_spawned_dynamic_actors[i] = _spawned_dynamic_actors.back();
+		_spawned_dynamic_actors.pop_back();
+	}
+}
+
+bool StageActorStreamer::TryCreatePendingActor(Entry& entry, const FCircle& spawn_area)
+{
+	assert(entry.actor == nullptr);
+
+	if (!IsInitPosInSpawnArea(entry, spawn_area))
+	{
+		return false;
+	}
+
+	Actor* const created_actor = _create_actor_function(entry.spawn_info);
+	if (created_actor == nullptr)
+	{
+		throw std::runtime_error("Failed to create stage actor");
+	}
+
+	entry.actor = created_actor;
+	_stats.num_pending_actors--;
+
+	const int cell_index = GetCellIndex(entry.spawn_info->initial_params->transform.position.x);
+	_actor_cell_indices[created_actor] = cell_index;
+
+	const float radius = created_actor->GetBoundingCircleRadius();
+	_cells[cell_index].max_radius = std::max(_cells[cell_index].max_radius, radius);
+	_max_radius = std::max(_max_radius, radius);
+
+	// 生成されたアクターは初期位置に表示されている. 実際の境界円で判定し直す
+	if (!IsInitPosInSpawnArea(entry, spawn_area))
+	{
+		DespawnActor(created_actor);
+	}
+	else if (!IsStaticActor(created_actor))
+	{
+		_spawned_dynamic_actors.push_back(entry);
+	}
+
+	return true;
+}
+
+bool StageActorStreamer::IsInitPosInSpawnArea(const Entry& entry, const FCircle& spawn_area) const
+{
+	const float radius = entry.actor ? entry.actor->GetBoundingCircleRadius() : PENDING_ACTOR_RADIUS;
+	const FCircle init_circle(entry.spawn_info->initial_params->transform.position, radius);
+	return GeometricUtility::DoesCircleOverlapWithAnother(init_circle, spawn_area);
+}
+
+void StageActorStreamer::SpawnActor(const Entry& entry)
+{
+	Actor* const actor = entry.actor;
+	const Transform& spawn_transform = entry.spawn_info->initial_params->transform;
+	actor->SetActorWorldPosition(spawn_transform.position);
+	actor->SetActorWorldRotation(spawn_transform.rotation);
+	actor->SetVelocity(Vector2D{});
+	actor->RequestToSetActorHidden(false);
+
+	if (!IsStaticActor(actor))
+	{
+		_spawned_dynamic_actors.push_back(entry);
+	}
+}
+
+void StageActorStreamer::DespawnActor(Actor* const actor)
+{
+	actor->RequestToSetActorHidden(true);
+}
+
+bool StageActorStreamer::IsStaticActor(const Actor* const actor)
+{
+	// 更新頻度とは関係なく, アクターの種類ごとに決める. Sleepでも起こされて動くアクターはありうる
+	return actor->IsStationary();
+}
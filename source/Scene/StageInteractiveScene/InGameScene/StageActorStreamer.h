@@ -0,0 +1,160 @@
+#pragma once
+#include "SystemTypes.h"
+#include "Utility/Core/MathCore.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
+
+class Actor;
+class Stage;
+struct SpawnActorInfo;
+
+/// <summary>
+/// ステージのアクターのスポーン/デスポーンを, ステージの長さ方向に並べたセル単位で管理するクラス
+/// <para>アクターは初期位置のX座標でセルに分けられる. 毎フレーム, スポーンエリアとの位置関係が変わったセルと, スポーンエリアの境界にかかるセルだけを調べる</para>
+/// <para>Actor::IsStationary()のアクター(ブロックなど)は初期位置から動かないので, セル単位でまとめてデスポーンさせる. それ以外のアクターはスポーン中だけ毎フレーム調べる</para>
+/// <para>遅延生成を有効にすると, アクターは初期位置が初めてスポーンエリアに近づいたときに生成される</para>
+/// </summary>
+class StageActorStreamer
+{
+public:
+	/// <summary>
+	/// 遅延生成するアクターを生成する関数. 生成したアクターを返す
+	/// </summary>
+	using CreateActorFunction = std::function<Actor*(const std::shared_ptr<SpawnActorInfo>&)>;
+
+	/// <summary>
+	/// 直近のUpdate()の処理量
+	/// </summary>
+	struct StreamingStats
+	{
+		int num_cells;
+		int num_visited_cells;
+		int num_visited_entries;
+		int num_spawned_dynamic_actors;
+		int num_pending_actors;	// 未生成のアクター数
+	};
+
+	// 1セルの幅 [タイル]
+	static constexpr int CELL_WIDTH_TILES = 4;
+
+	// 未生成のアクターの境界円半径の代わりに使う値. 生成後は実際の境界円で判定する
+	static constexpr float PENDING_ACTOR_RADIUS = UNIT_TILE_SIZE * 4.f;
+
+	StageActorStreamer();
+
+	StageActorStreamer(const StageActorStreamer&) = delete;
+	StageActorStreamer& operator=(const StageActorStreamer&) = delete;
+
+	/// <summary>
+	/// ステージの長さからセルを作る. アクターの登録はこの後に行う
+	/// </summary>
+	/// <param name="create_actor_function">遅延生成に使う関数</param>
+	void Initialize(const Stage& stage, const CreateActorFunction& create_actor_function);
+	void Finalize();
+
+	/// <summary>
+	/// 生成済みのステージのアクターを登録する
+	/// </summary>
+	void AddActor(Actor* const actor, const std::shared_ptr<SpawnActorInfo>& spawn_info);
+
+	/// <summary>
+	/// 遅延生成するアクターのスポーン情報を登録する
+	/// </summary>
+	void AddPendingActor(const std::shared_ptr<SpawnActorInfo>& spawn_info);
+
+	/// <summary>
+	/// シーンから除外, もしくは破棄されるアクターの登録を解除する. 未登録の場合は何もしない
+	/// </summary>
+	void RemoveActor(Actor* const actor);
+
+	/// <summary>
+	/// スポーンエリアに合わせてアクターをスポーン/デスポーンさせる
+	/// <para>アクターは, 初期位置を中心とした境界円がスポーンエリアと重なったときにスポーンされ, </para>
+	/// <para>現在位置を中心とした境界円がスポーンエリアから外れたときにデスポーンされる</para>
+	/// </summary>
+	void Update(const FCircle& spawn_area);
+
+	void GetStats(StreamingStats& out_stats) const;
+
+private:
+	struct Entry
+	{
+		std::shared_ptr<SpawnActorInfo> spawn_info;
+		Actor* actor;	// 未生成の場合はnullptr
+	};
+
+	/// <summary>
+	/// セルとスポーンエリアの位置関係
+	/// </summary>
+	enum class ECellState : uint8_t
+	{
+		Outside,	// どのエントリーもスポーンエリアと重ならない
+		Boundary,	// エントリーごとに調べる必要がある
+		Inside,		// 全エントリーの初期位置がスポーンエリアと重なる
+	};
+
+	struct Cell
+	{
+		std::vector<Entry> entries;
+
+		// エントリーの初期位置を囲む矩形と, 境界円半径の最大値
+		Vector2D init_pos_min;
+		Vector2D init_pos_max;
+		float max_radius;
+
+		ECellState state;
+	};
+
+	void AddEntry(const Entry& entry);
+	int GetCellIndex(const float x) const;
+	ECellState ComputeCellState(const Cell& cell, const FCircle& spawn_area) const;
+
+	/// <summary>
+	/// セル内のエントリーを1つずつ判定する
+	/// </summary>
+	void UpdateCellEntries(Cell& cell, const FCircle& spawn_area);
+
+	/// <summary>
+	/// スポーンエリアから外れたセルの動かないアクターをデスポーンさせる
+	/// </summary>
+	void DespawnStaticActorsInCell(Cell& cell);
+
+	/// <summary>
+	/// スポーン中の動くアクターについて, 現在位置でデスポーン判定を行う
+	/// </summary>
+	void UpdateSpawnedDynamicActors(const FCircle& spawn_area);
+
+	bool TryCreatePendingActor(Entry& entry, const FCircle& spawn_area);
+	bool IsInitPosInSpawnArea(const Entry& entry, const FCircle& spawn_area) const;
+	void SpawnActor(const Entry& entry);
+	void DespawnActor(Actor* const actor);
+	static bool IsStaticActor(const Actor* const actor);
+
+	std::vector<Cell> _cells;
+	float _stage_left;
+	float _cell_width;
+
+	// 全エントリーの境界円半径の最大値. 調べるセルの範囲を決めるのに使う
+	float _max_radius;
+
+	// 前回のUpdate()で調べたセルの範囲
+	int _first_active_cell;
+	int _last_active_cell;
+	bool _has_updated;
+
+	// 登録済みのアクターが入っているセル
+	std::unordered_map<Actor*, int> _actor_cell_indices;
+
+	// スポーン中の動くアクター
+	std::vector<Entry> _spawned_dynamic_actors;
+
+	// 前回のUpdate()でデスポーンした, 次のUpdate()でスポーン判定を行うアクター
+	std::vector<Entry> _respawn_candidates;
+
+	CreateActorFunction _create_actor_function;
+
+	StreamingStats _stats;
+};
@@ -32,7 +32,7 @@ InGameSceneState_GameOver::InGameSceneState_GameOver()
 
 void InGameSceneState_GameOver::OnEnterState(ParentSceneClass& parent_scene)
 {
-	__super::OnEnterState(parent_scene);
+	InGameSceneState::OnEnterState(parent_scene);
 
 	_timer = 0.f;
 	_fade_start_time = FLT_MAX;
@@ -55,7 +55,7 @@ void InGameSceneState_GameOver::OnEnterState(ParentSceneClass& parent_scene)
 
 std::shared_ptr<SceneState<InGameSceneState_GameOver::ParentSceneClass>> InGameSceneState_GameOver::Tick(ParentSceneClass& parent_scene, float delta_seconds)
 {
-	auto ret = __super::Tick(parent_scene, delta_seconds);
+	auto ret = InGameSceneState::Tick(parent_scene, delta_seconds);
 
 	_timer += delta_seconds;
 
@@ -64,7 +64,7 @@ std::shared_ptr<SceneState<InGameSceneState_GameOver::ParentSceneClass>> InGameS
 
 void InGameSceneState_GameOver::DrawForeground(ParentSceneClass& parent_scene, const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(parent_scene, canvas_info);
+	InGameSceneState::DrawForeground(parent_scene, canvas_info);
 
 	if (_timer < _fade_start_time)
 	{
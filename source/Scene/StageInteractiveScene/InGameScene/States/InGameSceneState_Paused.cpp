@@ -10,7 +10,7 @@ namespace {
 
 void InGameSceneState_Paused::OnEnterState(ParentSceneClass& parent_scene)
 {
-	__super::OnEnterState(parent_scene);
+	InGameSceneState::OnEnterState(parent_scene);
 
 	parent_scene.SetWorldTimerActive(false);
 
@@ -21,7 +21,7 @@ void InGameSceneState_Paused::OnEnterState(ParentSceneClass& parent_scene)
 
 void InGameSceneState_Paused::OnLeaveState(ParentSceneClass& parent_scene)
 {
-	__super::OnLeaveState(parent_scene);
+	InGameSceneState::OnLeaveState(parent_scene);
 
 	parent_scene.SetWorldTimerActive(true);
 
@@ -37,7 +37,7 @@ void InGameSceneState_Paused::OnLeaveState(ParentSceneClass& parent_scene)
 
 std::shared_ptr<SceneState<InGameSceneState_Paused::ParentSceneClass>> InGameSceneState_Paused::Tick(ParentSceneClass& parent_scene, float delta_seconds)
 {
-	auto ret = __super::Tick(parent_scene, delta_seconds);
+	auto ret = InGameSceneState::Tick(parent_scene, delta_seconds);
 
 	ImGuiWindowFlags flags = ImGuiWindowFlags_None;
 	flags |= ImGuiWindowFlags_NoResize;
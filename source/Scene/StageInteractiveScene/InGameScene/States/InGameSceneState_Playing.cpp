@@ -16,7 +16,7 @@ InGameSceneState_Playing::InGameSceneState_Playing()
 
 void InGameSceneState_Playing::OnEnterState(ParentSceneClass& parent_scene)
 {
-	__super::OnEnterState(parent_scene);
+	InGameSceneState::OnEnterState(parent_scene);
 
 	_spinner_icons.clear();
 	for (MasterDataID i = SPINNER_ICONS_ID_BEGIN; i < SPINNER_ICONS_ID_BEGIN + SPINNER_ICONS_ID_NUM; ++i)
@@ -24,6 +24,8 @@ void InGameSceneState_Playing::OnEnterState(ParentSceneClass& parent_scene)
 		_spinner_icons.push_back(MasterHelper::GetGameIconHandleForDxLib(i));
 	}
 
+	_last_player_render_position = parent_scene.GetPlayerRef()->GetActorRenderPosition();
+
 	parent_scene.GetPlayerRef()->character_events.OnDead.Bind(
 			[&](const CharacterDeathInfo* death_info) 
 			{
@@ -54,12 +56,12 @@ void InGameSceneState_Playing::OnLeaveState(ParentSceneClass& parent_scene)
 		player->character_events.OnDead.UnBind(this);
 		player->player_events.OnPlayerReachedGoal.UnBind(this);
 	}
-	__super::OnLeaveState(parent_scene);
+	InGameSceneState::OnLeaveState(parent_scene);
 }
 
 std::shared_ptr<SceneState<InGameSceneState_Playing::ParentSceneClass>> InGameSceneState_Playing::Tick(ParentSceneClass& parent_scene, float delta_seconds)
 {
-	auto ret = __super::Tick(parent_scene, delta_seconds);
+	auto ret = InGameSceneState::Tick(parent_scene, delta_seconds);
 
 	if (!parent_scene._is_timer_stopped)
 	{
@@ -80,7 +82,7 @@ std::shared_ptr<SceneState<InGameSceneState_Playing::ParentSceneClass>> InGameSc
 
 void InGameSceneState_Playing::DrawForeground(ParentSceneClass& parent_scene, const CanvasInfo& canvas_info)
 {
-	__super::DrawForeground(parent_scene, canvas_info);
+	InGameSceneState::DrawForeground(parent_scene, canvas_info);
 
 	// 残り時間
 	TCHAR time_string[32];
@@ -129,8 +131,10 @@ void InGameSceneState_Playing::DrawForeground(ParentSceneClass& parent_scene, co
 
 void InGameSceneState_Playing::UpdateCameraParams(ParentSceneClass& parent_scene, const float delta_seconds)
 {
-	const Vector2D delta_player_position = parent_scene.GetPlayerRef()->GetDeltaPosition();
-	const Vector2D player_world_pos = parent_scene.GetPlayerRef()->GetActorWorldPosition();
+	// NOTE: 描画の補間で滑らかに動くように, プレイヤーの描画位置に追従する
+	const Vector2D player_world_pos = parent_scene.GetPlayerRef()->GetActorRenderPosition();
+	const Vector2D delta_player_position = player_world_pos - _last_player_render_position;
+	_last_player_render_position = player_world_pos;
 
 	CameraParams& camera_params = parent_scene._camera_params;
 
@@ -160,7 +164,7 @@ void InGameSceneState_Playing::UpdateCameraParams(ParentSceneClass& parent_scene
 	{
 		constexpr float TOP_LIMIT = -1 + 1.f / 3.f;
 		constexpr float BOTTOM_LIMIT = 0;
-		const Vector2D player_pos_screen = camera_params.TransformPosition_WorldToScreen(parent_scene.GetPlayerRef()->GetActorWorldPosition());
+		const Vector2D player_pos_screen = camera_params.TransformPosition_WorldToScreen(player_world_pos);
 		const float player_screen_x = player_pos_screen.x;
 		const float player_screen_y = player_pos_screen.y;
 		if (player_screen_y < TOP_LIMIT)
@@ -34,4 +34,7 @@ private:
 
 	float _reset_timer;
 	std::vector<int> _spinner_icons;
+
+	// 前フレームのUpdateCameraParams()でのプレイヤーの描画位置. 1フレームに複数ステップ進む場合もあるので, プレイヤーの移動量はフレーム単位でここから求める
+	Vector2D _last_player_render_position;
 };
\ No newline at end of file
@@ -18,7 +18,7 @@ InGameSceneState_StageCleared::InGameSceneState_StageCleared()
 
 void InGameSceneState_StageCleared::OnEnterState(ParentSceneClass& parent_scene)
 {
-	__super::OnEnterState(parent_scene);
+	InGameSceneState::OnEnterState(parent_scene);
 
 	_is_player_goal_sequence_finished = false;
 
@@ -45,7 +45,7 @@ void InGameSceneState_StageCleared::OnEnterState(ParentSceneClass& parent_scene)
 
 void InGameSceneState_StageCleared::OnLeaveState(ParentSceneClass& parent_scene)
 {
-	__super::OnLeaveState(parent_scene);
+	InGameSceneState::OnLeaveState(parent_scene);
 }
 
 void InGameSceneState_StageCleared::DrawForeground(ParentSceneClass& parent_scene, const CanvasInfo& canvas_info)
@@ -55,7 +55,7 @@ void InGameSceneState_StageCleared::DrawForeground(ParentSceneClass& parent_scen
 		return;
 	}
 
-	__super::DrawForeground(parent_scene, canvas_info);
+	InGameSceneState::DrawForeground(parent_scene, canvas_info);
 	const float result_overlay_width = canvas_info.width * 0.9f;
 	const float result_overlay_height = canvas_info.height * 0.9f;
 	const float overlay_color = GetColor(0, 0, 0);
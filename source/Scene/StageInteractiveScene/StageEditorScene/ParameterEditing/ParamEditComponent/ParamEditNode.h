@@ -86,7 +86,8 @@ private:
 	/// <returns>値が確定したか</returns>
 	bool ShowValueUI()
 	{
-		static_assert(false, "ShowValueUI is not implemented for this type");
+		// NOTE: 特殊化の無い型でインスタンス化されたときだけ失敗させるため, テンプレート引数に依存する条件にする
+		static_assert(sizeof(ValueType) == 0, "ShowValueUI is not implemented for this type");
 	}
 
 	std::string name;
@@ -123,10 +124,10 @@ inline bool ParamEditNode<EditParamType::FLOAT>::ShowValueUI()
 
 namespace
 {
-	template<typename T, int N>
+	template<typename T, size_t N>
 	bool ShowArrayValueUI(std::array<T, N>& arr)
 	{
-		const size_t array_size = arr.size();
+		const int array_size = static_cast<int>(arr.size());
 		ImGui::InputScalarN("##", GetImGuiDataType<T>(), arr.data(), array_size);
 		return ImGui::IsItemDeactivatedAfterEdit();
 	}
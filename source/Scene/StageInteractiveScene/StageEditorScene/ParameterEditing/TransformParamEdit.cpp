@@ -0,0 +1,29 @@
+#include "TransformParamEdit.h"
+#include "ParameterEditingInclude.h"
+#include "Utility/Core/Math/Transform.h"
+
+namespace {
+	constexpr const char* LABEL_POSITION = "Position";
+	constexpr const char* LABEL_ROTATION = "Rotation";
+}
+
+void AddTransformToParamEditGroup(Transform& transform, const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history)
+{
+	auto transform_group = std::make_shared<ParamEditGroup>("Transform", 2);
+
+	AddChildParamEditNodeToGroup<EditParamType::FLOAT>(
+		transform_group,
+		command_history,
+		LABEL_ROTATION,
+		transform.rotation
+	);
+
+	AddChildParamEditNodeToGroup<EditParamType::FLOAT2>(
+		transform_group,
+		command_history,
+		LABEL_POSITION,
+		transform.position
+	);
+
+	parent->AddChild(transform_group);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <memory>
+
+struct Transform;
+class ParamEditGroup;
+class CommandHistory;
+
+/// <summary>
+/// Transformの位置と回転を編集するノードをまとめたグループを, parentに追加する
+/// <para>TransformはIEditableParameterを実装しないので, ステージエディタではこの関数を使う</para>
+/// </summary>
+/// <param name="transform">編集対象. グループより長く生存している必要がある</param>
+void AddTransformToParamEditGroup(Transform& transform, const std::shared_ptr<ParamEditGroup>& parent, const std::shared_ptr<CommandHistory>& command_history);
@@ -126,18 +126,22 @@ Actor* StageEditorScene::GetActorAt(const Vector2D& viewport_position) const
 
 	const Vector2D world_position = _camera_params.TransformPosition_ViewportToWorld(viewport_position);
 
-	for (auto& actor : _actors)
-	{
-		std::vector<Vector2D> vertices;
-		actor->GetWorldConvexPolygonVertices(vertices);
-
-		if (GeometricUtility::DoesConvexPolygonContainsPoint(world_position, vertices))
+	// NOTE: _actorsの順序は不定なので, 描画順で最初に見つかったアクターを返す
+	Actor* found_actor = nullptr;
+	ForEachActorInDrawOrder([&world_position, &found_actor](Actor* const actor)
 		{
-			return actor;
-		}
-	}
+			std::vector<Vector2D> vertices;
+			actor->GetWorldConvexPolygonVertices(vertices);
+
+			if (GeometricUtility::DoesConvexPolygonContainsPoint(world_position, vertices))
+			{
+				found_actor = actor;
+				return false;
+			}
+			return true;
+		});
 
-	return nullptr;
+	return found_actor;
 }
 
 bool StageEditorScene::IsMouseOnStage(const Vector2D& mouse_pos) const
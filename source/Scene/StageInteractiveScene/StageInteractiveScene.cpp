@@ -20,7 +20,7 @@ StageInteractiveScene::~StageInteractiveScene()
 
 void StageInteractiveScene::Initialize(const SceneBaseInitialParams* const scene_params)
 {
-	__super::Initialize(scene_params);
+	SceneBase::Initialize(scene_params);
 
 	typedef SceneBase::traits<StageInteractiveScene>::initial_params_type InitialParamsType;
 	const InitialParamsType* const stage_interactive_scene_params = dynamic_cast<const InitialParamsType*>(scene_params);
@@ -43,24 +43,26 @@ void StageInteractiveScene::Initialize(const SceneBaseInitialParams* const scene
 
 SceneType StageInteractiveScene::Tick(const float delta_seconds)
 {
-	const SceneType result_scene_type = __super::Tick(delta_seconds);
-
-	// 衝突判定
-	if (IsWorldTimerActive())
-	{
-		CollisionManager::GetInstance().HandleCollisions();
-	}
+	const SceneType result_scene_type = SceneBase::Tick(delta_seconds);
 
 	return GetSceneType();
 }
 
+void StageInteractiveScene::TickWorldStep(const float step_seconds)
+{
+	SceneBase::TickWorldStep(step_seconds);
+
+	// 衝突判定. アクターの移動と同じく, ステップごとに行う
+	CollisionManager::GetInstance().HandleCollisions();
+}
+
 void StageInteractiveScene::Finalize()
 {
 	actor_spawn_info_map.clear();
 	_stage.reset();
 	_player_ref = nullptr;
 
-	__super::Finalize();
+	SceneBase::Finalize();
 }
 
 std::unique_ptr<const SceneBaseInitialParams> StageInteractiveScene::GetInitialParamsForNextScene(const SceneType next_scene) const
@@ -105,7 +107,7 @@ void StageInteractiveScene::PreDestroyActor(Actor* destroyee)
 {
 	RemoveActorFromStage(destroyee);
 
-	__super::PreDestroyActor(destroyee);
+	SceneBase::PreDestroyActor(destroyee);
 }
 
 void StageInteractiveScene::BuildStage(const Stage& stage)
@@ -118,10 +120,9 @@ void StageInteractiveScene::BuildStage(const Stage& stage)
 
 	CreateActorsInStage();
 
-	// 全Actorの初期化が終了したので空間分割する
-	const Vector2D root_cell_left_top = stage.GetStageLeftTop() - Vector2D(UNIT_TILE_SIZE, UNIT_TILE_SIZE);
-	const Vector2D root_cell_right_bottom = stage.GetStageRightBottom() + Vector2D(UNIT_TILE_SIZE, UNIT_TILE_SIZE);
-	CollisionManager::GetInstance().ConstructKdTree(root_cell_left_top, root_cell_right_bottom);
+	// 全Actorの初期化が終了したので, コライダーをまとめてブロードフェーズに登録する
+	CollisionManager::GetInstance().SetLayerMatrix(MakeStageCollisionLayerMatrix());
+	CollisionManager::GetInstance().ConstructTree();
 
 	// 描画優先度をもとに, アクターをソートする
 	SortActorsByDrawPriority();
@@ -137,6 +138,15 @@ Player* StageInteractiveScene::GetPlayerRef() const
 	return _player_ref;
 }
 
+CollisionLayerMatrix StageInteractiveScene::MakeStageCollisionLayerMatrix()
+{
+	// 全ての組を衝突し得ない状態から始め, CollisionManagerが登録されたコライダーの衝突対象の組を追加する.
+	// 新しいアクターや衝突対象の変更は, 行列を書き換えなくてもそのまま反映される
+	CollisionLayerMatrix layer_matrix;
+	layer_matrix.SetAllLayersCollide(false);
+	return layer_matrix;
+}
+
 std::shared_ptr<SpawnActorInfo> StageInteractiveScene::GetSpawnActorInfo(Actor* actor) const
 {
 	return actor_spawn_info_map.at(actor);
@@ -215,24 +225,36 @@ void StageInteractiveScene::CreateActorsInStage()
 
 	for (const auto& actor_info : _stage->GetSpawnActorInfosRef())
 	{
-		Actor* spawned_actor = CreateAndInitializeActorByEntityType(actor_info->entity_type, actor_info->initial_params.get());
-		if (actor_info->entity_type == EEntityType::Player)
+		if (actor_info->entity_type != EEntityType::Player && ShouldCreateStageActorLazily(*actor_info))
+		{
+			continue;
+		}
+
+		CreateStageActor(actor_info);
+	}
+}
+
+Actor* StageInteractiveScene::CreateStageActor(const std::shared_ptr<SpawnActorInfo>& spawn_info)
+{
+	Actor* spawned_actor = CreateAndInitializeActorByEntityType(spawn_info->entity_type, spawn_info->initial_params.get());
+	if (spawn_info->entity_type == EEntityType::Player)
+	{
+		if (_player_ref != nullptr)
+		{
+			// プレイヤーは1体のみ
+			throw std::runtime_error("Player is already spawned");
+		}
+
+		_player_ref = dynamic_cast<Player*>(spawned_actor);
+
+		if (_player_ref == nullptr)
 		{
-			if (_player_ref != nullptr)
-			{
-				// プレイヤーは1体のみ
-				throw std::runtime_error("Player is already spawned");
-			}
-
-			_player_ref = dynamic_cast<Player*>(spawned_actor);
-
-			if (_player_ref == nullptr)
-			{
-				throw std::runtime_error("Spawned player is invalid");
-			}
+			throw std::runtime_error("Spawned player is invalid");
 		}
-		actor_spawn_info_map[spawned_actor] = actor_info;
 	}
+	actor_spawn_info_map[spawned_actor] = spawn_info;
+
+	return spawned_actor;
 }
 
 void StageInteractiveScene::CreateStagePerimeterColliders()
@@ -3,6 +3,7 @@
 #include "Scene/SceneBase.h"
 #include "Scene/StageInteractiveScene/Stage/Stage.h"
 #include "Scene/StageInteractiveScene/SpawnActorInfo.h"
+#include "GameSystems/Collision/CollisionLayerMatrix.h"
 #include <memory>
 
 class Player;
@@ -21,11 +22,18 @@ public:
 	virtual std::unique_ptr<const SceneBaseInitialParams> GetInitialParamsForNextScene(const SceneType next_scene) const override;
 protected:
 	virtual void PreDestroyActor(Actor* destroyee) override;
+	virtual void TickWorldStep(const float step_seconds) override;
 	//~ End SceneBase interface
 
 	//~ Begin StageInteractiveScene interface
 protected:
 	virtual void BuildStage(const Stage& stage);
+
+	/// <summary>
+	/// trueの場合, BuildStage()ではこのアクターを生成せず, 派生クラスが必要になったときにCreateStageActor()で生成する
+	/// <para>NOTE: プレイヤーはシーンの初期化で参照されるので, 常に最初に生成される</para>
+	/// </summary>
+	virtual bool ShouldCreateStageActorLazily(const SpawnActorInfo& spawn_info) const { return false; }
 	//~ End StageInteractiveScene interface
 
 public:
@@ -48,6 +56,12 @@ public:
 
 	Player* GetPlayerRef() const;
 
+	/// <summary>
+	/// ステージで衝突し得るレイヤーの組. 全ての組を衝突し得ない状態の行列を返し, CollisionManagerが各コライダーの衝突対象の組を追加する
+	/// <para>判定が起こり得ない組(地形同士, アイテム同士など)は追加されないので, ブロードフェーズで探索しない</para>
+	/// </summary>
+	static CollisionLayerMatrix MakeStageCollisionLayerMatrix();
+
 	/// <summary>
 	/// ステージのタイル範囲を取得
 	/// <para>NOTE: タイルインデックス(0,0)のタイルは左上頂点の座標がワールド原点に一致する</para>;
@@ -115,6 +129,16 @@ protected:
 	/// <returns></returns>
 	Stage& GetStageRef() const;
 
+	/// <summary>
+	/// スポーン情報からアクターを生成し, スポーン情報を登録する
+	/// </summary>
+	Actor* CreateStageActor(const std::shared_ptr<SpawnActorInfo>& spawn_info);
+
+	/// <summary>
+	/// スポーン情報が登録されている(生成済みの)アクターとスポーン情報の組
+	/// </summary>
+	const std::unordered_map<Actor*, std::shared_ptr<SpawnActorInfo>>& GetActorSpawnInfoMap() const { return actor_spawn_info_map; }
+
 	/// <summary>
 	/// 指定されたアクターのスポーン情報が登録されているか
 	/// </summary>
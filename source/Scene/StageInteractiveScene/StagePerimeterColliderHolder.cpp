@@ -16,6 +16,10 @@ void StagePerimeterColliderHolder::RequestToSetActorHidden(const bool new_hidden
 
 void StagePerimeterColliderHolder::CreateColliders(const Vector2D& left_top, const Vector2D& right_bottom)
 {
+	// コライダーを持つだけなので更新しない. 動かない
+	SetTickRate(EActorTickRate::Sleep);
+	SetStationary(true);
+
 	// コライダー生成に使用するパラメータ
 	const CollisionObjectType collision_object_type = CollisionObjectType::BARRIER;
 	const float stage_height = right_bottom.y - left_top.y;
@@ -37,6 +41,7 @@ void StagePerimeterColliderHolder::CreateColliders(const Vector2D& left_top, con
 		stage_height + UNIT_TILE_SIZE
 	);
 	left_collider->SetLocalTransform(Vector2D(0.f, stage_height / 2.f), DX_PI_F / 2.f);
+	left_collider->SetMobility(ColliderMobility::STATIC);
 
 	SegmentCollider* right_collider = CreateComponent<SegmentCollider>(this);
 	right_collider->SetSegmentColliderParams(
@@ -47,6 +52,7 @@ void StagePerimeterColliderHolder::CreateColliders(const Vector2D& left_top, con
 		stage_height + UNIT_TILE_SIZE
 	);
 	right_collider->SetLocalTransform(Vector2D(stage_width, stage_height / 2.f), DX_PI_F / 2.f);
+	right_collider->SetMobility(ColliderMobility::STATIC);
 
 	SegmentCollider* top_collider = CreateComponent<SegmentCollider>(this);
 	top_collider->SetSegmentColliderParams(
@@ -57,5 +63,6 @@ void StagePerimeterColliderHolder::CreateColliders(const Vector2D& left_top, con
 		stage_width + UNIT_TILE_SIZE
 	);
 	top_collider->SetLocalTransform(Vector2D(stage_width / 2.f, 0.f), 0.f);
+	top_collider->SetMobility(ColliderMobility::STATIC);
 
 }
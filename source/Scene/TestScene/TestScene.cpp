@@ -99,6 +99,19 @@ void TestScene::CreateTestSceneImpl(const int test_id)
 		SWITCH_CASE(2);
 		SWITCH_CASE(3);
 		SWITCH_CASE(4);
+		SWITCH_CASE(5);
+		SWITCH_CASE(6);
+		SWITCH_CASE(7);
+		SWITCH_CASE(8);
+		SWITCH_CASE(9);
+		SWITCH_CASE(10);
+		SWITCH_CASE(11);
+		SWITCH_CASE(12);
+		SWITCH_CASE(13);
+		SWITCH_CASE(14);
+		SWITCH_CASE(15);
+		SWITCH_CASE(16);
+		SWITCH_CASE(17);
 		// TODO: TestSceneImpl_Nを追加した場合、ここに追記
 	default:
 		throw std::runtime_error("Unknown test id");
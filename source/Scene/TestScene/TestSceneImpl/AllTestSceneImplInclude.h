@@ -2,10 +2,23 @@
 
 #ifndef ALL_TEST_SCENE_IMPL_INCLUDE
 #define ALL_TEST_SCENE_IMPL_INCLUDE
-constexpr int NUM_TEST_SCENE_IMPL = 4;
+constexpr int NUM_TEST_SCENE_IMPL = 17;
 #endif
 
 #include "Scene/TestScene/TestSceneImpl/TestSceneImpl_1.h"
 #include "Scene/TestScene/TestSceneImpl/TestSceneImpl_2.h"
 #include "Scene/TestScene/TestSceneImpl/TestSceneImpl_3.h"
-#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_4.h"
\ No newline at end of file
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_4.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_5.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_6.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_7.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_8.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_9.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_10.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_11.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_12.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_13.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_14.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_15.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_16.h"
+#include "Scene/TestScene/TestSceneImpl/TestSceneImpl_17.h"
\ No newline at end of file
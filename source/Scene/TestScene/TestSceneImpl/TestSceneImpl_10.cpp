@@ -0,0 +1,35 @@
+#include "TestSceneImpl_10.h"
+#include "Utility/Core/Math/GeometryUtilityBatch.h"
+
+TestSceneImpl_10::TestSceneImpl_10()
+{
+}
+
+TestSceneImpl_10::~TestSceneImpl_10()
+{
+}
+
+void TestSceneImpl_10::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+}
+
+SceneType TestSceneImpl_10::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("GeometryBatch");
+	{
+		ImGui::Text("SIMD width %d", GeometricUtilityBatch::GetSimdWidth());
+		ImGui::TextUnformatted("validation: tests/test_geometry_utility_batch");
+		ImGui::TextUnformatted("benchmark: tests/bench_geometry_utility_batch");
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_10::Finalize()
+{
+	__super::Finalize();
+}
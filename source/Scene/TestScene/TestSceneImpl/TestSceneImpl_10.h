@@ -0,0 +1,20 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// GeometricUtilityBatchのビルド設定を表示する
+/// <para>バッチ版とスカラー版の比較とベンチマークは, tests/のtest_geometry_utility_batchとbench_geometry_utility_batchで実行する</para>
+/// </summary>
+class TestSceneImpl_10 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_10();
+	virtual ~TestSceneImpl_10();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+};
@@ -0,0 +1,276 @@
+#include "TestSceneImpl_11.h"
+#include "Actor/Actor.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <sstream>
+
+namespace
+{
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+
+	/// <summary>
+	/// 以前のSceneBase::SortActorsByDrawPriority()と同じ比較
+	/// </summary>
+	bool LegacyCompareDrawOrder(const Actor* obj1, const Actor* obj2)
+	{
+		if (obj1->GetDrawPriority() != obj2->GetDrawPriority())
+		{
+			return obj1->GetDrawPriority() < obj2->GetDrawPriority();
+		}
+		return obj1->GetActorWorldPosition().y > obj2->GetActorWorldPosition().y;
+	}
+
+	/// <summary>
+	/// 以前のSceneBaseと同じく, 1つずつstd::findで探してvector::eraseで除外する
+	/// </summary>
+	void LegacyRemoveActors(std::vector<Actor*>& legacy_actors, const std::vector<Actor*>& actors_to_remove)
+	{
+		for (Actor* const actor : actors_to_remove)
+		{
+			auto it = std::find(legacy_actors.begin(), legacy_actors.end(), actor);
+			if (it != legacy_actors.end())
+			{
+				legacy_actors.erase(it);
+			}
+		}
+	}
+}
+
+TestSceneImpl_11::TestSceneImpl_11()
+	: _seed(12345)
+	, _num_actors(5000)
+	, _num_draw_priorities(8)
+	, _is_running_benchmark(false)
+{
+}
+
+TestSceneImpl_11::~TestSceneImpl_11()
+{
+}
+
+void TestSceneImpl_11::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+}
+
+SceneType TestSceneImpl_11::Tick(float delta_seconds)
+{
+	if (_is_running_benchmark)
+	{
+		return GetSceneType();
+	}
+
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("ActorRegistry");
+	{
+		ImGui::InputInt("seed", &_seed);
+		ImGui::SliderInt("actors", &_num_actors, 100, 50000);
+		ImGui::SliderInt("draw priorities", &_num_draw_priorities, 1, 64);
+		if (ImGui::Button("Run benchmark"))
+		{
+			RunBenchmark();
+		}
+
+		ImGui::TextUnformatted(_status.c_str());
+		for (const BenchmarkResult& result : _benchmark_results)
+		{
+			ImGui::Text(
+				"%-32s registry %9.3f ms  legacy %9.3f ms  (x%.1f)",
+				result.operation_name,
+				result.registry_ms,
+				result.legacy_ms,
+				result.registry_ms > 0.0 ? result.legacy_ms / result.registry_ms : 0.0
+			);
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_11::Finalize()
+{
+	__super::Finalize();
+}
+
+void TestSceneImpl_11::RunBenchmark()
+{
+	_benchmark_results.clear();
+	_is_running_benchmark = true;
+
+	std::mt19937 engine(static_cast<uint32_t>(_seed));
+
+	// 既存のアクターは移動している可能性があるので, 並べ直してから数える
+	SortActorsByDrawPriority();
+	int num_actors_before = 0;
+	bool is_order_valid = VerifyDrawOrder(num_actors_before);
+
+	std::vector<Actor*> actors;
+	int num_actors_in_draw_order = 0;
+
+	// 追加
+	{
+		BenchmarkResult result{};
+		result.operation_name = "add";
+
+		SpawnBenchActors(actors);
+		auto begin = std::chrono::high_resolution_clock::now();
+		ExecuteTick(0.f);
+		PrepareDrawOrder();
+		result.registry_ms = GetElapsedMilliseconds(begin);
+
+		std::vector<Actor*> legacy_actors;
+		begin = std::chrono::high_resolution_clock::now();
+		for (Actor* const actor : actors)
+		{
+			legacy_actors.push_back(actor);
+		}
+		std::sort(legacy_actors.begin(), legacy_actors.end(), LegacyCompareDrawOrder);
+		result.legacy_ms = GetElapsedMilliseconds(begin);
+
+		_benchmark_results.push_back(result);
+		is_order_valid &= VerifyDrawOrder(num_actors_in_draw_order);
+	}
+
+	// 1%のアクターの描画優先度を変更
+	{
+		BenchmarkResult result{};
+		result.operation_name = "change draw priority (1%)";
+
+		std::vector<Actor*> changed_actors = actors;
+		std::shuffle(changed_actors.begin(), changed_actors.end(), engine);
+		changed_actors.resize(std::max<size_t>(1, actors.size() / 100));
+
+		auto begin = std::chrono::high_resolution_clock::now();
+		for (Actor* const actor : changed_actors)
+		{
+			actor->SetDrawPriority((actor->GetDrawPriority() + 1) % _num_draw_priorities);
+		}
+		PrepareDrawOrder();
+		result.registry_ms = GetElapsedMilliseconds(begin);
+
+		std::vector<Actor*> legacy_actors = actors;
+		begin = std::chrono::high_resolution_clock::now();
+		std::sort(legacy_actors.begin(), legacy_actors.end(), LegacyCompareDrawOrder);
+		result.legacy_ms = GetElapsedMilliseconds(begin);
+
+		_benchmark_results.push_back(result);
+		is_order_valid &= VerifyDrawOrder(num_actors_in_draw_order);
+	}
+
+	// 半分のアクターをシーンから除外して, 戻す
+	{
+		BenchmarkResult result{};
+		result.operation_name = "remove half, then add back";
+
+		std::vector<Actor*> removed_actors(actors.begin(), actors.begin() + actors.size() / 2);
+		std::shuffle(removed_actors.begin(), removed_actors.end(), engine);
+
+		auto begin = std::chrono::high_resolution_clock::now();
+		for (Actor* const actor : removed_actors)
+		{
+			RemoveActor(actor);
+		}
+		ExecuteTick(0.f);
+		for (Actor* const actor : removed_actors)
+		{
+			AddActor(actor);
+		}
+		ExecuteTick(0.f);
+		PrepareDrawOrder();
+		result.registry_ms = GetElapsedMilliseconds(begin);
+
+		std::vector<Actor*> legacy_actors = actors;
+		begin = std::chrono::high_resolution_clock::now();
+		LegacyRemoveActors(legacy_actors, removed_actors);
+		std::sort(legacy_actors.begin(), legacy_actors.end(), LegacyCompareDrawOrder);
+		legacy_actors.insert(legacy_actors.end(), removed_actors.begin(), removed_actors.end());
+		std::sort(legacy_actors.begin(), legacy_actors.end(), LegacyCompareDrawOrder);
+		result.legacy_ms = GetElapsedMilliseconds(begin);
+
+		_benchmark_results.push_back(result);
+		is_order_valid &= VerifyDrawOrder(num_actors_in_draw_order);
+	}
+
+	// 全アクターをまとめて破棄
+	{
+		BenchmarkResult result{};
+		result.operation_name = "destroy all";
+
+		std::vector<Actor*> destroyed_actors = actors;
+		std::shuffle(destroyed_actors.begin(), destroyed_actors.end(), engine);
+
+		// 破棄した後はアクターに触れられないので, 以前の実装を先に計測する
+		std::vector<Actor*> legacy_actors = actors;
+		auto begin = std::chrono::high_resolution_clock::now();
+		LegacyRemoveActors(legacy_actors, destroyed_actors);
+		result.legacy_ms = GetElapsedMilliseconds(begin);
+
+		begin = std::chrono::high_resolution_clock::now();
+		for (Actor* const actor : destroyed_actors)
+		{
+			actor->MarkAsShouldDestroy();
+		}
+		ExecuteTick(0.f);
+		PrepareDrawOrder();
+		result.registry_ms = GetElapsedMilliseconds(begin);
+
+		_benchmark_results.push_back(result);
+		actors.clear();
+	}
+
+	int num_actors_after = 0;
+	is_order_valid &= VerifyDrawOrder(num_actors_after);
+
+	_is_running_benchmark = false;
+
+	const bool is_count_valid = num_actors_in_draw_order == num_actors_before + _num_actors && num_actors_after == num_actors_before;
+	std::ostringstream oss;
+	oss << (is_order_valid && is_count_valid ? "PASSED" : "FAILED")
+		<< ": " << _num_actors << " actors, " << _num_draw_priorities << " draw priorities"
+		<< ", draw order " << num_actors_in_draw_order << " -> " << num_actors_after << " actors";
+	_status = oss.str();
+}
+
+void TestSceneImpl_11::SpawnBenchActors(std::vector<Actor*>& out_actors)
+{
+	std::mt19937 engine(static_cast<uint32_t>(_seed));
+	std::uniform_real_distribution<float> position_distribution(0.f, 2000.f);
+	std::uniform_int_distribution<int> priority_distribution(0, _num_draw_priorities - 1);
+
+	out_actors.reserve(_num_actors);
+	for (int i = 0; i < _num_actors; i++)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = Vector2D(position_distribution(engine), position_distribution(engine));
+
+		Actor* actor = CreateActor<Actor>(&actor_params);
+		actor->SetDrawPriority(priority_distribution(engine));
+		out_actors.push_back(actor);
+	}
+}
+
+bool TestSceneImpl_11::VerifyDrawOrder(int& out_num_actors) const
+{
+	bool is_valid = true;
+	const Actor* last_actor = nullptr;
+	out_num_actors = 0;
+
+	ForEachActorInDrawOrder([&is_valid, &last_actor, &out_num_actors](Actor* const actor)
+		{
+			if (last_actor && LegacyCompareDrawOrder(actor, last_actor))
+			{
+				is_valid = false;
+			}
+			last_actor = actor;
+			out_num_actors++;
+			return true;
+		});
+
+	return is_valid;
+}
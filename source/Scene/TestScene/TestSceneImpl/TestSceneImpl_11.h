@@ -0,0 +1,53 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include <string>
+
+/// <summary>
+/// SceneBaseのアクター登録(_actors, 描画順)のベンチマーク
+/// <para>num_actors個のアクターをシーンに追加し, 描画優先度の変更, まとめての除外と破棄にかかる時間を計測する</para>
+/// <para>比較用に, 以前の実装(std::findとvector::eraseによる除外, 変更のたびに全アクターをソート)を同じアクターの配列で再現して計測する</para>
+/// </summary>
+class TestSceneImpl_11 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_11();
+	virtual ~TestSceneImpl_11();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	struct BenchmarkResult
+	{
+		const char* operation_name;
+		double registry_ms;
+		double legacy_ms;
+	};
+
+	void RunBenchmark();
+
+	/// <summary>
+	/// ベンチマーク用のアクターを生成し, シーンに追加する
+	/// </summary>
+	void SpawnBenchActors(std::vector<class Actor*>& out_actors);
+
+	/// <summary>
+	/// 描画順に並んだアクターの数を数え, 描画優先度とY座標の順序が正しいか確認する
+	/// </summary>
+	bool VerifyDrawOrder(int& out_num_actors) const;
+
+	// 設定値
+	int _seed;
+	int _num_actors;
+	int _num_draw_priorities;
+
+	// ベンチマーク中はExecuteTick()から呼ばれるTick()でImGuiの表示をしない
+	bool _is_running_benchmark;
+
+	std::string _status;
+	std::vector<BenchmarkResult> _benchmark_results;
+};
@@ -0,0 +1,188 @@
+#include "TestSceneImpl_12.h"
+#include "Actor/Actor.h"
+#include <random>
+
+namespace
+{
+	constexpr float BODY_RADIUS = 8.f;
+	constexpr float MIN_BODY_SPEED = 200.f;
+	constexpr float MAX_BODY_SPEED = 1200.f;
+	constexpr size_t STEPS_HISTORY_SIZE = 120;
+}
+
+TestSceneImpl_12::TestSceneImpl_12()
+	: _num_bodies(64)
+	, _steps_per_second(static_cast<int>(SimulationClock::DEFAULT_STEPS_PER_SECOND))
+	, _max_steps_per_frame(SimulationClock::DEFAULT_MAX_STEPS_PER_FRAME)
+	, _is_fixed_step_enabled(true)
+	, _hitch_ms(100)
+	, _should_draw_last_step_positions(false)
+	, _is_hitch_requested(false)
+	, _is_flushing_actors(false)
+{
+}
+
+TestSceneImpl_12::~TestSceneImpl_12()
+{
+}
+
+void TestSceneImpl_12::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	const Vector2D half_extent = _camera_params.GetWorldViewHalfExtent();
+	_area = FRectAA(_camera_params.world_offset - half_extent * 0.9f, _camera_params.world_offset + half_extent * 0.9f);
+
+	ApplyClockSettings();
+	SpawnBodies();
+}
+
+SceneType TestSceneImpl_12::Tick(float delta_seconds)
+{
+	if (_is_flushing_actors)
+	{
+		return GetSceneType();
+	}
+
+	// 次のフレームの経過時間が_hitch_msだけ伸びる
+	if (_is_hitch_requested)
+	{
+		Sleep(_hitch_ms);
+		_is_hitch_requested = false;
+	}
+
+	SceneType ret = __super::Tick(delta_seconds);
+
+	const SimulationClock& clock = GetSimulationClock();
+	const SimulationClock::ClockStats& clock_stats = clock.GetStats();
+	_steps_history.push_back(static_cast<float>(clock_stats.num_steps_last_frame));
+	if (_steps_history.size() > STEPS_HISTORY_SIZE)
+	{
+		_steps_history.pop_front();
+	}
+
+	ImGui::Begin("SimulationClock");
+	{
+		bool should_apply_settings = false;
+		should_apply_settings |= ImGui::Checkbox("fixed step", &_is_fixed_step_enabled);
+		should_apply_settings |= ImGui::SliderInt("steps per second", &_steps_per_second, 10, 480);
+		should_apply_settings |= ImGui::SliderInt("max steps per frame", &_max_steps_per_frame, 1, 32);
+		if (should_apply_settings)
+		{
+			ApplyClockSettings();
+		}
+
+		ImGui::SliderInt("bodies", &_num_bodies, 1, 1024);
+		if (ImGui::Button("Respawn"))
+		{
+			SpawnBodies();
+		}
+
+		ImGui::SliderInt("hitch [ms]", &_hitch_ms, 10, 1000);
+		if (ImGui::Button("Hitch"))
+		{
+			_is_hitch_requested = true;
+		}
+
+		ImGui::Checkbox("draw last step positions", &_should_draw_last_step_positions);
+
+		ImGui::Separator();
+		const std::vector<float> steps_history(_steps_history.begin(), _steps_history.end());
+		ImGui::PlotHistogram("steps", steps_history.data(), static_cast<int>(steps_history.size()), 0, nullptr, 0.f, static_cast<float>(_max_steps_per_frame), ImVec2(0, 60));
+		ImGui::Text("steps last frame %d / alpha %.3f / total steps %llu", clock_stats.num_steps_last_frame, clock.GetInterpolationAlpha(), clock_stats.num_total_steps);
+		ImGui::Text("frames without step %d / capped frames %d / dropped %.3f s", clock_stats.num_frames_without_step, clock_stats.num_capped_frames, clock_stats.dropped_seconds);
+		ImGui::Text("simulation %.3f ms", GetFrameCostStats().simulation_ms);
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_12::Draw()
+{
+	__super::Draw();
+
+	for (const Body& body : _bodies)
+	{
+		const Vector2D render_position = _camera_params.TransformPosition_WorldToViewport(body.actor->GetActorRenderPosition());
+		DxLib::DrawCircleAA(render_position.x, render_position.y, BODY_RADIUS, 16, 0x00FF00, TRUE);
+
+		if (_should_draw_last_step_positions)
+		{
+			const Vector2D last_step_position = _camera_params.TransformPosition_WorldToViewport(body.actor->GetActorWorldPosition());
+			DxLib::DrawCircleAA(last_step_position.x, last_step_position.y, BODY_RADIUS, 16, 0xFF0000, FALSE);
+		}
+	}
+}
+
+void TestSceneImpl_12::Finalize()
+{
+	// アクターはSceneBase::Finalize()で破棄される
+	_bodies.clear();
+	_steps_history.clear();
+
+	__super::Finalize();
+}
+
+void TestSceneImpl_12::TickWorldStep(const float step_seconds)
+{
+	__super::TickWorldStep(step_seconds);
+
+	for (Body& body : _bodies)
+	{
+		Vector2D position = body.actor->GetActorWorldPosition() + body.velocity * step_seconds;
+
+		// 領域の端で跳ね返る
+		if (position.x < _area.left_top.x || position.x > _area.right_bottom.x)
+		{
+			body.velocity.x = -body.velocity.x;
+			position.x = clamp(position.x, _area.left_top.x, _area.right_bottom.x);
+		}
+		if (position.y < _area.left_top.y || position.y > _area.right_bottom.y)
+		{
+			body.velocity.y = -body.velocity.y;
+			position.y = clamp(position.y, _area.left_top.y, _area.right_bottom.y);
+		}
+
+		body.actor->SetActorWorldPosition(position);
+	}
+}
+
+void TestSceneImpl_12::SpawnBodies()
+{
+	for (Body& body : _bodies)
+	{
+		body.actor->MarkAsShouldDestroy();
+	}
+	_bodies.clear();
+
+	std::mt19937 engine(12345u);
+	std::uniform_real_distribution<float> x_distribution(_area.left_top.x, _area.right_bottom.x);
+	std::uniform_real_distribution<float> y_distribution(_area.left_top.y, _area.right_bottom.y);
+	std::uniform_real_distribution<float> speed_distribution(MIN_BODY_SPEED, MAX_BODY_SPEED);
+	std::uniform_real_distribution<float> angle_distribution(0.f, CLN2D_TWO_PI);
+
+	for (int i = 0; i < _num_bodies; i++)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = Vector2D(x_distribution(engine), y_distribution(engine));
+
+		Body body;
+		body.actor = CreateActor<Actor>(&actor_params);
+		body.velocity = Vector2D::Rotate(Vector2D(speed_distribution(engine), 0.f), angle_distribution(engine));
+		_bodies.push_back(body);
+	}
+
+	// 破棄と追加を反映する
+	_is_flushing_actors = true;
+	ExecuteTick(0.f);
+	_is_flushing_actors = false;
+}
+
+void TestSceneImpl_12::ApplyClockSettings()
+{
+	SimulationClock& clock = GetSimulationClock();
+	clock.SetFixedStepEnabled(_is_fixed_step_enabled);
+	clock.SetStepsPerSecond(static_cast<float>(_steps_per_second));
+	clock.SetMaxStepsPerFrame(_max_steps_per_frame);
+}
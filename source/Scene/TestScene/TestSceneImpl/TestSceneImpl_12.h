@@ -0,0 +1,54 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include <deque>
+
+/// <summary>
+/// 固定ステップでのワールド更新と描画の補間の確認
+/// <para>画面内を等速で跳ね回るアクターを, TickWorldStep()で動かす. 描画は補間した位置(塗りつぶし)と, 最後のステップの位置(枠線)で行う</para>
+/// <para>ヒッチを起こすボタンで, 1フレームのステップ数の上限と捨てられる時間を確認できる</para>
+/// </summary>
+class TestSceneImpl_12 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_12();
+	virtual ~TestSceneImpl_12();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Draw() override;
+	virtual void Finalize() override;
+protected:
+	virtual void TickWorldStep(const float step_seconds) override;
+	// End SceneBase interface
+
+private:
+	struct Body
+	{
+		class Actor* actor;
+		Vector2D velocity;
+	};
+
+	void SpawnBodies();
+	void ApplyClockSettings();
+
+	// 設定値
+	int _num_bodies;
+	int _steps_per_second;
+	int _max_steps_per_frame;
+	bool _is_fixed_step_enabled;
+	int _hitch_ms;
+	bool _should_draw_last_step_positions;
+
+	bool _is_hitch_requested;
+
+	// SpawnBodies()でアクターをシーンに追加するためにExecuteTick()を呼ぶ間は, Tick()で何もしない
+	bool _is_flushing_actors;
+
+	std::vector<Body> _bodies;
+	FRectAA _area;
+
+	// 直近のフレームのステップ数
+	std::deque<float> _steps_history;
+};
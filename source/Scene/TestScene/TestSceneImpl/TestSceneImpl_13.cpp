@@ -0,0 +1,35 @@
+#include "TestSceneImpl_13.h"
+#include "GameSystems/ParticleManager/CpuParticleSimulator.h"
+
+TestSceneImpl_13::TestSceneImpl_13()
+{
+}
+
+TestSceneImpl_13::~TestSceneImpl_13()
+{
+}
+
+void TestSceneImpl_13::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+}
+
+SceneType TestSceneImpl_13::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("CpuParticleSimulator");
+	{
+		ImGui::Text("SIMD width %d", CpuParticleSimulator::GetSimdWidth());
+		ImGui::TextUnformatted("validation: tests/test_cpu_particle_simulator");
+		ImGui::TextUnformatted("benchmark: tests/bench_cpu_particle_simulator");
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_13::Finalize()
+{
+	__super::Finalize();
+}
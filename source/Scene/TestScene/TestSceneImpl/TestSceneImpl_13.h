@@ -0,0 +1,20 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// CpuParticleSimulatorのビルド設定を表示する
+/// <para>参照実装との比較とベンチマークは, tests/のtest_cpu_particle_simulatorとbench_cpu_particle_simulatorで実行する</para>
+/// </summary>
+class TestSceneImpl_13 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_13();
+	virtual ~TestSceneImpl_13();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+};
@@ -0,0 +1,35 @@
+#include "TestSceneImpl_14.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+
+TestSceneImpl_14::TestSceneImpl_14()
+{
+}
+
+TestSceneImpl_14::~TestSceneImpl_14()
+{
+}
+
+void TestSceneImpl_14::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+}
+
+SceneType TestSceneImpl_14::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("ParticleDrawLists");
+	{
+		ImGui::Text("%u slots, %u blend modes", MAX_PARTICLES_NUM, static_cast<uint32_t>(EnumInfo<EBlendMode>::List().size()));
+		ImGui::TextUnformatted("validation: tests/test_particle_draw_lists");
+		ImGui::TextUnformatted("benchmark: tests/bench_particle_draw_lists");
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_14::Finalize()
+{
+	__super::Finalize();
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// ParticleDrawListsが扱うスロット数とブレンドモード数を表示する
+/// <para>総当たりとの比較とベンチマークは, tests/のtest_particle_draw_listsとbench_particle_draw_listsで実行する</para>
+/// </summary>
+class TestSceneImpl_14 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_14();
+	virtual ~TestSceneImpl_14();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+};
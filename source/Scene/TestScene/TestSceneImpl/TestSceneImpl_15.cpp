@@ -0,0 +1,76 @@
+#include "TestSceneImpl_15.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "GameSystems/ParticleManager/ParticleManager.h"
+#include <fstream>
+
+namespace
+{
+	constexpr MasterDataID PARTICLE_ID = 1;
+
+	/// <summary>
+	/// index番目のエミッターの位置と向き. 画面上に格子状に並べる
+	/// </summary>
+	Transform GetEmitterTransform(const int index)
+	{
+		constexpr int NUM_COLUMNS = 16;
+		const float x = 80.f + 70.f * static_cast<float>(index % NUM_COLUMNS);
+		const float y = 120.f + 70.f * static_cast<float>(index / NUM_COLUMNS % 8);
+		return Transform(Vector2D(x, y), -0.5f * DX_PI_F + 0.1f * static_cast<float>(index % 7));
+	}
+}
+
+TestSceneImpl_15::TestSceneImpl_15()
+	: _is_emitting(false)
+	, _num_emitters(64)
+	, _num_particles_per_emitter(4)
+{
+}
+
+TestSceneImpl_15::~TestSceneImpl_15()
+{
+}
+
+void TestSceneImpl_15::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	const std::string PARTICLES_DIR = "resources/particles/";
+	std::ifstream json_file(PARTICLES_DIR + MdParticle::Get(PARTICLE_ID).json_name);
+	_spawn_desc.FromJsonObject(nlohmann::json::parse(json_file));
+}
+
+SceneType TestSceneImpl_15::Tick(float delta_seconds)
+{
+	// NOTE: 要求はワールドの更新の前に追加し, このフレームのParticleManager::Tick()でまとめて生成させる
+	if (_is_emitting)
+	{
+		ParticleManager& manager = ParticleManager::GetInstance();
+		for (int i = 0; i < _num_emitters; i++)
+		{
+			_spawn_desc.world_transform = GetEmitterTransform(i);
+			manager.Spawn(_spawn_desc, _num_particles_per_emitter);
+		}
+	}
+
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("ParticleSpawnQueue");
+	{
+		ImGui::Text("Spawn");
+		ImGui::Checkbox("emit", &_is_emitting);
+		ImGui::SliderInt("emitters", &_num_emitters, 1, 1024);
+		ImGui::SliderInt("particles per emitter", &_num_particles_per_emitter, 1, 64);
+
+		const ParticleSpawnStats& stats = GetFrameCostStats().particle_spawn;
+		ImGui::Text("requests %u (dropped %u)  particles %u (dropped %u)  submits %u", stats.num_requests, stats.num_dropped_requests, stats.num_particles, stats.num_dropped_particles, stats.num_submits);
+		ImGui::Text("generate %.3f ms  submit %.3f ms  pool %u", stats.generate_ms, stats.submit_ms, ParticleManager::GetInstance().GetPoolCount());
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_15::Finalize()
+{
+	__super::Finalize();
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include "GameSystems/ParticleManager/Particle/ParticleSpawnDesc.h"
+
+/// <summary>
+/// ParticleSpawnQueueの動作確認
+/// <para>生成: 複数のエミッターの分の要求をParticleManager::Spawn()で毎フレーム追加し, フレームごとの生成の統計を表示する</para>
+/// <para>検証とベンチマークは, tests/のtest_particle_spawn_queueとbench_particle_spawn_queueで実行する</para>
+/// </summary>
+class TestSceneImpl_15 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_15();
+	virtual ~TestSceneImpl_15();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	ParticleSpawnDesc _spawn_desc;
+
+	// 設定値
+	bool _is_emitting;
+	int _num_emitters;
+	int _num_particles_per_emitter;
+};
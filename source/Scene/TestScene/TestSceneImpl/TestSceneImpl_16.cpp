@@ -0,0 +1,223 @@
+#include "TestSceneImpl_16.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "GameSystems/ParticleManager/ParticleManager.h"
+#include <random>
+#include <sstream>
+
+namespace
+{
+	// 不一致をこれ以上表示しない
+	constexpr size_t MAX_VALIDATION_FAILURES = 32;
+
+	uint32_t RandomUint(std::mt19937& engine, const uint32_t min, const uint32_t max)
+	{
+		return std::uniform_int_distribution<uint32_t>(min, max)(engine);
+	}
+
+	/// <summary>
+	/// 同じページの2つの配置の間にpadding以上の隙間があるか
+	/// </summary>
+	bool IsSeparated(const SpriteAtlasEntry& a, const SpriteAtlasEntry& b, const uint32_t padding)
+	{
+		return a.page != b.page
+			|| a.x + a.width + padding <= b.x || b.x + b.width + padding <= a.x
+			|| a.y + a.height + padding <= b.y || b.y + b.height + padding <= a.y;
+	}
+
+	/// <summary>
+	/// ページの端との間にpadding以上の隙間があるか
+	/// </summary>
+	bool IsInPage(const SpriteAtlasLayout& layout, const SpriteAtlasEntry& entry)
+	{
+		const uint32_t padding = layout.GetPadding();
+		return entry.page < layout.GetNumPages()
+			&& entry.x >= padding && entry.y >= padding
+			&& entry.x + entry.width + padding <= layout.GetPageWidth()
+			&& entry.y + entry.height + padding <= layout.GetPageHeight();
+	}
+
+	bool IsSamePlacement(const SpriteAtlasEntry& a, const SpriteAtlasEntry& b)
+	{
+		return a.sprite_id == b.sprite_id && a.index == b.index && a.page == b.page
+			&& a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+	}
+}
+
+TestSceneImpl_16::TestSceneImpl_16()
+	: _sprite_sheet_layout(PARTICLE_ATLAS_PAGE_SIZE, PARTICLE_ATLAS_PAGE_SIZE, MAX_PARTICLE_ATLAS_PAGES, MAX_TEXTURES_NUM, PARTICLE_ATLAS_PADDING)
+	, _seed(12345)
+	, _num_validation_iterations(200)
+	, _page_size(1024)
+	, _max_pages(4)
+	, _padding(2)
+	, _max_sprite_size(384)
+{
+}
+
+TestSceneImpl_16::~TestSceneImpl_16()
+{
+}
+
+void TestSceneImpl_16::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	// 全てのスプライトシートをParticleManagerと同じ設定で置く. テクスチャは読み込まない
+	for (const MdSpriteSheet& sprite_sheet : MdSpriteSheet::GetData())
+	{
+		const MdImageFile& image_file = MasterHelper::GetImageFile(sprite_sheet);
+		_sprite_sheet_layout.Add(sprite_sheet.id, static_cast<uint32_t>(image_file.width), static_cast<uint32_t>(image_file.height));
+	}
+}
+
+SceneType TestSceneImpl_16::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("SpriteAtlas");
+	{
+		ImGui::Text("Resident");
+		const SpriteAtlasStats stats = ParticleManager::GetInstance().GetSpriteAtlasStats();
+		ImGui::Text("sprites %u  pages %u / %u allocated  resident %llu KB  occupancy %.1f%%", stats.num_sprites, stats.num_pages, stats.num_allocated_pages, stats.resident_bytes >> 10, stats.occupancy * 100.f);
+		ImGui::Text("decodes %u  page grows %u  load %.3f ms", stats.num_decodes, stats.num_page_grows, stats.load_ms);
+		if (ImGui::Button("Preload all particle sprites"))
+		{
+			std::vector<MasterDataID> particle_ids;
+			for (const MdParticle& particle : MdParticle::GetData())
+			{
+				particle_ids.push_back(particle.id);
+			}
+
+			// 2回目以降は全て読み込み済みなので, デコード数は増えない
+			ParticleManager::GetInstance().PreloadParticleSprites(particle_ids);
+			const SpriteAtlasStats after = ParticleManager::GetInstance().GetSpriteAtlasStats();
+			std::ostringstream oss;
+			oss << particle_ids.size() << " particles: " << (after.num_decodes - stats.num_decodes) << " decodes, "
+				<< (after.num_sprites - stats.num_sprites) << " new sprites, " << (after.load_ms - stats.load_ms) << " ms";
+			_preload_status = oss.str();
+		}
+		ImGui::TextUnformatted(_preload_status.c_str());
+
+		ImGui::Separator();
+		ImGui::Text("Layout of all sprite sheets (page %u, padding %u)", _sprite_sheet_layout.GetPageWidth(), _sprite_sheet_layout.GetPadding());
+		ImGui::Text("sprites %zu / %zu  pages %u  occupancy %.1f%%", _sprite_sheet_layout.GetEntries().size(), MdSpriteSheet::GetData().size(), _sprite_sheet_layout.GetNumPages(), _sprite_sheet_layout.GetOccupancy() * 100.f);
+		for (const SpriteAtlasEntry& entry : _sprite_sheet_layout.GetEntries())
+		{
+			ImGui::Text("[%2u] sprite %3llu  page %u  (%4u, %4u) %4u x %4u", entry.index, static_cast<unsigned long long>(entry.sprite_id), entry.page, entry.x, entry.y, entry.width, entry.height);
+		}
+
+		ImGui::Separator();
+		ImGui::Text("Validation");
+		ImGui::InputInt("seed", &_seed);
+		ImGui::SliderInt("iterations", &_num_validation_iterations, 1, 2000);
+		ImGui::SliderInt("page size", &_page_size, 64, 4096);
+		ImGui::SliderInt("max pages", &_max_pages, 1, 16);
+		ImGui::SliderInt("padding", &_padding, 0, 8);
+		ImGui::SliderInt("max sprite size", &_max_sprite_size, 1, 4096);
+		if (ImGui::Button("Run validation"))
+		{
+			std::mt19937 engine(static_cast<uint32_t>(_seed));
+			_validation_failures.clear();
+
+			const auto add_failure = [this](const std::string& failure)
+			{
+				if (_validation_failures.size() < MAX_VALIDATION_FAILURES)
+				{
+					_validation_failures.push_back(failure);
+				}
+			};
+
+			const uint32_t page_size = static_cast<uint32_t>(_page_size);
+			const uint32_t padding = static_cast<uint32_t>(_padding);
+			int num_failures = 0;
+			int64_t num_placed = 0;
+			int64_t num_rejected = 0;
+			double total_occupancy = 0.0;
+			std::vector<SpriteAtlasEntry> placed;
+			for (int iteration = 0; iteration < _num_validation_iterations; iteration++)
+			{
+				const std::string prefix = "iteration " + std::to_string(iteration) + ": ";
+				SpriteAtlasLayout layout(page_size, page_size, static_cast<uint32_t>(_max_pages), MAX_TEXTURES_NUM, padding);
+				placed.clear();
+
+				for (uint64_t sprite_id = 1; sprite_id <= MAX_TEXTURES_NUM; sprite_id++)
+				{
+					const uint32_t width = RandomUint(engine, 1, static_cast<uint32_t>(_max_sprite_size));
+					const uint32_t height = RandomUint(engine, 1, static_cast<uint32_t>(_max_sprite_size));
+					const SpriteAtlasEntry* const entry = layout.Add(sprite_id, width, height);
+					if (!entry)
+					{
+						// 置けないのは, ページに収まらない大きさか, ページを使い切ったときだけ
+						const bool is_too_large = width + padding * 2 > page_size || height + padding * 2 > page_size;
+						if (!is_too_large && layout.GetNumPages() < static_cast<uint32_t>(_max_pages))
+						{
+							num_failures++;
+							add_failure(prefix + "sprite " + std::to_string(sprite_id) + " was rejected with free pages");
+						}
+						if (layout.Find(sprite_id))
+						{
+							num_failures++;
+							add_failure(prefix + "rejected sprite " + std::to_string(sprite_id) + " is resident");
+						}
+						num_rejected++;
+						continue;
+					}
+
+					if (entry->width != width || entry->height != height || entry->index != placed.size() || !IsInPage(layout, *entry))
+					{
+						num_failures++;
+						add_failure(prefix + "sprite " + std::to_string(sprite_id) + " is out of page");
+					}
+					for (const SpriteAtlasEntry& other : placed)
+					{
+						if (!IsSeparated(*entry, other, padding))
+						{
+							num_failures++;
+							add_failure(prefix + "sprite " + std::to_string(sprite_id) + " overlaps sprite " + std::to_string(other.sprite_id));
+						}
+					}
+
+					// 追加しても既存の配置は変わらず, 同じスプライトをもう一度追加しても何も変わらない
+					placed.push_back(*entry);
+					if (layout.Add(sprite_id, width + 1, height + 1) != entry)
+					{
+						num_failures++;
+						add_failure(prefix + "sprite " + std::to_string(sprite_id) + " was placed twice");
+					}
+					for (const SpriteAtlasEntry& expected : placed)
+					{
+						const SpriteAtlasEntry* const found = layout.Find(expected.sprite_id);
+						if (!found || !IsSamePlacement(*found, expected))
+						{
+							num_failures++;
+							add_failure(prefix + "sprite " + std::to_string(expected.sprite_id) + " moved after adding sprite " + std::to_string(sprite_id));
+						}
+					}
+				}
+
+				num_placed += static_cast<int64_t>(placed.size());
+				total_occupancy += layout.GetOccupancy();
+			}
+
+			std::ostringstream oss;
+			oss << (num_failures == 0 ? "PASSED" : "FAILED")
+				<< ": " << _num_validation_iterations << " iterations, " << num_placed << " placed, " << num_rejected << " rejected"
+				<< ", average occupancy " << (total_occupancy / _num_validation_iterations * 100.0) << "%"
+				<< ", " << num_failures << " failures";
+			_validation_status = oss.str();
+		}
+		ImGui::TextUnformatted(_validation_status.c_str());
+		for (const std::string& failure : _validation_failures)
+		{
+			ImGui::TextUnformatted(failure.c_str());
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_16::Finalize()
+{
+	__super::Finalize();
+}
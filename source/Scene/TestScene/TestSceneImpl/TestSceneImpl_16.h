@@ -0,0 +1,41 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include "GameSystems/ParticleManager/TextureLoader/SpriteAtlasLayout.h"
+#include <string>
+
+/// <summary>
+/// パーティクルのスプライトアトラスの検証
+/// <para>常駐: ParticleManagerのアトラスの統計を表示し, 全てのパーティクルのスプライトを先読みしても読み込み済みのものが読み直されないことを確かめる</para>
+/// <para>配置: 全てのスプライトシートを実際の設定でSpriteAtlasLayoutに置いた結果を表示する</para>
+/// <para>検証: 乱数の大きさの矩形を追加し続け, 重なりとページからのはみ出しが無く, 追加しても既存の配置が変わらないかを調べる</para>
+/// </summary>
+class TestSceneImpl_16 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_16();
+	virtual ~TestSceneImpl_16();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	// 全てのスプライトシートを置いた配置
+	SpriteAtlasLayout _sprite_sheet_layout;
+
+	std::string _preload_status;
+
+	// 設定値
+	int _seed;
+	int _num_validation_iterations;
+	int _page_size;
+	int _max_pages;
+	int _padding;
+	int _max_sprite_size;
+
+	std::string _validation_status;
+	std::vector<std::string> _validation_failures;
+};
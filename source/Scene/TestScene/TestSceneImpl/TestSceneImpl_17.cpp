@@ -0,0 +1,152 @@
+#include "TestSceneImpl_17.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "GameSystems/Sound/SoundManager.h"
+#include <chrono>
+#include <sstream>
+
+namespace
+{
+	constexpr uint64_t BYTES_PER_MB = 1024 * 1024;
+
+	// インスタンスを作る効果音
+	const std::string TEST_SOUND_FILE = "resources/sounds/se/coin.ogg";
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
+
+TestSceneImpl_17::TestSceneImpl_17()
+	: _graphic_budget_mb(256)
+	, _sound_budget_mb(64)
+	, _num_sound_instances(8)
+{
+}
+
+TestSceneImpl_17::~TestSceneImpl_17()
+{
+}
+
+void TestSceneImpl_17::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	_graphic_budget_mb = static_cast<int>(GraphicResourceManager::GetInstance().GetCacheStats().budget_bytes / BYTES_PER_MB);
+	_sound_budget_mb = static_cast<int>(SoundManager::GetInstance().GetCacheStats().budget_bytes / BYTES_PER_MB);
+}
+
+SceneType TestSceneImpl_17::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	GraphicResourceManager& graphic_resource_manager = GraphicResourceManager::GetInstance();
+	SoundManager& sound_manager = SoundManager::GetInstance();
+
+	ImGui::Begin("AssetCache");
+	{
+		DrawCacheStats("Graphic", graphic_resource_manager.GetCacheStats());
+		if (ImGui::SliderInt("graphic budget (MB)", &_graphic_budget_mb, 0, 1024))
+		{
+			graphic_resource_manager.SetCacheBudget(static_cast<uint64_t>(_graphic_budget_mb) * BYTES_PER_MB);
+		}
+
+		ImGui::Separator();
+		DrawCacheStats("Sound", sound_manager.GetCacheStats());
+		if (ImGui::SliderInt("sound budget (MB)", &_sound_budget_mb, 0, 256))
+		{
+			sound_manager.SetCacheBudget(static_cast<uint64_t>(_sound_budget_mb) * BYTES_PER_MB);
+		}
+
+		ImGui::Separator();
+		ImGui::Text("Reload %zu sprite sheets", MdSpriteSheet::GetData().size());
+		if (ImGui::Button("Cold (unload all)"))
+		{
+			// このシーンで使っている画像も解放されるが, 描画時に取得し直される
+			graphic_resource_manager.UnloadAll();
+			LoadAllSpriteSheets("cold");
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Warm (scene change)"))
+		{
+			// シーンの終了と同じく参照を外してから, 次のシーンとして取得し直す
+			graphic_resource_manager.ReleaseSceneReferences();
+			LoadAllSpriteSheets("warm");
+		}
+		ImGui::TextUnformatted(_reload_status.c_str());
+
+		ImGui::Separator();
+		ImGui::Text("Sound instances of %s: %zu", TEST_SOUND_FILE.c_str(), _sound_instances.size());
+		ImGui::SliderInt("instances", &_num_sound_instances, 1, 64);
+		if (ImGui::Button("Make instances"))
+		{
+			const AssetCacheStats before = sound_manager.GetCacheStats();
+			const auto begin = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < _num_sound_instances; i++)
+			{
+				_sound_instances.push_back(sound_manager.MakeSoundInstance(TEST_SOUND_FILE));
+			}
+			const double elapsed_ms = GetElapsedMilliseconds(begin);
+			const AssetCacheStats after = sound_manager.GetCacheStats();
+
+			std::ostringstream oss;
+			oss << _num_sound_instances << " instances: " << (after.num_misses - before.num_misses) << " loads, "
+				<< (after.num_hits - before.num_hits) << " shared, " << elapsed_ms << " ms";
+			_sound_status = oss.str();
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Play all"))
+		{
+			for (const auto& sound_instance : _sound_instances)
+			{
+				sound_instance->Play();
+			}
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Destroy instances"))
+		{
+			_sound_instances.clear();
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Trim"))
+		{
+			sound_manager.TrimCache();
+		}
+		ImGui::TextUnformatted(_sound_status.c_str());
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_17::Finalize()
+{
+	_sound_instances.clear();
+	__super::Finalize();
+}
+
+void TestSceneImpl_17::LoadAllSpriteSheets(const char* label)
+{
+	GraphicResourceManager& graphic_resource_manager = GraphicResourceManager::GetInstance();
+	const AssetCacheStats before = graphic_resource_manager.GetCacheStats();
+	const auto begin = std::chrono::high_resolution_clock::now();
+	for (const MdSpriteSheet& sprite_sheet : MdSpriteSheet::GetData())
+	{
+		graphic_resource_manager.GetSprite(sprite_sheet.id);
+	}
+	const double elapsed_ms = GetElapsedMilliseconds(begin);
+	const AssetCacheStats after = graphic_resource_manager.GetCacheStats();
+
+	std::ostringstream oss;
+	oss << label << ": " << elapsed_ms << " ms, " << (after.num_hits - before.num_hits) << " hits, "
+		<< (after.num_misses - before.num_misses) << " misses, " << (after.num_evictions - before.num_evictions) << " evictions";
+	_reload_status = oss.str();
+}
+
+void TestSceneImpl_17::DrawCacheStats(const char* label, const AssetCacheStats& stats) const
+{
+	ImGui::Text("%s", label);
+	ImGui::Text("hits %llu  misses %llu  evictions %llu", stats.num_hits, stats.num_misses, stats.num_evictions);
+	ImGui::Text("resident %u (idle %u)  %llu / %llu KB", stats.num_resident, stats.num_idle, stats.resident_bytes >> 10, stats.budget_bytes >> 10);
+}
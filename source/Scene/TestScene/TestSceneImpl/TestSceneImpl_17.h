@@ -0,0 +1,46 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include "Utility/AssetCache.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class SoundInstance;
+
+/// <summary>
+/// 画像とサウンドのキャッシュの検証
+/// <para>統計: GraphicResourceManagerとSoundManagerのキャッシュのヒット数, ミス数, 常駐しているサイズを表示し, 予算を変更する</para>
+/// <para>読み込み直し: 全てのスプライトシートを, キャッシュを空にして読み込む場合と, シーンの切り替えを模して読み込み直す場合の時間を比べる</para>
+/// <para>サウンド: 同じ効果音のインスタンスを複数作り, サウンドデータが共有される(ロードは1回だけ)ことを確かめる</para>
+/// </summary>
+class TestSceneImpl_17 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_17();
+	virtual ~TestSceneImpl_17();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	/// <summary>
+	/// 全てのスプライトシートを取得し, かかった時間とキャッシュの統計の差分を_reload_statusに書く
+	/// </summary>
+	void LoadAllSpriteSheets(const char* label);
+
+	void DrawCacheStats(const char* label, const AssetCacheStats& stats) const;
+
+	// 設定値
+	int _graphic_budget_mb;
+	int _sound_budget_mb;
+	int _num_sound_instances;
+
+	std::string _reload_status;
+	std::string _sound_status;
+
+	std::vector<std::shared_ptr<SoundInstance>> _sound_instances;
+};
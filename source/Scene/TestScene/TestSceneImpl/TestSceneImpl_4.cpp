@@ -87,6 +87,59 @@ namespace
 
 		return;
 	}
+
+	void TestCircleOverlaps()
+	{
+		Vector2D penetration_depth;
+
+		// 1) 円同士. めり込み深度は中心間の方向に (半径の和 - 距離)
+		{
+			const bool result = GeometricUtility::DoesCircleOverlapWithAnother(FCircle(Vector2D(0, 0), 5), FCircle(Vector2D(8, 0), 5), &penetration_depth);
+			assert(result == true);
+			assert(std::fabs(penetration_depth.x - 2.0f) < 1e-3f);
+			assert(std::fabs(penetration_depth.y) < 1e-3f);
+		}
+
+		// 2) 中心が一致する円同士でもめり込み深度が求まる
+		{
+			const bool result = GeometricUtility::DoesCircleOverlapWithAnother(FCircle(Vector2D(0, 0), 5), FCircle(Vector2D(0, 0), 5), &penetration_depth);
+			assert(result == true);
+			assert(std::fabs(penetration_depth.Length() - 10.0f) < 1e-3f);
+		}
+
+		// 3) 回転した矩形の角の外側にある円は重ならない
+		{
+			const FRect rect(Vector2D(0, 0), 20, 20, CLN2D_PI * 0.25f);
+			const bool result = GeometricUtility::DoesRectOverlapWithCircle(rect, FCircle(Vector2D(10, 10), 4));
+			assert(result == false);
+		}
+
+		// 4) 矩形の辺に円がめり込む
+		{
+			const FRect rect(Vector2D(0, 0), 20, 10, 0.f);
+			const bool result = GeometricUtility::DoesRectOverlapWithCircle(rect, FCircle(Vector2D(13, 0), 4), &penetration_depth);
+			assert(result == true);
+			assert(std::fabs(penetration_depth.x - 1.0f) < 1e-3f);
+		}
+
+		// 5) 線分の端点付近の円. 端点からの距離で判定される
+		{
+			const Vector2D segment[2] = { Vector2D(-10, 0), Vector2D(10, 0) };
+			assert(GeometricUtility::DoesCircleOverlapWithConvexPolygon(FCircle(Vector2D(12, 0), 4), segment, 2, &penetration_depth));
+			assert(std::fabs(std::fabs(penetration_depth.x) - 2.0f) < 1e-3f);
+			assert(!GeometricUtility::DoesCircleOverlapWithConvexPolygon(FCircle(Vector2D(13, 4), 4), segment, 2));
+		}
+
+		// 6) 線分と円周の交点
+		{
+			float fraction = 0.f;
+			const bool result = GeometricUtility::GetSegmentCircleIntersection(fraction, FSegment(Vector2D(-10, 0), Vector2D(10, 0)), FCircle(Vector2D(0, 0), 5));
+			assert(result == true);
+			assert(std::fabs(fraction - 0.25f) < 1e-3f);
+		}
+
+		return;
+	}
 }
 
 
@@ -103,6 +156,7 @@ void TestSceneImpl_4::Initialize(const SceneBaseInitialParams* const scene_param
 	__super::Initialize(scene_params);
 
 	TestDoesSegmentIntersectWithAnother();
+	TestCircleOverlaps();
 
 	_debug_screen_handle = DxLib::MakeScreen(WINDOW_SIZE_X, WINDOW_SIZE_Y, TRUE);
 
@@ -163,7 +217,7 @@ void TestSceneImpl_4::Initialize(const SceneBaseInitialParams* const scene_param
 		);
 	}	
 
-	CollisionManager::GetInstance().ConstructKdTree(Vector2D(0, 0), Vector2D(1000, 1000));
+	CollisionManager::GetInstance().ConstructTree();
 }
 
 SceneType TestSceneImpl_4::Tick(float delta_seconds)
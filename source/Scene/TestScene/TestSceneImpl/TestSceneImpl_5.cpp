@@ -0,0 +1,374 @@
+#include "TestSceneImpl_5.h"
+#include "Actor/Actor.h"
+#include "Actor/ActorFactory.h"
+#include "GameSystems/CollisionManager.h"
+#include "Component/Collider/BoxCollider.h"
+#include "Component/Collider/CircleCollider.h"
+#include <chrono>
+#include <thread>
+
+namespace
+{
+	// ベンチマークのシミュレーションの固定ステップ
+	constexpr float BENCHMARK_DELTA_SECONDS = 1.f / 60.f;
+
+	// コライダーの一辺の長さの範囲
+	constexpr float MIN_COLLIDER_EXTENT = 16.f;
+	constexpr float MAX_COLLIDER_EXTENT = 48.f;
+
+	// 静的コライダーの一辺の長さ
+	constexpr float STATIC_COLLIDER_EXTENT = 32.f;
+
+	// コライダーの移動速さの最大値 [px/s]
+	constexpr float MAX_COLLIDER_SPEED = 600.f;
+
+	// ナローフェーズの計測に使うペアの数と, 計測の繰り返し回数
+	constexpr int MICRO_BENCHMARK_NUM_PAIRS = 4096;
+	constexpr int MICRO_BENCHMARK_NUM_REPEATS = 64;
+
+	// ナローフェーズの計測でペアを配置する範囲の一辺. 半分程度のペアが衝突する大きさにする
+	constexpr float MICRO_BENCHMARK_AREA_EXTENT = 64.f;
+
+	int GetMaxNumThreads()
+	{
+		return (std::max)(static_cast<int>(std::thread::hardware_concurrency()), 1);
+	}
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+
+	bool AreHitResultsEqual(const HitResult& lhs, const HitResult& rhs)
+	{
+		if (lhs.has_hit != rhs.has_hit)
+		{
+			return false;
+		}
+		if (!lhs.has_hit)
+		{
+			return true;
+		}
+		return lhs.collision_type == rhs.collision_type
+			&& lhs.self_collider == rhs.self_collider
+			&& lhs.other_collider == rhs.other_collider
+			&& lhs.total_push_back_distance == rhs.total_push_back_distance
+			&& lhs.normal_from_other == rhs.normal_from_other;
+	}
+
+	/// <summary>
+	/// colliders1[i]とcolliders2[i]のペアについて, 個別の判定とまとめた判定のそれぞれで1ペアあたりの時間を計測する
+	/// </summary>
+	template<class Collider1, class Collider2>
+	void MeasureNarrowPhasePairs(
+		double& out_scalar_ns_per_pair, double& out_batch_ns_per_pair, float& out_hit_ratio, bool& out_is_batch_consistent,
+		const std::vector<const Collider1*>& colliders1, const std::vector<const Collider2*>& colliders2
+	)
+	{
+		const int num_pairs = static_cast<int>(colliders1.size());
+		std::vector<HitResult> scalar_results(num_pairs);
+		std::vector<HitResult> batch_results(num_pairs);
+
+		const auto scalar_begin = std::chrono::high_resolution_clock::now();
+		for (int repeat = 0; repeat < MICRO_BENCHMARK_NUM_REPEATS; ++repeat)
+		{
+			for (int i = 0; i < num_pairs; ++i)
+			{
+				scalar_results[i] = HitResult{};
+				CheckCollidersHitImpl(scalar_results[i], colliders1[i], colliders2[i]);
+			}
+		}
+		const double scalar_ms = GetElapsedMilliseconds(scalar_begin);
+
+		int num_hits = 0;
+		const auto batch_begin = std::chrono::high_resolution_clock::now();
+		for (int repeat = 0; repeat < MICRO_BENCHMARK_NUM_REPEATS; ++repeat)
+		{
+			num_hits = CheckCollidersHitBatch(batch_results.data(), colliders1.data(), colliders2.data(), num_pairs);
+		}
+		const double batch_ms = GetElapsedMilliseconds(batch_begin);
+
+		const double num_evaluations = static_cast<double>(num_pairs) * MICRO_BENCHMARK_NUM_REPEATS;
+		out_scalar_ns_per_pair = scalar_ms * 1e6 / num_evaluations;
+		out_batch_ns_per_pair = batch_ms * 1e6 / num_evaluations;
+		out_hit_ratio = static_cast<float>(num_hits) / (std::max)(num_pairs, 1);
+
+		out_is_batch_consistent = true;
+		for (int i = 0; i < num_pairs; ++i)
+		{
+			out_is_batch_consistent &= AreHitResultsEqual(scalar_results[i], batch_results[i]);
+		}
+	}
+}
+
+TestSceneImpl_5::TestSceneImpl_5()
+	: _num_colliders(1000)
+	, _num_static_colliders(4000)
+	, _area(Vector2D(0, 0), Vector2D(8192, 2048))
+	, _last_move_ms(0.0)
+	, _last_handle_collisions_ms(0.0)
+	, _num_narrowphase_threads(1)
+{
+}
+
+TestSceneImpl_5::~TestSceneImpl_5()
+{
+}
+
+void TestSceneImpl_5::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	CollisionManager::GetInstance().Initialize();
+
+	RespawnColliders(_num_colliders);
+}
+
+SceneType TestSceneImpl_5::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	CollisionManager::GetInstance().SetNumNarrowPhaseThreads(_num_narrowphase_threads);
+	StepSimulation(_last_move_ms, _last_handle_collisions_ms);
+
+	const CollisionManager::CollisionStats& stats = CollisionManager::GetInstance().GetStats();
+
+	ImGui::Begin("CollisionBenchmark");
+	{
+		ImGui::SliderInt("num colliders", &_num_colliders, 100, 10000);
+		ImGui::SliderInt("num static colliders", &_num_static_colliders, 0, 20000);
+		ImGui::SliderInt("narrowphase threads", &_num_narrowphase_threads, 1, GetMaxNumThreads());
+		if (ImGui::Button("Respawn"))
+		{
+			RespawnColliders(_num_colliders);
+		}
+
+		ImGui::Text("move: %.3f ms", _last_move_ms);
+		ImGui::Text("handle collisions: %.3f ms", _last_handle_collisions_ms);
+		ImGui::Text("proxies: %d / tree height: %d", stats.num_proxies, stats.tree_height);
+		ImGui::Text("candidate pairs: %d / reinserted: %d", stats.num_candidate_pairs, stats.num_reinserted_proxies);
+		ImGui::Text("transform notifications: %d / moved proxies: %d", stats.num_transform_notifications, stats.num_moved_proxies);
+		ImGui::Text("static colliders: %d", stats.num_static_colliders);
+		ImGui::Text("inactive colliders: %d", stats.num_inactive_colliders);
+		ImGui::Text("filtered pairs: %d / hits: %d", stats.num_filtered_pairs, stats.num_hits);
+		ImGui::Text("broadphase %.3f ms / narrowphase %.3f ms / resolve %.3f ms", stats.broadphase_ms, stats.narrowphase_ms, stats.resolve_ms);
+
+		ImGui::Separator();
+		if (ImGui::Button("Run narrowphase micro benchmark"))
+		{
+			RunNarrowPhaseMicroBenchmark();
+		}
+
+		for (const auto& result : _micro_results)
+		{
+			ImGui::Text(
+				"%-10s  scalar %.1f ns/pair  batch %.1f ns/pair  hits %.0f%%  %s",
+				result.pair_name,
+				result.scalar_ns_per_pair,
+				result.batch_ns_per_pair,
+				result.hit_ratio * 100.f,
+				result.is_batch_consistent ? "scalar == batch" : "MISMATCH"
+			);
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_5::Draw()
+{
+	__super::Draw();
+}
+
+void TestSceneImpl_5::Finalize()
+{
+	DestroyBenchActors();
+	CollisionManager::GetInstance().Finalize();
+	__super::Finalize();
+}
+
+void TestSceneImpl_5::RespawnColliders(const int num_colliders)
+{
+	DestroyBenchActors();
+
+	// 静的コライダーはツリーの構築時に静的グリッドに登録されるので, ツリーを作り直す
+	CollisionManager::GetInstance().DestructTree();
+	SpawnStaticColliders(_num_static_colliders);
+	CollisionManager::GetInstance().ConstructTree();
+
+	_bench_actors.reserve(num_colliders);
+	_velocities.reserve(num_colliders);
+
+	for (int i = 0; i < num_colliders; ++i)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = Vector2D(
+			RandomNumberGenerator::GetRandomFloat(_area.left_top.x, _area.right_bottom.x),
+			RandomNumberGenerator::GetRandomFloat(_area.left_top.y, _area.right_bottom.y)
+		);
+		// シーンのTickとDrawの対象にしないため, シーンには追加しない
+		Actor* actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, this);
+
+		BoxCollider* collider = actor->CreateComponent<BoxCollider>(actor);
+		collider->SetBoxColliderParams(
+			CollisionType::OVERLAP,
+			CollisionObjectType::ENEMY,
+			{ CollisionObjectType::ENEMY, CollisionObjectType::GROUND },
+			false,
+			Vector2D(
+				RandomNumberGenerator::GetRandomFloat(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT),
+				RandomNumberGenerator::GetRandomFloat(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT)
+			)
+		);
+
+		_bench_actors.push_back(actor);
+		_velocities.push_back(Vector2D(
+			RandomNumberGenerator::GetRandomFloat(-MAX_COLLIDER_SPEED, MAX_COLLIDER_SPEED),
+			RandomNumberGenerator::GetRandomFloat(-MAX_COLLIDER_SPEED, MAX_COLLIDER_SPEED)
+		));
+	}
+}
+
+void TestSceneImpl_5::SpawnStaticColliders(const int num_static_colliders)
+{
+	_static_actors.reserve(num_static_colliders);
+
+	for (int i = 0; i < num_static_colliders; ++i)
+	{
+		// タイルの位置に揃えて配置する
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = Vector2D(
+			floorf(RandomNumberGenerator::GetRandomFloat(_area.left_top.x, _area.right_bottom.x) / STATIC_COLLIDER_EXTENT) * STATIC_COLLIDER_EXTENT,
+			floorf(RandomNumberGenerator::GetRandomFloat(_area.left_top.y, _area.right_bottom.y) / STATIC_COLLIDER_EXTENT) * STATIC_COLLIDER_EXTENT
+		);
+		Actor* actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, this);
+
+		BoxCollider* collider = actor->CreateComponent<BoxCollider>(actor);
+		collider->SetBoxColliderParams(
+			CollisionType::OVERLAP,
+			CollisionObjectType::GROUND,
+			{ CollisionObjectType::ENEMY },
+			false,
+			Vector2D(STATIC_COLLIDER_EXTENT, STATIC_COLLIDER_EXTENT)
+		);
+		collider->SetMobility(ColliderMobility::STATIC);
+
+		_static_actors.push_back(actor);
+	}
+}
+
+void TestSceneImpl_5::DestroyBenchActors()
+{
+	for (auto& actor : _bench_actors)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_bench_actors.clear();
+	_velocities.clear();
+
+	for (auto& actor : _static_actors)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_static_actors.clear();
+}
+
+void TestSceneImpl_5::StepSimulation(double& out_move_ms, double& out_handle_collisions_ms)
+{
+	const auto move_begin = std::chrono::high_resolution_clock::now();
+	for (size_t i = 0; i < _bench_actors.size(); ++i)
+	{
+		Actor* const actor = _bench_actors[i];
+		Vector2D& velocity = _velocities[i];
+
+		// 領域の端で反射させる
+		const Vector2D position = actor->GetActorWorldPosition() + velocity * BENCHMARK_DELTA_SECONDS;
+		if (position.x < _area.left_top.x || _area.right_bottom.x < position.x)
+		{
+			velocity.x *= -1.f;
+		}
+		if (position.y < _area.left_top.y || _area.right_bottom.y < position.y)
+		{
+			velocity.y *= -1.f;
+		}
+
+		actor->AddWorldPosition(velocity * BENCHMARK_DELTA_SECONDS);
+	}
+	out_move_ms = GetElapsedMilliseconds(move_begin);
+
+	const auto handle_begin = std::chrono::high_resolution_clock::now();
+	CollisionManager::GetInstance().HandleCollisions();
+	out_handle_collisions_ms = GetElapsedMilliseconds(handle_begin);
+}
+
+void TestSceneImpl_5::RunNarrowPhaseMicroBenchmark()
+{
+	auto spawn_actor = [this](std::vector<Actor*>& actors)
+		{
+			initial_params_of_actor_t<Actor> actor_params;
+			actor_params.transform.position = Vector2D(
+				RandomNumberGenerator::GetRandomFloat(0.f, MICRO_BENCHMARK_AREA_EXTENT),
+				RandomNumberGenerator::GetRandomFloat(0.f, MICRO_BENCHMARK_AREA_EXTENT)
+			);
+			actor_params.transform.rotation = RandomNumberGenerator::GetRandomFloat(-CLN2D_PI, CLN2D_PI);
+			Actor* actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, this);
+			actors.push_back(actor);
+			return actor;
+		};
+	auto random_extent = []()
+		{
+			return Vector2D(
+				RandomNumberGenerator::GetRandomFloat(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT),
+				RandomNumberGenerator::GetRandomFloat(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT)
+			);
+		};
+
+	std::vector<Actor*> actors;
+	std::vector<const BoxCollider*> boxes1, boxes2;
+	std::vector<const CircleCollider*> circles;
+
+	// 衝突対象を空にして, 計測中のアクターが衝突処理で押し戻されないようにしておく
+	for (int i = 0; i < MICRO_BENCHMARK_NUM_PAIRS; ++i)
+	{
+		BoxCollider* box1 = spawn_actor(actors)->CreateComponent<BoxCollider>(actors.back());
+		box1->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::ENEMY, {}, false, random_extent());
+		boxes1.push_back(box1);
+
+		BoxCollider* box2 = spawn_actor(actors)->CreateComponent<BoxCollider>(actors.back());
+		box2->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::ENEMY, {}, false, random_extent());
+		boxes2.push_back(box2);
+
+		CircleCollider* circle = spawn_actor(actors)->CreateComponent<CircleCollider>(actors.back());
+		circle->SetCircleColliderParams(
+			CollisionType::BLOCK, CollisionObjectType::ENEMY, {}, false,
+			RandomNumberGenerator::GetRandomFloat(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT) * 0.5f
+		);
+		circles.push_back(circle);
+	}
+
+	_micro_results.clear();
+
+	NarrowPhaseMicroBenchmarkResult box_box{ "box-box", MICRO_BENCHMARK_NUM_PAIRS };
+	MeasureNarrowPhasePairs(
+		box_box.scalar_ns_per_pair, box_box.batch_ns_per_pair, box_box.hit_ratio, box_box.is_batch_consistent,
+		boxes1, boxes2
+	);
+	_micro_results.push_back(box_box);
+
+	NarrowPhaseMicroBenchmarkResult circle_box{ "circle-box", MICRO_BENCHMARK_NUM_PAIRS };
+	MeasureNarrowPhasePairs(
+		circle_box.scalar_ns_per_pair, circle_box.batch_ns_per_pair, circle_box.hit_ratio, circle_box.is_batch_consistent,
+		circles, boxes2
+	);
+	_micro_results.push_back(circle_box);
+
+	for (auto& actor : actors)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+}
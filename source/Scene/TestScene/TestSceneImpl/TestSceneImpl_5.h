@@ -0,0 +1,90 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// コリジョンのベンチマーク
+/// <para>多数のコライダーを毎ティック移動させ, ブロードフェーズの更新と衝突処理にかかる時間を計測する</para>
+/// <para>計測結果に描画やアクターのTickのコストが混ざらないよう, ベンチマーク用のアクターはシーンに追加しない</para>
+/// <para>移動するコライダーの他に, ステージのブロックを模した静的コライダーを配置する</para>
+/// <para>コライダー数を変えた計測はtests/bench_collision_broadphase.cpp, スレッド数を変えた計測はtests/bench_collision_narrowphase_scaling.cppで行う</para>
+/// <para>並列ナローフェーズとシングルスレッドの結果の一致はtests/test_collision_parallel_narrowphase.cppで確認する</para>
+/// <para>形状の組み合わせごとの, ナローフェーズの1ペアあたりのコストも計測できる</para>
+/// </summary>
+class TestSceneImpl_5 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_5();
+	virtual ~TestSceneImpl_5();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Draw() override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	/// <summary>
+	/// ナローフェーズの1組の形状の組み合わせについての計測結果
+	/// </summary>
+	struct NarrowPhaseMicroBenchmarkResult
+	{
+		const char* pair_name;
+		int num_pairs;
+		double scalar_ns_per_pair;	// ペアごとにCheckCollidersHitImpl()を呼んだ場合
+		double batch_ns_per_pair;	// CheckCollidersHitBatch()でまとめて判定した場合
+		float hit_ratio;
+		bool is_batch_consistent;	// 両者の結果が一致したか
+	};
+
+	/// <summary>
+	/// ベンチマーク用のアクターを破棄し, num_colliders個の動的コライダーと_num_static_colliders個の静的コライダーを生成し直す
+	/// </summary>
+	void RespawnColliders(const int num_colliders);
+
+	/// <summary>
+	/// 静的コライダーを持つアクターを生成する. ツリーの構築前に呼ぶ
+	/// </summary>
+	void SpawnStaticColliders(const int num_static_colliders);
+
+	/// <summary>
+	/// ベンチマーク用のアクターを全て破棄する
+	/// </summary>
+	void DestroyBenchActors();
+
+	/// <summary>
+	/// 全コライダーを移動させ, 衝突処理を行う
+	/// </summary>
+	/// <param name="out_move_ms">移動にかかった時間</param>
+	/// <param name="out_handle_collisions_ms">衝突処理にかかった時間</param>
+	void StepSimulation(double& out_move_ms, double& out_handle_collisions_ms);
+
+	/// <summary>
+	/// 矩形同士と円と矩形のペアを生成し, ナローフェーズの1ペアあたりのコストを計測する
+	/// <para>ブロードフェーズや衝突処理は通さず, 判定関数だけを繰り返し呼ぶ</para>
+	/// </summary>
+	void RunNarrowPhaseMicroBenchmark();
+
+	std::vector<class Actor*> _bench_actors;
+	std::vector<Vector2D> _velocities;
+
+	// 静的コライダーを持つアクター
+	std::vector<class Actor*> _static_actors;
+
+	// 現在のコライダー数の設定値
+	int _num_colliders;
+	int _num_static_colliders;
+
+	// コライダーを配置する領域
+	FRectAA _area;
+
+	// 直近のフレームの計測値
+	double _last_move_ms;
+	double _last_handle_collisions_ms;
+
+	// ナローフェーズのスレッド数の設定値
+	int _num_narrowphase_threads;
+
+	std::vector<NarrowPhaseMicroBenchmarkResult> _micro_results;
+};
@@ -0,0 +1,273 @@
+#include "TestSceneImpl_6.h"
+#include "Actor/Actor.h"
+#include "Actor/ActorFactory.h"
+#include "GameSystems/CollisionManager.h"
+#include "Component/Collider/BoxCollider.h"
+#include "Component/Collider/SegmentCollider.h"
+#include "Component/Collider/TriangleCollider.h"
+#include <chrono>
+
+namespace
+{
+	// シミュレーションの固定ステップ
+	constexpr float SIMULATION_DELTA_SECONDS = 1.f / 60.f;
+
+	// レーンの配置
+	constexpr float LANE_SPACING = 96.f;
+	constexpr float FIRST_LANE_X = 64.f;
+
+	// 飛翔体の発射位置と一辺の長さ
+	constexpr float PROJECTILE_START_Y = 64.f;
+	constexpr float PROJECTILE_EXTENT = 8.f;
+
+	// 標的の上端と幅
+	constexpr float TARGET_TOP_Y = 400.f;
+	constexpr float TARGET_WIDTH = 64.f;
+
+	// 矩形ブロックの厚さと坂の高さ
+	constexpr float RECT_TARGET_THICKNESS = 16.f;
+	constexpr float SLOPE_TARGET_HEIGHT = 32.f;
+
+	// 飛翔体の上端がこれを超えたら標的を通り抜けたとみなす
+	constexpr float TUNNELED_Y = TARGET_TOP_Y + SLOPE_TARGET_HEIGHT + 32.f;
+
+	// 押し戻しで動いたとみなす距離
+	constexpr float PUSHED_DISTANCE_THRESHOLD = 0.01f;
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+}
+
+TestSceneImpl_6::TestSceneImpl_6()
+	: _num_lanes(12)
+	, _projectile_speed(3000.f)
+	, _is_continuous_collision_enabled(true)
+	, _num_shots(0)
+	, _num_tunneled{}
+	, _num_shots_per_kind{}
+	, _last_handle_collisions_ms(0.0)
+{
+}
+
+TestSceneImpl_6::~TestSceneImpl_6()
+{
+}
+
+void TestSceneImpl_6::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	CollisionManager::GetInstance().Initialize();
+
+	RespawnActors();
+}
+
+SceneType TestSceneImpl_6::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	_last_handle_collisions_ms = StepSimulation();
+
+	ImGui::Begin("ContinuousCollision");
+	{
+		ImGui::SliderInt("num lanes", &_num_lanes, NUM_TARGET_KINDS, 12);
+		ImGui::SliderFloat("projectile speed [px/s]", &_projectile_speed, 300.f, 12000.f);
+		ImGui::Checkbox("continuous collision", &_is_continuous_collision_enabled);
+		if (ImGui::Button("Respawn"))
+		{
+			RespawnActors();
+		}
+
+		const CollisionManager::CollisionStats& stats = CollisionManager::GetInstance().GetStats();
+		ImGui::Text("step per tick: %.1f px", _projectile_speed * SIMULATION_DELTA_SECONDS);
+		ImGui::Text("handle collisions: %.3f ms", _last_handle_collisions_ms);
+		ImGui::Text("hits: %d / swept hits: %d", stats.num_hits, stats.num_swept_hits);
+		ImGui::Text(
+			"shots %d  tunneled: rect %d/%d  slope %d/%d  segment %d/%d",
+			_num_shots,
+			_num_tunneled[TARGET_RECT], _num_shots_per_kind[TARGET_RECT],
+			_num_tunneled[TARGET_SLOPE], _num_shots_per_kind[TARGET_SLOPE],
+			_num_tunneled[TARGET_SEGMENT], _num_shots_per_kind[TARGET_SEGMENT]
+		);
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_6::Draw()
+{
+	__super::Draw();
+
+	// シーンに追加していないので, コライダーだけを描画する
+	for (ColliderBase* const collider : _target_colliders)
+	{
+		collider->DrawDebugLines(_camera_params);
+	}
+	for (BoxCollider* const collider : _projectile_colliders)
+	{
+		collider->DrawDebugLines(_camera_params);
+	}
+}
+
+void TestSceneImpl_6::Finalize()
+{
+	DestroyActors();
+	CollisionManager::GetInstance().Finalize();
+	__super::Finalize();
+}
+
+void TestSceneImpl_6::RespawnActors()
+{
+	DestroyActors();
+
+	_num_shots = 0;
+	std::fill(std::begin(_num_tunneled), std::end(_num_tunneled), 0);
+	std::fill(std::begin(_num_shots_per_kind), std::end(_num_shots_per_kind), 0);
+
+	// 標的はSTATICなので, ツリーの構築前に生成する
+	CollisionManager::GetInstance().DestructTree();
+
+	for (int lane_index = 0; lane_index < _num_lanes; ++lane_index)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = Vector2D(FIRST_LANE_X + LANE_SPACING * lane_index, TARGET_TOP_Y);
+		Actor* target = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, this);
+
+		ColliderBase* target_collider = nullptr;
+		switch (GetTargetKind(lane_index))
+		{
+		case TARGET_RECT:
+		{
+			BoxCollider* box = target->CreateComponent<BoxCollider>(target);
+			box->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false, Vector2D(TARGET_WIDTH, RECT_TARGET_THICKNESS));
+			box->SetLocalPosition(Vector2D(0.f, RECT_TARGET_THICKNESS * 0.5f));
+			target_collider = box;
+			break;
+		}
+		case TARGET_SLOPE:
+		{
+			// 左下がりの坂
+			TriangleCollider* triangle = target->CreateComponent<TriangleCollider>(target);
+			triangle->SetTriangleColliderParams(
+				CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false,
+				{ Vector2D(-TARGET_WIDTH * 0.5f, SLOPE_TARGET_HEIGHT), Vector2D(TARGET_WIDTH * 0.5f, 0.f), Vector2D(TARGET_WIDTH * 0.5f, SLOPE_TARGET_HEIGHT) }
+			);
+			target_collider = triangle;
+			break;
+		}
+		case TARGET_SEGMENT:
+		{
+			// すり抜け床と同じ, 厚さのない足場
+			SegmentCollider* segment = target->CreateComponent<SegmentCollider>(target);
+			segment->SetSegmentColliderParams(CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false, TARGET_WIDTH);
+			target_collider = segment;
+			break;
+		}
+		default:
+			break;
+		}
+		target_collider->SetMobility(ColliderMobility::STATIC);
+		_targets.push_back(target);
+		_target_colliders.push_back(target_collider);
+	}
+
+	CollisionManager::GetInstance().ConstructTree();
+
+	_projectiles.reserve(_num_lanes);
+	_projectile_colliders.reserve(_num_lanes);
+	_expected_positions.resize(_num_lanes);
+	for (int lane_index = 0; lane_index < _num_lanes; ++lane_index)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		// シーンのTickとDrawの対象にしないため, シーンには追加しない
+		Actor* projectile = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, this);
+
+		BoxCollider* collider = projectile->CreateComponent<BoxCollider>(projectile);
+		collider->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::ENEMY, { CollisionObjectType::GROUND }, true, Vector2D(PROJECTILE_EXTENT, PROJECTILE_EXTENT));
+		collider->SetContinuousCollisionEnabled(_is_continuous_collision_enabled);
+
+		_projectiles.push_back(projectile);
+		_projectile_colliders.push_back(collider);
+		ReloadProjectile(lane_index);
+	}
+}
+
+void TestSceneImpl_6::DestroyActors()
+{
+	for (auto& actor : _projectiles)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_projectiles.clear();
+	_projectile_colliders.clear();
+	_expected_positions.clear();
+
+	for (auto& actor : _targets)
+	{
+		actor->Finalize();
+		ActorFactory::DestroyActor(actor);
+	}
+	_targets.clear();
+	_target_colliders.clear();
+}
+
+void TestSceneImpl_6::ReloadProjectile(const int lane_index)
+{
+	const float step = _projectile_speed * SIMULATION_DELTA_SECONDS;
+	const float x = FIRST_LANE_X + LANE_SPACING * lane_index;
+	const float y = PROJECTILE_START_Y - RandomNumberGenerator::GetRandomFloat(0.f, step);
+
+	_projectiles[lane_index]->SetActorWorldPosition(Vector2D(x, y));
+
+	// ワープなので, 移動経路上の衝突を検出しないようにする
+	BoxCollider* const collider = _projectile_colliders[lane_index];
+	collider->SetContinuousCollisionEnabled(_is_continuous_collision_enabled);
+	collider->ResetContinuousCollisionSweep();
+}
+
+double TestSceneImpl_6::StepSimulation()
+{
+	const Vector2D displacement(0.f, _projectile_speed * SIMULATION_DELTA_SECONDS);
+	for (size_t i = 0; i < _projectiles.size(); ++i)
+	{
+		_projectiles[i]->AddWorldPosition(displacement);
+		_expected_positions[i] = _projectiles[i]->GetActorWorldPosition();
+	}
+
+	const auto handle_begin = std::chrono::high_resolution_clock::now();
+	CollisionManager::GetInstance().HandleCollisions();
+	const double handle_collisions_ms = GetElapsedMilliseconds(handle_begin);
+
+	for (int lane_index = 0; lane_index < static_cast<int>(_projectiles.size()); ++lane_index)
+	{
+		const Vector2D position = _projectiles[lane_index]->GetActorWorldPosition();
+		const Vector2D push_back = position - _expected_positions[lane_index];
+		const bool is_pushed = push_back.Length() > PUSHED_DISTANCE_THRESHOLD;
+
+		// 離散判定では, 深くめり込むと標的の向こう側へ押し出されることがあるので, それも通り抜けとして数える
+		const bool has_tunneled =
+			position.y - PROJECTILE_EXTENT * 0.5f > TUNNELED_Y ||
+			(is_pushed && push_back.y > 0.f);
+		if (!is_pushed && !has_tunneled)
+		{
+			continue;
+		}
+
+		// 標的に止められたか, 通り抜けたら1発として数えて撃ち直す
+		const TargetKind target_kind = GetTargetKind(lane_index);
+		++_num_shots;
+		++_num_shots_per_kind[target_kind];
+		if (has_tunneled)
+		{
+			++_num_tunneled[target_kind];
+		}
+		ReloadProjectile(lane_index);
+	}
+
+	return handle_collisions_ms;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// 連続衝突判定の動作確認
+/// <para>高速で落下する飛翔体を, 矩形ブロック・坂(三角形)・薄い足場(線分)に向けて撃ち続け, 通り抜けた数と衝突処理の時間を計測する</para>
+/// <para>TestSceneImpl_5と同様に, 計測対象のアクターはシーンに追加せず, このシーンが直接移動させる</para>
+/// <para>通り抜けの割合の検証はtests/test_continuous_collision.cppで行う</para>
+/// </summary>
+class TestSceneImpl_6 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_6();
+	virtual ~TestSceneImpl_6();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Draw() override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	/// <summary>
+	/// 標的の種類. レーンの番号で順に割り当てる
+	/// </summary>
+	enum TargetKind : int
+	{
+		TARGET_RECT,
+		TARGET_SLOPE,
+		TARGET_SEGMENT,
+		NUM_TARGET_KINDS
+	};
+
+	/// <summary>
+	/// 飛翔体と標的を破棄し, 生成し直す
+	/// </summary>
+	void RespawnActors();
+
+	void DestroyActors();
+
+	/// <summary>
+	/// 飛翔体をレーンの上端に戻す. 発射位置は1ティックの移動量の範囲でランダムにずらす
+	/// </summary>
+	void ReloadProjectile(const int lane_index);
+
+	/// <summary>
+	/// 飛翔体を移動させて衝突処理を行い, 標的で止まったものと通り抜けたものを数える
+	/// </summary>
+	/// <returns>衝突処理にかかった時間</returns>
+	double StepSimulation();
+
+	TargetKind GetTargetKind(const int lane_index) const { return static_cast<TargetKind>(lane_index % NUM_TARGET_KINDS); }
+
+	std::vector<class Actor*> _projectiles;
+	std::vector<class BoxCollider*> _projectile_colliders;
+	std::vector<class Actor*> _targets;
+	std::vector<class ColliderBase*> _target_colliders;
+
+	// 飛翔体ごとの, このティックの移動後の位置. 押し戻されたかの判定に使う
+	std::vector<Vector2D> _expected_positions;
+
+	// 設定値
+	int _num_lanes;
+	float _projectile_speed;
+	bool _is_continuous_collision_enabled;
+
+	// 現在の設定での累計
+	int _num_shots;
+	int _num_tunneled[NUM_TARGET_KINDS];
+	int _num_shots_per_kind[NUM_TARGET_KINDS];
+	double _last_handle_collisions_ms;
+};
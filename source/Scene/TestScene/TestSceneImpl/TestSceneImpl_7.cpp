@@ -0,0 +1,129 @@
+#include "TestSceneImpl_7.h"
+#include "GameSystems/CollisionManager.h"
+#include "Component/Collider/ColliderBase.h"
+#include <cstring>
+
+namespace
+{
+	constexpr const char* DEFAULT_GOLDEN_FILE_PATH = "collision_regression_golden.txt";
+}
+
+TestSceneImpl_7::TestSceneImpl_7()
+	: _stage_file_path{}
+	, _golden_file_path{}
+	, _num_stage_copies(1)
+	, _num_ticks(0)
+	, _preview_tick(0)
+{
+	const CollisionRegressionParams default_params;
+	strcpy_s(_stage_file_path, default_params.stage_file_path.c_str());
+	strcpy_s(_golden_file_path, DEFAULT_GOLDEN_FILE_PATH);
+	_num_stage_copies = default_params.num_stage_copies;
+	_num_ticks = default_params.num_ticks;
+}
+
+TestSceneImpl_7::~TestSceneImpl_7()
+{
+}
+
+void TestSceneImpl_7::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	CollisionManager::GetInstance().Initialize();
+
+	_regression = std::make_unique<CollisionRegression>(this);
+	_regression->LoadStage(_stage_file_path, _num_stage_copies);
+	_preview_tick = 0;
+}
+
+SceneType TestSceneImpl_7::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	if (_regression->IsStageLoaded())
+	{
+		_regression->StepSimulation(_preview_tick++);
+	}
+
+	ImGui::Begin("CollisionRegression");
+	{
+		ImGui::InputText("stage json", _stage_file_path, sizeof(_stage_file_path));
+		ImGui::SliderInt("stage copies", &_num_stage_copies, 1, 32);
+		ImGui::SliderInt("num ticks", &_num_ticks, 60, 6000);
+		if (ImGui::Button("Reload stage"))
+		{
+			_regression->LoadStage(_stage_file_path, _num_stage_copies);
+			_preview_tick = 0;
+		}
+		if (!_regression->IsStageLoaded())
+		{
+			ImGui::Text("failed to load %s", _stage_file_path);
+		}
+
+		const CollisionManager::CollisionStats& stats = CollisionManager::GetInstance().GetStats();
+		ImGui::Text("static colliders: %d / dynamic colliders: %d / skipped actors: %d", stats.num_static_colliders, _regression->GetNumDynamicColliders(), _regression->GetNumSkippedActors());
+		ImGui::Text("candidate pairs: %d / filtered pairs: %d / hits: %d", stats.num_candidate_pairs, stats.num_filtered_pairs, stats.num_hits);
+		ImGui::Text("broadphase %.3f ms / narrowphase %.3f ms / resolve %.3f ms", stats.broadphase_ms, stats.narrowphase_ms, stats.resolve_ms);
+
+		ImGui::Separator();
+		ImGui::InputText("golden file", _golden_file_path, sizeof(_golden_file_path));
+		const bool should_write_golden = ImGui::Button("Run and write golden");
+		ImGui::SameLine();
+		const bool should_compare_golden = ImGui::Button("Run and compare with golden");
+		if (should_write_golden || should_compare_golden)
+		{
+			CollisionRegressionParams params;
+			params.stage_file_path = _stage_file_path;
+			params.num_stage_copies = _num_stage_copies;
+			params.num_ticks = _num_ticks;
+			_reports.push_back(_regression->Run(params));
+			_preview_tick = _num_ticks;
+
+			_golden_mismatches.clear();
+			if (should_write_golden)
+			{
+				_golden_status = CollisionRegression::WriteGoldenFile(_golden_file_path, _reports.back()) ? "written" : "failed to write";
+			}
+			else
+			{
+				_golden_status = CollisionRegression::CompareWithGoldenFile(_golden_file_path, _reports.back(), _golden_mismatches) ? "PASSED" : "FAILED";
+			}
+		}
+
+		if (!_golden_status.empty())
+		{
+			ImGui::Text("golden: %s", _golden_status.c_str());
+			for (const std::string& mismatch : _golden_mismatches)
+			{
+				ImGui::Text("  %s", mismatch.c_str());
+			}
+		}
+
+		for (const auto& report : _reports)
+		{
+			ImGui::Text("%s", CollisionRegression::FormatReport(report).c_str());
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_7::Draw()
+{
+	__super::Draw();
+
+	// シーンに追加していないので, コライダーだけを描画する
+	for (ColliderBase* const collider : _regression->GetColliders())
+	{
+		collider->DrawDebugLines(_camera_params);
+	}
+}
+
+void TestSceneImpl_7::Finalize()
+{
+	_regression.reset();
+	CollisionManager::GetInstance().Finalize();
+	__super::Finalize();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+#include "GameSystems/Headless/CollisionRegression.h"
+#include <memory>
+#include <string>
+
+/// <summary>
+/// CollisionRegressionを画面で確認しながら実行する
+/// <para>コマンドラインからは--collision-regressionで同じ処理を実行できる</para>
+/// </summary>
+class TestSceneImpl_7 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_7();
+	virtual ~TestSceneImpl_7();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Draw() override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	std::unique_ptr<CollisionRegression> _regression;
+
+	// 設定値. パスはImGuiで編集する
+	char _stage_file_path[256];
+	char _golden_file_path[256];
+	int _num_stage_copies;
+	int _num_ticks;
+
+	// 画面表示用にシミュレーションを進めたティック数
+	int _preview_tick;
+
+	std::vector<CollisionRegressionReport> _reports;
+
+	// 直近のゴールデンファイルの操作の結果
+	std::string _golden_status;
+	std::vector<std::string> _golden_mismatches;
+};
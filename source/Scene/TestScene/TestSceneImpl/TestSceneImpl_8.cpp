@@ -0,0 +1,160 @@
+#include "TestSceneImpl_8.h"
+#include "Actor/ActorFactory.h"
+#include "Actor/Projectile/MagicProjectile/MagicProjectile.h"
+#include "GameSystems/GameObjectManager.h"
+#include <chrono>
+
+namespace
+{
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+
+	/// <summary>
+	/// GameObjectManagerのハンドルのテスト
+	/// </summary>
+	void TestGameObjectHandle(SceneBase* const owner_scene)
+	{
+		GameObjectManager& manager = GameObjectManager::GetInstance();
+
+		ProjectileInitialParams params;
+		Actor* projectile = ActorFactory::CreateAndInitializeActor<MagicProjectile>(&params, owner_scene);
+		const GameObjectHandle handle = projectile->GetHandle();
+		assert(manager.IsValid(handle));
+		assert(manager.FindObject(handle) == projectile);
+
+		Actor* const stale_pointer = projectile;
+		projectile->Finalize();
+		ActorFactory::DestroyActor(projectile);
+		assert(projectile == nullptr);
+		assert(!manager.IsValid(handle));
+		assert(!manager.IsValid(stale_pointer));
+		assert(manager.FindObject(handle) == nullptr);
+
+		// 同じスロットが再利用されても, 古いハンドルは新しいオブジェクトを指さない
+		Actor* reused = ActorFactory::CreateAndInitializeActor<MagicProjectile>(&params, owner_scene);
+		assert(manager.IsValid(reused));
+		assert(reused->GetHandle() != handle);
+		assert(!manager.IsValid(handle));
+		reused->Finalize();
+		ActorFactory::DestroyActor(reused);
+
+		assert(!manager.IsValid(nullptr));
+		assert(!manager.IsValid(GameObjectHandle()));
+	}
+}
+
+TestSceneImpl_8::TestSceneImpl_8()
+	: _num_projectiles(10000)
+	, _num_rounds(5)
+{
+}
+
+TestSceneImpl_8::~TestSceneImpl_8()
+{
+}
+
+void TestSceneImpl_8::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+
+	TestGameObjectHandle(this);
+}
+
+SceneType TestSceneImpl_8::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("GameObjectPool");
+	{
+		ImGui::SliderInt("num projectiles", &_num_projectiles, 1000, 50000);
+		ImGui::SliderInt("num rounds", &_num_rounds, 1, 20);
+
+		GameObjectManager::PoolStats stats;
+		GameObjectManager::GetInstance().GetPoolStats(stats);
+		ImGui::Text("live objects: %d  pools: %d  chunks: %d (%.1f KB)", stats.num_live_objects, stats.num_pools, stats.num_chunks, stats.num_chunk_bytes / 1024.0);
+
+		ImGui::Separator();
+		if (ImGui::Button("Run benchmark"))
+		{
+			_results.clear();
+			for (int i = 0; i < _num_rounds; ++i)
+			{
+				_results.push_back(RunRound(_num_projectiles));
+			}
+		}
+
+		for (size_t i = 0; i < _results.size(); ++i)
+		{
+			const RoundResult& result = _results[i];
+			ImGui::Text(
+				"round %d  projectiles %d  objects created %lld  chunk allocations %d  live %d  spawn %.3f ms  destroy %.3f ms",
+				static_cast<int>(i),
+				result.num_projectiles,
+				result.num_objects_created,
+				result.num_chunk_allocations,
+				result.num_live_objects,
+				result.spawn_ms,
+				result.destroy_ms
+			);
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_8::Finalize()
+{
+	__super::Finalize();
+}
+
+TestSceneImpl_8::RoundResult TestSceneImpl_8::RunRound(const int num_projectiles)
+{
+	GameObjectManager& manager = GameObjectManager::GetInstance();
+
+	GameObjectManager::PoolStats stats_before;
+	manager.GetPoolStats(stats_before);
+
+	RoundResult result{};
+	result.num_projectiles = num_projectiles;
+
+	// シーンのTickとDrawの対象にしないため, シーンには追加しない
+	std::vector<Actor*> projectiles;
+	projectiles.reserve(num_projectiles);
+
+	const auto spawn_begin = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < num_projectiles; ++i)
+	{
+		ProjectileInitialParams params;
+		params.transform.position = Vector2D(static_cast<float>(i % 100) * 16.f, static_cast<float>(i / 100) * 16.f);
+		params.initial_velocity = Vector2D(100.f, 0.f);
+		projectiles.push_back(ActorFactory::CreateAndInitializeActor<MagicProjectile>(&params, this));
+	}
+	result.spawn_ms = GetElapsedMilliseconds(spawn_begin);
+
+	GameObjectManager::PoolStats stats_spawned;
+	manager.GetPoolStats(stats_spawned);
+	result.num_live_objects = stats_spawned.num_live_objects;
+
+	const auto destroy_begin = std::chrono::high_resolution_clock::now();
+	for (auto& projectile : projectiles)
+	{
+		projectile->Finalize();
+		ActorFactory::DestroyActor(projectile);
+	}
+	manager.ResetUnusedPools();
+	result.destroy_ms = GetElapsedMilliseconds(destroy_begin);
+
+	GameObjectManager::PoolStats stats_after;
+	manager.GetPoolStats(stats_after);
+	result.num_objects_created = stats_after.total_objects_created - stats_before.total_objects_created;
+	result.num_chunk_allocations = stats_after.num_chunks - stats_before.num_chunks;
+
+	// 全て破棄したので, 生存オブジェクト数は元に戻る
+	assert(stats_after.num_live_objects == stats_before.num_live_objects);
+
+	return result;
+}
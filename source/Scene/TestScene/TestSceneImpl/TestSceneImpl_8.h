@@ -0,0 +1,54 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// GameObjectManagerのプールのテストとベンチマーク
+/// <para>飛翔体(MagicProjectile)の生成と破棄を繰り返し, 各ラウンドの時間と, プールがチャンクを確保した回数を計測する</para>
+/// <para>最初のラウンドでチャンクが確保された後は, 同じ数の生成ではチャンクの確保が起きないことを確認する</para>
+/// </summary>
+class TestSceneImpl_8 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_8();
+	virtual ~TestSceneImpl_8();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	/// <summary>
+	/// 1ラウンドの計測結果
+	/// </summary>
+	struct RoundResult
+	{
+		int num_projectiles;
+
+		// ラウンド中にGameObjectManagerが生成したオブジェクト数(アクターとコンポーネント)
+		// プールを使わない場合は, これと同じ回数のヒープ確保が行われる
+		int64_t num_objects_created;
+
+		// ラウンド中にプールが確保したチャンク数. プールを使う場合のヒープ確保の回数
+		int num_chunk_allocations;
+
+		// 生成直後の生存オブジェクト数
+		int num_live_objects;
+
+		double spawn_ms;
+		double destroy_ms;
+	};
+
+	/// <summary>
+	/// num_projectiles 個の飛翔体を生成してから全て破棄する
+	/// </summary>
+	RoundResult RunRound(const int num_projectiles);
+
+	// 設定値
+	int _num_projectiles;
+	int _num_rounds;
+
+	std::vector<RoundResult> _results;
+};
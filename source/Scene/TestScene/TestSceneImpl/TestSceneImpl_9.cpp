@@ -0,0 +1,183 @@
+#include "TestSceneImpl_9.h"
+#include <chrono>
+
+namespace
+{
+	/// <summary>
+	/// 計測用の入力. 実行ごとに同じ形状になるよう, 乱数は固定のシードの線形合同法で生成する
+	/// </summary>
+	struct GeometryBenchmarkInput
+	{
+		std::vector<FRect> rects;
+		std::vector<FRectAA> aa_rects;
+		std::vector<FSegment> segments;
+		std::vector<FCircle> circles;
+		std::vector<std::array<Vector2D, 4>> quads;
+	};
+
+	class BenchmarkRandom
+	{
+	public:
+		explicit BenchmarkRandom(const uint32_t seed) : _state(seed) {}
+
+		float Range(const float min, const float max)
+		{
+			_state = _state * 1664525u + 1013904223u;
+			return min + (max - min) * static_cast<float>(_state >> 8) / static_cast<float>(1u << 24);
+		}
+
+	private:
+		uint32_t _state;
+	};
+
+	GeometryBenchmarkInput MakeGeometryBenchmarkInput(const int num_shapes)
+	{
+		// 半分程度のペアが重なるような密度にする
+		constexpr float FIELD_SIZE = 256.f;
+
+		BenchmarkRandom random(12345u);
+		GeometryBenchmarkInput input;
+		for (int i = 0; i < num_shapes; ++i)
+		{
+			const Vector2D center(random.Range(0.f, FIELD_SIZE), random.Range(0.f, FIELD_SIZE));
+			const float width = random.Range(16.f, 96.f);
+			const float height = random.Range(16.f, 96.f);
+			const float rotation = random.Range(0.f, CLN2D_TWO_PI);
+
+			input.rects.push_back(FRect(center, width, height, rotation));
+			input.aa_rects.push_back(FRectAA(center, width, height));
+			input.segments.push_back(FSegment(center, center + Vector2D::Rotate(Vector2D(width * 2.f, 0.f), rotation)));
+			input.circles.push_back(FCircle(center, width * 0.5f));
+
+			std::array<Vector2D, 4> quad;
+			input.rects.back().GetVertices(quad);
+			input.quads.push_back(quad);
+		}
+		return input;
+	}
+
+	/// <summary>
+	/// 全ての i, j (i != j) の組についてkernel(i, j)を num_repeats 回呼ぶ
+	/// </summary>
+	/// <param name="out_num_hits">kernelがtrueを返した回数</param>
+	/// <returns>呼び出し回数</returns>
+	template<class Kernel>
+	int64_t RunPairKernel(const int num_shapes, const int num_repeats, const Kernel& kernel, int64_t& out_num_hits)
+	{
+		int64_t num_calls = 0;
+		out_num_hits = 0;
+		for (int repeat = 0; repeat < num_repeats; ++repeat)
+		{
+			for (int i = 0; i < num_shapes; ++i)
+			{
+				for (int j = 0; j < num_shapes; ++j)
+				{
+					if (i == j)
+					{
+						continue;
+					}
+					out_num_hits += kernel(i, j) ? 1 : 0;
+					++num_calls;
+				}
+			}
+		}
+		return num_calls;
+	}
+}
+
+TestSceneImpl_9::TestSceneImpl_9()
+	: _num_shapes(256)
+	, _num_repeats(4)
+{
+}
+
+TestSceneImpl_9::~TestSceneImpl_9()
+{
+}
+
+void TestSceneImpl_9::Initialize(const SceneBaseInitialParams* const scene_params)
+{
+	__super::Initialize(scene_params);
+}
+
+SceneType TestSceneImpl_9::Tick(float delta_seconds)
+{
+	SceneType ret = __super::Tick(delta_seconds);
+
+	ImGui::Begin("GeometryBenchmark");
+	{
+		ImGui::SliderInt("num shapes", &_num_shapes, 16, 1024);
+		ImGui::SliderInt("num repeats", &_num_repeats, 1, 32);
+		ImGui::Text("sizeof(Vector2D) %d / sizeof(Transform) %d", static_cast<int>(sizeof(Vector2D)), static_cast<int>(sizeof(Transform)));
+
+		if (ImGui::Button("Run benchmark"))
+		{
+			const GeometryBenchmarkInput input = MakeGeometryBenchmarkInput(_num_shapes);
+
+			_results.clear();
+
+			// カーネルごとにRunPairKernel()をインスタンス化し, 関数ポインタなどの間接呼び出しが計測に混ざらないようにする
+			auto run_kernel = [this](const char* kernel_name, const auto& kernel)
+				{
+					KernelResult result{};
+					result.kernel_name = kernel_name;
+
+					const auto begin = std::chrono::high_resolution_clock::now();
+					result.num_calls = RunPairKernel(_num_shapes, _num_repeats, kernel, result.num_hits);
+					const double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+
+					result.calls_per_second = seconds > 0.0 ? result.num_calls / seconds : 0.0;
+					_results.push_back(result);
+				};
+
+			run_kernel("DoesRectOverlapWithAnother", [&input](int i, int j)
+				{
+					Vector2D penetration_depth;
+					return GeometricUtility::DoesRectOverlapWithAnother(input.rects[i], input.rects[j], &penetration_depth);
+				});
+			run_kernel("DoesConvexPolygonOverlapWithAnother", [&input](int i, int j)
+				{
+					Vector2D penetration_depth;
+					return GeometricUtility::DoesConvexPolygonOverlapWithAnother(input.quads[i].data(), 4, input.quads[j].data(), 4, &penetration_depth);
+				});
+			run_kernel("DoesSegmentIntersectWithAnother", [&input](int i, int j)
+				{
+					Vector2D intersection;
+					return GeometricUtility::DoesSegmentIntersectWithAnother(intersection, input.segments[i], input.segments[j]);
+				});
+			run_kernel("GetSegmentAARectIntersections", [&input](int i, int j)
+				{
+					std::array<Vector2D, 2> intersections;
+					return GeometricUtility::GetSegmentAARectIntersections(intersections, input.segments[i], input.aa_rects[j]) > 0;
+				});
+			run_kernel("DoesCircleOverlapWithConvexPolygon", [&input](int i, int j)
+				{
+					Vector2D penetration_depth;
+					return GeometricUtility::DoesCircleOverlapWithConvexPolygon(input.circles[i], input.quads[j].data(), 4, &penetration_depth);
+				});
+			run_kernel("DoesAARectOverlapWithAnother", [&input](int i, int j)
+				{
+					return GeometricUtility::DoesAARectOverlapWithAnother(input.aa_rects[i], input.aa_rects[j]);
+				});
+		}
+
+		for (const KernelResult& result : _results)
+		{
+			ImGui::Text(
+				"%-36s %8.2f M calls/s  hits %lld / %lld",
+				result.kernel_name,
+				result.calls_per_second * 1e-6,
+				result.num_hits,
+				result.num_calls
+			);
+		}
+	}
+	ImGui::End();
+
+	return ret;
+}
+
+void TestSceneImpl_9::Finalize()
+{
+	__super::Finalize();
+}
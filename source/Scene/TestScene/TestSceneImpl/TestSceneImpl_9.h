@@ -0,0 +1,39 @@
+#pragma once
+#include "Scene/TestScene/TestSceneImpl/TestSceneImplBase.h"
+
+/// <summary>
+/// GeometricUtilityのよく使われる判定関数のマイクロベンチマーク
+/// <para>固定のシードで生成した形状に対して各関数を繰り返し呼び, 1秒あたりの呼び出し回数を計測する</para>
+/// <para>ヒット数も表示するので, Vector2Dなどの数学型を変更する前後で, 速度と結果の両方を比較できる</para>
+/// </summary>
+class TestSceneImpl_9 : public TestSceneImplBase
+{
+public:
+	TestSceneImpl_9();
+	virtual ~TestSceneImpl_9();
+
+	//~ Begin SceneBase interface
+public:
+	virtual void Initialize(const SceneBaseInitialParams* const scene_params) override;
+	virtual SceneType Tick(float delta_seconds) override;
+	virtual void Finalize() override;
+	// End SceneBase interface
+
+private:
+	/// <summary>
+	/// 1つの関数についての計測結果
+	/// </summary>
+	struct KernelResult
+	{
+		const char* kernel_name;
+		int64_t num_calls;
+		int64_t num_hits;
+		double calls_per_second;
+	};
+
+	// 設定値
+	int _num_shapes;
+	int _num_repeats;
+
+	std::vector<KernelResult> _results;
+};
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+/// <summary>
+/// AssetCacheの統計情報
+/// </summary>
+struct AssetCacheStats
+{
+	// Acquire()で見つかった回数と, 見つからなかった回数
+	uint64_t num_hits;
+	uint64_t num_misses;
+
+	// 予算を超えたため解放した数
+	uint64_t num_evictions;
+
+	// 常駐しているアセット数と, そのうち参照されていない(解放の候補になる)もの
+	uint32_t num_resident;
+	uint32_t num_idle;
+
+	// 常駐しているアセットのサイズの合計と, その予算
+	uint64_t resident_bytes;
+	uint64_t budget_bytes;
+};
+
+/// <summary>
+/// 参照カウント付きのアセットキャッシュ. シーンをまたいで保持し, 予算を超えたときだけ参照されていないものを解放する
+/// <para>参照カウントが0になったアセットはすぐには解放せず, 最後に使われた順に並べておく. 予算を超えた場合は, 最も前に使われたものから解放する</para>
+/// <para>参照されているアセットは予算を超えていても解放しない</para>
+/// </summary>
+/// <typeparam name="Key">アセットを識別する値</typeparam>
+/// <typeparam name="Value">ハンドルなど, ロードしたアセット</typeparam>
+template<class Key, class Value, class Hash = std::hash<Key>>
+class AssetCache
+{
+public:
+	// アセットを解放する関数. Trim()とClear()で呼ばれる
+	typedef std::function<void(const Key&, Value&)> Unloader;
+
+	AssetCache(const uint64_t budget_bytes, const Unloader& unloader);
+
+	/// <summary>
+	/// 参照カウントと統計を変えずにアセットを探す
+	/// </summary>
+	/// <returns>常駐していない場合はnullptr</returns>
+	Value* Find(const Key& key);
+
+	/// <summary>
+	/// アセットを探し, 見つかった場合は参照カウントを1増やして返す
+	/// </summary>
+	/// <returns>常駐していない場合はnullptr. 続けてロードしたアセットをInsert()する</returns>
+	Value* Acquire(const Key& key);
+
+	/// <summary>
+	/// ロードしたアセットを参照カウント1で追加し, 予算を超えた分を解放する
+	/// </summary>
+	/// <param name="bytes">アセットのサイズ. 見積もりでよい</param>
+	Value& Insert(const Key& key, Value&& value, const uint64_t bytes);
+
+	/// <summary>
+	/// 参照カウントを1減らす. 0になっても解放はしない
+	/// </summary>
+	/// <returns>常駐していない場合(Clear()の後に残っていた参照を返した場合など)はfalse</returns>
+	bool Release(const Key& key);
+
+	/// <summary>
+	/// 予算に収まるまで, 参照されていないアセットを最も前に使われたものから解放する
+	/// </summary>
+	void Trim();
+
+	/// <summary>
+	/// 参照されているものも含め, 全てのアセットを解放する
+	/// </summary>
+	void Clear();
+
+	void SetBudget(const uint64_t budget_bytes);
+	uint64_t GetBudget() const { return _budget_bytes; }
+
+	uint32_t GetRefCount(const Key& key) const;
+
+	AssetCacheStats GetStats() const;
+
+	/// <summary>
+	/// ヒット数, ミス数, 解放数を0に戻す
+	/// </summary>
+	void ResetCounters();
+
+private:
+	struct Entry
+	{
+		Value value;
+		uint64_t bytes;
+		uint32_t ref_count;
+
+		// ref_countが0の場合の, _idle_keys内の位置
+		typename std::list<Key>::iterator idle_it;
+	};
+
+	void Evict(typename std::unordered_map<Key, Entry, Hash>::iterator it);
+
+	std::unordered_map<Key, Entry, Hash> _entries;
+
+	// 参照されていないアセット. 先頭が最も前に使われたもの
+	std::list<Key> _idle_keys;
+
+	Unloader _unloader;
+	uint64_t _budget_bytes;
+	uint64_t _resident_bytes;
+
+	uint64_t _num_hits;
+	uint64_t _num_misses;
+	uint64_t _num_evictions;
+};
+
+template<class Key, class Value, class Hash>
+inline AssetCache<Key, Value, Hash>::AssetCache(const uint64_t budget_bytes, const Unloader& unloader)
+	: _unloader(unloader)
+	, _budget_bytes(budget_bytes)
+	, _resident_bytes(0)
+	, _num_hits(0)
+	, _num_misses(0)
+	, _num_evictions(0)
+{
+}
+
+template<class Key, class Value, class Hash>
+inline Value* AssetCache<Key, Value, Hash>::Find(const Key& key)
+{
+	const auto it = _entries.find(key);
+	return it != _entries.end() ? &it->second.value : nullptr;
+}
+
+template<class Key, class Value, class Hash>
+inline Value* AssetCache<Key, Value, Hash>::Acquire(const Key& key)
+{
+	const auto it = _entries.find(key);
+	if (it == _entries.end())
+	{
+		_num_misses++;
+		return nullptr;
+	}
+
+	_num_hits++;
+	Entry& entry = it->second;
+	if (entry.ref_count == 0)
+	{
+		_idle_keys.erase(entry.idle_it);
+	}
+	entry.ref_count++;
+	return &entry.value;
+}
+
+template<class Key, class Value, class Hash>
+inline Value& AssetCache<Key, Value, Hash>::Insert(const Key& key, Value&& value, const uint64_t bytes)
+{
+	assert(_entries.find(key) == _entries.end());
+
+	Entry& entry = _entries[key];
+	entry.value = std::move(value);
+	entry.bytes = bytes;
+	entry.ref_count = 1;
+	_resident_bytes += bytes;
+
+	// 追加したアセットは参照されているので, 解放されない
+	Trim();
+	return entry.value;
+}
+
+template<class Key, class Value, class Hash>
+inline bool AssetCache<Key, Value, Hash>::Release(const Key& key)
+{
+	const auto it = _entries.find(key);
+	if (it == _entries.end())
+	{
+		return false;
+	}
+
+	Entry& entry = it->second;
+	assert(entry.ref_count > 0);
+	entry.ref_count--;
+	if (entry.ref_count == 0)
+	{
+		entry.idle_it = _idle_keys.insert(_idle_keys.end(), key);
+	}
+	return true;
+}
+
+template<class Key, class Value, class Hash>
+inline void AssetCache<Key, Value, Hash>::Trim()
+{
+	while (_resident_bytes > _budget_bytes && !_idle_keys.empty())
+	{
+		const auto it = _entries.find(_idle_keys.front());
+		assert(it != _entries.end());
+		Evict(it);
+		_num_evictions++;
+	}
+}
+
+template<class Key, class Value, class Hash>
+inline void AssetCache<Key, Value, Hash>::Clear()
+{
+	while (!_entries.empty())
+	{
+		Evict(_entries.begin());
+	}
+	assert(_idle_keys.empty() && _resident_bytes == 0);
+}
+
+template<class Key, class Value, class Hash>
+inline void AssetCache<Key, Value, Hash>::SetBudget(const uint64_t budget_bytes)
+{
+	_budget_bytes = budget_bytes;
+	Trim();
+}
+
+template<class Key, class Value, class Hash>
+inline uint32_t AssetCache<Key, Value, Hash>::GetRefCount(const Key& key) const
+{
+	const auto it = _entries.find(key);
+	return it != _entries.end() ? it->second.ref_count : 0;
+}
+
+template<class Key, class Value, class Hash>
+inline AssetCacheStats AssetCache<Key, Value, Hash>::GetStats() const
+{
+	AssetCacheStats stats = {};
+	stats.num_hits = _num_hits;
+	stats.num_misses = _num_misses;
+	stats.num_evictions = _num_evictions;
+	stats.num_resident = static_cast<uint32_t>(_entries.size());
+	stats.num_idle = static_cast<uint32_t>(_idle_keys.size());
+	stats.resident_bytes = _resident_bytes;
+	stats.budget_bytes = _budget_bytes;
+	return stats;
+}
+
+template<class Key, class Value, class Hash>
+inline void AssetCache<Key, Value, Hash>::ResetCounters()
+{
+	_num_hits = 0;
+	_num_misses = 0;
+	_num_evictions = 0;
+}
+
+template<class Key, class Value, class Hash>
+inline void AssetCache<Key, Value, Hash>::Evict(typename std::unordered_map<Key, Entry, Hash>::iterator it)
+{
+	Entry& entry = it->second;
+	if (entry.ref_count == 0)
+	{
+		_idle_keys.erase(entry.idle_it);
+	}
+	_resident_bytes -= entry.bytes;
+	if (_unloader)
+	{
+		_unloader(it->first, entry.value);
+	}
+	_entries.erase(it);
+}
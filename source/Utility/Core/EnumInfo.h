@@ -1,5 +1,6 @@
 #pragma once
 #include <unordered_map>
+#include <vector>
 #include <string>
 #include <stdexcept>
 #include <type_traits>
@@ -2,6 +2,7 @@
 #include <string>
 #include <codecvt>
 #include <fstream>
+#include <sstream>
 #include "Utility/Core/EnumInfo.h"
 #include "Utility/Core/StringUtils.h"
 
@@ -0,0 +1,177 @@
+#include "BatchRandomStream.h"
+#include <algorithm>
+
+// AVX2が有効なビルドでは8系列を一度に, x64などSSE2が使える環境では4系列ずつ, それ以外は1系列ずつ進める
+#if !defined(CLN2D_DISABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define CLN2D_BATCH_RANDOM_AVX2
+#elif !defined(CLN2D_DISABLE_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CLN2D_BATCH_RANDOM_SSE2
+#endif
+
+namespace
+{
+	// 上位24bitを[0,1)に変換する係数 (2^-24)
+	constexpr float UINT24_TO_UNIT_FLOAT = 1.f / 16777216.f;
+
+	/// <summary>
+	/// splitmix64. xoshiroの作者が状態の初期化に推奨している生成器
+	/// </summary>
+	uint64_t SplitMix64(uint64_t& state)
+	{
+		state += 0x9E37'79B9'7F4A'7C15;
+		uint64_t z = state;
+		z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+		z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+		return z ^ (z >> 31);
+	}
+
+	////////~ Begin SIMD wrappers
+	//
+	// 乱数列の更新は以下の型と関数だけを使って書き, SIMD命令セットごとの違いはここに閉じ込める
+	// SimdUint: uint32_t をWIDTH個並べたもの
+	//
+#if defined(CLN2D_BATCH_RANDOM_AVX2)
+	struct SimdUint
+	{
+		static constexpr int WIDTH = 8;
+		__m256i v;
+	};
+
+	inline SimdUint Load(const uint32_t* p) { return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)) }; }
+	inline void Store(uint32_t* p, const SimdUint& a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a.v); }
+	inline SimdUint operator+(const SimdUint& a, const SimdUint& b) { return { _mm256_add_epi32(a.v, b.v) }; }
+	inline SimdUint operator^(const SimdUint& a, const SimdUint& b) { return { _mm256_xor_si256(a.v, b.v) }; }
+	inline SimdUint operator|(const SimdUint& a, const SimdUint& b) { return { _mm256_or_si256(a.v, b.v) }; }
+	template<int N> inline SimdUint ShiftLeft(const SimdUint& a) { return { _mm256_slli_epi32(a.v, N) }; }
+	template<int N> inline SimdUint ShiftRight(const SimdUint& a) { return { _mm256_srli_epi32(a.v, N) }; }
+	inline void StoreUnitFloat(float* p, const SimdUint& a)
+	{
+		// 24bitの値は符号付き整数としての変換で正しく変換でき, 2^-24倍は誤差なく計算できる
+		const __m256 value = _mm256_cvtepi32_ps(_mm256_srli_epi32(a.v, 8));
+		_mm256_storeu_ps(p, _mm256_mul_ps(value, _mm256_set1_ps(UINT24_TO_UNIT_FLOAT)));
+	}
+
+#elif defined(CLN2D_BATCH_RANDOM_SSE2)
+	struct SimdUint
+	{
+		static constexpr int WIDTH = 4;
+		__m128i v;
+	};
+
+	inline SimdUint Load(const uint32_t* p) { return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)) }; }
+	inline void Store(uint32_t* p, const SimdUint& a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a.v); }
+	inline SimdUint operator+(const SimdUint& a, const SimdUint& b) { return { _mm_add_epi32(a.v, b.v) }; }
+	inline SimdUint operator^(const SimdUint& a, const SimdUint& b) { return { _mm_xor_si128(a.v, b.v) }; }
+	inline SimdUint operator|(const SimdUint& a, const SimdUint& b) { return { _mm_or_si128(a.v, b.v) }; }
+	template<int N> inline SimdUint ShiftLeft(const SimdUint& a) { return { _mm_slli_epi32(a.v, N) }; }
+	template<int N> inline SimdUint ShiftRight(const SimdUint& a) { return { _mm_srli_epi32(a.v, N) }; }
+	inline void StoreUnitFloat(float* p, const SimdUint& a)
+	{
+		// 24bitの値は符号付き整数としての変換で正しく変換でき, 2^-24倍は誤差なく計算できる
+		const __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(a.v, 8));
+		_mm_storeu_ps(p, _mm_mul_ps(value, _mm_set1_ps(UINT24_TO_UNIT_FLOAT)));
+	}
+
+#else
+	struct SimdUint
+	{
+		static constexpr int WIDTH = 1;
+		uint32_t v;
+	};
+
+	inline SimdUint Load(const uint32_t* p) { return { *p }; }
+	inline void Store(uint32_t* p, const SimdUint& a) { *p = a.v; }
+	inline SimdUint operator+(const SimdUint& a, const SimdUint& b) { return { a.v + b.v }; }
+	inline SimdUint operator^(const SimdUint& a, const SimdUint& b) { return { a.v ^ b.v }; }
+	inline SimdUint operator|(const SimdUint& a, const SimdUint& b) { return { a.v | b.v }; }
+	template<int N> inline SimdUint ShiftLeft(const SimdUint& a) { return { a.v << N }; }
+	template<int N> inline SimdUint ShiftRight(const SimdUint& a) { return { a.v >> N }; }
+	inline void StoreUnitFloat(float* p, const SimdUint& a) { *p = static_cast<float>(a.v >> 8) * UINT24_TO_UNIT_FLOAT; }
+#endif
+	//
+	////////~ End SIMD wrappers
+
+	constexpr int SIMD_WIDTH = SimdUint::WIDTH;
+	static_assert(BatchRandomStream::NUM_LANES % SIMD_WIDTH == 0, "the number of lanes must be a multiple of the SIMD width");
+
+	template<int N>
+	inline SimdUint RotateLeft(const SimdUint& a)
+	{
+		return ShiftLeft<N>(a) | ShiftRight<32 - N>(a);
+	}
+}
+
+BatchRandomStream::BatchRandomStream(const uint64_t seed)
+{
+	Seed(seed);
+}
+
+void BatchRandomStream::Seed(const uint64_t seed)
+{
+	uint64_t splitmix_state = seed;
+	for (int lane = 0; lane < NUM_LANES; lane++)
+	{
+		const uint64_t low = SplitMix64(splitmix_state);
+		const uint64_t high = SplitMix64(splitmix_state);
+		_state[0][lane] = static_cast<uint32_t>(low);
+		_state[1][lane] = static_cast<uint32_t>(low >> 32);
+		_state[2][lane] = static_cast<uint32_t>(high);
+		_state[3][lane] = static_cast<uint32_t>(high >> 32);
+
+		// 状態が全て0だと0しか出力されなくなる
+		if ((low | high) == 0)
+		{
+			_state[0][lane] = 1;
+		}
+	}
+}
+
+void BatchRandomStream::FillUniform(float* out_values, const size_t num_values)
+{
+	size_t i = 0;
+	for (; i + NUM_LANES <= num_values; i += NUM_LANES)
+	{
+		Next(out_values + i);
+	}
+
+	if (i < num_values)
+	{
+		float rest[NUM_LANES];
+		Next(rest);
+		std::copy(rest, rest + (num_values - i), out_values + i);
+	}
+}
+
+int BatchRandomStream::GetSimdWidth()
+{
+	return SIMD_WIDTH;
+}
+
+void BatchRandomStream::Next(float* out_values)
+{
+	for (int lane = 0; lane < NUM_LANES; lane += SIMD_WIDTH)
+	{
+		SimdUint s0 = Load(&_state[0][lane]);
+		SimdUint s1 = Load(&_state[1][lane]);
+		SimdUint s2 = Load(&_state[2][lane]);
+		SimdUint s3 = Load(&_state[3][lane]);
+
+		// xoshiro128+. 出力の下位bitは品質が低いので, 上位24bitだけを使う
+		StoreUnitFloat(out_values + lane, s0 + s3);
+
+		const SimdUint t = ShiftLeft<9>(s1);
+		s2 = s2 ^ s0;
+		s3 = s3 ^ s1;
+		s1 = s1 ^ s2;
+		s0 = s0 ^ s3;
+		s2 = s2 ^ t;
+		s3 = RotateLeft<11>(s3);
+
+		Store(&_state[0][lane], s0);
+		Store(&_state[1][lane], s1);
+		Store(&_state[2][lane], s2);
+		Store(&_state[3][lane], s3);
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// 大量の乱数をまとめて生成するための乱数列. xoshiro128+ を8系列並べ, SSE2/AVX2で同時に進める
+/// <para>パーティクルの生成など, 1つのまとまり(バッチ)ごとにシードを与えて使い捨てる. 同じシードからは命令セットによらず同じ列が得られる</para>
+/// <para>RandomNumberGeneratorのメルセンヌ・ツイスタより品質は劣るので, 見た目にしか影響しない値にのみ使う</para>
+/// </summary>
+class BatchRandomStream
+{
+public:
+	// 並べる系列の数. FillUniform()は系列の順に値を書き出す
+	static constexpr int NUM_LANES = 8;
+
+	explicit BatchRandomStream(const uint64_t seed = 0);
+
+	/// <summary>
+	/// シードから全ての系列の状態を作り直す. 系列ごとの状態はsplitmix64でシードを展開して作る
+	/// </summary>
+	void Seed(const uint64_t seed);
+
+	/// <summary>
+	/// [0,1)の一様乱数をnum_values個書き出す
+	/// <para>NUM_LANESの倍数でない場合, 最後の1回分の余りは捨てる</para>
+	/// </summary>
+	void FillUniform(float* out_values, const size_t num_values);
+
+	/// <summary>
+	/// 1回で作られる値の数(SIMD幅)
+	/// </summary>
+	static int GetSimdWidth();
+
+private:
+	/// <summary>
+	/// 全ての系列を1回進め, 上位24bitを[0,1)の値にしてNUM_LANES個書き出す
+	/// </summary>
+	void Next(float* out_values);
+
+	// xoshiro128+ の状態. _state[i][lane]は系列laneの状態のi番目の32bit
+	alignas(32) uint32_t _state[4][NUM_LANES];
+};
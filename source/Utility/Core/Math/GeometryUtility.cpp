@@ -1,5 +1,6 @@
 #include "Utility/Core/MathCore.h"
 #include "SystemTypes.h"
+#include <cfloat>
 
 const float GeometricUtility::PENETRATION_DEPTH_OFFSET = 0.f;
 
@@ -44,7 +45,11 @@ bool GeometricUtility::DoesSegmentIntersectWithAnother(const FSegment& seg_a, co
 
 bool GeometricUtility::DoesTriangleOverlapWIthAnother(const FTriangle& triangle_a, const FTriangle& triangle_b, Vector2D* penetration_depth)
 {
-	return false;
+	std::array<Vector2D, 3> vertices_a;
+	std::array<Vector2D, 3> vertices_b;
+	triangle_a.GetVertices(vertices_a);
+	triangle_b.GetVertices(vertices_b);
+	return DoesConvexPolygonOverlapWithAnother(vertices_a.data(), 3, vertices_b.data(), 3, penetration_depth);
 }
 
 int GeometricUtility::GetSegmentRectIntersections(
@@ -148,6 +153,8 @@ bool GeometricUtility::DoesRectOverlapWithSegment(const FRect& rect, const FSegm
 	{
 		out_penetration_depth = segment_vertical_vec * depth_segment_vertical / segment_vertical_vec.Length();
 	}
+
+	return true;
 }
 
 bool GeometricUtility::DoesRectOverlapWithSegment(const FRect& rect, const FSegment& segment)
@@ -480,6 +487,44 @@ int GeometricUtility::GetSegmentAARectIntersections(const FSegment& segment, con
 	return GetSegmentAARectIntersections(intersections, segment, rect);
 }
 
+bool GeometricUtility::ClipSegmentByAARect(const Vector2D& start, const Vector2D& d, const FRectAA& rect, float& in_out_t_min, float& in_out_t_max)
+{
+	const float starts[2] = { start.x, start.y };
+	const float dirs[2] = { d.x, d.y };
+	const float mins[2] = { rect.left_top.x, rect.left_top.y };
+	const float maxs[2] = { rect.right_bottom.x, rect.right_bottom.y };
+
+	for (int axis = 0; axis < 2; ++axis)
+	{
+		if (fabsf(dirs[axis]) < EPSIRON)
+		{
+			// 軸に平行. 始点がスラブの外なら交差しない
+			if (starts[axis] < mins[axis] || maxs[axis] < starts[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const float inv_d = 1.f / dirs[axis];
+		float t1 = (mins[axis] - starts[axis]) * inv_d;
+		float t2 = (maxs[axis] - starts[axis]) * inv_d;
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+		}
+
+		in_out_t_min = (std::max)(in_out_t_min, t1);
+		in_out_t_max = (std::min)(in_out_t_max, t2);
+		if (in_out_t_min > in_out_t_max)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool GeometricUtility::DoesConvexPolygonContainsPoint(const Vector2D& query_point, const std::vector<Vector2D>& vertexes)
 {
     if (vertexes.size() < 3)
@@ -520,12 +565,349 @@ bool GeometricUtility::DoesCircleOverlapWithAnother(const FCircle& circle_a, con
 	if (penetration_depth)
 	{
 		const float penetration_length = radius_sum - distance;
-		*penetration_depth = distance_vec.Normalize() / distance * penetration_length;
+
+		// 中心が一致している場合は向きが決まらないので, 上向きに押し出す
+		const Vector2D direction = (distance < EPSIRON) ? Vector2D{ 0.f, -1.f } : distance_vec / distance;
+		*penetration_depth = direction * penetration_length;
+	}
+
+	return true;
+}
+
+bool GeometricUtility::DoesConvexPolygonOverlapWithAnother(
+	const Vector2D* vertices_a, const int num_vertices_a,
+	const Vector2D* vertices_b, const int num_vertices_b,
+	Vector2D* penetration_depth
+)
+{
+	if (num_vertices_a < 2 || num_vertices_b < 2)
+	{
+		return false;
+	}
+
+	float min_depth = FLT_MAX;
+	Vector2D min_depth_axis{};
+
+	const Vector2D* const polygons[2] = { vertices_a, vertices_b };
+	const int num_vertices[2] = { num_vertices_a, num_vertices_b };
+
+	for (int polygon_index = 0; polygon_index < 2; ++polygon_index)
+	{
+		for (int edge_index = 0; edge_index < num_vertices[polygon_index]; ++edge_index)
+		{
+			Vector2D axis;
+			if (!GetConvexPolygonAxis(polygons[polygon_index], num_vertices[polygon_index], edge_index, axis))
+			{
+				continue;
+			}
+
+			float min_a, max_a, min_b, max_b;
+			ProjectVerticesOntoAxis(vertices_a, num_vertices_a, axis, min_a, max_a);
+			ProjectVerticesOntoAxis(vertices_b, num_vertices_b, axis, min_b, max_b);
+
+			// 軸に沿ってどちらかの向きに押し出すのに必要な距離. 線分のように幅がない形状でも正しく求まる
+			const float depth = (std::min)(max_a - min_b, max_b - min_a) + PENETRATION_DEPTH_OFFSET;
+			if (depth < 0.f)
+			{
+				return false;
+			}
+
+			if (depth < min_depth)
+			{
+				min_depth = depth;
+				min_depth_axis = axis;
+			}
+		}
+	}
+
+	if (min_depth == FLT_MAX)
+	{
+		// 全ての辺が退化している
+		return false;
+	}
+
+	if (penetration_depth)
+	{
+		*penetration_depth = min_depth_axis * min_depth;
+	}
+
+	return true;
+}
+
+bool GeometricUtility::DoesCircleOverlapWithConvexPolygon(const FCircle& circle, const Vector2D* vertices, const int num_vertices, Vector2D* penetration_depth)
+{
+	if (num_vertices < 2)
+	{
+		return false;
+	}
+
+	float min_depth = FLT_MAX;
+	Vector2D min_depth_axis{};
+
+	auto test_axis = [&](const Vector2D& axis)
+		{
+			float min_polygon, max_polygon;
+			ProjectVerticesOntoAxis(vertices, num_vertices, axis, min_polygon, max_polygon);
+			const float center_projection = Vector2D::Dot(circle.center, axis);
+			const float min_circle = center_projection - circle.radius;
+			const float max_circle = center_projection + circle.radius;
+
+			const float depth = (std::min)(max_circle - min_polygon, max_polygon - min_circle) + PENETRATION_DEPTH_OFFSET;
+			if (depth < min_depth)
+			{
+				min_depth = depth;
+				min_depth_axis = axis;
+			}
+			return depth >= 0.f;
+		};
+
+	// 多角形の辺の法線 (線分の場合は法線と方向)
+	for (int edge_index = 0; edge_index < num_vertices; ++edge_index)
+	{
+		Vector2D axis;
+		if (GetConvexPolygonAxis(vertices, num_vertices, edge_index, axis) && !test_axis(axis))
+		{
+			return false;
+		}
+	}
+
+	// 円の中心から最も近い頂点へ向かう軸
+	int closest_index = 0;
+	float closest_distance_sq = FLT_MAX;
+	for (int i = 0; i < num_vertices; ++i)
+	{
+		const float distance_sq = (vertices[i] - circle.center).LengthSquared();
+		if (distance_sq < closest_distance_sq)
+		{
+			closest_distance_sq = distance_sq;
+			closest_index = i;
+		}
+	}
+	if (closest_distance_sq > EPSIRON * EPSIRON)
+	{
+		const Vector2D axis = (vertices[closest_index] - circle.center) / sqrtf(closest_distance_sq);
+		if (!test_axis(axis))
+		{
+			return false;
+		}
+	}
+
+	if (min_depth == FLT_MAX)
+	{
+		return false;
+	}
+
+	if (penetration_depth)
+	{
+		*penetration_depth = min_depth_axis * min_depth;
+	}
+
+	return true;
+}
+
+bool GeometricUtility::DoesRectOverlapWithCircle(const FRect& rect, const FCircle& circle, Vector2D* penetration_depth)
+{
+	// 矩形のローカル座標系で, 円の中心に最も近い矩形上の点を求める
+	const Vector2D local_center = Vector2D::Rotate(circle.center - rect.center, -rect.rotation);
+	const float half_width = rect.width * 0.5f;
+	const float half_height = rect.height * 0.5f;
+	const Vector2D closest_point{
+		(std::max)(-half_width, (std::min)(local_center.x, half_width)),
+		(std::max)(-half_height, (std::min)(local_center.y, half_height))
+	};
+
+	const Vector2D diff = local_center - closest_point;
+	const float distance_sq = diff.LengthSquared();
+	if (distance_sq > circle.radius * circle.radius)
+	{
+		return false;
+	}
+
+	if (penetration_depth)
+	{
+		Vector2D local_direction;
+		float depth;
+		if (distance_sq > EPSIRON * EPSIRON)
+		{
+			// 中心が矩形の外にある
+			const float distance = sqrtf(distance_sq);
+			local_direction = diff / distance;
+			depth = circle.radius - distance;
+		}
+		else
+		{
+			// 中心が矩形の内側にある. 最も近い辺の方向に押し出す
+			const float gap_x = half_width - fabsf(local_center.x);
+			const float gap_y = half_height - fabsf(local_center.y);
+			if (gap_x < gap_y)
+			{
+				local_direction = Vector2D{ local_center.x < 0.f ? -1.f : 1.f, 0.f };
+				depth = gap_x + circle.radius;
+			}
+			else
+			{
+				local_direction = Vector2D{ 0.f, local_center.y < 0.f ? -1.f : 1.f };
+				depth = gap_y + circle.radius;
+			}
+		}
+
+		*penetration_depth = Vector2D::Rotate(local_direction, rect.rotation) * (depth + PENETRATION_DEPTH_OFFSET);
 	}
 
 	return true;
 }
 
+bool GeometricUtility::GetSegmentCircleIntersection(float& out_fraction, const FSegment& segment, const FCircle& circle)
+{
+	// |start + t * d - center|^2 = radius^2 を t について解く
+	const Vector2D d = segment.end - segment.start;
+	const Vector2D f = segment.start - circle.center;
+	const float a = Vector2D::Dot(d, d);
+	if (a < EPSIRON * EPSIRON)
+	{
+		return false;
+	}
+
+	const float b = Vector2D::Dot(f, d);
+	const float c = Vector2D::Dot(f, f) - circle.radius * circle.radius;
+	const float discriminant = b * b - a * c;
+	if (discriminant < 0.f)
+	{
+		return false;
+	}
+
+	const float sqrt_discriminant = sqrtf(discriminant);
+	const float t_enter = (-b - sqrt_discriminant) / a;
+	const float t_exit = (-b + sqrt_discriminant) / a;
+
+	// 始点が円の外なら入る点, 内側なら出る点
+	const float t = (t_enter >= 0.f) ? t_enter : t_exit;
+	if (t < 0.f || t > 1.f)
+	{
+		return false;
+	}
+
+	out_fraction = t;
+	return true;
+}
+
+bool GeometricUtility::SweepConvexPolygonAgainstAnother(
+	const Vector2D* vertices_a, const int num_vertices_a, const Vector2D& displacement_a,
+	const Vector2D* vertices_b, const int num_vertices_b,
+	float& out_time_of_impact, Vector2D& out_normal
+)
+{
+	if (num_vertices_a < 2 || num_vertices_b < 2)
+	{
+		return false;
+	}
+
+	// 全ての分離軸で投影区間が重なっている時間帯 [t_enter, t_exit] を求める
+	float t_enter = -FLT_MAX;
+	float t_exit = 1.f;
+	Vector2D enter_normal{};
+
+	const Vector2D* const polygons[2] = { vertices_a, vertices_b };
+	const int num_vertices[2] = { num_vertices_a, num_vertices_b };
+
+	for (int polygon_index = 0; polygon_index < 2; ++polygon_index)
+	{
+		for (int edge_index = 0; edge_index < num_vertices[polygon_index]; ++edge_index)
+		{
+			Vector2D axis;
+			if (!GetConvexPolygonAxis(polygons[polygon_index], num_vertices[polygon_index], edge_index, axis))
+			{
+				continue;
+			}
+
+			float min_a, max_a, min_b, max_b;
+			ProjectVerticesOntoAxis(vertices_a, num_vertices_a, axis, min_a, max_a);
+			ProjectVerticesOntoAxis(vertices_b, num_vertices_b, axis, min_b, max_b);
+
+			const float speed = Vector2D::Dot(displacement_a, axis);
+			if (fabsf(speed) < EPSIRON)
+			{
+				// 軸方向に動かないので, 離れていればずっと離れたまま
+				if (max_a <= min_b || max_b <= min_a)
+				{
+					return false;
+				}
+				continue;
+			}
+
+			// 投影区間が重なり始める時刻と離れる時刻
+			float t_in = (min_b - max_a) / speed;
+			float t_out = (max_b - min_a) / speed;
+			if (t_in > t_out)
+			{
+				std::swap(t_in, t_out);
+			}
+
+			if (t_in > t_enter)
+			{
+				t_enter = t_in;
+
+				// AがBに向かって進む向きの逆がBからAへの法線
+				enter_normal = (speed > 0.f) ? axis * (-1.f) : axis;
+			}
+			t_exit = (std::min)(t_exit, t_out);
+
+			if (t_enter > t_exit)
+			{
+				return false;
+			}
+		}
+	}
+
+	// 移動開始時点で重なっている, もしくは移動量の範囲内で接触しない
+	if (t_enter < 0.f || t_enter > 1.f)
+	{
+		return false;
+	}
+
+	out_time_of_impact = t_enter;
+	out_normal = enter_normal;
+	return true;
+}
+
+FRectAA GeometricUtility::GetAARectUnion(const FRectAA& rect_a, const FRectAA& rect_b)
+{
+	FRectAA result;
+	result.left_top.x = (std::min)(rect_a.left_top.x, rect_b.left_top.x);
+	result.left_top.y = (std::min)(rect_a.left_top.y, rect_b.left_top.y);
+	result.right_bottom.x = (std::max)(rect_a.right_bottom.x, rect_b.right_bottom.x);
+	result.right_bottom.y = (std::max)(rect_a.right_bottom.y, rect_b.right_bottom.y);
+	return result;
+}
+
+bool GeometricUtility::GetConvexPolygonAxis(const Vector2D* vertices, const int num_vertices, const int edge_index, Vector2D& out_axis)
+{
+	const Vector2D edge = vertices[(edge_index + 1) % num_vertices] - vertices[edge_index];
+	const float edge_length = edge.Length();
+	if (edge_length < EPSIRON)
+	{
+		return false;
+	}
+
+	// 線分は厚さゼロの矩形とみなし, 法線に加えて線分の方向も分離軸にする
+	out_axis = (num_vertices == 2 && edge_index == 1)
+		? edge / edge_length
+		: Vector2D{ -edge.y, edge.x } / edge_length;
+	return true;
+}
+
+void GeometricUtility::ProjectVerticesOntoAxis(const Vector2D* vertices, const int num_vertices, const Vector2D& axis, float& out_min, float& out_max)
+{
+	out_min = FLT_MAX;
+	out_max = -FLT_MAX;
+	for (int i = 0; i < num_vertices; ++i)
+	{
+		const float projection = Vector2D::Dot(vertices[i], axis);
+		out_min = (std::min)(out_min, projection);
+		out_max = (std::max)(out_max, projection);
+	}
+}
+
 FRect FRectAA::ToFRect() const
 {
 	const Vector2D center = (left_top + right_bottom) * 0.5f;
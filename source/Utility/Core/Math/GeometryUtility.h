@@ -417,6 +417,17 @@ public:
 	/// <returns></returns>
 	static int GetSegmentAARectIntersections(const FSegment& segment, const FRectAA& rect);
 
+	/// <summary>
+	/// 始点start, 方向dの線分 start + t*d (t_minからt_maxまで) を軸に平行な矩形で切り取る (スラブ法)
+	/// </summary>
+	/// <param name="start">線分の始点</param>
+	/// <param name="d">線分の始点から終点へのベクトル</param>
+	/// <param name="rect">軸に平行な矩形</param>
+	/// <param name="in_out_t_min">切り取る範囲の下限. 矩形に入るtで更新される</param>
+	/// <param name="in_out_t_max">切り取る範囲の上限. 矩形から出るtで更新される</param>
+	/// <returns>線分が矩形と重なるか</returns>
+	static bool ClipSegmentByAARect(const Vector2D& start, const Vector2D& d, const FRectAA& rect, float& in_out_t_min, float& in_out_t_max);
+
 	/// <summary>
 	/// 凸多角形が点を内包するか
 	/// </summary>
@@ -427,7 +438,79 @@ public:
 
 	static bool DoesCircleOverlapWithAnother(const FCircle& circle_a, const FCircle& circle_b, Vector2D* penetration_depth = nullptr);
 
+	/// <summary>
+	/// 2つの凸多角形が重なっているか (分離軸定理)
+	/// <para>線分は2頂点の多角形として扱える</para>
+	/// </summary>
+	/// <param name="vertices_a">Aの頂点. 隣接要素は隣接する頂点</param>
+	/// <param name="num_vertices_a">Aの頂点数</param>
+	/// <param name="vertices_b">Bの頂点. 隣接要素は隣接する頂点</param>
+	/// <param name="num_vertices_b">Bの頂点数</param>
+	/// <param name="penetration_depth">めり込みを解消するための最短の移動ベクトル. 向きはAとBの位置関係によらない</param>
+	static bool DoesConvexPolygonOverlapWithAnother(
+		const Vector2D* vertices_a, const int num_vertices_a,
+		const Vector2D* vertices_b, const int num_vertices_b,
+		Vector2D* penetration_depth = nullptr
+	);
+
+	/// <summary>
+	/// 円と凸多角形が重なっているか (分離軸定理)
+	/// <para>分離軸は多角形の辺の法線と, 円の中心から最も近い頂点へ向かう軸</para>
+	/// </summary>
+	/// <param name="vertices">凸多角形の頂点. 隣接要素は隣接する頂点. 線分は2頂点で表す</param>
+	/// <param name="num_vertices">頂点数</param>
+	static bool DoesCircleOverlapWithConvexPolygon(const FCircle& circle, const Vector2D* vertices, const int num_vertices, Vector2D* penetration_depth = nullptr);
+
+	/// <summary>
+	/// 矩形と円が重なっているか
+	/// <para>矩形のローカル座標系で円の中心を矩形にクランプして, 最近点との距離を調べる</para>
+	/// </summary>
+	static bool DoesRectOverlapWithCircle(const FRect& rect, const FCircle& circle, Vector2D* penetration_depth = nullptr);
+
+	/// <summary>
+	/// 線分と円周の交点のうち, 始点に近いものを求める
+	/// <para>始点が円の内側にある場合は, 線分が円から出る点を返す</para>
+	/// </summary>
+	/// <param name="out_fraction">交点の位置. 線分の長さに対する始点からの割合 [0, 1]</param>
+	/// <returns>交点があるか</returns>
+	static bool GetSegmentCircleIntersection(float& out_fraction, const FSegment& segment, const FCircle& circle);
+
+	/// <summary>
+	/// 凸多角形Aをdisplacement_aだけ平行移動させたとき, 静止した凸多角形Bに最初に接触する時刻を求める (分離軸定理による掃引判定)
+	/// <para>線分は2頂点の多角形として扱える. 移動開始時点で既に重なっている場合は接触とみなさない</para>
+	/// </summary>
+	/// <param name="vertices_a">移動開始時点のAの頂点. 隣接要素は隣接する頂点</param>
+	/// <param name="num_vertices_a">Aの頂点数</param>
+	/// <param name="displacement_a">Aの移動量</param>
+	/// <param name="vertices_b">Bの頂点. 隣接要素は隣接する頂点</param>
+	/// <param name="num_vertices_b">Bの頂点数</param>
+	/// <param name="out_time_of_impact">接触時刻. displacement_aに対する割合 [0, 1]</param>
+	/// <param name="out_normal">接触した辺の, BからAへ向かう単位法線</param>
+	/// <returns>移動中に接触するか</returns>
+	static bool SweepConvexPolygonAgainstAnother(
+		const Vector2D* vertices_a, const int num_vertices_a, const Vector2D& displacement_a,
+		const Vector2D* vertices_b, const int num_vertices_b,
+		float& out_time_of_impact, Vector2D& out_normal
+	);
+
+	/// <summary>
+	/// 軸に平行な矩形2つを内包する最小の軸に平行な矩形
+	/// </summary>
+	static FRectAA GetAARectUnion(const FRectAA& rect_a, const FRectAA& rect_b);
+
 private:
+	/// <summary>
+	/// 凸多角形のedge_index番目の辺に対応する分離軸 (単位ベクトル)
+	/// <para>2頂点の場合は線分とみなし, 0番目は法線, 1番目は線分の方向を返す</para>
+	/// </summary>
+	/// <returns>辺の長さがゼロでなく, 軸が求まったか</returns>
+	static bool GetConvexPolygonAxis(const Vector2D* vertices, const int num_vertices, const int edge_index, Vector2D& out_axis);
+
+	/// <summary>
+	/// 頂点を軸に投影した区間
+	/// </summary>
+	static void ProjectVerticesOntoAxis(const Vector2D* vertices, const int num_vertices, const Vector2D& axis, float& out_min, float& out_max);
+
 	// 計算されためり込み深度に加算するオフセット.
     // (計算されためり込み深度) + (オフセット) > 0 なら重なっていると判定され,
 	// < 0 なら重なっていないと判定される
@@ -0,0 +1,412 @@
+#include "GeometryUtilityBatch.h"
+#include "Utility/Core/MathCore.h"
+#include <cassert>
+#include <cmath>
+
+// AVX2が有効なビルドでは8個ずつ, x64などSSE2が使える環境では4個ずつ, それ以外は1個ずつ判定する
+#if !defined(CLN2D_DISABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define CLN2D_GEOMETRY_BATCH_AVX2
+#elif !defined(CLN2D_DISABLE_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CLN2D_GEOMETRY_BATCH_SSE2
+#endif
+
+namespace
+{
+	// SoA配列の長さをこの倍数に切り上げる. どのSIMD幅でも末尾の読み込みが配列の範囲内に収まる
+	constexpr size_t BATCH_PADDING = 8;
+
+	size_t RoundUpToPadding(const size_t size)
+	{
+		return (size + BATCH_PADDING - 1) / BATCH_PADDING * BATCH_PADDING;
+	}
+
+	/// <summary>
+	/// 配列の末尾に要素を追加し, 長さをBATCH_PADDINGの倍数に保つ
+	/// </summary>
+	void PushPadded(std::vector<float>& array, const size_t index, const float value)
+	{
+		if (index >= array.size())
+		{
+			array.resize(RoundUpToPadding(index + 1), 0.f);
+		}
+		array[index] = value;
+	}
+
+	////////~ Begin SIMD wrappers
+	//
+	// 判定関数は以下の型と関数だけを使って書き, SIMD命令セットごとの違いはここに閉じ込める
+	// SimdFloat: float をWIDTH個並べたもの. SimdMask: 比較結果
+	//
+#if defined(CLN2D_GEOMETRY_BATCH_AVX2)
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 8;
+		__m256 v;
+	};
+	struct SimdMask
+	{
+		__m256 v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+	inline SimdFloat Set(const float x) { return { _mm256_set1_ps(x) }; }
+	inline void Store(float* p, const SimdFloat& a) { _mm256_storeu_ps(p, a.v); }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { _mm256_add_ps(a.v, b.v) }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { _mm256_sub_ps(a.v, b.v) }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { _mm256_mul_ps(a.v, b.v) }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { _mm256_div_ps(a.v, b.v) }; }
+	inline SimdFloat Abs(const SimdFloat& a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v) }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { _mm256_min_ps(a.v, b.v) }; }
+	inline SimdFloat Sqrt(const SimdFloat& a) { return { _mm256_sqrt_ps(a.v) }; }
+	inline SimdMask operator<(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+	inline SimdMask operator<=(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+	inline SimdMask operator==(const SimdFloat& a, const SimdFloat& b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { _mm256_and_ps(a.v, b.v) }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+	inline uint32_t ToBits(const SimdMask& mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask.v)); }
+
+#elif defined(CLN2D_GEOMETRY_BATCH_SSE2)
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 4;
+		__m128 v;
+	};
+	struct SimdMask
+	{
+		__m128 v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { _mm_loadu_ps(p) }; }
+	inline SimdFloat Set(const float x) { return { _mm_set1_ps(x) }; }
+	inline void Store(float* p, const SimdFloat& a) { _mm_storeu_ps(p, a.v); }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { _mm_add_ps(a.v, b.v) }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { _mm_sub_ps(a.v, b.v) }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { _mm_mul_ps(a.v, b.v) }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { _mm_div_ps(a.v, b.v) }; }
+	inline SimdFloat Abs(const SimdFloat& a) { return { _mm_andnot_ps(_mm_set1_ps(-0.f), a.v) }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { _mm_min_ps(a.v, b.v) }; }
+	inline SimdFloat Sqrt(const SimdFloat& a) { return { _mm_sqrt_ps(a.v) }; }
+	inline SimdMask operator<(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+	inline SimdMask operator<=(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmple_ps(a.v, b.v) }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+	inline SimdMask operator==(const SimdFloat& a, const SimdFloat& b) { return { _mm_cmpeq_ps(a.v, b.v) }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { _mm_and_ps(a.v, b.v) }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+	inline uint32_t ToBits(const SimdMask& mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask.v)); }
+
+#else
+	struct SimdFloat
+	{
+		static constexpr int WIDTH = 1;
+		float v;
+	};
+	struct SimdMask
+	{
+		bool v;
+	};
+
+	inline SimdFloat Load(const float* p) { return { *p }; }
+	inline SimdFloat Set(const float x) { return { x }; }
+	inline void Store(float* p, const SimdFloat& a) { *p = a.v; }
+	inline SimdFloat operator+(const SimdFloat& a, const SimdFloat& b) { return { a.v + b.v }; }
+	inline SimdFloat operator-(const SimdFloat& a, const SimdFloat& b) { return { a.v - b.v }; }
+	inline SimdFloat operator*(const SimdFloat& a, const SimdFloat& b) { return { a.v * b.v }; }
+	inline SimdFloat operator/(const SimdFloat& a, const SimdFloat& b) { return { a.v / b.v }; }
+	inline SimdFloat Abs(const SimdFloat& a) { return { std::fabs(a.v) }; }
+	inline SimdFloat Min(const SimdFloat& a, const SimdFloat& b) { return { a.v < b.v ? a.v : b.v }; }
+	inline SimdFloat Sqrt(const SimdFloat& a) { return { std::sqrt(a.v) }; }
+	inline SimdMask operator<(const SimdFloat& a, const SimdFloat& b) { return { a.v < b.v }; }
+	inline SimdMask operator<=(const SimdFloat& a, const SimdFloat& b) { return { a.v <= b.v }; }
+	inline SimdMask operator>=(const SimdFloat& a, const SimdFloat& b) { return { a.v >= b.v }; }
+	inline SimdMask operator==(const SimdFloat& a, const SimdFloat& b) { return { a.v == b.v }; }
+	inline SimdMask operator&(const SimdMask& a, const SimdMask& b) { return { a.v && b.v }; }
+	inline SimdFloat Select(const SimdMask& mask, const SimdFloat& a, const SimdFloat& b) { return mask.v ? a : b; }
+	inline uint32_t ToBits(const SimdMask& mask) { return mask.v ? 1u : 0u; }
+#endif
+	//
+	////////~ End SIMD wrappers
+
+	constexpr int SIMD_WIDTH = SimdFloat::WIDTH;
+	static_assert(32 % SIMD_WIDTH == 0, "a SIMD block must not straddle two mask words");
+	static_assert(BATCH_PADDING % SIMD_WIDTH == 0, "padding must be a multiple of the SIMD width");
+
+	/// <summary>
+	/// 先頭からindex個目の図形を含むブロックの, 範囲内の要素だけを残すマスク
+	/// </summary>
+	uint32_t GetValidLaneBits(const size_t index, const size_t size)
+	{
+		const size_t num_valid_lanes = size - index;
+		return num_valid_lanes >= static_cast<size_t>(SIMD_WIDTH) ? (1u << SIMD_WIDTH) - 1u : (1u << num_valid_lanes) - 1u;
+	}
+
+	/// <summary>
+	/// 出力先のビットマスクを図形の数に合わせて0で初期化する
+	/// </summary>
+	void ResetHitMasks(std::vector<uint32_t>& out_hit_masks, const size_t size)
+	{
+		out_hit_masks.assign((size + 31) / 32, 0u);
+	}
+}
+
+FRectBatch::FRectBatch()
+	: _num_rects(0)
+{
+}
+
+void FRectBatch::Clear()
+{
+	center_x.clear();
+	center_y.clear();
+	wvec_x.clear();
+	wvec_y.clear();
+	hvec_x.clear();
+	hvec_y.clear();
+	_num_rects = 0;
+}
+
+void FRectBatch::Reserve(const size_t num_rects)
+{
+	const size_t capacity = RoundUpToPadding(num_rects);
+	center_x.reserve(capacity);
+	center_y.reserve(capacity);
+	wvec_x.reserve(capacity);
+	wvec_y.reserve(capacity);
+	hvec_x.reserve(capacity);
+	hvec_y.reserve(capacity);
+}
+
+void FRectBatch::Add(const FRect& rect)
+{
+	const Vector2D wvec = rect.GetWidthVector();
+	const Vector2D hvec = rect.GetHeightVector();
+
+	PushPadded(center_x, _num_rects, rect.center.x);
+	PushPadded(center_y, _num_rects, rect.center.y);
+	PushPadded(wvec_x, _num_rects, wvec.x);
+	PushPadded(wvec_y, _num_rects, wvec.y);
+	PushPadded(hvec_x, _num_rects, hvec.x);
+	PushPadded(hvec_y, _num_rects, hvec.y);
+	_num_rects++;
+}
+
+FSegmentBatch::FSegmentBatch()
+	: _num_segments(0)
+{
+}
+
+void FSegmentBatch::Clear()
+{
+	start_x.clear();
+	start_y.clear();
+	dir_x.clear();
+	dir_y.clear();
+	_num_segments = 0;
+}
+
+void FSegmentBatch::Reserve(const size_t num_segments)
+{
+	const size_t capacity = RoundUpToPadding(num_segments);
+	start_x.reserve(capacity);
+	start_y.reserve(capacity);
+	dir_x.reserve(capacity);
+	dir_y.reserve(capacity);
+}
+
+void FSegmentBatch::Add(const FSegment& segment)
+{
+	const Vector2D dir = segment.end - segment.start;
+
+	PushPadded(start_x, _num_segments, segment.start.x);
+	PushPadded(start_y, _num_segments, segment.start.y);
+	PushPadded(dir_x, _num_segments, dir.x);
+	PushPadded(dir_y, _num_segments, dir.y);
+	_num_segments++;
+}
+
+void FSegmentBatch::AddRectEdges(const FRect& rect)
+{
+	std::array<Vector2D, 4> rect_vertices;
+	rect.GetVertices(rect_vertices);
+
+	for (size_t i = 0; i < 4; i++)
+	{
+		Add(FSegment{ rect_vertices[i], rect_vertices[(i + 1) % 4] });
+	}
+}
+
+int GeometricUtilityBatch::DoesRectOverlapWithBatch(const FRect& rect, const FRectBatch& batch, std::vector<uint32_t>& out_hit_masks, Vector2D* out_penetration_depths)
+{
+	const size_t num_rects = batch.Size();
+	ResetHitMasks(out_hit_masks, num_rects);
+
+	const Vector2D wvec_a = rect.GetWidthVector();
+	const Vector2D hvec_a = rect.GetHeightVector();
+
+	const SimdFloat center_a_x = Set(rect.center.x);
+	const SimdFloat center_a_y = Set(rect.center.y);
+	const SimdFloat wa_x = Set(wvec_a.x);
+	const SimdFloat wa_y = Set(wvec_a.y);
+	const SimdFloat ha_x = Set(hvec_a.x);
+	const SimdFloat ha_y = Set(hvec_a.y);
+	const SimdFloat len2_wa = Set(wvec_a.LengthSquared());
+	const SimdFloat len2_ha = Set(hvec_a.LengthSquared());
+	const SimdFloat half = Set(0.5f);
+	const SimdFloat zero = Set(0.f);
+
+	int num_hits = 0;
+	for (size_t i = 0; i < num_rects; i += SIMD_WIDTH)
+	{
+		const SimdFloat wb_x = Load(&batch.wvec_x[i]);
+		const SimdFloat wb_y = Load(&batch.wvec_y[i]);
+		const SimdFloat hb_x = Load(&batch.hvec_x[i]);
+		const SimdFloat hb_y = Load(&batch.hvec_y[i]);
+		const SimdFloat d_x = center_a_x - Load(&batch.center_x[i]);
+		const SimdFloat d_y = center_a_y - Load(&batch.center_y[i]);
+
+		// GeometricUtility::DoesRectOverlapWithAnother()の各軸のめり込み深度に, 軸の長さを掛けたもの
+		// 符号はめり込み深度と同じなので, 重なり判定には平方根も除算もいらない
+		// 相手の辺への投影 |v・w|, |v・h| はA側の軸とB側の軸で共通
+		const SimdFloat wa_wb = Abs(wa_x * wb_x + wa_y * wb_y);
+		const SimdFloat wa_hb = Abs(wa_x * hb_x + wa_y * hb_y);
+		const SimdFloat ha_wb = Abs(ha_x * wb_x + ha_y * wb_y);
+		const SimdFloat ha_hb = Abs(ha_x * hb_x + ha_y * hb_y);
+		const SimdFloat len2_wb = wb_x * wb_x + wb_y * wb_y;
+		const SimdFloat len2_hb = hb_x * hb_x + hb_y * hb_y;
+
+		const SimdFloat scaled_depth_a_w = half * (len2_wa + wa_wb + wa_hb) - Abs(wa_x * d_x + wa_y * d_y);
+		const SimdFloat scaled_depth_a_h = half * (len2_ha + ha_wb + ha_hb) - Abs(ha_x * d_x + ha_y * d_y);
+		const SimdFloat scaled_depth_b_w = half * (len2_wb + wa_wb + ha_wb) - Abs(wb_x * d_x + wb_y * d_y);
+		const SimdFloat scaled_depth_b_h = half * (len2_hb + wa_hb + ha_hb) - Abs(hb_x * d_x + hb_y * d_y);
+
+		const SimdMask is_overlapping =
+			(scaled_depth_a_w >= zero) & (scaled_depth_a_h >= zero) & (scaled_depth_b_w >= zero) & (scaled_depth_b_h >= zero);
+
+		const uint32_t hit_bits = ToBits(is_overlapping) & GetValidLaneBits(i, num_rects);
+		if (hit_bits == 0)
+		{
+			continue;
+		}
+
+		out_hit_masks[i / 32] |= hit_bits << (i % 32);
+
+		if (out_penetration_depths != nullptr)
+		{
+			// めり込み深度が最小の軸を, スカラー版と同じ優先順位(Aの幅, Aの高さ, Bの幅, Bの高さ)で選ぶ
+			const SimdFloat len_wa = Sqrt(len2_wa);
+			const SimdFloat len_ha = Sqrt(len2_ha);
+			const SimdFloat len_wb = Sqrt(len2_wb);
+			const SimdFloat len_hb = Sqrt(len2_hb);
+			const SimdFloat depth_a_w = scaled_depth_a_w / len_wa;
+			const SimdFloat depth_a_h = scaled_depth_a_h / len_ha;
+			const SimdFloat depth_b_w = scaled_depth_b_w / len_wb;
+			const SimdFloat depth_b_h = scaled_depth_b_h / len_hb;
+			const SimdFloat min_depth = Min(Min(depth_a_w, depth_a_h), Min(depth_b_w, depth_b_h));
+
+			SimdFloat axis_x = hb_x;
+			SimdFloat axis_y = hb_y;
+			SimdFloat axis_len = len_hb;
+			SimdFloat depth = depth_b_h;
+			const auto select_if_min = [&](const SimdFloat& candidate_depth, const SimdFloat& candidate_x, const SimdFloat& candidate_y, const SimdFloat& candidate_len)
+				{
+					const SimdMask is_min = candidate_depth == min_depth;
+					axis_x = Select(is_min, candidate_x, axis_x);
+					axis_y = Select(is_min, candidate_y, axis_y);
+					axis_len = Select(is_min, candidate_len, axis_len);
+					depth = Select(is_min, candidate_depth, depth);
+				};
+			select_if_min(depth_b_w, wb_x, wb_y, len_wb);
+			select_if_min(depth_a_h, ha_x, ha_y, len_ha);
+			select_if_min(depth_a_w, wa_x, wa_y, len_wa);
+
+			float penetration_x[SIMD_WIDTH];
+			float penetration_y[SIMD_WIDTH];
+			Store(penetration_x, axis_x * depth / axis_len);
+			Store(penetration_y, axis_y * depth / axis_len);
+			for (int lane = 0; lane < SIMD_WIDTH; lane++)
+			{
+				if ((hit_bits >> lane) & 1u)
+				{
+					out_penetration_depths[i + lane] = Vector2D(penetration_x[lane], penetration_y[lane]);
+				}
+			}
+		}
+
+		for (uint32_t bits = hit_bits; bits != 0; bits &= bits - 1)
+		{
+			num_hits++;
+		}
+	}
+
+	return num_hits;
+}
+
+int GeometricUtilityBatch::DoesSegmentIntersectWithBatch(const FSegment& segment, const FSegmentBatch& batch, std::vector<uint32_t>& out_hit_masks, Vector2D* out_intersection_positions)
+{
+	const size_t num_segments = batch.Size();
+	ResetHitMasks(out_hit_masks, num_segments);
+
+	// 記号はGeometricUtility::DoesSegmentIntersectWithAnother()に合わせる. ABがsegment, CDがバッチ内の線分
+	const Vector2D AB_vector = segment.end - segment.start;
+	const SimdFloat A_x = Set(segment.start.x);
+	const SimdFloat A_y = Set(segment.start.y);
+	const SimdFloat AB_x = Set(AB_vector.x);
+	const SimdFloat AB_y = Set(AB_vector.y);
+	const SimdFloat epsilon = Set(EPSIRON);
+	const SimdFloat zero = Set(0.f);
+	const SimdFloat one = Set(1.f);
+
+	int num_hits = 0;
+	for (size_t i = 0; i < num_segments; i += SIMD_WIDTH)
+	{
+		const SimdFloat CD_x = Load(&batch.dir_x[i]);
+		const SimdFloat CD_y = Load(&batch.dir_y[i]);
+		const SimdFloat AC_x = Load(&batch.start_x[i]) - A_x;
+		const SimdFloat AC_y = Load(&batch.start_y[i]) - A_y;
+
+		const SimdFloat ABxCD = AB_x * CD_y - AB_y * CD_x;
+		const SimdFloat s = (AC_x * CD_y - AC_y * CD_x) / ABxCD;
+		const SimdFloat t = (AC_x * AB_y - AC_y * AB_x) / ABxCD;
+
+		// 平行な線分のレーンはゼロ除算の結果を含むが, 最初の条件で除外される
+		const SimdMask is_intersecting =
+			(Abs(ABxCD) >= epsilon) & (s >= zero) & (s <= one) & (t >= zero) & (t <= one);
+
+		const uint32_t hit_bits = ToBits(is_intersecting) & GetValidLaneBits(i, num_segments);
+		if (hit_bits == 0)
+		{
+			continue;
+		}
+
+		out_hit_masks[i / 32] |= hit_bits << (i % 32);
+
+		if (out_intersection_positions != nullptr)
+		{
+			float intersection_x[SIMD_WIDTH];
+			float intersection_y[SIMD_WIDTH];
+			Store(intersection_x, A_x + AB_x * s);
+			Store(intersection_y, A_y + AB_y * s);
+			for (int lane = 0; lane < SIMD_WIDTH; lane++)
+			{
+				if ((hit_bits >> lane) & 1u)
+				{
+					out_intersection_positions[i + lane] = Vector2D(intersection_x[lane], intersection_y[lane]);
+				}
+			}
+		}
+
+		for (uint32_t bits = hit_bits; bits != 0; bits &= bits - 1)
+		{
+			num_hits++;
+		}
+	}
+
+	return num_hits;
+}
+
+int GeometricUtilityBatch::GetSimdWidth()
+{
+	return SIMD_WIDTH;
+}
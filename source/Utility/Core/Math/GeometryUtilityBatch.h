@@ -0,0 +1,114 @@
+#pragma once
+#include "GeometryUtility.h"
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// 複数の矩形をまとめて判定するための, 矩形のSoA(Structure of Arrays)表現
+/// <para>幅ベクトルと高さベクトルは追加時に計算しておくので, 判定のたびに三角関数を呼ばない</para>
+/// <para>各配列の長さはSIMDの幅の倍数に切り上げてあり, 末尾の余りは0で埋める</para>
+/// </summary>
+class FRectBatch
+{
+public:
+	FRectBatch();
+
+	void Clear();
+	void Reserve(const size_t num_rects);
+	void Add(const FRect& rect);
+
+	size_t Size() const { return _num_rects; }
+
+	std::vector<float> center_x;
+	std::vector<float> center_y;
+	std::vector<float> wvec_x;
+	std::vector<float> wvec_y;
+	std::vector<float> hvec_x;
+	std::vector<float> hvec_y;
+
+private:
+	size_t _num_rects;
+};
+
+/// <summary>
+/// 複数の線分をまとめて判定するための, 線分のSoA表現
+/// <para>始点と, 始点から終点へのベクトルを持つ. 配列の長さの扱いはFRectBatchと同じ</para>
+/// </summary>
+class FSegmentBatch
+{
+public:
+	FSegmentBatch();
+
+	void Clear();
+	void Reserve(const size_t num_segments);
+	void Add(const FSegment& segment);
+
+	/// <summary>
+	/// 矩形の4辺を, GeometricUtility::GetSegmentRectIntersections()と同じ順番で追加する
+	/// </summary>
+	void AddRectEdges(const FRect& rect);
+
+	size_t Size() const { return _num_segments; }
+
+	std::vector<float> start_x;
+	std::vector<float> start_y;
+	std::vector<float> dir_x;
+	std::vector<float> dir_y;
+
+private:
+	size_t _num_segments;
+};
+
+/// <summary>
+/// 1つの図形を多数の図形とまとめて判定するGeometricUtilityのバッチ版
+/// <para>SSE2(AVX2が有効なビルドではAVX2)で4個(8個)ずつ判定する. CLN2D_DISABLE_SIMDを定義するとスカラー版になる</para>
+/// <para>結果はビットマスクで返す. i番目の図形の結果は out_hit_masks[i / 32] の (i % 32) ビット目</para>
+/// </summary>
+class GeometricUtilityBatch
+{
+public:
+	/// <summary>
+	/// 矩形とバッチ内の各矩形が重なっているか. GeometricUtility::DoesRectOverlapWithAnother()のバッチ版
+	/// <para>重なり判定は平方根を使わずに行うため, 接しているだけの場合などの境界付近では, スカラー版と結果が異なることがある</para>
+	/// </summary>
+	/// <param name="rect">矩形</param>
+	/// <param name="batch">判定相手の矩形</param>
+	/// <param name="out_hit_masks">重なっているかのビットマスク</param>
+	/// <param name="out_penetration_depths">nullptrでなければ, 重なっている矩形についてrectのめり込み深度を書き込む. batch.Size()個の要素が必要</param>
+	/// <returns>重なっている矩形の数</returns>
+	static int DoesRectOverlapWithBatch(
+		const FRect& rect,
+		const FRectBatch& batch,
+		std::vector<uint32_t>& out_hit_masks,
+		Vector2D* out_penetration_depths = nullptr
+	);
+
+	/// <summary>
+	/// 線分とバッチ内の各線分が交差するか. GeometricUtility::DoesSegmentIntersectWithAnother()のバッチ版
+	/// <para>スカラー版と同じ順番で演算するので, 結果はスカラー版と一致する</para>
+	/// </summary>
+	/// <param name="segment">線分</param>
+	/// <param name="batch">判定相手の線分</param>
+	/// <param name="out_hit_masks">交差するかのビットマスク</param>
+	/// <param name="out_intersection_positions">nullptrでなければ, 交差する線分について交点を書き込む. batch.Size()個の要素が必要</param>
+	/// <returns>交差する線分の数</returns>
+	static int DoesSegmentIntersectWithBatch(
+		const FSegment& segment,
+		const FSegmentBatch& batch,
+		std::vector<uint32_t>& out_hit_masks,
+		Vector2D* out_intersection_positions = nullptr
+	);
+
+	/// <summary>
+	/// 1回の判定でまとめて処理する図形の数
+	/// </summary>
+	static int GetSimdWidth();
+
+	/// <summary>
+	/// ビットマスクのindex番目のビットが立っているか
+	/// </summary>
+	static bool IsHit(const std::vector<uint32_t>& hit_masks, const size_t index)
+	{
+		return (hit_masks[index / 32] >> (index % 32)) & 1u;
+	}
+};
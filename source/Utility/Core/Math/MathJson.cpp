@@ -0,0 +1,34 @@
+#include "MathJson.h"
+#include <cassert>
+
+namespace {
+	constexpr const char* JKEY_POSITION = "position";
+	constexpr const char* JKEY_ROTATION = "rotation";
+}
+
+void MathJson::ToJsonValue(const Vector2D& vector, nlohmann::json& value_json)
+{
+	value_json = { vector.x, vector.y };
+}
+
+void MathJson::FromJsonValue(const nlohmann::json& value_json, Vector2D& out_vector)
+{
+	const bool json_is_valid =
+		value_json.is_array() && value_json.size() == 2;
+	assert(json_is_valid);
+
+	out_vector.x = value_json.at(0).get<float>();
+	out_vector.y = value_json.at(1).get<float>();
+}
+
+void MathJson::ToJsonObject(const Transform& transform, nlohmann::json& transform_json)
+{
+	ToJsonValue(transform.position, transform_json[JKEY_POSITION]);
+	transform_json[JKEY_ROTATION] = transform.rotation;
+}
+
+void MathJson::FromJsonObject(const nlohmann::json& transform_json, Transform& out_transform)
+{
+	FromJsonValue(transform_json.at(JKEY_POSITION), out_transform.position);
+	transform_json.at(JKEY_ROTATION).get_to(out_transform.rotation);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include "Vector2D.h"
+#include "Transform.h"
+
+/// <summary>
+/// 数学の値型とJsonの相互変換
+/// <para>Vector2DやTransformは仮想関数を持たないので, IJsonValue, IJsonObjectの代わりにこれらの関数を使う</para>
+/// </summary>
+namespace MathJson
+{
+	/// <summary>
+	/// [x, y]の配列に変換する
+	/// </summary>
+	void ToJsonValue(const Vector2D& vector, nlohmann::json& value_json);
+
+	/// <summary>
+	/// [x, y]の配列から読み込む
+	/// </summary>
+	void FromJsonValue(const nlohmann::json& value_json, Vector2D& out_vector);
+
+	/// <summary>
+	/// {"position": [x, y], "rotation": r}のオブジェクトに変換する
+	/// </summary>
+	void ToJsonObject(const Transform& transform, nlohmann::json& transform_json);
+	void FromJsonObject(const nlohmann::json& transform_json, Transform& out_transform);
+}
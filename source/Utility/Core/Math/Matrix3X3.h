@@ -7,27 +7,68 @@ struct Matrix3x3
 	static const Matrix3x3 Zero;
 	static const Matrix3x3 Identity;
 
-	Matrix3x3();
+	constexpr Matrix3x3()
+		: _00(0.f), _01(0.f), _02(0.f)
+		, _10(0.f), _11(0.f), _12(0.f)
+		, _20(0.f), _21(0.f), _22(0.f)
+	{}
 
-	Matrix3x3(
+	constexpr Matrix3x3(
 		const float in_00, const float in_01, const float in_02,
 		const float in_10, const float in_11, const float in_12,
 		const float in_20, const float in_21, const float in_22
-	);
+	)
+		: _00(in_00), _01(in_01), _02(in_02)
+		, _10(in_10), _11(in_11), _12(in_12)
+		, _20(in_20), _21(in_21), _22(in_22)
+	{}
 
 	/// <summary>
 	/// DirectX::XMMATRIXに変換
 	/// </summary>
-	DirectX::XMMATRIX ToXMMATRIX() const;
+	DirectX::XMMATRIX ToXMMATRIX() const
+	{
+		return DirectX::XMMATRIX(
+			_00, _01, _02, 0.f,
+			_10, _11, _12, 0.f,
+			_20, _21, _22, 0.f,
+			0.f, 0.f, 0.f, 1.f
+		);
+	}
 
 	////////////
 	/// 算術演算子
 	////////////
-	Matrix3x3 operator*(const Matrix3x3& rhs) const;
+	constexpr Matrix3x3 operator*(const Matrix3x3& rhs) const
+	{
+		return Matrix3x3(
+			_00 * rhs._00 + _01 * rhs._10 + _02 * rhs._20,
+			_00 * rhs._01 + _01 * rhs._11 + _02 * rhs._21,
+			_00 * rhs._02 + _01 * rhs._12 + _02 * rhs._22,
+
+			_10 * rhs._00 + _11 * rhs._10 + _12 * rhs._20,
+			_10 * rhs._01 + _11 * rhs._11 + _12 * rhs._21,
+			_10 * rhs._02 + _11 * rhs._12 + _12 * rhs._22,
+
+			_20 * rhs._00 + _21 * rhs._10 + _22 * rhs._20,
+			_20 * rhs._01 + _21 * rhs._11 + _22 * rhs._21,
+			_20 * rhs._02 + _21 * rhs._12 + _22 * rhs._22
+		);
+	}
 
 	// (in_v.x, in_v.y, 1.f)の3次元ベクトルを変換
-	Vector2D TransformVector(const Vector2D& in_v) const;
-	void TransformVector(const Vector2D& in_v, Vector2D& out_v) const;
+	constexpr Vector2D TransformVector(const Vector2D& in_v) const
+	{
+		return Vector2D(
+			_00 * in_v.x + _01 * in_v.y + _02,
+			_10 * in_v.x + _11 * in_v.y + _12
+		);
+	}
+
+	constexpr void TransformVector(const Vector2D& in_v, Vector2D& out_v) const
+	{
+		out_v = TransformVector(in_v);
+	}
 
 	float _00;
 	float _01;
@@ -38,4 +79,6 @@ struct Matrix3x3
 	float _20;
 	float _21;
 	float _22;
-};
\ No newline at end of file
+};
+
+static_assert(std::is_trivially_copyable_v<Matrix3x3>, "Matrix3x3 must be trivially copyable");
@@ -21,6 +21,10 @@ float RandomNumberGenerator::GetRandomFloat(float min, float max)
 
 uint64_t RandomNumberGenerator::GetRandomUint64()
 {
+	if (!_generator_64)
+	{
+		CreateGenerators();
+	}
 	return (*_generator_64)();
 }
 
@@ -55,6 +59,30 @@ bool RandomNumberGenerator::ReturnTrueWithProbability(const float p)
 	return GetNormalizedRandomValue() < p;
 }
 
+void RandomNumberGenerator::SetSeed(const uint64_t seed)
+{
+	delete _generator_32;
+	delete _generator_64;
+
+	// 32bit版と64bit版が同じ列にならないよう, シードを分ける
+	std::seed_seq seed_seq_32{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+	_generator_32 = new std::mt19937(seed_seq_32);
+	_generator_64 = new std::mt19937_64(seed ^ 0x9E37'79B9'7F4A'7C15);
+}
+
+void RandomNumberGenerator::ResetSeed()
+{
+	delete _generator_32;
+	delete _generator_64;
+	CreateGenerators();
+}
+
+uint64_t RandomNumberGenerator::GenerateSeed()
+{
+	std::random_device rd;
+	return (static_cast<uint64_t>(rd()) << 32) | rd();
+}
+
 void RandomNumberGenerator::CreateGenerators()
 {
 	std::random_device rd;
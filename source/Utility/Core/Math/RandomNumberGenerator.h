@@ -28,6 +28,22 @@ public:
 	/// <param name="p">確率を表す[0,1]の値</param>
 	static bool ReturnTrueWithProbability(const float p);
 
+	/// <summary>
+	/// 乱数生成器を指定したシードで作り直す. 同じシードから同じ順に呼び出せば同じ値の列が得られる
+	/// <para>入力の記録と再生で, ワールドの更新を再現するために使う</para>
+	/// </summary>
+	static void SetSeed(const uint64_t seed);
+
+	/// <summary>
+	/// 乱数生成器を非決定的なシードで作り直す
+	/// </summary>
+	static void ResetSeed();
+
+	/// <summary>
+	/// 非決定的なシードを1つ生成する. SetSeed()に渡して, 記録に残すシードとして使う
+	/// </summary>
+	static uint64_t GenerateSeed();
+
 private:
 	static void CreateGenerators();
 
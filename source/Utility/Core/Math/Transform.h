@@ -1,45 +1,63 @@
 #pragma once
 
-#include "Utility/IJsonSerializable.h"
-#include "Scene/StageInteractiveScene/StageEditorScene/ParameterEditing/IEditableParameter.h"
 #include "Vector2D.h"
 #include "Matrix3X3.h"
+#include <cmath>
 
-struct Transform : public IJsonObject, public IEditableParameter
+/// <summary>
+/// 位置と回転. 仮想関数を持たない値型
+/// <para>Json変換はMathJson.h, ステージエディタでの編集はTransformParamEdit.hの関数で行う</para>
+/// </summary>
+struct Transform
 {
-	Transform()
+	constexpr Transform()
 		: position(Vector2D())
 		, rotation(0.f)
 	{
 	}
-	Transform(const Vector2D& in_pos, const float in_rot)
+	constexpr Transform(const Vector2D& in_pos, const float in_rot)
 		: position(in_pos)
 		, rotation(in_rot)
 	{
 	}
 
-	//~ Begin IJsonObject interface
-	virtual void ToJsonObject(nlohmann::json& transform_json) const override;
-	virtual void FromJsonObject(const nlohmann::json& transform_json) override;
-	//~ End IJsonObject interface
-
-	//~ Begin IEditableParameter interface
-	virtual void AddToParamEditGroup
-	(
-		const std::shared_ptr<ParamEditGroup>& parent,
-		const std::shared_ptr<CommandHistory>& command_history
-	) override;
-	//~ End IEditableParameter interface
-
-	Transform operator*(const Transform& rhs) const;
-	Matrix3x3 ToMatrix3x3() const;
-	Matrix3x3 ToMatrix3x3Inverse() const;
-	Vector2D TransformLocation(const Vector2D& in_vec) const;
-	Vector2D TransformDirection(const Vector2D& in_vec) const;
-	float TransformRotation(const float in_rot) const;
-	Vector2D InverseTransformLocaltion(const Vector2D& in_vec) const;
-	float InverseTransformRotation(const float in_rot) const;
+	Matrix3x3 ToMatrix3x3() const
+	{
+		const float cos_rotation = std::cos(rotation);
+		const float sin_rotation = std::sin(rotation);
+		return Matrix3x3(
+			cos_rotation, -sin_rotation, position.x,
+			sin_rotation, cos_rotation, position.y,
+			0, 0, 1
+		);
+	}
+
+	Matrix3x3 ToMatrix3x3Inverse() const
+	{
+		const float cos_rotation = std::cos(rotation);
+		const float sin_rotation = std::sin(rotation);
+		return Matrix3x3(
+			cos_rotation, sin_rotation, -position.x * cos_rotation - position.y * sin_rotation,
+			-sin_rotation, cos_rotation, position.x * sin_rotation - position.y * cos_rotation,
+			0, 0, 1
+		);
+	}
+
+	Vector2D TransformLocation(const Vector2D& in_vec) const { return ToMatrix3x3().TransformVector(in_vec); }
+
+	Vector2D TransformDirection(const Vector2D& in_vec) const
+	{
+		const float cos_rotation = std::cos(rotation);
+		const float sin_rotation = std::sin(rotation);
+		return Vector2D(cos_rotation * in_vec.x - sin_rotation * in_vec.y, sin_rotation * in_vec.x + cos_rotation * in_vec.y);
+	}
+
+	constexpr float TransformRotation(const float in_rot) const { return in_rot + rotation; }
+	Vector2D InverseTransformLocaltion(const Vector2D& in_vec) const { return ToMatrix3x3Inverse().TransformVector(in_vec); }
+	constexpr float InverseTransformRotation(const float in_rot) const { return in_rot - rotation; }
 
 	Vector2D position;
 	float rotation;
-};
\ No newline at end of file
+};
+
+static_assert(std::is_trivially_copyable_v<Transform>, "Transform must be trivially copyable");
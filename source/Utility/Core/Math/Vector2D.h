@@ -3,97 +3,139 @@
 #include <iosfwd>
 #include <vector>
 #include <array>
-#include "Utility/IJsonSerializable.h"
+#include <cmath>
+#include <type_traits>
 
 struct CameraParams;
 
 /**
  * 2Dベクトルクラス
+ * 仮想関数を持たない8バイトの値型. Json変換はMathJson.hの関数で行う
  */
-struct Vector2D : public IJsonValue
+struct Vector2D
 {
 public:
-	Vector2D()
+	constexpr Vector2D()
 		: x(0.0f), y(0.0f)
 	{}
 
-	Vector2D(float in_x, float in_y)
+	constexpr Vector2D(float in_x, float in_y)
 		: x(in_x), y(in_y)
 	{}
 
 	template <class T>
 	explicit Vector2D(const std::vector<T>& xy_vector)
-	{
-		x = static_cast<float>(xy_vector.at(0));
-		y = static_cast<float>(xy_vector.at(1));
-	}
+		: x(static_cast<float>(xy_vector.at(0)))
+		, y(static_cast<float>(xy_vector.at(1)))
+	{}
 
-	explicit Vector2D(const std::array<float, 2>& std_arr)
-		: x(std_arr.at(0)), y(std_arr.at(1))
+	explicit constexpr Vector2D(const std::array<float, 2>& std_arr)
+		: x(std_arr[0]), y(std_arr[1])
 	{}
 
-	explicit operator std::array<float,2>()const;
+	explicit constexpr operator std::array<float, 2>() const
+	{
+		return std::array<float, 2>{ x, y };
+	}
 
-	//~ Begin IJsonValue interface
-	virtual void ToJsonValue(nlohmann::json& value_json) const override;
-	virtual void FromJsonValue(const nlohmann::json& value_json) override;
-	//~ End IJsonValue interface
+	constexpr Vector2D& operator=(const std::array<float, 2>& std_arr)
+	{
+		x = std_arr[0];
+		y = std_arr[1];
+		return *this;
+	}
 
-	Vector2D& operator=(const Vector2D& in_vector);
-	Vector2D& operator=(const std::array<float, 2>& std_arr);
+	constexpr Vector2D operator +(const Vector2D& in_vector) const { return Vector2D(x + in_vector.x, y + in_vector.y); }
+	constexpr Vector2D& operator +=(const Vector2D& in_vector) { x += in_vector.x; y += in_vector.y; return *this; }
+	constexpr Vector2D operator -(const Vector2D& in_vector) const { return Vector2D(x - in_vector.x, y - in_vector.y); }
+	constexpr Vector2D& operator -=(const Vector2D& in_vector) { x -= in_vector.x; y -= in_vector.y; return *this; }
+	constexpr Vector2D operator *(float in_scalar) const { return Vector2D(x * in_scalar, y * in_scalar); }
+	constexpr Vector2D& operator *=(float in_scalar) { x *= in_scalar; y *= in_scalar; return *this; }
+	constexpr Vector2D operator *(const Vector2D& in_vector) const { return Vector2D(x * in_vector.x, y * in_vector.y); }
+	constexpr Vector2D& operator *=(const Vector2D& in_vector) { x *= in_vector.x; y *= in_vector.y; return *this; }
+
+	// ゼロ除算は結果を0にする
+	constexpr Vector2D operator /(float in_scalar) const
+	{
+		return in_scalar == 0.f ? Vector2D(0.f, 0.f) : Vector2D(x / in_scalar, y / in_scalar);
+	}
 
-	const Vector2D operator +(const Vector2D& in_vector) const;
-	Vector2D& operator +=(const Vector2D& in_vector);
-	const Vector2D operator -(const Vector2D& in_vector) const;
-	Vector2D& operator -=(const Vector2D& in_vector);
-	const Vector2D operator *(float in_scalar) const;
-	Vector2D& operator *=(float in_scalar);
-	const Vector2D operator *(const Vector2D& in_vector) const;
-	Vector2D& operator *=(const Vector2D& in_vector);
-	const Vector2D operator /(float in_scalar) const;
-	Vector2D& operator /=(float in_scalars);
+	constexpr Vector2D& operator /=(float in_scalar)
+	{
+		*this = *this / in_scalar;
+		return *this;
+	}
 
-	bool operator==(const Vector2D& in_vector) const;
-	bool operator!=(const Vector2D& in_vector) const;
+	constexpr bool operator==(const Vector2D& in_vector) const { return x == in_vector.x && y == in_vector.y; }
+	constexpr bool operator!=(const Vector2D& in_vector) const { return !(*this == in_vector); }
 
 	/// <summary>
 	/// X方向単位ベクトル
 	/// </summary>
 	/// <returns></returns>
-	static Vector2D ex();
+	static constexpr Vector2D ex() { return Vector2D(1.f, 0.f); }
 
 	/// <summary>
 	/// Y方向単位ベクトル
 	/// </summary>
 	/// <returns></returns>
-	static Vector2D ey();
+	static constexpr Vector2D ey() { return Vector2D(0.f, 1.f); }
 
-	static float Dot(const Vector2D& a, const Vector2D& b);
-	static float Cross(const Vector2D& a, const Vector2D& b);
-	static Vector2D Rotate(const Vector2D& a, float theta_rad);
-	Vector2D GetRotated(const float theta_rad) const;
+	static constexpr float Dot(const Vector2D& a, const Vector2D& b) { return (a.x * b.x) + (a.y * b.y); }
+	static constexpr float Cross(const Vector2D& a, const Vector2D& b) { return (a.x * b.y) - (a.y * b.x); }
+
+	static Vector2D Rotate(const Vector2D& a, float theta_rad)
+	{
+		if (theta_rad == 0.f)
+		{
+			return a;
+		}
+
+		const float cos_theta = std::cos(theta_rad);
+		const float sin_theta = std::sin(theta_rad);
+		return Vector2D(a.x * cos_theta - a.y * sin_theta, a.x * sin_theta + a.y * cos_theta);
+	}
+
+	Vector2D GetRotated(const float theta_rad) const { return Vector2D::Rotate(*this, theta_rad); }
 
 	// ワールド座標をビューポート座標に変換
 	// TODO: CameraParams::TransformPosition_WorldToViewportで置換
 	static Vector2D WorldToViewport(const Vector2D& world_position,const CameraParams& viewport_params);
-	
-	bool IsZeroVector() const;
-	float Length() const;
-	float LengthSquared() const;
-	Vector2D Normalize() const;
 
-	Vector2D GetX() const;
-	Vector2D GetY() const;
+	constexpr bool IsZeroVector() const { return x == 0.f && y == 0.f; }
+	float Length() const { return std::sqrt(LengthSquared()); }
+	constexpr float LengthSquared() const { return x * x + y * y; }
+	Vector2D Normalize() const { return *this / Length(); }
+
+	constexpr Vector2D GetX() const { return Vector2D(x, 0.f); }
+	constexpr Vector2D GetY() const { return Vector2D(0.f, y); }
 
 	// 四捨五入によるintへの変換
-	void ToIntRound(int& out_x, int& out_y) const;
+	void ToIntRound(int& out_x, int& out_y) const
+	{
+		out_x = static_cast<int>(std::round(x));
+		out_y = static_cast<int>(std::round(y));
+	}
+
 	// 切り捨てによるintへの変換
-	void ToIntFloor(int& out_x, int& out_y) const;
+	void ToIntFloor(int& out_x, int& out_y) const
+	{
+		out_x = static_cast<int>(std::floor(x));
+		out_y = static_cast<int>(std::floor(y));
+	}
+
 	// 切り上げによるintへの変換
-	void ToIntCeil(int& out_x, int& out_y) const;
+	void ToIntCeil(int& out_x, int& out_y) const
+	{
+		out_x = static_cast<int>(std::ceil(x));
+		out_y = static_cast<int>(std::ceil(y));
+	}
 
 public:
 	float x, y;
 };
 
-std::ostream& operator<<(std::ostream& os, const Vector2D& v);
\ No newline at end of file
+static_assert(sizeof(Vector2D) == 2 * sizeof(float), "Vector2D must not have padding or a vtable");
+static_assert(std::is_trivially_copyable_v<Vector2D>, "Vector2D must be trivially copyable");
+
+std::ostream& operator<<(std::ostream& os, const Vector2D& v);
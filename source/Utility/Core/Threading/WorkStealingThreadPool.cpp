@@ -0,0 +1,172 @@
+#include "WorkStealingThreadPool.h"
+#include <algorithm>
+#include <stdexcept>
+
+WorkStealingThreadPool::WorkStealingThreadPool(const int num_threads)
+	: _current_func(nullptr)
+	, _job_generation(0)
+	, _should_quit(false)
+	, _num_remaining_tasks(0)
+{
+	if (num_threads < 1)
+	{
+		throw std::invalid_argument("WorkStealingThreadPool requires at least one thread");
+	}
+
+	for (int i = 0; i < num_threads; ++i)
+	{
+		_queues.push_back(std::make_unique<WorkQueue>());
+	}
+
+	// スレッド番号0は呼び出し元スレッド
+	for (int i = 1; i < num_threads; ++i)
+	{
+		_workers.emplace_back(&WorkStealingThreadPool::WorkerLoop, this, i);
+	}
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_job_mutex);
+		_should_quit = true;
+	}
+	_job_cv.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		worker.join();
+	}
+}
+
+void WorkStealingThreadPool::ParallelFor(const int num_items, const int chunk_size, const std::function<void(int, int, int)>& func)
+{
+	if (num_items <= 0)
+	{
+		return;
+	}
+
+	const int num_threads = GetNumThreads();
+	const int actual_chunk_size = (std::max)(chunk_size, 1);
+	const int num_tasks = (num_items + actual_chunk_size - 1) / actual_chunk_size;
+
+	// 1スレッドまたは1タスクならスレッドを起こさずに処理する
+	if (num_threads == 1 || num_tasks == 1)
+	{
+		func(0, num_items, 0);
+		return;
+	}
+
+	_exception = nullptr;
+	_current_func = &func;
+	_num_remaining_tasks.store(num_tasks);
+
+	// 連続したタスクが同じスレッドに割り当たるようにブロック単位で配る
+	for (int task_index = 0; task_index < num_tasks; ++task_index)
+	{
+		const int thread_index = static_cast<int>(static_cast<int64_t>(task_index) * num_threads / num_tasks);
+		Task task;
+		task.begin = task_index * actual_chunk_size;
+		task.end = (std::min)(task.begin + actual_chunk_size, num_items);
+
+		WorkQueue& queue = *_queues[thread_index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(task);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_job_mutex);
+		++_job_generation;
+	}
+	_job_cv.notify_all();
+
+	RunTasks(0);
+
+	{
+		std::unique_lock<std::mutex> lock(_job_mutex);
+		_done_cv.wait(lock, [this]() { return _num_remaining_tasks.load() == 0; });
+	}
+	_current_func = nullptr;
+
+	if (_exception)
+	{
+		std::rethrow_exception(_exception);
+	}
+}
+
+void WorkStealingThreadPool::WorkerLoop(const int thread_index)
+{
+	uint64_t last_generation = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_job_mutex);
+			_job_cv.wait(lock, [this, last_generation]() { return _should_quit || _job_generation != last_generation; });
+			if (_should_quit)
+			{
+				return;
+			}
+			last_generation = _job_generation;
+		}
+
+		RunTasks(thread_index);
+	}
+}
+
+void WorkStealingThreadPool::RunTasks(const int thread_index)
+{
+	Task task;
+	while (TryPopTask(thread_index, task))
+	{
+		try
+		{
+			(*_current_func)(task.begin, task.end, thread_index);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(_exception_mutex);
+			if (!_exception)
+			{
+				_exception = std::current_exception();
+			}
+		}
+
+		if (_num_remaining_tasks.fetch_sub(1) == 1)
+		{
+			// 最後のタスク. 待機中の呼び出し元スレッドを起こす
+			std::lock_guard<std::mutex> lock(_job_mutex);
+			_done_cv.notify_all();
+		}
+	}
+}
+
+bool WorkStealingThreadPool::TryPopTask(const int thread_index, Task& out_task)
+{
+	// 自分のキューの末尾から取り出す
+	{
+		WorkQueue& own_queue = *_queues[thread_index];
+		std::lock_guard<std::mutex> lock(own_queue.mutex);
+		if (!own_queue.tasks.empty())
+		{
+			out_task = own_queue.tasks.back();
+			own_queue.tasks.pop_back();
+			return true;
+		}
+	}
+
+	// 他スレッドのキューの先頭から盗む
+	const int num_threads = GetNumThreads();
+	for (int offset = 1; offset < num_threads; ++offset)
+	{
+		WorkQueue& victim_queue = *_queues[(thread_index + offset) % num_threads];
+		std::lock_guard<std::mutex> lock(victim_queue.mutex);
+		if (!victim_queue.tasks.empty())
+		{
+			out_task = victim_queue.tasks.front();
+			victim_queue.tasks.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
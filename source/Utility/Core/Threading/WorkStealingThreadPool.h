@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <cstdint>
+
+/// <summary>
+/// ワークスティーリング方式のスレッドプール
+/// <para>各スレッドが自分のタスクキューを持ち, 自分のキューが空になったら他スレッドのキューの先頭からタスクを盗む.</para>
+/// <para>ParallelFor()を呼んだスレッドもスレッド番号0として処理に参加し, 全タスクが終わるまで戻らない</para>
+/// </summary>
+class WorkStealingThreadPool
+{
+public:
+	/// <param name="num_threads">呼び出し元スレッドを含むスレッド数. 1以上</param>
+	explicit WorkStealingThreadPool(const int num_threads);
+	~WorkStealingThreadPool();
+
+	WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+	/// <summary>
+	/// 呼び出し元スレッドを含むスレッド数
+	/// </summary>
+	int GetNumThreads() const { return static_cast<int>(_queues.size()); }
+
+	/// <summary>
+	/// [0, num_items)をchunk_size個ずつのタスクに分割し, 全スレッドで処理する.
+	/// <para>タスク内で投げられた例外は, 全タスクの終了後に呼び出し元スレッドで投げ直される (最初の1つのみ)</para>
+	/// </summary>
+	/// <param name="num_items">要素数</param>
+	/// <param name="chunk_size">1タスクあたりの要素数</param>
+	/// <param name="func">void(int begin, int end, int thread_index). [begin, end)を処理する</param>
+	void ParallelFor(const int num_items, const int chunk_size, const std::function<void(int, int, int)>& func);
+
+private:
+	struct Task
+	{
+		int begin;
+		int end;
+	};
+
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void WorkerLoop(const int thread_index);
+
+	/// <summary>
+	/// タスクがなくなるまで実行する
+	/// </summary>
+	void RunTasks(const int thread_index);
+
+	/// <summary>
+	/// 自分のキューの末尾からタスクを取り出す. 空なら他スレッドのキューの先頭から盗む
+	/// </summary>
+	bool TryPopTask(const int thread_index, Task& out_task);
+
+	std::vector<std::thread> _workers;
+	std::vector<std::unique_ptr<WorkQueue>> _queues;
+
+	// 実行中のParallelFor()の処理
+	const std::function<void(int, int, int)>* _current_func;
+
+	std::mutex _job_mutex;
+	std::condition_variable _job_cv;
+	std::condition_variable _done_cv;
+	uint64_t _job_generation;
+	bool _should_quit;
+
+	// 実行中のParallelFor()の未完了タスク数
+	std::atomic<int> _num_remaining_tasks;
+
+	std::mutex _exception_mutex;
+	std::exception_ptr _exception;
+};
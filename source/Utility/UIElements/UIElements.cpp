@@ -69,7 +69,7 @@ UIElements::ImageRectangle::ImageRectangle(const int graphic_handle, const float
 
 void UIElements::ImageRectangle::Draw(const Vector2D& left_top, const Vector2D& extent) const
 {
-	__super::Draw(left_top, extent);
+	Rectangle::Draw(left_top, extent);
 	int draw_center_x, draw_center_y;
 	CalcRectCenter(left_top, extent).ToIntRound(draw_center_x, draw_center_y);
 
@@ -0,0 +1,186 @@
+#pragma once
+#include "Actor/Actor.h"
+#include "Actor/ActorFactory.h"
+#include "Component/Collider/BoxCollider.h"
+#include "GameSystems/CollisionManager.h"
+#include "Scene/SceneBase.h"
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/// <summary>
+/// CollisionStressField::Spawn()の設定
+/// </summary>
+struct CollisionStressFieldParams
+{
+	int num_dynamic_colliders = 1000;
+
+	// ステージのブロックを模した, タイルに揃えて配置する静的コライダーの数
+	int num_static_colliders = 4000;
+
+	// BLOCKなら動的コライダー同士と静的コライダーで押し戻し合う. OVERLAPなら押し戻しは起こらない
+	CollisionType dynamic_collision_type = CollisionType::OVERLAP;
+
+	uint32_t seed = 12345;
+};
+
+/// <summary>
+/// 衝突処理のテストとベンチマークで使う, 多数のコライダーを領域の中で動かし続ける場
+/// <para>計測に描画やアクターのTickのコストが混ざらないよう, アクターはシーンに追加せず, この場が直接移動させる</para>
+/// <para>配置と速度はシードだけで決まるので, 同じ設定なら毎回同じコライダーが生成される</para>
+/// </summary>
+class CollisionStressField
+{
+public:
+	// シミュレーションの固定ステップ
+	static constexpr float DELTA_SECONDS = 1.f / 60.f;
+
+	explicit CollisionStressField(SceneBase* const owner_scene)
+		: _owner_scene(owner_scene)
+		, _area(Vector2D(0, 0), Vector2D(8192, 2048))
+	{
+	}
+
+	~CollisionStressField()
+	{
+		Destroy();
+	}
+
+	CollisionStressField(const CollisionStressField&) = delete;
+	CollisionStressField& operator=(const CollisionStressField&) = delete;
+
+	/// <summary>
+	/// コライダーを破棄し, 設定に従って生成し直す. 静的コライダーを登録するため, ツリーも作り直す
+	/// </summary>
+	void Spawn(const CollisionStressFieldParams& params)
+	{
+		Destroy();
+
+		std::mt19937 engine(params.seed);
+		const auto random_float = [&engine](const float min, const float max)
+			{
+				return std::uniform_real_distribution<float>(min, max)(engine);
+			};
+
+		CollisionManager::GetInstance().DestructTree();
+
+		_static_actors.reserve(params.num_static_colliders);
+		for (int i = 0; i < params.num_static_colliders; ++i)
+		{
+			// タイルの位置に揃えて配置する
+			const Vector2D position(
+				floorf(random_float(_area.left_top.x, _area.right_bottom.x) / STATIC_COLLIDER_EXTENT) * STATIC_COLLIDER_EXTENT,
+				floorf(random_float(_area.left_top.y, _area.right_bottom.y) / STATIC_COLLIDER_EXTENT) * STATIC_COLLIDER_EXTENT
+			);
+			BoxCollider* const collider = SpawnBoxActor(_static_actors, position);
+			collider->SetBoxColliderParams(
+				CollisionType::BLOCK,
+				CollisionObjectType::GROUND,
+				{ CollisionObjectType::ENEMY },
+				false,
+				Vector2D(STATIC_COLLIDER_EXTENT, STATIC_COLLIDER_EXTENT)
+			);
+			collider->SetMobility(ColliderMobility::STATIC);
+		}
+
+		CollisionManager::GetInstance().ConstructTree();
+
+		_dynamic_actors.reserve(params.num_dynamic_colliders);
+		_velocities.reserve(params.num_dynamic_colliders);
+		for (int i = 0; i < params.num_dynamic_colliders; ++i)
+		{
+			const Vector2D position(
+				random_float(_area.left_top.x, _area.right_bottom.x),
+				random_float(_area.left_top.y, _area.right_bottom.y)
+			);
+			const Vector2D extent(
+				random_float(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT),
+				random_float(MIN_COLLIDER_EXTENT, MAX_COLLIDER_EXTENT)
+			);
+			BoxCollider* const collider = SpawnBoxActor(_dynamic_actors, position);
+			collider->SetBoxColliderParams(
+				params.dynamic_collision_type,
+				CollisionObjectType::ENEMY,
+				{ CollisionObjectType::ENEMY, CollisionObjectType::GROUND },
+				params.dynamic_collision_type == CollisionType::BLOCK,
+				extent
+			);
+
+			_velocities.push_back(Vector2D(
+				random_float(-MAX_COLLIDER_SPEED, MAX_COLLIDER_SPEED),
+				random_float(-MAX_COLLIDER_SPEED, MAX_COLLIDER_SPEED)
+			));
+		}
+	}
+
+	void Destroy()
+	{
+		for (std::vector<Actor*>* const actors : { &_dynamic_actors, &_static_actors })
+		{
+			for (Actor*& actor : *actors)
+			{
+				actor->Finalize();
+				ActorFactory::DestroyActor(actor);
+			}
+			actors->clear();
+		}
+		_velocities.clear();
+	}
+
+	/// <summary>
+	/// 動的コライダーを速度に従って移動させる. 領域の端では反射させる
+	/// <para>移動はブロードフェーズの更新を含む</para>
+	/// </summary>
+	void MoveColliders()
+	{
+		for (size_t i = 0; i < _dynamic_actors.size(); ++i)
+		{
+			Actor* const actor = _dynamic_actors[i];
+			Vector2D& velocity = _velocities[i];
+
+			const Vector2D position = actor->GetActorWorldPosition() + velocity * DELTA_SECONDS;
+			if (position.x < _area.left_top.x || _area.right_bottom.x < position.x)
+			{
+				velocity.x *= -1.f;
+			}
+			if (position.y < _area.left_top.y || _area.right_bottom.y < position.y)
+			{
+				velocity.y *= -1.f;
+			}
+
+			actor->AddWorldPosition(velocity * DELTA_SECONDS);
+		}
+	}
+
+	const std::vector<Actor*>& GetDynamicActors() const { return _dynamic_actors; }
+
+private:
+	// コライダーの一辺の長さの範囲
+	static constexpr float MIN_COLLIDER_EXTENT = 16.f;
+	static constexpr float MAX_COLLIDER_EXTENT = 48.f;
+
+	// 静的コライダーの一辺の長さ
+	static constexpr float STATIC_COLLIDER_EXTENT = 32.f;
+
+	// コライダーの移動速さの最大値 [px/s]
+	static constexpr float MAX_COLLIDER_SPEED = 600.f;
+
+	BoxCollider* SpawnBoxActor(std::vector<Actor*>& out_actors, const Vector2D& position)
+	{
+		initial_params_of_actor_t<Actor> actor_params;
+		actor_params.transform.position = position;
+		Actor* const actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, _owner_scene);
+		out_actors.push_back(actor);
+		return actor->CreateComponent<BoxCollider>(actor);
+	}
+
+	SceneBase* _owner_scene;
+
+	// コライダーを配置する領域
+	FRectAA _area;
+
+	std::vector<Actor*> _dynamic_actors;
+	std::vector<Vector2D> _velocities;
+	std::vector<Actor*> _static_actors;
+};
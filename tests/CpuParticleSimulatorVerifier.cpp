@@ -0,0 +1,217 @@
+#include "CpuParticleSimulatorVerifier.h"
+#include "GameSystems/ParticleManager/CpuParticleSimulator.h"
+#include "SystemTypes.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+
+namespace
+{
+	// 不一致をこれ以上表示しない
+	constexpr size_t MAX_VALIDATION_FAILURES = 32;
+
+	// 1フレームに生成するパーティクル数の最大
+	constexpr int MAX_SPAWN_PER_FRAME = 24;
+
+	float RandomRange(std::mt19937& engine, const float min, const float max)
+	{
+		return std::uniform_real_distribution<float>(min, max)(engine);
+	}
+
+	uint32_t RandomUint(std::mt19937& engine, const uint32_t min, const uint32_t max)
+	{
+		return std::uniform_int_distribution<uint32_t>(min, max)(engine);
+	}
+
+	/// <summary>
+	/// アニメーションのループ回数や寿命0のパーティクルも含めて, 更新の分岐を全て通るようにする
+	/// </summary>
+	Particle MakeRandomParticle(std::mt19937& engine)
+	{
+		Particle p;
+		p.size = RandomRange(engine, 4.f, 32.f);
+		p.life_time = RandomUint(engine, 0, 49) == 0 ? 0.f : RandomRange(engine, 0.01f, 3.f);
+		p.gravity_scale = RandomRange(engine, -1.f, 2.f);
+		p.pos.x = RandomRange(engine, -500.f, 500.f);
+		p.pos.y = RandomRange(engine, -500.f, 500.f);
+		p.vel.x = RandomRange(engine, -300.f, 300.f);
+		p.vel.y = RandomRange(engine, -300.f, 300.f);
+		p.num_anim_frames = RandomUint(engine, 1, 8);
+		p.loop_start_offset = RandomUint(engine, 0, p.num_anim_frames - 1);
+		p.anim_first_frame = RandomUint(engine, 0, 15);
+		p.frame_duration = RandomRange(engine, 0.02f, 0.3f);
+		p.SetMaxLoop(RandomUint(engine, 0, 3));
+		p.SetBlendMode(RandomUint(engine, 0, 2));
+		p.SetTextureIndex(RandomUint(engine, 0, MAX_TEXTURES_NUM - 1));
+		return p;
+	}
+
+	bool IsActive(const Particle& particle)
+	{
+		return (particle.packed_data & Particle::is_active_mask) != 0;
+	}
+
+	double GetElapsedSeconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+
+	void AddFailure(CpuParticleValidationReport& report, const std::string& failure)
+	{
+		report.num_failures++;
+		if (report.failures.size() < MAX_VALIDATION_FAILURES)
+		{
+			report.failures.push_back(failure);
+		}
+	}
+}
+
+CpuParticleValidationReport CpuParticleSimulatorVerifier::RunValidation(const uint32_t seed, const uint32_t capacity, const int num_frames)
+{
+	CpuParticleValidationReport report{};
+	report.num_frames = num_frames;
+
+	std::mt19937 engine(seed);
+	CpuParticleSimulator simulator(capacity);
+
+	// スロットごとの期待値. 生成されたスロットはシミュレーターから読み取る
+	std::vector<Particle> expected(capacity);
+	for (uint32_t i = 0; i < capacity; i++)
+	{
+		expected[i] = simulator.GetParticle(i);
+	}
+
+	std::vector<Particle> spawn_particles;
+	for (int frame = 0; frame < num_frames; frame++)
+	{
+		spawn_particles.resize(RandomUint(engine, 0, MAX_SPAWN_PER_FRAME));
+		for (Particle& p : spawn_particles)
+		{
+			p = MakeRandomParticle(engine);
+		}
+
+		const uint32_t num_spawn = static_cast<uint32_t>(spawn_particles.size());
+		const bool expected_spawn_result = simulator.GetPoolCount() >= num_spawn;
+		if (simulator.Spawn(spawn_particles.data(), num_spawn) != expected_spawn_result)
+		{
+			AddFailure(report, "frame " + std::to_string(frame) + ": unexpected spawn result");
+		}
+		if (expected_spawn_result)
+		{
+			// 非アクティブからアクティブになったスロットが, 生成されたパーティクル
+			for (uint32_t i = 0; i < capacity; i++)
+			{
+				const Particle p = simulator.GetParticle(i);
+				if (IsActive(p) && !IsActive(expected[i]))
+				{
+					expected[i] = p;
+					report.num_spawned++;
+				}
+			}
+		}
+
+		const float dt = RandomRange(engine, 0.5f, 2.f) / Collon2D::FRAME_RATE;
+		simulator.Tick(dt, 0.f, PARTICLE_GRAVITY_ACCELERATION);
+		for (Particle& p : expected)
+		{
+			report.num_retired += CpuParticleSimulator::TickParticleReference(p, dt, 0.f, PARTICLE_GRAVITY_ACCELERATION) ? 1 : 0;
+		}
+
+		// 同じ順番で演算しているので, 全てのメンバが完全に一致する
+		uint32_t num_expected_active = 0;
+		for (uint32_t i = 0; i < capacity; i++)
+		{
+			const Particle actual = simulator.GetParticle(i);
+			num_expected_active += IsActive(expected[i]) ? 1 : 0;
+			if (std::memcmp(&actual, &expected[i], sizeof(Particle)) != 0)
+			{
+				AddFailure(report, "frame " + std::to_string(frame) + ": slot " + std::to_string(i) + " mismatch");
+			}
+		}
+		if (num_expected_active != simulator.GetNumActiveParticles())
+		{
+			AddFailure(report, "frame " + std::to_string(frame) + ": pool count mismatch");
+		}
+	}
+
+	simulator.DeactivateAll();
+	if (simulator.GetPoolCount() != capacity)
+	{
+		AddFailure(report, "DeactivateAll() did not return all slots to the pool");
+	}
+
+	return report;
+}
+
+void CpuParticleSimulatorVerifier::RunBenchmark(const int max_capacity_shift, const int num_ticks, std::vector<CpuParticleBenchmarkResult>& out_results)
+{
+	const float dt = 1.f / Collon2D::FRAME_RATE;
+
+	out_results.clear();
+	for (int shift = 0; shift <= max_capacity_shift; shift++)
+	{
+		CpuParticleBenchmarkResult result{};
+		result.capacity = MAX_PARTICLES_NUM << shift;
+
+		// 寿命を長くして, 計測中は全てのスロットをアクティブに保つ
+		std::vector<Particle> particles(result.capacity);
+		for (Particle& p : particles)
+		{
+			p.life_time = 1e9f;
+			p.gravity_scale = 1.f;
+			p.num_anim_frames = 4;
+			p.SetIsActive(1);
+		}
+
+		CpuParticleSimulator simulator(result.capacity);
+		simulator.Spawn(particles.data(), result.capacity);
+
+		const double num_updates = static_cast<double>(result.capacity) * num_ticks;
+		auto begin = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < num_ticks; i++)
+		{
+			simulator.Tick(dt, 0.f, PARTICLE_GRAVITY_ACCELERATION);
+		}
+		const double simulator_seconds = GetElapsedSeconds(begin);
+		result.simulator_updates_per_second = num_updates / simulator_seconds;
+		result.simulator_tick_ms = simulator_seconds * 1000.0 / num_ticks;
+
+		begin = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < num_ticks; i++)
+		{
+			for (Particle& p : particles)
+			{
+				CpuParticleSimulator::TickParticleReference(p, dt, 0.f, PARTICLE_GRAVITY_ACCELERATION);
+			}
+		}
+		result.reference_updates_per_second = num_updates / GetElapsedSeconds(begin);
+
+		out_results.push_back(result);
+	}
+}
+
+std::string CpuParticleValidationReport::ToString() const
+{
+	std::ostringstream oss;
+	oss << (num_failures == 0 ? "PASSED" : "FAILED")
+		<< ": " << num_frames << " frames, " << num_spawned << " spawned, " << num_retired << " retired"
+		<< ", " << num_failures << " failures";
+	return oss.str();
+}
+
+std::string CpuParticleBenchmarkResult::ToString() const
+{
+	char buffer[256];
+	snprintf(
+		buffer, sizeof(buffer),
+		"capacity %8u  simulator %8.2f M/s (%.3f ms/tick)  reference %8.2f M/s  (x%.2f)",
+		capacity,
+		simulator_updates_per_second * 1e-6,
+		simulator_tick_ms,
+		reference_updates_per_second * 1e-6,
+		simulator_updates_per_second / reference_updates_per_second
+	);
+	return buffer;
+}
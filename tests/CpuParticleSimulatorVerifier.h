@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// CpuParticleSimulatorVerifier::RunValidation()の結果
+/// </summary>
+struct CpuParticleValidationReport
+{
+	int num_frames;
+	int64_t num_spawned;
+	int64_t num_retired;
+	int num_failures;
+
+	// 不一致の説明. 多すぎる場合は先頭の一部だけ
+	std::vector<std::string> failures;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// CpuParticleSimulatorVerifier::RunBenchmark()の, 1つの容量についての計測結果
+/// </summary>
+struct CpuParticleBenchmarkResult
+{
+	uint32_t capacity;
+	double simulator_updates_per_second;
+	double reference_updates_per_second;	// 構造体の配列をTickParticleReference()で1個ずつ更新した場合
+	double simulator_tick_ms;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// CpuParticleSimulatorの検証とベンチマーク
+/// <para>検証: 乱数で生成したパーティクルを毎フレーム生成しながら更新し, ParticleCS.hlslを書き写したTickParticleReference()の結果と全てのスロットを比較する</para>
+/// <para>ベンチマーク: 全てのスロットがアクティブな状態で, 容量ごとに1秒あたりに更新できるパーティクル数を計測する</para>
+/// <para>tests/のtest_cpu_particle_simulatorとbench_cpu_particle_simulatorから使う</para>
+/// </summary>
+class CpuParticleSimulatorVerifier
+{
+public:
+	static CpuParticleValidationReport RunValidation(const uint32_t seed, const uint32_t capacity, const int num_frames);
+
+	/// <param name="max_capacity_shift">MAX_PARTICLES_NUMの何倍(2のべき乗)まで計測するか</param>
+	static void RunBenchmark(const int max_capacity_shift, const int num_ticks, std::vector<CpuParticleBenchmarkResult>& out_results);
+};
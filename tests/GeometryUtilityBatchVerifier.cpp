@@ -0,0 +1,441 @@
+#include "GeometryUtilityBatchVerifier.h"
+#include "Utility/Core/Math/GeometryUtilityBatch.h"
+#include "Utility/Core/MathCore.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+
+namespace
+{
+	// 不一致をこれ以上表示しない
+	constexpr size_t MAX_FUZZ_FAILURES = 32;
+
+	// 1回の比較で使うバッチの最大サイズ. SIMD幅の倍数にならない端数も試す
+	constexpr int MAX_FUZZ_BATCH_SIZE = 37;
+
+	float RandomRange(std::mt19937& engine, const float min, const float max)
+	{
+		return std::uniform_real_distribution<float>(min, max)(engine);
+	}
+
+	int RandomInt(std::mt19937& engine, const int min, const int max)
+	{
+		return std::uniform_int_distribution<int>(min, max)(engine);
+	}
+
+	bool RandomBool(std::mt19937& engine, const float p)
+	{
+		return RandomRange(engine, 0.f, 1.f) < p;
+	}
+
+	/// <summary>
+	/// 判定の境界付近を多く含むように, 整数座標・整数サイズ・回転ゼロの矩形を混ぜる
+	/// </summary>
+	FRect MakeFuzzRect(std::mt19937& engine)
+	{
+		FRect rect;
+		rect.center = RandomBool(engine, 0.5f)
+			? Vector2D(static_cast<float>(RandomInt(engine, -64, 64)), static_cast<float>(RandomInt(engine, -64, 64)))
+			: Vector2D(RandomRange(engine, -64.f, 64.f), RandomRange(engine, -64.f, 64.f));
+		rect.width = RandomBool(engine, 0.5f) ? static_cast<float>(RandomInt(engine, 1, 32) * 2) : RandomRange(engine, 0.5f, 64.f);
+		rect.height = RandomBool(engine, 0.5f) ? static_cast<float>(RandomInt(engine, 1, 32) * 2) : RandomRange(engine, 0.5f, 64.f);
+
+		const float rotation_type = RandomRange(engine, 0.f, 1.f);
+		if (rotation_type < 0.4f)
+		{
+			rect.rotation = 0.f;
+		}
+		else if (rotation_type < 0.6f)
+		{
+			rect.rotation = CLN2D_HALF_PI * static_cast<float>(RandomInt(engine, -2, 2));
+		}
+		else
+		{
+			rect.rotation = RandomRange(engine, -CLN2D_PI, CLN2D_PI);
+		}
+		return rect;
+	}
+
+	FSegment MakeFuzzSegment(std::mt19937& engine)
+	{
+		const Vector2D start(RandomRange(engine, -64.f, 64.f), RandomRange(engine, -64.f, 64.f));
+		Vector2D end(RandomRange(engine, -64.f, 64.f), RandomRange(engine, -64.f, 64.f));
+
+		// 軸に平行な線分を混ぜて, 平行・同一直線上の組み合わせを作る
+		if (RandomBool(engine, 0.2f))
+		{
+			end.y = start.y;
+		}
+		else if (RandomBool(engine, 0.2f))
+		{
+			end.x = start.x;
+		}
+		return FSegment(start, end);
+	}
+
+	/// <summary>
+	/// 矩形の各辺をmarginだけ広げる
+	/// </summary>
+	FRect InflateRect(const FRect& rect, const float margin)
+	{
+		return FRect(rect.center, rect.width + 2.f * margin, rect.height + 2.f * margin, rect.rotation);
+	}
+
+	/// <summary>
+	/// 誤差の範囲で判定が変わる組み合わせか. 少し広げると重なり, 少し狭めると離れる場合は境界付近とみなす
+	/// </summary>
+	bool IsBorderlineRectOverlap(const FRect& rect_a, const FRect& rect_b)
+	{
+		const float scale = 1.f + std::max({ fabsf(rect_a.center.x), fabsf(rect_a.center.y), fabsf(rect_b.center.x), fabsf(rect_b.center.y) });
+		const float margin = 1e-4f * scale;
+		return GeometricUtility::DoesRectOverlapWithAnother(rect_a, InflateRect(rect_b, margin))
+			&& !GeometricUtility::DoesRectOverlapWithAnother(rect_a, InflateRect(rect_b, -margin));
+	}
+
+	// NOTE: Vector2Dのoperator<<はVector2D.cppにあり, プラットフォーム非依存のビルドに含まれないので使わない
+	std::string ToString(const Vector2D& v)
+	{
+		std::ostringstream oss;
+		oss << "(" << v.x << "," << v.y << ")";
+		return oss.str();
+	}
+
+	std::string ToString(const FRect& rect)
+	{
+		std::ostringstream oss;
+		oss << "{" << ToString(rect.center) << ", " << rect.width << ", " << rect.height << ", " << rect.rotation << "}";
+		return oss.str();
+	}
+
+	std::string ToString(const FSegment& segment)
+	{
+		std::ostringstream oss;
+		oss << "{" << ToString(segment.start) << ", " << ToString(segment.end) << "}";
+		return oss.str();
+	}
+
+	void AddFuzzFailure(std::vector<std::string>& out_failures, const std::string& failure)
+	{
+		if (out_failures.size() < MAX_FUZZ_FAILURES)
+		{
+			out_failures.push_back(failure);
+		}
+	}
+
+	/// <summary>
+	/// DoesRectOverlapWithBatch()をDoesRectOverlapWithAnother()と比較する
+	/// <para>重なり判定は境界付近を除いて一致すること, めり込み深度は誤差の範囲で一致することを確認する</para>
+	/// </summary>
+	/// <returns>不一致の数</returns>
+	int FuzzRectOverlap(std::mt19937& engine, const int num_iterations, std::vector<std::string>& out_failures, int64_t& out_num_tests, int64_t& out_num_borderline)
+	{
+		int num_failures = 0;
+		FRectBatch batch;
+		std::vector<FRect> rects;
+		std::vector<uint32_t> hit_masks;
+		std::vector<Vector2D> penetration_depths;
+
+		for (int iteration = 0; iteration < num_iterations; iteration++)
+		{
+			const FRect query = MakeFuzzRect(engine);
+			const int batch_size = RandomInt(engine, 1, MAX_FUZZ_BATCH_SIZE);
+
+			batch.Clear();
+			rects.clear();
+			for (int i = 0; i < batch_size; i++)
+			{
+				rects.push_back(MakeFuzzRect(engine));
+				batch.Add(rects.back());
+			}
+
+			penetration_depths.assign(batch_size, Vector2D{});
+			const int num_hits = GeometricUtilityBatch::DoesRectOverlapWithBatch(query, batch, hit_masks, penetration_depths.data());
+
+			for (int i = 0; i < batch_size; i++)
+			{
+				out_num_tests++;
+
+				Vector2D expected_depth{};
+				const bool expected_hit = GeometricUtility::DoesRectOverlapWithAnother(query, rects[i], &expected_depth);
+				const bool actual_hit = GeometricUtilityBatch::IsHit(hit_masks, i);
+
+				if (expected_hit != actual_hit)
+				{
+					if (IsBorderlineRectOverlap(query, rects[i]))
+					{
+						out_num_borderline++;
+						continue;
+					}
+					num_failures++;
+					AddFuzzFailure(out_failures, "rect hit mismatch: " + ToString(query) + " vs " + ToString(rects[i]));
+					continue;
+				}
+
+				if (!expected_hit)
+				{
+					continue;
+				}
+
+				// 最小の軸が複数ある場合は選ばれる軸が誤差で変わりうるので, 長さだけ一致していればよい
+				const Vector2D& actual_depth = penetration_depths[i];
+				const float tolerance = 1e-3f * (1.f + expected_depth.Length());
+				const bool is_same_vector = (actual_depth - expected_depth).Length() <= tolerance;
+				const bool is_same_length = fabsf(actual_depth.Length() - expected_depth.Length()) <= tolerance;
+				if (!is_same_vector && !is_same_length)
+				{
+					num_failures++;
+					AddFuzzFailure(out_failures, "rect depth mismatch: " + ToString(query) + " vs " + ToString(rects[i])
+						+ " expected " + ToString(expected_depth) + " actual " + ToString(actual_depth));
+				}
+			}
+
+			// 境界付近の不一致があるとヒット数も変わるので, 戻り値はビットマスクと比べる
+			int num_bits = 0;
+			for (int i = 0; i < batch_size; i++)
+			{
+				num_bits += GeometricUtilityBatch::IsHit(hit_masks, i) ? 1 : 0;
+			}
+			if (num_hits != num_bits)
+			{
+				num_failures++;
+				AddFuzzFailure(out_failures, "rect hit count mismatch: returned " + std::to_string(num_hits) + ", mask " + std::to_string(num_bits));
+			}
+		}
+
+		return num_failures;
+	}
+
+	/// <summary>
+	/// DoesSegmentIntersectWithBatch()をDoesSegmentIntersectWithAnother()と比較する
+	/// <para>同じ順番で演算しているので, 交差判定と交点は完全に一致することを確認する</para>
+	/// </summary>
+	/// <returns>不一致の数</returns>
+	int FuzzSegmentIntersect(std::mt19937& engine, const int num_iterations, std::vector<std::string>& out_failures, int64_t& out_num_tests)
+	{
+		int num_failures = 0;
+		FSegmentBatch batch;
+		std::vector<FSegment> segments;
+		std::vector<uint32_t> hit_masks;
+		std::vector<Vector2D> intersections;
+
+		for (int iteration = 0; iteration < num_iterations; iteration++)
+		{
+			const FSegment query = MakeFuzzSegment(engine);
+			const int num_entries = RandomInt(engine, 1, MAX_FUZZ_BATCH_SIZE / 4);
+
+			batch.Clear();
+			segments.clear();
+			for (int i = 0; i < num_entries; i++)
+			{
+				const float entry_type = RandomRange(engine, 0.f, 1.f);
+				if (entry_type < 0.5f)
+				{
+					// 矩形の辺. AddRectEdges()と同じ順番で比較用の線分を作る
+					const FRect rect = MakeFuzzRect(engine);
+					batch.AddRectEdges(rect);
+
+					std::array<Vector2D, 4> vertices;
+					rect.GetVertices(vertices);
+					for (size_t v = 0; v < 4; v++)
+					{
+						segments.push_back(FSegment(vertices[v], vertices[(v + 1) % 4]));
+					}
+				}
+				else if (entry_type < 0.6f)
+				{
+					// 同一直線上の線分
+					const Vector2D offset = query.GetDirectionUnnormalized() * RandomRange(engine, -1.f, 1.f);
+					segments.push_back(FSegment(query.start + offset, query.end + offset));
+					batch.Add(segments.back());
+				}
+				else
+				{
+					segments.push_back(MakeFuzzSegment(engine));
+					batch.Add(segments.back());
+				}
+			}
+
+			const int batch_size = static_cast<int>(segments.size());
+			intersections.assign(batch_size, Vector2D{});
+			GeometricUtilityBatch::DoesSegmentIntersectWithBatch(query, batch, hit_masks, intersections.data());
+
+			for (int i = 0; i < batch_size; i++)
+			{
+				out_num_tests++;
+
+				Vector2D expected_intersection{};
+				const bool expected_hit = GeometricUtility::DoesSegmentIntersectWithAnother(expected_intersection, query, segments[i]);
+				const bool actual_hit = GeometricUtilityBatch::IsHit(hit_masks, i);
+
+				if (expected_hit != actual_hit)
+				{
+					num_failures++;
+					AddFuzzFailure(out_failures, "segment hit mismatch: " + ToString(query) + " vs " + ToString(segments[i]));
+				}
+				else if (expected_hit && expected_intersection != intersections[i])
+				{
+					num_failures++;
+					AddFuzzFailure(out_failures, "segment intersection mismatch: " + ToString(query) + " vs " + ToString(segments[i])
+						+ " expected " + ToString(expected_intersection) + " actual " + ToString(intersections[i]));
+				}
+			}
+		}
+
+		return num_failures;
+	}
+
+	double GetElapsedSeconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+}
+
+std::string GeometryBatchFuzzReport::ToString() const
+{
+	std::ostringstream oss;
+	oss << (num_failures == 0 ? "PASSED" : "FAILED")
+		<< ": rect " << num_rect_tests << " tests (" << num_borderline << " borderline)"
+		<< ", segment " << num_segment_tests << " tests"
+		<< ", " << num_failures << " failures";
+	return oss.str();
+}
+
+std::string GeometryBatchBenchmarkResult::ToString() const
+{
+	char buffer[256];
+	snprintf(
+		buffer, sizeof(buffer),
+		"%-24s scalar %8.2f M/s  batch %8.2f M/s  (x%.2f, build %.3f ms)  hits %lld / %lld",
+		kernel_name,
+		scalar_tests_per_second * 1e-6,
+		batch_tests_per_second * 1e-6,
+		batch_tests_per_second / scalar_tests_per_second,
+		batch_build_ms,
+		static_cast<long long>(num_scalar_hits),
+		static_cast<long long>(num_batch_hits)
+	);
+	return buffer;
+}
+
+GeometryBatchFuzzReport GeometricUtilityBatchVerifier::RunFuzzer(const uint32_t seed, const int num_iterations)
+{
+	std::mt19937 engine(seed);
+	GeometryBatchFuzzReport report{};
+	report.num_failures =
+		FuzzRectOverlap(engine, num_iterations, report.failures, report.num_rect_tests, report.num_borderline)
+		+ FuzzSegmentIntersect(engine, num_iterations, report.failures, report.num_segment_tests);
+	return report;
+}
+
+void GeometricUtilityBatchVerifier::RunBenchmark(const uint32_t seed, const int num_candidates, const int num_queries, std::vector<GeometryBatchBenchmarkResult>& out_results)
+{
+	std::mt19937 engine(seed);
+	out_results.clear();
+
+	std::vector<FRect> query_rects;
+	std::vector<FSegment> query_segments;
+	for (int i = 0; i < num_queries; i++)
+	{
+		query_rects.push_back(MakeFuzzRect(engine));
+		query_segments.push_back(MakeFuzzSegment(engine));
+	}
+
+	std::vector<FRect> candidate_rects;
+	std::vector<FSegment> candidate_edges;
+	for (int i = 0; i < num_candidates; i++)
+	{
+		candidate_rects.push_back(MakeFuzzRect(engine));
+
+		std::array<Vector2D, 4> vertices;
+		candidate_rects.back().GetVertices(vertices);
+		for (size_t v = 0; v < 4; v++)
+		{
+			candidate_edges.push_back(FSegment(vertices[v], vertices[(v + 1) % 4]));
+		}
+	}
+
+	std::vector<uint32_t> hit_masks;
+	std::vector<Vector2D> results(candidate_edges.size());
+
+	// 矩形1つと候補の矩形. ナローフェーズと同じくめり込み深度も求める
+	{
+		GeometryBatchBenchmarkResult result{};
+		result.kernel_name = "rect vs rects";
+		result.num_tests = static_cast<int64_t>(num_queries) * num_candidates;
+
+		int64_t scalar_hits = 0;
+		auto begin = std::chrono::high_resolution_clock::now();
+		for (const FRect& query : query_rects)
+		{
+			for (const FRect& candidate : candidate_rects)
+			{
+				Vector2D penetration_depth;
+				scalar_hits += GeometricUtility::DoesRectOverlapWithAnother(query, candidate, &penetration_depth) ? 1 : 0;
+			}
+		}
+		result.scalar_tests_per_second = result.num_tests / GetElapsedSeconds(begin);
+
+		begin = std::chrono::high_resolution_clock::now();
+		FRectBatch batch;
+		batch.Reserve(candidate_rects.size());
+		for (const FRect& candidate : candidate_rects)
+		{
+			batch.Add(candidate);
+		}
+		result.batch_build_ms = GetElapsedSeconds(begin) * 1000.0;
+
+		int64_t batch_hits = 0;
+		begin = std::chrono::high_resolution_clock::now();
+		for (const FRect& query : query_rects)
+		{
+			batch_hits += GeometricUtilityBatch::DoesRectOverlapWithBatch(query, batch, hit_masks, results.data());
+		}
+		result.batch_tests_per_second = result.num_tests / GetElapsedSeconds(begin);
+
+		result.num_scalar_hits = scalar_hits;
+		result.num_batch_hits = batch_hits;
+		out_results.push_back(result);
+	}
+
+	// 線分1つと候補の矩形の辺
+	{
+		GeometryBatchBenchmarkResult result{};
+		result.kernel_name = "segment vs rect edges";
+		result.num_tests = static_cast<int64_t>(num_queries) * static_cast<int64_t>(candidate_edges.size());
+
+		int64_t scalar_hits = 0;
+		auto begin = std::chrono::high_resolution_clock::now();
+		for (const FSegment& query : query_segments)
+		{
+			for (const FSegment& edge : candidate_edges)
+			{
+				Vector2D intersection;
+				scalar_hits += GeometricUtility::DoesSegmentIntersectWithAnother(intersection, query, edge) ? 1 : 0;
+			}
+		}
+		result.scalar_tests_per_second = result.num_tests / GetElapsedSeconds(begin);
+
+		begin = std::chrono::high_resolution_clock::now();
+		FSegmentBatch batch;
+		batch.Reserve(candidate_edges.size());
+		for (const FRect& candidate : candidate_rects)
+		{
+			batch.AddRectEdges(candidate);
+		}
+		result.batch_build_ms = GetElapsedSeconds(begin) * 1000.0;
+
+		int64_t batch_hits = 0;
+		begin = std::chrono::high_resolution_clock::now();
+		for (const FSegment& query : query_segments)
+		{
+			batch_hits += GeometricUtilityBatch::DoesSegmentIntersectWithBatch(query, batch, hit_masks, results.data());
+		}
+		result.batch_tests_per_second = result.num_tests / GetElapsedSeconds(begin);
+
+		result.num_scalar_hits = scalar_hits;
+		result.num_batch_hits = batch_hits;
+		out_results.push_back(result);
+	}
+}
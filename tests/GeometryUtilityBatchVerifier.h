@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// GeometricUtilityBatchVerifier::RunFuzzer()の結果
+/// </summary>
+struct GeometryBatchFuzzReport
+{
+	int64_t num_rect_tests;
+	int64_t num_borderline;		// 境界付近のため, 矩形の重なり判定の不一致を許した数
+	int64_t num_segment_tests;
+	int num_failures;
+
+	// 不一致の説明. 多すぎる場合は先頭の一部だけ
+	std::vector<std::string> failures;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// GeometricUtilityBatchVerifier::RunBenchmark()の, 1つのカーネルについてのスカラー版とバッチ版の計測結果
+/// </summary>
+struct GeometryBatchBenchmarkResult
+{
+	const char* kernel_name;
+	int64_t num_tests;
+	double scalar_tests_per_second;
+	double batch_tests_per_second;
+	double batch_build_ms;	// バッチの構築にかかった時間. 判定の計測には含めない
+
+	// 境界付近の判定の違いを除いて一致する
+	int64_t num_scalar_hits;
+	int64_t num_batch_hits;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// GeometricUtilityBatchの検証とベンチマーク
+/// <para>ファザー: 乱数で生成した図形についてバッチ版とスカラー版(GeometricUtility)の結果を比較し, 不一致を集める</para>
+/// <para>ベンチマーク: 1つの図形をnum_candidates個の図形と判定する処理を, スカラー版とバッチ版で計測する</para>
+/// <para>tests/のtest_geometry_utility_batchとbench_geometry_utility_batchから使う</para>
+/// </summary>
+class GeometricUtilityBatchVerifier
+{
+public:
+	static GeometryBatchFuzzReport RunFuzzer(const uint32_t seed, const int num_iterations);
+
+	static void RunBenchmark(const uint32_t seed, const int num_candidates, const int num_queries, std::vector<GeometryBatchBenchmarkResult>& out_results);
+};
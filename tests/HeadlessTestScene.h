@@ -0,0 +1,17 @@
+#pragma once
+#include "Scene/SceneBase.h"
+#include <stdexcept>
+
+// アクターを生成するテストとベンチマークで使う, アクターの所属先のシーン
+// TestSceneImplBaseは全シーンのヘッダーに依存するので, ここではSceneBaseの純粋仮想関数だけを実装する
+// テスト側はアクターをシーンに追加せず, Tick()も呼ばない
+class HeadlessTestScene : public SceneBase
+{
+public:
+	virtual SceneType GetSceneType() const override { return SceneType::TEST_SCENE; }
+
+	virtual std::unique_ptr<const SceneBaseInitialParams> GetInitialParamsForNextScene(const SceneType) const override
+	{
+		throw std::runtime_error("Undefined scene transition");
+	}
+};
@@ -0,0 +1,185 @@
+#include "ParticleDrawListsVerifier.h"
+#include "GameSystems/ParticleManager/ParticleDrawLists.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+
+namespace
+{
+	// 不一致をこれ以上表示しない
+	constexpr size_t MAX_VALIDATION_FAILURES = 32;
+
+	// 検証に使う配列の最大長. 非アクティブなスロットを読み飛ばす単位(8個)の倍数にならない端数も試す
+	constexpr uint32_t MAX_VALIDATION_PARTICLES = 300;
+
+	// 検証ではブレンドモードとテクスチャの範囲外の値も作る
+	constexpr uint32_t NUM_BLEND_MODES = 3;
+	constexpr uint32_t NUM_TEXTURES = MAX_TEXTURES_NUM;
+
+	constexpr float BENCHMARK_OCCUPANCIES[] = { 0.01f, 0.1f, 1.f };
+
+	uint32_t RandomUint(std::mt19937& engine, const uint32_t min, const uint32_t max)
+	{
+		return std::uniform_int_distribution<uint32_t>(min, max)(engine);
+	}
+
+	uint32_t MakePackedData(const uint32_t is_active, const uint32_t blend_mode, const uint32_t i_texture)
+	{
+		Particle p;
+		p.SetIsActive(is_active);
+		p.SetBlendMode(blend_mode);
+		p.SetTextureIndex(i_texture);
+		return p.packed_data;
+	}
+
+	double GetElapsedMicroseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+
+	void AddFailure(ParticleDrawListsValidationReport& report, const std::string& failure)
+	{
+		report.num_failures++;
+		if (report.failures.size() < MAX_VALIDATION_FAILURES)
+		{
+			report.failures.push_back(failure);
+		}
+	}
+}
+
+ParticleDrawListsValidationReport ParticleDrawListsVerifier::RunValidation(const uint32_t seed, const int num_iterations)
+{
+	ParticleDrawListsValidationReport report{};
+	report.num_iterations = num_iterations;
+
+	std::mt19937 engine(seed);
+
+	// 同じインスタンスを使い回して, 前回より短い配列でも正しく作り直せることも確認する
+	ParticleDrawLists draw_lists(NUM_BLEND_MODES, NUM_TEXTURES);
+	std::vector<uint32_t> packed_data;
+	std::vector<uint32_t> expected_indices;
+	for (int iteration = 0; iteration < num_iterations; iteration++)
+	{
+		packed_data.resize(RandomUint(engine, 0, MAX_VALIDATION_PARTICLES));
+		const uint32_t active_percent = RandomUint(engine, 0, 100);
+		for (uint32_t& packed : packed_data)
+		{
+			packed = MakePackedData(RandomUint(engine, 1, 100) <= active_percent ? 1 : 0, RandomUint(engine, 0, NUM_BLEND_MODES), RandomUint(engine, 0, NUM_TEXTURES));
+		}
+		const uint32_t num_particles = static_cast<uint32_t>(packed_data.size());
+		draw_lists.Build(packed_data.data(), num_particles);
+
+		const std::string prefix = "iteration " + std::to_string(iteration) + ": ";
+		uint32_t num_listed = 0;
+		for (uint32_t blend_mode = 0; blend_mode < NUM_BLEND_MODES; blend_mode++)
+		{
+			const ParticleDrawLists::Range blend_mode_range = draw_lists.GetBlendModeRange(blend_mode);
+			uint32_t num_in_blend_mode = 0;
+			for (uint32_t i_texture = 0; i_texture < NUM_TEXTURES; i_texture++)
+			{
+				// 全てのスロットを順に調べて作った期待値と, 並び順も含めて比較する
+				expected_indices.clear();
+				for (uint32_t i = 0; i < num_particles; i++)
+				{
+					if (packed_data[i] == MakePackedData(1, blend_mode, i_texture))
+					{
+						expected_indices.push_back(i);
+					}
+				}
+
+				const ParticleDrawLists::Range range = draw_lists.GetGroupRange(blend_mode, i_texture);
+				if (range.offset != blend_mode_range.offset + num_in_blend_mode)
+				{
+					AddFailure(report, prefix + "group offset mismatch");
+				}
+				if (range.count != expected_indices.size()
+					|| !std::equal(expected_indices.begin(), expected_indices.end(), draw_lists.GetIndices() + range.offset))
+				{
+					AddFailure(report, prefix + "group list mismatch (blend " + std::to_string(blend_mode) + ", texture " + std::to_string(i_texture) + ")");
+				}
+				num_in_blend_mode += range.count;
+			}
+			if (num_in_blend_mode != blend_mode_range.count)
+			{
+				AddFailure(report, prefix + "blend mode range mismatch");
+			}
+			num_listed += num_in_blend_mode;
+		}
+
+		uint32_t expected_rejected = 0;
+		for (const uint32_t packed : packed_data)
+		{
+			const bool is_active = (packed & Particle::is_active_mask) != 0;
+			const uint32_t blend_mode = (packed & Particle::blend_mode_mask) >> Particle::blend_mode_shift;
+			const uint32_t i_texture = (packed & Particle::i_texture_mask) >> Particle::i_texture_shift;
+			expected_rejected += (is_active && (blend_mode >= NUM_BLEND_MODES || i_texture >= NUM_TEXTURES)) ? 1 : 0;
+		}
+		if (num_listed != draw_lists.GetNumLiveParticles() || expected_rejected != draw_lists.GetNumRejectedParticles())
+		{
+			AddFailure(report, prefix + "count mismatch");
+		}
+		report.num_live_particles += draw_lists.GetNumLiveParticles();
+	}
+
+	return report;
+}
+
+void ParticleDrawListsVerifier::RunBenchmark(const uint32_t seed, const uint32_t num_blend_modes, const int num_builds, std::vector<ParticleDrawListsBenchmarkResult>& out_results)
+{
+	std::mt19937 engine(seed);
+	out_results.clear();
+
+	for (const float occupancy : BENCHMARK_OCCUPANCIES)
+	{
+		std::vector<uint32_t> packed_data(MAX_PARTICLES_NUM);
+		std::uniform_real_distribution<float> distribution(0.f, 1.f);
+		for (uint32_t& packed : packed_data)
+		{
+			packed = MakePackedData(distribution(engine) < occupancy ? 1 : 0, RandomUint(engine, 0, num_blend_modes - 1), RandomUint(engine, 0, NUM_TEXTURES - 1));
+		}
+
+		ParticleDrawLists draw_lists(num_blend_modes, NUM_TEXTURES);
+		draw_lists.Build(packed_data.data(), MAX_PARTICLES_NUM);
+
+		const auto begin = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < num_builds; i++)
+		{
+			draw_lists.Build(packed_data.data(), MAX_PARTICLES_NUM);
+		}
+
+		ParticleDrawListsBenchmarkResult result{};
+		result.occupancy = occupancy;
+		result.num_live_particles = draw_lists.GetNumLiveParticles();
+		result.build_us = GetElapsedMicroseconds(begin) / num_builds;
+		result.num_full_instances = static_cast<uint64_t>(MAX_PARTICLES_NUM) * num_blend_modes;
+		result.num_list_instances = draw_lists.GetNumLiveParticles();
+		out_results.push_back(result);
+	}
+}
+
+std::string ParticleDrawListsValidationReport::ToString() const
+{
+	std::ostringstream oss;
+	oss << (num_failures == 0 ? "PASSED" : "FAILED")
+		<< ": " << num_iterations << " iterations, " << num_live_particles << " live particles"
+		<< ", " << num_failures << " failures";
+	return oss.str();
+}
+
+std::string ParticleDrawListsBenchmarkResult::ToString() const
+{
+	char buffer[256];
+	snprintf(
+		buffer, sizeof(buffer),
+		"occupancy %5.1f%%  live %6u  build %8.2f us  instances %7llu -> %7llu",
+		occupancy * 100.f,
+		num_live_particles,
+		build_us,
+		static_cast<unsigned long long>(num_full_instances),
+		static_cast<unsigned long long>(num_list_instances)
+	);
+	return buffer;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// ParticleDrawListsVerifier::RunValidation()の結果
+/// </summary>
+struct ParticleDrawListsValidationReport
+{
+	int num_iterations;
+	int64_t num_live_particles;
+	int num_failures;
+
+	// 不一致の説明. 多すぎる場合は先頭の一部だけ
+	std::vector<std::string> failures;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// ParticleDrawListsVerifier::RunBenchmark()の, 1つの生存率についての計測結果
+/// </summary>
+struct ParticleDrawListsBenchmarkResult
+{
+	float occupancy;
+	uint32_t num_live_particles;
+	double build_us;
+
+	// 頂点シェーダーで処理するインスタンス数. 全てのスロットをブレンドモードの数だけ描画する場合と, リストで描画する場合
+	uint64_t num_full_instances;
+	uint64_t num_list_instances;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// ParticleDrawListsの検証とベンチマーク
+/// <para>検証: 乱数で生成したpacked_dataの配列からリストを作り, 全てのスロットを調べて作ったグループごとのリストと比較する</para>
+/// <para>ベンチマーク: MAX_PARTICLES_NUM個のスロットのうち1%, 10%, 100%が生存している場合に, リストの作成にかかる時間と描画するインスタンス数を計測する</para>
+/// <para>tests/のtest_particle_draw_listsとbench_particle_draw_listsから使う</para>
+/// </summary>
+class ParticleDrawListsVerifier
+{
+public:
+	static ParticleDrawListsValidationReport RunValidation(const uint32_t seed, const int num_iterations);
+
+	/// <param name="num_blend_modes">描画するブレンドモードの数. 通常はEBlendModeの要素数</param>
+	static void RunBenchmark(const uint32_t seed, const uint32_t num_blend_modes, const int num_builds, std::vector<ParticleDrawListsBenchmarkResult>& out_results);
+};
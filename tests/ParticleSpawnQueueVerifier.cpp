@@ -0,0 +1,392 @@
+#include "ParticleSpawnQueueVerifier.h"
+#include "Utility/Core/Math/BatchRandomStream.h"
+#include "Utility/Core/Math/RandomNumberGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+
+namespace
+{
+	constexpr float PI = 3.14159265358979f;
+
+	// 不一致をこれ以上表示しない
+	constexpr size_t MAX_VALIDATION_FAILURES = 32;
+
+	// 検証で1回に追加する要求数とパーティクル数の上限
+	constexpr uint32_t MAX_VALIDATION_REQUESTS = 64;
+	constexpr uint32_t MAX_VALIDATION_PARTICLES = 1024;
+
+	// 検証で1回に作る乱数の数の上限. NUM_LANESの倍数にならない端数も試す
+	constexpr uint32_t MAX_VALIDATION_RANDOM_VALUES = 1000;
+
+	// 値の比較に使う誤差
+	constexpr float VALIDATION_EPSILON = 1e-3f;
+
+	constexpr int BENCHMARK_NUM_EMITTERS[] = { 16, 128, 1024 };
+
+	float RandomFloat(std::mt19937& engine, const float min, const float max)
+	{
+		return std::uniform_real_distribution<float>(min, max)(engine);
+	}
+
+	uint32_t RandomUint(std::mt19937& engine, const uint32_t min, const uint32_t max)
+	{
+		return std::uniform_int_distribution<uint32_t>(min, max)(engine);
+	}
+
+	/// <summary>
+	/// [min, max)の範囲をランダムに決め, min, rangeとして書き込む
+	/// </summary>
+	void RandomRange(std::mt19937& engine, const float min, const float max, float& out_min, float& out_range)
+	{
+		const float a = RandomFloat(engine, min, max);
+		const float b = RandomFloat(engine, min, max);
+		out_min = std::min(a, b);
+		out_range = std::max(a, b) - out_min;
+	}
+
+	bool IsInRange(const float value, const float min, const float range)
+	{
+		return min - VALIDATION_EPSILON <= value && value <= min + range + VALIDATION_EPSILON;
+	}
+
+	/// <summary>
+	/// index番目のエミッターの要求. 画面上に格子状に並べる
+	/// </summary>
+	ParticleSpawnRequest MakeEmitterRequest(const int index, const MasterDataID animation_id, const int num_spawn)
+	{
+		constexpr int NUM_COLUMNS = 16;
+		const float direction = -0.5f * PI + 0.1f * static_cast<float>(index % 7);
+
+		ParticleSpawnRequest request = {};
+		request.animation_id = animation_id;
+		request.num_spawn = static_cast<uint32_t>(num_spawn);
+		request.position_x = 80.f + 70.f * static_cast<float>(index % NUM_COLUMNS);
+		request.position_y = 120.f + 70.f * static_cast<float>(index / NUM_COLUMNS % 8);
+		request.velocity_direction_x = std::cos(direction);
+		request.velocity_direction_y = std::sin(direction);
+		request.half_velocity_angle = 30.f * PI / 180.f;
+		request.size_min = 8.f;
+		request.size_range = 8.f;
+		request.life_time_min = 0.5f;
+		request.life_time_range = 1.f;
+		request.gravity_scale_min = 0.5f;
+		request.gravity_scale_range = 0.5f;
+		request.speed_min = 100.f;
+		request.speed_range = 100.f;
+		return request;
+	}
+
+	/// <summary>
+	/// 以前のParticleManager::Spawn() (ParticleSpawnDesc::MakeParticles()) と同じく, 要求ごとにアニメーションを解決し, 値ごとにRandomNumberGeneratorを呼んでパーティクルを作る
+	/// </summary>
+	void MakeParticlesPerRequest(const ParticleSpawnRequest& request, const ParticleSpawnAnimation& animation, Particle* out_particles)
+	{
+		for (uint32_t i = 0; i < request.num_spawn; i++)
+		{
+			Particle& p = out_particles[i];
+			p = Particle();
+			p.size = RandomNumberGenerator::GetRandomFloat(request.size_min, request.size_min + request.size_range);
+			p.life_time = RandomNumberGenerator::GetRandomFloat(request.life_time_min, request.life_time_min + request.life_time_range);
+			p.pos.x = request.position_x;
+			p.pos.y = request.position_y;
+
+			const float angle = RandomNumberGenerator::GetRandomFloat(-request.half_velocity_angle, request.half_velocity_angle);
+			const float speed = RandomNumberGenerator::GetRandomFloat(request.speed_min, request.speed_min + request.speed_range);
+			const float cos_angle = std::cos(angle);
+			const float sin_angle = std::sin(angle);
+			p.vel.x = (request.velocity_direction_x * cos_angle - request.velocity_direction_y * sin_angle) * speed;
+			p.vel.y = (request.velocity_direction_x * sin_angle + request.velocity_direction_y * cos_angle) * speed;
+
+			p.gravity_scale = RandomNumberGenerator::GetRandomFloat(request.gravity_scale_min, request.gravity_scale_min + request.gravity_scale_range);
+			p.anim_first_frame = animation.anim_first_frame;
+			p.num_anim_frames = animation.num_anim_frames;
+			p.loop_start_offset = animation.loop_start_offset;
+			p.frame_duration = animation.frame_duration;
+			p.SetBlendMode(animation.blend_mode);
+			p.SetMaxLoop(0);
+			p.SetTextureIndex(animation.texture_index);
+		}
+	}
+
+	/// <summary>
+	/// BatchRandomStreamのスカラーの参照実装. 系列ごとにsplitmix64で状態を作り, xoshiro128+ を1系列ずつ進める
+	/// </summary>
+	void FillUniformReference(const uint64_t seed, float* out_values, const size_t num_values)
+	{
+		constexpr int NUM_LANES = BatchRandomStream::NUM_LANES;
+
+		uint32_t state[NUM_LANES][4];
+		uint64_t splitmix_state = seed;
+		const auto splitmix64 = [&splitmix_state]()
+			{
+				splitmix_state += 0x9E37'79B9'7F4A'7C15;
+				uint64_t z = splitmix_state;
+				z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+				z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+				return z ^ (z >> 31);
+			};
+		for (int lane = 0; lane < NUM_LANES; lane++)
+		{
+			const uint64_t low = splitmix64();
+			const uint64_t high = splitmix64();
+			state[lane][0] = static_cast<uint32_t>(low);
+			state[lane][1] = static_cast<uint32_t>(low >> 32);
+			state[lane][2] = static_cast<uint32_t>(high);
+			state[lane][3] = static_cast<uint32_t>(high >> 32);
+			if ((low | high) == 0)
+			{
+				state[lane][0] = 1;
+			}
+		}
+
+		for (size_t i = 0; i < num_values; i++)
+		{
+			uint32_t* const s = state[i % NUM_LANES];
+			out_values[i] = static_cast<float>((s[0] + s[3]) >> 8) * (1.f / 16777216.f);
+
+			const uint32_t t = s[1] << 9;
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = (s[3] << 11) | (s[3] >> 21);
+		}
+	}
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	}
+
+	void AddFailure(ParticleSpawnValidationReport& report, const std::string& failure)
+	{
+		report.num_failures++;
+		if (report.failures.size() < MAX_VALIDATION_FAILURES)
+		{
+			report.failures.push_back(failure);
+		}
+	}
+}
+
+ParticleSpawnValidationReport ParticleSpawnQueueVerifier::RunValidation(const uint32_t seed, const int num_iterations)
+{
+	ParticleSpawnValidationReport report{};
+	report.num_iterations = num_iterations;
+
+	std::mt19937 engine(seed);
+
+	// 同じインスタンスを使い回し, 前回の要求が残らないことも確認する
+	ParticleSpawnQueue queue(MAX_VALIDATION_REQUESTS, MAX_VALIDATION_PARTICLES);
+	std::vector<ParticleSpawnRequest> requests;
+	std::vector<Particle> first_build;
+	std::vector<float> random_values;
+	std::vector<float> expected_random_values;
+	for (int iteration = 0; iteration < num_iterations; iteration++)
+	{
+		const std::string prefix = "iteration " + std::to_string(iteration) + ": ";
+		const uint64_t batch_seed = (static_cast<uint64_t>(seed) << 32) | static_cast<uint32_t>(iteration);
+
+		// 乱数列は, 命令セットによらずスカラーの参照実装と完全に一致する
+		const uint32_t num_random_values = RandomUint(engine, 1, MAX_VALIDATION_RANDOM_VALUES);
+		random_values.resize(num_random_values);
+		expected_random_values.resize(num_random_values);
+		BatchRandomStream(batch_seed).FillUniform(random_values.data(), num_random_values);
+		FillUniformReference(batch_seed, expected_random_values.data(), num_random_values);
+		if (std::memcmp(random_values.data(), expected_random_values.data(), sizeof(float) * num_random_values) != 0)
+		{
+			AddFailure(report, prefix + "random stream mismatch");
+		}
+		report.num_checked_random_values += num_random_values;
+
+		requests.resize(RandomUint(engine, 1, MAX_VALIDATION_REQUESTS));
+		for (ParticleSpawnRequest& request : requests)
+		{
+			request.animation_id = RandomUint(engine, 1, 6);
+			request.num_spawn = RandomUint(engine, 1, 48);
+			request.position_x = RandomFloat(engine, -1000.f, 1000.f);
+			request.position_y = RandomFloat(engine, -1000.f, 1000.f);
+			const float direction = RandomFloat(engine, -PI, PI);
+			request.velocity_direction_x = std::cos(direction);
+			request.velocity_direction_y = std::sin(direction);
+			request.half_velocity_angle = RandomFloat(engine, 0.f, 360.f) * 0.5f * (PI / 180.f);
+			RandomRange(engine, 1.f, 64.f, request.size_min, request.size_range);
+			RandomRange(engine, 0.1f, 5.f, request.life_time_min, request.life_time_range);
+			RandomRange(engine, -2.f, 2.f, request.gravity_scale_min, request.gravity_scale_range);
+			RandomRange(engine, 0.f, 500.f, request.speed_min, request.speed_range);
+		}
+
+		// 生成できる数を超える要求は, 追加された順に丸ごと捨てられる
+		const uint32_t max_particles = RandomUint(engine, 0, MAX_VALIDATION_PARTICLES);
+		std::vector<bool> is_expected_spawned(requests.size(), false);
+		uint32_t num_expected = 0;
+		for (size_t i = 0; i < requests.size(); i++)
+		{
+			if (!queue.Enqueue(requests[i]))
+			{
+				continue;
+			}
+			if (num_expected + requests[i].num_spawn <= max_particles)
+			{
+				num_expected += requests[i].num_spawn;
+				is_expected_spawned[i] = true;
+			}
+		}
+
+		ParticleSpawnStats stats;
+		const uint32_t num_spawn = queue.Build(batch_seed, max_particles, MakeSyntheticAnimation, stats);
+		if (num_spawn != num_expected || stats.num_particles != num_expected || stats.num_requests != requests.size())
+		{
+			AddFailure(report, prefix + "count mismatch");
+			continue;
+		}
+
+		uint32_t i_particle = 0;
+		for (size_t i = 0; i < requests.size(); i++)
+		{
+			if (!is_expected_spawned[i])
+			{
+				continue;
+			}
+
+			const ParticleSpawnRequest& request = requests[i];
+			const ParticleSpawnAnimation animation = MakeSyntheticAnimation(request.animation_id);
+			for (uint32_t k = 0; k < request.num_spawn; k++, i_particle++)
+			{
+				const Particle& p = queue.GetParticles()[i_particle];
+				const float speed = std::sqrt(p.vel.x * p.vel.x + p.vel.y * p.vel.y);
+				const float cos_angle = speed > VALIDATION_EPSILON
+					? (p.vel.x * request.velocity_direction_x + p.vel.y * request.velocity_direction_y) / speed
+					: 1.f;
+				const float angle = std::acos(std::min(std::max(cos_angle, -1.f), 1.f));
+				const bool is_valid =
+					IsInRange(p.size, request.size_min, request.size_range)
+					&& IsInRange(p.life_time, request.life_time_min, request.life_time_range)
+					&& IsInRange(p.gravity_scale, request.gravity_scale_min, request.gravity_scale_range)
+					&& IsInRange(speed, request.speed_min, request.speed_range)
+					&& angle <= std::min(request.half_velocity_angle, PI) + VALIDATION_EPSILON
+					&& p.pos.x == request.position_x && p.pos.y == request.position_y
+					&& p.age == 0.f && p.alpha == 1.f && p.i_frame == 0
+					&& p.anim_first_frame == animation.anim_first_frame && p.num_anim_frames == animation.num_anim_frames
+					&& p.loop_start_offset == animation.loop_start_offset && p.frame_duration == animation.frame_duration
+					&& (p.packed_data & Particle::is_active_mask) == 0
+					&& (p.packed_data & Particle::blend_mode_mask) >> Particle::blend_mode_shift == animation.blend_mode
+					&& (p.packed_data & Particle::i_texture_mask) >> Particle::i_texture_shift == animation.texture_index;
+				if (!is_valid)
+				{
+					AddFailure(report, prefix + "particle " + std::to_string(i_particle) + " of request " + std::to_string(i) + " is out of range");
+				}
+			}
+		}
+		report.num_checked_particles += num_spawn;
+
+		// 同じ要求と同じシードからは同じ値が作られる
+		first_build.assign(queue.GetParticles(), queue.GetParticles() + num_spawn);
+		for (const ParticleSpawnRequest& request : requests)
+		{
+			queue.Enqueue(request);
+		}
+		queue.Build(batch_seed, max_particles, MakeSyntheticAnimation, stats);
+		if (num_spawn > 0 && std::memcmp(first_build.data(), queue.GetParticles(), sizeof(Particle) * num_spawn) != 0)
+		{
+			AddFailure(report, prefix + "not deterministic");
+		}
+	}
+
+	return report;
+}
+
+void ParticleSpawnQueueVerifier::RunBenchmark(
+	const MasterDataID animation_id,
+	const ResolveAnimationFunc& resolve_animation,
+	const int num_particles_per_emitter,
+	const int num_frames,
+	std::vector<ParticleSpawnBenchmarkResult>& out_results
+)
+{
+	out_results.clear();
+
+	ParticleSpawnQueue queue(*std::max_element(std::begin(BENCHMARK_NUM_EMITTERS), std::end(BENCHMARK_NUM_EMITTERS)), MAX_PARTICLES_NUM);
+	std::vector<Particle> particles(MAX_PARTICLES_NUM);
+	for (const int num_emitters : BENCHMARK_NUM_EMITTERS)
+	{
+		const int num_spawn = std::min(num_particles_per_emitter, static_cast<int>(MAX_PARTICLES_NUM) / num_emitters);
+
+		// 要求ごとに作る
+		const auto per_request_begin = std::chrono::high_resolution_clock::now();
+		for (int frame = 0; frame < num_frames; frame++)
+		{
+			for (int i = 0; i < num_emitters; i++)
+			{
+				const ParticleSpawnRequest request = MakeEmitterRequest(i, animation_id, num_spawn);
+				MakeParticlesPerRequest(request, resolve_animation(request.animation_id), particles.data());
+			}
+		}
+		const double per_request_ms = GetElapsedMilliseconds(per_request_begin) / num_frames;
+
+		// キューでまとめて作る
+		const auto queue_begin = std::chrono::high_resolution_clock::now();
+		for (int frame = 0; frame < num_frames; frame++)
+		{
+			for (int i = 0; i < num_emitters; i++)
+			{
+				queue.Enqueue(MakeEmitterRequest(i, animation_id, num_spawn));
+			}
+			ParticleSpawnStats stats;
+			queue.Build(static_cast<uint64_t>(frame), MAX_PARTICLES_NUM, resolve_animation, stats);
+		}
+		const double queue_ms = GetElapsedMilliseconds(queue_begin) / num_frames;
+
+		ParticleSpawnBenchmarkResult result{};
+		result.num_emitters = num_emitters;
+		result.num_particles_per_emitter = num_spawn;
+		result.per_request_ms = per_request_ms;
+		result.queue_ms = queue_ms;
+		result.per_request_upload_bytes = static_cast<uint64_t>(num_emitters) * PARTICLES_BUFFER_SIZE;
+		result.queue_upload_bytes = static_cast<uint64_t>(num_emitters) * num_spawn * sizeof(Particle);
+		out_results.push_back(result);
+	}
+}
+
+ParticleSpawnAnimation ParticleSpawnQueueVerifier::MakeSyntheticAnimation(const MasterDataID animation_id)
+{
+	ParticleSpawnAnimation animation = {};
+	animation.anim_first_frame = static_cast<uint32_t>(animation_id) * 3;
+	animation.num_anim_frames = static_cast<uint32_t>(animation_id) % 5 + 1;
+	animation.loop_start_offset = static_cast<uint32_t>(animation_id) % 2;
+	animation.frame_duration = 0.05f * static_cast<float>(animation_id % 4 + 1);
+	animation.blend_mode = static_cast<uint32_t>(animation_id) % 3;
+	animation.texture_index = static_cast<uint32_t>(animation_id) % MAX_TEXTURES_NUM;
+	return animation;
+}
+
+std::string ParticleSpawnValidationReport::ToString() const
+{
+	std::ostringstream oss;
+	oss << (num_failures == 0 ? "PASSED" : "FAILED")
+		<< ": " << num_iterations << " iterations, " << num_checked_particles << " particles"
+		<< ", " << num_checked_random_values << " random values"
+		<< ", " << num_failures << " failures";
+	return oss.str();
+}
+
+std::string ParticleSpawnBenchmarkResult::ToString() const
+{
+	char buffer[256];
+	snprintf(
+		buffer, sizeof(buffer),
+		"emitters %4d x %2d  per-request %8.3f ms  queue %8.3f ms  upload %8llu KB -> %6llu KB",
+		num_emitters,
+		num_particles_per_emitter,
+		per_request_ms,
+		queue_ms,
+		static_cast<unsigned long long>(per_request_upload_bytes >> 10),
+		static_cast<unsigned long long>(queue_upload_bytes >> 10)
+	);
+	return buffer;
+}
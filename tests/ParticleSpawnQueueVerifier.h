@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "GameSystems/ParticleManager/ParticleSpawnQueue.h"
+
+/// <summary>
+/// ParticleSpawnQueueVerifier::RunValidation()の結果
+/// </summary>
+struct ParticleSpawnValidationReport
+{
+	int num_iterations;
+	int64_t num_checked_particles;
+	int64_t num_checked_random_values;	// BatchRandomStreamをスカラーの参照実装と比較した値の数
+	int num_failures;
+
+	// 不一致の説明. 多すぎる場合は先頭の一部だけ
+	std::vector<std::string> failures;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// ParticleSpawnQueueVerifier::RunBenchmark()の, 1つのエミッター数についての計測結果
+/// </summary>
+struct ParticleSpawnBenchmarkResult
+{
+	int num_emitters;
+	int num_particles_per_emitter;
+
+	// 1フレーム分の要求からパーティクルの初期値を作るのにかかった時間
+	double per_request_ms;
+	double queue_ms;
+
+	// 1フレーム分のアップロード量. 要求ごとの場合は生成情報バッファ全体を毎回書き込んでいた
+	uint64_t per_request_upload_bytes;
+	uint64_t queue_upload_bytes;
+
+	std::string ToString() const;
+};
+
+/// <summary>
+/// ParticleSpawnQueueとBatchRandomStreamの検証とベンチマーク
+/// <para>検証: 乱数で作った生成要求からパーティクルを作り, 値が指定した範囲に収まっているか, 同じシードから同じ値が作られるかを調べる. BatchRandomStreamの出力もスカラーの参照実装と比較する</para>
+/// <para>ベンチマーク: 以前のParticleManager::Spawn()と同じく要求ごとにアニメーションを解決し値ごとにRandomNumberGeneratorを呼ぶ場合と, キューでまとめて作る場合の時間とアップロード量を比べる</para>
+/// <para>tests/のtest_particle_spawn_queueとbench_particle_spawn_queueから使う</para>
+/// </summary>
+class ParticleSpawnQueueVerifier
+{
+public:
+	using ResolveAnimationFunc = std::function<ParticleSpawnAnimation(const MasterDataID)>;
+
+	static ParticleSpawnValidationReport RunValidation(const uint32_t seed, const int num_iterations);
+
+	/// <param name="animation_id">全てのエミッターが生成するアニメーション</param>
+	/// <param name="resolve_animation">アニメーションIDからアニメーションを解決する関数. ParticleManagerではマスターデータを引く</param>
+	static void RunBenchmark(
+		const MasterDataID animation_id,
+		const ResolveAnimationFunc& resolve_animation,
+		const int num_particles_per_emitter,
+		const int num_frames,
+		std::vector<ParticleSpawnBenchmarkResult>& out_results
+	);
+
+	/// <summary>
+	/// マスターデータを使わずに, アニメーションIDから値を決める. 検証と, tests/のベンチマークで使う
+	/// </summary>
+	static ParticleSpawnAnimation MakeSyntheticAnimation(const MasterDataID animation_id);
+};
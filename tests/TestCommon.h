@@ -0,0 +1,81 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+
+// プラットフォーム非依存モジュールのテストで使う, 最小限の検証マクロ
+// 失敗しても中断せずに数え, main()の最後にCLN2D_TEST_RESULT()で終了コードにする
+
+inline int& GetTestFailureCount()
+{
+	static int num_failures = 0;
+	return num_failures;
+}
+
+#define CLN2D_CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+			GetTestFailureCount()++; \
+		} \
+	} while (0)
+
+#define CLN2D_CHECK_NEAR(actual, expected, tolerance) \
+	do \
+	{ \
+		const double cln2d_actual = static_cast<double>(actual); \
+		const double cln2d_expected = static_cast<double>(expected); \
+		if (!(std::fabs(cln2d_actual - cln2d_expected) <= static_cast<double>(tolerance))) \
+		{ \
+			std::fprintf(stderr, "%s:%d: CHECK_NEAR failed: %s = %g, expected %g\n", __FILE__, __LINE__, #actual, cln2d_actual, cln2d_expected); \
+			GetTestFailureCount()++; \
+		} \
+	} while (0)
+
+#define CLN2D_TEST_RESULT() \
+	(GetTestFailureCount() == 0 \
+		? (std::printf("all checks passed\n"), 0) \
+		: (std::fprintf(stderr, "%d check(s) failed\n", GetTestFailureCount()), 1))
+
+/// <summary>
+/// 検証モジュールの結果を表示する. ReportはToString()と, 不一致の説明を持つfailuresを持つ
+/// </summary>
+/// <param name="label">何を変えて実行したか. "seed"や"capacity"など</param>
+template<typename Report>
+void PrintValidationReport(const char* label, const uint32_t value, const Report& report)
+{
+	std::printf("%s %u: %s\n", label, value, report.ToString().c_str());
+	for (const std::string& failure : report.failures)
+	{
+		std::fprintf(stderr, "  %s\n", failure.c_str());
+	}
+}
+
+/// <summary>
+/// valuesのそれぞれについて検証を実行し, 結果を表示してから確認する
+/// </summary>
+/// <param name="run_validation">値を受け取り, 結果を返す</param>
+/// <param name="check_report">結果を受け取り, CLN2D_CHECKで確認する</param>
+template<typename RunValidation, typename CheckReport>
+void RunValidationForEach(const char* label, const std::initializer_list<uint32_t> values, RunValidation run_validation, CheckReport check_report)
+{
+	for (const uint32_t value : values)
+	{
+		const auto report = run_validation(value);
+		PrintValidationReport(label, value, report);
+		check_report(report);
+	}
+}
+
+/// <summary>
+/// シードを変えて検証を実行する. 12345から連続する4つのシードを使う
+/// </summary>
+template<typename RunValidation, typename CheckReport>
+void RunValidationForSeeds(RunValidation run_validation, CheckReport check_report)
+{
+	RunValidationForEach("seed", { 12345u, 12346u, 12347u, 12348u }, run_validation, check_report);
+}
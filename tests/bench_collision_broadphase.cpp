@@ -0,0 +1,89 @@
+#include "CollisionStressField.h"
+#include "HeadlessTestScene.h"
+#include "GameSystems/CollisionManager.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// 1k-10k個の動的コライダーを毎ティック移動させたときの, ブロードフェーズの更新と衝突処理の時間, 候補ペア数, ツリーの高さ
+// マスターデータを読むため, リポジトリのルートで実行する
+// 使い方: bench_collision_broadphase [ティック数] [ナローフェーズのスレッド数]
+namespace
+{
+	constexpr int COLLIDER_COUNTS[] = { 1000, 2000, 5000, 10000 };
+
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const int num_ticks = argc > 1 ? std::atoi(argv[1]) : 120;
+	const int num_threads = argc > 2 ? std::atoi(argv[2]) : 1;
+
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+
+	HeadlessTestScene owner_scene;
+	SceneBaseInitialParams scene_params = {};
+	owner_scene.Initialize(&scene_params);
+	CollisionManager::GetInstance().Initialize();
+	CollisionManager::GetInstance().SetNumNarrowPhaseThreads(num_threads);
+
+	std::printf("%d ticks, %d narrowphase thread(s)\n", num_ticks, num_threads);
+	{
+		CollisionStressField field(&owner_scene);
+		for (const int num_colliders : COLLIDER_COUNTS)
+		{
+			CollisionStressFieldParams params;
+			params.num_dynamic_colliders = num_colliders;
+			field.Spawn(params);
+
+			double move_ms = 0.0;
+			double handle_collisions_ms = 0.0;
+			double broadphase_ms = 0.0;
+			double narrowphase_ms = 0.0;
+			double resolve_ms = 0.0;
+			double candidate_pairs = 0.0;
+			for (int tick = 0; tick < num_ticks; ++tick)
+			{
+				const auto move_begin = std::chrono::high_resolution_clock::now();
+				field.MoveColliders();
+				move_ms += GetElapsedMilliseconds(move_begin);
+
+				const auto handle_begin = std::chrono::high_resolution_clock::now();
+				CollisionManager::GetInstance().HandleCollisions();
+				handle_collisions_ms += GetElapsedMilliseconds(handle_begin);
+
+				const CollisionManager::CollisionStats& stats = CollisionManager::GetInstance().GetStats();
+				broadphase_ms += stats.broadphase_ms;
+				narrowphase_ms += stats.narrowphase_ms;
+				resolve_ms += stats.resolve_ms;
+				candidate_pairs += stats.num_candidate_pairs;
+			}
+
+			std::printf(
+				"  n=%5d  move %.3f ms  handle %.3f ms (broadphase %.3f / narrowphase %.3f / resolve %.3f)  pairs %.0f  height %d\n",
+				num_colliders,
+				move_ms / num_ticks,
+				handle_collisions_ms / num_ticks,
+				broadphase_ms / num_ticks,
+				narrowphase_ms / num_ticks,
+				resolve_ms / num_ticks,
+				candidate_pairs / num_ticks,
+				CollisionManager::GetInstance().GetStats().tree_height
+			);
+		}
+	}
+
+	CollisionManager::GetInstance().Finalize();
+	owner_scene.Finalize();
+	GraphicResourceManager::GetInstance().Destroy();
+	return 0;
+}
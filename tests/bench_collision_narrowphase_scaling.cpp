@@ -0,0 +1,84 @@
+#include "CollisionStressField.h"
+#include "HeadlessTestScene.h"
+#include "GameSystems/CollisionManager.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// ナローフェーズのスレッド数を1からコア数まで変えたときの, ナローフェーズと衝突処理全体の時間
+// マスターデータを読むため, リポジトリのルートで実行する
+// 使い方: bench_collision_narrowphase_scaling [動的コライダー数] [ティック数]
+namespace
+{
+	double GetElapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin)
+	{
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - begin).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const int num_colliders = argc > 1 ? std::atoi(argv[1]) : 5000;
+	const int num_ticks = argc > 2 ? std::atoi(argv[2]) : 120;
+	const int max_num_threads = (std::max)(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+
+	HeadlessTestScene owner_scene;
+	SceneBaseInitialParams scene_params = {};
+	owner_scene.Initialize(&scene_params);
+	CollisionManager::GetInstance().Initialize();
+
+	std::printf("%d colliders, %d ticks\n", num_colliders, num_ticks);
+	{
+		CollisionStressField field(&owner_scene);
+		CollisionStressFieldParams params;
+		params.num_dynamic_colliders = num_colliders;
+
+		double serial_narrowphase_ms = 0.0;
+		for (int num_threads = 1; num_threads <= max_num_threads; ++num_threads)
+		{
+			CollisionManager::GetInstance().SetNumNarrowPhaseThreads(num_threads);
+			field.Spawn(params);
+
+			double narrowphase_ms = 0.0;
+			double handle_collisions_ms = 0.0;
+			for (int tick = 0; tick < num_ticks; ++tick)
+			{
+				field.MoveColliders();
+
+				const auto handle_begin = std::chrono::high_resolution_clock::now();
+				CollisionManager::GetInstance().HandleCollisions();
+				handle_collisions_ms += GetElapsedMilliseconds(handle_begin);
+				narrowphase_ms += CollisionManager::GetInstance().GetStats().narrowphase_ms;
+			}
+			narrowphase_ms /= num_ticks;
+			handle_collisions_ms /= num_ticks;
+
+			if (num_threads == 1)
+			{
+				serial_narrowphase_ms = narrowphase_ms;
+			}
+			std::printf(
+				"  threads=%2d  narrowphase %.3f ms  handle %.3f ms  speedup x%.2f\n",
+				num_threads,
+				narrowphase_ms,
+				handle_collisions_ms,
+				serial_narrowphase_ms / (std::max)(narrowphase_ms, 1e-6)
+			);
+		}
+	}
+
+	CollisionManager::GetInstance().SetNumNarrowPhaseThreads(1);
+	CollisionManager::GetInstance().Finalize();
+	owner_scene.Finalize();
+	GraphicResourceManager::GetInstance().Destroy();
+	return 0;
+}
@@ -0,0 +1,25 @@
+#include "GameSystems/ParticleManager/CpuParticleSimulator.h"
+#include "CpuParticleSimulatorVerifier.h"
+#include <cstdio>
+#include <cstdlib>
+
+// CpuParticleSimulatorと, TickParticleReference()で1個ずつ更新した場合の速度を比べる
+// 使い方: bench_cpu_particle_simulator_<variant> [最大容量のシフト数(MAX_PARTICLES_NUM << n)] [ティック数]
+int main(int argc, char** argv)
+{
+	const int max_capacity_shift = argc > 1 ? std::atoi(argv[1]) : 3;
+	const int num_ticks = argc > 2 ? std::atoi(argv[2]) : 200;
+
+	std::printf("SIMD width %d, %d ticks\n", CpuParticleSimulator::GetSimdWidth(), num_ticks);
+
+	// 1回目はキャッシュとクロックを温めるために捨てる
+	std::vector<CpuParticleBenchmarkResult> results;
+	CpuParticleSimulatorVerifier::RunBenchmark(0, num_ticks, results);
+	CpuParticleSimulatorVerifier::RunBenchmark(max_capacity_shift, num_ticks, results);
+
+	for (const CpuParticleBenchmarkResult& result : results)
+	{
+		std::printf("  %s\n", result.ToString().c_str());
+	}
+	return 0;
+}
@@ -0,0 +1,38 @@
+#include "Utility/Core/Math/GeometryUtilityBatch.h"
+#include "GeometryUtilityBatchVerifier.h"
+#include <cstdio>
+#include <cstdlib>
+
+// GeometricUtilityBatchのスカラー版とバッチ版の速度を比べる
+// 使い方: bench_geometry_utility_batch_<variant> [候補数...]
+int main(int argc, char** argv)
+{
+	constexpr uint32_t SEED = 12345;
+	constexpr int NUM_QUERIES = 4096;
+
+	std::vector<int> candidate_counts = { 16, 64, 256 };
+	if (argc > 1)
+	{
+		candidate_counts.clear();
+		for (int i = 1; i < argc; i++)
+		{
+			candidate_counts.push_back(std::atoi(argv[i]));
+		}
+	}
+
+	std::printf("SIMD width %d, %d queries\n", GeometricUtilityBatch::GetSimdWidth(), NUM_QUERIES);
+	std::vector<GeometryBatchBenchmarkResult> results;
+	for (const int num_candidates : candidate_counts)
+	{
+		// 1回目はキャッシュとクロックを温めるために捨てる
+		GeometricUtilityBatchVerifier::RunBenchmark(SEED, num_candidates, NUM_QUERIES, results);
+		GeometricUtilityBatchVerifier::RunBenchmark(SEED, num_candidates, NUM_QUERIES, results);
+
+		std::printf("candidates %d\n", num_candidates);
+		for (const GeometryBatchBenchmarkResult& result : results)
+		{
+			std::printf("  %s\n", result.ToString().c_str());
+		}
+	}
+	return 0;
+}
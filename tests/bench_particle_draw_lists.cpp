@@ -0,0 +1,29 @@
+#include "ParticleDrawListsVerifier.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+#include <cstdio>
+#include <cstdlib>
+
+// MAX_PARTICLES_NUM個のスロットのうち1%, 10%, 100%が生存している場合の, リストの作成時間と描画するインスタンス数
+// 使い方: bench_particle_draw_lists [作成回数]
+int main(int argc, char** argv)
+{
+	constexpr uint32_t SEED = 12345;
+
+	// EBlendModeの要素数(Alpha, Add, Mula). EnumInfoはコード生成に依存するので, ここでは直接書く
+	constexpr uint32_t NUM_BLEND_MODES = 3;
+
+	const int num_builds = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+	std::printf("%u slots, %d builds\n", MAX_PARTICLES_NUM, num_builds);
+
+	// 1回目はキャッシュとクロックを温めるために捨てる
+	std::vector<ParticleDrawListsBenchmarkResult> results;
+	ParticleDrawListsVerifier::RunBenchmark(SEED, NUM_BLEND_MODES, num_builds, results);
+	ParticleDrawListsVerifier::RunBenchmark(SEED, NUM_BLEND_MODES, num_builds, results);
+
+	for (const ParticleDrawListsBenchmarkResult& result : results)
+	{
+		std::printf("  %s\n", result.ToString().c_str());
+	}
+	return 0;
+}
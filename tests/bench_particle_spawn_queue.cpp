@@ -0,0 +1,27 @@
+#include "ParticleSpawnQueueVerifier.h"
+#include "Utility/Core/Math/BatchRandomStream.h"
+#include <cstdio>
+#include <cstdlib>
+
+// 要求ごとにパーティクルを作る場合と, ParticleSpawnQueueでまとめて作る場合の1フレームあたりの時間
+// 使い方: bench_particle_spawn_queue_<variant> [エミッターあたりのパーティクル数] [フレーム数]
+int main(int argc, char** argv)
+{
+	constexpr MasterDataID ANIMATION_ID = 1;
+
+	const int num_particles_per_emitter = argc > 1 ? std::atoi(argv[1]) : 8;
+	const int num_frames = argc > 2 ? std::atoi(argv[2]) : 100;
+
+	std::printf("SIMD width %d, %d frames\n", BatchRandomStream::GetSimdWidth(), num_frames);
+
+	// 1回目はキャッシュとクロックを温めるために捨てる
+	std::vector<ParticleSpawnBenchmarkResult> results;
+	ParticleSpawnQueueVerifier::RunBenchmark(ANIMATION_ID, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, num_particles_per_emitter, num_frames, results);
+	ParticleSpawnQueueVerifier::RunBenchmark(ANIMATION_ID, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, num_particles_per_emitter, num_frames, results);
+
+	for (const ParticleSpawnBenchmarkResult& result : results)
+	{
+		std::printf("  %s\n", result.ToString().c_str());
+	}
+	return 0;
+}
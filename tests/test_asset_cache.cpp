@@ -0,0 +1,161 @@
+#include "Utility/AssetCache.h"
+#include "TestCommon.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+	typedef AssetCache<std::string, int> TestCache;
+
+	/// <summary>
+	/// 解放された順にキーを記録するキャッシュ
+	/// </summary>
+	struct RecordingCache
+	{
+		std::vector<std::string> unloaded_keys;
+		TestCache cache;
+
+		explicit RecordingCache(const uint64_t budget_bytes)
+			: cache(budget_bytes, [this](const std::string& key, int&) { unloaded_keys.push_back(key); })
+		{
+		}
+
+		// 読み込んで参照を返す. ゲームでの使い方と同じく, Acquire()で見つからなければInsert()する
+		void Load(const std::string& key, const int value, const uint64_t bytes)
+		{
+			if (cache.Acquire(key) == nullptr)
+			{
+				cache.Insert(key, int(value), bytes);
+			}
+		}
+	};
+
+	void TestIdleEvictionInLruOrder()
+	{
+		RecordingCache recording(300);
+		recording.Load("a", 1, 100);
+		recording.Load("b", 2, 100);
+		recording.Load("c", 3, 100);
+
+		// 参照が無くなった順に並ぶ. "a"は使い直したので, "b"より後で"c"より前になる
+		recording.cache.Release("a");
+		recording.cache.Release("b");
+		recording.Load("a", 1, 100);
+		recording.cache.Release("a");
+		recording.cache.Release("c");
+		CLN2D_CHECK(recording.unloaded_keys.empty());
+		CLN2D_CHECK(recording.cache.GetStats().num_idle == 3);
+
+		// 予算内に収まるまで, 参照されていないものを最も前に使われたものから解放する
+		recording.Load("d", 4, 150);
+		CLN2D_CHECK((recording.unloaded_keys == std::vector<std::string>{ "b", "a" }));
+		CLN2D_CHECK(recording.cache.Find("c") != nullptr);
+		CLN2D_CHECK(recording.cache.Find("a") == nullptr);
+		CLN2D_CHECK(recording.cache.GetStats().resident_bytes == 250);
+	}
+
+	void TestReferencedEntriesSurvive()
+	{
+		// 参照されているものは, 予算を超えても解放しない
+		RecordingCache recording(100);
+		recording.Load("a", 1, 80);
+		recording.Load("b", 2, 80);
+		CLN2D_CHECK(recording.unloaded_keys.empty());
+		CLN2D_CHECK(recording.cache.GetStats().resident_bytes == 160);
+		CLN2D_CHECK(recording.cache.GetRefCount("a") == 1 && recording.cache.GetRefCount("b") == 1);
+
+		// 参照が無くなっても, 次に予算を確かめるまでは残る
+		recording.cache.Release("a");
+		CLN2D_CHECK(recording.cache.Find("a") != nullptr);
+		recording.cache.Trim();
+		CLN2D_CHECK((recording.unloaded_keys == std::vector<std::string>{ "a" }));
+		CLN2D_CHECK(recording.cache.Find("b") != nullptr);
+	}
+
+	void TestSetBudgetTrims()
+	{
+		RecordingCache recording(1000);
+		recording.Load("a", 1, 100);
+		recording.Load("b", 2, 100);
+		recording.Load("c", 3, 100);
+		recording.cache.Release("a");
+		recording.cache.Release("b");
+
+		recording.cache.SetBudget(200);
+		CLN2D_CHECK((recording.unloaded_keys == std::vector<std::string>{ "a" }));
+		CLN2D_CHECK(recording.cache.GetBudget() == 200);
+
+		// 参照されている"c"は残り, 予算を超えたままになる
+		recording.cache.SetBudget(0);
+		CLN2D_CHECK((recording.unloaded_keys == std::vector<std::string>{ "a", "b" }));
+		CLN2D_CHECK(recording.cache.GetStats().resident_bytes == 100);
+		CLN2D_CHECK(recording.cache.Find("c") != nullptr);
+	}
+
+	void TestReleaseEvictedKey()
+	{
+		RecordingCache recording(100);
+		recording.Load("a", 1, 100);
+		recording.cache.Release("a");
+		recording.cache.SetBudget(0);
+		CLN2D_CHECK(recording.cache.Find("a") == nullptr);
+		CLN2D_CHECK(!recording.cache.Release("a"));
+		CLN2D_CHECK(!recording.cache.Release("never_loaded"));
+
+		// Clear()は参照されているものも解放するので, 残っていた参照を返してもfalse
+		recording.Load("b", 2, 50);
+		recording.cache.Clear();
+		CLN2D_CHECK((recording.unloaded_keys == std::vector<std::string>{ "a", "b" }));
+		CLN2D_CHECK(!recording.cache.Release("b"));
+		CLN2D_CHECK(recording.cache.GetRefCount("b") == 0);
+	}
+
+	void TestStats()
+	{
+		RecordingCache recording(200);
+		recording.Load("a", 1, 100);		// ミス
+		recording.Load("a", 1, 100);		// ヒット
+		recording.Load("b", 2, 100);		// ミス
+		CLN2D_CHECK(recording.cache.Find("c") == nullptr);	// Find()は数えない
+
+		AssetCacheStats stats = recording.cache.GetStats();
+		CLN2D_CHECK(stats.num_hits == 1 && stats.num_misses == 2);
+		CLN2D_CHECK(stats.num_evictions == 0);
+		CLN2D_CHECK(stats.num_resident == 2 && stats.num_idle == 0);
+		CLN2D_CHECK(stats.resident_bytes == 200 && stats.budget_bytes == 200);
+
+		recording.cache.Release("a");
+		recording.cache.Release("a");
+		recording.cache.Release("b");
+		stats = recording.cache.GetStats();
+		CLN2D_CHECK(stats.num_idle == 2);
+
+		recording.Load("c", 3, 100);
+		stats = recording.cache.GetStats();
+		CLN2D_CHECK(stats.num_evictions == 1 && stats.num_misses == 3);
+		CLN2D_CHECK(stats.num_resident == 2 && stats.num_idle == 1);
+
+		// 解放数などの累計だけを0に戻す
+		recording.cache.ResetCounters();
+		stats = recording.cache.GetStats();
+		CLN2D_CHECK(stats.num_hits == 0 && stats.num_misses == 0 && stats.num_evictions == 0);
+		CLN2D_CHECK(stats.num_resident == 2 && stats.resident_bytes == 200);
+
+		// Clear()による解放は, 予算を超えたための解放には数えない
+		recording.cache.Clear();
+		stats = recording.cache.GetStats();
+		CLN2D_CHECK(stats.num_evictions == 0);
+		CLN2D_CHECK(stats.num_resident == 0 && stats.num_idle == 0 && stats.resident_bytes == 0);
+	}
+}
+
+int main()
+{
+	TestIdleEvictionInLruOrder();
+	TestReferencedEntriesSurvive();
+	TestSetBudgetTrims();
+	TestReleaseEvictedKey();
+	TestStats();
+
+	return CLN2D_TEST_RESULT();
+}
@@ -0,0 +1,140 @@
+#include "CollisionStressField.h"
+#include "HeadlessTestScene.h"
+#include "GameSystems/CollisionManager.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "TestCommon.h"
+#include <vector>
+
+// 並列ナローフェーズが, シングルスレッドと同じ結果になることのテスト
+// マスターデータを読むため, リポジトリのルートで実行する
+namespace
+{
+	// 並列実行するスレッド数. 実行するマシンのコア数に関わらず, ワークスティーリングが起こる程度に分ける
+	constexpr int NUM_PARALLEL_THREADS = 4;
+
+	constexpr int NUM_TICKS = 60;
+
+	/// <summary>
+	/// num_ticks ティック分の衝突処理の結果. 押し戻しの順序が変われば位置も変わる
+	/// </summary>
+	struct SimulationTrace
+	{
+		std::vector<int> num_hits_per_tick;
+		std::vector<Vector2D> final_positions;
+	};
+
+	CollisionStressFieldParams MakeParams(const CollisionType dynamic_collision_type)
+	{
+		CollisionStressFieldParams params;
+		params.num_dynamic_colliders = 2000;
+		params.num_static_colliders = 2000;
+		params.dynamic_collision_type = dynamic_collision_type;
+		return params;
+	}
+
+	SimulationTrace RunSimulation(CollisionStressField& field, const CollisionStressFieldParams& params, const int num_threads)
+	{
+		CollisionManager::GetInstance().SetNumNarrowPhaseThreads(num_threads);
+		field.Spawn(params);
+
+		SimulationTrace trace;
+		for (int tick = 0; tick < NUM_TICKS; ++tick)
+		{
+			field.MoveColliders();
+			CollisionManager::GetInstance().HandleCollisions();
+			trace.num_hits_per_tick.push_back(CollisionManager::GetInstance().GetStats().num_hits);
+		}
+
+		for (const Actor* const actor : field.GetDynamicActors())
+		{
+			trace.final_positions.push_back(actor->GetActorWorldPosition());
+		}
+		return trace;
+	}
+
+	void TestNumThreads()
+	{
+		CollisionManager& collision_manager = CollisionManager::GetInstance();
+		collision_manager.SetNumNarrowPhaseThreads(NUM_PARALLEL_THREADS);
+		CLN2D_CHECK(collision_manager.GetNumNarrowPhaseThreads() == NUM_PARALLEL_THREADS);
+
+		// 1以下はシングルスレッド
+		collision_manager.SetNumNarrowPhaseThreads(0);
+		CLN2D_CHECK(collision_manager.GetNumNarrowPhaseThreads() == 1);
+		collision_manager.SetNumNarrowPhaseThreads(1);
+		CLN2D_CHECK(collision_manager.GetNumNarrowPhaseThreads() == 1);
+	}
+
+	void TestEveryTickMatchesSerial(CollisionStressField& field, const CollisionType dynamic_collision_type)
+	{
+		CollisionManager::GetInstance().SetNumNarrowPhaseThreads(1);
+		field.Spawn(MakeParams(dynamic_collision_type));
+
+		int num_mismatched_ticks = 0;
+		int total_hits = 0;
+		for (int tick = 0; tick < NUM_TICKS; ++tick)
+		{
+			field.MoveColliders();
+			if (!CollisionManager::GetInstance().DEBUG_VerifyParallelNarrowPhase(NUM_PARALLEL_THREADS))
+			{
+				++num_mismatched_ticks;
+			}
+			CollisionManager::GetInstance().HandleCollisions();
+			total_hits += CollisionManager::GetInstance().GetStats().num_hits;
+		}
+		CLN2D_CHECK(num_mismatched_ticks == 0);
+
+		// 衝突が起きていなければ比較の意味が無い
+		CLN2D_CHECK(total_hits > 0);
+	}
+
+	void TestSameTraceAsSerial(CollisionStressField& field, const CollisionType dynamic_collision_type)
+	{
+		// 押し戻しの結果が次のティックの入力になるので, 結果の並びが1つでも違えば位置がずれる
+		const CollisionStressFieldParams params = MakeParams(dynamic_collision_type);
+		const SimulationTrace serial = RunSimulation(field, params, 1);
+		const SimulationTrace parallel = RunSimulation(field, params, NUM_PARALLEL_THREADS);
+		CLN2D_CHECK(serial.num_hits_per_tick == parallel.num_hits_per_tick);
+		CLN2D_CHECK(serial.final_positions.size() == parallel.final_positions.size());
+
+		int num_mismatched_positions = 0;
+		for (size_t i = 0; i < serial.final_positions.size() && i < parallel.final_positions.size(); ++i)
+		{
+			if (serial.final_positions[i].x != parallel.final_positions[i].x || serial.final_positions[i].y != parallel.final_positions[i].y)
+			{
+				++num_mismatched_positions;
+			}
+		}
+		CLN2D_CHECK(num_mismatched_positions == 0);
+	}
+}
+
+int main()
+{
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+
+	HeadlessTestScene owner_scene;
+	SceneBaseInitialParams scene_params = {};
+	owner_scene.Initialize(&scene_params);
+	CollisionManager::GetInstance().Initialize();
+
+	TestNumThreads();
+	{
+		CollisionStressField field(&owner_scene);
+		for (const CollisionType dynamic_collision_type : { CollisionType::OVERLAP, CollisionType::BLOCK })
+		{
+			TestEveryTickMatchesSerial(field, dynamic_collision_type);
+			TestSameTraceAsSerial(field, dynamic_collision_type);
+		}
+	}
+
+	CollisionManager::GetInstance().SetNumNarrowPhaseThreads(1);
+	CollisionManager::GetInstance().Finalize();
+	owner_scene.Finalize();
+	GraphicResourceManager::GetInstance().Destroy();
+
+	return CLN2D_TEST_RESULT();
+}
@@ -0,0 +1,111 @@
+#include "GameSystems/Headless/CollisionRegression.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "HeadlessTestScene.h"
+#include "TestCommon.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ゴールデンファイルはtests/dataに置く. ステージとマスターデータはリポジトリのルートから読むので, ctestはルートで実行する
+// 衝突処理を変えて挙動が変わった場合は, 変化が意図したものであることを確認してから --write-golden で書き出し直す
+namespace
+{
+	const std::string GOLDEN_FILE_PATH = std::string(COLLON2D_TEST_DATA_DIR) + "collision_regression_golden.txt";
+
+	CollisionRegressionParams MakeParams()
+	{
+		// ブロードフェーズのツリーが数段になるよう, ステージを複製して並べる
+		CollisionRegressionParams params;
+		params.num_stage_copies = 16;
+		params.num_ticks = 240;
+		return params;
+	}
+
+	void TestMatchesGolden(SceneBase* const owner_scene)
+	{
+		CollisionRegression regression(owner_scene);
+		const CollisionRegressionReport report = regression.Run(MakeParams());
+		CLN2D_CHECK(regression.IsStageLoaded());
+		CLN2D_CHECK(report.num_static_colliders > 0);
+		CLN2D_CHECK(report.num_dynamic_colliders > 0);
+
+		// 速度はマシンごとに違うので比較しない
+		std::vector<std::string> mismatches;
+		const bool is_matched = CollisionRegression::CompareWithGoldenFile(GOLDEN_FILE_PATH, report, mismatches, false);
+		CLN2D_CHECK(is_matched);
+		for (const std::string& mismatch : mismatches)
+		{
+			std::fprintf(stderr, "  %s\n", mismatch.c_str());
+		}
+	}
+
+	void TestSameParamsSameHash(SceneBase* const owner_scene)
+	{
+		CollisionRegression regression(owner_scene);
+		const CollisionRegressionReport first = regression.Run(MakeParams());
+		const CollisionRegressionReport second = regression.Run(MakeParams());
+		CLN2D_CHECK(first.behavior_hash == second.behavior_hash);
+		CLN2D_CHECK(first.total_hits == second.total_hits);
+		CLN2D_CHECK(first.total_candidate_pairs == second.total_candidate_pairs);
+	}
+
+	void TestMissingStage(SceneBase* const owner_scene)
+	{
+		CollisionRegressionParams params = MakeParams();
+		params.stage_file_path = "resources/stage_templates/missing_stage.json";
+
+		CollisionRegression regression(owner_scene);
+		const CollisionRegressionReport report = regression.Run(params);
+		CLN2D_CHECK(!regression.IsStageLoaded());
+		CLN2D_CHECK(report.total_hits == 0);
+
+		// 読み込めなかった結果はゴールデンファイルと一致しない
+		std::vector<std::string> mismatches;
+		CLN2D_CHECK(!CollisionRegression::CompareWithGoldenFile(GOLDEN_FILE_PATH, report, mismatches, false));
+		CLN2D_CHECK(!mismatches.empty());
+	}
+
+	void TestMissingGolden(SceneBase* const owner_scene)
+	{
+		CollisionRegression regression(owner_scene);
+		const CollisionRegressionReport report = regression.Run(MakeParams());
+
+		std::vector<std::string> mismatches;
+		CLN2D_CHECK(!CollisionRegression::CompareWithGoldenFile(std::string(COLLON2D_TEST_DATA_DIR) + "missing_golden.txt", report, mismatches, false));
+		CLN2D_CHECK(mismatches.size() == 1);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+
+	HeadlessTestScene owner_scene;
+	SceneBaseInitialParams scene_params = {};
+	owner_scene.Initialize(&scene_params);
+
+	if (argc > 1 && std::strcmp(argv[1], "--write-golden") == 0)
+	{
+		CollisionRegression regression(&owner_scene);
+		const CollisionRegressionReport report = regression.Run(MakeParams());
+		const bool is_written = regression.IsStageLoaded() && CollisionRegression::WriteGoldenFile(GOLDEN_FILE_PATH, report);
+		std::printf("%s %s\n", is_written ? "written" : "FAILED: failed to write", GOLDEN_FILE_PATH.c_str());
+		owner_scene.Finalize();
+		GraphicResourceManager::GetInstance().Destroy();
+		return is_written ? 0 : 1;
+	}
+
+	TestMatchesGolden(&owner_scene);
+	TestSameParamsSameHash(&owner_scene);
+	TestMissingStage(&owner_scene);
+	TestMissingGolden(&owner_scene);
+
+	owner_scene.Finalize();
+	GraphicResourceManager::GetInstance().Destroy();
+
+	return CLN2D_TEST_RESULT();
+}
@@ -0,0 +1,294 @@
+#include "HeadlessTestScene.h"
+#include "Actor/Actor.h"
+#include "Actor/ActorFactory.h"
+#include "Component/Collider/BoxCollider.h"
+#include "Component/Collider/SegmentCollider.h"
+#include "Component/Collider/TriangleCollider.h"
+#include "GameSystems/CollisionManager.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "TestCommon.h"
+#include "Utility/Core/Math/GeometryUtility.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// 連続衝突判定のテスト
+// 高速で落下する飛翔体を, 矩形ブロック・坂(三角形)・薄い足場(線分)に向けて撃ち続け, 標的を通り抜けた数を数える
+// マスターデータを読むため, リポジトリのルートで実行する
+namespace
+{
+	// シミュレーションの固定ステップ
+	constexpr float SIMULATION_DELTA_SECONDS = 1.f / 60.f;
+
+	// レーンの配置. レーンの番号で標的の種類を順に割り当てる
+	constexpr int NUM_LANES = 12;
+	constexpr float LANE_SPACING = 96.f;
+	constexpr float FIRST_LANE_X = 64.f;
+
+	// 飛翔体の発射位置と一辺の長さ, 速さ. 1ティックの移動量は標的の厚さより十分大きい
+	constexpr float PROJECTILE_START_Y = 64.f;
+	constexpr float PROJECTILE_EXTENT = 8.f;
+	constexpr float PROJECTILE_SPEED = 3000.f;
+
+	// 標的の上端と幅
+	constexpr float TARGET_TOP_Y = 400.f;
+	constexpr float TARGET_WIDTH = 64.f;
+
+	// 矩形ブロックの厚さと坂の高さ
+	constexpr float RECT_TARGET_THICKNESS = 16.f;
+	constexpr float SLOPE_TARGET_HEIGHT = 32.f;
+
+	// 飛翔体の上端がこれを超えたら標的を通り抜けたとみなす
+	constexpr float TUNNELED_Y = TARGET_TOP_Y + SLOPE_TARGET_HEIGHT + 32.f;
+
+	// 押し戻しで動いたとみなす距離
+	constexpr float PUSHED_DISTANCE_THRESHOLD = 0.01f;
+
+	constexpr int NUM_TICKS = 600;
+
+	enum TargetKind : int
+	{
+		TARGET_RECT,
+		TARGET_SLOPE,
+		TARGET_SEGMENT,
+		NUM_TARGET_KINDS
+	};
+
+	struct ShootingResult
+	{
+		int num_shots[NUM_TARGET_KINDS];
+		int num_tunneled[NUM_TARGET_KINDS];
+	};
+
+	void TestSweepConvexPolygonAgainstAnother()
+	{
+		// 1辺10の正方形. 左上から時計回り
+		const Vector2D box[4] = { Vector2D(0, 0), Vector2D(10, 0), Vector2D(10, 10), Vector2D(0, 10) };
+
+		// 1回の移動で通り抜けてしまう厚さ2の壁. 右端(x=10)が壁の左面(x=50)に届くのは移動量の40%の時点
+		{
+			const Vector2D wall[4] = { Vector2D(50, -20), Vector2D(52, -20), Vector2D(52, 20), Vector2D(50, 20) };
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(GeometricUtility::SweepConvexPolygonAgainstAnother(box, 4, Vector2D(100, 0), wall, 4, toi, normal));
+			CLN2D_CHECK_NEAR(toi, 0.4f, 1e-4f);
+			CLN2D_CHECK_NEAR(normal.x, -1.f, 1e-4f);
+			CLN2D_CHECK_NEAR(normal.y, 0.f, 1e-4f);
+		}
+
+		// 厚さゼロの線分
+		{
+			const Vector2D segment[2] = { Vector2D(50, -20), Vector2D(50, 20) };
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(GeometricUtility::SweepConvexPolygonAgainstAnother(box, 4, Vector2D(100, 0), segment, 2, toi, normal));
+			CLN2D_CHECK_NEAR(toi, 0.4f, 1e-4f);
+			CLN2D_CHECK_NEAR(normal.x, -1.f, 1e-4f);
+		}
+
+		// 線分の上を斜めに通過して接触しない
+		{
+			const Vector2D segment[2] = { Vector2D(50, -20), Vector2D(50, 20) };
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(!GeometricUtility::SweepConvexPolygonAgainstAnother(box, 4, Vector2D(100, -100), segment, 2, toi, normal));
+		}
+
+		// 45度の坂に真上から落下する. 右下の頂点(70, -100)が斜辺(x + y = 100)上の(70, 30)に届く時点で, 法線は斜辺の左上向き
+		{
+			const Vector2D slope[3] = { Vector2D(0, 100), Vector2D(100, 0), Vector2D(100, 100) };
+			const Vector2D falling_box[4] = { Vector2D(60, -110), Vector2D(70, -110), Vector2D(70, -100), Vector2D(60, -100) };
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(GeometricUtility::SweepConvexPolygonAgainstAnother(falling_box, 4, Vector2D(0, 300), slope, 3, toi, normal));
+			CLN2D_CHECK_NEAR(toi, 130.f / 300.f, 1e-4f);
+			CLN2D_CHECK_NEAR(normal.x, -0.70710678f, 1e-4f);
+			CLN2D_CHECK_NEAR(normal.y, -0.70710678f, 1e-4f);
+		}
+
+		// 移動開始時点で重なっている場合は離散判定に任せる
+		{
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(!GeometricUtility::SweepConvexPolygonAgainstAnother(box, 4, Vector2D(100, 0), box, 4, toi, normal));
+		}
+
+		// 移動量が足りず届かない
+		{
+			const Vector2D wall[4] = { Vector2D(50, -20), Vector2D(52, -20), Vector2D(52, 20), Vector2D(50, 20) };
+			float toi = 0.f;
+			Vector2D normal;
+			CLN2D_CHECK(!GeometricUtility::SweepConvexPolygonAgainstAnother(box, 4, Vector2D(30, 0), wall, 4, toi, normal));
+		}
+	}
+
+	/// <summary>
+	/// 各レーンの標的に向けて飛翔体を num_ticks ティック分撃ち続け, 標的で止まった数と通り抜けた数を数える
+	/// </summary>
+	ShootingResult RunShooting(SceneBase* const owner_scene, const bool is_continuous_collision_enabled)
+	{
+		std::mt19937 engine(12345);
+		std::vector<Actor*> actors;
+		const auto spawn_actor = [owner_scene, &actors](const Vector2D& position)
+			{
+				initial_params_of_actor_t<Actor> actor_params;
+				actor_params.transform.position = position;
+				Actor* const actor = ActorFactory::CreateAndInitializeActor<Actor>(&actor_params, owner_scene);
+				actors.push_back(actor);
+				return actor;
+			};
+
+		// 標的はSTATICなので, ツリーの構築前に生成する
+		CollisionManager::GetInstance().DestructTree();
+		for (int lane_index = 0; lane_index < NUM_LANES; ++lane_index)
+		{
+			Actor* const target = spawn_actor(Vector2D(FIRST_LANE_X + LANE_SPACING * lane_index, TARGET_TOP_Y));
+			ColliderBase* target_collider = nullptr;
+			switch (lane_index % NUM_TARGET_KINDS)
+			{
+			case TARGET_RECT:
+			{
+				BoxCollider* const box = target->CreateComponent<BoxCollider>(target);
+				box->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false, Vector2D(TARGET_WIDTH, RECT_TARGET_THICKNESS));
+				box->SetLocalPosition(Vector2D(0.f, RECT_TARGET_THICKNESS * 0.5f));
+				target_collider = box;
+				break;
+			}
+			case TARGET_SLOPE:
+			{
+				// 左下がりの坂
+				TriangleCollider* const triangle = target->CreateComponent<TriangleCollider>(target);
+				triangle->SetTriangleColliderParams(
+					CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false,
+					{ Vector2D(-TARGET_WIDTH * 0.5f, SLOPE_TARGET_HEIGHT), Vector2D(TARGET_WIDTH * 0.5f, 0.f), Vector2D(TARGET_WIDTH * 0.5f, SLOPE_TARGET_HEIGHT) }
+				);
+				target_collider = triangle;
+				break;
+			}
+			default:
+			{
+				// すり抜け床と同じ, 厚さのない足場
+				SegmentCollider* const segment = target->CreateComponent<SegmentCollider>(target);
+				segment->SetSegmentColliderParams(CollisionType::BLOCK, CollisionObjectType::GROUND, { CollisionObjectType::ENEMY }, false, TARGET_WIDTH);
+				target_collider = segment;
+				break;
+			}
+			}
+			target_collider->SetMobility(ColliderMobility::STATIC);
+		}
+		CollisionManager::GetInstance().ConstructTree();
+
+		const float step = PROJECTILE_SPEED * SIMULATION_DELTA_SECONDS;
+		std::vector<Actor*> projectiles;
+		std::vector<BoxCollider*> projectile_colliders;
+		const auto reload_projectile = [&](const int lane_index)
+			{
+				// 発射位置は1ティックの移動量の範囲でずらす
+				const float y = PROJECTILE_START_Y - std::uniform_real_distribution<float>(0.f, step)(engine);
+				projectiles[lane_index]->SetActorWorldPosition(Vector2D(FIRST_LANE_X + LANE_SPACING * lane_index, y));
+
+				// ワープなので, 移動経路上の衝突を検出しないようにする
+				projectile_colliders[lane_index]->ResetContinuousCollisionSweep();
+			};
+
+		for (int lane_index = 0; lane_index < NUM_LANES; ++lane_index)
+		{
+			Actor* const projectile = spawn_actor(Vector2D());
+			BoxCollider* const collider = projectile->CreateComponent<BoxCollider>(projectile);
+			collider->SetBoxColliderParams(CollisionType::BLOCK, CollisionObjectType::ENEMY, { CollisionObjectType::GROUND }, true, Vector2D(PROJECTILE_EXTENT, PROJECTILE_EXTENT));
+			collider->SetContinuousCollisionEnabled(is_continuous_collision_enabled);
+			projectiles.push_back(projectile);
+			projectile_colliders.push_back(collider);
+			reload_projectile(lane_index);
+		}
+
+		ShootingResult result{};
+		for (int tick = 0; tick < NUM_TICKS; ++tick)
+		{
+			std::vector<Vector2D> expected_positions(NUM_LANES);
+			for (int lane_index = 0; lane_index < NUM_LANES; ++lane_index)
+			{
+				projectiles[lane_index]->AddWorldPosition(Vector2D(0.f, step));
+				expected_positions[lane_index] = projectiles[lane_index]->GetActorWorldPosition();
+			}
+
+			CollisionManager::GetInstance().HandleCollisions();
+
+			for (int lane_index = 0; lane_index < NUM_LANES; ++lane_index)
+			{
+				const Vector2D position = projectiles[lane_index]->GetActorWorldPosition();
+				const Vector2D push_back = position - expected_positions[lane_index];
+				const bool is_pushed = push_back.Length() > PUSHED_DISTANCE_THRESHOLD;
+
+				// 離散判定では, 深くめり込むと標的の向こう側へ押し出されることがあるので, それも通り抜けとして数える
+				const bool has_tunneled =
+					position.y - PROJECTILE_EXTENT * 0.5f > TUNNELED_Y ||
+					(is_pushed && push_back.y > 0.f);
+				if (!is_pushed && !has_tunneled)
+				{
+					continue;
+				}
+
+				// 標的に止められたか, 通り抜けたら1発として数えて撃ち直す
+				const int target_kind = lane_index % NUM_TARGET_KINDS;
+				++result.num_shots[target_kind];
+				if (has_tunneled)
+				{
+					++result.num_tunneled[target_kind];
+				}
+				reload_projectile(lane_index);
+			}
+		}
+
+		for (Actor*& actor : actors)
+		{
+			actor->Finalize();
+			ActorFactory::DestroyActor(actor);
+		}
+		return result;
+	}
+
+	void TestContinuousCollisionReducesTunneling(SceneBase* const owner_scene)
+	{
+		const ShootingResult discrete = RunShooting(owner_scene, false);
+		const ShootingResult continuous = RunShooting(owner_scene, true);
+		for (int kind = 0; kind < NUM_TARGET_KINDS; ++kind)
+		{
+			CLN2D_CHECK(discrete.num_shots[kind] > 0);
+			CLN2D_CHECK(continuous.num_shots[kind] > 0);
+			const double discrete_ratio = static_cast<double>(discrete.num_tunneled[kind]) / discrete.num_shots[kind];
+			const double continuous_ratio = static_cast<double>(continuous.num_tunneled[kind]) / continuous.num_shots[kind];
+			std::printf("target %d: tunneled discrete %.0f%%, continuous %.0f%%\n", kind, discrete_ratio * 100.0, continuous_ratio * 100.0);
+
+			// NOTE: 移動後の位置で標的と重なっていれば離散判定の結果を優先するので, 標的の中心を越えて重なった場合は向こう側へ押し出される
+			// 連続衝突判定で通り抜けがゼロにはならないが, 離散判定の半分未満にはなる
+			CLN2D_CHECK(continuous_ratio < discrete_ratio * 0.5);
+		}
+
+		// 厚さのない足場は, 離散判定ではほとんど通り抜ける
+		CLN2D_CHECK(discrete.num_tunneled[TARGET_SEGMENT] * 10 > discrete.num_shots[TARGET_SEGMENT] * 9);
+	}
+}
+
+int main()
+{
+	TestSweepConvexPolygonAgainstAnother();
+
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+
+	HeadlessTestScene owner_scene;
+	SceneBaseInitialParams scene_params = {};
+	owner_scene.Initialize(&scene_params);
+	CollisionManager::GetInstance().Initialize();
+
+	TestContinuousCollisionReducesTunneling(&owner_scene);
+
+	CollisionManager::GetInstance().Finalize();
+	owner_scene.Finalize();
+	GraphicResourceManager::GetInstance().Destroy();
+
+	return CLN2D_TEST_RESULT();
+}
@@ -0,0 +1,144 @@
+#include "GameSystems/ParticleManager/CpuParticleSimulator.h"
+#include "CpuParticleSimulatorVerifier.h"
+#include "TestCommon.h"
+#include <vector>
+
+namespace
+{
+	constexpr int NUM_FRAMES = 3000;
+	constexpr float DELTA_SECONDS = 1.f / 60.f;
+	constexpr float GRAVITY_FORCE_Y = 980.f;
+
+	Particle MakeParticle(const float life_time)
+	{
+		Particle particle;
+		particle.life_time = life_time;
+		particle.vel = Particle::float2(60.f, -120.f);
+		particle.gravity_scale = 1.f;
+		return particle;
+	}
+
+	bool IsSameParticle(const Particle& a, const Particle& b)
+	{
+		return a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.vel.x == b.vel.x && a.vel.y == b.vel.y
+			&& a.age == b.age && a.alpha == b.alpha && a.i_frame == b.i_frame && a.packed_data == b.packed_data;
+	}
+
+	void TestPool()
+	{
+		CpuParticleSimulator simulator(3);
+		CLN2D_CHECK(simulator.GetCapacity() == 3);
+		CLN2D_CHECK(simulator.GetPoolCount() == 3);
+		CLN2D_CHECK(simulator.GetNumActiveParticles() == 0);
+
+		// 足りなければ1つも取り出さない
+		const std::vector<Particle> particles(4, MakeParticle(1.f));
+		CLN2D_CHECK(!simulator.Spawn(particles.data(), 4));
+		CLN2D_CHECK(simulator.GetPoolCount() == 3);
+
+		// 小さいスロットから使う
+		CLN2D_CHECK(simulator.Spawn(particles.data(), 1));
+		CLN2D_CHECK(simulator.GetParticle(0).packed_data & Particle::is_active_mask);
+		CLN2D_CHECK((simulator.GetParticle(1).packed_data & Particle::is_active_mask) == 0);
+
+		CLN2D_CHECK(simulator.Spawn(particles.data(), 2));
+		CLN2D_CHECK(simulator.GetPoolCount() == 0);
+		CLN2D_CHECK(!simulator.Spawn(particles.data(), 1));
+
+		simulator.DeactivateAll();
+		CLN2D_CHECK(simulator.GetPoolCount() == 3);
+		for (uint32_t i = 0; i < simulator.GetCapacity(); i++)
+		{
+			CLN2D_CHECK((simulator.GetPackedData()[i] & Particle::is_active_mask) == 0);
+		}
+		CLN2D_CHECK(simulator.Spawn(particles.data(), 3));
+	}
+
+	void TestRetire()
+	{
+		// 寿命を迎えたティックでプールに戻り, 次のSpawnで使える
+		CpuParticleSimulator simulator(2);
+		const Particle particle = MakeParticle(DELTA_SECONDS * 2.f);
+		CLN2D_CHECK(simulator.Spawn(&particle, 1));
+
+		simulator.Tick(DELTA_SECONDS, 0.f, GRAVITY_FORCE_Y);
+		CLN2D_CHECK(simulator.GetNumActiveParticles() == 1);
+		simulator.Tick(DELTA_SECONDS, 0.f, GRAVITY_FORCE_Y);
+		CLN2D_CHECK(simulator.GetNumActiveParticles() == 0);
+		CLN2D_CHECK((simulator.GetParticle(0).packed_data & Particle::is_active_mask) == 0);
+
+		const std::vector<Particle> particles(2, particle);
+		CLN2D_CHECK(simulator.Spawn(particles.data(), 2));
+	}
+
+	void TestLastSlotMatchesReference()
+	{
+		// SIMD幅の倍数にならない容量で, 余りのレーンと同じ幅に入る最後のスロットを参照実装と比べる
+		const uint32_t capacity = static_cast<uint32_t>(CpuParticleSimulator::GetSimdWidth()) + 1;
+		CpuParticleSimulator simulator(capacity);
+		const std::vector<Particle> particles(capacity - 1, MakeParticle(0.5f));
+		CLN2D_CHECK(simulator.Spawn(particles.data(), capacity - 1));
+
+		// 小さいスロットから使うので, 最後に取り出されるのは最後のスロット
+		Particle reference = MakeParticle(1.f);
+		reference.num_anim_frames = 3;
+		CLN2D_CHECK(simulator.Spawn(&reference, 1));
+		reference.SetIsActive(1);
+
+		int num_mismatched_ticks = 0;
+		for (int tick = 0; tick < 90; tick++)
+		{
+			simulator.Tick(DELTA_SECONDS, 0.f, GRAVITY_FORCE_Y);
+			CpuParticleSimulator::TickParticleReference(reference, DELTA_SECONDS, 0.f, GRAVITY_FORCE_Y);
+			if (!IsSameParticle(simulator.GetParticle(capacity - 1), reference))
+			{
+				num_mismatched_ticks++;
+			}
+		}
+		CLN2D_CHECK(num_mismatched_ticks == 0);
+
+		// max_loopが1なので最後のフレームで止まり, 寿命の後半でフェードアウトしている
+		CLN2D_CHECK(reference.i_frame == 2);
+		CLN2D_CHECK(reference.alpha < 1.f);
+	}
+
+	void TestInfiniteLoop()
+	{
+		// max_loopが0なら, 寿命までフレームが進み続ける
+		CpuParticleSimulator simulator(1);
+		Particle particle = MakeParticle(1.f);
+		particle.num_anim_frames = 2;
+		particle.SetMaxLoop(0);
+		CLN2D_CHECK(simulator.Spawn(&particle, 1));
+
+		for (int tick = 0; tick < 45; tick++)
+		{
+			simulator.Tick(DELTA_SECONDS, 0.f, 0.f);
+		}
+		CLN2D_CHECK(simulator.GetParticle(0).i_frame > particle.num_anim_frames);
+	}
+}
+
+int main()
+{
+	std::printf("SIMD width %d\n", CpuParticleSimulator::GetSimdWidth());
+
+	TestPool();
+	TestRetire();
+	TestLastSlotMatchesReference();
+	TestInfiniteLoop();
+
+	// SIMD幅の倍数にならない容量と, プールが枯渇する小さな容量も試す
+	RunValidationForEach(
+		"capacity",
+		{ 1u, 7u, 61u, 1000u },
+		[](const uint32_t capacity) { return CpuParticleSimulatorVerifier::RunValidation(12345, capacity, NUM_FRAMES); },
+		[](const CpuParticleValidationReport& report)
+		{
+			CLN2D_CHECK(report.num_failures == 0);
+			CLN2D_CHECK(report.num_spawned > 0 && report.num_retired > 0);
+		}
+	);
+
+	return CLN2D_TEST_RESULT();
+}
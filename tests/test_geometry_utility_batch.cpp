@@ -0,0 +1,181 @@
+#include "Utility/Core/Math/GeometryUtilityBatch.h"
+#include "GeometryUtilityBatchVerifier.h"
+#include "TestCommon.h"
+#include <vector>
+
+namespace
+{
+	constexpr int NUM_ITERATIONS = 20000;
+
+	// 原点を覆う矩形と重ならないよう, 遠くに置く矩形
+	const FRect FAR_RECT(Vector2D(1000.f, 1000.f), 10.f, 10.f, 0.f);
+
+	void TestEmptyBatch()
+	{
+		FRectBatch rects;
+		FSegmentBatch segments;
+		CLN2D_CHECK(rects.Size() == 0 && segments.Size() == 0);
+
+		// 前の結果が残っていても, 空のバッチなら0個になる
+		std::vector<uint32_t> masks(4, 0xffffffffu);
+		CLN2D_CHECK(GeometricUtilityBatch::DoesRectOverlapWithBatch(FRect(Vector2D(), 10.f, 10.f, 0.f), rects, masks) == 0);
+		CLN2D_CHECK(masks.empty());
+
+		masks.assign(4, 0xffffffffu);
+		CLN2D_CHECK(GeometricUtilityBatch::DoesSegmentIntersectWithBatch(FSegment(Vector2D(), Vector2D(10.f, 10.f)), segments, masks) == 0);
+		CLN2D_CHECK(masks.empty());
+	}
+
+	void TestPaddingIsNotHit()
+	{
+		// 末尾の余りは中心が原点の大きさ0の矩形と同じ値なので, 原点を覆う矩形で判定しても重ならないこと
+		const FRect query(Vector2D(), 20.f, 20.f, 0.f);
+		const int simd_width = GeometricUtilityBatch::GetSimdWidth();
+		for (const int size : { 1, simd_width - 1, simd_width + 1 })
+		{
+			if (size <= 0)
+			{
+				continue;
+			}
+
+			FRectBatch batch;
+			for (int i = 0; i < size; i++)
+			{
+				batch.Add(FAR_RECT);
+			}
+			CLN2D_CHECK(batch.Size() == static_cast<size_t>(size));
+			CLN2D_CHECK(batch.center_x.size() % 8 == 0 && batch.center_x.size() >= batch.Size());
+
+			std::vector<uint32_t> masks;
+			CLN2D_CHECK(GeometricUtilityBatch::DoesRectOverlapWithBatch(query, batch, masks) == 0);
+			CLN2D_CHECK(masks.size() == 1 && masks[0] == 0u);
+		}
+	}
+
+	void TestMaskWordBoundary()
+	{
+		// 32個目と33個目は次のワードに入る
+		const FRect query(Vector2D(), 20.f, 20.f, 0.f);
+		for (const size_t size : { 31u, 32u, 33u })
+		{
+			FRectBatch batch;
+			for (size_t i = 0; i < size; i++)
+			{
+				batch.Add(i % 2 == 0 ? query : FAR_RECT);
+			}
+
+			std::vector<uint32_t> masks;
+			const int num_hits = GeometricUtilityBatch::DoesRectOverlapWithBatch(query, batch, masks);
+			CLN2D_CHECK(masks.size() == (size + 31) / 32);
+			CLN2D_CHECK(num_hits == static_cast<int>((size + 1) / 2));
+			for (size_t i = 0; i < size; i++)
+			{
+				CLN2D_CHECK(GeometricUtilityBatch::IsHit(masks, i) == (i % 2 == 0));
+			}
+		}
+	}
+
+	void TestRectOverlap()
+	{
+		const FRect query(Vector2D(), 20.f, 10.f, 0.f);
+		const std::vector<FRect> others = {
+			query,													// 同じ矩形
+			FRect(Vector2D(16.f, 0.f), 20.f, 10.f, 0.f),			// x方向に4めり込む
+			FRect(Vector2D(25.f, 0.f), 20.f, 10.f, 0.f),			// x方向に5離れている
+			FRect(Vector2D(0.f, 3.f), 20.f, 10.f, 1.f),				// 回転している
+		};
+
+		FRectBatch batch;
+		for (const FRect& other : others)
+		{
+			batch.Add(other);
+		}
+
+		std::vector<uint32_t> masks;
+		std::vector<Vector2D> depths(batch.Size());
+		CLN2D_CHECK(GeometricUtilityBatch::DoesRectOverlapWithBatch(query, batch, masks, depths.data()) == 3);
+		CLN2D_CHECK(!GeometricUtilityBatch::IsHit(masks, 2));
+		CLN2D_CHECK_NEAR(depths[1].x, 4.f, 1e-4);
+		CLN2D_CHECK_NEAR(depths[1].y, 0.f, 1e-4);
+
+		// 重なっている矩形のめり込み深度は, スカラー版とほぼ同じ値になる
+		for (const size_t i : { 0u, 1u, 3u })
+		{
+			Vector2D scalar_depth;
+			CLN2D_CHECK(GeometricUtilityBatch::IsHit(masks, i));
+			CLN2D_CHECK(GeometricUtility::DoesRectOverlapWithAnother(query, others[i], &scalar_depth));
+			CLN2D_CHECK_NEAR(depths[i].x, scalar_depth.x, 1e-3);
+			CLN2D_CHECK_NEAR(depths[i].y, scalar_depth.y, 1e-3);
+		}
+	}
+
+	void TestSegmentIntersection()
+	{
+		const FSegment query(Vector2D(0.f, 0.f), Vector2D(10.f, 10.f));
+
+		FSegmentBatch batch;
+		batch.Add(FSegment(Vector2D(0.f, 10.f), Vector2D(10.f, 0.f)));		// (5, 5)で交差する
+		batch.Add(FSegment(Vector2D(1.f, 0.f), Vector2D(11.f, 10.f)));		// 平行
+		batch.Add(FSegment(Vector2D(20.f, 0.f), Vector2D(20.f, 10.f)));		// 延長線上でしか交わらない
+
+		std::vector<uint32_t> masks;
+		std::vector<Vector2D> positions(batch.Size());
+		CLN2D_CHECK(GeometricUtilityBatch::DoesSegmentIntersectWithBatch(query, batch, masks, positions.data()) == 1);
+		CLN2D_CHECK(GeometricUtilityBatch::IsHit(masks, 0));
+		CLN2D_CHECK(!GeometricUtilityBatch::IsHit(masks, 1));
+		CLN2D_CHECK(!GeometricUtilityBatch::IsHit(masks, 2));
+		CLN2D_CHECK_NEAR(positions[0].x, 5.f, 1e-5);
+		CLN2D_CHECK_NEAR(positions[0].y, 5.f, 1e-5);
+
+		// 交点はスカラー版と一致する
+		Vector2D scalar_position;
+		CLN2D_CHECK(GeometricUtility::DoesSegmentIntersectWithAnother(scalar_position, query, FSegment(Vector2D(0.f, 10.f), Vector2D(10.f, 0.f))));
+		CLN2D_CHECK(positions[0].x == scalar_position.x && positions[0].y == scalar_position.y);
+	}
+
+	void TestClear()
+	{
+		FRectBatch batch;
+		batch.Add(FRect(Vector2D(), 10.f, 10.f, 0.f));
+		batch.Clear();
+		CLN2D_CHECK(batch.Size() == 0);
+
+		// 消した矩形と重ならない
+		batch.Add(FAR_RECT);
+		std::vector<uint32_t> masks;
+		CLN2D_CHECK(GeometricUtilityBatch::DoesRectOverlapWithBatch(FRect(Vector2D(), 10.f, 10.f, 0.f), batch, masks) == 0);
+
+		FSegmentBatch segments;
+		segments.AddRectEdges(FRect(Vector2D(), 10.f, 10.f, 0.f));
+		CLN2D_CHECK(segments.Size() == 4);
+		segments.Clear();
+		CLN2D_CHECK(segments.Size() == 0);
+	}
+}
+
+int main()
+{
+	std::printf("SIMD width %d\n", GeometricUtilityBatch::GetSimdWidth());
+
+	TestEmptyBatch();
+	TestPaddingIsNotHit();
+	TestMaskWordBoundary();
+	TestRectOverlap();
+	TestSegmentIntersection();
+	TestClear();
+
+	// バッチ版とスカラー版の結果が境界付近を除いて一致すること
+	RunValidationForSeeds(
+		[](const uint32_t seed) { return GeometricUtilityBatchVerifier::RunFuzzer(seed, NUM_ITERATIONS); },
+		[](const GeometryBatchFuzzReport& report)
+		{
+			CLN2D_CHECK(report.num_failures == 0);
+			CLN2D_CHECK(report.num_rect_tests > 0 && report.num_segment_tests > 0);
+
+			// 境界付近として見逃す不一致は, ごく一部であること
+			CLN2D_CHECK(report.num_borderline * 1000 < report.num_rect_tests);
+		}
+	);
+
+	return CLN2D_TEST_RESULT();
+}
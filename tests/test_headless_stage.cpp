@@ -0,0 +1,129 @@
+#include "GameSystems/Headless/HeadlessPlatform.h"
+#include "GameSystems/Headless/HeadlessRunner.h"
+#include "GameSystems/FontManager.h"
+#include "GameSystems/GameConfig/GameConfig.h"
+#include "GameSystems/GraphicResourceManager/GraphResourceManager.h"
+#include "GameSystems/MasterData/MasterDataInclude.h"
+#include "GameSystems/ParticleManager/ParticleManager.h"
+#include "SystemTypes.h"
+#include "TestCommon.h"
+#include <imgui.h>
+#include <stdexcept>
+#include <string>
+
+// テスト用のステージとスクリプトはtests/dataに置く. マスターデータはリポジトリのルートから読むので, ctestはルートで実行する
+namespace
+{
+	const std::string TEST_STAGE_UUID = "3f2b8c1e-5a7d-4e9b-8c21-6d0f4a9e7b13";
+	const std::string TEST_STAGES_DIR = std::string(COLLON2D_TEST_DATA_DIR) + "stages/";
+	// 右に歩いてゴールし, 結果画面で"ステージ選択"を選ぶ
+	const std::string CLEAR_AND_SELECT_SCRIPT_PATH = std::string(COLLON2D_TEST_DATA_DIR) + "input_clear_and_select.json";
+
+	// 右に歩いてゴールし, 結果画面で"リトライ"を選ぶ
+	const std::string CLEAR_AND_RETRY_SCRIPT_PATH = std::string(COLLON2D_TEST_DATA_DIR) + "input_clear_and_retry.json";
+
+	HeadlessRunParams MakeRunParams(const float simulated_seconds, const std::string& input_script_path)
+	{
+		HeadlessRunParams params;
+		params.stage_id = StageId(TEST_STAGE_UUID);
+		params.simulated_seconds = simulated_seconds;
+		params.frame_seconds = 1.f / FRAME_RATE;
+		params.input_script_path = input_script_path;
+		params.should_continue_on_retry = false;
+		return params;
+	}
+
+	void TestIdleRun()
+	{
+		// キーを何も押さなければ, プレイヤーはゴールに届かずに時間を進めきる
+		const HeadlessRunReport report = HeadlessRunner::Run(MakeRunParams(2.f, std::string()));
+		CLN2D_CHECK(report.exit_scene_type == SceneType::INGAME_SCENE);
+		CLN2D_CHECK(report.num_stage_loads == 1);
+		CLN2D_CHECK(report.num_frames >= 2 * FRAME_RATE);
+		CLN2D_CHECK(report.num_world_steps > 0);
+		CLN2D_CHECK_NEAR(report.simulated_seconds, 2.0, 1.0 / FRAME_RATE);
+
+		// プレイヤー, ゴール, 床, コイン2枚
+		CLN2D_CHECK(report.max_num_actors >= 5);
+	}
+
+	void TestClearAndSelect()
+	{
+		const HeadlessRunReport report = HeadlessRunner::Run(MakeRunParams(20.f, CLEAR_AND_SELECT_SCRIPT_PATH));
+		CLN2D_CHECK(report.exit_scene_type == SceneType::SELECT_SCENE);
+		CLN2D_CHECK(report.num_stage_loads == 1);
+		CLN2D_CHECK(report.simulated_seconds < 20.0);
+	}
+
+	void TestClearAndRetry()
+	{
+		// リトライで終了する設定なら, リトライを要求したところで終わる
+		const HeadlessRunReport stopped = HeadlessRunner::Run(MakeRunParams(20.f, CLEAR_AND_RETRY_SCRIPT_PATH));
+		CLN2D_CHECK(stopped.exit_scene_type == SceneType::MSG_RELOAD);
+		CLN2D_CHECK(stopped.num_stage_loads == 1);
+
+		// 続ける設定なら, ステージを読み込み直してスクリプトを最初からやり直す
+		HeadlessRunParams params = MakeRunParams(20.f, CLEAR_AND_RETRY_SCRIPT_PATH);
+		params.should_continue_on_retry = true;
+		const HeadlessRunReport continued = HeadlessRunner::Run(params);
+		CLN2D_CHECK(continued.exit_scene_type == SceneType::INGAME_SCENE);
+		CLN2D_CHECK(continued.num_stage_loads == 3);
+		CLN2D_CHECK_NEAR(continued.simulated_seconds, 20.0, 1.0 / FRAME_RATE);
+	}
+
+	void TestSameInputSameFrames()
+	{
+		// 同じスクリプトなら, 同じフレームで同じシーンへの遷移を要求する
+		const HeadlessRunReport first = HeadlessRunner::Run(MakeRunParams(20.f, CLEAR_AND_SELECT_SCRIPT_PATH));
+		const HeadlessRunReport second = HeadlessRunner::Run(MakeRunParams(20.f, CLEAR_AND_SELECT_SCRIPT_PATH));
+		CLN2D_CHECK(first.exit_scene_type == second.exit_scene_type);
+		CLN2D_CHECK(first.num_frames == second.num_frames);
+		CLN2D_CHECK(first.num_world_steps == second.num_world_steps);
+	}
+
+	void TestInvalidStageId()
+	{
+		bool is_thrown = false;
+		try
+		{
+			HeadlessRunParams params = MakeRunParams(1.f, std::string());
+			params.stage_id = StageId::NONE;
+			HeadlessRunner::Run(params);
+		}
+		catch (const std::runtime_error&)
+		{
+			is_thrown = true;
+		}
+		CLN2D_CHECK(is_thrown);
+	}
+}
+
+int main()
+{
+	LoadAllMasterData();
+	HeadlessPlatform::Enable();
+	ResourcePaths::Dir::STAGES = TEST_STAGES_DIR.c_str();
+
+	GameConfig::GetInstance().Init();
+	if (!ParticleManager::GetInstance().Init(EParticleBackend::CPU))
+	{
+		std::fprintf(stderr, "failed to initialize ParticleManager\n");
+		return 1;
+	}
+
+	// Main.cppのRunHeadless()と同じく, シーンのTick()で使うImGuiのコンテキストとフォントを用意する
+	ImGui::CreateContext();
+	FontManager::GetInstance().AddFontsFromMasterData();
+
+	TestIdleRun();
+	TestClearAndSelect();
+	TestClearAndRetry();
+	TestSameInputSameFrames();
+	TestInvalidStageId();
+
+	ImGui::DestroyContext();
+	GraphicResourceManager::GetInstance().Destroy();
+	ParticleManager::GetInstance().End();
+
+	return CLN2D_TEST_RESULT();
+}
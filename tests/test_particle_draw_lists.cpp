@@ -0,0 +1,152 @@
+#include "GameSystems/ParticleManager/ParticleDrawLists.h"
+#include "GameSystems/ParticleManager/Particle/Particle.h"
+#include "ParticleDrawListsVerifier.h"
+#include "TestCommon.h"
+#include <vector>
+
+namespace
+{
+	constexpr int NUM_ITERATIONS = 2000;
+
+	constexpr uint32_t NUM_BLEND_MODES = 2;
+	constexpr uint32_t NUM_TEXTURES = 3;
+
+	constexpr uint32_t INACTIVE = 0;
+
+	uint32_t MakeActive(const uint32_t blend_mode, const uint32_t i_texture)
+	{
+		return (1u << Particle::is_active_shift) | (blend_mode << Particle::blend_mode_shift) | (i_texture << Particle::i_texture_shift);
+	}
+
+	std::vector<uint32_t> GetGroupIndices(const ParticleDrawLists& lists, const uint32_t blend_mode, const uint32_t i_texture)
+	{
+		const ParticleDrawLists::Range range = lists.GetGroupRange(blend_mode, i_texture);
+		return std::vector<uint32_t>(lists.GetIndices() + range.offset, lists.GetIndices() + range.offset + range.count);
+	}
+
+	void TestEmpty()
+	{
+		ParticleDrawLists lists(NUM_BLEND_MODES, NUM_TEXTURES);
+
+		// 前回の結果が残らないこと
+		const std::vector<uint32_t> packed_data = { MakeActive(0, 0), MakeActive(1, 2) };
+		lists.Build(packed_data.data(), static_cast<uint32_t>(packed_data.size()));
+		CLN2D_CHECK(lists.GetNumLiveParticles() == 2);
+
+		const std::vector<uint32_t> empty;
+		lists.Build(empty.data(), 0);
+		CLN2D_CHECK(lists.GetNumLiveParticles() == 0);
+		CLN2D_CHECK(lists.GetNumRejectedParticles() == 0);
+		for (uint32_t blend_mode = 0; blend_mode < NUM_BLEND_MODES; blend_mode++)
+		{
+			CLN2D_CHECK(lists.GetBlendModeRange(blend_mode).count == 0);
+		}
+
+		// 全て非アクティブ
+		const std::vector<uint32_t> inactive(20, INACTIVE);
+		lists.Build(inactive.data(), static_cast<uint32_t>(inactive.size()));
+		CLN2D_CHECK(lists.GetNumLiveParticles() == 0);
+	}
+
+	void TestAllLive()
+	{
+		ParticleDrawLists lists(NUM_BLEND_MODES, NUM_TEXTURES);
+		const std::vector<uint32_t> packed_data(16, MakeActive(1, 1));
+		lists.Build(packed_data.data(), static_cast<uint32_t>(packed_data.size()));
+
+		CLN2D_CHECK(lists.GetNumLiveParticles() == 16);
+		const std::vector<uint32_t> indices = GetGroupIndices(lists, 1, 1);
+		CLN2D_CHECK(indices.size() == 16);
+		for (uint32_t i = 0; i < indices.size(); i++)
+		{
+			CLN2D_CHECK(indices[i] == i);
+		}
+		CLN2D_CHECK(lists.GetBlendModeRange(0).count == 0);
+		CLN2D_CHECK(lists.GetBlendModeRange(1).offset == 0 && lists.GetBlendModeRange(1).count == 16);
+	}
+
+	void TestPartialBlock()
+	{
+		// 8個ずつ読み飛ばすブロックに収まらない末尾と, 8個未満の配列
+		ParticleDrawLists lists(NUM_BLEND_MODES, NUM_TEXTURES);
+		for (const uint32_t num_particles : { 3u, 13u })
+		{
+			std::vector<uint32_t> packed_data(num_particles, INACTIVE);
+			packed_data.back() = MakeActive(0, 2);
+			lists.Build(packed_data.data(), num_particles);
+
+			CLN2D_CHECK(lists.GetNumLiveParticles() == 1);
+			const std::vector<uint32_t> indices = GetGroupIndices(lists, 0, 2);
+			CLN2D_CHECK(indices.size() == 1 && indices[0] == num_particles - 1);
+		}
+	}
+
+	void TestRejection()
+	{
+		ParticleDrawLists lists(NUM_BLEND_MODES, NUM_TEXTURES);
+		const std::vector<uint32_t> packed_data = {
+			MakeActive(NUM_BLEND_MODES, 0),
+			MakeActive(0, NUM_TEXTURES),
+			MakeActive(0xFF, 0xFF),
+			MakeActive(NUM_BLEND_MODES - 1, NUM_TEXTURES - 1),
+			NUM_BLEND_MODES << Particle::blend_mode_shift,		// 非アクティブなら範囲外でも数えない
+		};
+		lists.Build(packed_data.data(), static_cast<uint32_t>(packed_data.size()));
+
+		CLN2D_CHECK(lists.GetNumRejectedParticles() == 3);
+		CLN2D_CHECK(lists.GetNumLiveParticles() == 1);
+		const std::vector<uint32_t> indices = GetGroupIndices(lists, NUM_BLEND_MODES - 1, NUM_TEXTURES - 1);
+		CLN2D_CHECK(indices.size() == 1 && indices[0] == 3);
+	}
+
+	void TestOrder()
+	{
+		// ブレンドモード, テクスチャ, インデックスの昇順に並ぶ
+		ParticleDrawLists lists(NUM_BLEND_MODES, NUM_TEXTURES);
+		const std::vector<uint32_t> packed_data = {
+			MakeActive(1, 0),	// 0
+			MakeActive(0, 2),	// 1
+			INACTIVE,			// 2
+			MakeActive(1, 0),	// 3
+			MakeActive(0, 0),	// 4
+			MakeActive(0, 2),	// 5
+			MakeActive(1, 2),	// 6
+			MakeActive(0, 0),	// 7
+			MakeActive(0, 1),	// 8
+		};
+		lists.Build(packed_data.data(), static_cast<uint32_t>(packed_data.size()));
+
+		const std::vector<uint32_t> expected = { 4, 7, 8, 1, 5, 0, 3, 6 };
+		CLN2D_CHECK(lists.GetNumLiveParticles() == expected.size());
+		CLN2D_CHECK(std::vector<uint32_t>(lists.GetIndices(), lists.GetIndices() + lists.GetNumLiveParticles()) == expected);
+
+		// ブレンドモードごとの範囲は, そのブレンドモードの全てのグループを連続して含む
+		const ParticleDrawLists::Range blend_mode_0 = lists.GetBlendModeRange(0);
+		const ParticleDrawLists::Range blend_mode_1 = lists.GetBlendModeRange(1);
+		CLN2D_CHECK(blend_mode_0.offset == 0 && blend_mode_0.count == 5);
+		CLN2D_CHECK(blend_mode_1.offset == 5 && blend_mode_1.count == 3);
+		CLN2D_CHECK(GetGroupIndices(lists, 0, 1) == std::vector<uint32_t>{ 8 });
+		CLN2D_CHECK(GetGroupIndices(lists, 1, 1).empty());
+	}
+}
+
+int main()
+{
+	TestEmpty();
+	TestAllLive();
+	TestPartialBlock();
+	TestRejection();
+	TestOrder();
+
+	// 全てのグループのリストが総当たりで作ったものと並び順も含めて一致すること
+	RunValidationForSeeds(
+		[](const uint32_t seed) { return ParticleDrawListsVerifier::RunValidation(seed, NUM_ITERATIONS); },
+		[](const ParticleDrawListsValidationReport& report)
+		{
+			CLN2D_CHECK(report.num_failures == 0);
+			CLN2D_CHECK(report.num_live_particles > 0);
+		}
+	);
+
+	return CLN2D_TEST_RESULT();
+}
@@ -0,0 +1,188 @@
+#include "GameSystems/ParticleManager/ParticleSpawnQueue.h"
+#include "ParticleSpawnQueueVerifier.h"
+#include "Utility/Core/Math/BatchRandomStream.h"
+#include "TestCommon.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+	constexpr int NUM_ITERATIONS = 500;
+
+	// 範囲を持たない要求. 位置のxで, どの要求から作られたパーティクルかを見分ける
+	ParticleSpawnRequest MakeFixedRequest(const MasterDataID animation_id, const uint32_t num_spawn, const float position_x)
+	{
+		ParticleSpawnRequest request = {};
+		request.animation_id = animation_id;
+		request.num_spawn = num_spawn;
+		request.position_x = position_x;
+		request.velocity_direction_x = 1.f;
+		request.size_min = 8.f;
+		request.life_time_min = 2.f;
+		request.gravity_scale_min = 0.5f;
+		request.speed_min = 100.f;
+		return request;
+	}
+
+	void TestEmpty()
+	{
+		ParticleSpawnQueue queue(4, 16);
+		CLN2D_CHECK(queue.IsEmpty());
+
+		int num_resolved = 0;
+		const auto resolve_animation = [&num_resolved](const MasterDataID animation_id)
+			{
+				num_resolved++;
+				return ParticleSpawnQueueVerifier::MakeSyntheticAnimation(animation_id);
+			};
+
+		ParticleSpawnStats stats;
+		CLN2D_CHECK(queue.Build(1, 16, resolve_animation, stats) == 0);
+		CLN2D_CHECK(queue.GetNumParticles() == 0);
+		CLN2D_CHECK(stats.num_requests == 0 && stats.num_dropped_requests == 0);
+		CLN2D_CHECK(stats.num_particles == 0 && stats.num_dropped_particles == 0);
+		CLN2D_CHECK(num_resolved == 0);
+	}
+
+	void TestFixedValues()
+	{
+		// 範囲が0なら乱数によらず最小値になり, 角度の範囲が0なら初速度は向きのまま
+		ParticleSpawnQueue queue(4, 16);
+		CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(3, 2, 10.f)));
+
+		ParticleSpawnStats stats;
+		CLN2D_CHECK(queue.Build(7, 16, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, stats) == 2);
+		const ParticleSpawnAnimation animation = ParticleSpawnQueueVerifier::MakeSyntheticAnimation(3);
+		for (uint32_t i = 0; i < queue.GetNumParticles(); i++)
+		{
+			const Particle& p = queue.GetParticles()[i];
+			CLN2D_CHECK(p.pos.x == 10.f && p.pos.y == 0.f);
+			CLN2D_CHECK(p.size == 8.f && p.life_time == 2.f && p.gravity_scale == 0.5f);
+			CLN2D_CHECK(p.vel.x == 100.f && p.vel.y == 0.f);
+			CLN2D_CHECK(p.anim_first_frame == animation.anim_first_frame && p.num_anim_frames == animation.num_anim_frames);
+			CLN2D_CHECK(((p.packed_data & Particle::blend_mode_mask) >> Particle::blend_mode_shift) == animation.blend_mode);
+			CLN2D_CHECK(((p.packed_data & Particle::i_texture_mask) >> Particle::i_texture_shift) == animation.texture_index);
+			CLN2D_CHECK((p.packed_data & Particle::max_loop_mask) == 0);
+			CLN2D_CHECK((p.packed_data & Particle::is_active_mask) == 0);
+		}
+	}
+
+	void TestDropInOrder()
+	{
+		// 追加された順に, 入りきらない要求だけを捨てる. 後の小さな要求は作られる
+		ParticleSpawnQueue queue(4, 16);
+		CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(1, 6, 0.f)));
+		CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(1, 5, 1.f)));
+		CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(1, 3, 2.f)));
+
+		ParticleSpawnStats stats;
+		CLN2D_CHECK(queue.Build(1, 10, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, stats) == 9);
+		CLN2D_CHECK(stats.num_requests == 3 && stats.num_dropped_requests == 1);
+		CLN2D_CHECK(stats.num_particles == 9 && stats.num_dropped_particles == 5);
+		for (uint32_t i = 0; i < queue.GetNumParticles(); i++)
+		{
+			CLN2D_CHECK(queue.GetParticles()[i].pos.x == (i < 6 ? 0.f : 2.f));
+		}
+
+		// 要求数の上限
+		ParticleSpawnQueue small_queue(2, 16);
+		CLN2D_CHECK(small_queue.Enqueue(MakeFixedRequest(1, 1, 0.f)));
+		CLN2D_CHECK(small_queue.Enqueue(MakeFixedRequest(1, 1, 0.f)));
+		CLN2D_CHECK(!small_queue.Enqueue(MakeFixedRequest(1, 1, 0.f)));
+		small_queue.Clear();
+		CLN2D_CHECK(small_queue.IsEmpty());
+		CLN2D_CHECK(small_queue.GetNumParticles() == 0);
+	}
+
+	void TestResolveAnimationOnce()
+	{
+		// 1回のBuild()の中では, アニメーションIDごとに1回だけ解決する
+		ParticleSpawnQueue queue(8, 32);
+		for (const MasterDataID animation_id : { 5ul, 9ul, 5ul, 5ul, 9ul })
+		{
+			CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(animation_id, 2, 0.f)));
+		}
+
+		std::vector<MasterDataID> resolved_ids;
+		const auto resolve_animation = [&resolved_ids](const MasterDataID animation_id)
+			{
+				resolved_ids.push_back(animation_id);
+				return ParticleSpawnQueueVerifier::MakeSyntheticAnimation(animation_id);
+			};
+
+		ParticleSpawnStats stats;
+		CLN2D_CHECK(queue.Build(1, 32, resolve_animation, stats) == 10);
+		CLN2D_CHECK((resolved_ids == std::vector<MasterDataID>{ 5, 9 }));
+
+		// 次のBuild()では解決し直す
+		CLN2D_CHECK(queue.Enqueue(MakeFixedRequest(5, 1, 0.f)));
+		queue.Build(1, 32, resolve_animation, stats);
+		CLN2D_CHECK((resolved_ids == std::vector<MasterDataID>{ 5, 9, 5 }));
+	}
+
+	void TestRandomStream()
+	{
+		// 同じシードからは同じ列. NUM_LANESの倍数でない長さは, 倍数の長さの先頭と一致する
+		constexpr size_t NUM_VALUES = BatchRandomStream::NUM_LANES * 2;
+		std::vector<float> values(NUM_VALUES);
+		std::vector<float> partial_values(NUM_VALUES - 3);
+		BatchRandomStream(42).FillUniform(values.data(), values.size());
+		BatchRandomStream(42).FillUniform(partial_values.data(), partial_values.size());
+		CLN2D_CHECK(std::equal(partial_values.begin(), partial_values.end(), values.begin()));
+
+		for (const float value : values)
+		{
+			CLN2D_CHECK(0.f <= value && value < 1.f);
+		}
+
+		std::vector<float> other_values(NUM_VALUES);
+		BatchRandomStream(43).FillUniform(other_values.data(), other_values.size());
+		CLN2D_CHECK(other_values != values);
+	}
+
+	void TestDroppedStats()
+	{
+		// 捨てた要求も統計に含まれ, 次のBuild()には残らない
+		ParticleSpawnQueue queue(2, 16);
+		ParticleSpawnRequest request = {};
+		request.animation_id = 1;
+		request.num_spawn = 10;
+		CLN2D_CHECK(queue.Enqueue(request));
+		CLN2D_CHECK(!queue.Enqueue(request));	// パーティクル数の上限を超える
+		request.num_spawn = 0;
+		CLN2D_CHECK(!queue.Enqueue(request));
+
+		ParticleSpawnStats stats;
+		CLN2D_CHECK(queue.Build(1, 4, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, stats) == 0);	// プールが足りない
+		CLN2D_CHECK(stats.num_requests == 2 && stats.num_dropped_requests == 2);
+		CLN2D_CHECK(stats.num_particles == 0 && stats.num_dropped_particles == 20);
+		CLN2D_CHECK(queue.IsEmpty());
+
+		queue.Build(1, 16, ParticleSpawnQueueVerifier::MakeSyntheticAnimation, stats);
+		CLN2D_CHECK(stats.num_requests == 0 && stats.num_dropped_requests == 0 && stats.num_particles == 0);
+	}
+}
+
+int main()
+{
+	std::printf("SIMD width %d\n", BatchRandomStream::GetSimdWidth());
+
+	TestEmpty();
+	TestFixedValues();
+	TestDropInOrder();
+	TestResolveAnimationOnce();
+	TestRandomStream();
+	TestDroppedStats();
+
+	// 値が要求の範囲に収まり, 同じシードから同じ値が作られ, 乱数列が参照実装と一致すること
+	RunValidationForSeeds(
+		[](const uint32_t seed) { return ParticleSpawnQueueVerifier::RunValidation(seed, NUM_ITERATIONS); },
+		[](const ParticleSpawnValidationReport& report)
+		{
+			CLN2D_CHECK(report.num_failures == 0);
+			CLN2D_CHECK(report.num_checked_particles > 0 && report.num_checked_random_values > 0);
+		}
+	);
+
+	return CLN2D_TEST_RESULT();
+}
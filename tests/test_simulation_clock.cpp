@@ -0,0 +1,74 @@
+#include "GameSystems/SimulationClock.h"
+#include "TestCommon.h"
+
+namespace
+{
+	void TestFixedStep()
+	{
+		SimulationClock clock;
+		clock.SetStepsPerSecond(120.f);
+
+		// 60fpsのフレームは2ステップ
+		CLN2D_CHECK(clock.Advance(1.f / 60.f) == 2);
+		CLN2D_CHECK_NEAR(clock.GetStepSeconds(), 1.f / 120.f, 1e-7);
+
+		// 240fpsのフレームは2回に1回だけステップを進め, その間は補間する
+		CLN2D_CHECK(clock.Advance(1.f / 240.f) == 0);
+		CLN2D_CHECK_NEAR(clock.GetInterpolationAlpha(), 0.5f, 1e-3);
+		CLN2D_CHECK(clock.Advance(1.f / 240.f) == 1);
+		CLN2D_CHECK_NEAR(clock.GetInterpolationAlpha(), 0.f, 1e-3);
+
+		CLN2D_CHECK(clock.GetStats().num_frames_without_step == 1);
+		CLN2D_CHECK(clock.GetStats().num_total_steps == 3);
+	}
+
+	void TestStepCap()
+	{
+		SimulationClock clock;
+		clock.SetStepsPerSecond(100.f);
+		clock.SetMaxStepsPerFrame(4);
+
+		// 1秒のヒッチでも4ステップまでしか進めず, 残りは捨てる
+		CLN2D_CHECK(clock.Advance(1.f) == 4);
+		CLN2D_CHECK(clock.GetStats().num_capped_frames == 1);
+		CLN2D_CHECK_NEAR(clock.GetStats().dropped_seconds, 0.96f, 1e-3);
+
+		// 捨てた時間は次のフレームに持ち越さない
+		CLN2D_CHECK(clock.Advance(0.01f) == 1);
+	}
+
+	void TestVariableStep()
+	{
+		SimulationClock clock;
+		clock.SetFixedStepEnabled(false);
+
+		CLN2D_CHECK(clock.Advance(0.033f) == 1);
+		CLN2D_CHECK_NEAR(clock.GetStepSeconds(), 0.033f, 1e-7);
+		CLN2D_CHECK_NEAR(clock.GetInterpolationAlpha(), 1.f, 0.0);
+	}
+
+	void TestLongRunDoesNotDrift()
+	{
+		// ヘッドレス実行と同じく, 一定の経過時間で長時間進めてもステップ数がずれない
+		SimulationClock clock;
+		clock.SetStepsPerSecond(120.f);
+
+		uint64_t num_steps = 0;
+		constexpr int NUM_FRAMES = 60 * 60 * 10;
+		for (int i = 0; i < NUM_FRAMES; i++)
+		{
+			num_steps += clock.Advance(1.f / 60.f);
+		}
+		CLN2D_CHECK(num_steps == NUM_FRAMES * 2);
+		CLN2D_CHECK(clock.GetStats().num_capped_frames == 0);
+	}
+}
+
+int main()
+{
+	TestFixedStep();
+	TestStepCap();
+	TestVariableStep();
+	TestLongRunDoesNotDrift();
+	return CLN2D_TEST_RESULT();
+}
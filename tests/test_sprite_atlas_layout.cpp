@@ -0,0 +1,167 @@
+#include "GameSystems/ParticleManager/TextureLoader/SpriteAtlasLayout.h"
+#include "TestCommon.h"
+#include <random>
+
+namespace
+{
+	// 2つのスプライトの間にpadding以上の隙間があるか
+	bool IsSeparated(const SpriteAtlasEntry& a, const SpriteAtlasEntry& b, const uint32_t padding)
+	{
+		return a.page != b.page
+			|| a.x + a.width + padding <= b.x || b.x + b.width + padding <= a.x
+			|| a.y + a.height + padding <= b.y || b.y + b.height + padding <= a.y;
+	}
+
+	// ページの端との間にpadding以上の隙間があるか
+	bool IsInPage(const SpriteAtlasLayout& layout, const SpriteAtlasEntry& entry)
+	{
+		const uint32_t padding = layout.GetPadding();
+		return entry.page < layout.GetNumPages()
+			&& entry.x >= padding && entry.y >= padding
+			&& entry.x + entry.width + padding <= layout.GetPageWidth()
+			&& entry.y + entry.height + padding <= layout.GetPageHeight();
+	}
+
+	bool IsSamePlacement(const SpriteAtlasEntry& a, const SpriteAtlasEntry& b)
+	{
+		return a.sprite_id == b.sprite_id && a.index == b.index && a.page == b.page
+			&& a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+	}
+
+	void TestSingleSprite()
+	{
+		SpriteAtlasLayout layout(256, 128, 2, 8, 2);
+		CLN2D_CHECK(layout.GetNumPages() == 0);
+		CLN2D_CHECK(layout.GetOccupancy() == 0.f);
+		CLN2D_CHECK(layout.Find(42) == nullptr);
+
+		// 最初のスプライトはページの左上から, パディングだけ空けて置く
+		const SpriteAtlasEntry* entry = layout.Add(42, 64, 32);
+		CLN2D_CHECK(entry != nullptr);
+		if (entry != nullptr)
+		{
+			CLN2D_CHECK(entry->sprite_id == 42);
+			CLN2D_CHECK(entry->index == 0);
+			CLN2D_CHECK(entry->page == 0);
+			CLN2D_CHECK(entry->x == 2 && entry->y == 2);
+			CLN2D_CHECK(entry->width == 64 && entry->height == 32);
+		}
+		CLN2D_CHECK(layout.Find(42) == entry);
+		CLN2D_CHECK(layout.GetNumPages() == 1);
+		CLN2D_CHECK(layout.GetUsedTexels() == 64 * 32);
+		CLN2D_CHECK_NEAR(layout.GetOccupancy(), 64.0 * 32.0 / (256.0 * 128.0), 1e-6);
+
+		// 配置済みなら大きさが違っても置き直さない
+		CLN2D_CHECK(layout.Add(42, 16, 16) == entry);
+		CLN2D_CHECK(layout.GetEntries().size() == 1);
+
+		layout.Clear();
+		CLN2D_CHECK(layout.Find(42) == nullptr);
+		CLN2D_CHECK(layout.GetEntries().empty());
+		CLN2D_CHECK(layout.GetNumPages() == 0);
+		CLN2D_CHECK(layout.GetUsedTexels() == 0);
+	}
+
+	void TestRejection()
+	{
+		SpriteAtlasLayout layout(64, 64, 1, 3, 1);
+
+		// パディングを含めてページに収まらない, または大きさ0
+		CLN2D_CHECK(layout.Add(1, 63, 8) == nullptr);
+		CLN2D_CHECK(layout.Add(2, 8, 63) == nullptr);
+		CLN2D_CHECK(layout.Add(3, 0, 8) == nullptr);
+		CLN2D_CHECK(layout.Add(4, 62, 62) != nullptr);
+		CLN2D_CHECK(layout.GetNumPages() == 1);
+
+		// ページ数が上限なので, 小さくても置けない
+		CLN2D_CHECK(layout.Add(5, 1, 1) == nullptr);
+		CLN2D_CHECK(layout.Find(5) == nullptr);
+		CLN2D_CHECK(layout.GetEntries().size() == 1);
+
+		// スプライト数の上限
+		SpriteAtlasLayout small_layout(64, 64, 4, 2, 1);
+		CLN2D_CHECK(small_layout.Add(1, 4, 4) != nullptr);
+		CLN2D_CHECK(small_layout.Add(2, 4, 4) != nullptr);
+		CLN2D_CHECK(small_layout.Add(3, 4, 4) == nullptr);
+	}
+
+	void TestNewPage()
+	{
+		// 1ページに1つしか置けない大きさなら, ページを順に使う
+		SpriteAtlasLayout layout(64, 64, 3, 8, 2);
+		for (uint64_t sprite_id = 0; sprite_id < 3; sprite_id++)
+		{
+			const SpriteAtlasEntry* entry = layout.Add(sprite_id, 40, 40);
+			CLN2D_CHECK(entry != nullptr && entry->page == sprite_id);
+		}
+		CLN2D_CHECK(layout.Add(3, 40, 40) == nullptr);
+
+		// 空いている場所があれば, 前のページに戻って置く
+		const SpriteAtlasEntry* entry = layout.Add(4, 16, 16);
+		CLN2D_CHECK(entry != nullptr && entry->page == 0);
+	}
+
+	void TestRandomSprites(const uint32_t seed)
+	{
+		std::mt19937 engine(seed);
+		const uint32_t padding = std::uniform_int_distribution<uint32_t>(0, 4)(engine);
+		SpriteAtlasLayout layout(256, 256, 4, 64, padding);
+		const uint32_t max_size = layout.GetPageWidth() - padding * 2;
+
+		std::vector<SpriteAtlasEntry> placed;
+		for (uint64_t sprite_id = 1; sprite_id <= 200; sprite_id++)
+		{
+			// 大きいスプライトも時々混ぜる
+			const uint32_t size_limit = std::uniform_int_distribution<uint32_t>(0, 9)(engine) == 0 ? max_size + 8 : 64;
+			const uint32_t width = std::uniform_int_distribution<uint32_t>(1, size_limit)(engine);
+			const uint32_t height = std::uniform_int_distribution<uint32_t>(1, size_limit)(engine);
+			const uint32_t num_pages = layout.GetNumPages();
+
+			const SpriteAtlasEntry* entry = layout.Add(sprite_id, width, height);
+			if (entry == nullptr)
+			{
+				// 置けないのは, ページより大きいか, 空きがなく新しいページも使えない場合だけ
+				CLN2D_CHECK(width > max_size || height > max_size || placed.size() == layout.GetMaxEntries() || num_pages == layout.GetMaxPages());
+				CLN2D_CHECK(layout.Find(sprite_id) == nullptr);
+				continue;
+			}
+
+			CLN2D_CHECK(entry->index == placed.size());
+			CLN2D_CHECK(IsInPage(layout, *entry));
+			for (const SpriteAtlasEntry& other : placed)
+			{
+				CLN2D_CHECK(IsSeparated(*entry, other, padding));
+			}
+			placed.push_back(*entry);
+
+			// 追加し直しても同じ配置を返し, 置いたスプライトは動かない
+			CLN2D_CHECK(layout.Add(sprite_id, width, height) == entry);
+			CLN2D_CHECK(layout.GetEntries().size() == placed.size());
+			for (size_t i = 0; i < placed.size(); i++)
+			{
+				CLN2D_CHECK(IsSamePlacement(layout.GetEntries().at(i), placed.at(i)));
+			}
+		}
+
+		uint64_t used_texels = 0;
+		for (const SpriteAtlasEntry& entry : placed)
+		{
+			used_texels += static_cast<uint64_t>(entry.width) * entry.height;
+			CLN2D_CHECK(layout.Find(entry.sprite_id) == &layout.GetEntries().at(entry.index));
+		}
+		CLN2D_CHECK(layout.GetUsedTexels() == used_texels);
+		CLN2D_CHECK(layout.GetOccupancy() > 0.f && layout.GetOccupancy() <= 1.f);
+	}
+}
+
+int main()
+{
+	TestSingleSprite();
+	TestRejection();
+	TestNewPage();
+	for (uint32_t seed = 1; seed <= 16; seed++)
+	{
+		TestRandomSprites(seed);
+	}
+	return CLN2D_TEST_RESULT();
+}